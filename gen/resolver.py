@@ -0,0 +1,138 @@
+# Copyright 2021 xensik. All rights reserved.
+#
+# Use of this source code is governed by a GNU GPLv3 license
+# that can be found in the LICENSE file.
+
+# Builds the minimal perfect hash tables used by resolver.cpp for
+# name -> id lookups. Keys are hashed pre-lowercased (except opcodes),
+# duplicates keep the first entry of the list, like the old maps did.
+#
+# usage: python3 resolver.py <game> <src/game/xsk dir>
+
+import re
+import sys
+
+TABLES = [('opcode', False), ('function', True), ('method', True), ('file', True), ('token', True)]
+
+def seed_hash(data, seed):
+    value = 0x811C9DC5 ^ seed
+    for c in data:
+        value ^= c
+        value = (value * 0x01000193) & 0xFFFFFFFF
+    value ^= value >> 16
+    value = (value * 0x85EBCA6B) & 0xFFFFFFFF
+    value ^= value >> 13
+    value = (value * 0xC2B2AE35) & 0xFFFFFFFF
+    value ^= value >> 16
+    return value
+
+def unescape(value):
+    if '\\' in value and re.search(r'\\[^\\"]', value):
+        raise ValueError('unsupported escape in "%s"' % value)
+    return value.replace('\\"', '"').replace('\\\\', '\\')
+
+def parse_list(source, name):
+    match = re.search(r'std::array<pair_\w+, (\d+)> %s_list\s*\{\{(.*?)\}\};' % name, source, re.S)
+    if match is None:
+        raise ValueError('%s_list not found' % name)
+    values = []
+    for line in match.group(2).split('\n'):
+        line = line.strip()
+        if not line or line.startswith('//'):
+            continue
+        entry = re.match(r'\{\s*[^,]+?\s*,\s*"((?:[^"\\]|\\.)*)"\s*\}', line)
+        if entry is None:
+            raise ValueError('bad %s_list entry: %s' % (name, line))
+        values.append(unescape(entry.group(1)))
+    if len(values) != int(match.group(1)):
+        raise ValueError('%s_list size mismatch' % name)
+    return values
+
+def build(values, lower):
+    keys = []
+    seen = set()
+    for index, value in enumerate(values):
+        key = value.lower() if lower else value
+        if key in seen:
+            continue
+        seen.add(key)
+        keys.append((key.encode('latin-1'), index))
+
+    count = len(keys)
+    buckets = [[] for _ in range(max(1, count // 4))]
+    for key, index in keys:
+        buckets[seed_hash(key, 0) % len(buckets)].append((key, index))
+
+    seeds = [0] * len(buckets)
+    slots = [None] * count
+    order = sorted(range(len(buckets)), key=lambda b: -len(buckets[b]))
+
+    for b in order:
+        bucket = buckets[b]
+        if len(bucket) <= 1:
+            break
+        seed = 1
+        while True:
+            used = set()
+            for key, _ in bucket:
+                slot = seed_hash(key, seed) % count
+                if slots[slot] is not None or slot in used:
+                    break
+                used.add(slot)
+            else:
+                break
+            seed += 1
+        for key, index in bucket:
+            slots[seed_hash(key, seed) % count] = index
+        seeds[b] = seed
+
+    free = [slot for slot in range(count) if slots[slot] is None]
+    for b in order:
+        bucket = buckets[b]
+        if len(bucket) != 1:
+            continue
+        slot = free.pop()
+        slots[slot] = bucket[0][1]
+        seeds[b] = -slot - 1
+
+    return seeds, slots
+
+def emit_array(out, type, name, data):
+    out.append('constexpr std::array<%s, %d> %s' % (type, len(data), name))
+    out.append('{{')
+    for i in range(0, len(data), 16):
+        out.append('    ' + ', '.join(str(v) for v in data[i:i + 16]) + ',')
+    out.append('}};')
+    out.append('')
+
+def main():
+    game, path = sys.argv[1], sys.argv[2]
+    source = open(path + '/resolver.cpp', encoding='latin-1').read()
+
+    out = [
+        '// Copyright 2021 xensik. All rights reserved.',
+        '//',
+        '// Use of this source code is governed by a GNU GPLv3 license',
+        '// that can be found in the LICENSE file.',
+        '',
+        '// generated by gen/resolver.py, do not edit',
+        '',
+        '#pragma once',
+        '',
+        'namespace xsk::gsc::%s' % game,
+        '{',
+        '',
+    ]
+
+    for name, lower in TABLES:
+        seeds, slots = build(parse_list(source, name), lower)
+        emit_array(out, 'std::int32_t', '%s_hash_seeds' % name, seeds)
+        emit_array(out, 'std::uint32_t', '%s_hash_slots' % name, slots)
+
+    out.append('} // namespace xsk::gsc::%s' % game)
+
+    with open(path + '/resolver_hash.hpp', 'w', newline='\n') as file:
+        file.write('\n'.join(out) + '\n')
+
+if __name__ == '__main__':
+    main()
@@ -88,6 +88,51 @@ project "xsk-gsc-tool"
 
     zlib:link()
 
+project "xsk-gsc-bench"
+    kind "ConsoleApp"
+    language "C++"
+    targetname "gsc-bench"
+
+    dependson "xsk-gsc-utils"
+    dependson "xsk-gsc-iw5"
+    dependson "xsk-gsc-iw6"
+    dependson "xsk-gsc-iw7"
+    dependson "xsk-gsc-iw8"
+    dependson "xsk-gsc-s1"
+    dependson "xsk-gsc-s2"
+    dependson "xsk-gsc-s4"
+    dependson "xsk-gsc-h1"
+    dependson "xsk-gsc-h2"
+
+    pchheader "stdafx.hpp"
+    pchsource "src/bench/stdafx.cpp"
+
+    files {
+        "./src/bench/**.h",
+        "./src/bench/**.hpp",
+        "./src/bench/**.cpp"
+    }
+
+    links {
+        "xsk-gsc-utils",
+        "xsk-gsc-iw5",
+        "xsk-gsc-iw6",
+        "xsk-gsc-iw7",
+        "xsk-gsc-iw8",
+        "xsk-gsc-s1",
+        "xsk-gsc-s2",
+        "xsk-gsc-s4",
+        "xsk-gsc-h1",
+        "xsk-gsc-h2"
+    }
+
+    includedirs {
+        "./src/bench",
+        "./src"
+    }
+
+    zlib:link()
+
 project "xsk-gsc-utils"
     kind "StaticLib"
     language "C++"
@@ -0,0 +1,398 @@
+// Copyright 2021 xensik. All rights reserved.
+//
+// Use of this source code is governed by a GNU GPLv3 license
+// that can be found in the LICENSE file.
+
+#include "stdafx.hpp"
+
+#include "utils/xsk/utils.hpp"
+#include "iw5/xsk/iw5.hpp"
+#include "iw6/xsk/iw6.hpp"
+#include "iw7/xsk/iw7.hpp"
+#include "iw8/xsk/iw8.hpp"
+#include "s1/xsk/s1.hpp"
+#include "s2/xsk/s2.hpp"
+#include "s4/xsk/s4.hpp"
+#include "h1/xsk/h1.hpp"
+#include "h2/xsk/h2.hpp"
+
+namespace xsk::gsc
+{
+
+struct engines
+{
+    assembler::ptr assembler;
+    disassembler::ptr disassembler;
+    compiler::ptr compiler;
+};
+
+std::uint32_t rounds = 0;
+
+// a fresh set per call, the way every gsc-tool run starts
+auto make_engines(const std::string& game) -> engines
+{
+    if (game == "iw5") return { std::make_unique<iw5::assembler>(), std::make_unique<iw5::disassembler>(), std::make_unique<iw5::compiler>(build::prod) };
+    if (game == "iw6") return { std::make_unique<iw6::assembler>(), std::make_unique<iw6::disassembler>(), std::make_unique<iw6::compiler>(build::prod) };
+    if (game == "iw7") return { std::make_unique<iw7::assembler>(), std::make_unique<iw7::disassembler>(), std::make_unique<iw7::compiler>(build::prod) };
+    if (game == "iw8") return { std::make_unique<iw8::assembler>(), std::make_unique<iw8::disassembler>(), std::make_unique<iw8::compiler>(build::prod) };
+    if (game == "s1") return { std::make_unique<s1::assembler>(), std::make_unique<s1::disassembler>(), std::make_unique<s1::compiler>(build::prod) };
+    if (game == "s2") return { std::make_unique<s2::assembler>(), std::make_unique<s2::disassembler>(), std::make_unique<s2::compiler>(build::prod) };
+    if (game == "s4") return { std::make_unique<s4::assembler>(), std::make_unique<s4::disassembler>(), std::make_unique<s4::compiler>(build::prod) };
+    if (game == "h1") return { std::make_unique<h1::assembler>(), std::make_unique<h1::disassembler>(), std::make_unique<h1::compiler>(build::prod) };
+    if (game == "h2") return { std::make_unique<h2::assembler>(), std::make_unique<h2::disassembler>(), std::make_unique<h2::compiler>(build::prod) };
+
+    throw std::runtime_error("unknown game '" + game + "'");
+}
+
+auto elapsed_ms(std::chrono::steady_clock::time_point start) -> double
+{
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+// only local calls, not every game's resolver knows the same builtins
+const auto small_script = R"(main()
+{
+    level.players = [];
+    level.origins = [];
+    level thread on_connect();
+
+    for (i = 0; i < 10; i++)
+    {
+        level.players[i] = player_name(i);
+        level.origins[i] = (0, 0, i * 8);
+    }
+
+    wait 0.05;
+    level notify("started");
+}
+
+player_name(i)
+{
+    return "player_" + i;
+}
+
+on_connect()
+{
+    level endon("game_ended");
+
+    for (;;)
+    {
+        level waittill("connected", player);
+        player thread on_spawn();
+    }
+}
+
+on_spawn()
+{
+    self endon("disconnect");
+    self waittill("spawned_player");
+    self.origin = self.origin + (0, 0, 16);
+    self.welcome = "welcome " + self.name;
+}
+)"s;
+
+// compiles and assembles a small script with new engines each run, most of the time goes to
+// resolving opcode, token and function names
+void bench_resolver(const std::vector<std::string>& games)
+{
+    const auto runs = rounds ? rounds : 50;
+
+    for (const auto& game : games)
+    {
+        const auto start = std::chrono::steady_clock::now();
+
+        for (auto run = 0u; run < runs; run++)
+        {
+            auto engines = make_engines(game);
+            auto data = std::vector<std::uint8_t>(small_script.begin(), small_script.end());
+
+            engines.compiler->read_callback(utils::file::read);
+            engines.compiler->compile("small", data);
+
+            auto assembly = engines.compiler->output();
+
+            engines.assembler->assemble("small", assembly);
+        }
+
+        std::cout << utils::string::va("%s: %u runs, %.3f ms/run\n", game.data(), runs, elapsed_ms(start) / runs);
+    }
+}
+
+// funcs functions that call each other, loop and branch, so every local call and jump names a
+// function or a label in the listing
+auto synthetic_script(std::uint32_t funcs) -> std::string
+{
+    auto data = std::string{};
+
+    for (auto i = 0u; i < funcs; i++)
+    {
+        data += utils::string::va("func_%u(a)\n{\n", i);
+        data += "    for (i = 0; i < a; i++)\n    {\n";
+        data += "        if (i == 3)\n            break;\n        else if (i > 5)\n            continue;\n\n";
+        data += utils::string::va("        a += func_%u(i) + func_%u(i);\n    }\n\n", (i + 1) % funcs, i / 2);
+        data += "    switch (a)\n    {\n        case 1:\n            a++;\n            break;\n";
+        data += "        case 2:\n            a--;\n        default:\n            break;\n    }\n\n";
+        data += utils::string::va("    while (a > 10)\n        a = func_%u(a - 1);\n\n", (i * 7 + 3) % funcs);
+        data += "    return a;\n}\n\n";
+    }
+
+    return data;
+}
+
+// disassembles script and stack to a listing, then assembles the listing back, new engines each run
+void bench_listing(const std::string& game, const std::string& name, std::vector<std::uint8_t>& script, std::vector<std::uint8_t>& stack)
+{
+    const auto runs = rounds ? rounds : 10;
+    auto listing = std::vector<std::uint8_t>{};
+    auto start = std::chrono::steady_clock::now();
+
+    for (auto run = 0u; run < runs; run++)
+    {
+        auto engines = make_engines(game);
+
+        engines.disassembler->disassemble(name, script, stack);
+        listing = engines.disassembler->output_data();
+    }
+
+    const auto disasm_ms = elapsed_ms(start) / runs;
+
+    start = std::chrono::steady_clock::now();
+
+    for (auto run = 0u; run < runs; run++)
+    {
+        auto engines = make_engines(game);
+
+        engines.assembler->assemble(name, listing);
+    }
+
+    const auto asm_ms = elapsed_ms(start) / runs;
+    const auto size = double(listing.size()) / 1048576.0;
+
+    std::cout << utils::string::va("%s: %.1f MB gscasm, disasm %.1f ms/run, asm %.1f ms/run\n", name.data(), size, disasm_ms, asm_ms);
+}
+
+// compiles a .gsc, or unpacks a .gscbin, to the bytecode and stack the listing bench starts from
+void load_script(const std::string& game, const std::string& file, std::vector<std::uint8_t>& data, std::vector<std::uint8_t>& script, std::vector<std::uint8_t>& stack)
+{
+    if (file.size() >= 7 && file.compare(file.size() - 7, 7, ".gscbin") == 0)
+    {
+        auto bin = asset{};
+
+        bin.deserialize(data.data(), data.size());
+        script.assign(bin.bytecode, bin.bytecode + bin.bytecodeLen);
+        stack = utils::zlib::decompress(bin.buffer, bin.compressedLen, bin.len);
+        return;
+    }
+
+    auto engines = make_engines(game);
+
+    engines.compiler->read_callback(utils::file::read);
+    engines.compiler->compile(file, data);
+
+    auto assembly = engines.compiler->output();
+
+    engines.assembler->assemble(file, assembly);
+    script = engines.assembler->output_script();
+    stack = engines.assembler->output_stack();
+}
+
+// <game> [functions] [scripts...], a synthetic script with 1500 functions by default, then
+// every extra .gsc or .gscbin script for the game
+void bench_labels(const std::vector<std::string>& args)
+{
+    if (args.empty())
+    {
+        throw std::runtime_error("labels needs a game");
+    }
+
+    const auto& game = args[0];
+    auto first = std::size_t(1);
+    auto funcs = 1500u;
+
+    if (args.size() > 1 && !args[1].empty() && std::isdigit(static_cast<std::uint8_t>(args[1][0])))
+    {
+        funcs = std::max(1, std::atoi(args[1].data()));
+        first = 2;
+    }
+
+    auto script = std::vector<std::uint8_t>{};
+    auto stack = std::vector<std::uint8_t>{};
+    auto source = synthetic_script(funcs);
+    auto data = std::vector<std::uint8_t>(source.begin(), source.end());
+
+    load_script(game, "synthetic", data, script, stack);
+    bench_listing(game, utils::string::va("synthetic (%u functions)", funcs), script, stack);
+
+    for (auto i = first; i < args.size(); i++)
+    {
+        data = utils::file::read(args[i]);
+        load_script(game, args[i], data, script, stack);
+        bench_listing(game, args[i], script, stack);
+    }
+}
+
+// the uncompressed stacks of .gscbin scripts and zonetool .cgsc.stack files under path
+void load_stacks(const std::filesystem::path& path, std::vector<std::vector<std::uint8_t>>& stacks)
+{
+    const auto file = path.generic_string();
+
+    if (file.size() >= 7 && file.compare(file.size() - 7, 7, ".gscbin") == 0)
+    {
+        auto data = utils::file::map(file);
+        auto script = asset{};
+
+        script.deserialize(data.data(), data.size());
+        stacks.push_back(utils::zlib::decompress(script.buffer, script.compressedLen, script.len));
+    }
+    else if (file.size() >= 11 && file.compare(file.size() - 11, 11, ".cgsc.stack") == 0)
+    {
+        stacks.push_back(utils::file::read(file));
+    }
+}
+
+// deflates and inflates every stack at each level, times are per round over the whole corpus
+void bench_zlib(const std::vector<std::string>& paths)
+{
+    const auto runs = rounds ? rounds : 20;
+    auto stacks = std::vector<std::vector<std::uint8_t>>{};
+
+    for (const auto& path : paths)
+    {
+        if (std::filesystem::is_directory(path))
+        {
+            for (const auto& entry : std::filesystem::recursive_directory_iterator(path))
+            {
+                if (entry.is_regular_file())
+                {
+                    load_stacks(entry.path(), stacks);
+                }
+            }
+        }
+        else
+        {
+            load_stacks(path, stacks);
+        }
+    }
+
+    if (stacks.empty())
+    {
+        throw std::runtime_error("no .gscbin or .cgsc.stack files found");
+    }
+
+    auto total = std::size_t(0);
+
+    for (const auto& stack : stacks)
+    {
+        total += stack.size();
+    }
+
+    std::cout << utils::string::va("%zu stacks, %zu bytes, %u rounds per level\n", stacks.size(), total, runs);
+
+    for (auto level = 0; level <= utils::zlib::best; level++)
+    {
+        auto buffers = std::vector<std::vector<std::uint8_t>>(stacks.size());
+        auto start = std::chrono::steady_clock::now();
+
+        for (auto round = 0u; round < runs; round++)
+        {
+            for (auto i = 0u; i < stacks.size(); i++)
+            {
+                buffers[i] = utils::zlib::compress(stacks[i], level);
+            }
+        }
+
+        const auto deflate_ms = elapsed_ms(start) / runs;
+        auto compressed = std::size_t(0);
+
+        for (const auto& buffer : buffers)
+        {
+            compressed += buffer.size();
+        }
+
+        start = std::chrono::steady_clock::now();
+
+        for (auto round = 0u; round < runs; round++)
+        {
+            for (auto i = 0u; i < stacks.size(); i++)
+            {
+                if (utils::zlib::decompress(buffers[i], static_cast<std::uint32_t>(stacks[i].size())) != stacks[i])
+                {
+                    throw std::runtime_error(utils::string::va("stack %u doesn't inflate back at level %d", i, level));
+                }
+            }
+        }
+
+        const auto inflate_ms = elapsed_ms(start) / runs;
+        const auto ratio = total ? double(compressed) / double(total) : 0.0;
+
+        std::cout << utils::string::va("level %d: deflate %7.2f ms  inflate %6.2f ms  ratio %.3f\n", level, deflate_ms, inflate_ms, ratio);
+    }
+}
+
+const std::map<std::string, std::function<void(const std::vector<std::string>&)>> benches =
+{
+    { "labels", bench_labels },
+    { "resolver", bench_resolver },
+    { "zlib", bench_zlib },
+};
+
+void print_usage()
+{
+    std::cout << "usage: gsc-bench.exe [-r <rounds>] <bench> <args>...\n";
+    std::cout << "	* labels <game> [functions] [scripts]...: disassembles and assembles back a synthetic script with many local calls and jumps (default 1500 functions) and any extra .gsc or .gscbin scripts, ms per run (default 10 runs)\n";
+    std::cout << "	* resolver <game>...: compiles a small script with new engines each run, ms per run (default 50 runs, iw8 s4)\n";
+    std::cout << "	* zlib <path>...: deflates and inflates the stacks of .gscbin and .cgsc.stack files or directories at levels 0 to 9, ms per round and ratio (default 20 rounds)\n";
+}
+
+std::uint32_t main(std::uint32_t argc, char** argv)
+{
+    auto args = std::vector<std::string>{};
+
+    for (auto i = 1u; i < argc; i++)
+    {
+        const auto arg = std::string(argv[i]);
+
+        if (arg == "-r" && i + 1 < argc)
+        {
+            rounds = std::max(1, std::atoi(argv[++i]));
+        }
+        else
+        {
+            args.push_back(arg);
+        }
+    }
+
+    const auto itr = args.empty() ? benches.end() : benches.find(args.front());
+
+    if (itr == benches.end())
+    {
+        print_usage();
+        return 0;
+    }
+
+    args.erase(args.begin());
+
+    if (args.empty() && itr->first == "resolver")
+    {
+        args = { "iw8", "s4" };
+    }
+
+    try
+    {
+        itr->second(args);
+    }
+    catch (const std::exception& e)
+    {
+        std::cerr << e.what() << '\n';
+        return 1;
+    }
+
+    return 0;
+}
+
+} // namespace xsk::gsc
+
+int main(int argc, char** argv)
+{
+    return xsk::gsc::main(argc, argv);
+}
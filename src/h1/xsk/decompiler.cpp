@@ -11,45 +11,90 @@ namespace xsk::gsc::h1
 
 auto decompiler::output() -> std::vector<std::uint8_t>
 {
-    std::vector<std::uint8_t> output;
+    ast::printer p;
+    print(p);
 
-    auto data = std::make_unique<utils::byte_buffer>(0x100000);
-    data->write_string("// H1 GSC SOURCE\n");
-    data->write_string("// Decompiled by https://github.com/xensik/gsc-tool\n");
-    data->write_string(program_->print());
+    return std::vector<std::uint8_t>(p.data.begin(), p.data.end());
+}
 
-    output.resize(data->pos());
-    std::memcpy(output.data(), data->buffer().data(), output.size());
+void decompiler::output(std::ostream& stream)
+{
+    ast::printer p(stream);
+    print(p);
+    p.flush();
+}
 
-    return output;
+void decompiler::print(ast::printer& p)
+{
+    p << "// H1 GSC SOURCE\n";
+    p << "// Decompiled by https://github.com/xensik/gsc-tool\n";
+    program_->print(p);
 }
 
 void decompiler::decompile(const std::string& file, std::vector<function::ptr>& funcs)
 {
-    filename_ = file;
+    filename_ = std::make_shared<std::string>(file);
     program_ = std::make_unique<ast::program>();
+    strings_.clear();
+
+    utils::interner::scope scope(strings_);
 
-    for (auto& func : funcs)
+    if (thread_pool_ == nullptr || funcs.size() < 2)
     {
-        auto name = std::make_unique<ast::expr_identifier>(func->name.substr(4));
-        auto params = std::make_unique<ast::expr_parameters>();
-        auto block = std::make_unique<ast::stmt_list>();
-        func_ = std::make_unique<ast::decl_thread>(std::move(name), std::move(params), std::move(block));
+        for (auto& func : funcs)
+        {
+            decompile_thread(func);
+        }
 
-        stack_ = std::stack<ast::node::ptr>();
-        labels_ = func->labels;
-        expr_labels_.clear();
-        tern_labels_.clear();
-        blocks_.clear();
+        return;
+    }
 
-        decompile_function(func);
+    // functions are independent after disassembly, tasks only share the file name the node locations point to
+    std::vector<ast::program::ptr> parts(funcs.size());
 
-        process_stack(func_);
+    thread_pool_->parallel_for(funcs.size(), [&](std::size_t index)
+    {
+        utils::interner::scope scope(strings_);
+        decompiler worker;
+        worker.filename_ = filename_;
+        worker.program_ = std::make_unique<ast::program>();
+        worker.decompile_thread(funcs[index]);
+        parts[index] = std::move(worker.program_);
+    });
 
-        program_->declarations.push_back(ast::decl(std::move(func_)));
+    for (auto& part : parts)
+    {
+        std::move(part->declarations.begin(), part->declarations.end(), std::back_inserter(program_->declarations));
     }
 }
 
+void decompiler::thread_pool(utils::thread_pool* pool)
+{
+    thread_pool_ = pool;
+}
+
+void decompiler::decompile_thread(const function::ptr& func)
+{
+    auto name = std::make_unique<ast::expr_identifier>(func->name.substr(4));
+    auto params = std::make_unique<ast::expr_parameters>();
+    auto block = std::make_unique<ast::stmt_list>();
+    func_ = std::make_unique<ast::decl_thread>(std::move(name), std::move(params), std::move(block));
+
+    stack_ = std::stack<ast::node::ptr>();
+    labels_ = func->labels;
+    expr_labels_.clear();
+    tern_labels_.clear();
+    blocks_.clear();
+    in_waittill_ = false;
+    waittill_create_ = false;
+
+    decompile_function(func);
+
+    process_stack(func_);
+
+    program_->declarations.push_back(ast::decl(std::move(func_)));
+}
+
 void decompiler::decompile_function(const function::ptr& func)
 {
     bool in_waittill_ = false;
@@ -90,7 +135,7 @@ void decompiler::decompile_instruction(const instruction::ptr& inst)
 {
     decompile_expressions(inst);
 
-    auto loc = location(&filename_, inst->index);
+    auto loc = location(filename_.get(), inst->index);
 
     switch (opcode(inst->opcode))
     {
@@ -263,6 +308,7 @@ void decompiler::decompile_instruction(const instruction::ptr& inst)
             {
                 auto node = std::make_unique<ast::asm_create>(loc, inst->data[0]);
                 stack_.push(std::move(node));
+                waittill_create_ = true;
             }
             else
             {
@@ -471,7 +517,7 @@ void decompiler::decompile_instruction(const instruction::ptr& inst)
             auto name = std::make_unique<ast::expr_identifier>(loc, inst->data[0].substr(4));
             auto path = std::make_unique<ast::expr_path>(loc);
 
-            for (auto i = std::stoul(inst->data[1]); i > 0; i--)
+            for (auto i = inst->data[1].as_uint(); i > 0; i--)
             {
                 auto var = std::move(stack_.top());
                 stack_.pop();
@@ -490,7 +536,7 @@ void decompiler::decompile_instruction(const instruction::ptr& inst)
             auto name = std::make_unique<ast::expr_identifier>(loc, inst->data[0].substr(4));
             auto path = std::make_unique<ast::expr_path>(loc);
 
-            for (auto i = std::stoul(inst->data[1]); i > 0; i--)
+            for (auto i = inst->data[1].as_uint(); i > 0; i--)
             {
                 auto var = std::move(stack_.top()); stack_.pop();
                 loc = var->loc();
@@ -511,7 +557,7 @@ void decompiler::decompile_instruction(const instruction::ptr& inst)
             auto name = std::make_unique<ast::expr_identifier>(loc, inst->data[0].substr(4));
             auto path = std::make_unique<ast::expr_path>(loc);
 
-            for (auto i = std::stoul(inst->data[1]); i > 0; i--)
+            for (auto i = inst->data[1].as_uint(); i > 0; i--)
             {
                 auto var = std::move(stack_.top()); stack_.pop();
                 loc = var->loc();
@@ -532,7 +578,7 @@ void decompiler::decompile_instruction(const instruction::ptr& inst)
             auto name = std::make_unique<ast::expr_identifier>(loc, inst->data[0].substr(4));
             auto path = std::make_unique<ast::expr_path>(loc);
 
-            for (auto i = std::stoul(inst->data[1]); i > 0; i--)
+            for (auto i = inst->data[1].as_uint(); i > 0; i--)
             {
                 auto var = std::move(stack_.top()); stack_.pop();
                 loc = var->loc();
@@ -605,7 +651,7 @@ void decompiler::decompile_instruction(const instruction::ptr& inst)
             auto name = std::make_unique<ast::expr_identifier>(loc, inst->data[2]);
             auto path = std::make_unique<ast::expr_path>(loc, utils::string::backslash(inst->data[1]));
 
-            for (auto i = std::stoul(inst->data[0]); i > 0; i--)
+            for (auto i = inst->data[0].as_uint(); i > 0; i--)
             {
                 auto var = std::move(stack_.top()); stack_.pop();
                 loc = var->loc();
@@ -623,7 +669,7 @@ void decompiler::decompile_instruction(const instruction::ptr& inst)
             auto name = std::make_unique<ast::expr_identifier>(loc, inst->data[2]);
             auto path = std::make_unique<ast::expr_path>(loc, utils::string::backslash(inst->data[1]));
 
-            for (auto i = std::stoul(inst->data[0]); i > 0; i--)
+            for (auto i = inst->data[0].as_uint(); i > 0; i--)
             {
                 auto var = std::move(stack_.top()); stack_.pop();
                 loc = var->loc();
@@ -644,7 +690,7 @@ void decompiler::decompile_instruction(const instruction::ptr& inst)
             auto name = std::make_unique<ast::expr_identifier>(loc, inst->data[2]);
             auto path = std::make_unique<ast::expr_path>(loc, utils::string::backslash(inst->data[1]));
 
-            for (auto i = std::stoul(inst->data[0]); i > 0; i--)
+            for (auto i = inst->data[0].as_uint(); i > 0; i--)
             {
                 auto var = std::move(stack_.top()); stack_.pop();
                 loc = var->loc();
@@ -665,7 +711,7 @@ void decompiler::decompile_instruction(const instruction::ptr& inst)
             auto name = std::make_unique<ast::expr_identifier>(loc, inst->data[2]);
             auto path = std::make_unique<ast::expr_path>(loc, utils::string::backslash(inst->data[1]));
 
-            for (auto i = std::stoul(inst->data[0]); i > 0; i--)
+            for (auto i = inst->data[0].as_uint(); i > 0; i--)
             {
                 auto var = std::move(stack_.top()); stack_.pop();
                 loc = var->loc();
@@ -722,7 +768,7 @@ void decompiler::decompile_instruction(const instruction::ptr& inst)
             auto func = ast::expr(std::move(stack_.top())); stack_.pop();
             loc = func.as_node->loc();
 
-            for (auto i = std::stoul(inst->data[0]); i > 0; i--)
+            for (auto i = inst->data[0].as_uint(); i > 0; i--)
             {
                 auto var = std::move(stack_.top()); stack_.pop();
                 loc = var->loc();
@@ -740,7 +786,7 @@ void decompiler::decompile_instruction(const instruction::ptr& inst)
             auto func = ast::expr(std::move(stack_.top())); stack_.pop();
             loc = func.as_node->loc();
 
-            for (auto i = std::stoul(inst->data[0]); i > 0; i--)
+            for (auto i = inst->data[0].as_uint(); i > 0; i--)
             {
                 auto var = std::move(stack_.top()); stack_.pop();
                 loc = var->loc();
@@ -759,7 +805,7 @@ void decompiler::decompile_instruction(const instruction::ptr& inst)
             auto obj = ast::expr(std::move(stack_.top())); stack_.pop();
             loc = obj.as_node->loc();
 
-            for (auto i = std::stoul(inst->data[0]); i > 0; i--)
+            for (auto i = inst->data[0].as_uint(); i > 0; i--)
             {
                 auto var = std::move(stack_.top()); stack_.pop();
                 loc = var->loc();
@@ -778,7 +824,7 @@ void decompiler::decompile_instruction(const instruction::ptr& inst)
             auto obj = ast::expr(std::move(stack_.top())); stack_.pop();
             loc = obj.as_node->loc();
 
-            for (auto i = std::stoul(inst->data[0]); i > 0; i--)
+            for (auto i = inst->data[0].as_uint(); i > 0; i--)
             {
                 auto var = std::move(stack_.top()); stack_.pop();
                 loc = var->loc();
@@ -796,7 +842,7 @@ void decompiler::decompile_instruction(const instruction::ptr& inst)
             auto func = ast::expr(std::move(stack_.top())); stack_.pop();
             loc = func.as_node->loc();
 
-            for (auto i = std::stoul(inst->data[0]); i > 0; i--)
+            for (auto i = inst->data[0].as_uint(); i > 0; i--)
             {
                 auto var = std::move(stack_.top()); stack_.pop();
                 loc = var->loc();
@@ -815,7 +861,7 @@ void decompiler::decompile_instruction(const instruction::ptr& inst)
             auto obj = ast::expr(std::move(stack_.top())); stack_.pop();
             loc = obj.as_node->loc();
 
-            for (auto i = std::stoul(inst->data[0]); i > 0; i--)
+            for (auto i = inst->data[0].as_uint(); i > 0; i--)
             {
                 auto var = std::move(stack_.top()); stack_.pop();
                 loc = var->loc();
@@ -933,7 +979,7 @@ void decompiler::decompile_instruction(const instruction::ptr& inst)
             auto name = std::make_unique<ast::expr_identifier>(loc, inst->data[1]);
             auto path = std::make_unique<ast::expr_path>(loc);
 
-            for (auto i = std::stoul(inst->data[0]); i > 0; i--)
+            for (auto i = inst->data[0].as_uint(); i > 0; i--)
             {
                 auto var = std::move(stack_.top()); stack_.pop();
                 loc = var->loc();
@@ -1061,7 +1107,7 @@ void decompiler::decompile_instruction(const instruction::ptr& inst)
             auto obj = ast::expr(std::move(stack_.top())); stack_.pop();
             loc = obj.as_node->loc();
 
-            for (auto i = std::stoul(inst->data[0]); i > 0; i--)
+            for (auto i = inst->data[0].as_uint(); i > 0; i--)
             {
                 auto var = std::move(stack_.top()); stack_.pop();
                 loc = var->loc();
@@ -1278,7 +1324,7 @@ void decompiler::decompile_instruction(const instruction::ptr& inst)
             auto expr = ast::expr(std::move(stack_.top())); stack_.pop();
             loc = expr.as_node->loc();
 
-            for (auto i = std::stoul(inst->data[0]); i > 0; i++)
+            for (auto i = inst->data[0].as_uint(); i > 0; i++)
             {
                 auto node = std::move(stack_.top()); stack_.pop();
                 loc = node->loc();
@@ -1450,11 +1496,14 @@ void decompiler::decompile_instruction(const instruction::ptr& inst)
             break;
         case opcode::OP_SafeSetWaittillVariableFieldCached:
         {
-            if (stack_.top()->kind() != ast::kind::asm_create)
+            // a variable created right before is set here, any other one already exists
+            if (!waittill_create_)
             {
                 auto node = std::make_unique<ast::asm_access>(loc, inst->data[0]);
                 stack_.push(std::move(node));
             }
+
+            waittill_create_ = false;
         }
             break;
         case opcode::OP_SafeSetVariableFieldCached0:
@@ -1567,7 +1616,7 @@ void decompiler::decompile_instruction(const instruction::ptr& inst)
             {
                 std::vector<std::string> creates;
 
-                while (func_->stmt->list.back().as_node->kind() == ast::kind::asm_create)
+                while (!func_->stmt->list.empty() && func_->stmt->list.back().as_node->kind() == ast::kind::asm_create)
                 {
                     auto& entry = func_->stmt->list.back();
                     if (loc.begin.line < entry.as_node->loc().begin.line)
@@ -1648,7 +1697,7 @@ void decompiler::decompile_instruction(const instruction::ptr& inst)
         {
             auto count = inst->data[0];
             inst->data.erase(inst->data.begin());
-            auto data = inst->data;
+            auto data = std::vector<std::string>(inst->data.begin(), inst->data.end());
             auto end = std::make_unique<ast::asm_endswitch>(loc, data, count);
             func_->stmt->list.push_back(ast::stmt(std::move(end)));
         }
@@ -1657,7 +1706,7 @@ void decompiler::decompile_instruction(const instruction::ptr& inst)
         {
             auto expr = std::make_unique<ast::asm_jump>(loc, inst->data[0]);
             func_->stmt->list.push_back(ast::stmt(std::move(expr)));
-            if(stack_.size() != 0) tern_labels_.push_back(inst->data[0]);
+            if(stack_.size() != 0) tern_labels_.push_back(inst->data[0].as_label());
         }
             break;
         case opcode::OP_jumpback:
@@ -1692,7 +1741,7 @@ void decompiler::decompile_instruction(const instruction::ptr& inst)
             loc = lvalue.as_node->loc();
             auto expr = std::make_unique<ast::asm_jump_true_expr>(loc, std::move(lvalue), inst->data[0]);
             stack_.push(std::move(expr));
-            expr_labels_.push_back(inst->data[0]);
+            expr_labels_.push_back(inst->data[0].as_label());
         }
             break;
         case opcode::OP_JumpOnFalseExpr:
@@ -1702,7 +1751,7 @@ void decompiler::decompile_instruction(const instruction::ptr& inst)
             loc = lvalue.as_node->loc();
             auto expr = std::make_unique<ast::asm_jump_false_expr>(loc, std::move(lvalue), inst->data[0]);
             stack_.push(std::move(expr));
-            expr_labels_.push_back(inst->data[0]);
+            expr_labels_.push_back(inst->data[0].as_label());
         }
             break;
         case opcode::OP_waittillmatch2:
@@ -1778,6 +1827,7 @@ void decompiler::decompile_expressions(const instruction::ptr& inst)
 
 void decompiler::decompile_statements(const ast::stmt_list::ptr& stmt)
 {
+    decompile_exits(stmt);
     decompile_infinites(stmt);
     decompile_loops(stmt);
     decompile_switches(stmt);
@@ -1785,6 +1835,32 @@ void decompiler::decompile_statements(const ast::stmt_list::ptr& stmt)
     decompile_aborts(stmt);
 }
 
+// --peephole and --jump-threading turn 'if (x) break;' into one conditional jump out of the loop,
+// it is split back into a jump over a plain one so the if and break rules below read it
+void decompiler::decompile_exits(const ast::stmt_list::ptr& stmt)
+{
+    const auto& blk = blocks_.back();
+
+    if (blk.loc_break == "") return;
+
+    for (auto i = 0u; i < stmt->list.size(); i++)
+    {
+        auto& entry = stmt->list.at(i);
+
+        if (entry.as_node->kind() != ast::kind::asm_jump_cond || entry.as_cond->value != blk.loc_break || blk.loc_break == blk.loc_end)
+            continue;
+
+        auto loc = entry.loc();
+        auto next = (i + 1 < stmt->list.size()) ? stmt->list.at(i + 1).loc().label() : blk.loc_end;
+        auto& cond = entry.as_cond->expr;
+        auto test = (cond == ast::kind::expr_not) ? std::move(cond.as_not->rvalue) : ast::expr(std::make_unique<ast::expr_not>(loc, std::move(cond)));
+
+        entry = ast::stmt(std::make_unique<ast::asm_jump_cond>(loc, std::move(test), next));
+        stmt->list.insert(stmt->list.begin() + i + 1, ast::stmt(std::make_unique<ast::asm_jump>(loc, blk.loc_break)));
+        i++;
+    }
+}
+
 void decompiler::decompile_infinites(const ast::stmt_list::ptr& stmt)
 {
     for (int i = stmt->list.size() - 1; i >= 0; i--)
@@ -2347,7 +2423,7 @@ void decompiler::decompile_switch(const ast::stmt_list::ptr& stmt, std::uint32_t
         {
             auto loc_str = data.at(idx + 2);
             auto loc_idx = find_location_index(stmt, loc_str);
-            auto loc_pos = location(&filename_, std::stol(loc_str.substr(4), 0, 16));
+            auto loc_pos = location(filename_.get(), std::stol(loc_str.substr(4), 0, 16));
             auto value = ast::expr(std::make_unique<ast::expr_string>(loc_pos, data.at(idx + 1)));
             auto list = std::make_unique<ast::stmt_list>(loc);
             list->is_case = true;
@@ -2359,7 +2435,7 @@ void decompiler::decompile_switch(const ast::stmt_list::ptr& stmt, std::uint32_t
         {
             auto loc_str = data.at(idx + 1);
             auto loc_idx = find_location_index(stmt, loc_str);
-            auto loc_pos = location(&filename_, std::stol(loc_str.substr(4), 0, 16));
+            auto loc_pos = location(filename_.get(), std::stol(loc_str.substr(4), 0, 16));
             auto list = std::make_unique<ast::stmt_list>(loc);
             list->is_case = true;
             auto def_stmt = ast::stmt(std::make_unique<ast::stmt_default>(loc_pos, std::move(list)));
@@ -2462,9 +2538,11 @@ auto decompiler::find_location_index(const ast::stmt_list::ptr& stmt, const std:
     if (location == blocks_.back().loc_end)
         return stmt->list.size();
 
+    const auto line = gsc::location::label_line(location);
+
     for (auto& entry : stmt->list)
     {
-        if(entry.loc().label() == location)
+        if (entry.loc().begin.line == line)
             return index;
 
         index++;
@@ -2493,7 +2571,7 @@ void decompiler::process_parameters(const ast::expr_parameters::ptr& params, con
 {
     for (const auto& entry : params->list)
     {
-        blk->local_vars.push_back({ entry->value, static_cast<uint8_t>(std::stoi(entry->value.substr(4))), true });
+        blk->local_vars.push_back({ entry->id, static_cast<uint8_t>(std::stoi(entry->value.substr(4))), true });
         blk->local_vars_create_count++;
     }
 }
@@ -2810,7 +2888,7 @@ void decompiler::process_stmt_for(const ast::stmt_for::ptr& stmt, const block::p
     for (auto& index : stmt->vars)
     {
         auto var = utils::string::va("var_%d", std::stoi(index));
-        blk->local_vars.push_back({ var, static_cast<uint8_t>(std::stoi(index)), true });
+        blk->local_vars.push_back({ utils::interner::intern(var).id, static_cast<uint8_t>(std::stoi(index)), true });
         blk->local_vars_create_count++;
     }
 
@@ -2839,7 +2917,7 @@ void decompiler::process_stmt_foreach(const ast::stmt_foreach::ptr& stmt, const
     for (auto& index : stmt->vars)
     {
         auto var1 = utils::string::va("var_%d", std::stoi(index));
-        blk->local_vars.push_back({ var1, static_cast<uint8_t>(std::stoi(index)), true });
+        blk->local_vars.push_back({ utils::interner::intern(var1).id, static_cast<uint8_t>(std::stoi(index)), true });
         blk->local_vars_create_count++;
     }
 
@@ -3253,19 +3331,19 @@ void decompiler::process_var_create(ast::expr& expr, const block::ptr& blk, bool
     if (fromstmt)
     {
         auto var = utils::string::va("var_%d", std::stoi(expr.as_asm_create->index));
-        blk->local_vars.push_back({ var, static_cast<uint8_t>(std::stoi(expr.as_asm_create->index)), true });
+        blk->local_vars.push_back({ utils::interner::intern(var).id, static_cast<uint8_t>(std::stoi(expr.as_asm_create->index)), true });
         blk->local_vars_create_count++;
     }
     else
     {
         for (auto& entry : expr.as_asm_create->vars)
         {
-            blk->local_vars.push_back({ utils::string::va("var_%d", std::stoi(entry)), static_cast<uint8_t>(std::stoi(entry)), true });
+            blk->local_vars.push_back({ utils::interner::intern(utils::string::va("var_%d", std::stoi(entry))).id, static_cast<uint8_t>(std::stoi(entry)), true });
             blk->local_vars_create_count++;
         }
 
         auto var = utils::string::va("var_%d", std::stoi(expr.as_asm_create->index));
-        blk->local_vars.push_back({ var, static_cast<uint8_t>(std::stoi(expr.as_asm_create->index)), true });
+        blk->local_vars.push_back({ utils::interner::intern(var).id, static_cast<uint8_t>(std::stoi(expr.as_asm_create->index)), true });
         blk->local_vars_create_count++;
 
         expr = ast::expr(std::make_unique<ast::expr_identifier>(var));
@@ -3280,7 +3358,7 @@ void decompiler::process_var_access(ast::expr& expr, const block::ptr& blk)
     }
     else
     {
-        auto var = blk->local_vars.at(blk->local_vars.size() - 1 - std::stoi(expr.as_asm_access->index)).name;
+        const auto& var = utils::interner::find(blk->local_vars.at(blk->local_vars.size() - 1 - std::stoi(expr.as_asm_access->index)).name).value;
         expr = ast::expr(std::make_unique<ast::expr_identifier>(var));
     }
 }
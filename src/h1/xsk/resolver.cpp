@@ -5,166 +5,12 @@
 
 #include "stdafx.hpp"
 #include "h1.hpp"
+#include "resolver_hash.hpp"
 
 namespace xsk::gsc::h1
 {
 
-std::unordered_map<std::uint8_t, std::string> opcode_map;
-std::unordered_map<std::uint16_t, std::string> function_map;
-std::unordered_map<std::uint16_t, std::string> method_map;
-std::unordered_map<std::uint16_t, std::string> file_map;
-std::unordered_map<std::uint16_t, std::string> token_map;
-std::unordered_map<std::string, std::uint8_t> opcode_map_rev;
-std::unordered_map<std::string, std::uint16_t> function_map_rev;
-std::unordered_map<std::string, std::uint16_t> method_map_rev;
-std::unordered_map<std::string, std::uint16_t> file_map_rev;
-std::unordered_map<std::string, std::uint16_t> token_map_rev;
-
-auto resolver::opcode_id(const std::string& name) -> std::uint8_t
-{
-    const auto itr = opcode_map_rev.find(name);
-
-    if (itr != opcode_map_rev.end())
-    {
-        return itr->second;
-    }
-
-    throw error(utils::string::va("Couldn't resolve opcode id for name '%s'!", name.data()));
-}
-
-auto resolver::opcode_name(std::uint8_t id) -> std::string
-{
-    const auto itr = opcode_map.find(id);
-
-    if (itr != opcode_map.end())
-    {
-        return itr->second;
-    }
-
-    throw error(utils::string::va("Couldn't resolve opcode name for id '0x%hhX'!", id));
-}
-
-auto resolver::function_id(const std::string& name) -> std::uint16_t
-{
-    const auto itr = function_map_rev.find(name);
-
-    if (itr != function_map_rev.end())
-    {
-        return itr->second;
-    }
-
-    throw error(utils::string::va("Couldn't resolve builtin function id for name '%s'!", name.data()));
-}
-
-auto resolver::function_name(std::uint16_t id) -> std::string
-{
-    const auto itr = function_map.find(id);
-
-    if (itr != function_map.end())
-    {
-        return itr->second;
-    }
-
-    throw error(utils::string::va("Couldn't resolve builtin function name for id '%i'!", id));
-}
-
-auto resolver::method_id(const std::string& name) -> std::uint16_t
-{
-    const auto itr = method_map_rev.find(name);
-
-    if (itr != method_map_rev.end())
-    {
-        return itr->second;
-    }
-
-    throw error(utils::string::va("Couldn't resolve builtin method id for name '%s'!", name.data()));
-}
-
-auto resolver::method_name(std::uint16_t id) -> std::string
-{
-    const auto itr = method_map.find(id);
-
-    if (itr != method_map.end())
-    {
-        return itr->second;
-    }
-
-    throw error(utils::string::va("Couldn't resolve builtin method name for id '%i'!", id));
-}
-
-auto resolver::file_id(const std::string& name) -> std::uint16_t
-{
-    const auto itr = file_map_rev.find(name);
-
-    if (itr != file_map_rev.end())
-    {
-        return itr->second;
-    }
-
-    return 0;
-}
-
-auto resolver::file_name(std::uint16_t id) -> std::string
-{
-    const auto itr = file_map.find(id);
-
-    if (itr != file_map.end())
-    {
-        return itr->second;
-    }
-
-    return utils::string::va("_ID%i", id);
-}
-
-auto resolver::token_id(const std::string& name) -> std::uint16_t
-{
-    const auto itr = token_map_rev.find(name);
-
-    if (itr != token_map_rev.end())
-    {
-        return itr->second;
-    }
-
-    return 0;
-}
-
-auto resolver::token_name(std::uint16_t id) -> std::string
-{
-    const auto itr = token_map.find(id);
-
-    if (itr != token_map.end())
-    {
-        return itr->second;
-    }
-
-    return utils::string::va("_ID%i", id);
-}
-
-auto resolver::find_function(const std::string& name) -> bool
-{
-    const auto itr = function_map_rev.find(name);
-
-    if (itr != function_map_rev.end())
-    {
-        return true;
-    }
-
-    return false;
-}
-
-auto resolver::find_method(const std::string& name) -> bool
-{
-    const auto itr = method_map_rev.find(name);
-
-    if (itr != method_map_rev.end())
-    {
-        return true;
-    }
-
-    return false;
-}
-
-const std::array<pair_8C, 154> opcode_list
+constexpr std::array<pair_8C, 154> opcode_list
 {{
     { std::uint8_t(opcode::OP_End),"END" },
     { std::uint8_t(opcode::OP_Return),"RETN" },
@@ -322,7 +168,7 @@ const std::array<pair_8C, 154> opcode_list
     { std::uint8_t(opcode::OP_waitFrame), "WAITFRAME" },
 }};
 
-const std::array<pair_16C, 778> function_list
+constexpr std::array<pair_16C, 778> function_list
 {{
     { 0x001, "_func_001" },
     { 0x002, "_func_002" },
@@ -1104,7 +950,7 @@ const std::array<pair_16C, 778> function_list
     { 0x30A, "_func_30A" },
 }};
 
-const std::array<pair_16C, 1415> method_list
+constexpr std::array<pair_16C, 1415> method_list
 {{
     { 0x8000, "_meth_8000" },
     { 0x8001, "_meth_8001" },
@@ -2523,67 +2369,173 @@ const std::array<pair_16C, 1415> method_list
     { 0x8586, "_meth_8586" },
 }};
 
-const std::array<pair_16C, 1> file_list
+constexpr std::array<pair_16C, 1> file_list
 {{
     { 0, "DUMMY" },
 }};
 
-const std::array<pair_16C, 1> token_list
+constexpr std::array<pair_16C, 1> token_list
 {{
     { 0, "DUMMY" },
 }};
 
-struct __init__
+constexpr auto function_base = lookup::min_key(function_list);
+constexpr auto method_base = lookup::min_key(method_list);
+
+constexpr auto opcode_names = lookup::dense<0, 256>(opcode_list);
+constexpr auto function_names = lookup::dense<function_base, lookup::max_key(function_list) - function_base + 1>(function_list);
+constexpr auto method_names = lookup::dense<method_base, lookup::max_key(method_list) - method_base + 1>(method_list);
+
+static_assert(lookup::is_sorted(file_list), "file_list must be sorted by id");
+static_assert(lookup::is_sorted(token_list), "token_list must be sorted by id");
+static_assert(lookup::is_perfect<opcode_list, opcode_hash_seeds, opcode_hash_slots, false>(), "opcode hash tables are stale, re-run gen/resolver.py");
+static_assert(lookup::is_perfect<function_list, function_hash_seeds, function_hash_slots, true>(), "function hash tables are stale, re-run gen/resolver.py");
+static_assert(lookup::is_perfect<method_list, method_hash_seeds, method_hash_slots, true>(), "method hash tables are stale, re-run gen/resolver.py");
+static_assert(lookup::is_perfect<file_list, file_hash_seeds, file_hash_slots, true>(), "file hash tables are stale, re-run gen/resolver.py");
+static_assert(lookup::is_perfect<token_list, token_hash_seeds, token_hash_slots, true>(), "token hash tables are stale, re-run gen/resolver.py");
+
+auto resolver::opcode_id(std::string_view name) -> std::uint8_t
+{
+    const auto itr = lookup::find_value(opcode_list, opcode_hash_seeds, opcode_hash_slots, name, false);
+
+    if (itr != nullptr)
+    {
+        return itr->key;
+    }
+
+    throw error(utils::string::va("Couldn't resolve opcode id for name '%s'!", std::string(name).data()));
+}
+
+auto resolver::opcode_name(std::uint8_t id) -> std::string
+{
+    const auto itr = lookup::find_dense<0>(opcode_names, id);
+
+    if (itr != nullptr)
+    {
+        return itr;
+    }
+
+    throw error(utils::string::va("Couldn't resolve opcode name for id '0x%hhX'!", id));
+}
+
+auto resolver::function_id(const std::string& name) -> std::uint16_t
+{
+    const auto itr = lookup::find_value(function_list, function_hash_seeds, function_hash_slots, name, true);
+
+    if (itr != nullptr)
+    {
+        return itr->key;
+    }
+
+    throw error(utils::string::va("Couldn't resolve builtin function id for name '%s'!", name.data()));
+}
+
+auto resolver::function_name(std::uint16_t id) -> std::string
+{
+    const auto itr = lookup::find_dense<function_base>(function_names, id);
+
+    if (itr != nullptr)
+    {
+        return itr;
+    }
+
+    throw error(utils::string::va("Couldn't resolve builtin function name for id '%i'!", id));
+}
+
+auto resolver::method_id(const std::string& name) -> std::uint16_t
+{
+    const auto itr = lookup::find_value(method_list, method_hash_seeds, method_hash_slots, name, true);
+
+    if (itr != nullptr)
+    {
+        return itr->key;
+    }
+
+    throw error(utils::string::va("Couldn't resolve builtin method id for name '%s'!", name.data()));
+}
+
+auto resolver::method_name(std::uint16_t id) -> std::string
+{
+    const auto itr = lookup::find_dense<method_base>(method_names, id);
+
+    if (itr != nullptr)
+    {
+        return itr;
+    }
+
+    throw error(utils::string::va("Couldn't resolve builtin method name for id '%i'!", id));
+}
+
+auto resolver::file_id(const std::string& name) -> std::uint16_t
+{
+    const auto itr = lookup::find_value(file_list, file_hash_seeds, file_hash_slots, name, true);
+
+    if (itr != nullptr)
+    {
+        return itr->key;
+    }
+
+    return 0;
+}
+
+auto resolver::file_name(std::uint16_t id) -> std::string
+{
+    const auto itr = lookup::find_key(file_list, id);
+
+    if (itr != nullptr)
+    {
+        return itr->value;
+    }
+
+    return utils::string::va("_ID%i", id);
+}
+
+auto resolver::token_id(const std::string& name) -> std::uint16_t
+{
+    const auto itr = lookup::find_value(token_list, token_hash_seeds, token_hash_slots, name, true);
+
+    if (itr != nullptr)
+    {
+        return itr->key;
+    }
+
+    return 0;
+}
+
+auto resolver::token_name(std::uint16_t id) -> std::string
 {
-    __init__()
+    const auto itr = lookup::find_key(token_list, id);
+
+    if (itr != nullptr)
     {
-        static bool init = false;
-        if(init) return;
-        init = true;
+        return itr->value;
+    }
 
-        opcode_map.reserve(opcode_list.size());
-        opcode_map_rev.reserve(opcode_list.size());
-        function_map.reserve(function_list.size());
-        function_map_rev.reserve(function_list.size());
-        method_map.reserve(method_list.size());
-        method_map_rev.reserve(method_list.size());
-        file_map.reserve(file_list.size());
-        file_map_rev.reserve(file_list.size());
-        token_map.reserve(token_list.size());
-        token_map_rev.reserve(token_list.size());
+    return utils::string::va("_ID%i", id);
+}
 
-        for(const auto& entry : opcode_list)
-        {
-            opcode_map.insert({ entry.key, entry.value });
-            opcode_map_rev.insert({ entry.value, entry.key });
-        }
+auto resolver::find_function(const std::string& name) -> bool
+{
+    const auto itr = lookup::find_value(function_list, function_hash_seeds, function_hash_slots, name, true);
 
-        for(const auto& entry : function_list)
-        {
-            function_map.insert({ entry.key, entry.value });
-            function_map_rev.insert({ utils::string::to_lower(entry.value), entry.key });
-        }
+    if (itr != nullptr)
+    {
+        return true;
+    }
 
-        for(const auto& entry : method_list)
-        {
-            method_map.insert({ entry.key, entry.value });
-            method_map_rev.insert({ utils::string::to_lower(entry.value), entry.key });
-        }
+    return false;
+}
 
-        for(const auto& entry : file_list)
-        {
-            file_map.insert({ entry.key, entry.value });
-            file_map_rev.insert({ utils::string::to_lower(entry.value), entry.key });
-        }
+auto resolver::find_method(const std::string& name) -> bool
+{
+    const auto itr = lookup::find_value(method_list, method_hash_seeds, method_hash_slots, name, true);
 
-        for(const auto& entry : token_list)
-        {
-            token_map.insert({ entry.key, entry.value });
-            token_map_rev.insert({ utils::string::to_lower(entry.value), entry.key });
-        }
+    if (itr != nullptr)
+    {
+        return true;
     }
-};
 
-__init__ _;
+    return false;
+}
 
 } // namespace xsk::gsc::h1
@@ -0,0 +1,244 @@
+// Copyright 2021 xensik. All rights reserved.
+//
+// Use of this source code is governed by a GNU GPLv3 license
+// that can be found in the LICENSE file.
+
+// generated by gen/resolver.py, do not edit
+
+#pragma once
+
+namespace xsk::gsc::h1
+{
+
+constexpr std::array<std::int32_t, 38> opcode_hash_seeds
+{{
+    7, 10, 3, 13, 10, 243, 5, 165, 0, 135, 7, 255, 2, 433, 2, 142,
+    430, 257, 1, 275, 20, -96, 11, 687, 3, 606, 15, 735, 7, 16, 0, 79,
+    357, 490, 186, -71, 0, 1743,
+}};
+
+constexpr std::array<std::uint32_t, 154> opcode_hash_slots
+{{
+    46, 55, 115, 123, 25, 129, 143, 132, 105, 61, 69, 49, 145, 138, 84, 29,
+    58, 70, 15, 28, 125, 131, 34, 127, 150, 89, 35, 43, 59, 128, 5, 11,
+    48, 7, 67, 66, 148, 146, 90, 83, 32, 24, 122, 151, 37, 92, 26, 81,
+    149, 111, 71, 117, 114, 80, 78, 36, 98, 126, 86, 142, 52, 56, 73, 79,
+    12, 76, 57, 47, 88, 1, 40, 4, 42, 104, 108, 110, 109, 116, 45, 107,
+    152, 99, 112, 82, 96, 135, 17, 85, 51, 75, 31, 141, 21, 64, 94, 120,
+    18, 113, 93, 0, 97, 119, 147, 6, 101, 72, 38, 54, 8, 121, 103, 2,
+    87, 124, 136, 53, 134, 91, 14, 137, 50, 153, 133, 130, 10, 118, 22, 60,
+    39, 95, 30, 44, 106, 20, 19, 62, 41, 27, 63, 16, 74, 100, 13, 68,
+    33, 9, 23, 140, 3, 102, 139, 65, 77, 144,
+}};
+
+constexpr std::array<std::int32_t, 194> function_hash_seeds
+{{
+    15, 2, 4, 43, 305, 1, 13, 48, 94, 43, 21, 55, 15, 52, 769, 11,
+    23, 34, 285, 3, 15, 209, 32, 11, 12, 7, 78, 0, 1, 88, 1, 74,
+    97, 226, 14, 25, 4, 1, 152, 24, -754, 73, -745, 46, 3, 3, 24, 0,
+    3, 8, 8, 71, 14, 440, 20, 4, 7, 83, 17, 5, 1, -732, 106, 5,
+    16, 25, 1, 635, 3, 1, 4, -626, -504, 28, 5, 3, 275, 143, 117, 8,
+    6, 2, 1274, -419, 257, 1, 12, 1531, 24, 157, 52, 344, 22, 2, 9, 76,
+    24, 61, 650, -372, 2, 2, 17, 87, 40, 123, 3, 10, 5, 3, 91, 1,
+    38, 46, 1, -339, 183, 142, 19, 3, 109, 8, 386, 433, 676, 1, 37, 57,
+    3, 63, 19, 1, 184, 262, 52, 427, 191, 2, 45, 937, 3, 1031, 364, 127,
+    17, 87, 417, 3, 637, 10, 25, -313, 131, 2131, 1, 483, 9, 216, 86, 75,
+    -186, 0, 2, 12, 1589, 53, 13, 1, 77, 689, 424, 62, 3448, -94, 455, 412,
+    26, 1533, 587, 277, 44, 457, 2, 121, 942, 52, -54, 5, 6581, 4, 1, 6026,
+    6, 3365,
+}};
+
+constexpr std::array<std::uint32_t, 778> function_hash_slots
+{{
+    519, 22, 742, 213, 31, 666, 676, 614, 569, 544, 227, 728, 669, 284, 172, 668,
+    599, 282, 749, 372, 428, 252, 86, 389, 154, 434, 553, 83, 81, 494, 546, 580,
+    164, 760, 623, 678, 103, 166, 254, 66, 450, 759, 379, 350, 271, 363, 552, 415,
+    153, 689, 278, 253, 492, 712, 23, 594, 529, 135, 596, 695, 203, 141, 173, 392,
+    80, 458, 118, 313, 219, 245, 518, 606, 410, 16, 461, 702, 312, 369, 15, 318,
+    603, 534, 776, 0, 511, 315, 439, 308, 521, 476, 298, 643, 716, 44, 463, 89,
+    520, 117, 57, 124, 595, 568, 201, 121, 471, 401, 686, 631, 10, 296, 714, 99,
+    43, 444, 403, 663, 664, 771, 539, 317, 649, 502, 748, 120, 681, 495, 90, 98,
+    111, 613, 512, 674, 316, 309, 456, 205, 578, 183, 752, 768, 441, 277, 139, 642,
+    128, 537, 70, 199, 679, 344, 331, 501, 210, 238, 341, 353, 445, 184, 71, 368,
+    122, 472, 707, 705, 597, 130, 343, 93, 138, 487, 743, 174, 654, 246, 376, 402,
+    209, 289, 610, 745, 672, 479, 67, 550, 727, 651, 145, 505, 774, 566, 88, 208,
+    523, 464, 27, 395, 628, 222, 333, 61, 224, 64, 176, 351, 127, 220, 100, 656,
+    535, 558, 355, 5, 62, 635, 739, 182, 432, 281, 267, 228, 46, 572, 612, 588,
+    750, 270, 371, 563, 366, 295, 185, 467, 413, 571, 590, 753, 723, 508, 115, 250,
+    408, 286, 32, 168, 12, 54, 698, 7, 770, 754, 744, 338, 383, 412, 287, 604,
+    2, 21, 260, 146, 554, 690, 319, 41, 303, 660, 486, 717, 427, 311, 160, 279,
+    667, 288, 97, 386, 607, 119, 600, 14, 325, 126, 190, 671, 113, 708, 468, 542,
+    87, 510, 522, 78, 348, 49, 29, 304, 585, 357, 221, 721, 38, 405, 356, 229,
+    165, 433, 422, 186, 576, 214, 506, 449, 735, 536, 573, 79, 733, 731, 465, 336,
+    489, 452, 406, 352, 105, 225, 259, 60, 710, 367, 25, 354, 326, 393, 758, 42,
+    385, 722, 616, 725, 677, 20, 68, 48, 226, 583, 513, 448, 191, 726, 761, 384,
+    39, 365, 394, 40, 297, 509, 527, 548, 766, 380, 504, 619, 95, 633, 730, 189,
+    52, 123, 53, 294, 244, 713, 206, 136, 675, 280, 106, 658, 216, 388, 559, 180,
+    440, 697, 332, 741, 74, 592, 497, 4, 101, 187, 198, 302, 85, 503, 591, 129,
+    305, 478, 334, 490, 327, 493, 514, 736, 248, 629, 435, 618, 257, 290, 63, 75,
+    627, 207, 143, 223, 307, 212, 193, 337, 419, 269, 258, 429, 215, 364, 696, 330,
+    342, 650, 1, 291, 137, 47, 561, 192, 300, 411, 615, 234, 574, 236, 349, 418,
+    399, 757, 421, 470, 457, 584, 156, 112, 8, 762, 500, 516, 620, 242, 169, 701,
+    378, 268, 691, 30, 110, 36, 373, 149, 560, 400, 240, 178, 589, 540, 375, 636,
+    382, 482, 775, 11, 582, 346, 637, 459, 256, 547, 262, 451, 320, 362, 711, 715,
+    358, 148, 665, 266, 498, 624, 541, 687, 720, 447, 150, 632, 648, 361, 263, 359,
+    188, 688, 397, 69, 132, 9, 158, 460, 179, 611, 6, 65, 335, 109, 579, 718,
+    155, 693, 167, 231, 34, 621, 82, 626, 217, 533, 706, 3, 734, 634, 577, 602,
+    125, 528, 423, 443, 469, 387, 729, 639, 329, 436, 625, 685, 171, 652, 680, 237,
+    644, 293, 108, 273, 56, 370, 662, 483, 454, 473, 556, 292, 659, 84, 314, 157,
+    515, 147, 622, 230, 647, 700, 404, 377, 474, 55, 345, 756, 161, 151, 391, 638,
+    275, 646, 283, 195, 657, 340, 455, 755, 438, 264, 507, 131, 769, 301, 194, 601,
+    481, 586, 19, 414, 462, 197, 517, 37, 73, 565, 51, 102, 670, 181, 390, 694,
+    276, 104, 747, 709, 645, 107, 737, 532, 557, 488, 175, 417, 45, 430, 140, 76,
+    322, 772, 491, 587, 773, 549, 485, 740, 33, 200, 446, 426, 699, 673, 243, 152,
+    94, 704, 17, 424, 265, 58, 299, 159, 274, 177, 466, 50, 525, 738, 480, 328,
+    285, 764, 170, 564, 26, 765, 703, 526, 437, 347, 416, 538, 133, 24, 767, 324,
+    567, 431, 202, 72, 425, 609, 407, 570, 96, 605, 232, 683, 617, 692, 593, 134,
+    655, 641, 719, 381, 374, 653, 575, 724, 777, 763, 530, 196, 323, 28, 746, 475,
+    218, 640, 35, 608, 249, 13, 142, 477, 661, 239, 272, 684, 18, 77, 598, 555,
+    59, 247, 545, 92, 751, 496, 339, 630, 543, 562, 732, 116, 531, 360, 241, 409,
+    144, 163, 499, 233, 306, 211, 484, 453, 682, 162, 204, 310, 398, 321, 255, 396,
+    551, 91, 261, 114, 251, 442, 581, 420, 235, 524,
+}};
+
+constexpr std::array<std::int32_t, 353> method_hash_seeds
+{{
+    4, -1380, 94, 119, 8, 1, 29, 39, 52, 83, 83, 75, 37, 224, 8, 14,
+    18, 3, 327, 2, 163, 10, 4, 1, 141, 11, -1377, 57, 27, 106, 4, 1,
+    45, 24, -1365, 1, 17, -1281, 14, 357, 276, 3, 21, 5, 122, 16, 25, 48,
+    9, 2, -1276, 5, 1, 8, -1239, 1, 0, 16, 6, 1, 31, 10, 48, 7,
+    71, 8, 36, 21, 78, 5, 2, 13, 3, 1, 3, 3, 503, 95, 55, 9,
+    36, 2, 296, 45, 4, 47, 75, 135, 6, 2, 103, 43, 56, 5, 7, 114,
+    3, 1, 2, 180, 3, 83, 1, 3, -1192, 34, 0, -1149, 117, 6, 16, 4,
+    191, 64, 4, 23, 102, 16, 12, 285, -981, -693, 20, 204, 3, 69, 791, 156,
+    11, 1, 2, 213, 291, 11, 32, 57, 1, 19, 88, 21, 18, 82, 2, 89,
+    211, 165, 76, 357, 1, 19, 84, 16, 36, 12, 109, 116, 0, 3, 492, 137,
+    51, 1, 82, 463, -679, 10, 19, 3, 153, 89, 864, 38, 227, -528, 43, 4,
+    200, 5, 181, 323, 101, 481, 19, 201, 2, 449, 472, 132, 29, 34, 15, 336,
+    8, 1, -526, 1, 4, 201, 20, 30, 9, 73, 129, 14, 11, 4, 1, 6,
+    155, -510, 1, 0, 14, 19, 563, 11, 6, 3, 14, 97, 1, 452, 32, 1,
+    -483, 17, 114, 34, 18, 182, 11, 1, 1, 12, 54, 108, 416, 8, 368, 0,
+    -444, 92, 0, 14, 46, 8, 526, 5, 2, 286, 7, 1, 289, 1442, 15, -352,
+    460, 139, 111, 49, 478, 3, 435, 33, 1, 6, 47, 86, 385, 1, 1, 483,
+    82, 1121, 689, 40, 0, 206, 156, 12, 6, 502, 120, 1014, -305, 6, 759, 323,
+    555, 675, -284, 168, 939, 240, 27, 24, 439, 25, 232, 236, 40, 56, 311, 829,
+    117, 12, 2, 131, 21, 268, 2426, 32, 364, 56, 675, 12, 2529, -208, 21, 29,
+    481, 6, 30, 6, 176, 241, 686, -129, 4965, 142, 2, 761, 1575, 664, 68, 944,
+    362, 1, 29, 1682, 117, 1909, 2, -83, 30, 495, 2, 17, 1253, 1752, 1917, 224,
+    83,
+}};
+
+constexpr std::array<std::uint32_t, 1415> method_hash_slots
+{{
+    1018, 277, 1400, 686, 429, 258, 824, 169, 368, 1242, 428, 979, 447, 1181, 1094, 670,
+    849, 229, 995, 753, 203, 1279, 945, 1359, 284, 110, 160, 1131, 749, 807, 522, 457,
+    497, 977, 86, 339, 306, 1222, 1032, 904, 1406, 1160, 949, 667, 508, 1297, 242, 443,
+    967, 213, 1050, 629, 482, 697, 1356, 307, 971, 1106, 709, 543, 994, 955, 854, 1137,
+    1395, 720, 848, 318, 1041, 973, 94, 942, 68, 661, 890, 278, 832, 270, 963, 1334,
+    1288, 209, 1317, 427, 538, 1128, 200, 1112, 703, 733, 52, 133, 1071, 981, 1173, 815,
+    12, 879, 212, 1166, 773, 893, 403, 550, 975, 1111, 1199, 501, 382, 1408, 157, 619,
+    643, 519, 590, 123, 1246, 868, 1409, 1020, 1390, 623, 1176, 834, 573, 641, 976, 711,
+    473, 484, 1174, 716, 1068, 134, 1114, 857, 304, 1177, 349, 344, 1236, 1059, 437, 1237,
+    191, 1316, 250, 708, 1342, 288, 717, 343, 722, 489, 763, 129, 599, 53, 542, 626,
+    419, 1378, 566, 138, 786, 636, 1352, 691, 327, 988, 524, 745, 809, 1261, 181, 531,
+    529, 793, 269, 42, 746, 1165, 1136, 1115, 60, 788, 1140, 532, 225, 935, 858, 1123,
+    985, 448, 78, 865, 637, 1414, 822, 851, 1312, 55, 699, 514, 124, 843, 861, 1152,
+    74, 1357, 143, 112, 235, 402, 1070, 909, 1336, 186, 1063, 795, 172, 1124, 216, 530,
+    18, 1394, 1079, 1262, 580, 275, 414, 431, 266, 1125, 355, 118, 1393, 649, 1379, 99,
+    67, 1386, 162, 512, 121, 850, 243, 252, 888, 782, 506, 1182, 481, 1159, 233, 908,
+    3, 1085, 264, 1, 1143, 1233, 588, 1006, 852, 371, 1338, 174, 565, 731, 1108, 767,
+    455, 1321, 968, 864, 507, 56, 713, 884, 1220, 1327, 1105, 584, 158, 1259, 464, 1285,
+    1087, 1375, 1295, 467, 180, 887, 449, 1369, 663, 752, 1045, 648, 894, 20, 726, 102,
+    1333, 700, 574, 468, 677, 690, 710, 136, 37, 197, 152, 592, 1382, 1275, 85, 698,
+    111, 845, 27, 364, 452, 829, 739, 587, 179, 1303, 254, 500, 1301, 393, 1350, 10,
+    728, 801, 510, 1267, 84, 194, 1037, 466, 139, 978, 750, 544, 88, 379, 1049, 1308,
+    410, 1331, 370, 421, 625, 563, 337, 924, 97, 273, 899, 528, 378, 413, 1158, 505,
+    1013, 896, 560, 614, 984, 1036, 642, 1053, 1250, 535, 310, 274, 582, 1412, 611, 880,
+    161, 1197, 748, 33, 669, 1099, 883, 1212, 830, 234, 1040, 682, 11, 666, 1346, 601,
+    632, 1149, 1119, 818, 360, 980, 1088, 941, 702, 1086, 384, 564, 725, 910, 359, 549,
+    220, 1164, 1287, 415, 1162, 1156, 678, 165, 517, 766, 1404, 516, 79, 1365, 1003, 354,
+    480, 639, 1231, 404, 1377, 1005, 145, 882, 417, 182, 513, 300, 608, 1180, 616, 1065,
+    441, 1276, 1202, 1402, 193, 705, 646, 1126, 28, 21, 496, 741, 398, 215, 655, 432,
+    892, 790, 1299, 1305, 523, 951, 0, 357, 49, 589, 615, 1062, 1097, 442, 575, 762,
+    781, 1161, 142, 622, 933, 796, 26, 314, 872, 1310, 743, 401, 148, 1396, 992, 1347,
+    1002, 420, 426, 283, 31, 187, 1073, 567, 332, 1319, 1093, 405, 547, 1344, 787, 1309,
+    540, 1026, 453, 43, 780, 600, 578, 918, 603, 983, 778, 372, 96, 936, 322, 920,
+    826, 1116, 170, 1155, 433, 715, 253, 1266, 115, 1278, 628, 613, 81, 937, 765, 38,
+    302, 494, 1060, 338, 1277, 1213, 65, 1091, 1232, 744, 676, 1289, 206, 1290, 723, 335,
+    210, 515, 1218, 541, 902, 223, 7, 930, 1366, 1017, 837, 1019, 424, 694, 996, 137,
+    199, 35, 1055, 46, 684, 546, 1281, 5, 271, 188, 860, 1189, 1380, 987, 645, 688,
+    241, 685, 147, 120, 1121, 1206, 1186, 1353, 14, 389, 245, 308, 545, 131, 671, 1349,
+    627, 411, 316, 559, 386, 1405, 465, 434, 13, 997, 1023, 116, 1025, 219, 1355, 1133,
+    251, 348, 190, 1320, 842, 1179, 1000, 1102, 400, 1127, 1337, 1351, 620, 1146, 914, 83,
+    469, 1304, 917, 391, 957, 69, 1306, 1153, 783, 624, 36, 1192, 1325, 279, 751, 969,
+    660, 756, 236, 397, 451, 561, 785, 73, 595, 1205, 526, 409, 929, 100, 1191, 939,
+    836, 1257, 1204, 833, 1168, 238, 376, 98, 418, 714, 1120, 59, 331, 1221, 352, 885,
+    438, 8, 154, 1252, 70, 1113, 311, 127, 445, 1253, 45, 1240, 380, 621, 991, 757,
+    1318, 89, 816, 192, 1270, 1066, 1201, 931, 1058, 34, 548, 488, 1335, 964, 119, 312,
+    454, 1294, 334, 958, 1239, 183, 1139, 1188, 1313, 1383, 366, 533, 509, 471, 831, 408,
+    674, 1067, 54, 1235, 840, 444, 946, 1343, 764, 1224, 341, 333, 1052, 446, 692, 1172,
+    47, 881, 863, 340, 149, 256, 606, 319, 1296, 947, 1010, 1038, 721, 1077, 970, 679,
+    950, 527, 195, 1271, 585, 1389, 537, 163, 281, 839, 51, 644, 695, 1387, 844, 1323,
+    492, 1103, 828, 827, 1398, 1403, 1154, 707, 1028, 113, 22, 1104, 1183, 916, 680, 1117,
+    325, 1238, 737, 1046, 156, 877, 240, 1215, 214, 377, 345, 769, 735, 171, 853, 612,
+    555, 1022, 301, 1021, 901, 1110, 704, 1226, 232, 1230, 1225, 282, 263, 738, 1397, 1096,
+    1410, 383, 1169, 292, 1175, 82, 196, 989, 1371, 286, 166, 999, 775, 330, 724, 962,
+    1293, 805, 72, 1207, 1399, 367, 774, 1254, 874, 1363, 891, 476, 553, 940, 810, 462,
+    1208, 23, 326, 280, 230, 1142, 1228, 1135, 802, 29, 369, 93, 317, 498, 912, 986,
+    568, 1247, 361, 107, 128, 932, 246, 351, 727, 1043, 486, 305, 900, 1015, 534, 647,
+    1274, 718, 1401, 1024, 876, 813, 730, 272, 800, 761, 502, 696, 1109, 218, 664, 95,
+    1064, 1082, 602, 948, 1029, 867, 1374, 493, 934, 1227, 50, 231, 719, 772, 435, 734,
+    226, 260, 701, 2, 536, 593, 672, 1329, 819, 652, 1145, 518, 1129, 604, 346, 1258,
+    80, 478, 358, 759, 889, 1163, 168, 862, 927, 562, 1190, 91, 470, 1243, 1107, 104,
+    898, 1300, 1322, 569, 1272, 248, 249, 925, 381, 155, 362, 768, 557, 41, 998, 687,
+    299, 638, 185, 1144, 982, 521, 1076, 394, 1203, 1282, 1384, 201, 1324, 886, 1413, 571,
+    1054, 290, 1385, 350, 90, 106, 846, 1392, 634, 1016, 1341, 607, 798, 806, 959, 1061,
+    422, 44, 1138, 1223, 659, 675, 1098, 1209, 1411, 276, 1074, 1315, 576, 315, 758, 387,
+    77, 151, 794, 1100, 1198, 961, 1373, 15, 1264, 289, 320, 146, 1211, 577, 905, 922,
+    373, 681, 520, 323, 1081, 1241, 267, 450, 63, 483, 1248, 1007, 803, 64, 175, 57,
+    1075, 1194, 1364, 789, 657, 609, 1134, 207, 654, 353, 956, 1184, 570, 1244, 132, 430,
+    66, 4, 342, 1298, 1388, 668, 581, 298, 477, 1251, 262, 586, 173, 1332, 390, 1030,
+    1083, 211, 347, 511, 1328, 953, 1170, 313, 791, 1171, 247, 747, 71, 1367, 1147, 952,
+    630, 838, 30, 913, 406, 1200, 811, 227, 1150, 1260, 329, 75, 1044, 1339, 740, 954,
+    859, 605, 965, 474, 814, 479, 903, 39, 1370, 291, 943, 1092, 777, 25, 631, 960,
+    835, 1291, 1195, 799, 974, 808, 1292, 265, 103, 24, 1245, 456, 178, 150, 16, 1302,
+    938, 650, 1078, 9, 1196, 1009, 392, 1056, 804, 1210, 217, 1047, 228, 658, 412, 296,
+    105, 653, 895, 1132, 1118, 328, 101, 407, 1314, 870, 558, 293, 776, 597, 817, 436,
+    1080, 907, 1216, 554, 635, 770, 202, 224, 487, 1265, 1012, 1326, 1089, 76, 198, 365,
+    295, 204, 208, 552, 760, 633, 321, 460, 58, 1368, 125, 153, 825, 966, 130, 1187,
+    915, 416, 1376, 108, 1167, 19, 712, 754, 205, 1185, 665, 706, 617, 729, 244, 237,
+    1268, 1090, 640, 1284, 257, 1391, 993, 1273, 255, 1122, 458, 525, 303, 1048, 463, 176,
+    375, 572, 395, 792, 662, 490, 1178, 911, 504, 495, 736, 374, 388, 92, 689, 683,
+    869, 1311, 1381, 177, 294, 363, 1072, 591, 32, 356, 551, 871, 906, 439, 297, 1372,
+    485, 594, 923, 475, 651, 144, 656, 268, 459, 48, 823, 440, 1130, 126, 1011, 821,
+    109, 1031, 122, 873, 336, 1256, 1263, 222, 921, 135, 732, 797, 1345, 1157, 919, 1255,
+    583, 399, 425, 1234, 618, 784, 779, 1354, 1360, 771, 742, 159, 285, 461, 875, 221,
+    610, 990, 17, 140, 897, 856, 1217, 1027, 1361, 385, 1101, 855, 309, 1362, 1307, 1042,
+    1193, 6, 1051, 1214, 239, 1330, 472, 841, 503, 1358, 673, 1148, 598, 499, 539, 1001,
+    1057, 693, 259, 1039, 61, 926, 114, 324, 261, 62, 812, 1219, 1407, 755, 1008, 1229,
+    396, 287, 423, 1269, 944, 596, 167, 1141, 117, 1249, 556, 164, 1084, 1034, 866, 1035,
+    1095, 1033, 1280, 87, 1348, 1004, 1340, 1014, 878, 972, 1069, 1286, 184, 189, 847, 1151,
+    579, 928, 820, 40, 491, 141, 1283,
+}};
+
+constexpr std::array<std::int32_t, 1> file_hash_seeds
+{{
+    -1,
+}};
+
+constexpr std::array<std::uint32_t, 1> file_hash_slots
+{{
+    0,
+}};
+
+constexpr std::array<std::int32_t, 1> token_hash_seeds
+{{
+    -1,
+}};
+
+constexpr std::array<std::uint32_t, 1> token_hash_slots
+{{
+    0,
+}};
+
+} // namespace xsk::gsc::h1
@@ -10,25 +10,33 @@ namespace xsk::gsc::h2
 
 class decompiler : public gsc::decompiler
 {
-    std::string filename_;
+    std::shared_ptr<std::string> filename_;
+    utils::interner strings_;
     ast::program::ptr program_;
     ast::decl_thread::ptr func_;
-    std::unordered_map<std::uint32_t, std::string> labels_;
-    std::vector<std::string> expr_labels_;
-    std::vector<std::string> tern_labels_;
+    std::unordered_map<std::uint32_t, std::uint32_t> labels_;
+    std::vector<std::uint32_t> expr_labels_;
+    std::vector<std::uint32_t> tern_labels_;
     std::stack<ast::node::ptr> stack_;
     std::vector<block> blocks_;
     bool in_waittill_;
+    bool waittill_create_;
+    utils::thread_pool* thread_pool_ = nullptr;
 
 public:
     auto output() -> std::vector<std::uint8_t>;
+    void output(std::ostream& stream);
     void decompile(const std::string& file, std::vector<function::ptr>& funcs);
+    void thread_pool(utils::thread_pool* pool);
 
 private:
+    void print(ast::printer& p);
+    void decompile_thread(const function::ptr& func);
     void decompile_function(const function::ptr& func);
     void decompile_instruction(const instruction::ptr& inst);
     void decompile_expressions(const instruction::ptr& inst);
     void decompile_statements(const ast::stmt_list::ptr& stmt);
+    void decompile_exits(const ast::stmt_list::ptr& stmt);
     void decompile_infinites(const ast::stmt_list::ptr& stmt);
     void decompile_loops(const ast::stmt_list::ptr& stmt);
     void decompile_switches(const ast::stmt_list::ptr& stmt);
@@ -2975,41 +2975,25 @@ void h2_push_header(xsk::gsc::context* ctx, const std::string& file)
 
 		ctx->header_top++;
 
-		char* buf_data = 0;
-		size_t buf_size = 0;
+		auto& source = ctx->sources->load(file, ctx->read_callback);
 
-		for (auto& src : *ctx->sources)
-		{
-			if (src.name == file)
-			{
-				buf_data = reinterpret_cast<char*>(src.buf.data());
-				buf_size = src.buf.size();
+		ctx->locs.push(ctx->loc);
+		ctx->loc.initialize(&source.name);
 
-				ctx->locs.push(ctx->loc);
-				ctx->loc.initialize(&src.name);
-			}
-		}
+		// flex writes into the buffer it scans, the cached source is copied for each scan
+		auto data = static_cast<char*>(yyalloc(source.buf.size(), ctx->scanner));
 
-		if (buf_data == 0)
+		if (data == nullptr)
 		{
-			ctx->sources->push_back(xsk::gsc::source());
-			auto& source = ctx->sources->back();
-			source.name = file;
-			source.buf = ctx->read_callback(file + ".gsh");
-			source.buf.push_back(0);
-			source.buf.push_back(0);
-
-			buf_data = reinterpret_cast<char*>(source.buf.data());
-			buf_size = source.buf.size();
-
-			ctx->locs.push(ctx->loc);
-			ctx->loc.initialize(&source.name);
+			throw std::bad_alloc();
 		}
 
+		std::copy(source.buf.begin(), source.buf.end(), data);
+
 		auto state = new yy_buffer_state();
-		state->yy_buf_size = buf_size - 2;
-		state->yy_buf_pos = state->yy_ch_buf = buf_data;
-		state->yy_is_our_buffer = 0;
+		state->yy_buf_size = source.buf.size() - 2;
+		state->yy_buf_pos = state->yy_ch_buf = data;
+		state->yy_is_our_buffer = 1;
 		state->yy_input_file = NULL;
 		state->yy_n_chars = state->yy_buf_size;
 		state->yy_is_interactive = 0;
@@ -0,0 +1,251 @@
+// Copyright 2021 xensik. All rights reserved.
+//
+// Use of this source code is governed by a GNU GPLv3 license
+// that can be found in the LICENSE file.
+
+// generated by gen/resolver.py, do not edit
+
+#pragma once
+
+namespace xsk::gsc::h2
+{
+
+constexpr std::array<std::int32_t, 38> opcode_hash_seeds
+{{
+    7, 10, 3, 13, 10, 243, 5, 165, 0, 135, 7, 255, 2, 433, 2, 142,
+    430, 257, 1, 275, 20, -96, 11, 687, 3, 606, 15, 735, 7, 16, 0, 79,
+    357, 490, 186, -71, 0, 1743,
+}};
+
+constexpr std::array<std::uint32_t, 154> opcode_hash_slots
+{{
+    46, 55, 115, 123, 25, 129, 143, 132, 105, 61, 69, 49, 145, 138, 84, 29,
+    58, 70, 15, 28, 125, 131, 34, 127, 150, 89, 35, 43, 59, 128, 5, 11,
+    48, 7, 67, 66, 148, 146, 90, 83, 32, 24, 122, 151, 37, 92, 26, 81,
+    149, 111, 71, 117, 114, 80, 78, 36, 98, 126, 86, 142, 52, 56, 73, 79,
+    12, 76, 57, 47, 88, 1, 40, 4, 42, 104, 108, 110, 109, 116, 45, 107,
+    152, 99, 112, 82, 96, 135, 17, 85, 51, 75, 31, 141, 21, 64, 94, 120,
+    18, 113, 93, 0, 97, 119, 147, 6, 101, 72, 38, 54, 8, 121, 103, 2,
+    87, 124, 136, 53, 134, 91, 14, 137, 50, 153, 133, 130, 10, 118, 22, 60,
+    39, 95, 30, 44, 106, 20, 19, 62, 41, 27, 63, 16, 74, 100, 13, 68,
+    33, 9, 23, 140, 3, 102, 139, 65, 77, 144,
+}};
+
+constexpr std::array<std::int32_t, 200> function_hash_seeds
+{{
+    272, -700, 24, 1, 11, 2, 10, 11, -597, 126, 1, 2, 26, 1, -556, -525,
+    239, 2, 37, 50, 84, 12, 29, 167, 24, 69, 35, 2, 50, 348, 3, 1,
+    9, 155, 18, 58, -470, 33, 1, 236, 14, 12, 17, 29, 88, 43, 39, 228,
+    2, 322, 3, 132, 5, 159, -459, 1, 2, 22, 3, 5, 4, 7, 36, 180,
+    20, 173, 2, 42, 6, 1, 34, 64, 10, 11, 1, -397, 193, 1, 236, 59,
+    3, 78, 48, 10, 5, 25, 879, 57, 159, 1, 226, 114, 7, 32, 1, -256,
+    88, 87, 3, 73, 5, 54, 5, 471, 195, 41, 17, 8, 2, -245, 2, 109,
+    4, 16, 115, 38, -244, 158, 70, 6, 244, 40, 73, 0, 4, 200, 23, 9,
+    66, 401, 1, 9, 0, 15, 219, 15, 161, 2, 2, 11, 296, 35, 48, 5,
+    2, 1038, 3, 9, 97, 32, 1752, 438, 10, 1459, 130, 771, 223, 5, 351, -224,
+    583, 961, 13, 94, 5, 9, 81, 76, 141, 1, 188, 118, 1, 185, 255, 485,
+    125, 2440, 680, 637, -160, 1, 307, 29, 13, 44, -115, 300, 591, 263, 2903, 107,
+    37, 1, 1419, 2301, 152, 14, 146, 2864,
+}};
+
+constexpr std::array<std::uint32_t, 800> function_hash_slots
+{{
+    397, 432, 622, 93, 42, 209, 263, 701, 137, 200, 71, 448, 469, 300, 595, 676,
+    501, 298, 345, 491, 734, 663, 242, 305, 366, 706, 119, 642, 35, 82, 419, 264,
+    346, 385, 227, 198, 628, 20, 657, 728, 19, 463, 559, 437, 766, 130, 498, 783,
+    48, 281, 556, 527, 118, 782, 161, 159, 172, 565, 311, 550, 142, 758, 760, 210,
+    648, 233, 534, 226, 749, 570, 536, 671, 618, 539, 515, 475, 359, 605, 18, 150,
+    152, 148, 17, 751, 285, 416, 41, 537, 68, 268, 221, 192, 741, 778, 626, 38,
+    167, 718, 453, 606, 739, 337, 526, 700, 528, 390, 664, 620, 37, 349, 274, 517,
+    113, 717, 320, 66, 257, 422, 73, 466, 1, 776, 662, 748, 601, 529, 324, 710,
+    558, 795, 665, 427, 386, 261, 525, 562, 459, 181, 418, 669, 5, 617, 476, 499,
+    404, 614, 464, 698, 208, 277, 788, 446, 189, 434, 282, 653, 566, 540, 279, 290,
+    598, 582, 99, 325, 683, 433, 134, 480, 522, 25, 131, 157, 524, 630, 347, 447,
+    67, 532, 425, 26, 745, 541, 640, 338, 406, 191, 232, 641, 636, 380, 549, 369,
+    612, 702, 183, 176, 607, 609, 160, 542, 732, 497, 722, 472, 405, 567, 423, 784,
+    89, 547, 546, 467, 343, 613, 165, 677, 332, 471, 236, 382, 399, 753, 770, 83,
+    412, 85, 762, 692, 112, 468, 322, 493, 154, 354, 50, 503, 389, 265, 402, 256,
+    43, 260, 313, 769, 94, 132, 415, 314, 554, 465, 293, 269, 16, 266, 78, 715,
+    596, 551, 124, 363, 652, 250, 69, 791, 506, 351, 291, 429, 638, 395, 445, 251,
+    10, 278, 632, 219, 182, 742, 187, 327, 599, 151, 125, 500, 145, 392, 591, 644,
+    53, 276, 237, 799, 77, 589, 707, 761, 587, 60, 34, 297, 592, 439, 444, 153,
+    54, 179, 597, 512, 787, 253, 341, 679, 356, 58, 292, 693, 102, 672, 767, 127,
+    62, 105, 400, 430, 548, 768, 12, 284, 201, 450, 139, 581, 645, 487, 736, 777,
+    164, 747, 713, 637, 477, 368, 426, 126, 452, 211, 568, 670, 270, 272, 384, 716,
+    513, 774, 143, 318, 97, 296, 655, 396, 757, 586, 7, 443, 780, 98, 138, 711,
+    372, 255, 225, 381, 391, 763, 114, 123, 457, 220, 316, 339, 117, 394, 364, 361,
+    335, 496, 22, 79, 96, 310, 687, 490, 789, 91, 231, 104, 695, 538, 754, 485,
+    358, 651, 2, 205, 133, 33, 514, 202, 629, 737, 306, 564, 235, 215, 462, 254,
+    474, 136, 141, 756, 373, 156, 168, 106, 197, 785, 746, 413, 714, 275, 649, 217,
+    410, 100, 178, 302, 173, 520, 523, 303, 120, 378, 195, 590, 55, 162, 661, 495,
+    177, 342, 449, 531, 228, 355, 555, 779, 583, 295, 45, 336, 27, 240, 553, 39,
+    224, 101, 668, 204, 56, 689, 287, 411, 781, 24, 667, 360, 186, 738, 246, 580,
+    752, 51, 258, 241, 796, 309, 656, 23, 543, 135, 489, 15, 674, 771, 87, 21,
+    92, 627, 230, 744, 383, 147, 331, 222, 70, 633, 552, 59, 330, 190, 790, 365,
+    504, 169, 508, 103, 109, 650, 623, 441, 229, 8, 608, 688, 3, 213, 560, 720,
+    576, 690, 417, 603, 594, 259, 40, 180, 14, 288, 516, 584, 571, 379, 294, 456,
+    729, 128, 248, 90, 673, 660, 424, 28, 245, 30, 86, 398, 684, 773, 31, 129,
+    312, 367, 329, 750, 502, 507, 408, 149, 304, 686, 170, 654, 216, 307, 121, 76,
+    797, 685, 271, 634, 635, 75, 95, 431, 792, 348, 505, 708, 484, 388, 252, 238,
+    545, 350, 621, 460, 440, 115, 414, 666, 442, 61, 680, 563, 509, 375, 326, 602,
+    483, 775, 249, 600, 6, 473, 218, 146, 13, 593, 374, 454, 315, 561, 184, 730,
+    461, 798, 703, 163, 643, 107, 682, 719, 639, 207, 371, 267, 206, 699, 759, 319,
+    794, 709, 646, 510, 65, 194, 110, 64, 573, 740, 697, 479, 557, 578, 280, 451,
+    764, 731, 321, 733, 80, 273, 334, 352, 659, 458, 243, 544, 743, 588, 579, 625,
+    585, 44, 428, 140, 212, 185, 244, 111, 482, 725, 572, 574, 299, 681, 9, 328,
+    29, 704, 155, 239, 619, 0, 712, 308, 435, 494, 46, 289, 403, 47, 530, 535,
+    519, 492, 765, 631, 724, 376, 624, 52, 49, 353, 511, 616, 166, 57, 362, 723,
+    188, 72, 323, 247, 721, 108, 344, 175, 694, 74, 63, 521, 438, 421, 158, 393,
+    377, 171, 610, 470, 4, 199, 786, 196, 575, 370, 486, 234, 604, 286, 518, 407,
+    36, 401, 387, 122, 455, 283, 488, 696, 569, 755, 144, 174, 88, 478, 615, 675,
+    420, 262, 772, 533, 357, 577, 317, 214, 735, 658, 116, 193, 333, 340, 793, 301,
+    691, 11, 481, 203, 727, 678, 32, 409, 611, 84, 647, 223, 705, 436, 726, 81,
+}};
+
+constexpr std::array<std::int32_t, 372> method_hash_seeds
+{{
+    3, 114, 104, 1, 9, 12, 292, 16, 26, 2, 1, 1, 63, 1, 11, 19,
+    32, 3, -1438, 3, 128, 1, 53, 1, 16, 4, 14, 2, 84, 33, 75, 1,
+    7, 14, 728, 2, 3, 71, 124, 47, 2, 139, 18, 1, 4, 35, 20, 31,
+    17, 76, 17, 11, 8, 68, 1, 11, 0, 27, 1, 253, -1433, 238, 671, -1431,
+    18, 6, -1428, 170, 191, 17, 1, 81, 6, 64, 81, 80, 7, 5, 2, 242,
+    14, 1, 1, 1, 118, 27, 379, 74, -1227, 2, 20, 8, 10, 36, 1, 2,
+    22, 81, 2, 16, 52, 98, 44, 2, 98, 7, 1, 174, -1155, 120, 152, 33,
+    39, 1, 20, 1, 11, 232, 784, 477, 69, 10, 477, 187, 190, 1, 7, 2,
+    1, 286, 8, 21, 280, 97, 98, 46, -1147, 2, 1, -1126, 90, 93, 256, 988,
+    4, 12, 2, -1053, 2, -1029, 21, 20, 603, 1, 72, 86, 168, 17, 1, 41,
+    8, 21, 133, 112, 111, 43, 30, 39, 535, 1, 19, 65, 30, 9, 2, 1,
+    8, 74, 4, 120, 17, 475, -991, -881, 4, 1001, 39, 1, 1187, 38, 23, 75,
+    1, 764, 35, 102, 14, 56, 277, 417, 20, 202, 5, 105, 69, 13, 2, 102,
+    4, 95, 160, 726, -842, 12, 336, 55, 5, -766, -728, 1, 19, 242, 37, 552,
+    43, 103, 30, 7, 532, 13, 561, 452, 230, -686, 1, 56, 603, -650, 1524, 380,
+    4, 0, 148, 606, 9, 61, 3, 2, 37, 12, 5, 56, 11, 2, 9, -616,
+    2, 9, 4, 7, 27, 3, 13, 48, 1401, 155, 186, 12, 90, 19, 558, 3,
+    408, 96, 15, -553, 1, 1, 177, 10, 473, 11, 23, 1, 14, 125, 3, 752,
+    25, 3, 38, 2039, 2967, 11, 13, 196, 1662, 666, 257, 193, 46, 1159, 2, -320,
+    4, 358, 70, -264, 36, 515, 44, -231, 14, 673, 15, 618, 8164, 2, 2998, 8,
+    20, 283, 235, 17, 58, 27, -222, 15, 198, 19, 1, 7, 2, 162, -176, 95,
+    399, 121, -152, 48, 5195, 1, 80, 185, 87, 197, 733, 2, 41, 291, 1934, 46,
+    793, 9, 141, 115, 717, 4917, 126, 2, 1, 250, 2, -140, -136, 232, 1, 1676,
+    244, 2, -25, 3,
+}};
+
+constexpr std::array<std::uint32_t, 1491> method_hash_slots
+{{
+    782, 8, 490, 111, 964, 755, 937, 870, 742, 907, 1271, 1196, 592, 1148, 511, 902,
+    631, 284, 248, 778, 420, 325, 551, 139, 1174, 313, 68, 220, 641, 1275, 1450, 912,
+    866, 1246, 1329, 1096, 63, 444, 1394, 62, 463, 547, 297, 107, 945, 1200, 1112, 498,
+    307, 1162, 628, 1111, 438, 369, 960, 580, 573, 5, 1474, 969, 143, 159, 352, 751,
+    1436, 455, 1044, 85, 665, 1172, 130, 839, 633, 84, 1284, 193, 703, 406, 984, 787,
+    83, 1055, 771, 582, 657, 837, 1444, 1005, 141, 291, 207, 467, 1417, 1050, 968, 186,
+    448, 512, 991, 694, 1161, 823, 238, 932, 1395, 1248, 150, 1349, 975, 1362, 951, 1035,
+    485, 710, 873, 1477, 1343, 1347, 487, 516, 1333, 28, 108, 100, 696, 814, 1225, 1478,
+    683, 280, 1440, 898, 822, 646, 936, 1442, 815, 1396, 625, 651, 242, 1265, 145, 988,
+    0, 1165, 379, 1204, 254, 983, 609, 691, 180, 553, 685, 1366, 204, 1151, 1177, 1002,
+    437, 1356, 706, 525, 163, 998, 1276, 671, 1392, 550, 14, 282, 13, 1334, 1097, 312,
+    730, 893, 627, 599, 675, 417, 1446, 1092, 1024, 721, 327, 1168, 241, 700, 746, 1131,
+    258, 365, 959, 1021, 1117, 1138, 979, 269, 805, 1064, 575, 144, 415, 10, 320, 272,
+    779, 433, 503, 600, 557, 1279, 847, 383, 807, 750, 1435, 738, 929, 290, 1376, 530,
+    1327, 44, 508, 1365, 1155, 842, 518, 1202, 370, 804, 481, 817, 1110, 1026, 20, 2,
+    1398, 504, 119, 1415, 1066, 421, 726, 521, 1085, 1323, 605, 1336, 781, 914, 1463, 768,
+    48, 704, 464, 458, 409, 399, 1316, 194, 1077, 360, 709, 338, 477, 129, 591, 429,
+    188, 36, 1150, 610, 767, 456, 155, 1006, 662, 89, 69, 1212, 879, 811, 168, 1432,
+    617, 1393, 577, 887, 234, 1263, 1071, 71, 1017, 164, 559, 1409, 555, 445, 153, 161,
+    319, 1304, 56, 889, 331, 391, 474, 156, 173, 453, 1479, 337, 495, 377, 451, 1004,
+    952, 838, 1381, 578, 90, 1076, 405, 1455, 1482, 756, 4, 1088, 844, 1108, 1143, 324,
+    67, 639, 17, 113, 267, 941, 222, 423, 239, 938, 933, 1020, 1355, 904, 854, 1095,
+    642, 1207, 724, 95, 1235, 74, 101, 470, 172, 1357, 473, 1224, 514, 510, 1139, 330,
+    1390, 1182, 1416, 12, 1252, 899, 1123, 1375, 57, 780, 7, 1176, 1061, 949, 1164, 361,
+    483, 77, 926, 157, 125, 638, 965, 519, 621, 565, 1047, 1209, 1451, 1152, 1003, 1335,
+    934, 374, 1258, 1124, 1249, 430, 861, 152, 372, 930, 716, 1489, 871, 1288, 158, 653,
+    1015, 1277, 30, 725, 905, 1348, 533, 121, 1345, 441, 630, 1481, 527, 690, 1361, 635,
+    1194, 1378, 304, 128, 812, 693, 845, 446, 281, 810, 1426, 1198, 757, 110, 216, 1363,
+    425, 94, 1403, 1214, 1461, 213, 219, 340, 556, 182, 1472, 734, 875, 93, 97, 162,
+    58, 1413, 1286, 505, 996, 65, 308, 1186, 250, 903, 375, 328, 127, 19, 1243, 109,
+    712, 1367, 1105, 1408, 1217, 358, 1098, 1043, 1221, 397, 667, 1018, 554, 76, 1370, 1114,
+    1170, 1126, 1326, 1407, 1439, 990, 1034, 1113, 38, 603, 232, 1419, 1037, 131, 26, 493,
+    1441, 1283, 175, 602, 786, 853, 275, 283, 636, 105, 946, 381, 865, 132, 1244, 60,
+    1261, 1083, 432, 500, 702, 981, 891, 1389, 859, 475, 72, 806, 120, 491, 1278, 1310,
+    883, 705, 1469, 87, 507, 276, 24, 743, 78, 1399, 1289, 403, 1178, 679, 262, 54,
+    449, 376, 1373, 714, 922, 471, 461, 808, 1480, 901, 1080, 1033, 606, 322, 362, 1337,
+    1291, 364, 663, 1195, 351, 522, 880, 818, 214, 46, 133, 21, 928, 1136, 1031, 956,
+    1471, 300, 772, 178, 1010, 958, 469, 797, 226, 460, 1314, 741, 15, 1270, 731, 1065,
+    1099, 1264, 1029, 1273, 1028, 1100, 1354, 1360, 135, 311, 1405, 655, 1259, 61, 686, 661,
+    783, 581, 595, 264, 1199, 288, 1122, 765, 1401, 824, 1102, 1300, 1341, 1068, 966, 570,
+    382, 1377, 1339, 426, 335, 561, 913, 917, 896, 1060, 81, 1229, 1222, 939, 200, 462,
+    357, 1205, 688, 176, 645, 546, 1285, 246, 953, 385, 117, 1453, 410, 962, 769, 1473,
+    563, 416, 718, 1146, 1052, 973, 395, 1454, 1290, 1468, 285, 1325, 826, 910, 228, 1042,
+    422, 1078, 137, 1387, 201, 1431, 587, 993, 1128, 1067, 170, 777, 890, 583, 104, 171,
+    799, 1231, 658, 537, 349, 472, 1213, 916, 277, 11, 611, 598, 1090, 1016, 867, 66,
+    1041, 1084, 41, 1299, 147, 1340, 138, 1058, 23, 593, 1144, 31, 22, 309, 1049, 96,
+    1160, 296, 1350, 531, 278, 828, 1036, 287, 1, 707, 1351, 1101, 788, 106, 1142, 1421,
+    212, 897, 183, 541, 567, 760, 980, 1027, 413, 91, 763, 857, 489, 989, 1173, 995,
+    935, 1051, 52, 1368, 543, 1032, 412, 348, 1007, 1180, 1309, 1437, 1433, 1397, 1070, 664,
+    419, 202, 832, 1342, 622, 566, 862, 39, 813, 1171, 263, 501, 1312, 1303, 53, 346,
+    957, 240, 1385, 298, 1009, 536, 1094, 1344, 1445, 187, 885, 1411, 900, 1322, 623, 908,
+    114, 1467, 478, 1062, 656, 924, 648, 266, 1462, 1266, 1045, 310, 1169, 682, 666, 198,
+    1448, 1206, 350, 1069, 872, 831, 1230, 390, 167, 1134, 659, 821, 1239, 809, 978, 1317,
+    1125, 1179, 244, 1137, 1418, 1422, 589, 196, 684, 315, 148, 452, 249, 123, 669, 354,
+    1053, 974, 1456, 1048, 443, 963, 32, 243, 816, 33, 1429, 50, 1296, 1081, 1254, 332,
+    333, 860, 486, 715, 1423, 1154, 843, 672, 520, 1320, 1488, 624, 761, 1109, 736, 314,
+    252, 1374, 1328, 341, 1183, 604, 271, 1013, 140, 253, 363, 596, 766, 590, 800, 142,
+    770, 544, 687, 834, 136, 1103, 548, 386, 1197, 942, 1269, 863, 1458, 37, 191, 466,
+    1364, 371, 650, 73, 1251, 227, 856, 920, 676, 552, 620, 1391, 1318, 103, 584, 911,
+    265, 1443, 943, 868, 1369, 1000, 497, 1428, 259, 1072, 819, 400, 717, 576, 762, 720,
+    735, 745, 189, 1476, 396, 301, 523, 850, 339, 25, 569, 190, 88, 774, 51, 299,
+    9, 1086, 796, 802, 1106, 389, 47, 59, 754, 1245, 643, 336, 165, 1330, 210, 877,
+    1267, 1306, 1188, 1383, 1227, 758, 440, 1219, 571, 1232, 378, 488, 35, 884, 480, 698,
+    1121, 1233, 801, 615, 1127, 1430, 513, 1181, 773, 1115, 1167, 1313, 509, 1250, 199, 224,
+    359, 1338, 878, 1470, 393, 940, 851, 517, 203, 697, 1352, 98, 820, 343, 1236, 1175,
+    986, 1410, 368, 479, 994, 776, 992, 1014, 1119, 918, 723, 236, 568, 562, 1331, 833,
+    982, 888, 515, 1298, 1400, 607, 732, 1292, 836, 1226, 1012, 1075, 289, 1475, 977, 411,
+    1287, 102, 795, 40, 790, 402, 492, 1486, 206, 1484, 538, 1091, 1156, 342, 1490, 154,
+    1030, 459, 1485, 1324, 398, 345, 1372, 286, 915, 27, 612, 245, 647, 42, 260, 1234,
+    970, 407, 1240, 506, 233, 1104, 1025, 534, 1302, 649, 434, 535, 749, 711, 944, 1073,
+    626, 792, 660, 476, 640, 678, 1457, 134, 869, 424, 1438, 840, 230, 3, 1211, 1332,
+    629, 1256, 925, 431, 524, 268, 1228, 528, 747, 545, 616, 744, 668, 270, 1218, 387,
+    864, 921, 293, 1402, 1140, 174, 99, 1406, 45, 793, 947, 1238, 972, 279, 1166, 34,
+    827, 1379, 75, 728, 427, 775, 892, 673, 256, 1464, 1120, 1220, 116, 1353, 197, 1063,
+    1307, 124, 644, 29, 255, 784, 1190, 961, 927, 753, 971, 1089, 80, 689, 166, 118,
+    985, 759, 408, 997, 895, 321, 353, 1255, 719, 454, 858, 894, 1449, 16, 1087, 1184,
+    681, 564, 1483, 701, 1272, 1311, 733, 1019, 302, 1082, 752, 1001, 317, 447, 1145, 539,
+    1046, 1185, 1022, 306, 1040, 1384, 634, 1158, 999, 494, 195, 1487, 1460, 614, 49, 1093,
+    1079, 931, 737, 225, 82, 384, 1404, 18, 954, 825, 526, 1208, 401, 560, 881, 344,
+    1466, 1280, 55, 169, 1135, 373, 680, 1412, 208, 764, 215, 791, 64, 305, 484, 1189,
+    418, 1247, 803, 237, 785, 948, 542, 1130, 1452, 579, 316, 558, 1260, 1223, 549, 192,
+    695, 1203, 692, 326, 1118, 1459, 43, 923, 652, 1147, 366, 1163, 223, 1038, 122, 151,
+    586, 404, 251, 273, 1414, 435, 149, 209, 160, 1297, 177, 303, 987, 1253, 1159, 1359,
+    1149, 126, 1447, 874, 334, 846, 1315, 235, 919, 1074, 1305, 1294, 6, 829, 257, 388,
+    457, 231, 1192, 112, 1295, 1057, 1321, 848, 740, 229, 295, 1281, 414, 86, 356, 1346,
+    482, 1358, 882, 247, 1388, 727, 950, 794, 1282, 221, 585, 1054, 436, 380, 439, 619,
+    637, 532, 181, 1133, 594, 217, 1386, 849, 1371, 1023, 211, 748, 1262, 540, 329, 465,
+    967, 1380, 1424, 292, 323, 1039, 613, 674, 632, 1059, 529, 184, 1187, 909, 1107, 955,
+    798, 1191, 572, 318, 442, 394, 886, 1153, 708, 347, 499, 1193, 1141, 428, 496, 835,
+    218, 1319, 1116, 1237, 1308, 355, 1008, 450, 1210, 1201, 261, 1301, 739, 1465, 713, 1129,
+    852, 699, 1268, 906, 1216, 1425, 608, 1241, 1157, 502, 1056, 729, 876, 976, 855, 677,
+    1242, 1215, 468, 185, 601, 294, 115, 274, 789, 1293, 79, 1132, 1274, 670, 722, 618,
+    367, 392, 205, 1427, 70, 654, 841, 597, 574, 1434, 830, 92, 1420, 1382, 179, 146,
+    1257, 1011, 588,
+}};
+
+constexpr std::array<std::int32_t, 1> file_hash_seeds
+{{
+    -1,
+}};
+
+constexpr std::array<std::uint32_t, 1> file_hash_slots
+{{
+    0,
+}};
+
+constexpr std::array<std::int32_t, 1> token_hash_seeds
+{{
+    -1,
+}};
+
+constexpr std::array<std::uint32_t, 1> token_hash_slots
+{{
+    0,
+}};
+
+} // namespace xsk::gsc::h2
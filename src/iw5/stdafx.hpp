@@ -17,6 +17,7 @@
 // C/C++
 #include <regex>
 #include <string>
+#include <cstring>
 #include <vector>
 #include <memory>
 #include <algorithm>
@@ -30,6 +31,12 @@
 #include <sstream>
 #include <fstream>
 #include <unordered_map>
+#include <deque>
+#include <thread>
+#include <mutex>
+#include <shared_mutex>
+#include <condition_variable>
+#include <atomic>
 #include <stdio.h>
 #include <cassert>
 
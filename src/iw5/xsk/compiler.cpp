@@ -11,6 +11,49 @@
 namespace xsk::gsc::iw5
 {
 
+// opcodes behind the operations the function passes work with
+const std::vector<opcode_table::entry> peephole_table =
+{
+    { opcode_table::op::jump, std::uint8_t(opcode::OP_jump) },
+    { opcode_table::op::jump_back, std::uint8_t(opcode::OP_jumpback) },
+    { opcode_table::op::jump_on_false, std::uint8_t(opcode::OP_JumpOnFalse) },
+    { opcode_table::op::jump_on_true, std::uint8_t(opcode::OP_JumpOnTrue) },
+    { opcode_table::op::jump_on_false_expr, std::uint8_t(opcode::OP_JumpOnFalseExpr) },
+    { opcode_table::op::jump_on_true_expr, std::uint8_t(opcode::OP_JumpOnTrueExpr) },
+    { opcode_table::op::switch_jump, std::uint8_t(opcode::OP_switch) },
+    { opcode_table::op::switch_end, std::uint8_t(opcode::OP_endswitch) },
+    { opcode_table::op::end, std::uint8_t(opcode::OP_End) },
+    { opcode_table::op::ret, std::uint8_t(opcode::OP_Return) },
+    { opcode_table::op::cast_bool, std::uint8_t(opcode::OP_CastBool) },
+    { opcode_table::op::bool_not, std::uint8_t(opcode::OP_BoolNot) },
+    { opcode_table::op::get_zero, std::uint8_t(opcode::OP_GetZero) },
+    { opcode_table::op::get_byte, std::uint8_t(opcode::OP_GetByte) },
+    { opcode_table::op::get_neg_byte, std::uint8_t(opcode::OP_GetNegByte) },
+    { opcode_table::op::equality, std::uint8_t(opcode::OP_equality) },
+    { opcode_table::op::inequality, std::uint8_t(opcode::OP_inequality) },
+    { opcode_table::op::less, std::uint8_t(opcode::OP_less) },
+    { opcode_table::op::greater, std::uint8_t(opcode::OP_greater) },
+    { opcode_table::op::less_equal, std::uint8_t(opcode::OP_less_equal) },
+    { opcode_table::op::greater_equal, std::uint8_t(opcode::OP_greater_equal) },
+    { opcode_table::op::eval_local_cached0, std::uint8_t(opcode::OP_EvalLocalVariableCached0) },
+    { opcode_table::op::eval_local_cached1, std::uint8_t(opcode::OP_EvalLocalVariableCached1) },
+    { opcode_table::op::eval_local_cached2, std::uint8_t(opcode::OP_EvalLocalVariableCached2) },
+    { opcode_table::op::eval_local_cached3, std::uint8_t(opcode::OP_EvalLocalVariableCached3) },
+    { opcode_table::op::eval_local_cached4, std::uint8_t(opcode::OP_EvalLocalVariableCached4) },
+    { opcode_table::op::eval_local_cached5, std::uint8_t(opcode::OP_EvalLocalVariableCached5) },
+    { opcode_table::op::eval_local_cached, std::uint8_t(opcode::OP_EvalLocalVariableCached) },
+    { opcode_table::op::set_local_field_cached0, std::uint8_t(opcode::OP_SetLocalVariableFieldCached0) },
+    { opcode_table::op::set_local_field_cached, std::uint8_t(opcode::OP_SetLocalVariableFieldCached) },
+};
+
+// calls to a name the game defines go to the builtin even when a thread has it too
+auto is_builtin(const std::string& name) -> bool
+{
+    return resolver::find_function(name) || resolver::find_method(name);
+}
+
+compiler::compiler(build mode) : mode_(mode), peephole_(peephole_table, opcode_size) {}
+
 auto compiler::output() -> std::vector<function::ptr>
 {
     return std::move(assembly_);
@@ -19,7 +62,11 @@ auto compiler::output() -> std::vector<function::ptr>
 void compiler::compile(const std::string& file, std::vector<std::uint8_t>& data)
 {
     filename_ = file;
-    sources_.clear();
+    sources_.clear_loaded();
+
+    // the syntax tree only lives during this compile, so do its names and strings
+    utils::interner strings;
+    utils::interner::scope scope(strings);
 
     auto prog = parse_buffer(filename_, data);
 
@@ -31,6 +78,48 @@ void compiler::read_callback(std::function<std::vector<std::uint8_t>(const std::
     read_callback_ = func;
 }
 
+void compiler::include_cache(gsc::include_cache* cache)
+{
+    include_cache_ = cache;
+}
+
+void compiler::inlining(bool enable)
+{
+    inlining_ = enable;
+}
+
+void compiler::peephole_rules(bool enable)
+{
+    peephole_rules_ = enable;
+}
+
+void compiler::jump_threading(bool enable)
+{
+    jump_threading_ = enable;
+}
+
+// files read by the last compile besides the script itself
+auto compiler::dependencies() -> std::vector<std::string>
+{
+    auto result = sources_.loaded();
+
+    for (const auto& entry : includes_)
+    {
+        result.push_back(entry.name);
+    }
+
+    std::sort(result.begin(), result.end());
+    result.erase(std::unique(result.begin(), result.end()), result.end());
+
+    return result;
+}
+
+// rewrites the function passes made during the last compile, by rule
+auto compiler::opt_stats() -> const std::map<std::string, std::size_t>&
+{
+    return opt_stats_;
+}
+
 auto compiler::parse_buffer(const std::string& file, std::vector<std::uint8_t>& data) -> ast::program::ptr
 {
     yyscan_t scanner;
@@ -69,14 +158,6 @@ auto compiler::parse_buffer(const std::string& file, std::vector<std::uint8_t>&
     return result;
 }
 
-auto compiler::parse_file(const std::string& file) -> ast::program::ptr
-{
-    auto buffer = read_callback_(file);
-    auto result = parse_buffer(file, buffer);
-
-    return result;
-}
-
 void compiler::compile_program(const ast::program::ptr& program)
 {
     assembly_.clear();
@@ -86,6 +167,15 @@ void compiler::compile_program(const ast::program::ptr& program)
     local_functions_.clear();
     index_ = 1;
     developer_thread_ = false;
+    opt_stats_.clear();
+
+    gsc::optimizer().optimize(program);
+
+    // inlined calls fold again with the arguments they were given
+    if (inlining_ && gsc::inliner(is_builtin).optimize(program, opt_stats_))
+    {
+        gsc::optimizer().optimize(program);
+    }
 
     for (const auto& entry : program->declarations)
     {
@@ -122,21 +212,33 @@ void compiler::emit_include(const ast::include::ptr& include)
 
     try
     {
-        auto program = parse_file(path);
+        auto data = read_callback_(path);
+        const auto hash = utils::hash::fnv1a(data);
 
         std::vector<std::string> funcs;
 
-        for (const auto& decl : program->declarations)
+        // gsh headers can't declare threads, the include alone decides what it exports
+        if (include_cache_ == nullptr || !include_cache_->find(path, hash, funcs))
         {
-            if (decl == ast::kind::decl_thread)
+            auto program = parse_buffer(path, data);
+
+            for (const auto& decl : program->declarations)
+            {
+                if (decl == ast::kind::decl_thread)
+                {
+                    funcs.push_back(decl.as_thread->name->value);
+                }
+            }
+
+            if (funcs.size() == 0)
             {
-                funcs.push_back(decl.as_thread->name->value);
+                throw comp_error(include->loc(), "error empty include file '" + path + "'.");
             }
-        }
 
-        if (funcs.size() == 0)
-        {
-            throw comp_error(include->loc(), "error empty include file '" + path + "'.");
+            if (include_cache_ != nullptr)
+            {
+                include_cache_->insert(path, hash, funcs);
+            }
         }
 
         includes_.push_back(include_t(path, funcs));
@@ -199,6 +301,7 @@ void compiler::emit_decl_thread(const ast::decl_thread::ptr& thread)
     break_blks_.clear();
     continue_blks_.clear();
 
+    locals_.allocate(thread, opt_stats_);
     process_thread(thread, blk);
 
     emit_expr_parameters(thread->params, blk);
@@ -206,6 +309,9 @@ void compiler::emit_decl_thread(const ast::decl_thread::ptr& thread)
     emit_opcode(opcode::OP_End);
 
     function_->size = index_ - function_->index;
+    if (jump_threading_) gsc::flow_graph(peephole_).optimize(*function_, opt_stats_);
+    if (peephole_rules_) gsc::peephole(peephole_).optimize(*function_, opt_stats_);
+    index_ = function_->index + function_->size;
     assembly_.push_back(std::move(function_));
 }
 
@@ -411,6 +517,22 @@ void compiler::emit_stmt_wait(const ast::stmt_wait::ptr& stmt, const block::ptr&
 
 void compiler::emit_stmt_waittill(const ast::stmt_waittill::ptr& stmt, const block::ptr& blk)
 {
+    // locals ordered by use can put variables that aren't created yet in front of the waittill
+    // ones, those are created first so each waittill variable is created right where it is set
+    for (const auto& entry : stmt->args->list)
+    {
+        const auto i = blk->find_variable(entry.as_identifier->id);
+
+        if (i < 0) continue;
+
+        for (auto j = blk->local_vars_create_count; j < static_cast<std::uint32_t>(i); j++)
+        {
+            emit_opcode(opcode::OP_CreateLocalVariable, operand::integer(blk->local_vars[j].create));
+            blk->local_vars[j].init = true;
+            blk->local_vars_create_count = j + 1;
+        }
+    }
+
     emit_expr(stmt->event, blk);
     emit_expr(stmt->obj, blk);
     emit_opcode(opcode::OP_waittill);
@@ -429,7 +551,7 @@ void compiler::emit_stmt_waittillmatch(const ast::stmt_waittillmatch::ptr& stmt,
     emit_expr_arguments(stmt->args, blk);
     emit_expr(stmt->event, blk);
     emit_expr(stmt->obj, blk);
-    emit_opcode(opcode::OP_waittillmatch, utils::string::va("%d", stmt->args->list.size()));
+    emit_opcode(opcode::OP_waittillmatch, operand::integer(stmt->args->list.size()));
     emit_opcode(opcode::OP_waittillmatch2);
     emit_opcode(opcode::OP_clearparams);
 }
@@ -522,8 +644,8 @@ void compiler::emit_stmt_while(const ast::stmt_while::ptr& stmt, const block::pt
     auto continue_loc = create_label();
 
     blk->transfer(stmt->blk);
-    stmt->blk->loc_break = break_loc;
-    stmt->blk->loc_continue = continue_loc;
+    stmt->blk->label_break = break_loc.as_label();
+    stmt->blk->label_continue = continue_loc.as_label();
 
     emit_create_local_vars(stmt->blk);
     
@@ -576,8 +698,8 @@ void compiler::emit_stmt_dowhile(const ast::stmt_dowhile::ptr& stmt, const block
     auto continue_loc = create_label();
 
     blk->transfer(stmt->blk);
-    stmt->blk->loc_break = break_loc;
-    stmt->blk->loc_continue = continue_loc;
+    stmt->blk->label_break = break_loc.as_label();
+    stmt->blk->label_continue = continue_loc.as_label();
 
     emit_create_local_vars(stmt->blk);
     
@@ -632,8 +754,8 @@ void compiler::emit_stmt_for(const ast::stmt_for::ptr& stmt, const block::ptr& b
     emit_stmt(stmt->init, blk, false);
 
     blk->transfer(stmt->blk);
-    stmt->blk->loc_break = break_loc;
-    stmt->blk->loc_continue = continue_loc;
+    stmt->blk->label_break = break_loc.as_label();
+    stmt->blk->label_continue = continue_loc.as_label();
 
     emit_create_local_vars(stmt->blk);
 
@@ -707,8 +829,8 @@ void compiler::emit_stmt_foreach(const ast::stmt_foreach::ptr& stmt, const block
     emit_expr_variable_ref(stmt->key_expr, blk, true);
 
     blk->transfer(stmt->ctx);
-    stmt->ctx->loc_break = break_loc;
-    stmt->ctx->loc_continue = continue_loc;
+    stmt->ctx->label_break = break_loc.as_label();
+    stmt->ctx->label_continue = continue_loc.as_label();
 
     emit_create_local_vars(stmt->ctx);
 
@@ -777,8 +899,8 @@ void compiler::emit_stmt_switch(const ast::stmt_switch::ptr& stmt, const block::
 
     can_break_ = true;
 
-    std::vector<std::string> data;
-    data.push_back(utils::string::va("%d", stmt->stmt->list.size()));
+    std::vector<operand> data;
+    data.push_back(operand::integer(stmt->stmt->list.size()));
 
     bool has_default = false;
     block* default_ctx = nullptr;
@@ -799,7 +921,9 @@ void compiler::emit_stmt_switch(const ast::stmt_switch::ptr& stmt, const block::
             {
                 auto loc = insert_label();
                 data.push_back("case");
-                data.push_back(case_->label.as_integer->value);
+                const auto& value = case_->label.as_integer->value;
+                // negative labels don't fit the jump table and stay strings
+                data.push_back(utils::string::is_number(value) ? operand::integer(std::stoi(value)) : operand(value));
                 data.push_back(loc);
             }
             else if (case_->label == ast::kind::expr_string)
@@ -815,7 +939,7 @@ void compiler::emit_stmt_switch(const ast::stmt_switch::ptr& stmt, const block::
             }
 
             blk->transfer(case_->blk);
-            case_->blk->loc_break = break_loc;
+            case_->blk->label_break = break_loc.as_label();
             emit_stmt_list(case_->stmt, case_->blk, false);
             if (case_->stmt->list.size() > 0)
                 emit_remove_local_vars(case_->blk);
@@ -830,7 +954,7 @@ void compiler::emit_stmt_switch(const ast::stmt_switch::ptr& stmt, const block::
             default_ctx = entry.as_default->blk.get();
 
             blk->transfer(entry.as_default->blk);
-            entry.as_default->blk->loc_break = break_loc;
+            entry.as_default->blk->label_break = break_loc.as_label();
             emit_stmt_list(entry.as_default->stmt, entry.as_default->blk, false);
             if (entry.as_default->stmt->list.size() > 0)
                 emit_remove_local_vars(entry.as_default->blk);
@@ -876,24 +1000,24 @@ void compiler::emit_stmt_default(const ast::stmt_default::ptr& stmt, const block
 
 void compiler::emit_stmt_break(const ast::stmt_break::ptr& stmt, const block::ptr& blk)
 {
-    if (!can_break_ || blk->abort != abort_t::abort_none || blk->loc_break == "")
+    if (!can_break_ || blk->abort != abort_t::abort_none || blk->label_break == 0)
         throw comp_error(stmt->loc(), "illegal break statement");
 
     break_blks_.push_back(blk.get());
     emit_remove_local_vars(blk);
     blk->abort = abort_t::abort_break;
-    emit_opcode(opcode::OP_jump, blk->loc_break);
+    emit_opcode(opcode::OP_jump, operand::label(blk->label_break));
 }
 
 void compiler::emit_stmt_continue(const ast::stmt_continue::ptr& stmt, const block::ptr& blk)
 {
-    if (!can_continue_ || blk->abort != abort_t::abort_none || blk->loc_continue == "")
+    if (!can_continue_ || blk->abort != abort_t::abort_none || blk->label_continue == 0)
         throw comp_error(stmt->loc(), "illegal continue statement");
     
     continue_blks_.push_back(blk.get());
     emit_remove_local_vars(blk);
     blk->abort = abort_t::abort_continue;
-    emit_opcode(opcode::OP_jump, blk->loc_continue);
+    emit_opcode(opcode::OP_jump, operand::label(blk->label_continue));
 }
 
 void compiler::emit_stmt_return(const ast::stmt_return::ptr& stmt, const block::ptr& blk)
@@ -1302,7 +1426,7 @@ void compiler::emit_expr_call_pointer(const ast::expr_pointer::ptr& expr, const
     emit_expr_arguments(expr->args, blk);
     emit_expr(expr->func, blk);
 
-    auto argcount = utils::string::va("%d", expr->args->list.size());
+    auto argcount = operand::integer(expr->args->list.size());
 
     switch (expr->mode)
     {
@@ -1330,7 +1454,7 @@ void compiler::emit_expr_call_function(const ast::expr_function::ptr& expr, cons
 
     emit_expr_arguments(expr->args, blk);
 
-    auto argcount = utils::string::va("%d", expr->args->list.size());
+    auto argcount = operand::integer(expr->args->list.size());
 
     if (type == ast::call::type::local)
     {
@@ -1338,15 +1462,15 @@ void compiler::emit_expr_call_function(const ast::expr_function::ptr& expr, cons
         {
             case ast::call::mode::normal:
                 if (expr->args->list.size() > 0)
-                    emit_opcode(opcode::OP_ScriptLocalFunctionCall, expr->name->value);
+                    emit_opcode(opcode::OP_ScriptLocalFunctionCall, local_function(expr->name->value));
                 else
-                    emit_opcode(opcode::OP_ScriptLocalFunctionCall2, expr->name->value);
+                    emit_opcode(opcode::OP_ScriptLocalFunctionCall2, local_function(expr->name->value));
                 break;
             case ast::call::mode::thread:
-                emit_opcode(opcode::OP_ScriptLocalThreadCall, { expr->name->value, argcount });
+                emit_opcode(opcode::OP_ScriptLocalThreadCall, { local_function(expr->name->value), argcount });
                 break;
             case ast::call::mode::childthread:
-                emit_opcode(opcode::OP_ScriptLocalChildThreadCall, { expr->name->value, argcount });
+                emit_opcode(opcode::OP_ScriptLocalChildThreadCall, { local_function(expr->name->value), argcount });
                 break;
             case ast::call::mode::builtin:
                 // no local builtins
@@ -1425,7 +1549,7 @@ void compiler::emit_expr_method_pointer(const ast::expr_pointer::ptr& expr, cons
     emit_expr(obj, blk);
     emit_expr(expr->func, blk);
 
-    auto argcount = utils::string::va("%d", expr->args->list.size());
+    auto argcount = operand::integer(expr->args->list.size());
 
     switch (expr->mode)
     {
@@ -1454,20 +1578,20 @@ void compiler::emit_expr_method_function(const ast::expr_function::ptr& expr, co
     emit_expr_arguments(expr->args, blk);
     emit_expr(obj, blk);
 
-    auto argcount = utils::string::va("%d", expr->args->list.size());
+    auto argcount = operand::integer(expr->args->list.size());
 
     if (type == ast::call::type::local)
     {
         switch (expr->mode)
         {
             case ast::call::mode::normal:
-                emit_opcode(opcode::OP_ScriptLocalMethodCall, expr->name->value);
+                emit_opcode(opcode::OP_ScriptLocalMethodCall, local_function(expr->name->value));
                 break;
             case ast::call::mode::thread:
-                emit_opcode(opcode::OP_ScriptLocalMethodThreadCall, { expr->name->value, argcount });
+                emit_opcode(opcode::OP_ScriptLocalMethodThreadCall, { local_function(expr->name->value), argcount });
                 break;
             case ast::call::mode::childthread:
-                emit_opcode(opcode::OP_ScriptLocalMethodChildThreadCall, { expr->name->value, argcount });
+                emit_opcode(opcode::OP_ScriptLocalMethodChildThreadCall, { local_function(expr->name->value), argcount });
                 break;
             case ast::call::mode::builtin:
                 // no local builtins
@@ -1564,7 +1688,7 @@ void compiler::emit_expr_reference(const ast::expr_reference::ptr& expr, const b
     switch (type)
     {
         case ast::call::type::local:
-            emit_opcode(opcode::OP_GetLocalFunction, expr->name->value);
+            emit_opcode(opcode::OP_GetLocalFunction, local_function(expr->name->value));
             break;
         case ast::call::type::far:
             emit_opcode(opcode::OP_GetFarFunction, { expr->path->value, expr->name->value });
@@ -1889,26 +2013,26 @@ void compiler::emit_expr_object(const ast::expr& expr, const block::ptr& blk)
 
 void compiler::emit_expr_vector(const ast::expr_vector::ptr& expr, const block::ptr& blk)
 {
-    std::vector<std::string> data;
+    std::vector<operand> data;
 
     bool isexpr = false;
 
     if (expr->x == ast::kind::expr_integer)
-        data.push_back(expr->x.as_integer->value);
+        data.push_back(operand::component(std::stof(expr->x.as_integer->value)));
     else if (expr->x == ast::kind::expr_float)
-        data.push_back(expr->x.as_float->value);
+        data.push_back(operand::component(std::stof(expr->x.as_float->value)));
     else isexpr = true;
 
     if (expr->y == ast::kind::expr_integer)
-        data.push_back(expr->y.as_integer->value);
+        data.push_back(operand::component(std::stof(expr->y.as_integer->value)));
     else if (expr->y == ast::kind::expr_float)
-        data.push_back(expr->y.as_float->value);
+        data.push_back(operand::component(std::stof(expr->y.as_float->value)));
     else isexpr = true;
 
     if (expr->z == ast::kind::expr_integer)
-        data.push_back(expr->z.as_integer->value);
+        data.push_back(operand::component(std::stof(expr->z.as_integer->value)));
     else if (expr->z == ast::kind::expr_float)
-        data.push_back(expr->z.as_float->value);
+        data.push_back(operand::component(std::stof(expr->z.as_float->value)));
     else isexpr = true;
 
     if (!isexpr)
@@ -1976,7 +2100,7 @@ void compiler::emit_expr_string(const ast::expr_string::ptr& expr)
 
 void compiler::emit_expr_color(const ast::expr_color::ptr& expr)
 {
-    std::vector<std::string> data;
+    std::vector<operand> data;
     std::string x, y, z;
 
     if (expr->value.size() == 3)
@@ -1992,15 +2116,15 @@ void compiler::emit_expr_color(const ast::expr_color::ptr& expr)
         z = "0x" + expr->value.substr(4, 2);
     }
 
-    data.push_back(utils::string::hex_to_dec(x.data()));
-    data.push_back(utils::string::hex_to_dec(y.data()));
-    data.push_back(utils::string::hex_to_dec(z.data()));
+    data.push_back(operand::component(static_cast<float>(std::stoi(x, nullptr, 16))));
+    data.push_back(operand::component(static_cast<float>(std::stoi(y, nullptr, 16))));
+    data.push_back(operand::component(static_cast<float>(std::stoi(z, nullptr, 16))));
     emit_opcode(opcode::OP_GetVector, data);
 }
 
 void compiler::emit_expr_float(const ast::expr_float::ptr& expr)
 {
-    emit_opcode(opcode::OP_GetFloat, expr->value);
+    emit_opcode(opcode::OP_GetFloat, operand::floating(std::stof(expr->value)));
 }
 
 void compiler::emit_expr_integer(const ast::expr_integer::ptr& expr)
@@ -2013,23 +2137,23 @@ void compiler::emit_expr_integer(const ast::expr_integer::ptr& expr)
     }
     else if (value > 0 && value < 256)
     {
-        emit_opcode(opcode::OP_GetByte, expr->value);
+        emit_opcode(opcode::OP_GetByte, operand::integer(value));
     }
     else if (value < 0 && value > -256)
     {
-        emit_opcode(opcode::OP_GetNegByte, expr->value.substr(1));
+        emit_opcode(opcode::OP_GetNegByte, operand::integer(-value));
     }
     else if (value > 0 && value < 65536)
     {
-        emit_opcode(opcode::OP_GetUnsignedShort, expr->value);
+        emit_opcode(opcode::OP_GetUnsignedShort, operand::integer(value));
     }
     else if (value < 0 && value > -65536)
     {
-        emit_opcode(opcode::OP_GetNegUnsignedShort, expr->value.substr(1));
+        emit_opcode(opcode::OP_GetNegUnsignedShort, operand::integer(-value));
     }
     else
     {
-        emit_opcode(opcode::OP_GetInteger, expr->value);
+        emit_opcode(opcode::OP_GetInteger, operand::integer(value));
     }
 }
 
@@ -2040,7 +2164,7 @@ void compiler::emit_expr_false(const ast::expr_false::ptr&)
 
 void compiler::emit_expr_true(const ast::expr_true::ptr&)
 {
-    emit_opcode(opcode::OP_GetByte, "1");
+    emit_opcode(opcode::OP_GetByte, operand::integer(1));
 }
 
 void compiler::emit_create_local_vars(const block::ptr& blk)
@@ -2049,7 +2173,7 @@ void compiler::emit_create_local_vars(const block::ptr& blk)
     {
         for (auto i = blk->local_vars_create_count; i < blk->local_vars_public_count; i++)
         {
-            auto data = utils::string::va("%d", blk->local_vars.at(i).create);
+            auto data = operand::integer(blk->local_vars.at(i).create);
             emit_opcode(opcode::OP_CreateLocalVariable, data);
             blk->local_vars.at(i).init = true;
         }
@@ -2065,7 +2189,7 @@ void compiler::emit_remove_local_vars(const block::ptr& blk)
 
         if (count > 0)
         {
-            auto data = utils::string::va("%d", count);
+            auto data = operand::integer(count);
             emit_opcode(opcode::OP_RemoveLocalVariables, data);
         }
     }
@@ -2083,7 +2207,7 @@ void compiler::emit_opcode(opcode op)
     index_ += inst->size;
 }
 
-void compiler::emit_opcode(opcode op, const std::string& data)
+void compiler::emit_opcode(opcode op, const operand& data)
 {
     function_->instructions.push_back(std::make_unique<instruction>());
     
@@ -2096,7 +2220,7 @@ void compiler::emit_opcode(opcode op, const std::string& data)
     index_ += inst->size;
 }
 
-void compiler::emit_opcode(opcode op, const std::vector<std::string>& data)
+void compiler::emit_opcode(opcode op, const std::vector<operand>& data)
 {
     function_->instructions.push_back(std::make_unique<instruction>());
     
@@ -2113,6 +2237,7 @@ void compiler::process_thread(const ast::decl_thread::ptr& decl, const block::pt
 {
     process_expr_parameters(decl->params, blk);
     process_stmt_list(decl->stmt, blk);
+    locals_.order(*blk, decl->params->list.size(), opt_stats_);
 }
 
 void compiler::process_stmt(const ast::stmt& stmt, const block::ptr& blk)
@@ -2253,7 +2378,7 @@ void compiler::process_stmt_waittill(const ast::stmt_waittill::ptr& stmt, const
             throw comp_error(entry.loc(), "illegal waittill param, must be a local variable");
         }
     
-        register_variable(entry.as_identifier->value, blk);
+        register_variable(entry.as_identifier->id, blk);
     }
 }
 
@@ -2315,6 +2440,7 @@ void compiler::process_stmt_while(const ast::stmt_while::ptr& stmt, const block:
     stmt->blk = std::make_unique<block>();
 
     blk->copy(stmt->blk);
+    register_hoisted(stmt.get(), stmt->blk);
     process_stmt(stmt->stmt, stmt->blk);
 
     continue_blks_.push_back(stmt->blk.get());
@@ -2342,6 +2468,7 @@ void compiler::process_stmt_dowhile(const ast::stmt_dowhile::ptr& stmt, const bl
     stmt->blk = std::make_unique<block>();
 
     blk->copy(stmt->blk);
+    register_hoisted(stmt.get(), stmt->blk);
     process_stmt(stmt->stmt, stmt->blk);
 
     continue_blks_.push_back(stmt->blk.get());
@@ -2373,6 +2500,7 @@ void compiler::process_stmt_for(const ast::stmt_for::ptr& stmt, const block::ptr
 
     blk->copy(stmt->blk);
     blk->copy(stmt->blk_iter);
+    register_hoisted(stmt.get(), stmt->blk);
 
     process_stmt(stmt->stmt, stmt->blk);
 
@@ -2421,6 +2549,7 @@ void compiler::process_stmt_foreach(const ast::stmt_foreach::ptr& stmt, const bl
 
     blk->copy(stmt->ctx);
     blk->copy(stmt->ctx_post);
+    register_hoisted(stmt.get(), stmt->ctx);
 
     // calculate stmt variables & add missing array access as first stmt
     process_expr(stmt->value_expr, stmt->ctx);
@@ -2595,7 +2724,7 @@ void compiler::process_expr(const ast::expr& expr, const block::ptr& blk)
 {
     if (expr == ast::kind::expr_identifier)
     {
-        register_variable(expr.as_identifier->value, blk);
+        register_variable(expr.as_identifier->id, blk);
     }
     else if (expr == ast::kind::expr_array)
     {
@@ -2607,59 +2736,54 @@ void compiler::process_expr_parameters(const ast::expr_parameters::ptr& decl, co
 {
     for (const auto& entry : decl->list)
     {
-        register_variable(entry->value, blk);
+        register_variable(entry->id, blk);
     }
 }
 
-void compiler::register_variable(const std::string& name, const block::ptr& blk)
+void compiler::register_variable(utils::interner::handle name, const block::ptr& blk)
 {
-    auto it = std::find_if (blk->local_vars.begin(), blk->local_vars.end(),
-            [&](const gsc::local_var& v) { return v.name == name; });
+    if (blk->find_variable(name) >= 0) return;
+
+    const auto itr = local_stack_.find(name);
 
-    if (it == blk->local_vars.end())
+    if (itr != local_stack_.end())
     {
-        auto found = false;
-        for (std::size_t i = 0; i < local_stack_.size(); i++)
-        {
-            if (local_stack_[i] == name)
-            {
-                blk->local_vars.push_back({ name, static_cast<uint8_t>(i), false });
-                found = true;
-                break;
-            }
-        }
+        blk->local_vars.push_back({ name, itr->second, false });
+    }
+    else
+    {
+        blk->local_vars.push_back({ name, stack_idx_, false });
+        local_stack_.insert({ name, stack_idx_ });
+        stack_idx_++;
+    }
+}
 
-        if (!found)
-        {
-            blk->local_vars.push_back({ name, stack_idx_, false });
-            local_stack_.push_back(name);
-            stack_idx_++;
-        }
+// variables the allocator moved out of a loop are created with the loop block
+void compiler::register_hoisted(const ast::node* loop, const block::ptr& blk)
+{
+    for (const auto name : locals_.hoisted(loop))
+    {
+        register_variable(name, blk);
     }
 }
 
 void compiler::initialize_variable(const ast::expr_identifier::ptr& name, const block::ptr& blk)
 {
-    for (std::uint32_t i = 0; i < blk->local_vars.size(); i++)
+    const auto i = blk->find_variable(name->id);
+
+    if (i >= 0 && !blk->local_vars[i].init)
     {
-        if (blk->local_vars[i].name == name->value)
+        for (auto j = 0; j < i; j++)
         {
-            if (!blk->local_vars[i].init)
+            if (!blk->local_vars[j].init)
             {
-                for (std::uint32_t j = 0; j < i; j++)
-                {
-                    if (!blk->local_vars[j].init)
-                    {
-                        emit_opcode(opcode::OP_CreateLocalVariable, utils::string::va("%d", blk->local_vars[j].create));
-                        blk->local_vars[j].init = true;
-                        //ctx->local_vars_create_count++;
-                    }
-                }
-                blk->local_vars[i].init = true;
-                blk->local_vars_create_count = i + 1;
-                return;
+                emit_opcode(opcode::OP_CreateLocalVariable, operand::integer(blk->local_vars[j].create));
+                blk->local_vars[j].init = true;
             }
         }
+        blk->local_vars[i].init = true;
+        blk->local_vars_create_count = i + 1;
+        return;
     }
 
     throw comp_error(name->loc(), "local variable '" + name->value + "' not found.");
@@ -2667,82 +2791,65 @@ void compiler::initialize_variable(const ast::expr_identifier::ptr& name, const
 
 void compiler::create_variable(const ast::expr_identifier::ptr& name, const block::ptr& blk)
 {
-    for (std::size_t i = 0; i < blk->local_vars.size(); i++)
+    const auto i = blk->find_variable(name->id);
+
+    if (i < 0)
+        throw comp_error(name->loc(), "local variable '" + name->value + "' not found.");
+
+    auto& var = blk->local_vars.at(i);
+
+    if (!var.init)
     {
-        auto& var = blk->local_vars.at(i);
-        if (var.name == name->value)
-        {
-            if (!var.init)
-            {
-                emit_opcode(opcode::OP_CreateLocalVariable, utils::string::va("%d", var.create));
-                var.init = true;
-                blk->local_vars_create_count++;
-            }
-            return;
-        }
+        emit_opcode(opcode::OP_CreateLocalVariable, operand::integer(var.create));
+        var.init = true;
+        blk->local_vars_create_count++;
     }
-
-    throw comp_error(name->loc(), "local variable '" + name->value + "' not found.");
 }
 
 auto compiler::variable_stack_index(const ast::expr_identifier::ptr& name, const block::ptr& blk) -> std::uint8_t
 {
-    for (std::size_t i = 0; i < blk->local_vars.size(); i++)
-    {
-        if (blk->local_vars[i].name == name->value)
-        {
-            if (blk->local_vars.at(i).init)
-            {
-                return blk->local_vars_create_count - 1 - i;
-            }
+    const auto i = blk->find_variable(name->id);
 
-            throw comp_error(name->loc(), "local variable '" + name->value + "' not initialized.");
-        }   
-    }
+    if (i < 0)
+        throw comp_error(name->loc(), "local variable '" + name->value + "' not found.");
 
-    throw comp_error(name->loc(), "local variable '" + name->value + "' not found.");
+    if (!blk->local_vars.at(i).init)
+        throw comp_error(name->loc(), "local variable '" + name->value + "' not initialized.");
+
+    return blk->local_vars_create_count - 1 - i;
 }
 
-auto compiler::variable_create_index(const ast::expr_identifier::ptr& name, const block::ptr& blk) -> std::string
+auto compiler::variable_create_index(const ast::expr_identifier::ptr& name, const block::ptr& blk) -> operand
 {
-    for (std::size_t i = 0; i < blk->local_vars.size(); i++)
-    {
-        if (blk->local_vars[i].name == name->value)
-            return utils::string::va("%d", blk->local_vars[i].create);
-    }
+    const auto i = blk->find_variable(name->id);
 
-    throw comp_error(name->loc(), "local variable '" + name->value + "' not found.");
+    if (i < 0)
+        throw comp_error(name->loc(), "local variable '" + name->value + "' not found.");
+
+    return operand::integer(blk->local_vars[i].create);
 }
 
-auto compiler::variable_access_index(const ast::expr_identifier::ptr& name, const block::ptr& blk) -> std::string
+auto compiler::variable_access_index(const ast::expr_identifier::ptr& name, const block::ptr& blk) -> operand
 {
-    for (std::size_t i = 0; i < blk->local_vars.size(); i++)
-    {
-        if (blk->local_vars[i].name == name->value)
-        {
-            if (blk->local_vars.at(i).init)
-            {
-                return utils::string::va("%d", blk->local_vars_create_count - 1 - i);
-            }
+    const auto i = blk->find_variable(name->id);
 
-            throw comp_error(name->loc(), "local variable '" + name->value + "' not initialized.");
-        }   
-    }
+    if (i < 0)
+        throw comp_error(name->loc(), "local variable '" + name->value + "' not found.");
 
-    throw comp_error(name->loc(), "local variable '" + name->value + "' not found.");
+    if (!blk->local_vars.at(i).init)
+        throw comp_error(name->loc(), "local variable '" + name->value + "' not initialized.");
+
+    return operand::integer(blk->local_vars_create_count - 1 - i);
 }
 
 auto compiler::variable_initialized(const ast::expr_identifier::ptr& name, const block::ptr& blk) -> bool
 {
-    for (std::size_t i = 0; i < blk->local_vars.size(); i++)
-    {
-        if (blk->local_vars[i].name == name->value)
-        {
-            return blk->local_vars.at(i).init;
-        }
-    }
+    const auto i = blk->find_variable(name->id);
 
-    throw comp_error(name->loc(), "local variable '" + name->value + "' not found.");
+    if (i < 0)
+        throw comp_error(name->loc(), "local variable '" + name->value + "' not found.");
+
+    return blk->local_vars.at(i).init;
 }
 
 auto compiler::resolve_function_type(const ast::expr_function::ptr& expr) -> ast::call::type
@@ -2840,31 +2947,34 @@ auto compiler::is_constant_condition(const ast::expr& expr) -> bool
     return false;
 }
 
-auto compiler::create_label() -> std::string
+// local calls refer to the function by its position, the assembler doesn't look up names
+auto compiler::local_function(const std::string& name) -> operand
+{
+    const auto itr = std::find(local_functions_.begin(), local_functions_.end(), name);
+    return operand::function(static_cast<std::uint32_t>(itr - local_functions_.begin()), name);
+}
+
+auto compiler::create_label() -> operand
 {
-    label_idx_++;
-    auto name = utils::string::va("loc_%d", label_idx_);
-    return name;
+    return operand::label(++label_idx_);
 }
 
-auto compiler::insert_label() -> std::string
+auto compiler::insert_label() -> operand
 {
     const auto itr = function_->labels.find(index_);
 
     if (itr != function_->labels.end())
     {
-       return itr->second;
+       return operand::label(itr->second);
     }
     else
     {
-        label_idx_++;
-        auto name = utils::string::va("loc_%d", label_idx_);
-        function_->labels.insert({index_, name});
-        return name;
+        function_->labels.insert({index_, ++label_idx_});
+        return operand::label(label_idx_);
     }
 }
 
-void compiler::insert_label(const std::string& name)
+void compiler::insert_label(const operand& name)
 {
     const auto itr = function_->labels.find(index_);
 
@@ -2881,8 +2991,8 @@ void compiler::insert_label(const std::string& name)
                 case opcode::OP_jump:
                 case opcode::OP_jumpback:
                 case opcode::OP_switch:
-                    if (inst->data[0] == name)
-                        inst->data[0] = itr->second;
+                    if (inst->data[0].as_label() == name.as_label())
+                        inst->data[0] = operand::label(itr->second);
                     break;
                 case opcode::OP_endswitch:
                 default:
@@ -2892,7 +3002,7 @@ void compiler::insert_label(const std::string& name)
     }
     else
     {
-        function_->labels.insert({index_, name});
+        function_->labels.insert({index_, name.as_label()});
     }
 }
 
@@ -3501,7 +3611,7 @@ void compiler::print_debug_info()
 
             if (itr != func->labels.end())
             {
-                print_label(itr->second);
+                print_label(operand::label_name(itr->second));
             }
 
             print_instruction(inst);
@@ -3529,21 +3639,21 @@ void compiler::print_instruction(const instruction::ptr& inst)
     case opcode::OP_endswitch:
         print_opcodes(inst->index, 3);
         printf("%s", resolver::opcode_name(inst->opcode).data());
-        printf(" %s\n", inst->data[0].data());
+        printf(" %s\n", inst->data[0].str().data());
         {
-            std::uint32_t totalcase = std::stoul(inst->data[0]);
+            std::uint32_t totalcase = inst->data[0].as_uint();
             auto index = 0;
             for (auto casenum = 0u; casenum < totalcase; casenum++)
             {
                 print_opcodes(inst->index, 7);
                 if (inst->data[1 + index] == "case")
                 {
-                    printf("%s %s %s", inst->data[1 + index].data(), inst->data[1 + index + 1].data(), inst->data[1 + index + 2].data());
+                    printf("%s %s %s", inst->data[1 + index].str().data(), inst->data[1 + index + 1].str().data(), inst->data[1 + index + 2].str().data());
                     index += 3;
                 }
                 else if (inst->data[1 + index] == "default")
                 {
-                    printf("%s %s", inst->data[1 + index].data(), inst->data[1 + index + 1].data());
+                    printf("%s %s", inst->data[1 + index].str().data(), inst->data[1 + index + 1].str().data());
                     index += 2;
                 }
                 if (casenum != totalcase - 1)
@@ -3558,7 +3668,7 @@ void compiler::print_instruction(const instruction::ptr& inst)
         printf("%s", resolver::opcode_name(inst->opcode).data());
         for (auto& d : inst->data)
         {
-            printf(" %s", d.data());
+            printf(" %s", d.str().data());
         }
         break;
     }
@@ -5,193 +5,27 @@
 
 #include "stdafx.hpp"
 #include "iw5.hpp"
+#include "resolver_hash.hpp"
 
 namespace xsk::gsc::iw5
 {
 
-std::unordered_map<std::uint8_t, std::string> opcode_map;
-std::unordered_map<std::uint16_t, std::string> function_map;
-std::unordered_map<std::uint16_t, std::string> method_map;
-std::unordered_map<std::uint16_t, std::string> file_map;
-std::unordered_map<std::uint16_t, std::string> token_map;
-std::unordered_map<std::string, std::uint8_t> opcode_map_rev;
-std::unordered_map<std::string, std::uint16_t> function_map_rev;
-std::unordered_map<std::string, std::uint16_t> method_map_rev;
-std::unordered_map<std::string, std::uint16_t> file_map_rev;
-std::unordered_map<std::string, std::uint16_t> token_map_rev;
-
-auto resolver::opcode_id(const std::string& name) -> std::uint8_t
-{
-    const auto itr = opcode_map_rev.find(name);
-
-    if (itr != opcode_map_rev.end())
-    {
-        return itr->second;
-    }
-
-    throw error(utils::string::va("Couldn't resolve opcode id for name '%s'!", name.data()));
-}
-
-auto resolver::opcode_name(std::uint8_t id) -> std::string
-{
-    const auto itr = opcode_map.find(id);
-
-    if (itr != opcode_map.end())
-    {
-        return itr->second;
-    }
-
-    throw error(utils::string::va("Couldn't resolve opcode name for id '0x%hhX'!", id));
-}
-
-auto resolver::function_id(const std::string& name) -> std::uint16_t
+struct custom_tables
 {
-    const auto itr = function_map_rev.find(name);
-
-    if (itr != function_map_rev.end())
-    {
-        return itr->second;
-    }
-
-    throw error(utils::string::va("Couldn't resolve builtin function id for name '%s'!", name.data()));
-}
-
-auto resolver::function_name(std::uint16_t id) -> std::string
-{
-    const auto itr = function_map.find(id);
-
-    if (itr != function_map.end())
-    {
-        return itr->second;
-    }
-
-    throw error(utils::string::va("Couldn't resolve builtin function name for id '%i'!", id));
-}
-
-auto resolver::method_id(const std::string& name) -> std::uint16_t
-{
-    const auto itr = method_map_rev.find(name);
-
-    if (itr != method_map_rev.end())
-    {
-        return itr->second;
-    }
-
-    throw error(utils::string::va("Couldn't resolve builtin method id for name '%s'!", name.data()));
-}
-
-auto resolver::method_name(std::uint16_t id) -> std::string
-{
-    const auto itr = method_map.find(id);
-
-    if (itr != method_map.end())
-    {
-        return itr->second;
-    }
-
-    throw error(utils::string::va("Couldn't resolve builtin method name for id '%i'!", id));
-}
-
-auto resolver::file_id(const std::string& name) -> std::uint16_t
-{
-    const auto itr = file_map_rev.find(name);
-
-    if (itr != file_map_rev.end())
-    {
-        return itr->second;
-    }
-
-    return 0;
-}
-
-auto resolver::file_name(std::uint16_t id) -> std::string
-{
-    const auto itr = file_map.find(id);
-
-    if (itr != file_map.end())
-    {
-        return itr->second;
-    }
-
-    return utils::string::va("_ID%i", id);
-}
-
-auto resolver::token_id(const std::string& name) -> std::uint16_t
-{
-    const auto itr = token_map_rev.find(name);
-
-    if (itr != token_map_rev.end())
-    {
-        return itr->second;
-    }
-
-    return 0;
-}
-
-auto resolver::token_name(std::uint16_t id) -> std::string
-{
-    const auto itr = token_map.find(id);
-
-    if (itr != token_map.end())
-    {
-        return itr->second;
-    }
-
-    return utils::string::va("_ID%i", id);
-}
-
-auto resolver::find_function(const std::string& name) -> bool
-{
-    const auto itr = function_map_rev.find(name);
-
-    if (itr != function_map_rev.end())
-    {
-        return true;
-    }
-
-    return false;
-}
-
-auto resolver::find_method(const std::string& name) -> bool
-{
-    const auto itr = method_map_rev.find(name);
-
-    if (itr != method_map_rev.end())
-    {
-        return true;
-    }
-
-    return false;
-}
-
-void resolver::add_function(const std::string& name, std::uint16_t id)
-{
-    const auto itr = function_map_rev.find(name);
-
-    if (itr != function_map_rev.end())
-    {
-        throw error("builtin function '" + name + "' already defined.");
-    }
-
-    function_map.insert({ id, name });
-    function_map_rev.insert({ name, id });
-
-}
+    std::shared_mutex mutex;
+    std::unordered_map<std::uint16_t, std::string> function_map;
+    std::unordered_map<std::uint16_t, std::string> method_map;
+    std::unordered_map<std::string, std::uint16_t> function_map_rev;
+    std::unordered_map<std::string, std::uint16_t> method_map_rev;
+};
 
-void resolver::add_method(const std::string& name, std::uint16_t id)
+auto get_custom_tables() -> custom_tables&
 {
-    const auto itr = method_map_rev.find(name);
-
-    if (itr != method_map_rev.end())
-    {
-        throw error("builtin method '" + name + "' already defined.");
-    }
-
-    method_map.insert({ id, name });
-    method_map_rev.insert({ name, id });
+    static custom_tables instance;
+    return instance;
 }
 
-const std::array<pair_8C, 153> opcode_list
+constexpr std::array<pair_8C, 153> opcode_list
 {{
     { std::uint8_t(opcode::OP_End),"END" },
     { std::uint8_t(opcode::OP_Return),"RETN" },
@@ -348,7 +182,7 @@ const std::array<pair_8C, 153> opcode_list
     { std::uint8_t(opcode::OP_BoolComplement),"BOOL_COMPLEMENT" },
 }};
 
-const std::array<pair_16C, 455> function_list
+constexpr std::array<pair_16C, 455> function_list
 {{
     { 0x001, "precacheturret" },
     { 0x002, "getweaponarray" },
@@ -807,7 +641,7 @@ const std::array<pair_16C, 455> function_list
     { 0x1C7, "precachesound" },
 }};
 
-const std::array<pair_16C, 780> method_list
+constexpr std::array<pair_16C, 780> method_list
 {{
     { 0x8000, "thermaldrawdisable" },
     { 0x8001, "setturretdismountorg" },
@@ -1592,7 +1426,7 @@ const std::array<pair_16C, 780> method_list
     { 0x830C, "setgametypestring" },
 }};
 
-const std::array<pair_16C, 592> file_list
+constexpr std::array<pair_16C, 592> file_list
 {{
     { 29, "maps/mp/gametypes/_tweakables" },
     { 30, "common_scripts/utility" },
@@ -2250,7 +2084,7 @@ const std::array<pair_16C, 592> file_list
     { 33386, "maps/so_survival_mp_park_precache" },
 }};
 
-const std::array<pair_16C, 5534> token_list
+constexpr std::array<pair_16C, 5534> token_list
 {{
     { 1, "pl#" },
     { 17, "teamHasRemoteUAV" }, // was introduced in an IW patch, made up name
@@ -5307,9 +5141,9 @@ const std::array<pair_16C, 5534> token_list
     { 12433, "lifeId" },
     { 12434, "heliType" },
     { 12435, "queueAdd" },
-    { 12438, "setUsingRemote" },
     { 12436, "currentActiveVehicleCount" },
     { 12437, "maxVehiclesAllowed" },
+    { 12438, "setUsingRemote" },
     { 12439, "initRideKillstreak" },
     { 12440, "clearUsingRemote" },
     { 12441, "deleteOnEntNotify" },
@@ -7826,58 +7660,250 @@ const std::array<pair_16C, 5534> token_list
     { 25827, "_unk_field_ID25827" }, // was introduced in an IW patch, used in _destructible.gsc
 }};
 
-struct __init__
+constexpr auto function_base = lookup::min_key(function_list);
+constexpr auto method_base = lookup::min_key(method_list);
+
+constexpr auto opcode_names = lookup::dense<0, 256>(opcode_list);
+constexpr auto function_names = lookup::dense<function_base, lookup::max_key(function_list) - function_base + 1>(function_list);
+constexpr auto method_names = lookup::dense<method_base, lookup::max_key(method_list) - method_base + 1>(method_list);
+
+static_assert(lookup::is_sorted(file_list), "file_list must be sorted by id");
+static_assert(lookup::is_sorted(token_list), "token_list must be sorted by id");
+static_assert(lookup::is_perfect<opcode_list, opcode_hash_seeds, opcode_hash_slots, false>(), "opcode hash tables are stale, re-run gen/resolver.py");
+static_assert(lookup::is_perfect<function_list, function_hash_seeds, function_hash_slots, true>(), "function hash tables are stale, re-run gen/resolver.py");
+static_assert(lookup::is_perfect<method_list, method_hash_seeds, method_hash_slots, true>(), "method hash tables are stale, re-run gen/resolver.py");
+static_assert(lookup::is_perfect<file_list, file_hash_seeds, file_hash_slots, true>(), "file hash tables are stale, re-run gen/resolver.py");
+static_assert(lookup::is_perfect<token_list, token_hash_seeds, token_hash_slots, true>(), "token hash tables are stale, re-run gen/resolver.py");
+
+auto resolver::opcode_id(std::string_view name) -> std::uint8_t
+{
+    const auto itr = lookup::find_value(opcode_list, opcode_hash_seeds, opcode_hash_slots, name, false);
+
+    if (itr != nullptr)
+    {
+        return itr->key;
+    }
+
+    throw error(utils::string::va("Couldn't resolve opcode id for name '%s'!", std::string(name).data()));
+}
+
+auto resolver::opcode_name(std::uint8_t id) -> std::string
+{
+    const auto itr = lookup::find_dense<0>(opcode_names, id);
+
+    if (itr != nullptr)
+    {
+        return itr;
+    }
+
+    throw error(utils::string::va("Couldn't resolve opcode name for id '0x%hhX'!", id));
+}
+
+auto resolver::function_id(const std::string& name) -> std::uint16_t
 {
-    __init__()
+    const auto itr = lookup::find_value(function_list, function_hash_seeds, function_hash_slots, name, true);
+
+    if (itr != nullptr)
     {
-        static bool init = false;
-        if(init) return;
-        init = true;
+        return itr->key;
+    }
 
-        opcode_map.reserve(opcode_list.size());
-        opcode_map_rev.reserve(opcode_list.size());
-        function_map.reserve(function_list.size());
-        function_map_rev.reserve(function_list.size());
-        method_map.reserve(method_list.size());
-        method_map_rev.reserve(method_list.size());
-        file_map.reserve(file_list.size());
-        file_map_rev.reserve(file_list.size());
-        token_map.reserve(token_list.size());
-        token_map_rev.reserve(token_list.size());
-        
-        for(const auto& entry : opcode_list)
-        {
-            opcode_map.insert({ entry.key, entry.value });
-            opcode_map_rev.insert({ entry.value, entry.key });
-        }
+    auto& custom = get_custom_tables();
+    std::shared_lock<std::shared_mutex> lock(custom.mutex);
+    const auto it = custom.function_map_rev.find(name);
 
-        for(const auto& entry : function_list)
-        {
-            function_map.insert({ entry.key, entry.value });
-            function_map_rev.insert({ utils::string::to_lower(entry.value), entry.key });
-        }
+    if (it != custom.function_map_rev.end())
+    {
+        return it->second;
+    }
 
-        for(const auto& entry : method_list)
-        {
-            method_map.insert({ entry.key, entry.value });
-            method_map_rev.insert({ utils::string::to_lower(entry.value), entry.key });
-        }
+    throw error(utils::string::va("Couldn't resolve builtin function id for name '%s'!", name.data()));
+}
 
-        for(const auto& entry : file_list)
-        {
-            file_map.insert({ entry.key, entry.value });
-            file_map_rev.insert({ utils::string::to_lower(entry.value), entry.key });
-        }
+auto resolver::function_name(std::uint16_t id) -> std::string
+{
+    const auto itr = lookup::find_dense<function_base>(function_names, id);
 
-        for(const auto& entry : token_list)
-        {
-            token_map.insert({ entry.key, entry.value });
-            token_map_rev.insert({ utils::string::to_lower(entry.value), entry.key });
-        }
+    if (itr != nullptr)
+    {
+        return itr;
+    }
+
+    auto& custom = get_custom_tables();
+    std::shared_lock<std::shared_mutex> lock(custom.mutex);
+    const auto it = custom.function_map.find(id);
+
+    if (it != custom.function_map.end())
+    {
+        return it->second;
     }
-};
 
-__init__ _;
+    throw error(utils::string::va("Couldn't resolve builtin function name for id '%i'!", id));
+}
+
+auto resolver::method_id(const std::string& name) -> std::uint16_t
+{
+    const auto itr = lookup::find_value(method_list, method_hash_seeds, method_hash_slots, name, true);
+
+    if (itr != nullptr)
+    {
+        return itr->key;
+    }
+
+    auto& custom = get_custom_tables();
+    std::shared_lock<std::shared_mutex> lock(custom.mutex);
+    const auto it = custom.method_map_rev.find(name);
+
+    if (it != custom.method_map_rev.end())
+    {
+        return it->second;
+    }
+
+    throw error(utils::string::va("Couldn't resolve builtin method id for name '%s'!", name.data()));
+}
+
+auto resolver::method_name(std::uint16_t id) -> std::string
+{
+    const auto itr = lookup::find_dense<method_base>(method_names, id);
+
+    if (itr != nullptr)
+    {
+        return itr;
+    }
+
+    auto& custom = get_custom_tables();
+    std::shared_lock<std::shared_mutex> lock(custom.mutex);
+    const auto it = custom.method_map.find(id);
+
+    if (it != custom.method_map.end())
+    {
+        return it->second;
+    }
+
+    throw error(utils::string::va("Couldn't resolve builtin method name for id '%i'!", id));
+}
+
+auto resolver::file_id(const std::string& name) -> std::uint16_t
+{
+    const auto itr = lookup::find_value(file_list, file_hash_seeds, file_hash_slots, name, true);
+
+    if (itr != nullptr)
+    {
+        return itr->key;
+    }
+
+    return 0;
+}
+
+auto resolver::file_name(std::uint16_t id) -> std::string
+{
+    const auto itr = lookup::find_key(file_list, id);
+
+    if (itr != nullptr)
+    {
+        return itr->value;
+    }
+
+    return utils::string::va("_ID%i", id);
+}
+
+auto resolver::token_id(const std::string& name) -> std::uint16_t
+{
+    const auto itr = lookup::find_value(token_list, token_hash_seeds, token_hash_slots, name, true);
+
+    if (itr != nullptr)
+    {
+        return itr->key;
+    }
+
+    return 0;
+}
+
+auto resolver::token_name(std::uint16_t id) -> std::string
+{
+    const auto itr = lookup::find_key(token_list, id);
+
+    if (itr != nullptr)
+    {
+        return itr->value;
+    }
+
+    return utils::string::va("_ID%i", id);
+}
+
+auto resolver::find_function(const std::string& name) -> bool
+{
+    const auto itr = lookup::find_value(function_list, function_hash_seeds, function_hash_slots, name, true);
+
+    if (itr != nullptr)
+    {
+        return true;
+    }
+
+    auto& custom = get_custom_tables();
+    std::shared_lock<std::shared_mutex> lock(custom.mutex);
+    const auto it = custom.function_map_rev.find(name);
+
+    if (it != custom.function_map_rev.end())
+    {
+        return true;
+    }
+
+    return false;
+}
+
+auto resolver::find_method(const std::string& name) -> bool
+{
+    const auto itr = lookup::find_value(method_list, method_hash_seeds, method_hash_slots, name, true);
+
+    if (itr != nullptr)
+    {
+        return true;
+    }
+
+    auto& custom = get_custom_tables();
+    std::shared_lock<std::shared_mutex> lock(custom.mutex);
+    const auto it = custom.method_map_rev.find(name);
+
+    if (it != custom.method_map_rev.end())
+    {
+        return true;
+    }
+
+    return false;
+}
+
+void resolver::add_function(const std::string& name, std::uint16_t id)
+{
+    auto& custom = get_custom_tables();
+    std::unique_lock<std::shared_mutex> lock(custom.mutex);
+
+    const auto itr = lookup::find_value(function_list, function_hash_seeds, function_hash_slots, name, true);
+
+    if (itr != nullptr || custom.function_map_rev.find(name) != custom.function_map_rev.end())
+    {
+        throw error("builtin function '" + name + "' already defined.");
+    }
+
+    custom.function_map.insert({ id, name });
+    custom.function_map_rev.insert({ name, id });
+}
+
+void resolver::add_method(const std::string& name, std::uint16_t id)
+{
+    auto& custom = get_custom_tables();
+    std::unique_lock<std::shared_mutex> lock(custom.mutex);
+
+    const auto itr = lookup::find_value(method_list, method_hash_seeds, method_hash_slots, name, true);
+
+    if (itr != nullptr || custom.method_map_rev.find(name) != custom.method_map_rev.end())
+    {
+        throw error("builtin method '" + name + "' already defined.");
+    }
+
+    custom.method_map.insert({ id, name });
+    custom.method_map_rev.insert({ name, id });
+}
 
 } // namespace xsk::gsc::iw5
 
@@ -11,7 +11,7 @@ namespace xsk::gsc::iw5
 class resolver
 {
 public:
-    static auto opcode_id(const std::string& name) -> std::uint8_t;
+    static auto opcode_id(std::string_view name) -> std::uint8_t;
     static auto opcode_name(std::uint8_t id) -> std::string;
 
     static auto function_id(const std::string& name) -> std::uint16_t;
@@ -0,0 +1,645 @@
+// Copyright 2021 xensik. All rights reserved.
+//
+// Use of this source code is governed by a GNU GPLv3 license
+// that can be found in the LICENSE file.
+
+// generated by gen/resolver.py, do not edit
+
+#pragma once
+
+namespace xsk::gsc::iw5
+{
+
+constexpr std::array<std::int32_t, 38> opcode_hash_seeds
+{{
+    7, 40, 6, 2, 38, 63, 22, 347, 0, 52, 15, 347, 5, 423, 100, 244,
+    448, 417, 1, 12, 1, -153, 24, 59, 1, 610, 164, 586, 38, 75, 0, 260,
+    20, 596, 277, -1, 0, 2125,
+}};
+
+constexpr std::array<std::uint32_t, 153> opcode_hash_slots
+{{
+    40, 30, 132, 130, 4, 34, 51, 95, 45, 86, 74, 8, 105, 1, 67, 119,
+    141, 124, 12, 138, 50, 38, 35, 113, 60, 78, 75, 82, 140, 73, 108, 16,
+    32, 111, 112, 56, 31, 103, 128, 7, 79, 72, 15, 80, 131, 19, 29, 145,
+    142, 129, 127, 97, 92, 47, 37, 104, 66, 25, 133, 57, 116, 14, 2, 54,
+    61, 126, 99, 18, 21, 48, 76, 98, 102, 125, 118, 6, 46, 123, 68, 100,
+    139, 91, 5, 62, 13, 36, 23, 144, 114, 89, 117, 146, 94, 44, 10, 59,
+    11, 53, 22, 93, 85, 58, 49, 122, 55, 106, 65, 43, 24, 148, 101, 39,
+    64, 83, 107, 115, 41, 63, 90, 52, 109, 42, 17, 27, 149, 71, 81, 152,
+    87, 147, 136, 33, 137, 0, 135, 110, 9, 69, 77, 96, 84, 88, 3, 143,
+    28, 151, 134, 121, 26, 150, 20, 70, 120,
+}};
+
+constexpr std::array<std::int32_t, 113> function_hash_seeds
+{{
+    11, 2, 5, 43, -455, 5, 5, 74, 1, 55, 183, 1, 4, -382, 292, 4,
+    8, 266, 133, 524, 158, 13, 2, 8, 1, 44, 2, 156, 1, 18, 92, 37,
+    -187, 204, 343, 14, 310, 153, 2, 16, 98, 262, 6, 30, 420, 316, 30, 81,
+    4, 391, 32, 10, -179, 55, 4, 29, 43, 427, 147, -171, 103, 17, 17, 1332,
+    312, 4, 148, 396, 5, 602, 17, 0, 1, 5, 2, 49, -133, 10, 242, 1840,
+    1861, 1, 107, 734, 0, 37, 1148, 650, 0, -126, 9, 124, 25, 84, 977, -104,
+    3, 29, -34, 4, 108, -27, 10, -10, 0, 1, 115, 718, 54, 357, 1457, 732,
+    2364,
+}};
+
+constexpr std::array<std::uint32_t, 455> function_hash_slots
+{{
+    288, 414, 393, 44, 110, 99, 71, 164, 351, 190, 303, 430, 283, 420, 115, 162,
+    345, 154, 2, 145, 378, 358, 21, 291, 258, 436, 260, 349, 229, 261, 297, 128,
+    387, 313, 181, 438, 53, 447, 98, 305, 282, 329, 220, 366, 437, 84, 243, 344,
+    234, 413, 57, 316, 116, 104, 89, 58, 107, 8, 401, 342, 111, 444, 46, 146,
+    333, 365, 17, 417, 276, 340, 250, 210, 141, 427, 72, 304, 410, 294, 338, 312,
+    360, 319, 431, 395, 209, 80, 251, 63, 204, 354, 321, 14, 386, 267, 248, 139,
+    6, 15, 135, 367, 299, 30, 339, 353, 364, 300, 406, 302, 423, 168, 93, 149,
+    92, 20, 409, 233, 352, 266, 179, 191, 372, 376, 88, 173, 28, 167, 180, 60,
+    308, 306, 397, 256, 412, 3, 362, 59, 208, 255, 49, 120, 451, 51, 193, 64,
+    203, 416, 281, 150, 270, 382, 73, 405, 136, 87, 370, 450, 166, 274, 348, 197,
+    318, 275, 278, 390, 78, 103, 332, 172, 293, 426, 97, 449, 439, 322, 225, 47,
+    381, 55, 77, 201, 326, 27, 347, 335, 330, 11, 425, 371, 292, 207, 186, 42,
+    184, 377, 272, 153, 213, 90, 85, 66, 268, 217, 127, 343, 408, 70, 309, 432,
+    192, 171, 310, 357, 440, 118, 91, 452, 262, 76, 399, 38, 52, 389, 137, 374,
+    177, 132, 280, 400, 286, 296, 279, 421, 219, 331, 325, 178, 169, 34, 134, 1,
+    133, 170, 240, 161, 249, 424, 328, 428, 176, 82, 402, 22, 327, 142, 259, 221,
+    113, 334, 165, 442, 228, 388, 317, 40, 62, 183, 61, 384, 361, 227, 106, 81,
+    25, 101, 174, 265, 247, 131, 435, 315, 307, 95, 105, 96, 159, 214, 415, 337,
+    241, 152, 398, 375, 433, 356, 446, 422, 123, 69, 32, 407, 122, 246, 301, 74,
+    148, 109, 160, 363, 222, 373, 212, 285, 434, 194, 253, 147, 359, 230, 263, 185,
+    403, 418, 298, 41, 65, 284, 245, 235, 100, 239, 196, 102, 216, 187, 48, 355,
+    311, 163, 369, 54, 205, 43, 287, 289, 138, 75, 83, 290, 429, 314, 368, 237,
+    195, 12, 295, 226, 175, 33, 68, 13, 155, 189, 396, 35, 121, 206, 144, 200,
+    404, 140, 9, 445, 143, 346, 320, 129, 323, 244, 443, 36, 379, 5, 156, 231,
+    411, 94, 0, 18, 158, 271, 223, 4, 198, 341, 50, 117, 23, 79, 67, 254,
+    151, 126, 324, 29, 392, 130, 108, 188, 350, 199, 10, 56, 26, 391, 441, 394,
+    45, 119, 454, 419, 453, 238, 257, 112, 16, 114, 385, 236, 211, 202, 252, 215,
+    24, 264, 232, 125, 218, 273, 277, 448, 31, 336, 380, 157, 37, 86, 224, 7,
+    182, 269, 242, 19, 383, 39, 124,
+}};
+
+constexpr std::array<std::int32_t, 194> method_hash_seeds
+{{
+    42, 2, 14, 20, 2, 1, 36, 1, 18, 2, 400, 23, 8, 40, 1, 128,
+    1, 1, 85, 99, 4, 4, 3, 92, 1, 90, 28, 37, 0, 3, 12, 10,
+    17, 48, 483, 4, 130, 2, 2, 91, 3, 23, 58, 2, -743, 4, 129, 0,
+    26, 2, 318, 15, -704, 47, 27, 5, 15, 1, 139, 41, 2, 8, 447, 475,
+    341, 61, 66, 142, 197, 0, 1, 39, -619, 1, 7, 20, 1, 27, 18, 10,
+    33, 132, 11, 61, 2, 92, -617, 4, 270, 79, 54, -533, 1, 5, 23, 35,
+    45, 325, 326, -491, 48, 188, 5, 10, 721, 1, 0, 152, 1, 45, 221, 416,
+    1, 23, 15, 623, 237, 8, 47, 19, 397, 2, 3, 67, 52, 15, 6, 26,
+    -415, 50, -315, 1218, 62, 490, 230, 1, -180, 152, 2, 6, 460, 31, 736, 6,
+    1139, 2234, 1692, -94, 12, 8, 52, 8, -67, -44, 2, 47, 1252, 40, 216, 4866,
+    158, 1, 3, 1, 5, 156, 14, 268, 1, 1230, 62, 101, 65, 12, 39, 421,
+    25, 66, 21, 1607, 1535, 12, 169, 742, 3, 2, 59, 1097, 111, 15, 2895, 1936,
+    106, 32,
+}};
+
+constexpr std::array<std::uint32_t, 779> method_hash_slots
+{{
+    592, 103, 675, 510, 88, 660, 594, 127, 472, 532, 22, 729, 746, 597, 249, 305,
+    457, 66, 476, 641, 741, 42, 306, 340, 405, 116, 67, 317, 443, 416, 65, 502,
+    222, 754, 134, 104, 504, 556, 343, 466, 337, 748, 547, 664, 363, 509, 399, 23,
+    459, 553, 561, 573, 51, 117, 170, 450, 776, 289, 725, 523, 150, 629, 48, 303,
+    53, 736, 391, 102, 731, 351, 716, 56, 517, 247, 140, 219, 414, 112, 298, 3,
+    632, 750, 582, 339, 710, 403, 666, 655, 356, 372, 663, 665, 323, 174, 732, 223,
+    157, 235, 552, 243, 320, 389, 74, 449, 775, 96, 512, 291, 527, 257, 778, 588,
+    613, 604, 394, 69, 493, 444, 282, 265, 484, 173, 577, 516, 29, 221, 130, 640,
+    9, 536, 217, 21, 475, 623, 190, 486, 377, 269, 204, 451, 691, 550, 0, 769,
+    27, 211, 319, 129, 346, 759, 727, 245, 242, 631, 197, 238, 30, 32, 246, 234,
+    70, 581, 230, 423, 464, 26, 15, 409, 603, 310, 214, 426, 777, 268, 702, 158,
+    114, 473, 271, 644, 110, 263, 283, 119, 579, 436, 495, 124, 605, 661, 529, 11,
+    95, 155, 762, 562, 558, 433, 297, 378, 539, 202, 229, 195, 364, 494, 728, 697,
+    407, 607, 184, 251, 28, 60, 250, 177, 712, 368, 770, 669, 85, 408, 620, 685,
+    396, 682, 555, 381, 461, 738, 147, 401, 19, 358, 478, 417, 477, 248, 649, 68,
+    711, 541, 256, 8, 258, 456, 774, 208, 497, 191, 537, 270, 266, 730, 118, 496,
+    47, 101, 428, 667, 688, 262, 773, 434, 379, 338, 231, 137, 193, 33, 72, 252,
+    12, 203, 274, 83, 611, 442, 84, 89, 6, 16, 159, 545, 598, 139, 176, 483,
+    81, 720, 100, 576, 696, 79, 189, 764, 586, 608, 519, 387, 210, 518, 244, 281,
+    635, 43, 55, 398, 554, 767, 772, 169, 758, 681, 435, 196, 345, 1, 349, 125,
+    279, 525, 430, 106, 424, 82, 99, 690, 571, 618, 75, 287, 13, 589, 113, 316,
+    212, 760, 334, 284, 360, 705, 779, 751, 199, 446, 412, 63, 330, 699, 544, 34,
+    392, 126, 735, 757, 487, 481, 506, 352, 492, 336, 369, 123, 614, 743, 144, 107,
+    653, 771, 24, 565, 526, 299, 300, 501, 143, 654, 439, 645, 715, 500, 322, 703,
+    288, 425, 233, 376, 44, 168, 572, 474, 585, 432, 5, 71, 328, 45, 309, 335,
+    367, 86, 460, 763, 734, 543, 404, 355, 707, 128, 186, 311, 753, 765, 236, 295,
+    722, 470, 559, 453, 347, 181, 406, 673, 749, 267, 301, 350, 745, 294, 353, 419,
+    549, 590, 651, 671, 491, 145, 292, 111, 192, 10, 421, 62, 458, 420, 325, 467,
+    329, 602, 293, 374, 524, 721, 718, 752, 138, 375, 761, 41, 253, 165, 535, 109,
+    148, 676, 704, 133, 454, 740, 365, 50, 427, 31, 80, 64, 318, 73, 38, 684,
+    469, 156, 188, 642, 4, 255, 52, 90, 285, 348, 438, 422, 228, 341, 78, 471,
+    569, 520, 20, 59, 326, 679, 609, 578, 373, 437, 452, 701, 97, 615, 239, 463,
+    601, 659, 93, 218, 385, 331, 163, 637, 154, 402, 595, 241, 700, 333, 630, 538,
+    622, 766, 522, 296, 280, 324, 488, 570, 706, 683, 670, 108, 370, 698, 261, 332,
+    747, 135, 643, 273, 17, 286, 612, 122, 171, 362, 560, 91, 361, 646, 313, 530,
+    431, 482, 489, 742, 315, 593, 205, 528, 98, 166, 272, 39, 180, 185, 388, 183,
+    551, 7, 626, 77, 448, 178, 259, 656, 94, 557, 380, 737, 596, 627, 87, 717,
+    395, 733, 726, 755, 254, 36, 200, 429, 224, 227, 533, 628, 514, 480, 142, 275,
+    61, 723, 521, 624, 342, 49, 768, 131, 182, 575, 354, 498, 531, 37, 160, 479,
+    756, 220, 574, 503, 639, 636, 672, 410, 694, 633, 2, 625, 680, 58, 689, 568,
+    534, 617, 580, 308, 14, 162, 172, 359, 739, 213, 201, 658, 304, 215, 232, 462,
+    606, 151, 314, 668, 499, 393, 650, 153, 76, 167, 621, 490, 616, 290, 587, 411,
+    161, 207, 695, 194, 382, 563, 513, 415, 312, 198, 591, 46, 662, 505, 508, 686,
+    57, 92, 54, 719, 302, 321, 546, 136, 724, 120, 386, 744, 692, 465, 678, 35,
+    40, 485, 141, 187, 566, 175, 652, 225, 25, 441, 564, 583, 674, 216, 152, 657,
+    371, 327, 693, 397, 418, 468, 610, 708, 599, 445, 260, 542, 209, 687, 237, 264,
+    400, 511, 132, 413, 440, 548, 18, 366, 344, 600, 390, 276, 638, 584, 277, 677,
+    206, 455, 714, 146, 105, 226, 179, 307, 447, 540, 647, 567, 357, 384, 278, 240,
+    121, 115, 648, 709, 713, 149, 619, 383, 507, 634, 164,
+}};
+
+constexpr std::array<std::int32_t, 147> file_hash_seeds
+{{
+    43, 2, 140, 2, 103, 16, 10, 185, 18, 2, 15, -539, 405, 208, 103, 39,
+    129, 4, 2, 494, 12, 25, 36, 751, 8, 3, 267, 32, 5, 106, 1, 203,
+    104, 1130, 40, 165, 63, 9, 8, 131, 2, -520, 15, 49, 147, 3, -379, 12,
+    2, 44, 3, 21, 23, 4, 5, 1, 11, 8, 5, 2, 323, 9, 82, 9,
+    328, 1, 2, 10, 3, 69, 3, 1, 8, 980, 372, 15, 207, 1, 2, 24,
+    192, 9, 745, 74, 48, 1, 7, 1, 2337, 507, 247, 27, 2, 580, 351, 142,
+    566, 25, -264, 13, 9, 3, 197, 30, 664, 83, 28, 1, 49, -163, 36, 3,
+    287, 33, 55, 170, -67, 236, 173, 2, 38, 110, 24, 967, 15, 1653, 28, 633,
+    371, 2488, 22, 2, 3002, -16, 351, 1, 152, 3847, 9, 1, 2529, 2290, 20, 11,
+    89, 364, 0,
+}};
+
+constexpr std::array<std::uint32_t, 591> file_hash_slots
+{{
+    98, 545, 539, 70, 95, 401, 97, 333, 73, 398, 543, 273, 79, 484, 54, 380,
+    518, 584, 494, 325, 290, 506, 51, 560, 156, 590, 270, 21, 30, 200, 105, 565,
+    261, 319, 91, 425, 181, 508, 282, 523, 347, 376, 183, 29, 386, 485, 202, 157,
+    434, 298, 16, 171, 490, 379, 195, 397, 161, 234, 216, 591, 340, 457, 365, 196,
+    321, 203, 243, 450, 116, 370, 460, 10, 480, 264, 34, 470, 136, 124, 452, 328,
+    267, 22, 512, 378, 162, 367, 423, 331, 477, 121, 96, 303, 99, 403, 358, 209,
+    221, 476, 192, 133, 520, 500, 445, 364, 574, 408, 190, 137, 194, 20, 417, 547,
+    537, 180, 473, 300, 329, 487, 25, 431, 395, 233, 220, 350, 421, 44, 345, 411,
+    13, 535, 31, 430, 515, 564, 272, 28, 24, 277, 374, 41, 373, 77, 146, 501,
+    141, 522, 534, 330, 542, 226, 525, 486, 26, 50, 208, 482, 320, 513, 349, 113,
+    489, 447, 569, 499, 575, 371, 337, 332, 147, 497, 426, 240, 17, 266, 528, 165,
+    540, 291, 402, 388, 106, 375, 387, 385, 244, 14, 451, 68, 269, 287, 306, 414,
+    311, 60, 167, 53, 58, 389, 352, 441, 160, 458, 256, 576, 293, 404, 296, 102,
+    49, 153, 150, 262, 314, 343, 440, 341, 193, 229, 566, 259, 182, 59, 67, 459,
+    109, 557, 191, 143, 529, 224, 119, 72, 394, 406, 295, 100, 232, 288, 323, 504,
+    443, 496, 524, 361, 145, 544, 588, 166, 84, 585, 78, 549, 312, 15, 436, 418,
+    366, 419, 207, 454, 36, 254, 391, 177, 429, 390, 536, 74, 40, 413, 11, 432,
+    456, 455, 138, 219, 442, 511, 155, 481, 301, 532, 168, 252, 383, 550, 265, 446,
+    276, 548, 198, 212, 339, 472, 563, 144, 502, 437, 533, 205, 81, 304, 246, 231,
+    18, 9, 581, 140, 510, 37, 363, 498, 117, 114, 351, 63, 579, 135, 76, 527,
+    438, 65, 154, 369, 201, 466, 558, 115, 249, 127, 172, 139, 516, 55, 462, 57,
+    80, 572, 278, 211, 309, 517, 101, 583, 112, 174, 126, 415, 284, 42, 393, 289,
+    424, 164, 90, 189, 218, 555, 336, 308, 2, 400, 123, 3, 163, 52, 538, 61,
+    530, 225, 88, 69, 568, 318, 222, 46, 467, 562, 169, 570, 359, 199, 362, 405,
+    342, 238, 327, 19, 253, 492, 381, 346, 283, 128, 586, 129, 475, 4, 469, 514,
+    505, 237, 571, 187, 521, 170, 263, 175, 360, 302, 488, 86, 268, 310, 316, 483,
+    422, 322, 541, 176, 382, 158, 409, 87, 412, 471, 279, 245, 159, 186, 577, 384,
+    552, 286, 122, 125, 299, 464, 0, 285, 45, 178, 71, 399, 344, 251, 185, 242,
+    197, 582, 108, 32, 217, 353, 120, 519, 184, 396, 368, 580, 35, 435, 546, 85,
+    142, 567, 228, 107, 103, 33, 134, 479, 6, 173, 271, 573, 305, 151, 83, 1,
+    420, 104, 8, 5, 465, 274, 47, 111, 204, 357, 149, 493, 132, 354, 317, 7,
+    43, 39, 463, 75, 235, 526, 503, 507, 93, 453, 257, 468, 23, 427, 12, 247,
+    215, 223, 292, 294, 407, 152, 428, 356, 444, 206, 250, 448, 89, 355, 281, 64,
+    307, 130, 38, 297, 461, 449, 335, 392, 214, 559, 531, 326, 27, 92, 315, 554,
+    188, 589, 491, 241, 509, 561, 118, 495, 348, 275, 433, 56, 324, 439, 416, 213,
+    578, 377, 587, 148, 131, 248, 239, 230, 474, 210, 62, 410, 94, 260, 82, 280,
+    236, 179, 553, 372, 478, 334, 66, 258, 48, 227, 313, 110, 556, 338, 255,
+}};
+
+constexpr std::array<std::int32_t, 1382> token_hash_seeds
+{{
+    42, 50, 75, 214, 7, 68, 7, 4, 49, 9, 11, 2, 22, 8, 10, -5453,
+    3, 75, 4, 4, 27, 64, 87, 61, 27, -5448, 122, 176, 1, 8, 4, 1,
+    14, 86, 2, 168, 2, 121, 11, 166, 460, 85, 1, 21, 3, -5422, 1, 24,
+    20, 1, 288, -5341, 19, 1, 47, -5333, 21, 5, 89, -5305, 34, 83, 1, 25,
+    91, 4, 70, 18, 72, 1, 1, 39, 18, 17, 13, 23, 14, 2, 13, 116,
+    2, 5, 67, 129, 1, 14, 225, 96, 114, 1, 1, 8, 1, 10, 2, 21,
+    1, 16, -5191, 2, -5126, 3, 1, 10, 9, 42, 11, 18, 1, 13, -5115, 4,
+    49, 94, 10, 20, 3, 201, 6, 40, 6, 7, 185, 14, 1, 13, 60, 53,
+    88, 68, 1, 33, 43, 51, 2, 1, 112, 3, 8, 122, 110, 10, 6, 40,
+    109, 3, 2, 28, 73, 1, 39, 9, 14, 71, -5074, 22, -5068, 6, 89, 29,
+    1, 2, 58, 9, 22, 6, 298, 22, 1, 2, 3, 6, 6, 109, 26, 27,
+    30, -5061, 16, 30, 1, 91, 2, 160, 55, 4, 1, 8, 19, -4948, 41, 143,
+    232, 72, 1, -4908, 1, 247, 1, 1, 9, 1, 33, 12, 4, 41, 56, 1,
+    2, 130, 261, 122, 7, 2, 9, 24, 59, 24, -4870, 6, 1, 43, 1, 103,
+    15, 150, 3, 1, 424, 99, -4771, 277, 20, 160, 64, 1, 460, 6, 21, 148,
+    20, 1, 5, 14, 11, 19, 183, -4620, 28, 19, 122, 9, -4602, 11, 24, 13,
+    4, 7, -4501, 178, 2, 22, 6, 1, 36, 2, 125, 24, -4487, -4462, 34, 12,
+    129, 1, 44, 24, 6, 75, 1, 17, 1, 3, -4419, 14, 39, 440, 1, 73,
+    4, 52, 0, 75, 8, 94, 17, 2, 3, 5, 2, -4413, 1, 3, 157, 0,
+    16, 317, 21, 16, 32, 12, 318, 5, 270, -4316, 234, 1, 12, 1, 15, 13,
+    3, 106, 152, 3, 25, 2, 500, 16, 26, 5, -4280, 59, 52, 8, 2, 3,
+    30, 0, 1, 4, 136, 3, 3, 40, 19, 1, 445, 2, -4274, 4, 17, 302,
+    6, 1, 14, 57, 31, 1, 128, 61, 2, 1, 38, 16, 255, -4257, 10, 26,
+    -4213, 139, 1, 339, 611, 7, 2, 305, 2, 1, 26, 72, 15, 0, 10, -4204,
+    11, 3, 343, -4095, 68, 2, 133, 8, 38, 25, 12, 82, 1, 72, 155, 19,
+    52, 19, 1, 13, 133, 189, 97, 168, 99, 20, 5, 21, 1, 456, 61, 0,
+    114, 114, 6, 31, -4061, -4000, 7, 4, 11, 292, 68, 29, -3988, 39, 23, 100,
+    15, 28, 2, 94, 9, 43, 415, 4, 1, 18, 187, 24, 12, 5, 4, 2,
+    2, 54, 14, 11, 11, 79, 6, 1, 3, 11, 1, 191, 85, 7, 13, 113,
+    1, 1, 323, 70, 1, 108, 37, 1, 42, -3946, 97, 255, 18, 61, 57, 170,
+    1, 421, 5, 545, 1, 27, 216, 25, 131, 94, 12, -3938, 96, 11, 16, 7,
+    233, 144, 718, 51, 1, 13, 147, 8, 35, 1403, 39, 9, 26, 640, 1, 3,
+    661, 41, 130, 2, 204, 37, 14, 20, 6, 367, 5, 618, 4, 11, 9, 14,
+    36, 12, 33, 46, 115, 1, -3832, 3, 11, 76, 217, 3, 1, 647, 8, 9,
+    1, 40, 13, 2, -3814, 316, 4, 259, -3781, 51, 10, 5, 354, 1, 4, 146,
+    1, 110, 40, 36, 77, 2, 34, 16, 3, 82, 3, 10, 4, 16, 2, 39,
+    -3711, 1, 666, -3673, 255, -3634, 126, 187, 173, 130, 405, 18, 10, -3570, 16, 6,
+    13, 37, 74, 3, 66, -3505, 6, 2, 168, 3, 11, 1, 7, 151, 126, 157,
+    22, 642, 13, 128, 1, 3, -3427, 20, 29, 3, 24, 979, 49, 340, 50, 125,
+    88, 6, 451, 56, 2, 52, 72, 1, 3, 148, 4, 3, 4, 147, 747, 2,
+    10, 7, 32, 67, -3376, -3330, 71, 1, -3273, 5, 322, 335, 3, 5, 67, 209,
+    109, -3017, -3007, 77, 63, -2811, 87, 15, 178, 16, -2774, 49, 40, 1, 215, -2742,
+    26, 401, 284, 1, 5, 1, 7, 1, 318, 146, 352, 7, 1, 89, 238, 10,
+    15, 25, 7, 19, 27, 367, 42, 162, 155, 139, 2, 115, 0, 736, 80, 2,
+    0, 30, 369, 7, 27, 55, 2, -2738, 416, 96, 82, 24, -2717, 2, 89, 4,
+    2, 147, 12, 324, 532, 32, -2684, 1, 26, 671, 201, -2678, 20, 11, -2617, 525,
+    5, -2542, 4, 5, 2, 4, -2393, 175, 3, 8, 250, 63, 416, 1359, 2, 137,
+    1, 219, 2, 158, 3, 130, 3, 126, 302, 119, 4, 243, 2, 299, 615, 218,
+    -2221, 9, 29, 4, 328, 2, 930, 1, 227, 1, 1, 1208, -2120, 89, -2106, 11,
+    420, 474, 4, 104, -2096, 4, 2, 19, 84, 1745, 179, 5, 88, 487, 9, 691,
+    56, 340, 56, 449, 96, 2, 31, 10, 23, -2034, 44, 13, 16, 22, 4, 20,
+    1, -1897, 51, 10, 351, 14, 532, 184, 26, 36, -1891, 2, -1851, -1841, 706, 91,
+    38, 1, 1, 27, 83, 0, -1691, 124, 195, 7, 87, 10, 871, 37, 278, -1610,
+    209, 45, 88, 2, 269, 58, 12, 0, 401, 1, 39, 679, 6, 52, 22, 473,
+    18, 68, 49, 265, 1100, 0, 314, 2446, 273, -1603, 83, -1561, 2, 8, 13, 525,
+    215, 21, 5, 27, 1, 32, -1546, 3, 21, 121, 10, 19, 305, 2, 303, 27,
+    134, 27, 77, 299, 2, 16, 222, 1491, 25, 11, 113, 33, 2, 342, 25, 2,
+    6, 71, 4, 451, 292, 204, 27, 428, 252, 2, 11, 105, -1474, 43, 763, -1433,
+    -1410, 44, 188, 3, -1402, 1, 21, 8, 18, 1, 562, 74, 3, 1, 55, 88,
+    1110, 2, -1287, 283, 276, 15, -1164, 14, 30, 467, 181, 5, 10, 72, 568, -1011,
+    328, -982, 15, 1092, 5, -900, 1, 182, 320, 589, 46, 3, 1, 60, 273, 21,
+    37, 7, 608, 26, 1012, 136, 49, 52, -892, 13, 225, 3, 63, -870, 148, 259,
+    207, 2, 32, 92, 1, 19, 33, 1378, 4, 38, 23, 21, 22, 63, 101, 68,
+    7, 856, 522, 531, 981, 69, -820, 150, 1, 30, 741, 199, 172, 0, 853, 2024,
+    241, 1, 784, 32, 1, 662, 244, 5, 10, 661, 1841, 1999, 19, 45, 4, 41,
+    40, 84, 248, 1739, 99, 62, 205, 479, 501, -636, -634, 259, 149, 1, 218, 1,
+    213, 40, 9, 2, 11, 39, 1, 4, 685, 23, 2702, 88, 33, 790, 77, 835,
+    69, 45, 4, 2, 225, 385, 395, 89, 1, 43, 14, 45, 181, -570, 61, 5,
+    5, 50, 3168, 10, 84, 56, -532, 61, 831, 1447, 69, 137, 1, 12, 1, 27,
+    3, 151, 188, 292, 344, 44, 1563, 10, 51, 554, 7, 414, 2, 1344, 0, 1,
+    1336, 274, 33, 3, 1, 479, 49, 73, 165, 2145, 476, 5, 2, 10, 21, 78,
+    1362, 2, 6, -529, 2, 181, 2, 189, 15, 2, 1199, -524, 3, 461, 1, 477,
+    737, 0, 202, 4, 0, 332, 1, 509, 1590, 91, 398, -504, 12, 1520, 2, 85,
+    393, 106, 3285, 203, 0, 554, 11, 14, 114, 169, 3, 348, 0, 29, 5, 66,
+    1, 1, 1811, 254, 5, 878, 36, 522, 511, 79, 19, 116, 1000, 1, 5, 218,
+    31, 73, 8, 7, 3452, 5, 63, 13, 42, 5, 80, 26, 102, 4, 2, 13,
+    6, 6, 57, 12, 252, -503, 77, 32, 419, 18, 293, 133, 8, 52, 191, -469,
+    4, 7, 8, 6, 3, 8, 99, 634, 49, 639, 390, -462, 384, 13, 16, 103,
+    2, 196, 47, 153, 188, 616, -461, 102, 2396, 3, 379, 142, 106, 20, 243, 54,
+    243, 19, 1, 1402, 384, 1026, 295, 1613, -448, 321, 39, -439, -266, 14, 1321, 605,
+    4, 940, 6364, 3, 1873, 147, 352, 3, 471, 11099, 1, -242, 2, 832, 3712, 0,
+    770, 3394, 232, 108, 217, 217, 113, 254, 202, 29, 6, 1, 1378, 82, 1385, -226,
+    267, 2, 867, 109, 1926, 2274, -168, 4186, 184, 0, 1, 941, 2147, 423, 673, -122,
+    16, 1, 6, 3, 30, 2609, 157, 12, 13, 46, -102, -76, 0, 17269, 372, 346,
+    273, 17, 185, 338, 126, 2451, 203, 106, 440, 2349, 1630, 738, 29, 643, 99, 92,
+    1105, 978, 1783, 237, 41, 1106, 22, 2192, 158, 65, 272, 0, 1, 1005, 4, 151,
+    638, 91, 52, 2321, 171, 443,
+}};
+
+constexpr std::array<std::uint32_t, 5529> token_hash_slots
+{{
+    5036, 956, 3616, 3569, 4886, 2782, 3069, 508, 5395, 1835, 3008, 987, 1690, 51, 1142, 2635,
+    2054, 4334, 534, 1300, 127, 653, 1906, 1775, 1974, 3609, 2720, 5057, 3881, 1527, 5063, 3313,
+    3007, 4586, 3301, 606, 5330, 548, 908, 2183, 703, 4241, 1285, 2062, 2294, 238, 2778, 645,
+    4645, 676, 1006, 2329, 2726, 1748, 1340, 845, 1541, 4724, 2552, 3699, 1771, 5242, 712, 1918,
+    1655, 747, 5324, 644, 2525, 106, 3122, 4170, 4208, 322, 5507, 5220, 2106, 1453, 264, 4579,
+    343, 1401, 1490, 1439, 3628, 5377, 2407, 1378, 2471, 151, 1759, 5385, 901, 1855, 3864, 736,
+    1970, 3405, 1151, 2752, 694, 3386, 5359, 3273, 3768, 3449, 2444, 936, 1996, 1078, 3495, 4445,
+    2066, 68, 5469, 3646, 1335, 4943, 3459, 2926, 2913, 4247, 5089, 1076, 2861, 2421, 492, 4404,
+    3993, 1808, 1383, 4631, 334, 4807, 4921, 4179, 1769, 4218, 4681, 193, 2, 3631, 2426, 1663,
+    1132, 1592, 3724, 325, 2379, 4574, 2085, 537, 1838, 2251, 2837, 2050, 1161, 929, 1243, 3184,
+    3520, 2538, 4922, 3118, 1861, 1929, 1456, 942, 1044, 3227, 3785, 578, 335, 896, 2181, 1860,
+    2514, 857, 3059, 5437, 5188, 1221, 3871, 2417, 5187, 730, 5073, 331, 994, 2967, 850, 2124,
+    3476, 5527, 2928, 2204, 4196, 4965, 1934, 3415, 1420, 4504, 3799, 438, 1946, 5341, 2105, 628,
+    2575, 4668, 3371, 5405, 3091, 4948, 2927, 5393, 3662, 386, 5235, 4025, 3309, 263, 3463, 379,
+    1202, 1501, 4685, 5477, 3215, 1652, 1762, 2894, 488, 3406, 5130, 3000, 3483, 552, 306, 4091,
+    2242, 3779, 4722, 2640, 813, 1124, 4640, 3025, 3968, 825, 2090, 5175, 3180, 985, 2960, 861,
+    1713, 2881, 4989, 4064, 4235, 2781, 2425, 799, 2965, 4881, 3206, 2380, 5116, 1289, 2571, 4456,
+    522, 4037, 3343, 4348, 1705, 5331, 3050, 2925, 92, 2856, 404, 3420, 1174, 2626, 1645, 1561,
+    3583, 4824, 2443, 3106, 1057, 4474, 1380, 5071, 388, 677, 233, 1240, 5274, 2275, 1268, 1074,
+    2612, 5234, 2951, 1798, 2433, 5091, 3086, 2784, 3425, 58, 1957, 544, 3279, 5194, 700, 2957,
+    20, 1805, 721, 1738, 3387, 647, 75, 3529, 2089, 1355, 2322, 763, 5499, 4665, 4805, 3101,
+    3364, 4089, 613, 2055, 4171, 1583, 2480, 2003, 3315, 2599, 4331, 2850, 1359, 2262, 693, 3152,
+    4473, 637, 1223, 378, 4104, 1432, 1088, 2828, 3966, 2367, 2718, 5139, 1950, 4800, 1912, 4479,
+    2157, 1904, 2972, 939, 1803, 1153, 3943, 1133, 437, 5511, 3083, 887, 3133, 829, 4896, 2657,
+    1326, 5391, 554, 4592, 5432, 5292, 2286, 4727, 4932, 4169, 4532, 2584, 1196, 4465, 2577, 4442,
+    4192, 646, 4238, 5225, 5099, 510, 5371, 4203, 2353, 1052, 4878, 2998, 2173, 425, 1924, 4748,
+    2644, 5053, 2798, 2523, 3940, 2762, 4245, 36, 2116, 3153, 3053, 4688, 1837, 925, 2609, 5160,
+    1566, 4427, 4040, 4972, 1568, 4875, 5042, 2258, 2225, 4493, 142, 2022, 3307, 1870, 1486, 4900,
+    1417, 2839, 1080, 4281, 5370, 1154, 1206, 5380, 3170, 3419, 1671, 3147, 4950, 4882, 2332, 448,
+    4659, 2445, 1116, 3026, 1039, 5523, 5502, 583, 368, 4563, 2136, 4332, 1170, 1314, 3955, 3572,
+    4542, 1461, 3342, 865, 1188, 2093, 2805, 1248, 147, 2628, 4999, 4612, 1291, 4041, 4877, 1187,
+    2423, 5402, 1725, 2697, 3, 3002, 3690, 1114, 2921, 3456, 194, 1113, 4893, 3661, 627, 2339,
+    851, 2602, 999, 4944, 2961, 3005, 5170, 1400, 221, 413, 3914, 2604, 3910, 4635, 947, 1367,
+    1374, 2456, 4949, 3347, 5312, 288, 4799, 202, 3606, 3443, 3604, 1905, 1777, 2541, 1799, 5120,
+    3311, 4694, 1259, 403, 5412, 3697, 5104, 4211, 2663, 2529, 2959, 2114, 1962, 3548, 5028, 2486,
+    449, 5094, 4140, 4291, 4350, 3487, 5361, 3284, 5445, 4565, 787, 3093, 1454, 1591, 1702, 2113,
+    1778, 4695, 3944, 2391, 4874, 2270, 3471, 2642, 2618, 5348, 1782, 3931, 526, 4843, 1776, 1067,
+    1768, 3730, 1254, 4383, 3530, 4610, 642, 1871, 4775, 1097, 550, 5243, 293, 3801, 4212, 4954,
+    1373, 4463, 817, 3016, 1143, 3382, 3500, 5060, 4814, 5299, 3814, 2992, 2151, 4658, 4337, 2693,
+    5514, 2072, 4925, 584, 4643, 2892, 826, 1827, 131, 2001, 753, 168, 1874, 1972, 4450, 5318,
+    4249, 3438, 4774, 1540, 1942, 3350, 29, 5046, 3263, 1584, 2409, 228, 5131, 4920, 3444, 4345,
+    641, 1494, 5480, 2314, 1255, 5420, 4292, 3488, 2786, 631, 3217, 185, 1009, 2852, 1349, 5024,
+    2661, 5174, 4204, 4413, 759, 2263, 2826, 462, 5281, 455, 4783, 1900, 4641, 4917, 385, 2191,
+    3369, 3248, 1991, 4899, 884, 2177, 1026, 5214, 2515, 2312, 2330, 3729, 192, 5354, 98, 2553,
+    2855, 3763, 3363, 3197, 538, 222, 1557, 2152, 1825, 5484, 3349, 2358, 4677, 2274, 4615, 2785,
+    2436, 2047, 977, 2973, 879, 2354, 2737, 2859, 2226, 486, 2978, 5092, 5275, 459, 4756, 1499,
+    1537, 3269, 1617, 569, 3131, 871, 1722, 1180, 3299, 601, 4767, 4303, 1595, 1507, 4224, 5365,
+    5415, 5172, 4415, 5262, 2835, 5226, 1708, 2863, 477, 3932, 2638, 3346, 2556, 3557, 3922, 3638,
+    2733, 1937, 4525, 1910, 974, 3013, 4088, 4028, 5161, 1190, 5471, 824, 5155, 2187, 1238, 2025,
+    2597, 3361, 71, 2955, 4796, 2753, 2963, 1411, 402, 493, 2738, 2205, 3150, 3888, 5201, 4395,
+    3587, 1322, 1881, 2281, 2871, 4043, 79, 592, 4726, 1555, 4539, 3722, 1779, 5206, 1959, 1227,
+    4969, 1642, 714, 3241, 4068, 702, 329, 4765, 5290, 1471, 225, 3230, 4325, 429, 4535, 3598,
+    4555, 3954, 4876, 280, 2127, 3136, 1159, 5455, 731, 3594, 757, 345, 3337, 833, 1210, 4136,
+    3769, 3610, 3971, 2984, 1750, 5398, 2683, 4553, 5228, 4423, 1100, 1234, 4696, 4123, 1586, 4607,
+    2808, 3323, 148, 310, 1651, 2723, 711, 689, 283, 2678, 1847, 5162, 4085, 3328, 4158, 507,
+    2580, 4216, 4526, 2192, 2470, 523, 4865, 3986, 1547, 3236, 4894, 2824, 893, 4679, 776, 2070,
+    129, 4265, 4990, 1138, 4613, 4991, 2983, 3767, 1094, 1403, 3853, 302, 391, 3716, 4718, 4144,
+    4655, 370, 3032, 1051, 4663, 2653, 4054, 5304, 5253, 5081, 746, 3162, 2109, 5518, 598, 3121,
+    4406, 1066, 814, 5169, 3619, 179, 1213, 5326, 3068, 587, 5482, 4242, 2356, 340, 3372, 3649,
+    4361, 2452, 4873, 373, 3891, 5031, 3430, 2488, 984, 4891, 4031, 5389, 4362, 3257, 1914, 1280,
+    1139, 3819, 3225, 4902, 1495, 2741, 5193, 11, 1701, 4016, 301, 3027, 309, 1244, 1521, 2230,
+    1081, 5178, 2621, 3731, 4341, 311, 3705, 4074, 3896, 3469, 5306, 3824, 678, 5463, 4024, 5182,
+    2803, 143, 3691, 3878, 2213, 3717, 2092, 1639, 5493, 235, 953, 3182, 745, 768, 239, 2175,
+    1787, 2437, 515, 3186, 4763, 680, 663, 1387, 4905, 2483, 4802, 800, 2198, 802, 4940, 5185,
+    220, 4816, 3499, 2999, 1204, 1878, 1723, 1256, 3388, 4741, 520, 2063, 1459, 4545, 4374, 838,
+    3448, 324, 4317, 446, 158, 3947, 804, 1670, 4225, 1394, 1123, 4368, 4356, 1251, 4541, 3119,
+    4484, 3960, 3586, 1207, 4386, 867, 4327, 1821, 2734, 2203, 4336, 3479, 2324, 2509, 3742, 3293,
+    874, 1189, 3220, 5358, 1543, 4353, 5156, 1195, 3130, 2634, 1464, 3210, 2812, 5382, 1473, 4320,
+    3880, 3627, 111, 3160, 2032, 2528, 1261, 1346, 4449, 5336, 1686, 4416, 1526, 2467, 4287, 4451,
+    4134, 5208, 2630, 5528, 1687, 2185, 3468, 2694, 1003, 2507, 1612, 4704, 4283, 5403, 2069, 1692,
+    1504, 133, 2887, 4275, 5335, 3526, 454, 447, 2395, 560, 5033, 3384, 4608, 4862, 1913, 4114,
+    4329, 5388, 4769, 3591, 1915, 2302, 2977, 5279, 3036, 3795, 199, 529, 4359, 686, 3798, 2298,
+    4198, 295, 1818, 3480, 2305, 4713, 3905, 805, 245, 1710, 960, 207, 3607, 4931, 1925, 3265,
+    4021, 1476, 3319, 4903, 114, 1092, 4630, 5259, 1345, 180, 416, 3985, 749, 2497, 610, 897,
+    2414, 811, 1363, 417, 3913, 4312, 2299, 5379, 659, 1632, 3432, 1699, 801, 3792, 3826, 1005,
+    2441, 4059, 618, 2918, 2908, 85, 3978, 5247, 4282, 2016, 5355, 4606, 771, 80, 4221, 2714,
+    4863, 3612, 3383, 2057, 4269, 840, 3577, 1636, 3071, 4588, 2107, 4234, 4182, 3807, 4121, 1469,
+    4857, 392, 432, 588, 2779, 1933, 3161, 3845, 668, 5329, 3264, 2860, 1496, 3039, 4197, 1140,
+    5517, 3338, 3575, 453, 4672, 2207, 2156, 3915, 2485, 2668, 223, 4671, 682, 4620, 758, 2474,
+    4131, 2757, 4729, 2585, 5360, 3680, 3858, 2919, 3287, 5340, 3775, 2034, 4739, 5301, 4839, 5004,
+    4335, 3018, 997, 1887, 1993, 967, 2176, 5430, 558, 3568, 3259, 2847, 356, 2705, 3324, 2717,
+    1973, 518, 3900, 2166, 2020, 5376, 1423, 900, 4355, 1971, 5196, 4480, 177, 1751, 2909, 3314,
+    906, 291, 2155, 4549, 699, 4232, 2366, 2310, 243, 3467, 27, 4385, 4314, 4529, 907, 1368,
+    3081, 297, 4103, 63, 3721, 224, 1576, 3983, 5308, 4157, 902, 1382, 2748, 4966, 2759, 5251,
+    2944, 1556, 2017, 1648, 4076, 4307, 536, 3494, 4400, 2976, 2184, 4228, 4207, 1514, 2420, 2848,
+    3542, 4507, 450, 3663, 1544, 535, 1216, 3252, 4811, 399, 863, 5258, 1628, 3391, 4523, 5105,
+    4433, 5289, 961, 4666, 2362, 5043, 3839, 344, 818, 3972, 3211, 4141, 4452, 2533, 2494, 3400,
+    4414, 3964, 1337, 672, 1484, 2328, 3090, 1834, 1853, 3219, 2405, 248, 3998, 1679, 1902, 1664,
+    2495, 3045, 4209, 4720, 88, 195, 2126, 3057, 290, 2796, 1361, 2301, 709, 5491, 2943, 1680,
+    1876, 4100, 928, 973, 596, 796, 4842, 2990, 3395, 1810, 2402, 5411, 4364, 4181, 3080, 3514,
+    2219, 5019, 2701, 4497, 3017, 2202, 4139, 4052, 4829, 1536, 3708, 3104, 5352, 3754, 4692, 354,
+    4284, 4699, 396, 2162, 4067, 3671, 1084, 1744, 3673, 4751, 1182, 5495, 3058, 1658, 1282, 2239,
+    3137, 5473, 5141, 2439, 3762, 3991, 1108, 2060, 3396, 3428, 3733, 2707, 543, 1443, 3033, 494,
+    4505, 1606, 4125, 3655, 99, 2681, 2351, 4639, 3640, 3715, 4273, 4670, 4596, 1129, 3727, 371,
+    249, 4823, 124, 673, 786, 164, 5074, 4632, 352, 3492, 4884, 1734, 3308, 439, 3912, 2043,
+    4930, 1018, 966, 2008, 3585, 140, 464, 5146, 2468, 4986, 4462, 4517, 314, 3149, 2801, 4519,
+    951, 4214, 1533, 4836, 630, 4514, 45, 2988, 3271, 1470, 2854, 1977, 1873, 5317, 153, 1334,
+    2473, 5316, 4589, 4190, 5287, 553, 4994, 1569, 2746, 2199, 2377, 4145, 4837, 2740, 3485, 5439,
+    1167, 504, 1897, 121, 2077, 5303, 2715, 4742, 1157, 2598, 4702, 4611, 4840, 4883, 319, 135,
+    1430, 70, 762, 755, 2636, 3173, 430, 1579, 4847, 4094, 5475, 4290, 3486, 2206, 752, 1249,
+    2882, 4980, 3590, 2082, 4546, 2595, 2516, 4906, 113, 103, 5001, 2783, 2954, 77, 1276, 1075,
+    5483, 4077, 125, 2361, 3938, 779, 2659, 4830, 1908, 2218, 1277, 1360, 170, 1956, 3596, 4032,
+    1646, 5339, 5386, 2068, 830, 5115, 5230, 2876, 198, 2806, 5059, 406, 219, 218, 1451, 4892,
+    4111, 2522, 1311, 3359, 3893, 3157, 4047, 540, 739, 2601, 273, 3484, 251, 2019, 1318, 5500,
+    1807, 4476, 1753, 5321, 136, 452, 2763, 3434, 1888, 5264, 4129, 5087, 4180, 5245, 3280, 2904,
+    3509, 5191, 294, 741, 209, 750, 479, 1829, 3512, 4092, 5328, 4276, 174, 157, 4430, 3502,
+    3232, 513, 5408, 4354, 3696, 4664, 1882, 5366, 57, 4133, 4732, 2817, 604, 123, 3035, 1960,
+    2215, 2846, 2453, 2352, 2564, 5350, 1460, 1525, 5367, 3660, 4867, 5020, 5121, 2292, 2981, 1172,
+    783, 5029, 499, 3117, 1224, 5266, 2435, 946, 2557, 1179, 3639, 3952, 3834, 1919, 5093, 4468,
+    2689, 5369, 3959, 5011, 256, 1342, 5520, 3353, 5451, 2122, 4850, 2970, 3194, 844, 1396, 312,
+    3198, 5256, 4124, 3450, 4116, 3599, 2936, 4868, 4889, 2986, 3774, 3060, 1089, 214, 4122, 4075,
+    458, 4860, 2492, 2620, 3028, 2481, 5508, 4042, 1719, 1317, 4297, 547, 2018, 2958, 4109, 849,
+    2037, 4011, 4657, 1896, 2793, 4787, 5487, 2268, 1231, 1267, 688, 2911, 3837, 1553, 1643, 1917,
+    4560, 5425, 1984, 4274, 1232, 134, 778, 5002, 3868, 2889, 401, 2135, 5186, 382, 162, 1608,
+    2732, 3700, 1482, 2058, 10, 1796, 2513, 2221, 2581, 4888, 1465, 3304, 4178, 1145, 823, 1493,
+    2006, 4447, 1826, 4697, 4154, 2572, 4707, 3168, 2690, 4073, 4832, 5284, 182, 784, 2544, 3004,
+    1813, 2872, 2014, 2588, 4458, 1069, 3605, 988, 4007, 3362, 685, 989, 1728, 1405, 4113, 2670,
+    4405, 4411, 3561, 4963, 1356, 2223, 2079, 3246, 4815, 3608, 4280, 1109, 743, 3543, 2823, 4175,
+    1274, 3527, 3892, 1727, 250, 3021, 4026, 2517, 3566, 4970, 2545, 832, 1597, 4210, 2605, 3238,
+    4928, 5110, 2144, 4306, 2246, 3203, 3368, 732, 1988, 2650, 1412, 5176, 5464, 3322, 4151, 4087,
+    3523, 2180, 1840, 1447, 4006, 1830, 1103, 4293, 2739, 3009, 2104, 2519, 4441, 3107, 1844, 3200,
+    5314, 1688, 2766, 3044, 1106, 2534, 4897, 980, 3658, 2186, 2308, 2131, 777, 3073, 2895, 3417,
+    4578, 4987, 1749, 4673, 1932, 2710, 4743, 3407, 1898, 2290, 3276, 1512, 738, 1774, 60, 3482,
+    4045, 533, 377, 383, 915, 284, 2307, 4108, 5205, 2134, 3593, 362, 4027, 3156, 1812, 5070,
+    4429, 1441, 3818, 3258, 3183, 4424, 24, 4627, 4259, 4099, 2827, 5413, 656, 3283, 4750, 2096,
+    5323, 828, 816, 615, 3189, 1372, 5294, 252, 5422, 1806, 3967, 5327, 4143, 716, 3759, 1035,
+    2035, 1305, 1307, 2078, 5494, 3134, 415, 4554, 1519, 3838, 4746, 3221, 17, 2562, 3725, 4437,
+    1649, 5144, 3094, 4804, 2031, 4252, 4995, 3600, 4464, 959, 2524, 2771, 3554, 4443, 3874, 395,
+    5037, 1313, 3546, 955, 4213, 3821, 1938, 478, 232, 1998, 2600, 2772, 4147, 2375, 3076, 1953,
+    687, 1446, 5421, 2120, 1444, 3212, 3062, 3851, 1073, 1370, 387, 2607, 2463, 1352, 1516, 3381,
+    567, 2297, 2469, 4115, 3247, 4377, 2719, 1399, 754, 5481, 2442, 3222, 2526, 4201, 5362, 539,
+    2755, 4797, 649, 3645, 4055, 5349, 412, 3339, 3687, 3109, 5151, 2917, 3635, 4409, 357, 2616,
+    4399, 5077, 1866, 4779, 4065, 4521, 5221, 593, 5158, 1709, 1137, 3006, 1298, 2849, 3718, 2818,
+    1952, 2780, 6, 4792, 5529, 4246, 1212, 38, 2172, 780, 3957, 4667, 5431, 3143, 5423, 2540,
+    4455, 4853, 4343, 957, 2874, 2448, 1889, 1538, 2115, 4730, 2543, 770, 1275, 2550, 4935, 2764,
+    2411, 3015, 3735, 244, 1385, 3927, 704, 4305, 3945, 1070, 1193, 4725, 2532, 1647, 1602, 2666,
+    1721, 211, 236, 1071, 1168, 1079, 3292, 4736, 5197, 4879, 608, 4544, 1848, 3681, 568, 3354,
+    3882, 3139, 2404, 3310, 3556, 1681, 4974, 2150, 2427, 4753, 5375, 299, 1293, 4617, 5505, 4330,
+    858, 3617, 3999, 3683, 3041, 1731, 1393, 2937, 2349, 172, 173, 497, 5407, 1506, 1325, 3185,
+    2902, 1714, 2036, 5082, 1198, 2103, 1548, 1242, 3064, 681, 4700, 3901, 44, 1013, 3930, 4738,
+    1930, 3019, 1790, 146, 3935, 5485, 5126, 3941, 611, 1765, 3852, 3250, 2067, 2413, 5192, 372,
+    3427, 2457, 2617, 5051, 2306, 3958, 181, 1650, 2137, 304, 338, 5286, 3003, 81, 4754, 3244,
+    1329, 102, 882, 622, 1733, 3800, 5449, 562, 4791, 1886, 1893, 2368, 1689, 5419, 1601, 2787,
+    3701, 318, 4777, 2201, 1574, 655, 2820, 1312, 3302, 2288, 2722, 591, 3581, 671, 2303, 1781,
+    2749, 3226, 4638, 5148, 1550, 3582, 2870, 4223, 3622, 2026, 4924, 1019, 97, 2566, 2428, 4,
+    1487, 5333, 3389, 4296, 337, 5183, 3111, 4262, 4010, 1585, 265, 5252, 2629, 3084, 4789, 3351,
+    5102, 5295, 1846, 3925, 3174, 5293, 3642, 5458, 1532, 993, 1485, 5000, 217, 1839, 461, 5124,
+    5532, 1127, 5142, 4324, 197, 4328, 2296, 237, 3576, 666, 2118, 2508, 4366, 4117, 1463, 4870,
+    4135, 2382, 5079, 4288, 725, 2686, 1947, 4826, 2536, 5145, 696, 2731, 1852, 3242, 5179, 3296,
+    4483, 720, 3078, 3233, 5332, 2012, 910, 2662, 3504, 1696, 3472, 1618, 1295, 5218, 1695, 3776,
+    1833, 859, 2631, 4624, 3433, 2845, 3517, 545, 1316, 2094, 5438, 4762, 4740, 905, 4469, 4845,
+    4048, 3869, 2836, 2819, 2573, 4825, 5280, 2924, 2125, 5347, 3261, 3436, 496, 2073, 891, 3650,
+    2840, 5227, 4747, 3020, 271, 1850, 2891, 1901, 4080, 4684, 1350, 2472, 2267, 46, 1222, 3654,
+    2611, 2700, 5298, 2101, 317, 5357, 894, 4279, 313, 2325, 2260, 926, 3623, 1408, 3809, 5112,
+    3894, 2596, 3950, 2200, 5320, 2249, 3516, 1381, 3761, 3626, 5044, 2086, 1849, 1637, 2083, 4222,
+    1720, 2235, 4236, 1283, 1147, 2735, 1831, 3079, 2388, 2142, 3773, 5345, 1440, 3710, 2938, 2706,
+    4174, 2692, 4660, 4051, 4601, 2450, 3138, 4501, 617, 652, 3123, 1529, 4636, 1954, 341, 3088,
+    4927, 3804, 1135, 3379, 5478, 1093, 1615, 5254, 728, 436, 5418, 5239, 1351, 253, 4098, 517,
+    435, 3670, 502, 3305, 1581, 5224, 2161, 2138, 4509, 4745, 1668, 4316, 1607, 408, 5273, 3413,
+    3923, 4095, 31, 4160, 2169, 5392, 1301, 1176, 3144, 4895, 1508, 5448, 3684, 3067, 1863, 3538,
+    5509, 4434, 2586, 524, 2625, 607, 5337, 1201, 1434, 577, 2505, 2674, 498, 4096, 4315, 360,
+    277, 5078, 4387, 1250, 5058, 358, 1596, 1983, 4488, 2945, 5143, 4189, 1331, 5526, 941, 1880,
+    3445, 3678, 4349, 1219, 3856, 2934, 3179, 2555, 4165, 639, 2002, 1358, 1619, 4266, 4176, 3201,
+    2195, 1036, 4788, 4599, 4712, 1163, 1004, 3675, 5049, 3711, 5513, 2048, 4576, 229, 2512, 3756,
+    1588, 2143, 4494, 5123, 5211, 1297, 1820, 528, 4301, 3551, 1281, 4595, 761, 5083, 1662, 3828,
+    4614, 4851, 1715, 1032, 3866, 5288, 625, 2424, 715, 1055, 5025, 2614, 2174, 1237, 3803, 3848,
+    2044, 3051, 3125, 5236, 3666, 3632, 981, 2111, 1477, 300, 2259, 1406, 3141, 2558, 982, 4901,
+    2679, 4308, 2883, 5353, 208, 4326, 5248, 1271, 4678, 2941, 3917, 2993, 1031, 943, 4323, 4705,
+    2412, 1982, 4240, 2932, 623, 2110, 410, 2647, 4993, 3810, 3921, 4219, 600, 1724, 2344, 1483,
+    2997, 2833, 2042, 3404, 4778, 514, 1404, 205, 4057, 1530, 4550, 3490, 1869, 5269, 549, 2011,
+    4086, 843, 5470, 3747, 1980, 5530, 4256, 575, 3358, 3011, 5199, 722, 734, 2095, 870, 5157,
+    1877, 2040, 4033, 5138, 1814, 1150, 339, 1413, 444, 2765, 1797, 1252, 5436, 4977, 1948, 16,
+    2991, 2283, 2890, 3657, 2510, 531, 3190, 4126, 5310, 491, 5434, 2834, 1166, 4864, 1068, 4338,
+    2901, 2822, 3001, 2877, 5492, 1945, 1994, 2028, 1792, 2237, 186, 484, 760, 3098, 1185, 1425,
+    2974, 2334, 3253, 1008, 3249, 4384, 4187, 4358, 4311, 5343, 5440, 3823, 1320, 3082, 1515, 3403,
+    2406, 605, 5084, 5231, 1667, 59, 846, 4676, 4859, 2627, 4719, 5461, 1121, 1228, 5184, 5128,
+    3096, 5384, 1072, 1474, 3589, 3154, 2935, 1593, 3796, 2148, 766, 4598, 2459, 1631, 1083, 990,
+    810, 3317, 4398, 2767, 5075, 2776, 4342, 5396, 1146, 1923, 4698, 2449, 1323, 3374, 2537, 1279,
+    963, 2484, 3740, 724, 1429, 589, 931, 2247, 1752, 785, 5237, 5108, 4593, 1620, 2335, 820,
+    5088, 1554, 662, 3010, 141, 4072, 4964, 2023, 1641, 4916, 1862, 3693, 2145, 4929, 267, 3906,
+    1448, 3841, 475, 819, 2272, 3192, 2466, 4548, 348, 862, 1899, 2520, 4915, 4813, 2531, 4656,
+    5233, 4919, 1640, 2802, 4808, 898, 4534, 1024, 1657, 240, 2084, 996, 321, 3116, 3187, 3243,
+    4559, 1625, 3749, 4061, 4841, 1815, 100, 3458, 4764, 2907, 2211, 1922, 1549, 1951, 4629, 885,
+    3674, 72, 3579, 2797, 5244, 886, 3549, 482, 227, 836, 3753, 183, 1528, 4030, 839, 2229,
+    332, 1205, 84, 1712, 3656, 5056, 3066, 2535, 4382, 4388, 91, 585, 3820, 995, 307, 3877,
+    5506, 3446, 3163, 4379, 3643, 2769, 2879, 2795, 5016, 5007, 3857, 405, 772, 4231, 3288, 3251,
+    1890, 661, 3928, 394, 4112, 3601, 4934, 4982, 3979, 4105, 3698, 2233, 1119, 3326, 3535, 204,
+    3375, 3475, 3416, 574, 4682, 1273, 4634, 2365, 835, 5472, 1410, 2256, 2979, 1622, 1590, 914,
+    4703, 5167, 674, 130, 976, 3886, 3029, 1389, 4322, 4380, 4365, 4128, 201, 3559, 3842, 5125,
+    5062, 3625, 1563, 5486, 1197, 4855, 5173, 4193, 4137, 2476, 1235, 2590, 4090, 4604, 3519, 1766,
+    4448, 564, 2121, 2396, 2337, 530, 3949, 675, 5307, 4772, 4786, 2987, 2615, 918, 3129, 4049,
+    3780, 5202, 4854, 275, 4946, 422, 350, 5490, 2504, 4271, 3042, 169, 3732, 792, 4846, 3539,
+    4512, 4689, 793, 2383, 2696, 4370, 1832, 697, 2789, 4289, 1524, 1369, 795, 4344, 1218, 3584,
+    407, 2648, 2381, 2966, 3752, 3676, 1062, 2170, 1551, 3295, 3336, 2276, 4257, 1691, 4046, 4642,
+    923, 1614, 636, 3320, 37, 4849, 3787, 3908, 1302, 3061, 1763, 2948, 756, 5496, 1836, 640,
+    3452, 1033, 4973, 3833, 3195, 3953, 2389, 4898, 145, 1920, 101, 1572, 1598, 509, 1534, 5200,
+    3024, 643, 2593, 2703, 4941, 2906, 2815, 2130, 216, 2129, 1366, 3412, 1571, 4511, 5452, 5136,
+    4013, 4913, 1126, 3216, 664, 3275, 555, 1756, 4690, 5114, 178, 5149, 4947, 1867, 1181, 2234,
+    2227, 2479, 4101, 3714, 797, 3065, 3290, 2969, 1884, 3113, 4581, 2061, 433, 1144, 4828, 654,
+    3629, 5429, 2841, 206, 2075, 2610, 4600, 4373, 4623, 3659, 1338, 5525, 1392, 156, 2461, 5489,
+    1987, 1669, 5309, 1186, 1327, 3757, 485, 5095, 4625, 1928, 2217, 4618, 834, 4118, 3312, 2029,
+    4570, 2458, 1263, 2490, 4014, 2994, 4272, 4952, 5246, 5154, 2482, 1730, 3531, 1817, 4050, 5416,
+    2224, 3989, 551, 4910, 3344, 5068, 342, 2165, 1654, 82, 463, 3588, 5232, 3100, 3191, 1462,
+    1986, 4714, 2087, 1842, 2724, 4149, 2688, 4968, 4961, 1879, 5424, 4992, 390, 3793, 4833, 4885,
+    1194, 1284, 65, 919, 4250, 5229, 1436, 4304, 822, 2804, 3262, 4127, 3286, 4155, 4418, 2814,
+    979, 1134, 4300, 2348, 1377, 5118, 4701, 4603, 969, 2359, 930, 3603, 3695, 1795, 1909, 1613,
+    4755, 3738, 1740, 5443, 1321, 3515, 4683, 3997, 868, 978, 4217, 581, 5204, 2236, 5417, 2363,
+    933, 3746, 5268, 3423, 4459, 5127, 7, 3811, 4812, 5533, 5510, 3707, 572, 3831, 5097, 5165,
+    2788, 1203, 3996, 3911, 5397, 2929, 2345, 2193, 4062, 5207, 1226, 2506, 281, 609, 3489, 3595,
+    1673, 1002, 1746, 4953, 2592, 794, 4531, 1967, 246, 4580, 2671, 5198, 4188, 4907, 1822, 532,
+    2100, 4194, 5022, 3806, 258, 1492, 3473, 719, 3294, 1178, 5399, 2254, 3611, 1091, 561, 4285,
+    3813, 2583, 1407, 4495, 505, 4417, 3207, 2216, 3904, 54, 389, 692, 1357, 4251, 154, 5209,
+    3285, 1014, 2866, 1344, 2154, 2655, 4391, 5488, 3281, 397, 5117, 4119, 2041, 4784, 3634, 2033,
+    3239, 2858, 1634, 2489, 2015, 5103, 2214, 4078, 4489, 3615, 4524, 4621, 42, 1022, 3352, 5442,
+    457, 2053, 2503, 428, 1040, 282, 5113, 1966, 2656, 1200, 189, 5005, 2578, 234, 1811, 2851,
+    1365, 3240, 2542, 2045, 2447, 4492, 3816, 2004, 5008, 4626, 3397, 1156, 1012, 3621, 1025, 1675,
+    3719, 1122, 5010, 5338, 3702, 4773, 241, 1414, 5406, 5446, 4000, 2677, 4962, 3648, 3426, 2252,
+    3410, 83, 899, 2007, 3127, 5150, 3592, 115, 632, 411, 1112, 424, 1475, 5410, 2282, 3014,
+    1422, 3421, 420, 881, 4817, 4457, 2108, 4428, 4653, 1856, 4069, 2995, 3462, 254, 3974, 690,
+    1623, 2491, 226, 1225, 1065, 95, 4564, 5444, 4537, 831, 4440, 4056, 2024, 5032, 427, 3664,
+    650, 5300, 815, 3037, 2664, 4029, 1390, 954, 2868, 2338, 4981, 877, 49, 409, 4780, 2487,
+    2271, 3441, 4267, 5076, 4687, 4258, 1603, 917, 3836, 2340, 860, 384, 3553, 2676, 212, 1433,
+    1130, 3987, 381, 2300, 934, 2639, 4908, 4471, 2608, 5034, 2182, 3764, 1128, 3289, 4402, 64,
+    3202, 3771, 2097, 152, 2729, 691, 2160, 1624, 3737, 4609, 4706, 742, 1054, 2364, 2613, 3120,
+    367, 5009, 39, 4253, 4821, 2071, 2000, 1981, 1560, 4159, 5180, 2378, 614, 270, 2153, 1155,
+    1028, 2633, 5101, 4978, 1626, 1328, 1010, 1016, 3899, 2603, 1455, 4591, 2478, 1891, 3995, 1452,
+    2760, 364, 1604, 3685, 842, 1509, 35, 2939, 4790, 789, 3329, 0, 4372, 2498, 1445, 1466,
+    440, 3454, 566, 998, 1963, 298, 176, 2964, 4183, 556, 2146, 3148, 359, 3204, 2900, 3506,
+    1872, 4856, 3849, 2711, 4561, 4396, 2052, 5203, 3466, 12, 1718, 1287, 4650, 1794, 2005, 4960,
+    3562, 1531, 2695, 986, 3451, 2311, 3783, 1063, 3128, 3975, 3022, 3840, 53, 1479, 2916, 1700,
+    4200, 3865, 3973, 1894, 1348, 5177, 4752, 2232, 2117, 1265, 2745, 2896, 4375, 3876, 3510, 426,
+    2355, 175, 3218, 1241, 2228, 4498, 2446, 1503, 4431, 2651, 1286, 3602, 1308, 5166, 3965, 4184,
+    3862, 1926, 2728, 2946, 1498, 21, 3376, 2319, 3440, 4834, 3437, 3453, 4918, 3920, 5387, 262,
+    541, 289, 848, 5297, 1907, 3465, 5039, 3682, 1716, 2371, 231, 149, 1684, 2171, 1177, 952,
+    93, 2923, 3859, 3145, 1883, 992, 3439, 4340, 5504, 1685, 3040, 2539, 467, 2046, 4528, 3367,
+    3077, 3341, 527, 2673, 1627, 1175, 4575, 3694, 2475, 3570, 1391, 4260, 3870, 2278, 5447, 1854,
+    4130, 5457, 2333, 3461, 1565, 1605, 1233, 2438, 3102, 3739, 8, 3847, 1041, 4017, 1435, 1843,
+    2649, 3228, 3726, 3653, 2725, 2709, 19, 2691, 1208, 3873, 87, 5283, 624, 4582, 1192, 303,
+    1661, 4909, 563, 937, 3513, 4066, 5216, 4760, 1824, 2511, 1726, 684, 4522, 1965, 4983, 184,
+    5260, 2660, 1767, 5018, 2320, 4594, 5313, 3709, 4652, 2316, 2140, 242, 3103, 2158, 4711, 1272,
+    1353, 3933, 852, 2102, 2821, 4686, 4500, 1247, 2730, 4082, 5322, 2567, 4737, 4156, 5319, 4794,
+    5168, 4015, 3937, 1303, 2422, 3537, 1266, 1034, 769, 1758, 1467, 1262, 3092, 3540, 1742, 3031,
+    2744, 1020, 1236, 4923, 61, 2985, 1021, 4979, 3624, 4107, 1421, 2930, 1676, 3056, 398, 1941,
+    4771, 4939, 1001, 1064, 1416, 1428, 4255, 26, 1995, 4106, 120, 1819, 4393, 1659, 3254, 913,
+    1115, 3641, 2277, 4782, 2940, 4716, 2164, 4436, 3345, 3812, 729, 1059, 2222, 2569, 4023, 2518,
+    1269, 683, 4093, 1931, 1388, 2931, 2862, 2915, 5296, 363, 3087, 1921, 3424, 1828, 4444, 5302,
+    1611, 355, 1939, 1772, 483, 4177, 3782, 4904, 4822, 3521, 2568, 2698, 4872, 3054, 2809, 76,
+    2231, 634, 4597, 4110, 5066, 2727, 2431, 5374, 4244, 1703, 3399, 3126, 4120, 909, 948, 2680,
+    4294, 5215, 3689, 519, 5, 3723, 3442, 1027, 3158, 1347, 2956, 5501, 2561, 2266, 2775, 2576,
+    108, 2327, 4998, 4585, 2684, 3470, 2493, 4958, 3766, 3637, 1761, 5521, 3994, 1395, 1784, 1717,
+    1999, 3325, 1589, 1220, 648, 3736, 32, 2968, 3867, 4022, 912, 5040, 2770, 2304, 3567, 1943,
+    257, 3224, 911, 3043, 2582, 3744, 1969, 718, 3099, 1102, 2313, 4502, 333, 2756, 260, 4861,
+    1791, 4819, 2501, 2009, 3178, 1573, 28, 5122, 3097, 5163, 1885, 4161, 938, 3597, 2081, 366,
+    4831, 1184, 2454, 866, 1698, 1158, 2888, 1000, 1426, 476, 4508, 1961, 1656, 3460, 3883, 4759,
+    2243, 5479, 1214, 2293, 3679, 1118, 3237, 3034, 1101, 1061, 276, 506, 773, 4083, 4102, 2238,
+    1672, 806, 1587, 4733, 1418, 2922, 2220, 3778, 1095, 361, 3981, 3089, 5050, 2013, 472, 5271,
+    2800, 2248, 2128, 30, 594, 160, 1964, 4146, 1125, 2672, 1260, 1107, 2903, 3408, 4229, 4420,
+    5454, 4723, 4758, 4852, 2021, 4515, 3720, 2933, 612, 3748, 5257, 1523, 2831, 1732, 1258, 5503,
+    442, 3140, 4757, 2400, 2074, 2168, 2751, 1895, 5085, 89, 3781, 2357, 2285, 1599, 1343, 3897,
+    3188, 3884, 1082, 1098, 1419, 5238, 4651, 3300, 188, 107, 3918, 2885, 41, 827, 1099, 4313,
+    4880, 2554, 3550, 4018, 1927, 3962, 2499, 4019, 5474, 5030, 4911, 441, 3234, 2873, 1745, 4346,
+    3447, 665, 1978, 1682, 490, 4408, 2704, 1427, 944, 5210, 2619, 4605, 323, 308, 4731, 4967,
+    1975, 2884, 2790, 854, 707, 4168, 266, 210, 883, 4622, 2897, 2875, 4199, 4985, 5147, 1023,
+    1458, 2563, 128, 3393, 4397, 5519, 1371, 856, 5272, 3620, 1677, 2606, 5195, 2750, 2910, 1045,
+    1087, 3668, 109, 1760, 423, 473, 4261, 4394, 3491, 4654, 3481, 4422, 3802, 635, 821, 5414,
+    3193, 3298, 203, 4407, 5428, 878, 791, 1916, 3507, 2791, 2139, 1245, 326, 3508, 4540, 1545,
+    3613, 4810, 1706, 3075, 487, 873, 1319, 3651, 2546, 1816, 4227, 4955, 4138, 4254, 3528, 571,
+    576, 4976, 3977, 3751, 2240, 4392, 1940, 4263, 3667, 4084, 4486, 2465, 4478, 1520, 13, 876,
+    2914, 847, 5270, 1517, 1050, 500, 3108, 525, 1935, 2398, 5045, 67, 347, 1564, 5137, 1735,
+    3327, 983, 3095, 1976, 3618, 2419, 4454, 3827, 3854, 4858, 3903, 3929, 4984, 5100, 1264, 733,
+    5497, 5052, 2430, 4728, 1449, 2455, 5460, 2857, 5334, 1665, 3431, 2777, 5006, 2559, 4768, 3356,
+    3402, 3982, 443, 1693, 4761, 626, 4996, 5212, 2886, 922, 118, 2318, 9, 4680, 3703, 2196,
+    2899, 3401, 255, 971, 5048, 1043, 5241, 1697, 4302, 456, 2530, 1270, 3760, 2952, 3380, 1294,
+    2527, 5512, 4988, 3478, 4202, 2565, 4039, 4793, 4562, 1674, 471, 2076, 657, 3558, 2898, 4530,
+    4691, 2384, 5282, 5190, 1789, 3734, 1131, 4321, 43, 5466, 4401, 3176, 2039, 2321, 5465, 3890,
+    5217, 557, 1007, 2975, 3863, 2141, 2721, 393, 1090, 5129, 5181, 3277, 419, 1, 638, 4461,
+    4520, 4166, 3564, 2370, 4310, 1638, 3560, 991, 1104, 1292, 47, 2385, 2323, 4381, 3524, 2708,
+    418, 3976, 2376, 1562, 1171, 904, 3177, 2010, 3688, 2051, 3573, 4005, 1518, 5021, 3360, 4278,
+    4071, 4153, 4081, 3074, 349, 4766, 3544, 921, 751, 3916, 4371, 3030, 3231, 3303, 4268, 1858,
+    1341, 4770, 972, 4053, 5356, 2350, 4206, 3331, 3409, 4220, 4044, 4543, 4360, 4848, 2551, 2179,
+    3105, 4172, 1594, 5047, 4887, 949, 2212, 5026, 890, 2500, 4869, 2133, 2560, 2623, 5055, 723,
+    2265, 4937, 3046, 1173, 3980, 2574, 3745, 4785, 4419, 1117, 1802, 735, 4070, 5468, 5372, 3647,
+    962, 2570, 4926, 3755, 5222, 3885, 1979, 1865, 1472, 3855, 1522, 1621, 2687, 4097, 4142, 1635,
+    2123, 2838, 4286, 3501, 5014, 2773, 3743, 5064, 2147, 112, 3497, 4513, 3055, 633, 1011, 2280,
+    2159, 5250, 812, 1754, 3829, 717, 3390, 259, 1546, 4499, 3012, 1857, 5373, 4602, 1056, 837,
+    365, 3378, 3817, 4669, 5450, 1577, 5223, 2589, 3565, 4942, 1398, 2190, 119, 580, 3825, 2451,
+    5249, 4710, 1085, 3669, 892, 4527, 2091, 3164, 4674, 4776, 4661, 1864, 5285, 2920, 5498, 460,
+    4827, 5441, 1992, 5515, 1570, 501, 586, 2408, 3797, 2255, 803, 4004, 2829, 1539, 5342, 5462,
+    90, 5394, 546, 5390, 3948, 4997, 3992, 3474, 2624, 2947, 346, 1868, 2658, 1111, 3547, 2878,
+    3963, 3686, 582, 5277, 2825, 1096, 1788, 4971, 4715, 1209, 3934, 3132, 4460, 3907, 4390, 1793,
+    5291, 5522, 3536, 965, 3049, 5363, 2754, 4185, 1038, 1415, 2464, 3574, 1409, 3070, 2295, 1578,
+    4339, 305, 5080, 5476, 4496, 670, 116, 2665, 25, 4485, 2654, 1148, 1513, 34, 150, 2197,
+    469, 5134, 22, 2622, 1653, 2912, 1552, 4547, 4557, 94, 4951, 603, 285, 5219, 3366, 573,
+    2949, 710, 1120, 5003, 4299, 2397, 3956, 1580, 5524, 3984, 3850, 3665, 2429, 369, 701, 2098,
+    4558, 3385, 3165, 40, 4583, 1764, 286, 4357, 215, 1800, 315, 1944, 3860, 2865, 470, 3155,
+    1160, 2502, 466, 5401, 4795, 5240, 2343, 353, 3677, 166, 920, 3808, 2346, 1535, 2369, 3789,
+    1660, 4063, 4506, 3875, 503, 4491, 2942, 1630, 274, 3398, 4567, 767, 1478, 782, 3545, 52,
+    932, 595, 3970, 2374, 3159, 3355, 69, 1354, 927, 511, 1306, 864, 1402, 4890, 764, 1903,
+    3578, 3166, 950, 3335, 3377, 3229, 2643, 1315, 2289, 2699, 4421, 163, 869, 4637, 3822, 3988,
+    1060, 3580, 1431, 2080, 4510, 5038, 1741, 3394, 774, 5263, 3266, 4363, 2432, 3278, 2742, 4646,
+    1747, 1029, 3522, 4820, 3115, 4587, 5381, 1364, 4838, 139, 2905, 414, 1542, 3272, 2521, 2682,
+    1457, 171, 2392, 1042, 2149, 4351, 3457, 3270, 2893, 5054, 18, 1333, 3843, 117, 1491, 3414,
+    2811, 1610, 5255, 1851, 621, 2816, 3493, 167, 2996, 2360, 3728, 434, 3370, 15, 33, 3951,
+    4835, 5265, 4150, 5427, 316, 924, 3969, 4347, 3418, 1757, 3879, 1510, 2477, 968, 4432, 807,
+    4806, 96, 1468, 565, 4734, 1257, 1278, 1707, 1165, 2632, 74, 3357, 3498, 3199, 809, 1911,
+    2667, 2496, 5171, 4538, 2287, 3902, 945, 3332, 3274, 1199, 2163, 62, 376, 3267, 4956, 1600,
+    3961, 667, 5012, 3112, 3525, 320, 1997, 3571, 765, 495, 3861, 903, 706, 3895, 1773, 705,
+    3429, 2867, 855, 279, 5133, 4590, 196, 1678, 4008, 2950, 1488, 2415, 2372, 2261, 4264, 1141,
+    3392, 5467, 5459, 889, 3256, 4079, 4389, 1968, 880, 3652, 261, 4226, 1739, 4439, 3936, 3872,
+    1755, 579, 1253, 3455, 190, 3511, 3835, 5023, 4552, 2326, 161, 3171, 5400, 2646, 5213, 5164,
+    3924, 1169, 474, 4369, 2336, 3889, 3503, 421, 1505, 4036, 4378, 5067, 1736, 2810, 935, 292,
+    3518, 660, 1384, 2244, 4709, 2331, 1211, 1230, 2119, 5453, 1330, 4572, 4270, 1332, 748, 4038,
+    5135, 5267, 4470, 1309, 4205, 1296, 3340, 4191, 213, 4034, 1290, 737, 2387, 489, 2284, 3939,
+    4616, 4012, 5364, 1809, 2712, 4644, 1841, 4866, 4844, 5086, 3533, 2980, 431, 5159, 1990, 4173,
+    4003, 2056, 1559, 1704, 73, 2813, 230, 3435, 2088, 155, 3477, 5017, 5035, 1955, 4933, 5305,
+    1489, 3172, 4233, 964, 2832, 1989, 2410, 3334, 1048, 2194, 4647, 3786, 3052, 2799, 1246, 4352,
+    3124, 1729, 5351, 4781, 2637, 2768, 3563, 2273, 268, 4693, 481, 713, 679, 5346, 4435, 1502,
+    4403, 1288, 5409, 4721, 512, 2386, 400, 1386, 4945, 3777, 1053, 3990, 2434, 3365, 4148, 2547,
+    1500, 1336, 2059, 4035, 3784, 1215, 5311, 3614, 5119, 2843, 3333, 3146, 4487, 775, 380, 872,
+    2401, 726, 48, 4481, 2390, 2038, 1644, 1786, 468, 2416, 4248, 4818, 3209, 3555, 3946, 4936,
+    1239, 2747, 740, 616, 5065, 4002, 4060, 2291, 2989, 4482, 3713, 975, 375, 1743, 2209, 1892,
+    3898, 4503, 3214, 1558, 1567, 2315, 66, 1136, 4633, 4472, 3765, 5531, 3636, 1683, 4662, 4959,
+    4001, 3306, 3169, 2279, 5090, 1616, 5111, 159, 5276, 4020, 2669, 4577, 727, 958, 4376, 50,
+    1229, 5013, 3704, 2167, 3633, 4809, 4319, 4735, 3085, 2736, 2030, 1397, 4446, 2807, 4453, 853,
+    5404, 3047, 3750, 4426, 3110, 788, 1362, 1497, 4243, 619, 2403, 5435, 4584, 2342, 1058, 138,
+    110, 3772, 708, 1582, 3255, 1629, 2794, 3330, 2462, 2049, 3741, 1633, 695, 3830, 2549, 2317,
+    2645, 4938, 2716, 2132, 1694, 4803, 5027, 296, 3644, 1324, 2027, 2208, 4518, 2548, 144, 3297,
+    165, 1438, 1737, 5378, 3316, 798, 4749, 3245, 4164, 1310, 5325, 122, 521, 4410, 3534, 3114,
+    1770, 5261, 3167, 14, 3260, 3790, 5015, 2188, 2594, 1015, 4132, 5153, 4914, 1985, 3175, 4152,
+    2685, 516, 374, 2250, 4619, 1217, 2460, 3282, 5433, 4477, 1609, 4490, 5107, 4412, 559, 2394,
+    2399, 2869, 1875, 269, 2112, 1424, 1379, 2844, 841, 4533, 2065, 2830, 2257, 1936, 3213, 4009,
+    3318, 3038, 3151, 2761, 1339, 4556, 1047, 1037, 4467, 4333, 3196, 3422, 1077, 1783, 137, 3770,
+    4277, 3072, 278, 5516, 330, 3205, 2702, 1442, 3791, 2675, 4162, 1164, 5278, 86, 4425, 4801,
+    2440, 1801, 2264, 2579, 4717, 3181, 1046, 5152, 1049, 3063, 3788, 3844, 2393, 1191, 1450, 5189,
+    1183, 1804, 4649, 698, 5426, 3832, 3552, 327, 200, 3926, 590, 2178, 4058, 651, 4167, 3541,
+    336, 4871, 2064, 5109, 3919, 2853, 1859, 3464, 2743, 2309, 2099, 781, 3135, 4648, 1481, 3815,
+    2587, 808, 4975, 4569, 2189, 597, 3235, 4466, 1376, 2774, 3023, 3208, 4367, 5072, 3909, 4573,
+    5069, 2641, 126, 1480, 1105, 3496, 78, 1711, 3805, 2962, 2953, 105, 4571, 4215, 3758, 4912,
+    875, 4163, 5061, 599, 3223, 3348, 2210, 1575, 2269, 2347, 2842, 1030, 1958, 744, 5098, 1162,
+    5132, 55, 3706, 5041, 3373, 56, 4318, 4566, 542, 940, 3291, 3411, 1375, 1299, 4237, 187,
+    2418, 4475, 658, 132, 3142, 888, 3794, 3692, 1666, 4309, 4516, 1785, 5344, 5456, 1437, 2758,
+    3048, 2982, 2245, 3532, 287, 351, 1017, 328, 23, 2864, 1949, 4195, 895, 5140, 4230, 4568,
+    3321, 5383, 2713, 465, 1149, 3942, 191, 4536, 669, 272, 3887, 602, 4298, 629, 3672, 2341,
+    4798, 620, 1304, 4295, 3505, 4438, 5096, 790, 2373, 2591, 4186, 3268, 480, 3630, 2880, 445,
+    4675, 1511, 916, 104, 1086, 4957, 4744, 1845, 4551, 2253, 4708, 2652, 2792, 5106, 2241, 5315,
+    970, 3846, 570, 451, 247, 1780, 3712, 1110, 4628,
+}};
+
+} // namespace xsk::gsc::iw5
@@ -15,10 +15,7 @@ auto assembler::output_script() -> std::vector<std::uint8_t>
 
     if (script_ == nullptr) return script;
 
-    script.resize(script_->pos());
-    std::memcpy(script.data(), script_->buffer().data(), script.size());
-
-    return script;
+    return script_->release();
 }
 
 auto assembler::output_stack() -> std::vector<std::uint8_t>
@@ -27,23 +24,22 @@ auto assembler::output_stack() -> std::vector<std::uint8_t>
 
     if (stack_ == nullptr) return stack;
 
-    stack.resize(stack_->pos());
-    std::memcpy(stack.data(), stack_->buffer().data(), stack.size());
-
-    return stack;
+    return stack_->release();
 }
 
 void assembler::assemble(const std::string& file, std::vector<std::uint8_t>& data)
 {
-    std::vector<std::string> assembly = utils::string::clean_buffer_lines(data);
+    asm_reader reader(data.data(), data.size());
     std::vector<function::ptr> functions;
     function::ptr func = nullptr;
     std::uint32_t index = 1;
     std::uint16_t switchnum = 0;
 
-    for (auto& line : assembly)
+    while (reader.next())
     {
-        if (line == "" || line.substr(0, 2) == "//")
+        const auto line = reader.line();
+
+        if (line.substr(0, 2) == "//")
         {
             continue;
         }
@@ -63,25 +59,30 @@ void assembler::assemble(const std::string& file, std::vector<std::uint8_t>& dat
         }
         else if (line.substr(0, 4) == "loc_")
         {
-            func->labels[index] = line;
+            func->labels[index] = operand::label_id(std::string(line));
         }
         else
         {
-            auto data = utils::string::parse_code(line);
+            const auto& data = reader.tokens();
+
+            if (data.empty())
+            {
+                continue;
+            }
 
             if (switchnum)
             {
                 if (data[0] == "case" || data[0] == "default")
                 {
-                    for (auto& entry : data)
+                    for (const auto& entry : data)
                     {
-                        func->instructions.back()->data.push_back(entry);
+                        func->instructions.back()->data.push_back(std::string(entry));
                     }
                     switchnum--;
                     continue;
                 }
 
-                throw asm_error("invalid instruction inside endswitch \""s + line + "\"!");
+                throw asm_error("invalid instruction inside endswitch \""s + std::string(line) + "\"!");
             }
             else
             {
@@ -89,12 +90,16 @@ void assembler::assemble(const std::string& file, std::vector<std::uint8_t>& dat
                 inst->index = index;
                 inst->opcode = static_cast<std::uint8_t>(resolver::opcode_id(data[0]));
                 inst->size = opcode_size(inst->opcode);
-                data.erase(data.begin());
-                inst->data = std::move(data);
+                inst->data.reserve(data.size() - 1);
+
+                for (auto i = 1u; i < data.size(); i++)
+                {
+                    inst->data.push_back(std::string(data[i]));
+                }
 
                 if (opcode(inst->opcode) == opcode::OP_endswitch)
                 {
-                    switchnum = static_cast<std::uint16_t>(std::stoi(inst->data[0]));
+                    switchnum = static_cast<std::uint16_t>(inst->data[0].as_int());
                     inst->size += 7 * switchnum;
                 }
 
@@ -109,10 +114,24 @@ void assembler::assemble(const std::string& file, std::vector<std::uint8_t>& dat
 
 void assembler::assemble(const std::string& file, std::vector<function::ptr>& funcs)
 {
-    script_ = std::make_unique<utils::byte_buffer>(0x100000);
-    stack_ = std::make_unique<utils::byte_buffer>(0x100000);
+    std::size_t size = 1;
+
+    for (const auto& func : funcs)
+    {
+        size += func->size;
+    }
+
+    script_ = std::make_unique<utils::byte_buffer>(size);
+    stack_ = std::make_unique<utils::byte_buffer>(funcs.size() * 8);
     filename_ = file;
     functions_ = std::move(funcs);
+    function_index_.clear();
+    function_index_.reserve(functions_.size());
+
+    for (const auto& func : functions_)
+    {
+        function_index_.insert({ func->name, func->index });
+    }
 
     script_->write<std::uint8_t>(static_cast<std::uint8_t>(opcode::OP_End));
 
@@ -124,7 +143,13 @@ void assembler::assemble(const std::string& file, std::vector<function::ptr>& fu
 
 void assembler::assemble_function(const function::ptr& func)
 {
-    labels_ = func->labels;
+    label_index_.clear();
+    label_index_.reserve(func->labels.size());
+
+    for (const auto& entry : func->labels)
+    {
+        label_index_.insert({ entry.second, entry.first });
+    }
 
     stack_->write<std::uint32_t>(func->size);
 
@@ -220,26 +245,26 @@ void assembler::assemble_instruction(const instruction::ptr& inst)
         case opcode::OP_GetByte:
         case opcode::OP_GetNegByte:
             script_->write<std::uint8_t>(static_cast<std::uint8_t>(inst->opcode));
-            script_->write<std::uint8_t>(static_cast<std::uint8_t>(std::stoi(inst->data[0])));
+            script_->write<std::uint8_t>(static_cast<std::uint8_t>(inst->data[0].as_int()));
             break;
         case opcode::OP_GetUnsignedShort:
         case opcode::OP_GetNegUnsignedShort:
             script_->write<std::uint8_t>(static_cast<std::uint8_t>(inst->opcode));
-            script_->write<std::uint16_t>(static_cast<std::uint16_t>(std::stoi(inst->data[0])));
+            script_->write<std::uint16_t>(static_cast<std::uint16_t>(inst->data[0].as_int()));
             break;
         case opcode::OP_GetInteger:
             script_->write<std::uint8_t>(static_cast<std::uint8_t>(inst->opcode));
-            script_->write<std::int32_t>(std::stoi(inst->data[0]));
+            script_->write<std::int32_t>(inst->data[0].as_int());
             break;
         case opcode::OP_GetFloat:
             script_->write<std::uint8_t>(static_cast<std::uint8_t>(inst->opcode));
-            script_->write<float>(std::stof(inst->data[0]));
+            script_->write<float>(inst->data[0].as_float());
             break;
         case opcode::OP_GetVector:
             script_->write<std::uint8_t>(static_cast<std::uint8_t>(inst->opcode));
-            script_->write<float>(std::stof(inst->data[0]));
-            script_->write<float>(std::stof(inst->data[1]));
-            script_->write<float>(std::stof(inst->data[2]));
+            script_->write<float>(inst->data[0].as_float());
+            script_->write<float>(inst->data[1].as_float());
+            script_->write<float>(inst->data[2].as_float());
             break;
         case opcode::OP_GetString:
         case opcode::OP_GetIString:
@@ -261,7 +286,7 @@ void assembler::assemble_instruction(const instruction::ptr& inst)
             break;
         case opcode::OP_waittillmatch:
             script_->write<std::uint8_t>(static_cast<std::uint8_t>(inst->opcode));
-            script_->write<std::uint8_t>(static_cast<std::uint8_t>(std::stoi(inst->data[0])));
+            script_->write<std::uint8_t>(static_cast<std::uint8_t>(inst->data[0].as_int()));
             break;
         case opcode::OP_SetNewLocalVariableFieldCached0:
         case opcode::OP_EvalNewLocalArrayRefCached0:
@@ -278,7 +303,7 @@ void assembler::assemble_instruction(const instruction::ptr& inst)
         case opcode::OP_EvalLocalVariableObjectCached:
         case opcode::OP_EvalLocalArrayCached:
             script_->write<std::uint8_t>(static_cast<std::uint8_t>(inst->opcode));
-            script_->write<std::uint8_t>(static_cast<std::uint8_t>(std::stoi(inst->data[0])));
+            script_->write<std::uint8_t>(static_cast<std::uint8_t>(inst->data[0].as_int()));
             break;
         case opcode::OP_EvalSelfFieldVariable:
         case opcode::OP_SetLevelFieldVariableField:
@@ -301,7 +326,7 @@ void assembler::assemble_instruction(const instruction::ptr& inst)
         case opcode::OP_ScriptMethodThreadCallPointer:
         case opcode::OP_ScriptMethodChildThreadCallPointer:
             script_->write<std::uint8_t>(static_cast<std::uint8_t>(inst->opcode));
-            script_->write<std::uint8_t>(static_cast<std::uint8_t>(std::stoi(inst->data[0])));
+            script_->write<std::uint8_t>(static_cast<std::uint8_t>(inst->data[0].as_int()));
             break;
         case opcode::OP_GetLocalFunction:
         case opcode::OP_ScriptLocalFunctionCall2:
@@ -382,19 +407,19 @@ void assembler::assemble_builtin_call(const instruction::ptr& inst, bool method,
 
     if (args)
     {
-        script_->write<std::uint8_t>(static_cast<std::uint8_t>(std::stoi(inst->data[0])));
+        script_->write<std::uint8_t>(static_cast<std::uint8_t>(inst->data[0].as_int()));
 
         if (method)
-            id = inst->data[1].substr(0, 3) == "_ID" ? std::stoi(inst->data[1].substr(3)) : resolver::method_id(inst->data[1]);
+            id = resolve_id(inst->data[1], resolver::method_id);
         else
-            id = inst->data[1].substr(0, 3) == "_ID" ? std::stoi(inst->data[1].substr(3)) : resolver::function_id(inst->data[1]);
+            id = resolve_id(inst->data[1], resolver::function_id);
     }
     else
     {
         if (method)
-            id = inst->data[0].substr(0, 3) == "_ID" ? std::stoi(inst->data[0].substr(3)) : resolver::method_id(inst->data[0]);
+            id = resolve_id(inst->data[0], resolver::method_id);
         else
-            id = inst->data[0].substr(0, 3) == "_ID" ? std::stoi(inst->data[0].substr(3)) : resolver::function_id(inst->data[0]);
+            id = resolve_id(inst->data[0], resolver::function_id);
     }
 
     script_->write<std::uint16_t>(id);
@@ -412,7 +437,7 @@ void assembler::assemble_local_call(const instruction::ptr& inst, bool thread)
 
     if (thread)
     {
-        script_->write<std::uint8_t>(static_cast<std::uint8_t>(std::stoi(inst->data[1])));
+        script_->write<std::uint8_t>(static_cast<std::uint8_t>(inst->data[1].as_int()));
     }
 }
 
@@ -427,15 +452,15 @@ void assembler::assemble_far_call(const instruction::ptr& inst, bool thread)
 
     if (thread)
     {
-        script_->write<std::uint8_t>(static_cast<std::uint8_t>(std::stoi(inst->data[0])));
+        script_->write<std::uint8_t>(static_cast<std::uint8_t>(inst->data[0].as_int()));
 
-        file_id = inst->data[1].substr(0, 3) == "_ID" ? std::stoi(inst->data[1].substr(3)) : resolver::file_id(inst->data[1]);
-        func_id = inst->data[2].substr(0, 3) == "_ID" ? std::stoi(inst->data[2].substr(3)) : resolver::token_id(inst->data[2]);
+        file_id = resolve_id(inst->data[1], resolver::file_id);
+        func_id = resolve_id(inst->data[2], resolver::token_id);
     }
     else
     {
-        file_id = inst->data[0].substr(0, 3) == "_ID" ? std::stoi(inst->data[0].substr(3)) : resolver::file_id(inst->data[0]);
-        func_id = inst->data[1].substr(0, 3) == "_ID" ? std::stoi(inst->data[1].substr(3)) : resolver::token_id(inst->data[1]);
+        file_id = resolve_id(inst->data[0], resolver::file_id);
+        func_id = resolve_id(inst->data[1], resolver::token_id);
     }
 
     stack_->write<std::uint16_t>(file_id);
@@ -459,9 +484,9 @@ void assembler::assemble_end_switch(const instruction::ptr& inst)
 
     std::uint16_t casenum = 0;
 
-    if (utils::string::is_number(inst->data[0]))
+    if (inst->data[0].type() == operand::kind::integer || utils::string::is_number(inst->data[0]))
     {
-        casenum = std::stoi(inst->data[0]);
+        casenum = inst->data[0].as_int();
     }
     else
     {
@@ -476,9 +501,9 @@ void assembler::assemble_end_switch(const instruction::ptr& inst)
     {
         if (inst->data[1 + (3 * i)] == "case")
         {
-            if (utils::string::is_number(inst->data[1 + (3 * i) + 1]))
+            if (inst->data[1 + (3 * i) + 1].type() == operand::kind::integer || utils::string::is_number(inst->data[1 + (3 * i) + 1]))
             {
-                script_->write<uint32_t>((std::stoi(inst->data[1 + (3 * i) + 1]) & 0xFFFFFF) + 0x800000);
+                script_->write<uint32_t>((inst->data[1 + (3 * i) + 1].as_int() & 0xFFFFFF) + 0x800000);
             }
             else
             {
@@ -515,9 +540,9 @@ void assembler::assemble_field_variable(const instruction::ptr& inst)
 
     std::uint16_t field_id = 0;
 
-    if (inst->data[0].substr(0, 3) == "_ID")
+    if (inst->data[0].type() == operand::kind::id || inst->data[0].substr(0, 3) == "_ID")
     {
-        field_id = (std::uint16_t)std::stoi(inst->data[0].substr(3));
+        field_id = resolve_id(inst->data[0], resolver::token_id);
     }
     else
     {
@@ -571,32 +596,64 @@ void assembler::assemble_offset(std::int32_t offset)
     script_->write<std::uint8_t>(bytes[2]);
 }
 
-auto assembler::resolve_function(const std::string& name) -> std::uint32_t
+// ids kept by the disassembler are written as they are, '_ID' names are parsed and
+// other names looked up
+template <typename T>
+auto assembler::resolve_id(const operand& data, T (*lookup)(const std::string&)) -> T
 {
-    auto temp = name.substr(0, 4) == "sub_" ? name.substr(4) : name;
-    
-    for (const auto& func : functions_)
+    if (data.type() == operand::kind::id)
+        return static_cast<T>(data.as_uint());
+
+    const auto name = data.str();
+
+    if (name.substr(0, 3) == "_ID")
+        return static_cast<T>(std::stoul(name.substr(3)));
+
+    return lookup(name);
+}
+
+auto assembler::resolve_function(const operand& data) -> std::uint32_t
+{
+    if (data.type() == operand::kind::function)
     {
-        if (func->name == temp)
+        const auto pos = data.as_uint();
+
+        if (pos < functions_.size())
         {
-            return func->index;
+            return functions_[pos]->index;
         }
+
+        throw asm_error("Couldn't resolve local function address of '" + data.substr(4) + "'!");
+    }
+
+    const auto name = data.str();
+    auto temp = std::string_view(name);
+
+    if (temp.substr(0, 4) == "sub_")
+    {
+        temp.remove_prefix(4);
+    }
+
+    const auto itr = function_index_.find(temp);
+
+    if (itr != function_index_.end())
+    {
+        return itr->second;
     }
 
-    throw asm_error("Couldn't resolve local function address of '" + temp + "'!");
+    throw asm_error("Couldn't resolve local function address of '" + std::string(temp) + "'!");
 }
 
-auto assembler::resolve_label(const std::string& name) -> std::uint32_t
+auto assembler::resolve_label(const operand& data) -> std::uint32_t
 {
-    for (auto& func : labels_)
+    const auto itr = label_index_.find(data.as_label());
+
+    if (itr != label_index_.end())
     {
-        if (func.second == name)
-        {
-            return func.first;
-        }
+        return itr->second;
     }
 
-    throw asm_error("Couldn't resolve label address of '" + name + "'!");
+    throw asm_error("Couldn't resolve label address of '" + data + "'!");
 }
 
 }  // namespace xsk::gsc::iw6
@@ -16,7 +16,7 @@ auto disassembler::output() -> std::vector<function::ptr>
 
 auto disassembler::output_data() -> std::vector<std::uint8_t>
 {
-    output_ = std::make_unique<utils::byte_buffer>(0x100000);
+    output_ = std::make_unique<utils::byte_buffer>(script_size_ * 4);
 
     output_->write_string("// IW6 GSC ASSEMBLY\n");
     output_->write_string("// Disassembled by https://github.com/xensik/gsc-tool\n");
@@ -26,19 +26,20 @@ auto disassembler::output_data() -> std::vector<std::uint8_t>
         print_function(func);
     }
 
-    std::vector<std::uint8_t> output;
-
-    output.resize(output_->pos());
-    std::memcpy(output.data(), output_->buffer().data(), output.size());
-
-    return output;
+    return output_->release();
 }
 
 void disassembler::disassemble(const std::string& file, std::vector<std::uint8_t>& script, std::vector<std::uint8_t>& stack)
+{
+    disassemble(file, script.data(), script.size(), stack.data(), stack.size());
+}
+
+void disassembler::disassemble(const std::string& file, const std::uint8_t* script, std::size_t script_size, const std::uint8_t* stack, std::size_t stack_size)
 {
     filename_ = file;
-    script_ = std::make_unique<utils::byte_buffer>(script);
-    stack_ = std::make_unique<utils::byte_buffer>(stack);
+    script_size_ = script_size;
+    script_ = std::make_unique<utils::byte_buffer>(script, script_size);
+    stack_ = std::make_unique<utils::byte_buffer>(stack, stack_size);
     functions_.clear();
 
     script_->seek(1);
@@ -60,6 +61,10 @@ void disassembler::disassemble(const std::string& file, std::vector<std::uint8_t
     }
 
     resolve_local_functions();
+
+    // the buffers only view the caller's data, don't keep them past this call
+    script_.reset();
+    stack_.reset();
 }
 
 void disassembler::dissasemble_function(const function::ptr& func)
@@ -157,25 +162,22 @@ void disassembler::dissasemble_instruction(const instruction::ptr& inst)
             break;
         case opcode::OP_GetByte:
         case opcode::OP_GetNegByte:
-            inst->data.push_back(utils::string::va("%i", script_->read<std::uint8_t>()));
+            inst->data.push_back(operand::integer(script_->read<std::uint8_t>()));
             break;
         case opcode::OP_GetUnsignedShort:
         case opcode::OP_GetNegUnsignedShort:
-            inst->data.push_back(utils::string::va("%i", script_->read<std::uint16_t>()));
+            inst->data.push_back(operand::integer(script_->read<std::uint16_t>()));
             break;
         case opcode::OP_GetInteger:
-            inst->data.push_back(utils::string::va("%i", script_->read<std::int32_t>()));
+            inst->data.push_back(operand::integer(script_->read<std::int32_t>()));
             break;
         case opcode::OP_GetFloat:
-        {
-            auto val = script_->read<float>();
-            inst->data.push_back(utils::string::va("%g%s", val, val == int(val) ? ".0" : ""));
-        }
+            inst->data.push_back(operand::floating(script_->read<float>()));
             break;
         case opcode::OP_GetVector:
-            inst->data.push_back(utils::string::va("%g", script_->read<float>()));
-            inst->data.push_back(utils::string::va("%g", script_->read<float>()));
-            inst->data.push_back(utils::string::va("%g", script_->read<float>()));
+            inst->data.push_back(operand::component(script_->read<float>()));
+            inst->data.push_back(operand::component(script_->read<float>()));
+            inst->data.push_back(operand::component(script_->read<float>()));
             break;
         case opcode::OP_GetString:
         case opcode::OP_GetIString:
@@ -192,7 +194,7 @@ void disassembler::dissasemble_instruction(const instruction::ptr& inst)
             inst->data.push_back(utils::string::quote(stack_->read_c_string().data(), false));
             break;
         case opcode::OP_waittillmatch:
-            inst->data.push_back(utils::string::va("%i", script_->read<std::uint8_t>()));
+            inst->data.push_back(operand::integer(script_->read<std::uint8_t>()));
             break;
         case opcode::OP_SetNewLocalVariableFieldCached0:
         case opcode::OP_EvalNewLocalArrayRefCached0:
@@ -208,7 +210,7 @@ void disassembler::dissasemble_instruction(const instruction::ptr& inst)
         case opcode::OP_CreateLocalVariable:
         case opcode::OP_EvalLocalVariableObjectCached:
         case opcode::OP_EvalLocalArrayCached:
-            inst->data.push_back(utils::string::va("%i", script_->read<std::uint8_t>()));
+            inst->data.push_back(operand::integer(script_->read<std::uint8_t>()));
             break;
         case opcode::OP_EvalSelfFieldVariable:
         case opcode::OP_SetLevelFieldVariableField:
@@ -230,7 +232,7 @@ void disassembler::dissasemble_instruction(const instruction::ptr& inst)
         case opcode::OP_ScriptChildThreadCallPointer:
         case opcode::OP_ScriptMethodThreadCallPointer:
         case opcode::OP_ScriptMethodChildThreadCallPointer:
-            inst->data.push_back(utils::string::va("%i", script_->read<std::uint8_t>()));
+            inst->data.push_back(operand::integer(script_->read<std::uint8_t>()));
             break;
         case opcode::OP_GetLocalFunction:
         case opcode::OP_ScriptLocalFunctionCall2:
@@ -307,16 +309,18 @@ void disassembler::disassemble_builtin_call(const instruction::ptr& inst, bool m
 {
     if (args)
     {
-        inst->data.push_back(utils::string::va("%i", script_->read<std::uint8_t>()));
+        inst->data.push_back(operand::integer(script_->read<std::uint8_t>()));
     }
 
     if (method)
     {
-        inst->data.push_back(resolver::method_name(script_->read<std::uint16_t>()));
+        const auto id = script_->read<std::uint16_t>();
+        inst->data.push_back(operand::id(id, resolver::method_name(id)));
     }
     else
     {
-        inst->data.push_back(resolver::function_name(script_->read<std::uint16_t>()));
+        const auto id = script_->read<std::uint16_t>();
+        inst->data.push_back(operand::id(id, resolver::function_name(id)));
     }
 }
 
@@ -324,11 +328,11 @@ void disassembler::disassemble_local_call(const instruction::ptr& inst, bool thr
 {
     std::int32_t offset = disassemble_offset();
 
-    inst->data.push_back(utils::string::va("%X", offset + inst->index + 1));
+    inst->data.push_back(operand::integer(offset + inst->index + 1));
 
     if (thread)
     {
-        inst->data.push_back(utils::string::va("%i", script_->read<std::uint8_t>()));
+        inst->data.push_back(operand::integer(script_->read<std::uint8_t>()));
     }
 }
 
@@ -338,7 +342,7 @@ void disassembler::disassemble_far_call(const instruction::ptr& inst, bool threa
 
     if (thread)
     {
-        inst->data.push_back(utils::string::va("%i", script_->read<std::uint8_t>()));
+        inst->data.push_back(operand::integer(script_->read<std::uint8_t>()));
     }
 
     auto file_id = stack_->read<std::uint16_t>();
@@ -346,35 +350,29 @@ void disassembler::disassemble_far_call(const instruction::ptr& inst, bool threa
     auto func_id = stack_->read<std::uint16_t>();
     auto func_name = func_id == 0 ? stack_->read_c_string() : resolver::token_name(func_id);
 
-    inst->data.push_back(file_name != "" ? file_name : utils::string::va("_ID%i", file_id));
-    inst->data.push_back(func_name != "" ? func_name : utils::string::va("_ID%i", func_id));
+    inst->data.push_back(operand::id(file_id, file_name != "" ? file_name : utils::string::va("_ID%i", file_id)));
+    inst->data.push_back(operand::id(func_id, func_name != "" ? func_name : utils::string::va("_ID%i", func_id)));
 }
 
 void disassembler::disassemble_jump(const instruction::ptr& inst, bool expr, bool back)
 {
-    std::int32_t addr;
-    std::string label;
+    std::uint32_t addr;
 
     if (expr)
     {
         addr = inst->index + 3 + script_->read<std::int16_t>();
-        label = utils::string::va("loc_%X", addr);
-        inst->data.push_back(label);
     }
     else if (back)
     {
         addr = inst->index + 3 - script_->read<std::uint16_t>();
-        label = utils::string::va("loc_%X", addr);
-        inst->data.push_back(label);
     }
     else
     {
         addr = inst->index + 5 + script_->read<std::int32_t>();
-        label = utils::string::va("loc_%X", addr);
-        inst->data.push_back(label);
     }
 
-    labels_.insert({addr, label});
+    inst->data.push_back(operand::label(addr));
+    labels_.insert({addr, addr});
 }
 
 void disassembler::disassemble_field_variable(const instruction::ptr& inst)
@@ -386,28 +384,27 @@ void disassembler::disassemble_field_variable(const instruction::ptr& inst)
     {   
         auto temp = stack_->read<std::uint16_t>();
         field_name = temp == 0 ? stack_->read_c_string() : std::to_string(temp);
+
+        inst->data.push_back(field_name != "" ? field_name : utils::string::va("_ID%i", field_id));
     }
     else
     {
-        field_name = resolver::token_name(field_id);
+        inst->data.push_back(operand::id(field_id, resolver::token_name(field_id)));
     }
-
-    inst->data.push_back(field_name != "" ? field_name : utils::string::va("_ID%i", field_id));
 }
 
 void disassembler::disassemble_switch(const instruction::ptr& inst)
 {
-    std::int32_t addr = inst->index + 4 + script_->read<std::int32_t>();
-    std::string label = utils::string::va("loc_%X", addr);
+    std::uint32_t addr = inst->index + 4 + script_->read<std::int32_t>();
 
-    inst->data.push_back(label);
-    labels_.insert({addr, label});
+    inst->data.push_back(operand::label(addr));
+    labels_.insert({addr, addr});
 }
 
 void disassembler::disassemble_end_switch(const instruction::ptr& inst)
 {
     std::uint16_t case_num = script_->read<std::uint16_t>();
-    inst->data.push_back(utils::string::va("%i", case_num));
+    inst->data.push_back(operand::integer(case_num));
 
     std::uint32_t internal_index = inst->index + 3;
 
@@ -430,17 +427,16 @@ void disassembler::disassemble_end_switch(const instruction::ptr& inst)
             else
             {
                 inst->data.push_back("case");
-                inst->data.push_back(utils::string::va("%i", (case_label - 0x800000) & 0xFFFFFF));
+                inst->data.push_back(operand::integer((case_label - 0x800000) & 0xFFFFFF));
             }
 
             inst->size += 4;
             internal_index += 4;
 
-            auto addr = disassemble_offset() + internal_index;
-            std::string label = utils::string::va("loc_%X", addr);
-            inst->data.push_back(label);
+            std::uint32_t addr = disassemble_offset() + internal_index;
+            inst->data.push_back(operand::label(addr));
 
-            labels_.insert({addr, label});
+            labels_.insert({addr, addr});
 
             inst->size += 3;
             internal_index += 3;
@@ -466,6 +462,14 @@ auto disassembler::disassemble_offset() -> std::int32_t
 
 void disassembler::resolve_local_functions()
 {
+    function_index_.clear();
+    function_index_.reserve(functions_.size());
+
+    for (auto i = 0u; i < functions_.size(); i++)
+    {
+        function_index_.insert({ functions_[i]->index, i });
+    }
+
     for (auto& func : functions_)
     {
         for (auto& inst : func->instructions)
@@ -480,7 +484,7 @@ void disassembler::resolve_local_functions()
             case opcode::OP_ScriptLocalChildThreadCall:
             case opcode::OP_ScriptLocalMethodThreadCall:
             case opcode::OP_ScriptLocalMethodChildThreadCall:
-                inst->data.at(0) = resolve_function(inst->data[0]);
+                inst->data.at(0) = resolve_function(inst->data[0].as_uint());
                 break;
             default:
                 break;
@@ -489,24 +493,16 @@ void disassembler::resolve_local_functions()
     }
 }
 
-auto disassembler::resolve_function(const std::string& index) -> std::string
+auto disassembler::resolve_function(std::uint32_t index) -> operand
 {
-    if (utils::string::is_hex_number(index))
-    {
-        std::uint32_t idx = std::stoul(index, nullptr, 16);
-
-        for (auto& func : functions_)
-        {
-            if (func->index == idx)
-            {
-                return func->name;
-            }
-        }
+    const auto itr = function_index_.find(index);
 
-        throw disasm_error(utils::string::va("Couldn't resolve function name at index '0x%04X'!", idx));
+    if (itr != function_index_.end())
+    {
+        return operand::function(itr->second, functions_[itr->second]->name.substr(4));
     }
 
-    throw disasm_error(utils::string::va("\"%s\" is not valid function address!", index.data()));
+    throw disasm_error(utils::string::va("Couldn't resolve function name at index '0x%04X'!", index));
 }
 
 void disassembler::print_function(const function::ptr& func)
@@ -520,7 +516,7 @@ void disassembler::print_function(const function::ptr& func)
 
         if (itr != func->labels.end())
         {
-            output_->write_string(utils::string::va("\t%s\n", itr->second.data()));
+            output_->write_string(utils::string::va("\t%s\n", operand::label_name(itr->second).data()));
         }
 
         print_instruction(inst);
@@ -536,20 +532,20 @@ void disassembler::print_instruction(const instruction::ptr& inst)
     {
     case opcode::OP_endswitch:
         output_->write_string(utils::string::va("\t\t%s", resolver::opcode_name(inst->opcode).data()));
-        output_->write_string(utils::string::va(" %s\n", inst->data[0].data()));
+        output_->write_string(utils::string::va(" %s\n", inst->data[0].str().data()));
         {
-            std::uint32_t totalcase = std::stoul(inst->data[0]);
+            std::uint32_t totalcase = inst->data[0].as_uint();
             auto index = 0;
             for (auto casenum = 0u; casenum < totalcase; casenum++)
             {
                 if (inst->data[1 + index] == "case")
                 {
-                    output_->write_string(utils::string::va("\t\t\t%s %s %s", inst->data[1 + index].data(), inst->data[1 + index + 1].data(), inst->data[1 + index + 2].data()));
+                    output_->write_string(utils::string::va("\t\t\t%s %s %s", inst->data[1 + index].str().data(), inst->data[1 + index + 1].str().data(), inst->data[1 + index + 2].str().data()));
                     index += 3;
                 }
                 else if (inst->data[1 + index] == "default")
                 {
-                    output_->write_string(utils::string::va("\t\t\t%s %s", inst->data[1 + index].data(), inst->data[1 + index + 1].data()));
+                    output_->write_string(utils::string::va("\t\t\t%s %s", inst->data[1 + index].str().data(), inst->data[1 + index + 1].str().data()));
                     index += 2;
                 }
                 if (casenum != totalcase - 1)
@@ -563,7 +559,7 @@ void disassembler::print_instruction(const instruction::ptr& inst)
         output_->write_string(utils::string::va("\t\t%s", resolver::opcode_name(inst->opcode).data()));
         for (auto& d : inst->data)
         {
-            output_->write_string(utils::string::va(" %s", d.data()));
+            output_->write_string(utils::string::va(" %s", d.str().data()));
         }
         break;
     }
@@ -0,0 +1,1343 @@
+// Copyright 2021 xensik. All rights reserved.
+//
+// Use of this source code is governed by a GNU GPLv3 license
+// that can be found in the LICENSE file.
+
+// generated by gen/resolver.py, do not edit
+
+#pragma once
+
+namespace xsk::gsc::iw6
+{
+
+constexpr std::array<std::int32_t, 38> opcode_hash_seeds
+{{
+    7, 40, 6, 2, 38, 63, 22, 347, 0, 52, 15, 347, 5, 423, 100, 244,
+    448, 417, 1, 12, 1, -153, 24, 59, 1, 610, 164, 586, 38, 75, 0, 260,
+    20, 596, 277, -1, 0, 2125,
+}};
+
+constexpr std::array<std::uint32_t, 153> opcode_hash_slots
+{{
+    40, 30, 132, 130, 4, 34, 51, 95, 45, 86, 74, 8, 105, 1, 67, 119,
+    141, 124, 12, 138, 50, 38, 35, 113, 60, 78, 75, 82, 140, 73, 108, 16,
+    32, 111, 112, 56, 31, 103, 128, 7, 79, 72, 15, 80, 131, 19, 29, 145,
+    142, 129, 127, 97, 92, 47, 37, 104, 66, 25, 133, 57, 116, 14, 2, 54,
+    61, 126, 99, 18, 21, 48, 76, 98, 102, 125, 118, 6, 46, 123, 68, 100,
+    139, 91, 5, 62, 13, 36, 23, 144, 114, 89, 117, 146, 94, 44, 10, 59,
+    11, 53, 22, 93, 85, 58, 49, 122, 55, 106, 65, 43, 24, 148, 101, 39,
+    64, 83, 107, 115, 41, 63, 90, 52, 109, 42, 17, 27, 149, 71, 81, 152,
+    87, 147, 136, 33, 137, 0, 135, 110, 9, 69, 77, 96, 84, 88, 3, 143,
+    28, 151, 134, 121, 26, 150, 20, 70, 120,
+}};
+
+constexpr std::array<std::int32_t, 151> function_hash_seeds
+{{
+    4, 7, 29, 109, 63, 3, 20, 1, 29, 58, 101, 23, -595, 8, 7, 90,
+    6, 1, 15, 197, 247, 25, 4, 22, 3, 1, -554, 3, 516, 3, 65, 156,
+    0, 5, 91, 1, 2, 1, 2, 31, 918, 60, 35, 5, 381, 7, 37, 82,
+    1, 1, -550, 3, 19, 1, 340, 172, 5, 167, -547, 1, -537, -460, 271, 1,
+    0, 217, 7, 0, 73, 46, 2, 68, 5, 0, 7, 39, 64, 2, 6, 2,
+    591, 30, -341, 126, 69, 66, 38, -322, 12, 424, 315, 182, 145, 611, 9, -256,
+    949, 59, 181, 117, 167, 1322, 1, 0, 258, 1, 339, -207, 1, 43, 4, 129,
+    37, 83, 7, 193, 58, 473, -167, 206, 525, 341, 156, 281, -151, -90, 145, 122,
+    13, 101, 268, 68, 485, 241, 458, 314, 1, 2550, 1198, 1, -66, 2424, 1, 1,
+    623, 218, 146, 828, 302, 7, 68,
+}};
+
+constexpr std::array<std::uint32_t, 605> function_hash_slots
+{{
+    584, 158, 124, 515, 182, 39, 550, 271, 70, 248, 76, 144, 573, 214, 133, 464,
+    4, 496, 239, 340, 560, 302, 520, 190, 471, 331, 165, 210, 85, 393, 162, 394,
+    322, 112, 32, 93, 498, 261, 273, 196, 46, 224, 270, 312, 106, 511, 467, 208,
+    167, 499, 179, 472, 574, 228, 83, 361, 592, 512, 57, 578, 300, 283, 125, 602,
+    303, 298, 111, 447, 357, 503, 75, 421, 479, 150, 486, 323, 325, 370, 184, 114,
+    257, 513, 556, 309, 282, 443, 41, 275, 56, 5, 483, 185, 563, 61, 531, 171,
+    415, 452, 449, 341, 43, 561, 383, 301, 176, 385, 526, 90, 48, 68, 544, 403,
+    418, 548, 528, 183, 280, 495, 384, 362, 189, 382, 587, 432, 395, 492, 229, 444,
+    372, 374, 481, 36, 420, 268, 428, 364, 253, 27, 97, 249, 543, 146, 178, 570,
+    25, 199, 285, 494, 237, 117, 188, 263, 260, 234, 191, 3, 484, 524, 424, 81,
+    545, 64, 205, 153, 505, 232, 77, 534, 540, 244, 71, 154, 24, 363, 527, 342,
+    136, 221, 115, 1, 109, 344, 523, 417, 582, 203, 33, 369, 506, 356, 320, 386,
+    147, 466, 60, 335, 121, 399, 23, 123, 20, 295, 595, 119, 96, 87, 42, 562,
+    354, 126, 389, 212, 518, 430, 522, 18, 272, 530, 159, 134, 391, 107, 95, 269,
+    201, 138, 510, 409, 604, 236, 541, 304, 243, 457, 549, 406, 547, 80, 52, 129,
+    542, 204, 230, 461, 388, 132, 294, 431, 299, 551, 284, 398, 373, 120, 339, 440,
+    59, 442, 334, 501, 338, 222, 177, 532, 565, 35, 553, 148, 478, 476, 226, 579,
+    155, 555, 552, 381, 21, 598, 240, 252, 392, 438, 601, 141, 50, 327, 557, 559,
+    426, 319, 149, 238, 215, 72, 455, 448, 140, 439, 422, 537, 318, 390, 507, 453,
+    554, 131, 289, 477, 423, 30, 332, 63, 470, 227, 86, 473, 256, 463, 297, 379,
+    69, 380, 12, 122, 53, 566, 345, 47, 348, 62, 101, 367, 197, 110, 0, 66,
+    575, 419, 462, 22, 308, 350, 231, 219, 454, 401, 200, 247, 99, 54, 102, 91,
+    429, 488, 192, 497, 343, 585, 274, 571, 586, 538, 436, 490, 225, 371, 15, 223,
+    100, 49, 105, 375, 346, 251, 2, 521, 104, 306, 220, 404, 266, 516, 143, 169,
+    157, 98, 482, 451, 568, 410, 441, 546, 84, 198, 347, 173, 434, 65, 218, 352,
+    569, 163, 485, 328, 596, 397, 589, 277, 590, 152, 281, 558, 246, 216, 310, 493,
+    78, 31, 465, 89, 366, 468, 459, 116, 58, 414, 475, 577, 8, 241, 536, 38,
+    17, 29, 11, 44, 377, 137, 580, 351, 588, 7, 581, 9, 450, 16, 276, 603,
+    108, 349, 509, 45, 504, 329, 519, 264, 469, 128, 186, 175, 591, 255, 412, 508,
+    600, 594, 207, 407, 529, 572, 533, 288, 337, 118, 311, 321, 250, 360, 168, 291,
+    487, 6, 28, 489, 151, 597, 135, 460, 245, 194, 324, 265, 293, 145, 433, 359,
+    130, 170, 365, 514, 446, 160, 26, 79, 445, 396, 315, 336, 213, 181, 55, 307,
+    161, 576, 202, 242, 195, 73, 193, 539, 292, 10, 139, 317, 425, 353, 599, 187,
+    326, 416, 74, 402, 287, 166, 278, 254, 411, 209, 456, 34, 67, 164, 51, 13,
+    593, 333, 535, 427, 142, 583, 491, 206, 567, 368, 330, 405, 500, 378, 564, 174,
+    437, 474, 267, 358, 180, 316, 211, 296, 262, 400, 290, 217, 233, 235, 480, 435,
+    156, 305, 172, 517, 502, 355, 37, 103, 458, 258, 413, 82, 313, 113, 525, 408,
+    259, 279, 88, 387, 127, 40, 286, 376, 314, 19, 94, 14, 92,
+}};
+
+constexpr std::array<std::int32_t, 266> method_hash_seeds
+{{
+    209, 130, 6, 271, 2, 284, 2, 3, 2, 16, 5, 18, 11, 2, 56, 5,
+    38, 46, 475, 67, 55, 76, 4, 20, 5, -1061, 56, -883, 550, 0, 31, 9,
+    29, 580, 442, 103, -862, 96, 1, 8, 14, 13, 66, 4, 1, 22, 79, 29,
+    1, 126, 57, 9, 4, 7, 61, 1, -762, 29, 17, 13, 1, 84, 143, 27,
+    75, -711, 1, 109, 0, 17, 68, 7, 1, 42, 5, 7, 1, 7, 323, 8,
+    548, 62, 18, 4, 4, 2, 30, 386, -472, 57, 24, 28, 20, 22, 2, 8,
+    70, 2, 4, 1, 0, 1, 2, 4, 9, 1, 5, 51, 330, 149, 2, 49,
+    96, 5, 5, 1, 34, 7, 205, 100, 55, -454, 3, 54, 143, 13, 968, 440,
+    2, 96, 54, 1, 270, 212, 617, 764, -443, 25, 4, -371, 2, 10, 5, 2,
+    7, 52, 5, 100, 3, 52, 78, 21, 519, 31, 63, 131, 45, 2, 13, 1,
+    7, 18, 22, 45, 26, 33, 32, 11, 320, 60, 156, 1, 339, 1, 25, 15,
+    308, 197, 130, 103, 1, 6, 15, 6, 2, 6, 1159, 193, 246, 619, 1, 444,
+    606, 70, 1207, 115, 79, 16, 1215, 159, 1, 563, 324, 77, 665, 959, 13, 1525,
+    685, 55, 1008, 8069, -283, 9, 4862, 24, 1, 156, 107, 181, -267, -195, 44, 333,
+    399, 46, 8, 9, 109, 577, 99, 73, 0, 123, 1114, 19, 57, 0, 2811, 190,
+    186, 10663, 14, 632, 12, 37, 7179, 40, 102, 18, 19, 706, -121, 47, 113, 294,
+    -39, 632, 357, 36, 19, 67, 19, 2024, 1412, 11,
+}};
+
+constexpr std::array<std::uint32_t, 1066> method_hash_slots
+{{
+    8, 101, 139, 368, 194, 701, 631, 154, 915, 227, 939, 1025, 603, 813, 478, 144,
+    342, 980, 546, 487, 1033, 499, 747, 28, 916, 626, 1035, 855, 384, 898, 104, 390,
+    804, 913, 244, 516, 823, 33, 406, 429, 152, 25, 172, 42, 226, 221, 166, 363,
+    888, 702, 860, 465, 27, 986, 386, 625, 664, 143, 317, 656, 870, 306, 796, 382,
+    666, 62, 536, 684, 785, 232, 947, 350, 1001, 280, 271, 992, 112, 229, 808, 575,
+    438, 419, 412, 299, 23, 778, 75, 1020, 117, 367, 609, 482, 790, 399, 719, 894,
+    312, 960, 310, 600, 1030, 270, 1038, 928, 471, 39, 639, 52, 1012, 425, 876, 504,
+    522, 769, 55, 580, 215, 528, 606, 176, 295, 1003, 109, 506, 905, 335, 21, 64,
+    885, 24, 502, 301, 908, 784, 981, 86, 509, 400, 43, 49, 818, 356, 3, 954,
+    762, 71, 309, 843, 331, 44, 977, 893, 369, 900, 496, 378, 184, 79, 994, 573,
+    332, 565, 201, 789, 681, 764, 437, 669, 239, 180, 739, 415, 1044, 932, 748, 205,
+    941, 214, 251, 865, 667, 90, 743, 464, 705, 524, 376, 698, 540, 768, 45, 866,
+    650, 690, 765, 1022, 750, 655, 456, 66, 926, 255, 931, 776, 1017, 563, 431, 918,
+    566, 1039, 661, 979, 840, 83, 138, 349, 680, 653, 168, 1063, 133, 697, 642, 159,
+    102, 405, 945, 265, 119, 657, 517, 185, 689, 234, 984, 761, 877, 77, 873, 914,
+    1060, 633, 659, 175, 1014, 479, 798, 174, 240, 886, 348, 788, 177, 281, 589, 767,
+    864, 920, 643, 106, 458, 195, 775, 4, 1057, 427, 300, 451, 568, 718, 693, 749,
+    1024, 526, 620, 685, 816, 30, 353, 88, 551, 305, 289, 216, 952, 426, 871, 85,
+    709, 16, 337, 385, 250, 165, 951, 294, 35, 274, 1045, 248, 58, 835, 574, 404,
+    786, 1021, 354, 982, 224, 507, 493, 596, 569, 82, 1065, 975, 292, 377, 717, 381,
+    18, 293, 897, 272, 962, 374, 273, 510, 421, 1046, 187, 605, 302, 590, 836, 196,
+    247, 448, 249, 623, 561, 799, 801, 637, 339, 711, 602, 1053, 223, 956, 209, 142,
+    1004, 414, 777, 442, 470, 372, 887, 163, 630, 288, 521, 115, 491, 582, 183, 203,
+    435, 736, 704, 583, 322, 756, 307, 854, 352, 940, 473, 695, 668, 191, 252, 59,
+    1059, 97, 193, 682, 78, 1047, 934, 802, 998, 950, 892, 619, 313, 923, 423, 791,
+    108, 461, 683, 679, 741, 50, 1034, 649, 277, 74, 774, 441, 284, 2, 160, 607,
+    814, 436, 171, 264, 13, 134, 99, 91, 644, 595, 967, 359, 1, 963, 246, 391,
+    660, 189, 346, 641, 648, 398, 316, 753, 120, 1036, 936, 880, 254, 937, 282, 987,
+    687, 904, 847, 929, 712, 729, 315, 972, 834, 1018, 525, 188, 523, 548, 455, 751,
+    475, 308, 1056, 617, 149, 80, 727, 351, 674, 103, 828, 130, 5, 283, 810, 207,
+    651, 413, 628, 1048, 985, 76, 0, 116, 911, 757, 424, 140, 686, 991, 122, 472,
+    584, 608, 671, 645, 489, 22, 636, 856, 236, 795, 944, 32, 263, 807, 370, 208,
+    996, 604, 520, 179, 488, 550, 401, 453, 94, 498, 811, 535, 515, 1043, 531, 792,
+    955, 164, 662, 1010, 1007, 136, 417, 303, 1040, 220, 73, 450, 611, 969, 511, 1051,
+    613, 268, 260, 218, 420, 508, 512, 672, 1006, 147, 53, 703, 722, 256, 883, 228,
+    829, 800, 31, 409, 723, 259, 581, 326, 755, 1041, 241, 67, 17, 449, 909, 744,
+    612, 634, 912, 364, 572, 632, 114, 824, 93, 710, 1029, 6, 529, 358, 819, 533,
+    325, 186, 500, 1009, 484, 206, 371, 841, 553, 779, 1027, 1005, 658, 446, 181, 298,
+    874, 853, 587, 542, 833, 1015, 304, 60, 494, 291, 157, 121, 278, 978, 211, 100,
+    173, 699, 554, 333, 919, 547, 261, 577, 12, 495, 430, 826, 726, 721, 627, 476,
+    440, 338, 556, 1011, 597, 760, 96, 708, 1062, 820, 591, 29, 156, 361, 135, 745,
+    783, 537, 610, 297, 557, 463, 973, 948, 14, 327, 830, 995, 490, 365, 95, 730,
+    706, 787, 957, 692, 544, 638, 691, 200, 958, 890, 545, 925, 614, 514, 146, 949,
+    334, 397, 738, 344, 677, 480, 592, 676, 752, 118, 483, 707, 422, 571, 902, 89,
+    794, 688, 262, 320, 81, 124, 433, 477, 253, 276, 1026, 68, 72, 1019, 665, 858,
+    970, 387, 966, 562, 311, 942, 869, 555, 11, 447, 366, 492, 113, 219, 123, 497,
+    126, 933, 731, 621, 825, 968, 812, 728, 257, 169, 513, 411, 269, 601, 403, 267,
+    279, 746, 827, 889, 716, 549, 162, 534, 235, 444, 190, 388, 198, 1013, 578, 519,
+    481, 204, 469, 842, 151, 392, 654, 56, 585, 217, 111, 670, 759, 373, 875, 715,
+    906, 36, 128, 576, 737, 616, 287, 92, 1037, 845, 153, 428, 1058, 696, 872, 1008,
+    199, 197, 857, 137, 19, 559, 243, 560, 773, 803, 831, 910, 675, 63, 345, 46,
+    343, 468, 34, 821, 148, 167, 347, 107, 924, 383, 501, 454, 141, 983, 805, 766,
+    266, 527, 51, 225, 330, 375, 974, 946, 328, 782, 838, 647, 629, 150, 742, 286,
+    990, 586, 222, 943, 182, 434, 959, 285, 9, 961, 155, 846, 567, 538, 314, 953,
+    460, 178, 323, 7, 237, 878, 793, 1061, 439, 539, 859, 558, 474, 543, 1049, 393,
+    599, 615, 318, 663, 879, 640, 407, 408, 849, 230, 486, 848, 20, 772, 564, 329,
+    1031, 61, 899, 340, 161, 901, 868, 882, 598, 467, 518, 964, 758, 733, 158, 105,
+    837, 965, 1052, 1028, 922, 321, 70, 1016, 65, 780, 541, 26, 530, 319, 47, 917,
+    37, 862, 673, 41, 125, 552, 997, 891, 635, 771, 588, 1064, 362, 192, 844, 579,
+    593, 976, 861, 700, 863, 145, 355, 735, 1002, 290, 988, 466, 850, 734, 1023, 170,
+    781, 839, 379, 402, 10, 740, 646, 275, 131, 452, 694, 754, 1032, 1055, 87, 1050,
+    971, 652, 324, 394, 809, 245, 410, 817, 380, 296, 443, 884, 720, 360, 678, 242,
+    462, 532, 907, 999, 1000, 725, 724, 852, 48, 129, 832, 989, 770, 921, 210, 927,
+    84, 233, 457, 815, 98, 57, 357, 459, 903, 938, 341, 570, 713, 485, 714, 867,
+    54, 132, 231, 622, 618, 15, 1042, 935, 213, 212, 505, 896, 238, 895, 258, 396,
+    127, 336, 395, 69, 1054, 445, 432, 797, 503, 416, 110, 763, 389, 732, 993, 202,
+    851, 930, 624, 594, 822, 40, 418, 38, 881, 806,
+}};
+
+constexpr std::array<std::int32_t, 207> file_hash_seeds
+{{
+    14, 152, 9, 30, 200, 3, 6, 45, 25, 6, 1, 63, 0, 174, 4, 2,
+    1, 1, 33, 70, 13, 223, 18, 60, -741, 36, 184, 30, 105, 28, 4, 164,
+    354, 867, 3, 6, 3, 1, 126, 8, 21, 35, 240, 19, 7, 1, 81, 651,
+    12, 15, 6, 4, 1, 9, 13, 3, 294, 305, 6, -315, 146, 3, 6, 52,
+    169, 63, 126, 13, 1, 17, 3, 11, 175, 9, 7, 17, -278, 8, 1, 13,
+    15, 331, 4, 190, 70, -259, 8, 22, 12, 15, 14, 3, 7, 1, 8, 1,
+    40, 440, 159, 24, 489, 35, 20, 17, 27, 95, 162, 34, -221, 43, 202, 4,
+    207, 17, 159, 3, 357, 317, 99, 136, 138, 11, 84, 11, 1279, 15, 23, 1,
+    226, 679, 130, -195, 2, 9, 1, 62, 257, 5, 4, 70, 240, 0, 603, 68,
+    22, 4, 242, 1338, 8, 1149, 217, 292, 3, 48, 169, 1002, 35, 243, 1, -125,
+    1, 7, 165, 5, 27, 476, 1153, 14, 74, 1605, 2, 14, 1, 1, 13, 760,
+    19, 4756, 52, 3431, 133, 1, 1318, 55, 65, 1, 11, 92, 74, 511, 14, 1332,
+    353, 185, 158, 33, 4125, 347, 12, 1, 7, 85, 298, 327, -121, 4041, 4819,
+}};
+
+constexpr std::array<std::uint32_t, 831> file_hash_slots
+{{
+    468, 151, 753, 51, 806, 414, 658, 174, 740, 491, 432, 374, 278, 156, 545, 449,
+    749, 746, 67, 440, 239, 370, 99, 168, 583, 573, 217, 572, 303, 696, 446, 762,
+    309, 86, 526, 438, 809, 546, 243, 461, 506, 734, 731, 209, 8, 252, 321, 238,
+    752, 697, 597, 439, 379, 107, 451, 484, 245, 788, 558, 341, 320, 193, 538, 249,
+    747, 563, 680, 192, 1, 471, 702, 406, 311, 675, 611, 671, 163, 388, 769, 215,
+    294, 381, 77, 59, 745, 592, 183, 826, 704, 9, 827, 189, 318, 26, 682, 771,
+    121, 559, 605, 776, 305, 4, 617, 523, 540, 273, 155, 593, 391, 293, 93, 80,
+    485, 765, 329, 466, 208, 131, 549, 513, 643, 467, 596, 603, 75, 350, 145, 3,
+    585, 407, 416, 478, 81, 173, 435, 656, 422, 109, 352, 442, 824, 42, 79, 200,
+    722, 399, 133, 44, 327, 30, 87, 500, 82, 508, 727, 751, 665, 450, 729, 182,
+    712, 437, 236, 136, 570, 644, 758, 297, 672, 46, 21, 117, 142, 483, 284, 564,
+    223, 430, 642, 153, 346, 529, 744, 586, 359, 521, 654, 72, 405, 116, 607, 619,
+    431, 783, 68, 716, 434, 17, 674, 582, 232, 803, 111, 396, 497, 488, 481, 577,
+    106, 241, 676, 347, 184, 326, 7, 16, 767, 800, 127, 18, 188, 287, 295, 519,
+    280, 536, 459, 609, 420, 561, 400, 486, 706, 411, 503, 100, 393, 386, 741, 27,
+    429, 204, 282, 144, 166, 426, 124, 517, 409, 502, 782, 447, 453, 496, 334, 427,
+    820, 253, 12, 325, 505, 323, 815, 165, 792, 428, 316, 373, 830, 389, 375, 199,
+    28, 504, 196, 247, 433, 312, 211, 194, 626, 715, 791, 516, 444, 50, 37, 302,
+    158, 198, 268, 134, 104, 225, 547, 351, 135, 299, 759, 699, 589, 254, 701, 64,
+    571, 718, 518, 213, 169, 404, 828, 73, 560, 69, 542, 335, 772, 645, 368, 363,
+    695, 580, 711, 31, 632, 543, 797, 465, 498, 641, 202, 639, 579, 436, 469, 525,
+    599, 148, 220, 139, 14, 777, 615, 738, 369, 464, 356, 556, 274, 794, 218, 271,
+    54, 110, 574, 480, 659, 591, 419, 366, 263, 285, 53, 514, 413, 710, 154, 377,
+    687, 219, 43, 248, 29, 568, 700, 210, 230, 616, 620, 35, 34, 684, 735, 333,
+    354, 296, 257, 472, 448, 33, 487, 226, 61, 353, 332, 541, 180, 655, 423, 161,
+    612, 314, 470, 187, 507, 673, 818, 105, 262, 392, 65, 595, 707, 152, 443, 395,
+    380, 784, 576, 417, 143, 349, 259, 276, 78, 120, 805, 623, 796, 146, 567, 569,
+    292, 584, 385, 322, 125, 63, 88, 15, 786, 398, 606, 494, 647, 685, 224, 237,
+    250, 214, 304, 38, 36, 358, 244, 531, 246, 71, 829, 408, 725, 149, 102, 821,
+    394, 819, 201, 383, 355, 371, 748, 689, 760, 688, 362, 462, 91, 171, 618, 633,
+    524, 147, 85, 686, 298, 636, 108, 736, 96, 717, 290, 291, 721, 578, 397, 57,
+    367, 126, 608, 233, 382, 343, 272, 795, 56, 235, 613, 55, 206, 602, 275, 822,
+    384, 13, 690, 652, 348, 266, 123, 724, 501, 823, 810, 730, 764, 186, 286, 203,
+    720, 640, 52, 719, 185, 692, 492, 25, 766, 331, 460, 604, 197, 581, 817, 621,
+    554, 344, 669, 637, 256, 337, 813, 667, 624, 424, 222, 775, 441, 289, 269, 177,
+    97, 90, 457, 345, 94, 410, 70, 58, 221, 650, 726, 587, 530, 231, 610, 635,
+    528, 773, 622, 705, 532, 279, 339, 648, 739, 598, 167, 191, 816, 474, 811, 590,
+    6, 0, 190, 651, 301, 662, 40, 594, 103, 601, 376, 631, 364, 763, 456, 614,
+    754, 733, 212, 785, 737, 779, 308, 663, 565, 207, 140, 495, 84, 41, 793, 627,
+    288, 48, 20, 115, 649, 141, 555, 539, 750, 300, 709, 319, 698, 575, 62, 365,
+    178, 132, 251, 801, 22, 490, 283, 119, 790, 732, 693, 780, 281, 306, 548, 313,
+    770, 808, 798, 537, 23, 227, 32, 24, 473, 315, 664, 179, 402, 76, 261, 265,
+    535, 804, 2, 317, 455, 160, 657, 625, 638, 101, 83, 324, 553, 60, 787, 92,
+    10, 342, 181, 328, 812, 128, 713, 112, 778, 425, 159, 668, 533, 714, 157, 255,
+    515, 310, 162, 511, 742, 562, 421, 45, 512, 150, 98, 789, 757, 387, 277, 489,
+    588, 566, 412, 774, 170, 5, 493, 527, 114, 678, 445, 129, 95, 743, 418, 130,
+    270, 600, 458, 454, 19, 814, 378, 522, 703, 74, 267, 557, 475, 357, 679, 630,
+    49, 403, 47, 825, 629, 482, 240, 372, 799, 756, 723, 122, 89, 452, 683, 39,
+    336, 677, 137, 691, 228, 390, 479, 634, 544, 807, 264, 768, 666, 260, 175, 463,
+    802, 258, 242, 66, 330, 360, 361, 195, 338, 781, 670, 229, 708, 205, 551, 755,
+    653, 307, 401, 415, 11, 694, 509, 234, 661, 520, 164, 646, 476, 172, 176, 340,
+    628, 660, 681, 550, 534, 118, 552, 216, 510, 499, 138, 728, 761, 477, 113,
+}};
+
+constexpr std::array<std::int32_t, 3454> token_hash_seeds
+{{
+    80, 115, -13810, 1, 16, 1, -13729, 8, 1, 4, 0, 94, 47, 116, 6, 21,
+    14, 12, 52, -13726, 1, 16, -13698, 7, 1, 19, -13585, 2, 5, 1, -13584, 140,
+    41, 11, 2, 11, 2, 39, 98, -13535, 117, 1, 310, 17, 40, -13474, 37, 1,
+    7, 2, 27, 78, 3, 5, 45, 32, 116, 147, 40, 2, 68, 1, 39, 2,
+    2, -13433, 46, 1, 8, 1, 33, 33, 3, 3, 5, 6, 3, 0, 32, 82,
+    1, 23, 18, 65, -13331, -13217, 7, 4, 4, 100, 24, 11, 23, 52, 1, 18,
+    404, 286, 103, 9, 4, 4, 0, -13214, 3, -13192, 1, 31, 8, -13189, 24, 47,
+    39, 66, 6, 93, 8, 8, 7, 0, 14, 341, 8, 1, 1, 2, 0, 3,
+    3, 177, 29, 2, 4, 0, 2, 4, 1, 1, 1, 2, 182, 45, -13104, -12993,
+    4, 7, 110, 7, 130, 17, 5, 122, 1, 5, 2, -12872, 1, 13, 1, 1,
+    -12788, 85, 21, 1, 23, 1, 8, 2, 190, 88, 25, 2, 141, 8, 8, 10,
+    340, 3, 1, 516, 4, 214, 97, 194, 17, 78, 254, 72, 1, 28, 325, 27,
+    18, 29, 7, 10, 28, 7, 128, 31, 71, -12775, 28, 13, 1, 43, 43, 16,
+    8, 14, 5, 42, -12725, 195, 5, 187, 7, 2, 6, 40, 1, 21, 5, 3,
+    75, 164, -12534, 54, 6, 3, 23, 72, 90, 101, 22, 42, 1, 3, 124, 49,
+    112, 1, 3, 8, -12500, -12485, 1, 15, 5, 16, 78, 2, 91, 2, 50, 22,
+    17, 123, 24, 43, 23, 8, -12451, 3, 3, 4, 1, 3, 11, 16, -12308, 65,
+    1, 0, 45, 2, 1, 196, 8, 5, 218, 40, 17, 4, 9, 81, 257, 2,
+    32, 33, 9, 8, 19, 149, 16, 5, 33, 12, 147, 7, 1, 53, -12187, 50,
+    1, 13, 47, 9, 58, 4, 3, 3, 6, 8, 6, 2, 86, 3, 2, 6,
+    152, 67, -12078, 7, 26, 108, -11988, 2, 1, 3, 3, 16, 51, 44, 65, 302,
+    1, 15, 5, 10, 10, 25, 1, 2, 5, 39, 10, 105, 8, -11938, 3, 7,
+    277, 3, 12, 4, 150, -11847, 19, 69, 9, 86, 1, 0, 2, 130, 240, 1,
+    -11838, 14, 3, 19, 1, 15, 185, 101, 3, 124, 6, 32, 109, 4, 7, 81,
+    4, 1, 1, -11820, 10, 7, 135, 27, -11766, 164, 9, 1, -11750, -11694, 10, 293,
+    1, 4, 6, 11, 5, 103, 101, 18, 6, 315, -11639, 94, 37, 55, 2, 37,
+    75, 2, 31, 300, 44, 1, 10, 27, 5, 12, 2, 23, 10, 205, 243, 1,
+    246, 95, 1, 90, 888, -11574, 1, -11503, -11501, 6, 245, 298, 2, -11461, 162, 15,
+    1, 4, 30, 76, 6, -11455, 3, 1, 3, 276, 209, 45, -11438, 38, 891, 10,
+    -11425, 59, 270, 6, 7, 144, 11, 63, 5, 44, 21, 21, 45, 135, 22, 30,
+    140, 17, 9, 1, 21, 20, 275, 6, -11240, -11194, -11165, 15, 1, 4, 157, 8,
+    7, 43, 90, 30, 3, 144, 2, 33, 4, 95, 77, 53, -11152, 6, 9, 33,
+    -11112, 4, 68, 2, 18, 91, 154, 0, 56, 7, 6, 15, 1, 11, 5, 245,
+    2, 7, 1, 13, 41, 2, 3, 1, 83, 17, 1, 5, 257, 281, 45, -11020,
+    1, -10966, 3, 136, 1, 10, 2, 39, 414, 6, 44, 169, 105, 5, 5, 8,
+    11, 65, 24, 46, 20, -10939, 8, -10855, 21, 22, 18, 11, 8, 15, -10649, 1,
+    -10607, -10461, -10407, 128, 89, 4, 2, 43, 41, 2, 1, 1, 13, 2, 393, 17,
+    16, 15, 5, 2, 1, 128, 1, 1, 267, -10395, 2, 10, 5, 12, 9, 40,
+    20, 1, 3, 247, 10, 1, -10333, 18, 6, 374, 4, 86, 6, -10311, 8, 10,
+    37, 5, 5, 3, 116, 1, 1, 16, 2, 306, 1, 51, 4, 3, 26, 31,
+    9, 95, 78, 131, 145, 2, 17, 2, 0, 201, 71, 59, 1, 1, 1, 2,
+    4, 192, 37, 75, 64, 13, 3, 1, 443, 2, 79, 6, 248, -10295, 11, 177,
+    29, 71, 9, 34, 1, 6, 46, 200, 26, 2, -10242, 1, 12, 13, 1, 16,
+    119, 184, 40, 1, 23, 4, 16, 3, 5, 7, 42, 8, 4, 434, 188, 1,
+    1, 18, 3, 16, 12, 9, 11, 84, 103, 75, 1, 48, 26, 22, 10, 13,
+    -10207, 104, 12, 28, 3, 30, 152, 2, 1, 113, 2, 30, 305, 1, 1, 70,
+    47, 464, 44, 17, 98, 497, 1, 1, 10, 145, 0, 31, 8, 5, 1, 37,
+    518, 18, 2, 11, 3, 173, -10197, 4, 98, 124, 2, 9, 59, 60, 122, 142,
+    6, 26, 67, 307, 87, 260, 26, 33, 233, 18, 1, 2, 29, 18, 0, 9,
+    5, 69, 22, 10, 71, 15, 113, 7, -10196, 14, 59, 4, 4, 5, 120, 229,
+    37, 116, 132, 1, 1, 11, 181, 2, 50, 45, 282, 16, 16, 49, 167, 49,
+    4, 4, 27, 49, 7, 157, 148, 1, 123, 4, 3, 1, 68, 27, 74, 257,
+    4, 240, 147, 447, 6, 184, 35, 49, 2, 84, 1, 66, 15, 8, 7, 37,
+    69, 26, 10, 7, 65, 1, 22, 9, 12, 28, 5, 243, 2, 4, 53, 42,
+    76, 93, 91, 58, 8, 2, 8, 38, 10, 0, -10124, 52, -10086, 6, 13, 31,
+    39, 3, 1, 44, 23, 162, 4, 119, 76, 130, 91, 19, 14, 59, 12, 240,
+    0, 1, -10062, 36, 0, 1, 6, 6, 5, 90, -10029, 46, 6, 5, 43, 61,
+    12, 160, 3, -10018, 11, 68, 3, 1, 4, 33, 158, 3, -9995, -9993, 14, 8,
+    79, -9964, 683, 106, 137, 86, 410, 49, -9963, 183, 5, 3, 39, 10, -9919, 21,
+    10, 9, 23, 59, 20, 1, 0, 26, -9799, 4, 3, 135, 2, 61, 67, 28,
+    356, 40, 62, 1, -9797, 1, 379, 49, 0, 203, 2, 29, 3, 377, 2, 37,
+    50, 284, -9721, 3, 4, 43, 20, 35, 16, -9716, 115, 198, 74, 36, 3, 6,
+    4, 1, 4, 40, 275, 10, 1, 23, 14, 20, 65, 2, 72, 1, 179, 195,
+    15, 313, 1, 13, 170, 9, 9, 147, -9664, 320, 14, -9612, 2, 1, -9596, 60,
+    14, 85, 2, 2, 15, 27, 199, 969, 47, 2, 4, 18, -9561, 0, 81, 1,
+    130, 22, 157, 140, 37, 3, 81, 392, 25, 1, 1, 393, 13, 1, 143, 3,
+    73, 21, 7, 605, 4, 1, 32, 653, -9546, 42, 1, 14, 12, 2, 31, 98,
+    1, 3, 1, 6, 2, 68, 396, 36, 19, -9403, 2, 12, 14, 94, 21, 158,
+    15, 42, 15, -9399, 4, 48, 25, 62, -9353, 12, 41, 9, -9324, 95, 3, 1,
+    143, 97, 21, 93, 48, 0, 590, 15, 140, 11, 54, 218, 148, 91, 368, 2,
+    -9181, 19, 21, 206, 3, 22, 1, 34, 118, 22, 33, 7, 10, 78, 32, 33,
+    1, 1, 47, 4, 11, 35, 1, 1, 105, 2, 12, 24, 14, 1, 23, 12,
+    8, 1, 1, 142, 30, 3, 2, 8, 19, 27, 86, 1, 1, 195, 29, -9001,
+    31, 1, 113, 3, 45, 16, 11, 3, 16, 4, 10, 118, 10, 5, 32, 90,
+    70, 31, 170, 19, 12, 53, 0, 82, 68, 337, 5, 23, 3, 58, 76, 56,
+    0, 84, -8974, 40, 21, 24, 7, -8960, 13, 1, 33, 66, 6, 31, 62, 238,
+    3, 15, 23, 4, 30, 1, 50, 1, 51, 2, 10, 13, 10, 49, 19, 325,
+    131, 99, 5, -8908, 14, 23, 30, 13, 39, 200, -8873, 62, 2, 173, 78, 282,
+    -8803, 1, 57, 28, 734, 67, 131, 6, 27, 171, -8661, 2, 157, 11, -8652, 92,
+    83, 488, 246, 26, -8628, 1, 27, 2, 45, 35, 27, -8497, 122, 2, 3, 41,
+    53, 208, 1, 12, 292, 9, 8, 4, 10, 20, 18, 19, 30, 173, 2, 71,
+    36, 17, 18, 27, 1, 41, 28, 25, 95, -8359, 35, 1, 484, 158, 11, -8199,
+    9, 58, 89, -8101, 8, 17, 1, 17, 19, 72, 3, 2, 547, 228, 2, 18,
+    29, 1, 35, 19, 162, 189, 63, 43, 37, 196, 45, 75, 293, 18, 77, -8054,
+    42, 116, 18, 294, 211, 12, 18, 59, 5, 5, 6, 120, 11, -8020, 141, 2,
+    8, 59, 115, 114, 37, 69, 80, 5, 35, 1, 11, 9, 64, 322, 1, -7990,
+    232, 11, 116, -7988, 28, 22, 28, 31, 49, 13, 56, 22, 283, 41, 65, 3,
+    14, 113, 6, 7, 20, 52, 91, 29, 149, 7, 9, 6, 164, 142, -7930, -7872,
+    9, 2, 129, 566, 3, 233, 15, 55, 12, 23, 23, 48, 152, -7824, 8, 112,
+    15, 4, 26, -7799, 19, 109, 3, 33, 39, 5, 2, 26, 7, 9, 190, 27,
+    16, 30, 78, 0, 248, 1, 1, 7, 55, 257, 112, 13, 268, -7786, 2, 239,
+    8, 26, 18, 29, 4, 3, 17, 57, 489, 11, 8, 21, 0, 127, 2, 1,
+    143, 158, 116, 2, 48, 3, 33, 148, 67, -7652, 37, 13, 6, 3, 16, 1,
+    6, 15, 42, -7628, 6, 1, 10, 1, 11, 3, 1, 33, 0, 187, 15, 12,
+    1, 25, 254, 30, 161, 104, 148, 44, 11, 1, 230, 12, 11, 6, 346, -7627,
+    388, 6, 2, 25, 7, 45, 10, 35, 26, 512, 663, -7613, 41, 2, 11, 13,
+    7, 95, 70, 1, 30, 158, 508, 39, 10, 39, 724, 212, 7, 737, 21, 18,
+    3, 141, 6, 111, 20, 490, 153, 109, 108, 197, 335, 4, 193, 21, 12, 995,
+    13, 41, 151, 108, 14, 656, 82, 9, 320, 364, -7547, 2, 273, 46, 78, 584,
+    178, 68, 88, 142, 68, 60, 7, 5, 7, 2, 4, 205, 731, 14, 1, 3,
+    521, 2, 28, 213, 16, 548, 46, 298, 4, 9, 57, 21, 16, 1, -7484, 71,
+    267, 1, 337, 46, 184, 5, 15, 5, 1, 3, 36, 6, 20, 23, 31, 7,
+    238, 354, 29, 61, 13, 17, 32, 5, 120, 507, 94, 7, 13, 223, 755, 1,
+    77, 219, 233, 26, 52, 456, 3, 148, 23, 226, -7379, 144, 30, -7315, 37, 160,
+    22, 315, 60, 2, 1, 99, 826, 106, 7, 6, 12, 72, 6, 97, -7219, 7,
+    -7146, 6, 205, 52, 288, 3, 70, 21, 162, 3, 98, 159, 10, 3, 67, 35,
+    297, 114, 98, 5, 12, 842, 835, 1, 57, 788, 12, 2, 17, 67, 131, 8,
+    2, 80, 4, 52, 1, 3, 33, 1, 588, 128, 3, 122, 11, 145, 446, 213,
+    65, 96, 218, 43, 30, 158, 29, 21, 30, 1, 120, 93, 47, 14, 1, 67,
+    4, 713, 179, 3, 70, 56, 5, 85, 4, 144, 7, 352, 2, 106, 2, 22,
+    78, 134, 33, 246, 26, 6, 0, 3, 52, 3, 41, 160, 314, 3, 2, 5,
+    13, 42, 17, 4, 69, 618, 112, 1, 79, 8, 28, 98, 148, 6, 536, 225,
+    722, 19, 169, 7, 31, 294, 1, 1, 69, 10, 1, 3, 3, 27, 84, 1,
+    197, 1, 1, 12, 2, 108, 55, 15, 227, 5, 0, 3, 30, 4, 174, 40,
+    -7116, 33, 420, 19, 111, 117, 6, 4, 1, 35, 58, 27, 1, 1204, 347, -7042,
+    74, -7024, 62, 13, 5, 263, 262, 10, 206, 23, 11, 14, 1, 273, 95, 189,
+    7, 336, -6970, 303, 57, 248, 3, 69, 13, 63, 5, 10, 112, 0, -6851, 58,
+    141, 452, 172, 49, 2, 110, 10, 4, 20, 17, 116, 162, 223, 2, 235, 22,
+    2, 59, 1, 7, 1, 274, 18, 1173, 388, 35, 52, 319, 105, 1, 105, 1,
+    1, 105, 3, 16, 1, -6798, -6788, 77, 245, 35, 15, 28, 1, 5, 196, 84,
+    25, 145, 123, -6771, 195, 137, 38, 31, 9, 536, 2, -6609, 8, 28, 518, -6592,
+    7, 15, -6520, 72, 21, 16, 372, 0, 134, 34, 1, 20, 1, 50, 162, 3,
+    169, 4, 94, 6, 41, 166, 1, 16, 295, 38, 34, 385, 5, 21, -6461, 45,
+    77, 476, 1, -6308, 114, -6278, -6247, 391, 336, 1, 7, 32, 29, 639, 91, -6223,
+    -6173, 1365, 113, 40, 5, -6157, 656, 377, 11, -6148, 274, 9, 3, 28, 0, 816,
+    1, 63, 789, 33, 9, 352, 16, 300, 0, 105, 3, 103, 711, 8, 178, -6097,
+    966, 64, -5952, 10, 1, 684, 187, 130, 0, 39, 7, 290, 788, 517, 95, -5950,
+    1, 19, 10, 674, 17, 1010, 2, 102, 23, -5878, 1, 71, 6, 37, 1, 43,
+    70, 9, 96, 7, 2, 16, 10, 7, 196, 1394, 8, 195, 185, 524, 22, 20,
+    54, 33, 265, 67, 20, 26, 16, 238, 3, 66, 1, 3, 482, 403, 5, 83,
+    78, -5868, 12, 841, 42, 28, 310, 1, 56, 479, 30, 70, 425, -5867, 8, 113,
+    -5862, 0, 165, 10, 151, 33, 151, 91, 11, 10, 393, 223, 133, 1, 241, 1618,
+    60, 69, 2, 50, 428, 435, 235, 233, 44, -5797, 2, 61, 48, 6, 28, 1030,
+    125, 438, 1, 1, 84, 1, 5, 4, 8, 134, 188, 7, 10, -5700, 2, 134,
+    374, 5, 4, 30, 12, 136, 9, 7, 993, 32, 63, 18, 5, 28, 58, 207,
+    0, 2630, 73, 23, 88, 1, 1, 40, 0, 1, 209, 66, -5656, 3, 1, 793,
+    22, 1194, 1, 6, 7, 11, 29, 61, 112, 36, 64, -5618, 300, 23, 207, 1,
+    1, 181, -5588, 32, 103, 66, 1, 252, 343, 982, 16, 80, -5581, 11, 456, 28,
+    8, 38, 59, 405, 191, 728, 106, 1, 107, 95, 9, 1, 551, 10, 6, 27,
+    146, 3, 258, 10, 335, 110, 36, 38, 18, 11, -5491, 56, 1, 2, 17, 31,
+    4, 68, 957, 39, 33, -5232, 3, 26, 14, 24, 58, 223, 3, 719, 324, 47,
+    1507, 1439, 34, 11, 310, 788, 252, 4, 84, 365, 53, 38, 92, 8, 2, 462,
+    798, -5160, 31, 336, 93, 228, -5150, 93, 194, 2, 17, -5147, 339, 48, 693, 166,
+    77, 2, 13, 76, 9, 22, 5, 368, 467, 563, 6, 396, 59, 300, -5024, 1,
+    141, 1025, 269, 1, 420, 74, 65, 202, 402, 4, 84, 6, 1, 30, 3, 278,
+    177, 1, 1, 30, 195, 25, 21, -5019, 1, 9, 265, 758, 613, 0, -5002, 212,
+    34, 97, -4979, 81, -4700, 183, 101, 347, 3, 25, 1, 27, 1, 10, 16, 518,
+    20, 2, 19, 6, 1174, 47, 152, 4, 192, 2, 408, 18, 553, 205, 11, 137,
+    4, 55, 1, 73, 117, 64, 1, 116, 44, 769, 34, 0, 130, 14, 13, 6,
+    -4634, 27, 223, 356, 762, 4, 122, 2, 234, 64, 2202, 61, 2, 202, -4628, 4,
+    477, -4582, 1, 182, 11, 18, 497, 25, 1667, 267, 442, 743, 22, 327, 225, 236,
+    3, 1273, 974, 22, 14, 365, 155, 442, 680, 2, 3, 30, 1, 91, 45, 573,
+    3, 1018, 15, 100, 239, 62, 76, 441, 160, 211, 182, 382, 9, 803, 66, 168,
+    144, -4577, 1537, 15, 195, 178, 134, 44, 217, 1199, 66, 732, 41, 73, 14, 0,
+    464, 52, 1130, 234, 51, 211, 1083, 26, 53, 6, 143, 281, 5, 3, 18, 1018,
+    1188, 1328, -4527, 2, 96, 480, 82, 1, 109, 0, 641, 0, 0, 23, 18, 537,
+    22, 447, 43, 11, 1977, 118, 46, 32, 19, 0, 38, 2, 32, 24, 722, 64,
+    19, 218, 14, 39, 1, 323, 160, 0, 272, 6, 13, 32, 421, 981, 39, 158,
+    241, 7, 13, 719, -4441, 11, -4295, 1528, 6, 116, 809, 104, 298, 1, 1812, 155,
+    1, 18, 519, 43, 87, 18, 568, 77, 116, 1031, 612, 7, 18, 300, 28, 27,
+    8, 29, 20, 2, -4281, 10, 324, 581, 2, 1, 456, 1226, 238, -4233, 64, 398,
+    1243, 138, 7, 1063, 0, -4229, 300, 29, -4214, 13, 6, 4, 18, 270, 336, 356,
+    22, 915, -4083, 311, 18, 101, 69, 2, 1, 159, 954, 3031, 2, 4, 957, 4,
+    189, 220, -4051, 470, 16, 14, 3, 437, 6, 1032, 0, 364, 315, 73, 31, 38,
+    54, 18, 2, 219, 770, 3, 1185, 88, -3984, 166, 47, 264, 309, 1, 85, 1673,
+    1, 21, -3974, -3963, 18, 1152, 34, 650, 158, 189, 67, 344, 1653, 516, 834, 2,
+    43, 348, 20, 7, 22, 17, 191, 92, 43, 22, 144, 148, 17, 3, 66, 1,
+    1, 219, 1049, 4, 77, 153, 64, 111, 229, 1506, 17, 94, -3446, 1941, 1373, 134,
+    2012, 243, 2, 116, 1639, 1, 13, 12, 3, 6, 32, 33, 4, 1533, 260, 2072,
+    117, -3301, 123, 88, 4, 3, 139, 168, 24, 14, 1, 10, 1005, 457, 84, 187,
+    -3259, 52, 828, 97, 283, 236, 2, 460, 3, 114, 2, 646, 7, 1262, 908, 5,
+    -3237, 82, 3, 40, 27, 662, 7, 37, 83, 49, 21, 186, 1, 21, 13, 19,
+    179, 30, 170, 20, 142, 285, 0, 54, 1366, 51, 309, 37, 304, 1535, 31, 6,
+    0, 388, -3199, 1, 1054, 54, 154, -3120, 0, 47, 2, 260, 92, 7, 1317, 189,
+    77, 568, 255, 22, 1, 8, -3002, 17, 213, 108, -2985, 148, 58, 235, 536, 173,
+    3, -2882, -2740, 18, 2, 0, 143, 41, 58, 819, 665, 432, -2661, 1869, -2636, 693,
+    3, 1010, 279, 1878, 2292, 9, 17, 46, 310, 86, 1985, 1, 29, 4, 94, 1,
+    300, 584, 476, 37, 210, 44, 128, 1061, 1884, 667, 509, 479, 41, 853, 6, 87,
+    253, 3486, 1159, 67, 301, 747, 5, 50, 5, 1, -2597, 942, 178, 260, 181, 1,
+    15, 37, 11, 1, 263, 525, 1319, 48, -2534, 1884, -2500, 1038, 141, 908, -2239, -2083,
+    -1866, 1373, 2, 184, 6, 2760, -1838, 5, 227, 258, 368, 6, 33, 141, 84, 1062,
+    679, 5, 4957, 18, 439, 1, 13, 589, 183, 2, 24, 266, 5, 313, 18, 61,
+    57, 18, 962, 335, 12, 311, 142, 2, 4, 63, 13, 130, 341, -1674, 3, 152,
+    12, 89, 3, 33, 272, 65, 362, 967, -1579, 71, 259, 131, -1469, 3, 8, 14,
+    1005, 275, 21, 2, 546, 1467, 338, 5, 3541, 3, 1008, 147, 1885, 2352, 1665, 230,
+    17, 29, 1734, 120, 23, 128, 436, 54, 218, 83, 37, 122, 6, 226, 670, 29,
+    20, 0, 2, 4039, 56, 20, -1458, 381, 258, 1447, 858, 2, 2, 54, 52, -1453,
+    70, 1, 247, 1574, 49, 606, 14, 11, 17, 45, 10, 45, 3, 876, 22, 418,
+    1, 4312, 37, 59, 4, 1, 14, 51, 483, 403, 3, 207, 25, -1450, 44, 451,
+    29, 98, -1365, 38, 1, 1, 1872, 15, 134, 54, 14, 3, 2587, 289, 222, 63,
+    3, 19, -1294, 153, 49, 41, 3879, 2, 173, -1113, 241, 436, 202, 34, 10, 217,
+    139, 13, 903, 940, 4, 1, 329, 812, 0, 3200, 11, 3, 1977, 211, 34, 10,
+    4, 2276, 297, 724, 4051, 4649, 6, 73, 19, 52, 82, 1120, 13, -1096, 88, 1960,
+    972, 1744, -968, 1, 1, 41, 1030, 27, 116, 591, 66, 13, 36, 771, 15, 237,
+    2, 136, 1629, 41, 2291, 463, 265, 5, 13, 324, 986, 72, 12, 346, 170, 2219,
+    -846, 1782, 1512, 2, 6, 1391, -779, 186, 786, 1065, 102, 1604, 0, 11, 1, 117,
+    153, -727, -708, 127, -688, 9, 217, 454, 213, 160, 944, 8, 80, 1341, 50, 432,
+    220, 30, 2049, 4543, 11, 31, 861, 29, 242, 72, 14, 22, 960, 11, 2148, 2,
+    288, 1062, 3, 173, 103, 128, 62, 1, 84, 1, 4441, 23, 4, 547, 19, 40,
+    2, 1827, 1, 2, 165, 11, 350, 456, 1, 2, 2, 152, 2795, 114, 7825, 553,
+    1, 93, 552, 43, 8, 887, -648, 1037, 1778, 74, 4830, 3, -641, 299, -603, 1681,
+    14, 1337, 45, 4331, 1266, -565, 2666, 115, 7, 1382, 314, 184, 436, 1, 6, 0,
+    2852, 102, 7, 173, 804, 672, 1, 19, 1939, 179, 74, 462, 79, 34, 136, 295,
+    4, 1269, 61, 224, 97, 5427, 274, 33, 3, 82, 123, 2214, 74, 7, 924, 6,
+    398, -459, 65, 7, 2975, 0, 4, 6, 111, 39, 443, 2054, 966, 2586, 3, 43,
+    1337, 46, 180, 9509, 6271, 440, 0, 2008, 672, 78, 3, 41, -452, 13, 139, 0,
+    23, 3, 3, 6, 60, 432, 1970, 152, 73, -356, 27, 393, 1997, 1625, 123, 18,
+    14, 1, 3, 87, 1, 1, 0, 324, 1079, 1, 34, 1959, 6, -334, 6744, 62,
+    30, 704, 213, 80, 1262, 720, 75, 12, 13, 331, 508, 2, 2, 335, 220, 13,
+    0, 87, 3986, 153, 32, 21, 3427, 189, 206, 4257, 97, 292, 363, 2, 4, 249,
+    4311, 37, 569, 64, 922, 3, 206, 1044, 7, 1723, 595, 190, 104, 1, 11, 425,
+    2, 86, 976, 0, 34, 0, 23, 3, 1, 1003, -253, 76, 26, 6, 16, 397,
+    117, 3, 745, 36, 14, 217, 418, 82, 519, 961, 1382, 3068, 0, 1225, 3, 516,
+    49, -240, 1747, 143, 172, 5, 3883, 84, 2902, 346, 3, 36, 55, 450, 541, 250,
+    444, 914, 8, 2329, 1491, 99, 74, 119, 57, 3043, 141, 37, 360, 82, 90, 420,
+    79, 1383, -237, 0, 9, 12, -124, 49, 273, 1, 0, 2179, 5, 79,
+}};
+
+constexpr std::array<std::uint32_t, 13817> token_hash_slots
+{{
+    6368, 7535, 661, 12749, 7184, 6708, 12751, 11655, 735, 8839, 9872, 9718, 2091, 8521, 3437, 348,
+    9189, 2465, 1887, 7778, 4914, 8949, 12877, 5585, 9563, 2192, 1892, 5420, 2866, 5441, 10888, 10306,
+    2435, 10377, 185, 6952, 3549, 4927, 10046, 6464, 1086, 4119, 5870, 1150, 6541, 13789, 9850, 7879,
+    1997, 3999, 10659, 9869, 6362, 1716, 297, 1739, 52, 11732, 13671, 4391, 5017, 6806, 8455, 8382,
+    4396, 10704, 7951, 12627, 954, 7609, 1386, 6123, 21, 6647, 11103, 12680, 936, 9366, 3526, 5607,
+    11601, 12055, 11755, 6240, 10390, 4404, 290, 11209, 2342, 1952, 9250, 3402, 3713, 6209, 11872, 622,
+    1567, 4366, 1234, 5934, 3476, 614, 4436, 11783, 9592, 4099, 12275, 12667, 11979, 0, 12109, 1764,
+    8130, 5459, 6071, 10585, 5981, 3454, 7700, 7214, 550, 3723, 10252, 12394, 11669, 10219, 344, 4521,
+    3232, 3005, 7606, 3096, 9266, 5975, 9496, 2262, 4283, 13030, 8172, 84, 11122, 5711, 13365, 9664,
+    7516, 10860, 6498, 13146, 7318, 2177, 8735, 10682, 1591, 3637, 7967, 9103, 7559, 3129, 11202, 11728,
+    11511, 11030, 6328, 10594, 7204, 3517, 3532, 5101, 9880, 2580, 5789, 861, 6953, 6048, 6215, 5889,
+    5866, 11571, 10815, 4350, 13242, 2441, 1328, 5352, 13572, 10021, 10104, 9232, 13442, 4105, 8917, 3746,
+    4956, 9396, 2596, 7340, 1961, 12475, 7164, 6088, 709, 12561, 3946, 2788, 11934, 2503, 1151, 5177,
+    12160, 2986, 6558, 198, 10557, 62, 4297, 1457, 9273, 3351, 3847, 12721, 5940, 13633, 8271, 1152,
+    2093, 13142, 2482, 3047, 10238, 10286, 8117, 10351, 11798, 5784, 4944, 1089, 10050, 11518, 13444, 1163,
+    8547, 1498, 7165, 7836, 9628, 3632, 5432, 2096, 3863, 2930, 4414, 8986, 3894, 5508, 11843, 8369,
+    9892, 3019, 10508, 2181, 13202, 4440, 12008, 13059, 9269, 2102, 6032, 9764, 5418, 3985, 10241, 12326,
+    9081, 12590, 5525, 477, 7723, 11817, 11133, 3018, 2157, 10160, 8128, 412, 4739, 2876, 7390, 8121,
+    11560, 11481, 5549, 8071, 9782, 4995, 8361, 4497, 3254, 6696, 7638, 9799, 6955, 4432, 10310, 10384,
+    3787, 10446, 12104, 3964, 4663, 5884, 785, 5248, 4972, 8997, 7704, 5556, 597, 13760, 12835, 9066,
+    8968, 5994, 6967, 13358, 4114, 2659, 6437, 13132, 9864, 3953, 1331, 3181, 10425, 1455, 6750, 3809,
+    6254, 12105, 625, 349, 2612, 12650, 8721, 2052, 2934, 10681, 9105, 5279, 12878, 7799, 238, 1303,
+    13741, 317, 4011, 7056, 8417, 8840, 3492, 3046, 12415, 4933, 4154, 8578, 435, 5389, 11354, 1004,
+    13227, 10848, 9665, 4158, 6517, 12131, 2737, 3081, 3830, 10305, 9537, 13776, 11536, 10352, 9166, 12002,
+    11413, 1627, 8373, 2678, 3114, 10463, 12949, 7620, 3237, 7600, 6987, 13179, 8371, 4947, 3786, 8447,
+    11741, 9243, 9507, 11806, 4077, 3013, 10930, 160, 8668, 7348, 3736, 2832, 5625, 748, 5131, 7563,
+    404, 2148, 6634, 2700, 8116, 812, 3449, 6886, 12217, 9304, 11878, 4182, 1418, 2906, 6772, 5995,
+    2245, 9152, 11776, 8693, 5950, 6751, 4887, 4328, 11825, 7532, 5284, 2254, 12894, 8622, 3735, 5488,
+    6241, 1867, 12481, 8716, 10518, 11073, 2188, 574, 9083, 6933, 1259, 1153, 5601, 2629, 4717, 8673,
+    848, 6883, 11994, 3367, 3539, 5628, 13747, 13481, 5332, 9985, 12543, 6800, 46, 11665, 9045, 5064,
+    6949, 2640, 5007, 113, 12216, 1131, 4347, 6001, 6979, 542, 1373, 7760, 12107, 12112, 9204, 4533,
+    746, 8248, 253, 6284, 7126, 11839, 8403, 8053, 2082, 7059, 12169, 1409, 7014, 7746, 8662, 8153,
+    8520, 2252, 2373, 5763, 13793, 2542, 823, 9993, 12828, 1618, 9209, 3357, 11946, 1636, 7789, 190,
+    5338, 6663, 1573, 4747, 10014, 2727, 6463, 223, 5419, 1728, 7232, 9795, 817, 6627, 12865, 6015,
+    8720, 7239, 12925, 5238, 6410, 1194, 5251, 12305, 10443, 4819, 9095, 8199, 640, 9235, 13445, 10133,
+    7280, 3684, 1619, 9272, 6927, 4522, 8064, 12692, 13494, 8313, 3159, 9241, 5993, 10565, 8797, 5368,
+    2271, 7848, 11896, 9223, 12359, 9505, 2154, 7525, 2208, 179, 5016, 10929, 7055, 13055, 2844, 63,
+    4751, 7342, 9376, 12825, 11120, 1446, 7880, 6502, 12708, 292, 13469, 10395, 3319, 5973, 3842, 4401,
+    3906, 12161, 12602, 8585, 3876, 10213, 7624, 11409, 6389, 12905, 12716, 4624, 5335, 9450, 11474, 1014,
+    13705, 10256, 385, 11241, 9931, 9555, 6061, 1648, 12916, 8646, 2068, 144, 6903, 1149, 4079, 7744,
+    4532, 12903, 6861, 7742, 9986, 11796, 3106, 12995, 6385, 5307, 12628, 553, 1345, 7990, 3217, 4481,
+    12816, 7575, 6649, 458, 13250, 981, 7604, 5897, 10868, 395, 9260, 11025, 11527, 5672, 2258, 10683,
+    13257, 10665, 96, 4512, 6415, 396, 13782, 1849, 7414, 1500, 9955, 8736, 2029, 13801, 9737, 3896,
+    10288, 12829, 11551, 1889, 6131, 229, 4992, 4606, 7553, 9865, 1987, 769, 636, 208, 6812, 1939,
+    7631, 11102, 6304, 11005, 11043, 11797, 454, 1967, 7222, 7480, 7488, 6220, 5564, 8591, 1881, 4859,
+    12157, 4808, 7643, 3800, 10316, 12132, 9509, 6650, 6600, 9992, 1440, 5621, 3325, 4722, 4096, 2808,
+    3391, 449, 904, 6231, 8016, 2338, 3258, 2932, 5119, 9321, 4310, 232, 1938, 9511, 1963, 7497,
+    7773, 7428, 8317, 6494, 855, 9682, 8885, 209, 5348, 2059, 13277, 6942, 3831, 7330, 6583, 7394,
+    6330, 13493, 11703, 1137, 3178, 7087, 10499, 4632, 9190, 5511, 1245, 6077, 1412, 2294, 1491, 12018,
+    1411, 7750, 1824, 10083, 4100, 5401, 2047, 7607, 12431, 13267, 13054, 4289, 3480, 6848, 10898, 2374,
+    12372, 9333, 1936, 7973, 3050, 10171, 7307, 5855, 10969, 1424, 849, 7337, 5532, 7911, 12819, 1756,
+    1451, 2957, 5701, 11163, 10459, 13655, 12855, 7618, 12609, 8631, 10503, 1260, 12416, 4117, 8643, 11471,
+    216, 11640, 2568, 2128, 12457, 8729, 4559, 8573, 8357, 3475, 2329, 10357, 10040, 12754, 4628, 5043,
+    12042, 11283, 7096, 9627, 3242, 2779, 7845, 6449, 1370, 2893, 12912, 2051, 9294, 6515, 11438, 2218,
+    13057, 6466, 12522, 4929, 13191, 7460, 4188, 6024, 2437, 8734, 5557, 2635, 409, 9262, 9206, 6221,
+    6787, 4207, 320, 12313, 7020, 9855, 5246, 7286, 4103, 2241, 11973, 842, 11157, 12641, 2057, 12915,
+    2063, 1164, 10392, 8203, 4080, 10069, 432, 1941, 5519, 2401, 8164, 10989, 9772, 2399, 1306, 8604,
+    10257, 13658, 4865, 12129, 7580, 8154, 4879, 694, 5762, 11762, 3198, 879, 10030, 480, 5631, 6938,
+    7215, 7661, 13548, 1607, 13770, 417, 3737, 7777, 4022, 13433, 11057, 7145, 5429, 2111, 12732, 7874,
+    11096, 12402, 5933, 9806, 3688, 4496, 5913, 7257, 11980, 4690, 9101, 5936, 13623, 6981, 13077, 3784,
+    2878, 5143, 7298, 12178, 5296, 12224, 5572, 1102, 3376, 13185, 3748, 10491, 6379, 12328, 31, 10155,
+    1026, 7586, 5240, 993, 9907, 3121, 10732, 3303, 12117, 656, 12257, 12951, 9411, 11168, 12343, 6483,
+    3252, 2260, 10086, 3368, 7567, 12710, 9117, 12818, 5985, 4173, 6101, 1525, 1541, 11376, 13050, 4519,
+    11457, 10661, 9229, 5893, 10066, 13402, 11764, 8158, 1603, 11036, 5393, 7325, 582, 11290, 5196, 829,
+    8063, 2308, 4219, 67, 7908, 8860, 6546, 3439, 1351, 10730, 1601, 6442, 10663, 10766, 6556, 8210,
+    11075, 1577, 8419, 10845, 11886, 13437, 5469, 7083, 7039, 7270, 801, 11153, 8810, 2382, 11129, 10921,
+    13126, 2875, 11249, 8065, 9246, 166, 1585, 2028, 6874, 8025, 10627, 8836, 2593, 10796, 5939, 1160,
+    10005, 4953, 10797, 7081, 12339, 1344, 978, 361, 5871, 5927, 8649, 12453, 12715, 12119, 2609, 10480,
+    1255, 7049, 12731, 5098, 2863, 5328, 1361, 8075, 11299, 594, 8930, 12388, 3156, 1323, 10750, 10440,
+    12444, 1233, 5051, 9818, 8526, 12822, 3552, 9221, 9794, 150, 9836, 9888, 10060, 3472, 9124, 1903,
+    11221, 1237, 11229, 5480, 11519, 267, 10192, 1874, 11208, 8830, 12070, 4971, 7255, 13586, 6179, 11275,
+    6999, 7570, 5000, 12127, 6743, 9230, 3741, 2595, 6968, 13541, 11549, 3609, 12976, 35, 5231, 1165,
+    4656, 10687, 11953, 8977, 13521, 2657, 4092, 5840, 3758, 645, 10936, 9024, 12334, 3634, 11947, 6290,
+    4399, 296, 5082, 2132, 7413, 10709, 6270, 9492, 8634, 11508, 10164, 3604, 11365, 786, 4294, 8926,
+    9311, 1550, 12571, 2899, 12959, 1055, 184, 620, 6543, 843, 12057, 13765, 1479, 3640, 11985, 10361,
+    10931, 303, 9698, 13614, 8051, 13480, 9564, 3270, 9051, 6542, 1410, 3647, 12115, 7379, 3834, 9340,
+    11885, 9513, 4327, 4332, 3774, 13605, 3266, 9609, 13815, 11884, 11286, 11448, 7471, 13667, 3959, 12744,
+    12724, 5057, 1139, 10992, 5400, 4800, 4428, 12859, 992, 2158, 1394, 6777, 4679, 3288, 6038, 3077,
+    547, 5031, 2685, 3849, 7761, 3683, 4150, 6829, 4621, 6299, 9461, 5683, 12064, 1587, 13119, 6528,
+    7711, 5758, 9389, 10700, 6657, 10895, 8599, 13210, 4486, 9344, 10354, 11995, 11223, 9530, 6744, 5568,
+    12293, 9163, 587, 11772, 8899, 11469, 12159, 851, 12435, 6318, 4262, 2534, 7354, 961, 6774, 12246,
+    1883, 1453, 7387, 5259, 12137, 13188, 9409, 4727, 6097, 6842, 4545, 968, 5645, 13446, 1223, 9732,
+    9446, 3513, 6838, 5095, 4796, 10577, 1051, 4383, 2042, 138, 3030, 8009, 4218, 4159, 869, 4168,
+    5129, 1218, 5294, 1821, 6339, 12987, 4232, 12203, 4901, 10359, 5570, 13421, 10705, 11139, 12572, 11318,
+    912, 6112, 9553, 1215, 8557, 3072, 13649, 5473, 4989, 4600, 11984, 6338, 9353, 12344, 1690, 9112,
+    4574, 2286, 11751, 6878, 1563, 11217, 11565, 5452, 13182, 11267, 13513, 2898, 3997, 4633, 2398, 10528,
+    5404, 8740, 9789, 13555, 9012, 4018, 3707, 9642, 8820, 6646, 653, 9037, 3925, 5566, 2524, 8143,
+    3630, 10180, 6888, 10181, 6480, 8764, 2305, 3943, 10496, 12536, 4213, 8437, 3312, 7395, 19, 4662,
+    584, 9049, 12122, 8963, 10615, 8311, 202, 2139, 10916, 6896, 11260, 5159, 2790, 5008, 1190, 10798,
+    10982, 8763, 5490, 12227, 761, 8430, 125, 9015, 5376, 11238, 3520, 4631, 3731, 1307, 1058, 3318,
+    1293, 6493, 9881, 4236, 3253, 7159, 1540, 1377, 4906, 4143, 8881, 11254, 8529, 2270, 4680, 4750,
+    2511, 4061, 9761, 7245, 7687, 12808, 1421, 6378, 224, 2889, 1817, 1505, 3301, 10413, 10153, 1948,
+    6358, 12083, 4163, 9580, 2936, 8107, 12565, 9421, 2240, 3038, 4705, 11274, 11020, 4629, 2349, 11484,
+    1213, 5241, 11780, 8324, 11853, 6388, 12693, 1882, 700, 2501, 13556, 4452, 5147, 4427, 12756, 10961,
+    12279, 78, 4826, 7082, 7785, 11667, 6668, 6519, 6008, 3200, 8904, 9536, 13732, 6620, 7719, 10328,
+    13464, 11247, 8906, 8629, 4711, 252, 3527, 7173, 1981, 11583, 12655, 7015, 13456, 3349, 7496, 1704,
+    9067, 9487, 394, 10536, 8318, 6739, 2204, 11634, 7000, 5189, 6100, 13535, 5435, 8594, 606, 12013,
+    10811, 7303, 13008, 7350, 2141, 12087, 314, 7800, 431, 8754, 7869, 828, 2874, 10267, 6277, 6460,
+    420, 10621, 8292, 6677, 6899, 281, 4788, 4612, 9763, 5373, 5667, 3210, 956, 10232, 6314, 1381,
+    486, 8478, 12473, 559, 2901, 5320, 12555, 192, 9857, 5391, 11866, 11586, 616, 6828, 12515, 3489,
+    6862, 2627, 6014, 13617, 9469, 3158, 639, 7344, 3366, 5791, 4930, 13037, 156, 7103, 7007, 10643,
+    4405, 9435, 12297, 12777, 4493, 5210, 1957, 4868, 1288, 5748, 5292, 8263, 2014, 2131, 2022, 2860,
+    2602, 5321, 8831, 2696, 10950, 8658, 3431, 11372, 3058, 1683, 13672, 12005, 1347, 474, 7068, 8056,
+    5885, 10457, 9971, 3192, 6889, 69, 1144, 3874, 7608, 11656, 8304, 6773, 7986, 942, 884, 641,
+    245, 5966, 11236, 2756, 548, 4589, 13099, 2062, 8978, 10800, 7132, 11359, 13697, 6551, 11534, 5398,
+    5427, 8306, 9188, 8365, 12194, 10940, 12069, 12942, 11672, 400, 11662, 9017, 4695, 11714, 6904, 1749,
+    7577, 91, 13742, 10591, 13279, 5700, 9544, 11353, 2378, 1391, 3137, 5197, 10280, 5004, 12757, 11231,
+    13123, 7094, 4667, 759, 8889, 7331, 6610, 6426, 2968, 3247, 2750, 1047, 8114, 3477, 10188, 6297,
+    3506, 999, 7745, 9569, 1805, 4726, 1449, 12827, 3536, 1665, 2073, 7514, 1612, 2152, 1382, 9228,
+    5816, 3246, 13817, 2558, 7018, 9519, 846, 8821, 5078, 591, 4922, 4278, 12056, 615, 8279, 13129,
+    6570, 3396, 2005, 6706, 2490, 3838, 8741, 8816, 5343, 7499, 2632, 12519, 11160, 1535, 9831, 1919,
+    4206, 6950, 9345, 5380, 4365, 4430, 1330, 6656, 4016, 11563, 3835, 5912, 11480, 1921, 5375, 826,
+    10654, 4499, 11158, 4057, 6125, 5199, 8531, 4491, 12041, 1383, 7457, 4697, 4745, 11939, 9898, 4871,
+    10935, 6825, 4517, 3724, 1788, 864, 4160, 7924, 11452, 7067, 5776, 12801, 10573, 235, 4132, 11901,
+    5841, 2264, 2049, 11785, 13395, 9508, 9072, 315, 12652, 12580, 8126, 7596, 10690, 3912, 2197, 12668,
+    4964, 4921, 7461, 9673, 5879, 13341, 10612, 8867, 8235, 13460, 9712, 469, 7293, 8993, 6681, 2144,
+    7585, 12478, 9426, 8343, 10540, 6370, 8822, 12222, 2895, 1211, 1609, 13166, 6845, 8842, 4513, 3175,
+    1546, 1857, 10100, 6561, 8473, 7685, 2776, 9497, 13244, 11733, 12591, 9725, 1044, 3851, 11360, 12980,
+    3596, 11342, 12534, 2175, 4075, 8924, 5554, 370, 1929, 11840, 1257, 6859, 12898, 5130, 7411, 8515,
+    7357, 8564, 528, 13554, 5121, 7076, 4337, 5592, 720, 4563, 9325, 839, 507, 300, 11061, 9866,
+    513, 7292, 4315, 8308, 4028, 3059, 13177, 10201, 13135, 11880, 12242, 11301, 9805, 3816, 12988, 8093,
+    6027, 8208, 12182, 12090, 4439, 12154, 8901, 3589, 1437, 3141, 3316, 11128, 8574, 10584, 8273, 8353,
+    4113, 4179, 7792, 1295, 3807, 6167, 1615, 2341, 8321, 878, 8920, 155, 10928, 8350, 4766, 931,
+    5182, 4850, 8852, 13790, 3740, 463, 984, 6962, 9482, 10161, 10959, 13546, 220, 13692, 9275, 2502,
+    6175, 13604, 6308, 9418, 321, 510, 10812, 8330, 11940, 4760, 95, 9965, 4174, 2991, 8969, 2798,
+    1358, 8300, 6507, 7341, 218, 2201, 953, 2505, 10600, 9890, 3433, 4359, 1725, 2203, 8677, 1388,
+    9614, 2795, 11622, 6554, 555, 10498, 10963, 9274, 12640, 10900, 11997, 490, 11184, 8862, 1221, 10111,
+    1341, 10980, 4957, 4089, 11136, 12426, 5250, 505, 10087, 9585, 13315, 13601, 603, 11041, 12466, 9571,
+    4248, 12813, 1115, 5737, 9264, 6070, 4687, 11193, 6246, 10614, 955, 13580, 6613, 8354, 3619, 10344,
+    8356, 2537, 9830, 7266, 13095, 3, 11724, 8211, 4146, 4635, 13027, 4313, 2714, 11737, 9733, 5573,
+    8541, 11466, 7738, 6006, 4189, 12317, 5642, 5750, 149, 9606, 13768, 3259, 3250, 13015, 6662, 623,
+    5766, 8768, 1252, 3722, 4463, 12994, 8630, 11891, 5910, 12151, 5506, 853, 5579, 10279, 13461, 9962,
+    13174, 126, 3608, 4041, 5086, 10273, 4065, 60, 11657, 2805, 4380, 6271, 8283, 8687, 11035, 7919,
+    2006, 3733, 4625, 3932, 3417, 7807, 535, 11959, 8985, 9438, 9905, 11572, 775, 4060, 4587, 206,
+    4108, 6250, 2734, 7595, 3204, 5270, 9058, 3580, 10862, 1169, 7862, 696, 6183, 1947, 5498, 5027,
+    4298, 12004, 9674, 11822, 5668, 10922, 1613, 6664, 6518, 6064, 6053, 13792, 12184, 13147, 288, 5898,
+    4245, 4857, 6201, 8753, 4732, 3920, 164, 11803, 5800, 1458, 5152, 730, 10945, 1659, 7540, 12146,
+    5710, 10509, 11373, 13222, 11867, 4526, 2267, 1855, 3955, 923, 3554, 13276, 8837, 1656, 4577, 9270,
+    11027, 8334, 3801, 519, 9883, 10075, 8159, 1532, 2555, 2888, 3337, 9471, 7887, 882, 4003, 8808,
+    1807, 1054, 6717, 12463, 8082, 5617, 3491, 10462, 10289, 11644, 13254, 12081, 8276, 10147, 9238, 10842,
+    1487, 12456, 12850, 12044, 9207, 1031, 5872, 1501, 9777, 6775, 3251, 8444, 5450, 10476, 1167, 10327,
+    4469, 8761, 565, 2611, 9306, 13662, 13575, 2681, 12467, 8146, 8062, 6124, 964, 3930, 11422, 9701,
+    8888, 5287, 13002, 11257, 7878, 13399, 4830, 6432, 3543, 13133, 9320, 2104, 4023, 7360, 5533, 4019,
+    3832, 6599, 68, 11124, 11174, 11748, 6910, 10708, 8695, 10821, 11642, 10167, 3256, 9271, 9332, 6085,
+    5740, 12596, 12676, 12527, 5951, 90, 13107, 9780, 215, 121, 4646, 11756, 2180, 1120, 4228, 2300,
+    4551, 13100, 6841, 3669, 6235, 1430, 1865, 8028, 7412, 3719, 12597, 4581, 9052, 4875, 6065, 11397,
+    9001, 1118, 11596, 4129, 7208, 1365, 4495, 6919, 11490, 5463, 7042, 11905, 1342, 1795, 3892, 11064,
+    10979, 7655, 13702, 1000, 11396, 1614, 8750, 11606, 10028, 4993, 9755, 1510, 3828, 11076, 9217, 5135,
+    6428, 8688, 11996, 10255, 10330, 8482, 2325, 3792, 5512, 12469, 6602, 6282, 3936, 8847, 8046, 1995,
+    11691, 4768, 1708, 9594, 7716, 273, 4937, 181, 6604, 11167, 523, 11852, 9018, 1061, 9721, 2974,
+    7022, 7747, 12848, 7242, 6301, 3169, 6268, 11529, 5857, 5062, 10211, 4990, 316, 4362, 12798, 13727,
+    4730, 11399, 5650, 862, 2738, 4348, 2370, 6082, 5206, 2944, 12314, 2579, 4905, 8029, 1005, 10653,
+    7811, 783, 3020, 12531, 12406, 2951, 9211, 6537, 11949, 7197, 4300, 485, 9625, 6569, 9658, 852,
+    10949, 9659, 8815, 8807, 5050, 12746, 1943, 145, 7221, 9973, 12965, 8131, 7634, 4586, 7752, 7641,
+    4234, 12311, 7943, 10460, 3387, 12612, 5353, 2865, 2850, 12941, 6121, 7968, 13241, 6397, 10454, 12152,
+    6630, 6877, 11055, 13627, 1902, 3039, 6296, 10547, 10904, 6055, 7034, 5896, 12113, 11675, 5497, 9882,
+    11848, 1235, 4054, 8044, 12450, 5500, 8600, 11309, 9458, 114, 10568, 13023, 8572, 3128, 4340, 5860,
+    1353, 6352, 8665, 10071, 5133, 6056, 8554, 11097, 12277, 2529, 10566, 6742, 11476, 5655, 669, 5577,
+    2806, 10531, 1060, 11944, 13086, 7013, 5596, 5384, 9382, 4674, 3829, 6002, 13408, 1752, 2733, 4029,
+    1176, 6505, 5569, 6912, 3772, 5605, 13691, 6104, 6305, 4378, 6165, 2010, 1922, 8217, 12382, 8406,
+    4547, 9652, 854, 8650, 4579, 11525, 11232, 10151, 3052, 7937, 4742, 8666, 8802, 9459, 12162, 263,
+    2641, 4607, 1856, 11060, 13019, 10054, 10885, 11387, 2454, 9692, 662, 120, 12428, 12634, 1073, 10469,
+    13559, 4785, 13794, 9406, 4969, 5345, 168, 2704, 10876, 3695, 13065, 2268, 8975, 7802, 12585, 2043,
+    12421, 8865, 4872, 11977, 3339, 5918, 2894, 10881, 4284, 7064, 10090, 1320, 10693, 7547, 889, 7564,
+    1641, 1984, 3881, 4538, 10448, 7842, 9557, 3879, 3139, 12780, 7578, 13459, 841, 3089, 3505, 6884,
+    10183, 6210, 2471, 10336, 7048, 9819, 3465, 12802, 657, 7674, 13336, 3374, 2852, 8911, 2515, 10123,
+    10751, 13685, 2831, 8580, 10492, 39, 10692, 5773, 2824, 7701, 1580, 10084, 10967, 6587, 76, 697,
+    1375, 13316, 6098, 5126, 3424, 4149, 1173, 1872, 5954, 10320, 4214, 9551, 2243, 6813, 770, 2480,
+    2758, 140, 7008, 40, 10282, 1547, 5453, 7550, 1142, 10656, 3979, 1760, 6763, 7736, 8589, 989,
+    5310, 581, 11827, 8394, 8798, 13122, 13278, 7398, 5811, 13120, 11431, 10586, 2656, 12506, 7886, 5222,
+    12031, 12400, 4330, 5483, 1239, 10712, 6917, 6126, 13235, 5886, 3557, 11008, 11595, 6863, 8220, 9102,
+    10418, 13085, 3438, 9431, 1610, 687, 8160, 13403, 11919, 461, 6156, 6346, 3123, 7431, 8077, 302,
+    2273, 43, 9792, 2483, 7373, 7851, 11063, 8457, 3569, 12073, 5812, 3756, 7709, 9422, 11137, 1119,
+    5778, 7240, 11130, 9303, 847, 5589, 8609, 5303, 2772, 10175, 4013, 5943, 13676, 995, 13118, 6674,
+    4552, 2050, 2504, 2760, 11887, 7060, 3752, 6050, 414, 11512, 6444, 7211, 10505, 11182, 2786, 6066,
+    3573, 9218, 2759, 4684, 6975, 5813, 10297, 4286, 4773, 4142, 10696, 11284, 9233, 476, 2755, 4997,
+    11112, 963, 6749, 5665, 6311, 13621, 9990, 11670, 1794, 230, 6506, 4618, 1789, 5565, 2754, 13468,
+    789, 5271, 11582, 11524, 11319, 13284, 11233, 2603, 12670, 1428, 8492, 258, 3872, 12274, 7614, 10938,
+    9158, 8216, 3334, 1050, 3931, 5725, 4782, 7727, 10883, 1605, 2691, 353, 6869, 12289, 10109, 13201,
+    2316, 9602, 12558, 8868, 12966, 7143, 13497, 6836, 957, 1502, 459, 4899, 12459, 6790, 10142, 12883,
+    10672, 12323, 530, 7783, 2283, 2105, 9687, 7472, 13051, 4622, 12823, 11877, 9390, 12660, 1263, 1314,
+    13079, 8543, 2277, 29, 3578, 4086, 8601, 1735, 10774, 7699, 3626, 9679, 8989, 8576, 4907, 12429,
+    11065, 13568, 1926, 9169, 9119, 101, 9375, 6921, 5158, 9583, 7544, 61, 10270, 6779, 4477, 11498,
+    8848, 12735, 529, 13170, 2026, 6294, 663, 12893, 2962, 285, 2247, 4797, 11195, 9008, 3730, 4806,
+    9856, 11478, 7155, 12486, 3182, 5252, 1043, 8663, 9731, 12584, 10791, 3132, 128, 9392, 11614, 103,
+    6402, 3140, 12817, 10851, 10564, 10495, 9387, 3742, 5492, 3177, 6321, 7866, 1420, 8102, 4666, 13307,
+    945, 7786, 2004, 5751, 5001, 32, 12847, 466, 11706, 13394, 5225, 7269, 3983, 8255, 6416, 5759,
+    6465, 13449, 2345, 5552, 2978, 8195, 5947, 10118, 13, 9560, 11183, 10719, 3960, 8, 4102, 8553,
+    7838, 6377, 9891, 4948, 7152, 7977, 6198, 1819, 5331, 6336, 4784, 670, 2985, 7366, 3791, 3268,
+    12889, 11842, 12729, 11663, 6527, 11077, 1896, 8133, 11151, 5529, 12656, 2918, 10523, 5986, 10556, 6745,
+    7012, 1352, 6894, 9363, 6860, 1711, 2929, 11497, 13539, 525, 10856, 2837, 10259, 13714, 916, 690,
+    2168, 10427, 11533, 5593, 8791, 13594, 7548, 5962, 11007, 3147, 2701, 12208, 12301, 2841, 11605, 10644,
+    3460, 5347, 7566, 10813, 10907, 8142, 11446, 8467, 8582, 153, 12570, 9437, 2604, 3568, 3350, 9019,
+    8043, 3654, 8691, 500, 1980, 9860, 3283, 5785, 5198, 5288, 9958, 10243, 573, 11857, 1484, 12576,
+    9118, 7683, 8152, 1198, 753, 11719, 5021, 8962, 3355, 12407, 8813, 462, 10725, 7089, 13354, 9738,
+    1476, 1124, 3398, 11432, 12583, 7805, 10905, 8433, 8349, 10716, 8247, 918, 13780, 2660, 1944, 11302,
+    8237, 2412, 9510, 7933, 10076, 5032, 833, 12035, 544, 11787, 81, 7949, 10419, 10792, 3482, 10251,
+    9899, 299, 2791, 379, 9141, 11226, 440, 892, 13102, 1107, 2160, 3428, 5923, 93, 10272, 8806,
+    6748, 6033, 2406, 4161, 12303, 428, 11875, 7728, 771, 10847, 13308, 2171, 5346, 607, 8307, 5916,
+    8773, 289, 97, 12752, 3531, 1566, 59, 5026, 282, 11307, 5970, 3720, 9597, 9113, 3042, 726,
+    646, 7659, 8675, 11556, 1971, 3908, 12990, 11668, 7291, 933, 8780, 13082, 443, 5356, 4046, 11759,
+    8155, 5787, 3073, 9329, 7843, 13378, 3100, 7478, 8779, 4354, 9267, 8174, 6830, 13668, 6076, 5976,
+    3624, 7847, 5590, 4676, 9516, 11462, 1713, 5515, 2094, 7463, 12283, 4393, 4402, 12051, 6390, 2079,
+    6454, 12573, 7632, 8827, 10527, 2763, 2269, 6349, 12789, 10648, 543, 71, 8800, 1670, 10248, 3267,
+    1833, 3284, 2451, 13374, 13295, 10560, 10948, 11631, 10803, 1448, 6247, 4433, 13173, 7030, 1640, 2626,
+    6315, 1950, 1776, 4976, 2671, 9427, 5509, 8637, 10695, 3817, 12010, 13524, 6418, 3989, 5771, 12706,
+    12347, 453, 7066, 12063, 2630, 2744, 12921, 6641, 13379, 7098, 8534, 9460, 4511, 5747, 5034, 12047,
+    9503, 8088, 222, 4892, 2433, 11766, 5895, 13641, 1369, 13417, 7672, 8377, 13544, 10299, 11778, 5474,
+    13259, 7816, 5330, 1201, 12237, 3098, 7629, 9599, 1431, 5987, 9781, 11270, 42, 6623, 3407, 13455,
+    7587, 7877, 6083, 2464, 13550, 1082, 8640, 6918, 8331, 11292, 8912, 12566, 3074, 8702, 343, 9709,
+    10207, 4975, 6479, 10079, 1741, 8363, 13602, 13771, 7688, 10011, 8410, 8367, 4884, 10372, 13496, 8201,
+    10711, 11371, 11111, 6469, 6983, 8499, 10135, 11808, 13457, 808, 13012, 1264, 6753, 7562, 9640, 10893,
+    11734, 12794, 7370, 1637, 12824, 393, 13482, 6105, 3189, 1552, 11031, 840, 9383, 1644, 5085, 3951,
+    9429, 4476, 9851, 7583, 10691, 12967, 3008, 571, 3762, 11623, 4244, 3977, 11045, 7996, 2411, 9670,
+    5058, 7448, 4295, 8287, 2354, 5428, 3294, 11879, 3636, 75, 10284, 9576, 4764, 8297, 1128, 8449,
+    4888, 1677, 4369, 8135, 7896, 5915, 8919, 6181, 2650, 11838, 13052, 1575, 11742, 7898, 10957, 11541,
+    13526, 7332, 1081, 175, 9704, 7289, 13289, 5831, 12239, 10444, 8460, 2075, 562, 5967, 4613, 5193,
+    647, 1214, 3230, 11454, 5553, 1946, 8017, 3022, 2031, 4592, 1572, 9667, 11159, 13500, 3910, 6989,
+    7779, 10721, 319, 8254, 12148, 8426, 6303, 12900, 6875, 9719, 10458, 7276, 11042, 12259, 13648, 1281,
+    13788, 9315, 8055, 2492, 8782, 6320, 7251, 11172, 7637, 5690, 7362, 212, 4792, 11587, 2748, 7355,
+    12080, 2352, 6256, 5728, 8864, 12792, 9093, 8252, 4153, 9512, 4326, 950, 11573, 9724, 10646, 6149,
+    1777, 3457, 4456, 7569, 7402, 2143, 8569, 7139, 4273, 7278, 13640, 9400, 2946, 2250, 9556, 259,
+    13487, 6245, 13372, 3592, 9730, 7653, 2594, 10717, 667, 6413, 7218, 9660, 10434, 1464, 9476, 9822,
+    7657, 6832, 4467, 13537, 1413, 3921, 3029, 12471, 12309, 9439, 8469, 10481, 8023, 12483, 5449, 4736,
+    10103, 2642, 948, 3420, 12106, 2114, 7763, 7057, 9810, 3142, 4091, 10897, 2230, 6208, 5513, 1210,
+    664, 2417, 5476, 974, 742, 12284, 12926, 1258, 9821, 5805, 4786, 1299, 5698, 12662, 1595, 10874,
+    11936, 2679, 10866, 7907, 6636, 13301, 2071, 10162, 6488, 7203, 6849, 5291, 6589, 10689, 10411, 195,
+    6345, 11185, 5826, 7970, 13232, 11774, 10350, 10020, 12458, 10449, 3370, 6096, 10013, 11393, 1775, 13233,
+    8120, 12396, 6616, 11861, 8777, 1513, 1466, 821, 5002, 10085, 12346, 12601, 10447, 1126, 5507, 5670,
+    10041, 4616, 3276, 6678, 3193, 8818, 4285, 5883, 12956, 3971, 112, 12480, 3572, 1628, 13280, 2491,
+    12879, 12026, 9690, 88, 11456, 8289, 5112, 11943, 7074, 8966, 11335, 4755, 12713, 11062, 6213, 6618,
+    7644, 8233, 3382, 3468, 881, 9728, 6405, 6922, 9174, 2741, 8049, 10824, 9443, 12193, 3356, 12491,
+    2771, 644, 9050, 8205, 13718, 11358, 2498, 12787, 4381, 5827, 11951, 11087, 161, 7649, 2371, 8620,
+    7069, 2343, 6954, 7444, 4082, 6073, 4708, 11830, 894, 8231, 8445, 7856, 7359, 13762, 8409, 8470,
+    4761, 2449, 2849, 9020, 7338, 11913, 2543, 8951, 1018, 154, 12488, 9182, 11531, 8186, 1942, 1747,
+    13101, 5653, 13386, 7980, 8873, 4754, 4358, 12244, 7262, 4805, 4386, 7396, 11666, 10450, 7791, 7079,
+    4226, 12661, 13370, 7647, 11834, 12011, 4338, 3587, 1989, 7378, 6451, 5799, 895, 5834, 260, 8007,
+    7157, 3819, 1893, 13643, 3150, 10326, 1367, 9499, 13542, 834, 5853, 9579, 8284, 3227, 182, 11273,
+    3793, 8737, 8100, 10421, 3584, 10098, 8379, 7584, 3456, 7287, 86, 4070, 9797, 7902, 5322, 1336,
+    5125, 7510, 10987, 5941, 6837, 9873, 1646, 9408, 5261, 4074, 4271, 10187, 2182, 4891, 9423, 6885,
+    4202, 4642, 12989, 1193, 5754, 2631, 3364, 6714, 7095, 10755, 8335, 7108, 12060, 2881, 5856, 7005,
+    7748, 9335, 8165, 11343, 12370, 5436, 3890, 3899, 3243, 9649, 5433, 835, 2910, 12728, 5493, 13731,
+    9638, 1106, 4329, 11828, 7971, 2344, 5357, 12563, 9633, 1094, 5351, 532, 8945, 4980, 577, 4926,
+    3080, 7252, 1979, 7868, 7546, 3229, 9742, 1838, 8418, 8769, 4110, 3529, 4001, 11370, 8059, 4062,
+    3130, 11749, 7328, 4585, 10589, 11948, 1015, 5371, 8757, 10670, 489, 10099, 3776, 5265, 11812, 12773,
+    3434, 9982, 4261, 7236, 3161, 6333, 11135, 7327, 5163, 13304, 7343, 7666, 1492, 1934, 8435, 7198,
+    3044, 11113, 8568, 5005, 10349, 1406, 10873, 7051, 11181, 4614, 3497, 8083, 13018, 8124, 9289, 2032,
+    10198, 8489, 11773, 6026, 7389, 10215, 3672, 7282, 6603, 12917, 2616, 3797, 9954, 8504, 9342, 13565,
+    7975, 13811, 3412, 8434, 4723, 8667, 7410, 9297, 1035, 3067, 2864, 1335, 13104, 2902, 6108, 9825,
+    4147, 3347, 12832, 11506, 13620, 1068, 4665, 12185, 3875, 10741, 1111, 2448, 8476, 4157, 9632, 4877,
+    3679, 9613, 4803, 13080, 10402, 12690, 53, 1402, 3898, 2060, 13039, 8971, 13695, 12001, 148, 8175,
+    11779, 12791, 364, 5818, 4839, 2633, 2830, 12545, 1522, 10472, 106, 4455, 475, 5501, 9146, 13029,
+    12654, 13345, 10319, 7420, 9833, 13094, 11304, 11952, 8079, 12849, 10250, 4311, 1231, 11009, 4125, 5684,
+    6911, 10806, 2285, 12068, 5100, 6625, 979, 10595, 10341, 13517, 3504, 13294, 8725, 10777, 1534, 11216,
+    7588, 13334, 6891, 6789, 5180, 1216, 8045, 1918, 13224, 6722, 12442, 4713, 9506, 3296, 13432, 3865,
+    2346, 10616, 5195, 11357, 13813, 9717, 3135, 5212, 286, 9745, 10823, 2544, 12799, 3093, 7770, 9726,
+    11356, 2834, 12984, 56, 8894, 5968, 8193, 10514, 5772, 12092, 2581, 6876, 3845, 147, 9582, 11717,
+    3090, 907, 6757, 8453, 5575, 6643, 7021, 6925, 12762, 3455, 2392, 10239, 3553, 3764, 8559, 11876,
+    5092, 8513, 9179, 12427, 7923, 8570, 6373, 4701, 5190, 4043, 3522, 3739, 11677, 22, 12000, 12542,
+    8823, 5716, 4556, 4264, 12699, 7834, 5035, 12269, 11265, 7545, 13686, 3706, 6343, 10094, 4185, 776,
+    9098, 7590, 2765, 8747, 3884, 5203, 7175, 10144, 7639, 2745, 8584, 64, 12803, 2730, 12254, 5651,
+    2562, 8718, 9258, 3992, 5524, 13411, 7555, 11426, 651, 1600, 6815, 13351, 1059, 12839, 6365, 3718,
+    4790, 3617, 9648, 6645, 5484, 7871, 633, 3488, 7180, 824, 12352, 487, 4802, 4167, 9966, 7939,
+    11981, 12593, 11328, 12126, 3521, 6078, 966, 2011, 3500, 1576, 3969, 11256, 8835, 9239, 2945, 3686,
+    8758, 4598, 5176, 9645, 7466, 12281, 2838, 8811, 12201, 8202, 4700, 11080, 9430, 13578, 11523, 13318,
+    12020, 11978, 5154, 1187, 3882, 4543, 2313, 1885, 12015, 2605, 6622, 2950, 2215, 10532, 2539, 13190,
+    13105, 13412, 12887, 5232, 9612, 10128, 8803, 10978, 626, 4459, 9498, 4416, 10212, 8680, 2248, 11379,
+    12071, 11537, 8712, 9933, 11227, 10333, 9854, 10587, 9759, 2422, 2183, 8251, 5959, 12653, 767, 8119,
+    10322, 13205, 7593, 9540, 4193, 741, 677, 4034, 2569, 6207, 5928, 13034, 10623, 11465, 6091, 12455,
+    6563, 4200, 12846, 8752, 207, 12920, 12150, 8915, 12425, 497, 2147, 7721, 8954, 12066, 5422, 6977,
+    13451, 3511, 2705, 6253, 478, 3712, 5718, 9791, 533, 4571, 1397, 4845, 4776, 7154, 5862, 13017,
+    2242, 6601, 915, 6691, 11242, 6196, 10404, 3384, 9393, 8524, 9839, 11489, 8501, 11810, 4017, 11564,
+    8258, 12166, 3333, 9999, 11317, 9727, 1514, 4255, 10884, 13533, 7459, 7172, 8465, 11781, 8943, 2439,
+    9104, 4048, 12084, 8137, 3305, 2001, 3190, 595, 10388, 2668, 13584, 8775, 8338, 12796, 1958, 5289,
+    6205, 10588, 12778, 9493, 11649, 4015, 11930, 6025, 3949, 9526, 6834, 10830, 8413, 7681, 7409, 11849,
+    11423, 10913, 7906, 7449, 1596, 5089, 9629, 6545, 4638, 8851, 4704, 9843, 8091, 11746, 2661, 10249,
+    5235, 7141, 12500, 10442, 5674, 5204, 5742, 445, 13338, 1506, 10771, 9964, 13271, 12238, 3328, 2628,
+    4777, 10993, 3915, 12136, 10432, 8745, 13246, 3311, 1041, 1305, 7295, 13071, 6724, 8229, 1079, 9680,
+    83, 6287, 12183, 10145, 5456, 9756, 2694, 7361, 2302, 7571, 12638, 3023, 3197, 7530, 11141, 8024,
+    10714, 2046, 10638, 2326, 11101, 11932, 10233, 1461, 9407, 11338, 5285, 11192, 1199, 2298, 10686, 649,
+    2216, 8659, 2390, 9995, 1808, 11248, 1480, 2886, 10376, 10451, 13797, 731, 13806, 6544, 2892, 1125,
+    1327, 3975, 341, 3116, 7364, 8006, 7408, 8421, 5413, 9934, 274, 12781, 7884, 996, 9811, 10947,
+    5301, 33, 6624, 11615, 11676, 6351, 9650, 13616, 3207, 758, 10483, 13501, 9263, 10461, 1274, 10745,
+    2455, 1668, 11155, 4376, 8200, 5848, 11931, 8681, 9196, 4031, 169, 815, 4064, 7004, 8964, 11514,
+    3717, 9619, 1804, 123, 7045, 11250, 13657, 3982, 8442, 10244, 11494, 3375, 8657, 5109, 11918, 7537,
+    6713, 1688, 1702, 6074, 1350, 16, 2822, 4974, 7308, 9085, 517, 10197, 9071, 837, 1625, 6007,
+    10428, 1822, 11941, 10422, 5499, 13356, 7482, 1224, 902, 10906, 4372, 5266, 9946, 4820, 11926, 618,
+    10632, 11976, 13387, 11069, 12554, 4567, 13047, 7347, 1960, 7504, 5019, 13398, 10486, 3471, 5858, 4058,
+    13675, 7798, 9486, 1897, 4883, 6701, 12017, 13321, 9078, 4004, 7336, 1982, 13286, 313, 1109, 5313,
+    1157, 12636, 12485, 5647, 5451, 4199, 6386, 1955, 6810, 7114, 5880, 7930, 2739, 3766, 10353, 5729,
+    4233, 7987, 10650, 2561, 9236, 11404, 12928, 5663, 12927, 8452, 2785, 5489, 2134, 2547, 6447, 6747,
+    7942, 10502, 10869, 10966, 13331, 1427, 3861, 8459, 4515, 12192, 8475, 10894, 10520, 10604, 9895, 527,
+    4911, 3974, 4672, 9666, 304, 2586, 9201, 9906, 11659, 6453, 8086, 8508, 9465, 3406, 12595, 12312,
+    10810, 10731, 2984, 6107, 2186, 2430, 11566, 6110, 5249, 7764, 10991, 2372, 7491, 6769, 1692, 11140,
+    7597, 13701, 8439, 2045, 5478, 3234, 1348, 4025, 11094, 6797, 4779, 3314, 629, 12366, 6281, 2404,
+    8487, 5673, 7226, 11145, 5980, 845, 363, 976, 4527, 2375, 11072, 5823, 7743, 7163, 9915, 5706,
+    7031, 10140, 666, 2172, 7470, 7912, 7740, 11023, 7158, 9088, 7277, 13636, 2039, 1186, 2037, 13319,
+    11542, 5949, 2223, 1556, 685, 12200, 10374, 6067, 13681, 13313, 401, 2811, 4988, 7124, 7133, 2937,
+    4858, 8136, 13706, 7111, 8366, 4151, 12392, 3335, 6279, 8587, 11579, 3548, 5290, 3773, 6470, 3498,
+    11637, 5664, 3323, 7601, 10903, 12164, 9610, 8494, 8648, 12709, 9539, 13091, 2239, 6568, 2585, 8316,
+    10920, 12786, 3119, 9137, 13590, 9347, 4813, 8390, 2166, 2897, 11022, 11794, 12386, 12355, 10186, 1851,
+    6672, 6474, 10703, 12484, 627, 13545, 382, 6249, 8795, 6041, 5810, 4368, 8436, 11770, 4035, 9358,
+    7929, 10680, 7910, 7128, 13362, 11473, 4978, 9796, 4084, 12045, 12489, 10882, 7406, 3595, 11378, 11306,
+    5460, 12497, 11515, 1219, 13755, 7582, 6022, 10618, 5, 3313, 6155, 7100, 13226, 7388, 7890, 8845,
+    11928, 11039, 660, 6792, 2194, 7171, 11483, 23, 10112, 5717, 6394, 10775, 2023, 11957, 13505, 4,
+    6682, 6961, 12863, 1901, 2559, 10367, 2377, 10544, 13414, 221, 1714, 4807, 7689, 5888, 9173, 7642,
+    5472, 11194, 9245, 9686, 7062, 11240, 4317, 7549, 3381, 5379, 8910, 3057, 6676, 13148, 12494, 10968,
+    5597, 11965, 11500, 2928, 12946, 10024, 4781, 12271, 12251, 8947, 12560, 12086, 3541, 3231, 5764, 9369,
+    5606, 9802, 9360, 2858, 6306, 3188, 12765, 13204, 11164, 11975, 8057, 12932, 12618, 12338, 2688, 9055,
+    4384, 8197, 10105, 1053, 13721, 183, 7828, 2825, 1459, 10635, 4133, 6680, 12685, 7382, 7589, 3218,
+    2328, 5626, 11547, 10939, 10386, 12763, 5090, 8141, 9918, 11407, 12880, 11548, 12934, 12639, 5118, 10694,
+    2109, 1695, 3327, 11262, 4088, 4488, 7489, 10190, 11261, 1207, 8788, 624, 12353, 12337, 10983, 679,
+    13033, 5563, 6728, 1966, 7602, 1380, 8843, 9845, 5012, 8399, 10634, 11420, 7787, 9914, 2320, 962,
+    12332, 3021, 3102, 5930, 8706, 10927, 6539, 11689, 5709, 9741, 10639, 8022, 9068, 4039, 7780, 6189,
+    15, 4066, 8875, 5081, 10529, 1225, 7258, 1016, 9153, 5744, 8672, 7801, 6166, 10852, 333, 7247,
+    10146, 6868, 11339, 10607, 7849, 173, 2499, 8858, 13683, 11375, 481, 7922, 1906, 13484, 6936, 13436,
+    1174, 7829, 1280, 13581, 13619, 5544, 11344, 5969, 6638, 2038, 5510, 5634, 12195, 1389, 7572, 6685,
+    991, 1395, 429, 7846, 7091, 2315, 12861, 4038, 6574, 1390, 11856, 12496, 9151, 5014, 10065, 863,
+    7363, 7356, 12335, 13283, 3035, 7528, 4282, 10611, 12298, 11398, 12866, 1720, 8066, 4441, 8655, 7386,
+    2196, 11962, 4257, 2796, 11430, 5093, 256, 10542, 7888, 3902, 3274, 8021, 6947, 3917, 7456, 832,
+    5707, 1471, 11449, 994, 12743, 3104, 13346, 7515, 816, 3760, 4919, 2814, 6858, 3844, 10254, 6485,
+    8887, 3010, 1315, 6421, 1863, 11793, 9952, 2, 9740, 9538, 10804, 6031, 11394, 3858, 6780, 5956,
+    3575, 1617, 10482, 5842, 10994, 3565, 11444, 2232, 2952, 11696, 12188, 7285, 791, 11280, 6408, 9257,
+    9168, 8743, 2174, 9096, 13567, 768, 10641, 8516, 8987, 6013, 336, 8832, 7803, 6117, 11479, 4138,
+    10651, 5091, 11212, 1030, 4986, 5174, 11352, 2781, 9920, 11998, 11336, 8448, 13571, 8097, 2599, 11626,
+    1687, 9139, 5223, 7392, 6593, 4438, 12841, 10546, 8893, 3162, 5518, 10889, 12482, 9775, 12141, 747,
+    11228, 3458, 11244, 10156, 8080, 7999, 703, 419, 3699, 2729, 1770, 6206, 7697, 8264, 9127, 2019,
+    12613, 4292, 1155, 8315, 5681, 1247, 13488, 8708, 8525, 1759, 8707, 12745, 3166, 7854, 244, 8179,
+    8464, 946, 3320, 2966, 2056, 6219, 11204, 7921, 11740, 2903, 11639, 9785, 5128, 8314, 3670, 4095,
+    4367, 8400, 12604, 11769, 5782, 7751, 11050, 2961, 7279, 12770, 2487, 5669, 4524, 2914, 2074, 6867,
+    13596, 2288, 7162, 11401, 9474, 3295, 10740, 7954, 1976, 13161, 7891, 6939, 11983, 10844, 7099, 6819,
+    7199, 9256, 10832, 5757, 2106, 7190, 2556, 1456, 7475, 5382, 1467, 4604, 7966, 1783, 13021, 3544,
+    12606, 7899, 10769, 8546, 1095, 5277, 8632, 11416, 867, 12387, 10817, 10456, 705, 13673, 3481, 9006,
+    2970, 11230, 3084, 10778, 5151, 5704, 9565, 13245, 3678, 13400, 6486, 171, 1292, 7938, 8147, 3269,
+    12769, 3079, 5560, 9249, 4854, 3627, 8326, 2761, 4741, 3967, 830, 12391, 7367, 1222, 7935, 6805,
+    3109, 9082, 13650, 1664, 5926, 10375, 13660, 2960, 8755, 8262, 8957, 10737, 2789, 3385, 6943, 1282,
+    4230, 928, 5157, 12605, 10205, 7473, 13589, 4078, 11125, 13206, 7296, 2829, 10759, 1452, 7167, 5537,
+    8685, 4375, 5221, 7610, 11213, 8388, 3292, 94, 472, 11263, 13504, 49, 2278, 11002, 9134, 4417,
+    3470, 3893, 12434, 6731, 9100, 8351, 4950, 13781, 4421, 3862, 2839, 10132, 4126, 5447, 4480, 6197,
+    12308, 4466, 7383, 13611, 13694, 6371, 8596, 8212, 8151, 4652, 1354, 2257, 12025, 9046, 10543, 8635,
+    6140, 4288, 3361, 8440, 4222, 3535, 9293, 13664, 1385, 7452, 7272, 6873, 1866, 6324, 2359, 7885,
+    2574, 6538, 10660, 11220, 9180, 7623, 7859, 2672, 12319, 4861, 6406, 3846, 1543, 6487, 11784, 4044,
+    4042, 7539, 10593, 8598, 6540, 4293, 11763, 2385, 1465, 12235, 5360, 7950, 12512, 3442, 6564, 8140,
+    5009, 8542, 5105, 1273, 5648, 236, 70, 8812, 9708, 10061, 13155, 3061, 2949, 648, 4529, 13728,
+    5953, 6424, 7033, 5603, 11418, 8441, 77, 9165, 6573, 2736, 7804, 2339, 1630, 9788, 13651, 5909,
+    12401, 5070, 11119, 9027, 7956, 4954, 8606, 7319, 6585, 6334, 2801, 4333, 4856, 7814, 710, 6686,
+    9523, 4753, 11686, 6738, 5836, 5865, 9798, 3418, 2360, 8855, 6172, 9282, 9584, 7576, 4576, 10538,
+    10138, 5781, 10752, 10890, 2636, 11788, 13532, 3823, 12393, 12403, 8990, 7574, 12635, 8623, 227, 7432,
+    10652, 1593, 5765, 7316, 6171, 8027, 8288, 11735, 2424, 4453, 1034, 13630, 12852, 8498, 6291, 13439,
+    8450, 8171, 5630, 766, 3648, 561, 6438, 1399, 1754, 7915, 8518, 3411, 8579, 827, 13219, 10915,
+    1482, 12140, 9706, 12330, 10754, 1707, 10277, 4051, 7182, 8139, 3663, 6711, 12698, 3244, 3148, 7855,
+    10412, 5899, 908, 13143, 6788, 9787, 1332, 10764, 11246, 8471, 10334, 380, 782, 1561, 13249, 1270,
+    6626, 10570, 3332, 8226, 10242, 6660, 9896, 11761, 5722, 9562, 10068, 8219, 12098, 3888, 7997, 3062,
+    10226, 328, 4537, 4572, 1848, 7656, 5161, 12812, 8209, 3290, 3950, 8089, 8011, 4945, 5039, 4209,
+    13216, 11841, 12991, 5254, 1877, 3623, 6202, 6553, 12914, 6396, 9941, 684, 11727, 4862, 4465, 1,
+    4554, 1873, 12833, 6242, 8738, 4943, 354, 900, 2284, 7808, 413, 13292, 1368, 13103, 1731, 13677,
+    3265, 12771, 7739, 6559, 2151, 7757, 4195, 2675, 2584, 3483, 4169, 9451, 8191, 4353, 1638, 7732,
+    11332, 11258, 9967, 880, 1220, 3777, 10034, 1006, 10537, 9927, 8364, 9804, 621, 3016, 2752, 12621,
+    1248, 7105, 5470, 13310, 1468, 9181, 10925, 7334, 12910, 9623, 7495, 1840, 10718, 2356, 1134, 9481,
+    11720, 2299, 3753, 2379, 917, 6992, 6273, 6633, 7052, 1404, 2461, 11894, 492, 5806, 12521, 9662,
+    12479, 12397, 12191, 10148, 2904, 1633, 2220, 9634, 2122, 3991, 7439, 7830, 6796, 10720, 10283, 3097,
+    2577, 998, 4709, 8704, 8759, 1796, 9142, 13005, 6995, 11709, 17, 10818, 9590, 10839, 10471, 4678,
+    12367, 4162, 12411, 8560, 9669, 3937, 9871, 10387, 8500, 4590, 6216, 12172, 13041, 2712, 13415, 11674,
+    10405, 7080, 1841, 1178, 2496, 9086, 12082, 1121, 87, 6978, 7712, 3866, 4448, 5116, 2397, 4370,
+    4821, 680, 2456, 12040, 10092, 8149, 12679, 4181, 9202, 398, 13160, 788, 11575, 1674, 2221, 3601,
+    7309, 1852, 10115, 10303, 2198, 11578, 10346, 4308, 5551, 6450, 10608, 10407, 5304, 13203, 772, 2521,
+    2549, 12067, 2710, 11568, 13063, 3496, 5550, 226, 10598, 12110, 13337, 5445, 13531, 8530, 6607, 9122,
+    5696, 975, 6969, 8730, 9252, 7317, 10779, 6915, 12231, 2653, 11171, 1023, 6072, 13024, 11196, 237,
+    1721, 12046, 5770, 4472, 11652, 3262, 1097, 2938, 13588, 10275, 13805, 1064, 6372, 2512, 4849, 13767,
+    408, 3509, 4002, 9720, 3873, 5829, 12953, 4336, 11603, 5859, 9801, 4823, 7193, 8005, 3546, 7050,
+    655, 5814, 9135, 1635, 4714, 8352, 4431, 5028, 5487, 13700, 2575, 604, 3761, 5854, 12233, 8227,
+    11333, 1130, 1549, 8112, 8302, 7113, 7216, 406, 6203, 4671, 4828, 12108, 2210, 11098, 9859, 5584,
+    3133, 8871, 5992, 9048, 952, 9279, 6475, 13786, 6973, 12462, 12022, 5037, 5315, 10912, 3187, 1329,
+    9150, 12673, 2757, 6997, 1197, 4371, 6901, 12144, 8481, 11923, 6134, 6898, 2061, 11177, 3664, 1661,
+    13427, 2367, 11234, 1671, 2836, 7253, 167, 3611, 9010, 11451, 13068, 2088, 6791, 1460, 8466, 4122,
+    8595, 4424, 6393, 13081, 1434, 10479, 10501, 2817, 7381, 12093, 11293, 11334, 6693, 12858, 5528, 605,
+    13199, 8285, 13530, 12384, 1196, 4287, 10056, 13440, 7561, 10517, 6286, 12981, 12361, 3850, 6754, 4111,
+    1135, 11594, 1910, 937, 12649, 1268, 7775, 736, 11744, 8378, 13489, 9617, 4837, 3045, 2405, 2972,
+    2711, 10039, 10114, 11439, 7731, 13769, 13483, 10877, 8544, 4869, 7965, 10317, 10, 11522, 10990, 9187,
+    12048, 12547, 11109, 7831, 6565, 1845, 1138, 729, 3956, 100, 10526, 7903, 2940, 270, 12378, 5336,
+    12424, 3117, 8134, 4863, 11330, 2087, 6467, 367, 13067, 11633, 9464, 5689, 2707, 3583, 6191, 5783,
+    11628, 1530, 1355, 4719, 2054, 13735, 5902, 10787, 10018, 5059, 7893, 12599, 3452, 960, 10208, 1986,
+    10445, 9953, 10271, 5237, 11210, 2592, 10975, 6478, 1180, 3692, 6477, 12683, 1432, 10258, 947, 219,
+    5876, 442, 366, 5837, 8423, 6833, 7909, 1699, 12058, 8412, 12705, 9655, 13485, 3378, 1945, 9074,
+    1991, 10397, 9399, 9678, 6653, 8891, 2274, 4437, 3446, 11272, 7541, 11888, 6665, 3000, 2942, 12689,
+    13740, 11922, 12197, 4494, 10875, 2869, 12199, 12884, 3973, 9129, 4097, 2413, 5325, 1954, 11818, 4418,
+    10756, 13296, 10910, 8033, 12537, 2149, 9997, 8138, 13131, 959, 4104, 13031, 7220, 8012, 3346, 2129,
+    11268, 10152, 3877, 8776, 10274, 8497, 265, 11589, 11771, 10298, 6178, 4349, 8280, 10072, 4314, 7183,
+    4609, 9816, 12577, 4938, 12797, 10169, 8293, 3214, 12376, 12700, 558, 9186, 1326, 9842, 3726, 6767,
+    9401, 6639, 13287, 3754, 8282, 2764, 6093, 5777, 12167, 4473, 7993, 10781, 12831, 6730, 3151, 3464,
+    4320, 1645, 10131, 1531, 7726, 4323, 12413, 2237, 5439, 12258, 9036, 9161, 536, 1846, 9832, 9377,
+    5033, 10762, 681, 6776, 4419, 12978, 7917, 4130, 13352, 8257, 11507, 8872, 11038, 496, 2319, 12130,
+    575, 8618, 13466, 11385, 12764, 4620, 3607, 10163, 8882, 12514, 790, 13264, 10236, 3598, 4836, 7952,
+    4260, 3160, 1791, 12464, 10281, 2402, 3785, 4121, 2478, 13238, 8602, 4961, 4670, 1589, 10744, 5594,
+    1809, 3812, 3836, 967, 10017, 3825, 1294, 5600, 4351, 12922, 13574, 1011, 4729, 13020, 10631, 11678,
+    2070, 342, 7985, 6335, 10221, 4227, 13773, 1931, 11883, 3516, 12049, 8724, 2125, 3299, 2560, 4771,
+    4374, 2963, 11690, 5825, 4460, 7156, 5175, 3348, 13043, 911, 11425, 6631, 13243, 4913, 1108, 4794,
+    3558, 6529, 8495, 4874, 6572, 13221, 5640, 2463, 1072, 13046, 11384, 2388, 7865, 8374, 10366, 12619,
+    1990, 11892, 949, 13248, 10831, 3195, 13708, 13688, 356, 2848, 11078, 11132, 7140, 2065, 8362, 12611,
+    460, 10857, 11532, 799, 8398, 13438, 3525, 11799, 9164, 7766, 6611, 6941, 2590, 8493, 9950, 2959,
+    9868, 8150, 10080, 9938, 4912, 6930, 1496, 11598, 12438, 3750, 628, 324, 7594, 539, 3108, 11684,
+    13298, 4242, 13195, 9000, 8799, 572, 6594, 37, 5864, 10805, 4931, 583, 5662, 10601, 8472, 9452,
+    1624, 369, 1606, 5402, 6392, 13382, 2327, 4176, 12324, 13562, 9341, 2624, 13229, 11138, 4550, 5024,
+    11597, 8952, 3408, 4637, 6312, 521, 2136, 7329, 8034, 3001, 6042, 9350, 8427, 723, 1042, 5874,
+    11395, 7038, 5730, 2155, 9951, 10678, 10512, 11754, 5281, 8829, 8031, 12551, 11723, 3978, 3641, 3668,
+    9867, 1343, 8936, 8903, 2092, 12582, 10119, 6462, 11661, 8828, 8636, 13638, 9053, 11018, 930, 887,
+    13552, 3240, 9172, 12322, 7481, 9751, 10879, 1441, 12552, 10293, 5935, 11032, 586, 11161, 10229, 11899,
+    11802, 10658, 3644, 8339, 1801, 5115, 11904, 10511, 5392, 11470, 3219, 12356, 818, 8571, 4076, 2217,
+    6824, 338, 7358, 5186, 2099, 4388, 7422, 631, 4390, 8918, 9149, 9462, 9644, 1785, 8456, 11074,
+    10177, 7603, 12867, 9028, 12669, 13560, 7305, 3690, 8970, 6139, 7946, 11361, 11351, 4694, 254, 359,
+    2107, 10304, 8454, 3365, 11364, 13507, 10470, 13682, 12954, 5054, 11040, 8060, 5083, 13528, 11314, 7794,
+    10400, 4985, 3279, 12607, 6865, 12465, 11517, 3585, 4274, 9837, 12034, 12094, 5446, 6809, 13558, 4818,
+    10218, 1098, 13228, 9075, 357, 7194, 10871, 3687, 3205, 13733, 506, 630, 890, 12245, 3651, 4171,
+    10116, 10926, 11917, 5588, 10126, 9283, 11308, 4492, 10833, 6580, 5395, 13409, 134, 2813, 3625, 12969,
+    8429, 2184, 10209, 5922, 9711, 13405, 4834, 6843, 79, 464, 5494, 8391, 8742, 8762, 5166, 4735,
+    3693, 5666, 820, 13606, 8833, 9261, 1832, 10583, 3721, 8299, 2432, 3400, 2018, 5407, 10230, 3852,
+    12441, 4394, 4235, 9208, 11911, 6704, 6576, 6993, 2998, 5111, 4593, 6089, 9878, 5319, 13163, 1784,
+    13631, 6436, 13406, 4876, 7979, 7640, 8428, 11705, 531, 3642, 10908, 109, 2924, 13262, 9030, 3321,
+    2113, 163, 5029, 711, 12544, 483, 5682, 4345, 8592, 12099, 6293, 7151, 3972, 293, 12474, 6068,
+    13799, 1080, 10465, 157, 5349, 822, 7419, 5821, 3732, 1362, 6419, 12528, 7223, 12541, 11468, 7101,
+    7435, 13454, 12417, 12622, 1266, 12948, 5255, 13707, 3435, 1972, 6272, 2916, 2263, 8461, 6456, 13347,
+    8008, 3839, 2826, 4855, 4307, 1743, 9752, 7900, 275, 12432, 8401, 1226, 1116, 3616, 1065, 8886,
+    12088, 6988, 6687, 2976, 6887, 5227, 13121, 9420, 2520, 3550, 12923, 12626, 6916, 9130, 6619, 5977,
+    6847, 5178, 13508, 5828, 3729, 10715, 8048, 1422, 8319, 2145, 12740, 8385, 8898, 10237, 2719, 3463,
+    2445, 10846, 10240, 10530, 2393, 311, 9848, 1837, 7645, 12327, 11611, 3783, 4246, 9636, 1826, 4599,
+    8380, 11509, 11390, 13128, 6489, 8054, 9463, 9902, 13757, 1269, 1736, 7837, 7284, 4769, 756, 3426,
+    8189, 10596, 6893, 5559, 7963, 9440, 3691, 6313, 3041, 2652, 5743, 5522, 9424, 13477, 4941, 4645,
+    1275, 920, 2939, 438, 6758, 10031, 11323, 13253, 5517, 4361, 1425, 10964, 2553, 764, 1548, 5063,
+    5726, 2121, 13139, 4026, 6407, 9558, 13156, 7686, 6733, 9595, 546, 5365, 7407, 6199, 1393, 130,
+    13435, 5234, 5739, 11658, 8050, 12454, 2676, 7948, 3895, 13164, 7437, 4734, 6615, 4395, 2138, 2415,
+    2812, 1192, 1036, 13473, 8728, 4557, 4783, 12, 2185, 5405, 9550, 2008, 9, 4324, 12695, 850,
+    2255, 5309, 2366, 13312, 9823, 12642, 3698, 4743, 11968, 5796, 8792, 177, 9457, 13075, 3224, 8341,
+    2810, 3886, 99, 11222, 11617, 488, 13093, 11736, 7028, 6499, 1450, 4302, 10136, 2212, 11555, 9148,
+    8517, 11992, 6699, 8002, 9388, 10490, 34, 11419, 1746, 4451, 11048, 13467, 11902, 2423, 13384, 5339,
+    5423, 54, 4272, 6822, 10602, 7490, 7027, 3404, 7521, 13200, 6145, 11235, 11895, 8368, 8092, 7304,
+    11503, 9977, 6971, 592, 7703, 6567, 2715, 9367, 1398, 1166, 1581, 4634, 2871, 4960, 1810, 2304,
+    8103, 5011, 8042, 1679, 11851, 4299, 9909, 10468, 12204, 13184, 7178, 6550, 12937, 10837, 12659, 5699,
+    11581, 12508, 7438, 10088, 6374, 3416, 12772, 871, 165, 4833, 9736, 4305, 7964, 8914, 13622, 5873,
+    5802, 1182, 13361, 2297, 1339, 12663, 1271, 2674, 3004, 3853, 11935, 2747, 5337, 4478, 2644, 5809,
+    1899, 1667, 12503, 7174, 5311, 941, 6129, 8320, 10174, 6986, 371, 9847, 10742, 1703, 1652, 1254,
+    5099, 158, 13137, 913, 11162, 10291, 4343, 8853, 3994, 5875, 9309, 13585, 4608, 241, 7992, 2485,
+    13158, 12739, 9581, 9069, 1127, 2977, 12307, 12276, 9047, 6966, 1279, 8545, 8778, 12972, 2538, 1334,
+    8506, 5724, 9696, 8245, 9220, 9021, 13060, 12535, 8787, 12696, 7434, 6003, 11402, 943, 12723, 1553,
+    5220, 6807, 4253, 6764, 6229, 7860, 9532, 12615, 10032, 2227, 6854, 3622, 11873, 2459, 2115, 4795,
+    13597, 9749, 9295, 10802, 8015, 12019, 9661, 1423, 11707, 1415, 3711, 654, 247, 12614, 10970, 10613,
+    9643, 10972, 12295, 6523, 3075, 8896, 12630, 10369, 10760, 10795, 2116, 4458, 11713, 3503, 13599, 2236,
+    8908, 6719, 10487, 13013, 6651, 2069, 3709, 12844, 7002, 1195, 2583, 5042, 5431, 6195, 3814, 10887,
+    12750, 3840, 8125, 3127, 5326, 10667, 10266, 1256, 7853, 11434, 5721, 1778, 9527, 1040, 4540, 1908,
+    3345, 10455, 11725, 11388, 10954, 3958, 10688, 7765, 6670, 7662, 13703, 1831, 13009, 381, 9483, 8696,
+    10580, 2773, 12405, 8432, 11482, 8223, 12993, 415, 8996, 13511, 4968, 9391, 707, 11967, 4531, 2024,
+    4756, 5963, 3371, 9227, 6906, 9384, 1949, 9826, 7612, 1363, 9604, 8678, 10324, 10636, 7440, 13320,
+    10625, 11001, 905, 1579, 7989, 12784, 3124, 1940, 1999, 8277, 5974, 8928, 1745, 4772, 868, 4049,
+    7321, 2768, 4250, 8438, 8068, 10452, 897, 9542, 2436, 12278, 3249, 9945, 1503, 7981, 7219, 1623,
+    8991, 652, 737, 9546, 5961, 5388, 141, 1096, 5409, 11368, 6214, 10677, 1029, 7265, 10776, 12919,
+    6135, 13138, 4258, 2995, 1069, 12147, 12190, 1569, 8539, 2317, 9987, 12198, 12032, 12730, 1170, 2101,
+    13420, 12156, 6934, 12896, 7671, 11491, 4377, 5530, 3223, 3646, 12579, 6827, 4575, 2941, 9023, 11105,
+    4738, 3629, 987, 11602, 727, 1706, 7781, 2563, 4851, 7605, 1650, 6597, 5275, 3674, 4346, 8014,
+    5538, 12364, 4107, 13416, 197, 844, 9743, 3769, 1631, 13213, 11544, 7301, 5558, 13377, 658, 5938,
+    7695, 7443, 5169, 5216, 1519, 13247, 2921, 4582, 9417, 12189, 9063, 6433, 2199, 10193, 11082, 6765,
+    921, 4518, 8167, 1249, 8710, 1859, 12853, 4485, 11066, 4812, 13573, 1651, 12971, 11893, 11900, 9398,
+    10841, 8874, 11543, 11282, 3869, 2695, 6566, 2709, 9120, 8113, 3662, 8900, 5065, 5374, 7957, 13141,
+    7380, 11067, 11053, 7680, 570, 8932, 6355, 12836, 9844, 10004, 3519, 12704, 10793, 74, 7926, 12158,
+    11729, 8669, 8052, 8072, 13592, 3179, 9031, 9195, 2234, 8010, 2890, 4155, 12350, 1515, 7425, 11809,
+    2476, 12550, 7983, 1340, 12357, 7110, 8638, 1653, 8679, 1181, 12440, 13194, 9808, 609, 7217, 6154,
+    1694, 3968, 10287, 11428, 1853, 8713, 6846, 4056, 5141, 10231, 7001, 1272, 763, 13624, 5257, 5013,
+    6012, 3689, 5475, 13626, 3870, 467, 13720, 2545, 7833, 2767, 12702, 6768, 6086, 5948, 13803, 3700,
+    5467, 4669, 7767, 10706, 10788, 5341, 1620, 12219, 7722, 11964, 358, 7505, 6481, 1117, 6491, 4304,
+    11123, 2625, 3591, 3473, 5615, 6157, 3821, 12448, 4112, 5426, 11312, 12505, 5997, 10308, 4534, 2732,
+    1319, 10861, 5659, 4059, 2509, 1608, 2140, 1900, 3467, 6222, 200, 13410, 11791, 1734, 9224, 6058,
+    13097, 5972, 6185, 10010, 6111, 5144, 4415, 10622, 10172, 4447, 8104, 7684, 2189, 1509, 3425, 9237,
+    10561, 2647, 13376, 5425, 6609, 4615, 9703, 5096, 6526, 1384, 5964, 10325, 9472, 8785, 1143, 456,
+    13600, 6180, 8468, 4457, 5832, 13089, 10313, 12625, 1246, 11100, 5957, 12230, 5629, 1062, 4623, 10747,
+    8502, 12800, 7405, 508, 11526, 12007, 11297, 10809, 12390, 3078, 7135, 12349, 11927, 807, 5760, 1738,
+    7144, 8913, 11863, 1917, 2528, 8682, 3409, 12173, 5622, 4904, 4506, 793, 7782, 2058, 6703, 2847,
+    8477, 4981, 13157, 6844, 4560, 4535, 2176, 12564, 1512, 11475, 8325, 4573, 9748, 1951, 5114, 8558,
+    3051, 8144, 3540, 12760, 809, 4925, 12433, 5657, 1090, 8081, 6606, 1924, 10296, 5201, 12096, 3447,
+    2440, 11245, 3542, 12270, 58, 5636, 1204, 6872, 13098, 2620, 10640, 9758, 1236, 7322, 4832, 2713,
+    11000, 8628, 1408, 3226, 11331, 133, 12523, 7616, 10223, 11570, 9125, 3694, 7424, 7788, 671, 6275,
+    8722, 4356, 10184, 6300, 2009, 13809, 12241, 2324, 6932, 12939, 10494, 5018, 4164, 10500, 5495, 5960,
+    5243, 4789, 1244, 6811, 433, 2522, 6090, 10685, 13426, 5146, 3751, 7648, 3306, 3802, 13381, 2909,
+    284, 9132, 2259, 13804, 11619, 12389, 10415, 2334, 9073, 5944, 5989, 9308, 3555, 740, 12125, 3928,
+    10467, 2792, 1762, 7149, 13520, 4072, 7035, 7509, 5396, 5847, 13549, 8863, 2127, 7315, 5793, 11738,
+    2541, 10535, 4829, 744, 6793, 11412, 13635, 9930, 12945, 204, 8281, 13516, 3202, 7500, 755, 8348,
+    12365, 9343, 360, 12507, 12529, 4192, 9178, 8415, 12039, 1378, 8567, 6259, 9575, 5632, 11777, 610,
+    8069, 10015, 12734, 10139, 2486, 8030, 13074, 733, 7733, 7861, 5412, 1338, 10393, 4408, 2530, 6707,
+    9637, 8514, 1077, 3120, 4420, 4928, 1622, 10671, 8026, 1191, 4657, 11847, 2219, 6364, 11621, 4979,
+    12342, 7201, 4692, 2450, 13144, 3708, 1802, 8549, 3363, 2567, 11960, 12292, 10780, 4916, 11300, 3813,
+    6715, 10263, 7297, 11558, 9381, 11988, 10107, 4514, 10195, 176, 3344, 8170, 11745, 178, 6970, 8726,
+    9942, 5361, 1356, 8032, 11093, 5123, 12574, 1297, 6985, 3891, 7090, 10552, 2513, 493, 13407, 8431,
+    876, 6138, 9193, 7579, 1049, 10318, 6761, 8509, 7116, 7115, 6855, 2253, 9035, 11577, 11760, 411,
+    5477, 4689, 10808, 5045, 11767, 7522, 1774, 8608, 11718, 1998, 13715, 5269, 13492, 1122, 6028, 12171,
+    8956, 12882, 1447, 4553, 7186, 12016, 1364, 6360, 11898, 10746, 7320, 13087, 7426, 9116, 4053, 6835,
+    2540, 8624, 9286, 196, 4570, 11131, 110, 2622, 10053, 780, 1206, 10872, 7560, 4536, 1758, 10828,
+    9185, 5462, 13045, 5504, 6375, 5905, 3725, 3445, 7326, 5591, 6357, 7668, 6727, 8215, 9593, 10179,
+    10097, 9889, 13192, 5323, 3658, 5228, 11303, 7313, 2322, 6295, 6084, 11175, 11414, 7520, 11285, 13423,
+    4008, 11366, 2108, 11807, 2489, 1379, 10120, 643, 1568, 3987, 9713, 7123, 12165, 8935, 1835, 3006,
+    2293, 7905, 7630, 439, 5244, 9386, 6740, 8979, 3257, 7870, 5097, 777, 3118, 1750, 2040, 12078,
+    13738, 6265, 6840, 7136, 5798, 4505, 6511, 3907, 4640, 9032, 10168, 11607, 1574, 4565, 12985, 13479,
+    6591, 10001, 2124, 8162, 1387, 13666, 1524, 1994, 12262, 8607, 6821, 6016, 5076, 10761, 1217, 8295,
+    1675, 111, 127, 3524, 9365, 4268, 13150, 13076, 619, 11966, 45, 12546, 2027, 3510, 12738, 8824,
+    9948, 2667, 7720, 8451, 2103, 8218, 9926, 10154, 5861, 242, 11463, 2908, 2064, 3032, 5752, 4966,
+    9917, 4487, 1298, 11441, 6581, 12267, 6723, 7365, 8616, 3450, 12250, 11682, 9616, 1084, 12864, 11681,
+    7427, 2409, 1048, 11972, 11845, 6080, 9395, 13561, 13330, 3818, 8612, 11752, 534, 9765, 5741, 9968,
+    2692, 8556, 5344, 672, 5386, 1070, 11804, 1063, 1208, 6429, 12079, 2233, 12511, 6359, 4725, 11520,
+    13540, 261, 3918, 9184, 10216, 12697, 11874, 613, 4136, 9559, 8496, 13300, 13787, 4710, 4063, 8443,
+    269, 7628, 8132, 10919, 1710, 901, 8575, 9444, 9222, 3024, 11584, 11224, 5620, 9092, 738, 7895,
+    13679, 6584, 10302, 5381, 280, 12742, 6262, 938, 194, 12806, 10574, 10864, 10933, 11557, 12286, 10619,
+    9292, 12556, 12748, 2002, 5903, 8345, 11180, 10158, 6473, 8096, 7011, 5999, 7707, 12380, 4325, 11266,
+    7784, 4767, 7492, 8480, 5894, 2358, 8597, 3034, 6193, 12930, 12886, 8275, 11535, 10022, 11313, 3606,
+    7897, 10858, 11624, 10892, 10937, 5245, 11288, 706, 12837, 1527, 9714, 5514, 7796, 11613, 3280, 3965,
+    8039, 5079, 1027, 8980, 7429, 6353, 8998, 8794, 7872, 12603, 7776, 983, 2249, 7925, 6266, 2331,
+    5768, 6856, 2828, 3981, 12871, 6782, 4583, 2891, 11815, 6683, 11237, 3714, 2818, 1964, 6046, 934,
+    5022, 10089, 9570, 2872, 5155, 3275, 2658, 4703, 8927, 6160, 4223, 11721, 10191, 13189, 4109, 7275,
+    6935, 5687, 7464, 5283, 4866, 3590, 6170, 13759, 7920, 11149, 11092, 5881, 3201, 3286, 10185, 7961,
+    262, 12054, 7658, 6945, 6457, 2425, 1154, 4266, 12992, 6496, 9653, 251, 13293, 12592, 10414, 8425,
+    2799, 4501, 5358, 425, 2506, 6081, 10203, 12620, 10637, 5608, 3484, 3556, 13551, 2637, 12329, 4815,
+    9996, 12133, 12684, 9651, 3037, 10710, 11574, 3094, 2731, 909, 10159, 1978, 1768, 10475, 8639, 1529,
+    6850, 5703, 13632, 2089, 6163, 12460, 10417, 1722, 4373, 6337, 568, 7416, 6965, 4449, 5616, 12616,
+    13431, 9577, 8519, 13309, 12348, 2576, 1145, 2444, 4737, 6307, 5038, 9672, 243, 12629, 1321, 9929,
+    9744, 2261, 4135, 10525, 9991, 7353, 13117, 3317, 2110, 3660, 13291, 2137, 13656, 10953, 12036, 5833,
+    11942, 1227, 6795, 11277, 12123, 11200, 6039, 9870, 3855, 2751, 12647, 7209, 7168, 6052, 10101, 12520,
+    9729, 27, 13048, 3963, 8312, 2880, 2803, 6816, 11341, 1469, 5988, 13036, 5160, 858, 9697, 1013,
+    8929, 12637, 1483, 2911, 7450, 691, 1359, 5049, 2648, 10292, 2246, 6164, 9812, 2623, 8110, 2190,
+    12409, 6839, 13196, 10321, 6956, 4281, 7246, 12410, 6802, 11786, 1860, 6356, 8188, 7867, 914, 5804,
+    642, 11871, 4817, 8310, 13745, 12892, 13502, 9735, 6018, 13553, 4204, 6512, 470, 11004, 10918, 10996,
+    4290, 1200, 7927, 8925, 6411, 5761, 11403, 9284, 7534, 7368, 6263, 10129, 2386, 5218, 9123, 465,
+    4811, 1686, 2601, 1772, 5548, 494, 12100, 7650, 10026, 6882, 11126, 1507, 11914, 8422, 6103, 5767,
+    8342, 10307, 6075, 5908, 11882, 11865, 13256, 6448, 277, 1141, 2353, 5215, 13006, 2400, 7527, 1205,
+    340, 6871, 2955, 9416, 5693, 566, 12418, 8115, 6069, 139, 11616, 13486, 3924, 9504, 8375, 7715,
+    2510, 7227, 8073, 3167, 2819, 3697, 4630, 3986, 6595, 11016, 3582, 5587, 877, 7507, 2416, 12285,
+    4443, 365, 1974, 1937, 9524, 2548, 4998, 5298, 11099, 6562, 10669, 3336, 9586, 10727, 12053, 10290,
+    7058, 2954, 10729, 13739, 13785, 6521, 4562, 3512, 2311, 3833, 4434, 982, 373, 8537, 6755, 5046,
+    7476, 4139, 7288, 9689, 8061, 5774, 6692, 13547, 13465, 4555, 55, 9014, 1202, 4172, 12187, 12986,
+    12996, 6128, 11349, 3667, 5378, 7200, 5578, 5410, 11711, 5929, 7863, 600, 8931, 10485, 6525, 4539,
+    4280, 2295, 10380, 3871, 11298, 1470, 13730, 8383, 5932, 10958, 5226, 8269, 8332, 12333, 6133, 7447,
+    8988, 12868, 10309, 8774, 2123, 7202, 13807, 257, 332, 1346, 2130, 13212, 1914, 5047, 749, 2915,
+    1439, 1691, 7592, 11683, 3353, 2211, 7875, 9314, 10854, 11485, 11028, 7268, 2639, 3904, 1407, 117,
+    5779, 2364, 6582, 10042, 3235, 11730, 11322, 1790, 6186, 1039, 2920, 719, 5448, 7691, 2164, 12102,
+    11552, 10106, 6234, 11104, 12830, 13698, 11731, 5819, 9970, 13419, 7267, 3338, 11890, 2350, 11915, 4215,
+    13073, 12559, 374, 10567, 11638, 6503, 6928, 1261, 13285, 5239, 1360, 9470, 12229, 7233, 3153, 11405,
+    6329, 9910, 7129, 4170, 11632, 3702, 7673, 5835, 2133, 346, 9009, 8880, 9336, 225, 9949, 683,
+    13373, 3053, 6095, 13178, 567, 6726, 12998, 12958, 5299, 13418, 969, 1101, 4406, 11604, 13325, 4999,
+    9824, 5695, 11110, 5491, 13725, 9897, 1435, 3393, 836, 11963, 3734, 7025, 9099, 12666, 9903, 5434,
+    1158, 10734, 9722, 9413, 3419, 8510, 8670, 3988, 13603, 7, 3112, 12170, 9684, 5200, 7493, 5295,
+    10923, 13004, 13752, 5945, 5171, 6062, 10091, 12963, 11539, 9552, 7669, 9984, 8309, 13441, 11647, 8372,
+    10952, 12439, 7820, 7260, 5851, 5066, 2296, 2488, 11492, 5686, 12300, 10786, 4398, 4691, 10748, 2794,
+    4946, 8698, 4627, 4688, 8236, 9834, 7976, 12404, 451, 2823, 6325, 11860, 12805, 11789, 9065, 10194,
+    9778, 1416, 2762, 5925, 8359, 10772, 9601, 6459, 1177, 13240, 10867, 4814, 10064, 6322, 5658, 7376,
+    5236, 4951, 8241, 7445, 12711, 6746, 6102, 2994, 6785, 1985, 3562, 11792, 6382, 1555, 5612, 7663,
+    2680, 4461, 5355, 250, 10073, 8370, 7061, 6621, 118, 7127, 2033, 9290, 13652, 2619, 2740, 2222,
+    3307, 7310, 9723, 8953, 6974, 3174, 3547, 9705, 10323, 6669, 9681, 1928, 3763, 7225, 6230, 4191,
+    8603, 5188, 4389, 9694, 4959, 12240, 787, 13463, 6654, 4775, 7106, 3403, 4675, 10261, 970, 5734,
+    2429, 4965, 3822, 12225, 11816, 452, 325, 13413, 12664, 9554, 1682, 5727, 13766, 7375, 5887, 6232,
+    2035, 3297, 2964, 8225, 714, 7573, 4144, 11646, 10389, 7138, 7531, 8329, 9766, 4118, 5272, 12872,
+    6040, 12273, 10941, 4006, 12024, 57, 10649, 540, 7134, 12888, 13209, 6317, 12857, 10224, 426, 2802,
+    3125, 4724, 9502, 6417, 12513, 3867, 9923, 12202, 7016, 1310, 13040, 6608, 8109, 8746, 1765, 5990,
+    10610, 1771, 9979, 6118, 12263, 10484, 5803, 11287, 1100, 8555, 5454, 2742, 814, 8228, 9835, 2843,
+    3804, 7146, 6760, 5087, 13737, 5797, 3567, 6752, 455, 11392, 6054, 12979, 3990, 5385, 9334, 7314,
+    10510, 2207, 9919, 6520, 10130, 2572, 1890, 10423, 1564, 5942, 10406, 468, 5795, 4249, 13116, 4936,
+    1554, 13515, 8479, 350, 7302, 7086, 6252, 2565, 11929, 13396, 9647, 870, 13218, 1313, 6021, 13610,
+    12498, 5697, 2085, 2292, 2100, 13397, 9518, 1685, 8503, 1812, 10176, 13495, 3883, 9813, 4342, 3341,
+    12085, 1811, 4955, 1019, 5194, 2081, 5390, 5937, 11712, 5965, 2408, 1571, 11813, 13251, 5342, 12931,
+    12530, 2090, 8239, 12717, 1894, 12074, 13665, 13663, 6658, 10102, 7441, 9192, 11243, 6592, 2578, 8340,
+    8190, 12890, 10662, 8995, 1523, 4825, 7009, 722, 8243, 11795, 1243, 7188, 9760, 4183, 8291, 11837,
+    1179, 8355, 3868, 10373, 7248, 13112, 10515, 65, 5660, 66, 11291, 9434, 9265, 6288, 2804, 12493,
+    10381, 1250, 2953, 6445, 2816, 10545, 7071, 3049, 10045, 12569, 9940, 3903, 6557, 2275, 3744, 9716,
+    3394, 5715, 4306, 12059, 11561, 10466, 5377, 2229, 6892, 13775, 10178, 8389, 13111, 7988, 6958, 8270,
+    13026, 13777, 8533, 2282, 6784, 689, 8207, 6534, 10934, 2015, 4392, 1558, 441, 6030, 5142, 6913,
+    10917, 2669, 1769, 12091, 1598, 6695, 7654, 8250, 266, 5618, 3530, 5080, 13687, 9548, 2931, 1905,
+    4659, 2706, 12610, 5904, 10170, 11383, 12943, 12118, 10058, 6283, 3727, 9654, 3656, 11381, 997, 2142,
+    376, 7053, 1538, 7281, 5282, 4591, 2749, 1621, 8392, 6029, 4720, 8766, 7374, 12977, 11600, 10554,
+    9038, 12733, 7708, 5984, 910, 450, 2935, 4774, 8076, 107, 13704, 7187, 2053, 3185, 9355, 12236,
+    13169, 13434, 4516, 2666, 6187, 6398, 11427, 10488, 11059, 2381, 7679, 12213, 9084, 1828, 5892, 10093,
+    9033, 4120, 10951, 4020, 4482, 11987, 4528, 712, 4778, 12501, 9983, 11538, 1289, 8552, 5359, 3287,
+    4894, 3395, 2067, 1188, 6712, 8253, 7730, 3302, 716, 11858, 3443, 803, 4098, 10365, 2702, 6409,
+    13393, 9467, 12369, 3537, 3808, 6770, 12935, 3507, 7264, 12103, 10988, 3957, 9210, 5305, 13239, 1781,
+    5256, 7109, 4050, 249, 757, 11592, 4474, 4239, 9541, 9887, 1228, 7479, 11154, 9734, 9668, 7047,
+    5437, 446, 3676, 4423, 12767, 4716, 13125, 1669, 3012, 8905, 10396, 5150, 7667, 5643, 13168, 4619,
+    4561, 9691, 5172, 295, 13472, 3289, 4301, 8883, 322, 11289, 10410, 8834, 1559, 8714, 4668, 2958,
+    499, 6495, 6063, 10360, 2213, 9468, 2289, 3759, 2468, 9618, 11380, 3782, 2473, 3164, 12218, 3645,
+    1499, 11635, 1232, 4263, 10722, 6403, 9479, 11753, 4256, 12294, 13140, 3579, 5543, 9767, 8234, 4504,
+    9133, 12790, 12062, 6440, 3459, 11029, 9774, 6316, 12821, 6588, 4835, 5124, 12876, 9300, 9428, 8793,
+    1709, 5067, 12703, 5562, 10143, 6350, 2965, 8099, 5122, 7189, 1715, 5372, 7511, 7352, 1490, 5219,
+    5952, 3291, 2396, 7822, 7696, 1878, 8084, 4740, 9254, 10767, 9002, 13726, 11680, 4655, 6391, 12186,
+    10539, 7617, 12671, 6184, 6430, 7446, 4897, 2376, 10835, 3392, 11501, 6302, 2112, 3859, 3293, 6045,
+    210, 3171, 4321, 1898, 4116, 5546, 3703, 3122, 12975, 4229, 6019, 926, 12385, 5117, 9276, 5170,
+    9534, 806, 1843, 9226, 8176, 11673, 11467, 7102, 12033, 9700, 3340, 2314, 9656, 2917, 5183, 12153,
+    8694, 4385, 9385, 2665, 4721, 11826, 3635, 7934, 8424, 12677, 6400, 7485, 5329, 13563, 3860, 1988,
+    13038, 240, 1916, 5815, 13491, 10337, 7693, 10438, 1681, 10739, 4918, 6957, 12761, 6414, 12955, 6361,
+    13736, 10878, 3002, 8561, 8346, 3799, 927, 6908, 11846, 12290, 12907, 12143, 11347, 5978, 7299, 6679,
+    2479, 13783, 4316, 4363, 3248, 860, 8358, 48, 1497, 2689, 545, 11505, 885, 8982, 201, 170,
+    12594, 3068, 4942, 12179, 2323, 6010, 12255, 10331, 12516, 1582, 4240, 3794, 10096, 10555, 12121, 13430,
+    10033, 2887, 11143, 10006, 7335, 4588, 7283, 5485, 1071, 682, 10285, 6455, 1454, 7117, 554, 7458,
+    2557, 11588, 13710, 7774, 8984, 1324, 11641, 10901, 2214, 13659, 3528, 11350, 11790, 637, 3180, 8328,
+    9026, 3199, 10082, 7241, 9087, 13763, 9529, 7346, 9814, 1172, 9060, 6648, 2484, 9635, 3490, 13327,
+    1400, 12449, 6510, 12360, 4902, 10409, 13523, 10137, 12430, 1773, 12381, 4650, 8305, 10726, 1371, 10200,
+    11909, 1850, 11251, 2684, 5184, 1493, 13359, 11442, 9171, 11510, 11989, 12899, 5074, 11697, 36, 2394,
+    1304, 2224, 4106, 12116, 5253, 9886, 11037, 6236, 2041, 6671, 8699, 6087, 3559, 2912, 8265, 5333,
+    13306, 12089, 10790, 1977, 1312, 10048, 5302, 12003, 10981, 2725, 11294, 4254, 9144, 7543, 4908, 7717,
+    12139, 9004, 9410, 7369, 2495, 6280, 13154, 7513, 7619, 1879, 2076, 7806, 4454, 7660, 2933, 11083,
+    6632, 2870, 8206, 2533, 3064, 3309, 7023, 5801, 8992, 2086, 12265, 1485, 7401, 122, 1825, 7400,
+    116, 10853, 7120, 8767, 1616, 2815, 2879, 4878, 12451, 8689, 13654, 5604, 3655, 6524, 3422, 6168,
+    2007, 3942, 1136, 3260, 4309, 2438, 10944, 9928, 4303, 8615, 5314, 3618, 5671, 10311, 2983, 7945,
+    2500, 12834, 5526, 3538, 119, 8108, 12398, 9473, 4341, 1590, 12420, 276, 12982, 10943, 2854, 590,
+    4636, 4312, 8942, 11346, 8035, 11459, 8614, 9089, 3993, 10206, 7941, 10559, 10081, 2550, 8869, 9838,
+    1045, 11782, 4435, 7244, 10609, 9143, 11088, 11496, 2387, 4639, 11504, 4085, 2703, 5134, 4548, 12252,
+    2717, 9841, 9863, 8118, 10362, 5996, 9259, 9762, 8360, 5794, 1012, 268, 2066, 9852, 11324, 5845,
+    537, 2746, 2536, 4810, 896, 5442, 3138, 8948, 5505, 8411, 5911, 5040, 8347, 10736, 9911, 3909,
+    4407, 1075, 3576, 11436, 13265, 11912, 11679, 4842, 10051, 7692, 1959, 3048, 12665, 287, 7237, 10074,
+    6756, 7835, 9323, 5745, 10549, 12075, 5863, 2238, 8590, 2615, 526, 10575, 8583, 4210, 137, 434,
+    8420, 10626, 3033, 813, 985, 1067, 518, 5415, 10222, 11513, 217, 13269, 9219, 7551, 9039, 3331,
+    391, 2407, 5998, 5010, 11495, 11903, 12266, 1718, 7876, 2410, 7249, 9305, 2434, 9419, 10225, 1301,
+    3705, 12940, 9415, 9301, 5654, 8173, 4166, 9695, 9750, 339, 9167, 4661, 1935, 7468, 3444, 2956,
+    2923, 9231, 11086, 12810, 335, 11203, 5317, 3430, 11121, 13577, 13471, 1443, 7526, 12687, 4275, 9598,
+    2348, 13186, 7857, 9111, 12368, 8974, 1654, 2827, 8958, 1787, 9108, 5890, 9327, 6948, 5387, 3914,
+    11011, 6990, 7465, 9543, 11862, 3462, 12445, 12212, 11722, 187, 6736, 7690, 7206, 7003, 11907, 5165,
+    1046, 5153, 3577, 12845, 12446, 9514, 4702, 8505, 7483, 4558, 6200, 12120, 98, 7928, 9215, 5877,
+    3798, 7017, 13369, 12568, 1093, 4546, 2670, 1871, 7254, 9425, 6536, 6401, 13802, 3088, 12856, 13353,
+    7858, 205, 2996, 10363, 8003, 3677, 12363, 8960, 8070, 4503, 8944, 13305, 2453, 13653, 8213, 560,
+    2833, 8866, 10599, 4909, 2610, 2621, 13303, 12414, 12904, 12374, 5471, 11173, 1291, 5712, 5286, 3486,
+    865, 4470, 12875, 4037, 3085, 1797, 13800, 3885, 4083, 4047, 1132, 1209, 8950, 6781, 10724, 12296,
+    1757, 6817, 2048, 9913, 3563, 7769, 10569, 3602, 7664, 3947, 8972, 10707, 4903, 4770, 3984, 6741,
+    9989, 3621, 2519, 13510, 10524, 1112, 3499, 13268, 2276, 5383, 7235, 11305, 13699, 10003, 11345, 6261,
+    2646, 1953, 13127, 5539, 5334, 11487, 8939, 1105, 11206, 10962, 11024, 10834, 12097, 9484, 9319, 10214,
+    6427, 8690, 5534, 6998, 10738, 9769, 1433, 4746, 6471, 8393, 632, 8538, 13514, 7131, 4030, 13032,
+    9478, 765, 11374, 12691, 1565, 6786, 7824, 383, 13383, 1104, 9849, 4860, 10113, 10675, 1417, 12101,
+    4870, 11990, 11058, 9442, 6059, 6264, 12345, 312, 10995, 13425, 2153, 9109, 4791, 1884, 12874, 3545,
+    13388, 2947, 9525, 4696, 7615, 5213, 1405, 8877, 9394, 12037, 11389, 4744, 5541, 12720, 9197, 5168,
+    2507, 9981, 8272, 13225, 13629, 9840, 9937, 4647, 12600, 9515, 10340, 11695, 6721, 1495, 13134, 347,
+    1148, 11450, 2582, 2877, 11169, 4357, 389, 8512, 1730, 5217, 4194, 12377, 1238, 5036, 2699, 4145,
+    10055, 9739, 11550, 3666, 11461, 4208, 11516, 7823, 8934, 965, 13470, 10401, 5637, 7418, 4610, 7323,
+    11829, 1349, 7170, 12095, 5278, 8458, 11329, 11921, 9885, 2800, 8290, 699, 234, 5979, 498, 10276,
+    9040, 6233, 8719, 2514, 9298, 12788, 11955, 11835, 9817, 9110, 13808, 10358, 6204, 3671, 12644, 4382,
+    4052, 751, 2774, 732, 9853, 4090, 3136, 12419, 5179, 9016, 2693, 11054, 4681, 102, 203, 5641,
+    3225, 602, 6327, 5293, 4683, 5052, 9500, 10383, 8244, 7694, 1372, 717, 298, 10453, 13669, 8037,
+    12291, 6929, 1147, 7433, 988, 9177, 3551, 2728, 11969, 13750, 557, 12331, 9521, 10047, 6823, 7682,
+    10825, 4216, 5583, 9861, 3701, 6818, 4780, 199, 1907, 7713, 8161, 4982, 1183, 1444, 13615, 12851,
+    3560, 12782, 5817, 6383, 318, 12077, 7046, 13114, 3414, 6684, 13003, 4706, 4225, 7974, 2428, 8242,
+    7652, 6735, 9770, 4069, 5921, 9154, 2975, 4611, 10827, 4890, 9372, 6926, 13058, 10382, 3206, 3502,
+    12287, 11012, 10431, 10430, 11897, 10217, 9145, 3330, 11716, 5678, 12758, 9566, 8074, 13536, 9364, 5679,
+    4277, 899, 9373, 1038, 410, 9916, 473, 12826, 12785, 2735, 9600, 7524, 5077, 1528, 8168, 1284,
+    13367, 3236, 11186, 1968, 5627, 6509, 10474, 13595, 9699, 308, 12318, 5071, 6652, 10016, 13689, 186,
+    5366, 5468, 5455, 5075, 38, 7556, 2598, 6666, 7984, 11850, 7271, 6237, 12452, 3952, 9768, 3916,
+    6387, 2687, 7626, 11554, 8897, 11190, 10814, 1253, 10027, 7153, 4259, 1647, 3091, 1296, 3628, 9621,
+    4360, 13266, 2191, 12163, 724, 13812, 10572, 4765, 301, 556, 5574, 2554, 2708, 3649, 13579, 13083,
+    2690, 6667, 9330, 10029, 124, 8462, 10035, 10578, 2321, 9056, 1719, 2380, 12725, 11612, 1161, 9828,
+    10896, 6309, 4712, 6635, 3043, 9378, 7729, 9278, 12124, 3633, 1836, 1010, 8384, 2573, 11620, 5233,
+    1662, 11091, 6381, 10679, 3401, 3929, 10576, 3944, 1113, 2084, 1666, 2634, 2564, 5788, 6142, 8395,
+    10550, 9693, 355, 6079, 4425, 4578, 162, 2206, 1888, 1560, 9757, 8047, 12842, 11585, 11836, 7705,
+    12747, 6150, 5006, 3298, 6441, 13282, 10426, 3593, 11150, 11443, 11326, 12795, 3743, 3015, 13713, 12423,
+    8586, 5542, 8085, 3277, 13774, 10657, 7621, 1091, 760, 3919, 26, 7892, 13557, 10519, 11408, 4152,
+    9034, 3913, 2126, 5676, 2361, 811, 13078, 9517, 2072, 718, 7259, 9572, 11391, 7306, 8809, 728,
+    3639, 9255, 4224, 9454, 10355, 1634, 9331, 6629, 5540, 11643, 5623, 11386, 8298, 6555, 713, 4595,
+    2351, 2362, 6484, 12701, 8278, 4024, 3421, 725, 9212, 8180, 10121, 24, 7702, 10551, 796, 11699,
+    601, 9288, 5263, 7097, 990, 10533, 10182, 13297, 11688, 3095, 8727, 9677, 7611, 9441, 11869, 804,
+    6759, 4045, 8941, 1727, 8701, 2421, 4137, 12340, 6675, 11855, 10127, 10603, 3173, 3154, 2651, 12779,
+    6, 4843, 3310, 7940, 2913, 11747, 7177, 13642, 1970, 3343, 13207, 2228, 6976, 10676, 5068, 2235,
+    7873, 3514, 12232, 2777, 9356, 11051, 7300, 11348, 191, 11015, 4915, 6783, 8613, 189, 12487, 6141,
+    13476, 3685, 6734, 520, 11821, 7542, 6439, 12581, 13152, 10628, 3466, 3110, 13779, 4648, 5120, 12901,
+    1526, 13153, 3322, 1920, 12840, 11591, 1052, 6017, 5719, 638, 11908, 9947, 8322, 3940, 6492, 13751,
+    13608, 12476, 11648, 5820, 11553, 13270, 9414, 12207, 7399, 4426, 13333, 1311, 8182, 444, 3176, 7093,
+    13644, 4542, 8224, 1673, 4490, 8981, 7771, 11627, 9157, 8664, 2457, 12408, 11362, 676, 11295, 11188,
+    4935, 10049, 7041, 9974, 8178, 10141, 4698, 14, 180, 1583, 9140, 448, 3211, 8129, 12443, 12214,
+    3970, 675, 9820, 784, 10416, 3099, 2885, 12504, 11205, 7345, 6047, 4658, 3377, 6799, 7130, 418,
+    6596, 10836, 5839, 12038, 12447, 4201, 5646, 1660, 9630, 2462, 2987, 6831, 5613, 9809, 4331, 2784,
+    2309, 1318, 579, 1780, 12974, 1278, 11820, 10973, 6577, 8651, 5102, 6642, 2055, 1486, 5680, 7290,
+    6267, 7179, 1748, 1868, 3566, 7393, 10816, 1262, 502, 4603, 5416, 6578, 10765, 12306, 13498, 12321,
+    13302, 12490, 3369, 6857, 6659, 13756, 6852, 5242, 693, 10998, 9310, 390, 12517, 7147, 7176, 6228,
+    10859, 7196, 12843, 13193, 13375, 12793, 8486, 4251, 8485, 11906, 8652, 4005, 10840, 3757, 2867, 12061,
+    4217, 6702, 8749, 5461, 4027, 7010, 1592, 7349, 5652, 13422, 6853, 5369, 484, 8641, 2418, 11033,
+    754, 1744, 13392, 3113, 9862, 1983, 9827, 5145, 1827, 9041, 8983, 7404, 8267, 4124, 5906, 8183,
+    8786, 12811, 5306, 378, 4205, 4809, 7160, 3155, 1518, 1419, 4175, 11499, 7677, 6044, 3399, 800,
+    695, 7959, 2256, 7599, 6944, 11610, 8294, 10235, 13637, 9357, 3939, 135, 7706, 10799, 3329, 5260,
+    214, 13258, 6820, 1891, 3980, 1066, 6148, 11925, 5417, 6472, 6009, 7044, 2083, 3788, 7864, 7797,
+    3441, 8344, 8484, 5340, 10924, 4101, 3025, 5229, 10134, 5786, 13274, 5481, 3063, 2030, 10753, 1022,
+    6147, 2846, 2980, 1024, 9029, 8019, 3533, 8933, 13290, 4409, 7735, 5900, 4040, 2766, 1861, 688,
+    3069, 1494, 9374, 2793, 12586, 11415, 1875, 3826, 1474, 3889, 7238, 2077, 2225, 211, 4757, 11562,
+    4009, 8923, 8094, 1436, 9535, 3263, 9156, 7839, 3897, 13260, 13474, 9077, 13795, 9339, 8123, 8879,
+    9091, 1909, 798, 4196, 10339, 3359, 2992, 2993, 9338, 11800, 13598, 2682, 1723, 9533, 11417, 1357,
+    4507, 13566, 7311, 12379, 8067, 3998, 3605, 1886, 3665, 7969, 5867, 11327, 9561, 11645, 8814, 11455,
+    1876, 5107, 12759, 6808, 6902, 9776, 8336, 5567, 5430, 3738, 11924, 2859, 131, 7538, 8122, 7536,
+    3768, 11824, 8238, 10173, 5531, 8177, 4601, 4848, 2677, 11687, 1932, 9549, 80, 9368, 1056, 12282,
+    10312, 10435, 11198, 7451, 4296, 12617, 13746, 10673, 7832, 3362, 11530, 11377, 2470, 13056, 4864, 8040,
+    6177, 402, 7085, 6248, 11316, 12999, 781, 1099, 11278, 3675, 6109, 4291, 5138, 1854, 3878, 13634,
+    3857, 5919, 3653, 6023, 8621, 7506, 2097, 11758, 11084, 3007, 3026, 10516, 7753, 9707, 12072, 9277,
+    142, 6920, 10300, 11147, 3805, 403, 4759, 10189, 10666, 5262, 5702, 10946, 6422, 73, 4429, 9079,
+    8163, 8511, 7633, 82, 1712, 12608, 5421, 1689, 11743, 8408, 6698, 1168, 501, 10122, 9268, 11253,
+    516, 8414, 9624, 4344, 9746, 278, 11991, 7558, 2159, 9043, 13748, 7415, 4379, 12128, 11528, 7916,
+    1426, 12924, 291, 4247, 6354, 1814, 3561, 13252, 12562, 2357, 12030, 6575, 5173, 5571, 12707, 13576,
+    6490, 8405, 9326, 11889, 4900, 3479, 1611, 2340, 4523, 10439, 5723, 3103, 10581, 6940, 8018, 279,
+    10059, 7078, 3300, 6991, 12862, 3107, 5924, 6376, 12873, 9815, 8194, 7904, 8723, 13108, 5056, 4584,
+    1847, 6504, 10117, 11142, 10165, 4237, 3501, 10379, 5110, 10378, 5692, 2369, 6880, 491, 5731, 9657,
+    7826, 12938, 11178, 10385, 283, 13172, 13709, 1175, 3827, 5780, 13090, 9663, 10630, 11259, 9175, 9531,
+    2095, 4840, 12776, 1088, 11651, 10674, 3586, 1240, 6890, 11207, 6258, 1732, 7523, 13364, 5466, 1087,
+    8819, 673, 13263, 3165, 5084, 1823, 1815, 1309, 2716, 3397, 6710, 4071, 12028, 2098, 10902, 12383,
+    10668, 8909, 8127, 13696, 3281, 7754, 1993, 13360, 2698, 4643, 3388, 977, 4180, 3574, 10642, 5769,
+    11013, 2307, 958, 1076, 5808, 509, 105, 6174, 5611, 10000, 6778, 5044, 13448, 7565, 5258, 11590,
+    10012, 8617, 13326, 2589, 384, 5318, 2664, 7250, 5370, 6136, 8157, 2178, 8732, 2034, 4885, 5639,
+    11950, 6161, 2883, 11144, 7552, 7793, 11502, 5181, 3264, 12341, 9059, 7795, 1462, 8550, 8232, 13069,
+    10749, 11255, 739, 9961, 2332, 3170, 13096, 925, 4525, 580, 9894, 8907, 13162, 5030, 3056, 2723,
+    2720, 372, 8973, 6771, 2654, 5108, 2778, 2820, 11569, 2477, 4087, 4400, 7229, 10789, 10563, 4886,
+    9337, 8523, 1544, 11974, 922, 13181, 10541, 2835, 3390, 6579, 13499, 6057, 9574, 3597, 8535, 6729,
+    10062, 1586, 6020, 3221, 2265, 4654, 13053, 7819, 1895, 11127, 9603, 5324, 1763, 1185, 2179, 9011,
+    9631, 7635, 10977, 10684, 7107, 7756, 805, 3995, 12929, 2982, 13332, 3036, 13180, 13149, 7501, 4594,
+    8404, 2165, 6482, 9370, 2013, 5644, 6960, 264, 11, 7554, 10960, 596, 4731, 12174, 715, 13044,
+    424, 9683, 3534, 12272, 12933, 7212, 10078, 4187, 407, 599, 5694, 4707, 5633, 7043, 802, 11225,
+    8961, 2726, 3014, 3086, 11916, 12009, 13429, 5576, 11938, 13380, 3083, 6239, 2458, 2200, 9380, 12149,
+    12712, 1414, 12575, 3055, 8397, 3282, 12624, 7104, 388, 1508, 6535, 6964, 12960, 3837, 8884, 2649,
+    708, 5132, 522, 13272, 9448, 1133, 9620, 10624, 13538, 10245, 8562, 1842, 2226, 1020, 5790, 8185,
+    2044, 8491, 3478, 3657, 13724, 1287, 5496, 3765, 3728, 12135, 4220, 10606, 11367, 825, 875, 11070,
+    13647, 7073, 12645, 1156, 3673, 10424, 13145, 4450, 11264, 13363, 5677, 1477, 7913, 8581, 11429, 8817,
+    9285, 6905, 11179, 9114, 2782, 4335, 479, 9070, 13693, 6113, 9779, 85, 9115, 1663, 5224, 7944,
+    6803, 3854, 6366, 2990, 10770, 1092, 2003, 12256, 2981, 972, 12221, 10347, 11424, 11445, 2017, 10008,
+    678, 4977, 9346, 7421, 12495, 12658, 8692, 3976, 10108, 13613, 1915, 6694, 4231, 10784, 12891, 8739,
+    2882, 3495, 2973, 10914, 11176, 541, 326, 9107, 9155, 3911, 11211, 9904, 7026, 4881, 7054, 10723,
+    1286, 2943, 4471, 11433, 4853, 4605, 11108, 1676, 10843, 2117, 4500, 4651, 1733, 8765, 7503, 6801,
+    10548, 7844, 6514, 1085, 12961, 7040, 7397, 13001, 10202, 4952, 9214, 9936, 3432, 10278, 7088, 11187,
+    3031, 11218, 6127, 10605, 9935, 3961, 6907, 10125, 13754, 12325, 1438, 1078, 6980, 13678, 3922, 11340,
+    1032, 7192, 8268, 3315, 5661, 3659, 7228, 8256, 331, 5316, 9324, 552, 2783, 11166, 5300, 3354,
+    10562, 12714, 13645, 4787, 866, 9671, 11954, 10801, 5444, 5363, 13175, 2662, 5775, 12253, 5276, 9573,
+    9957, 8642, 11363, 3935, 5187, 6984, 1403, 8087, 971, 7901, 10974, 2845, 3111, 2205, 1057, 2971,
+    4664, 13223, 5191, 10698, 11081, 2391, 3009, 3843, 2979, 6924, 3208, 1276, 305, 4763, 4544, 8804,
+    11693, 8781, 3599, 2884, 8859, 3487, 10044, 8296, 9061, 3494, 11580, 5308, 5991, 9846, 2303, 4462,
+    6446, 11702, 1975, 10038, 12027, 12223, 11823, 8856, 13618, 6982, 7646, 10985, 9944, 5148, 9404, 8709,
+    5555, 9702, 2156, 1189, 5521, 1912, 3933, 11052, 8098, 980, 12336, 9005, 4804, 5691, 7125, 13230,
+    9829, 5720, 5502, 6224, 2403, 3194, 4241, 5545, 12913, 5205, 6292, 1680, 4014, 12168, 8789, 10826,
+    1767, 9121, 13814, 5113, 12304, 5185, 28, 13231, 1584, 951, 9943, 551, 7518, 608, 9998, 6347,
+    2251, 6959, 4889, 12557, 7118, 8751, 10592, 857, 13609, 9688, 13317, 5580, 8605, 6826, 13791, 2330,
+    4475, 1696, 4602, 10391, 11685, 11567, 13064, 4580, 271, 11090, 2452, 5297, 7960, 2896, 6276, 4267,
+    6590, 11844, 3186, 1545, 1123, 5609, 4444, 13744, 10733, 12436, 7181, 3745, 1159, 12686, 13749, 13072,
+    9800, 686, 692, 2780, 1203, 7436, 11970, 2167, 12657, 5732, 7423, 7512, 6513, 1742, 7205, 2523,
+    2697, 6173, 2078, 4093, 2608, 13350, 7263, 12134, 4127, 7092, 1604, 4847, 4036, 6257, 3474, 8671,
+    6532, 10664, 5202, 6332, 6060, 3115, 2807, 4617, 10429, 4873, 10268, 10345, 1429, 8846, 12012, 4641,
+    5041, 5073, 8078, 3803, 1973, 13734, 12422, 11046, 9490, 8261, 5869, 7261, 9097, 9877, 5015, 6804,
+    10228, 3273, 8870, 9978, 10314, 10124, 8633, 7755, 5162, 6909, 11814, 4940, 13447, 1283, 2770, 7636,
+    932, 9042, 5656, 7665, 3581, 2368, 89, 12354, 4733, 2900, 1473, 6384, 3144, 6211, 10822, 903,
+    721, 7169, 7882, 151, 5312, 5094, 6188, 6443, 3996, 327, 1799, 6152, 12549, 3638, 8106, 10743,
+    13171, 11488, 11152, 2967, 334, 9322, 3228, 11056, 7972, 13010, 1927, 7815, 10558, 8857, 4827, 886,
+    12727, 10976, 13151, 4932, 2535, 8249, 9784, 6217, 6092, 5983, 7883, 11739, 3747, 12050, 12838, 7191,
+    7568, 11831, 9807, 617, 7351, 10473, 18, 3082, 4934, 13208, 944, 7454, 3272, 11118, 10942, 10504,
+    8625, 906, 11034, 8303, 7790, 5408, 2333, 13016, 9547, 4410, 9858, 330, 9675, 2907, 3087, 9939,
+    12553, 929, 1489, 13527, 3620, 4123, 482, 1308, 7827, 7749, 6700, 6115, 3810, 6690, 6637, 1001,
+    7994, 13165, 8784, 5958, 12299, 5649, 3493, 5208, 4568, 11435, 5207, 13106, 9980, 1557, 3134, 5209,
+    4693, 7210, 3101, 2163, 1956, 12548, 9176, 3900, 9397, 3245, 2855, 5971, 1761, 11546, 7294, 11833,
+    6851, 7813, 2290, 12510, 10166, 8490, 3901, 12315, 10335, 399, 6900, 6798, 1028, 13722, 9147, 7818,
+    2460, 8654, 11447, 10007, 12726, 2518, 4898, 7084, 12674, 13452, 9456, 11116, 12648, 3216, 1241, 4484,
+    6034, 7075, 9281, 1521, 9362, 13183, 2426, 12142, 6531, 9379, 7676, 9485, 3631, 7670, 8674, 1481,
+    6605, 3222, 2497, 4715, 9291, 9403, 9608, 3755, 8463, 9710, 2187, 7914, 12774, 7762, 13323, 3789,
+    10571, 659, 8566, 7213, 5164, 11832, 377, 3515, 8090, 3571, 13187, 9988, 11281, 6162, 2281, 3614,
+    635, 368, 3380, 1992, 5274, 7517, 1729, 6897, 8551, 6132, 3427, 4597, 12006, 7651, 3372, 13478,
+    9879, 5638, 10829, 2999, 10057, 231, 10199, 5149, 13810, 1923, 6285, 514, 2395, 8540, 3076, 10493,
+    6547, 4685, 6937, 129, 12176, 2272, 7850, 10838, 8181, 9912, 430, 72, 13462, 10880, 1649, 7809,
+    5104, 10342, 13115, 4184, 8260, 8683, 337, 7962, 1816, 6243, 8697, 5753, 6461, 7724, 7142, 2868,
+    13124, 7372, 12076, 2571, 4355, 7122, 323, 12587, 2797, 9475, 1800, 13424, 8878, 6946, 7675, 5364,
+    9589, 8474, 8999, 11453, 9348, 8507, 11636, 9280, 7591, 7889, 9545, 495, 701, 7678, 188, 11545,
+    5440, 1322, 12234, 13357, 10150, 7029, 13110, 2753, 6688, 1880, 11961, 3413, 4190, 2516, 12472, 5708,
+    11276, 5598, 447, 11698, 12468, 1265, 4626, 7161, 9354, 7932, 8854, 7978, 2607, 2927, 8381, 7519,
+    6344, 2552, 12906, 8838, 2997, 12228, 11106, 3157, 5602, 4824, 13007, 11382, 13607, 10865, 11197, 8004,
+    795, 9901, 6120, 9198, 7508, 12539, 8221, 2193, 11757, 7121, 13385, 6255, 13453, 838, 1003, 9605,
+    11239, 5907, 5807, 13215, 11214, 10783, 272, 2493, 939, 2591, 5685, 9622, 778, 7234, 9352, 593,
+    12243, 1626, 12532, 3848, 6036, 6260, 13275, 11189, 11315, 3934, 13778, 10260, 11310, 9578, 3770, 1904,
+    1726, 9317, 11472, 4186, 8563, 4910, 9924, 8783, 9963, 2969, 11460, 3271, 6434, 1830, 1700, 10077,
+    13088, 9959, 423, 1300, 12509, 12261, 136, 12210, 9715, 10204, 10420, 11660, 9522, 8266, 6468, 12052,
+    3278, 8895, 7385, 9591, 12249, 4949, 12264, 7019, 2162, 8184, 2383, 3771, 511, 375, 9491, 11477,
+    1599, 8407, 7840, 13130, 2135, 1171, 12643, 11019, 2618, 1806, 10227, 4801, 11165, 12854, 3841, 92,
+    7137, 13197, 5053, 1779, 1705, 12525, 11854, 12678, 5267, 2306, 4748, 9240, 7024, 12633, 935, 2587,
+    779, 11750, 10617, 7758, 7810, 6766, 5520, 6994, 3820, 12247, 11486, 13061, 2347, 1074, 3255, 12371,
+    6720, 9191, 5367, 2266, 2363, 794, 11115, 10647, 5061, 7377, 4991, 9359, 4397, 12675, 1570, 9449,
+    5055, 11958, 4987, 2600, 2170, 12869, 7462, 8994, 10850, 11279, 7737, 7768, 10701, 8204, 4939, 13028,
+    2231, 4660, 174, 2718, 12936, 1317, 10728, 9956, 8748, 4334, 13322, 11017, 2527, 11859, 6151, 13569,
+    11355, 4178, 3440, 1212, 2905, 11920, 9432, 6289, 8733, 2384, 6130, 6146, 6725, 1114, 9969, 5411,
+    7625, 11021, 7324, 1602, 8611, 5280, 2570, 2617, 1717, 6223, 750, 8760, 13612, 5582, 4412, 4963,
+    611, 11156, 6190, 3815, 3594, 4483, 2724, 4413, 9646, 3613, 1285, 4498, 12682, 11437, 10620, 9054,
+    8058, 6158, 8214, 3778, 5756, 9080, 4156, 3066, 2922, 1913, 9876, 6951, 698, 2721, 1792, 1562,
+    9501, 9494, 9803, 307, 9244, 13025, 4243, 1396, 6218, 1037, 5527, 6435, 13062, 1697, 11945, 12983,
+    12268, 13136, 4841, 8588, 10253, 10507, 13450, 5901, 12145, 12681, 13084, 6194, 13211, 5503, 856, 13198,
+    9596, 11044, 10301, 3564, 2431, 10965, 5850, 5327, 8610, 8166, 10315, 4686, 9436, 4033, 4364, 1009,
+    1962, 5523, 4967, 5264, 7119, 1488, 9007, 3780, 310, 10713, 12248, 13391, 8105, 11014, 13743, 13719,
+    12470, 9588, 11999, 9489, 2195, 6458, 13525, 13261, 4115, 2469, 11148, 11692, 12399, 7487, 7953, 13475,
+    3017, 8660, 4749, 773, 3070, 6367, 2606, 6870, 4917, 3131, 3239, 306, 11708, 7498, 585, 8844,
+    3168, 12567, 7231, 563, 8483, 5479, 5069, 4198, 11191, 3610, 11910, 1724, 8001, 4387, 10794, 6420,
+    12177, 12373, 5414, 7112, 10398, 6500, 8653, 13348, 2673, 5736, 2842, 3163, 8416, 7077, 2614, 1520,
+    146, 2645, 8036, 10036, 12950, 10399, 7817, 4279, 9994, 3003, 13591, 2862, 2853, 6571, 4983, 12518,
+    8230, 6269, 9676, 810, 6227, 4339, 3410, 3966, 2821, 1642, 7613, 9126, 10070, 6522, 13729, 246,
+    7371, 10210, 5060, 11933, 12870, 7557, 2419, 6399, 11049, 13684, 1740, 7072, 3508, 248, 6094, 7453,
+    7710, 7006, 745, 3146, 5846, 6923, 7918, 5003, 50, 4822, 7622, 13758, 891, 11320, 13784, 10403,
+    12897, 4973, 8446, 10785, 7037, 3954, 4677, 6794, 1657, 13049, 11986, 5581, 8645, 2427, 422, 13273,
+    4882, 11003, 3126, 2279, 10234, 8274, 13328, 239, 3209, 4403, 8222, 10986, 13723, 1864, 5103, 12111,
+    8593, 7207, 5830, 3864, 5735, 874, 3680, 30, 421, 12736, 12997, 3650, 10433, 10067, 7150, 5561,
+    9783, 8488, 12014, 12973, 8715, 8577, 12623, 11956, 10997, 2775, 7995, 13014, 4844, 7273, 4816, 13764,
+    3405, 8902, 13368, 10436, 6116, 4067, 2244, 10521, 12538, 5211, 11170, 1539, 5868, 3238, 12895, 3710,
+    7812, 8861, 12775, 3806, 2663, 10247, 9639, 2743, 11650, 7821, 10329, 8647, 7741, 4319, 503, 10899,
+    10782, 8522, 1374, 1463, 11618, 1025, 11870, 10971, 10699, 10911, 104, 44, 3661, 10697, 2312, 973,
+    12205, 11715, 8396, 11993, 3779, 11085, 3172, 4718, 6661, 2365, 2840, 5020, 3184, 2291, 5824, 11089,
+    13506, 13214, 9216, 1658, 397, 10269, 5048, 6655, 13255, 2280, 13237, 12023, 4596, 3887, 11458, 10037,
+    12029, 5127, 9875, 5362, 3213, 1140, 9412, 10955, 6617, 8148, 5713, 13314, 2597, 6176, 1229, 5547,
+    9044, 13167, 11671, 9615, 8259, 6866, 3643, 6011, 5156, 1021, 12310, 4649, 12316, 1594, 1965, 11068,
+    6342, 5394, 5406, 1782, 9349, 13796, 5023, 12719, 3261, 8644, 12351, 386, 3600, 11369, 11114, 7477,
+    10758, 4867, 3923, 12302, 5792, 5072, 9607, 2310, 4762, 10590, 8661, 4510, 10807, 2080, 3715, 3681,
+    2025, 172, 6612, 11219, 10464, 9213, 7494, 6972, 12944, 8156, 8976, 6762, 9199, 5920, 3461, 8013,
+    4502, 4411, 4923, 13522, 12820, 6238, 10246, 9793, 1578, 1511, 4893, 5482, 3304, 10597, 4445, 4032,
+    10063, 6697, 13176, 437, 3485, 6326, 4322, 12741, 3775, 3326, 10849, 668, 9203, 4970, 13113, 11864,
+    1516, 1316, 4962, 5595, 13518, 7148, 9057, 4653, 6380, 10149, 8937, 4203, 2613, 2467, 9313, 12526,
+    6192, 13593, 7598, 5838, 1684, 9064, 8196, 471, 1629, 6533, 3233, 2861, 13349, 1184, 13220, 743,
+    1002, 11819, 9874, 4896, 2443, 12065, 11629, 6705, 12753, 12492, 10534, 13570, 2481, 12589, 25, 12533,
+    3938, 1829, 5586, 1517, 9090, 6963, 4270, 10437, 12175, 1798, 3429, 6689, 10343, 940, 888, 3415,
+    7947, 2120, 4238, 4752, 7714, 2948, 2414, 13512, 12737, 8387, 2722, 11609, 10356, 3926, 9685, 7469,
+    7998, 9318, 8756, 6106, 9495, 1755, 8337, 5705, 13299, 2118, 3143, 13753, 5946, 9402, 1803, 4134,
+    10757, 3523, 1597, 5635, 3220, 10368, 41, 4798, 2161, 12206, 3373, 5755, 8286, 13761, 4479, 6640,
+    504, 9296, 7474, 11881, 9528, 9455, 10984, 12578, 9900, 8841, 2301, 1542, 9445, 12477, 6628, 7841,
+    4541, 4509, 4644, 12280, 5882, 576, 2508, 6644, 4566, 2472, 6614, 5982, 10157, 8967, 734, 2202,
+    11117, 12881, 7333, 12021, 8145, 5714, 9587, 3145, 11493, 7230, 12632, 7032, 11411, 3795, 6226, 7455,
+    10019, 6814, 8246, 3105, 11440, 108, 12783, 2318, 6212, 11311, 13329, 5599, 3215, 2809, 6914, 7312,
+    13366, 2551, 10655, 6864, 416, 11630, 4682, 2119, 5619, 13428, 10773, 2036, 8770, 10909, 8101, 2787,
+    7627, 12226, 10220, 2475, 9131, 1017, 10999, 8825, 6331, 7484, 10956, 9094, 3652, 4846, 9062, 8656,
+    6412, 7256, 12968, 4276, 7759, 9975, 2638, 4958, 4000, 12375, 8192, 7185, 9307, 3152, 11400, 8946,
+    6404, 3212, 3824, 9253, 6716, 6586, 5917, 11464, 1930, 7894, 9908, 3880, 12718, 3324, 8095, 12646,
+    6169, 4318, 5746, 2525, 13712, 9972, 1820, 4520, 4265, 10023, 6341, 2517, 3927, 2016, 3767, 1267,
+    12043, 8626, 11694, 11801, 8705, 10265, 13340, 564, 11599, 3941, 9786, 13628, 6043, 10371, 5140, 228,
+    11410, 8565, 872, 7417, 5738, 9922, 13339, 8940, 10408, 6319, 12502, 665, 11937, 8959, 13458, 351,
+    11653, 2355, 8686, 5891, 13519, 13234, 4081, 5844, 8731, 3027, 6476, 7533, 13564, 2926, 13716, 6709,
+    13639, 5464, 4165, 6051, 13404, 4996, 5614, 3203, 10196, 1643, 12804, 6516, 255, 11201, 13159, 6931,
+    2020, 2336, 512, 5137, 924, 3436, 12814, 10645, 13401, 5025, 2683, 2420, 436, 8717, 6137, 1834,
+    10332, 7852, 7224, 9242, 7725, 12807, 11421, 10052, 5486, 10819, 20, 1277, 2526, 8323, 1242, 1786,
+    598, 2546, 704, 5192, 10497, 9159, 2389, 9328, 3612, 5849, 4221, 12755, 12962, 7195, 13355, 12902,
+    6530, 6310, 8676, 1325, 8849, 352, 362, 2989, 3945, 797, 8922, 11726, 5399, 9248, 6431, 5458,
+    12220, 7991, 11805, 3790, 13342, 3196, 1869, 2769, 6501, 10110, 11271, 2169, 1672, 6879, 10579, 859,
+    2919, 12461, 1996, 3570, 8796, 9747, 3040, 10095, 9480, 4464, 8772, 11608, 11710, 132, 13625, 9205,
+    12911, 3358, 12694, 4073, 13066, 13503, 13109, 1933, 7529, 4838, 329, 3451, 1401, 8955, 5955, 3682,
+    538, 3379, 3796, 5167, 2012, 7982, 5443, 588, 7274, 8790, 5465, 2442, 1478, 1813, 12970, 1925,
+    12288, 4177, 9316, 9925, 2447, 12766, 5535, 5139, 3071, 9022, 2337, 6119, 13587, 8890, 4446, 10370,
+    3469, 9013, 2588, 6099, 11252, 831, 4758, 12180, 6298, 10264, 10855, 11199, 986, 10295, 13798, 8700,
+    1969, 3092, 3588, 8386, 1701, 4699, 1766, 10820, 12722, 8850, 13288, 12437, 6395, 8402, 2856, 3962,
+    11700, 345, 12114, 1504, 9754, 8703, 1751, 3352, 8921, 12524, 12196, 9299, 12815, 9453, 6340, 5852,
+    873, 9312, 12362, 4564, 11321, 143, 11664, 11107, 4140, 1858, 11406, 11215, 3241, 7931, 11868, 10394,
+    1366, 11269, 10478, 6552, 1793, 6718, 10338, 12215, 1537, 4021, 7581, 13534, 1110, 4252, 9361, 11768,
+    4994, 11559, 674, 2655, 3696, 3781, 8532, 9641, 4799, 7339, 13543, 1251, 4530, 8876, 8744, 11296,
+    12320, 9234, 2146, 3360, 9771, 5878, 7486, 702, 578, 3011, 8805, 792, 9567, 2873, 10348, 13311,
+    3615, 5733, 8020, 13343, 2209, 1033, 193, 2857, 9287, 13042, 2686, 2335, 13583, 9960, 6732, 11010,
+    4131, 1008, 3065, 11337, 4895, 6549, 3603, 3448, 6153, 9251, 4673, 10553, 11521, 5397, 6144, 12155,
+    9351, 12138, 9568, 12395, 5914, 1862, 11654, 1083, 9405, 4352, 1230, 7772, 5688, 634, 12964, 12688,
+    13443, 10768, 8965, 10043, 4068, 5273, 5230, 4468, 3028, 8771, 10506, 10891, 12651, 6122, 11026, 12412,
+    6425, 919, 4549, 10025, 10513, 5516, 1655, 13717, 2532, 5088, 774, 11701, 4489, 893, 9138, 9183,
+    11704, 12181, 47, 2925, 9753, 6560, 13390, 8627, 1302, 13092, 7825, 8327, 9488, 3389, 5610, 10702,
+    7936, 5136, 9302, 13335, 1844, 4010, 6508, 1103, 6244, 569, 4924, 2287, 9136, 5106, 8041, 9128,
+    5424, 13674, 9466, 9225, 6895, 10489, 5822, 13035, 6037, 12672, 8111, 12809, 12885, 7958, 3453, 10009,
+    12957, 11047, 11079, 9921, 9076, 4197, 10886, 9893, 8619, 387, 13646, 2173, 6497, 13236, 233, 8536,
+    11006, 1693, 12211, 6348, 7698, 1376, 6004, 13772, 457, 12952, 1007, 12358, 1392, 9884, 612, 8548,
+    9162, 9170, 8801, 11134, 12631, 6369, 819, 9626, 13371, 9371, 3060, 1753, 3285, 1737, 13680, 13661,
+    9106, 6225, 898, 4094, 5438, 12909, 13011, 8301, 7243, 7070, 11775, 549, 10262, 1162, 13000, 1839,
+    10294, 10441, 1472, 8333, 6143, 7063, 4055, 5624, 10932, 7403, 6278, 13022, 589, 159, 5268, 9976,
+    12588, 11625, 6323, 294, 5749, 13490, 6452, 7502, 10522, 7065, 13529, 152, 12499, 12598, 10582, 8528,
+    3749, 4007, 13816, 1445, 11576, 8684, 7881, 883, 9247, 13711, 11325, 4728, 762, 9447, 11811, 1337,
+    524, 4211, 10870, 6182, 13670, 8892, 10763, 12908, 4422, 13509, 8916, 1533, 7430, 1588, 4212, 5931,
+    11071, 12918, 7718, 5350, 7036, 6881, 11765, 11971, 13217, 8826, 4508, 2851, 13070, 2446, 9932, 12540,
+    2494, 7166, 213, 9160, 6673, 13582, 3905, 3308, 7442, 4442, 7467, 515, 7391, 5354, 4148, 5247,
+    9003, 6423, 6598, 11593, 3191, 2566, 1333, 405, 8198, 8038, 2466, 650, 10477, 12768, 9433, 1129,
+    4569, 6049, 11540, 427, 4012, 4128, 4920, 6363, 13344, 1551, 3149, 10735, 3948, 9194, 3704, 6159,
+    9773, 1870, 8938, 7955, 3856, 12260, 5403, 1698, 9025, 1442, 3342, 5214, 8711, 5843, 4269, 3054,
+    51, 1678, 3383, 10863, 13324, 1911, 6737, 3811, 1639, 3423, 4141, 9790, 8376, 8527, 12860, 115,
+    8000, 1146, 13389, 7734, 3518, 11146, 10364, 9477, 6114, 8187, 10002, 1475, 3386, 6251, 13281, 4852,
+    8169, 2988, 6000, 8240, 3716, 3183, 9200, 13690, 2643, 4880, 10629, 5457, 5536, 4831, 11095, 309,
+    10633, 5675, 1536, 6996, 752, 2531, 6005, 2474, 9611, 392, 2021, 6548, 1290, 6035, 6274, 4984,
+    9520, 4793, 11982, 1632, 12209, 7384, 2150, 12947, 2000,
+}};
+
+} // namespace xsk::gsc::iw6
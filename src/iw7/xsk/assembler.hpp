@@ -14,7 +14,8 @@ class assembler : public gsc::assembler
     utils::byte_buffer::ptr script_;
     utils::byte_buffer::ptr stack_;
     std::vector<function::ptr> functions_;
-    std::unordered_map<std::uint32_t, std::string> labels_;
+    std::unordered_map<std::string_view, std::uint32_t> function_index_;
+    std::unordered_map<std::uint32_t, std::uint32_t> label_index_;
 
 public:
     auto output_script() -> std::vector<std::uint8_t>;
@@ -33,8 +34,10 @@ private:
     void assemble_field_variable(const instruction::ptr& inst);
     void assemble_jump(const instruction::ptr& inst, bool expr, bool back);
     void assemble_offset(std::int32_t offset);
-    auto resolve_function(const std::string& name) -> std::uint32_t;
-    auto resolve_label(const std::string& name) -> std::uint32_t;
+    template <typename T>
+    auto resolve_id(const operand& data, T (*lookup)(const std::string&)) -> T;
+    auto resolve_function(const operand& data) -> std::uint32_t;
+    auto resolve_label(const operand& data) -> std::uint32_t;
 };
 
 } // namespace xsk::gsc::iw7
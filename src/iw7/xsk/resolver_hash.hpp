@@ -0,0 +1,252 @@
+// Copyright 2021 xensik. All rights reserved.
+//
+// Use of this source code is governed by a GNU GPLv3 license
+// that can be found in the LICENSE file.
+
+// generated by gen/resolver.py, do not edit
+
+#pragma once
+
+namespace xsk::gsc::iw7
+{
+
+constexpr std::array<std::int32_t, 38> opcode_hash_seeds
+{{
+    7, 40, 6, 2, 38, 63, 22, 347, 0, 52, 15, 347, 5, 423, 100, 244,
+    448, 417, 1, 12, 1, -153, 24, 59, 1, 610, 164, 586, 38, 75, 0, 260,
+    20, 596, 277, -1, 0, 2125,
+}};
+
+constexpr std::array<std::uint32_t, 153> opcode_hash_slots
+{{
+    40, 30, 132, 130, 4, 34, 51, 95, 45, 86, 74, 8, 105, 1, 67, 119,
+    141, 124, 12, 138, 50, 38, 35, 113, 60, 78, 75, 82, 140, 73, 108, 16,
+    32, 111, 112, 56, 31, 103, 128, 7, 79, 72, 15, 80, 131, 19, 29, 145,
+    142, 129, 127, 97, 92, 47, 37, 104, 66, 25, 133, 57, 116, 14, 2, 54,
+    61, 126, 99, 18, 21, 48, 76, 98, 102, 125, 118, 6, 46, 123, 68, 100,
+    139, 91, 5, 62, 13, 36, 23, 144, 114, 89, 117, 146, 94, 44, 10, 59,
+    11, 53, 22, 93, 85, 58, 49, 122, 55, 106, 65, 43, 24, 148, 101, 39,
+    64, 83, 107, 115, 41, 63, 90, 52, 109, 42, 17, 27, 149, 71, 81, 152,
+    87, 147, 136, 33, 137, 0, 135, 110, 9, 69, 77, 96, 84, 88, 3, 143,
+    28, 151, 134, 121, 26, 150, 20, 70, 120,
+}};
+
+constexpr std::array<std::int32_t, 201> function_hash_seeds
+{{
+    183, 1, 14, 39, 2, 45, 5, 6, -794, 277, 42, 27, 43, 47, 1, 141,
+    76, 1, 129, 237, 382, 177, 4, 4, 1, 4, 24, 1, 2, 8, 28, 1,
+    2, 636, 4, 26, 4, 17, 52, 2, -673, 3, 109, 138, 122, 64, 26, 312,
+    55, 0, 44, 81, 6, 30, 4, 62, 5, 18, 3, 90, 378, 250, 88, 31,
+    7, 8, 3, 314, 18, 104, 5, 1, 1, -649, 5, 0, 85, 88, 1, 70,
+    13, 70, 100, 2, 30, 4, 89, 1, 34, 1, 169, 7, 379, 4, 1, 45,
+    -503, 2, -442, 7, 1, 24, 500, 230, 31, 1, 25, 64, 181, 1, 26, 7,
+    133, 132, 38, 504, 3, -417, 36, 34, 24, 1536, 2, 1, 30, -383, 25, 95,
+    136, 25, 163, 3, 78, 5, -355, 3, 16, 219, 15, 435, 57, 95, 439, 144,
+    16, 248, 82, 55, 80, 212, 40, 8, 31, 588, 231, 642, 849, 8, 10, 1,
+    0, 11, 840, -229, 216, 2370, 737, 5, 40, 520, 2, -172, 412, 386, 64, 80,
+    1, 241, 72, 5, 413, 2071, 69, 513, 5, 290, 158, 8068, 907, 1, 2575, 9899,
+    330, 1204, 1, -11, 2, 915, 27, 598, 5,
+}};
+
+constexpr std::array<std::uint32_t, 807> function_hash_slots
+{{
+    57, 700, 484, 349, 413, 475, 628, 604, 97, 265, 729, 434, 465, 457, 183, 222,
+    242, 387, 787, 109, 642, 607, 746, 105, 430, 21, 543, 12, 669, 476, 244, 119,
+    550, 148, 274, 396, 240, 282, 28, 458, 209, 337, 512, 697, 502, 254, 617, 435,
+    236, 479, 277, 467, 488, 655, 754, 553, 767, 339, 425, 651, 418, 77, 614, 314,
+    326, 538, 542, 657, 338, 363, 361, 149, 333, 582, 228, 316, 202, 400, 310, 151,
+    0, 609, 115, 578, 644, 81, 485, 133, 758, 92, 296, 603, 160, 661, 104, 120,
+    295, 757, 638, 421, 357, 377, 125, 693, 724, 658, 131, 601, 522, 279, 405, 793,
+    653, 665, 360, 83, 584, 372, 646, 71, 233, 708, 493, 399, 224, 620, 456, 221,
+    519, 805, 771, 177, 445, 429, 433, 401, 751, 588, 723, 587, 442, 565, 305, 343,
+    781, 358, 31, 76, 595, 764, 633, 225, 344, 117, 206, 378, 264, 473, 9, 616,
+    496, 533, 460, 199, 419, 613, 45, 252, 454, 42, 304, 79, 313, 695, 470, 69,
+    291, 40, 126, 431, 744, 359, 299, 251, 34, 427, 659, 287, 521, 74, 169, 411,
+    713, 30, 806, 32, 312, 170, 194, 539, 191, 505, 211, 441, 501, 332, 511, 88,
+    366, 562, 286, 200, 75, 796, 660, 652, 637, 159, 168, 571, 721, 453, 144, 103,
+    187, 705, 551, 101, 216, 414, 715, 373, 298, 706, 186, 256, 649, 13, 311, 795,
+    302, 691, 443, 303, 232, 591, 325, 190, 791, 688, 696, 412, 54, 736, 790, 258,
+    398, 725, 482, 727, 146, 365, 329, 784, 579, 491, 720, 308, 260, 317, 444, 214,
+    420, 718, 67, 340, 68, 535, 114, 432, 6, 380, 369, 656, 438, 544, 73, 171,
+    397, 184, 804, 145, 619, 59, 108, 641, 424, 43, 284, 226, 48, 11, 489, 477,
+    178, 802, 163, 634, 510, 611, 122, 223, 220, 500, 128, 179, 261, 192, 318, 768,
+    630, 323, 139, 3, 25, 51, 33, 27, 683, 800, 297, 730, 681, 22, 393, 576,
+    324, 14, 166, 428, 341, 335, 112, 121, 35, 526, 483, 546, 761, 770, 290, 722,
+    741, 52, 738, 208, 80, 684, 497, 786, 776, 755, 747, 283, 167, 82, 515, 517,
+    743, 742, 375, 188, 455, 2, 701, 165, 672, 682, 348, 140, 552, 85, 262, 368,
+    270, 394, 327, 714, 803, 640, 677, 204, 127, 577, 509, 156, 238, 704, 306, 331,
+    135, 53, 370, 574, 726, 388, 716, 680, 39, 794, 568, 118, 44, 608, 271, 561,
+    99, 227, 309, 624, 278, 390, 559, 64, 229, 320, 711, 752, 346, 548, 239, 415,
+    207, 410, 461, 504, 481, 563, 381, 775, 219, 782, 558, 385, 36, 289, 350, 41,
+    524, 328, 342, 4, 72, 643, 702, 570, 266, 594, 602, 554, 334, 586, 452, 37,
+    164, 66, 217, 263, 581, 606, 451, 356, 379, 106, 495, 62, 300, 234, 147, 678,
+    243, 629, 694, 198, 307, 650, 753, 518, 246, 362, 760, 547, 735, 247, 231, 437,
+    636, 255, 110, 392, 774, 756, 275, 416, 321, 733, 783, 268, 87, 474, 182, 210,
+    90, 143, 374, 84, 734, 196, 663, 777, 235, 89, 674, 779, 671, 545, 740, 780,
+    487, 237, 436, 573, 560, 667, 16, 468, 799, 389, 464, 583, 158, 61, 527, 480,
+    150, 407, 38, 739, 272, 137, 102, 107, 155, 134, 439, 692, 626, 173, 423, 201,
+    498, 789, 450, 181, 20, 257, 610, 215, 319, 213, 513, 623, 668, 47, 259, 7,
+    18, 315, 580, 662, 737, 530, 627, 345, 94, 537, 408, 249, 353, 666, 422, 193,
+    564, 376, 212, 124, 276, 557, 95, 136, 162, 766, 382, 8, 281, 63, 719, 750,
+    772, 404, 712, 463, 593, 180, 96, 440, 639, 205, 531, 679, 23, 153, 288, 612,
+    15, 499, 152, 417, 703, 336, 525, 161, 647, 598, 687, 645, 792, 383, 689, 654,
+    371, 621, 402, 322, 670, 253, 426, 600, 55, 132, 138, 507, 347, 566, 406, 269,
+    599, 86, 528, 765, 123, 622, 195, 111, 635, 98, 749, 503, 690, 762, 745, 567,
+    449, 676, 56, 516, 592, 486, 618, 141, 675, 447, 352, 728, 707, 572, 732, 391,
+    685, 494, 301, 778, 130, 478, 549, 569, 773, 625, 172, 176, 245, 250, 100, 5,
+    459, 490, 514, 631, 65, 91, 759, 769, 409, 585, 673, 448, 285, 556, 532, 364,
+    520, 280, 731, 189, 26, 597, 446, 698, 798, 699, 748, 469, 70, 664, 395, 367,
+    10, 17, 175, 174, 384, 58, 466, 230, 351, 472, 596, 508, 555, 506, 113, 797,
+    536, 218, 78, 801, 129, 785, 154, 575, 709, 534, 529, 93, 50, 116, 241, 590,
+    386, 157, 492, 540, 462, 648, 523, 355, 294, 19, 354, 615, 46, 197, 541, 293,
+    49, 710, 330, 1, 142, 686, 267, 589, 24, 788, 29, 717, 605, 60, 292, 185,
+    273, 403, 203, 471, 763, 632, 248,
+}};
+
+constexpr std::array<std::int32_t, 375> method_hash_seeds
+{{
+    33, 3, 34, 10, 72, 11, 13, 1, 3, 4, 41, 12, 24, 82, -1464, 3,
+    7, -1386, 109, 12, 5, 1, 26, 27, -1377, 24, -1355, 34, -1352, 7, 21, 117,
+    -1334, 1, 8, 112, 38, 44, 282, 52, 109, -1332, 0, 3, 10, 53, 9, 3,
+    -1137, 310, 4, 3, 60, 186, 207, 1, 5, 49, 1, 27, 8, 98, 70, 2,
+    46, 10, 14, 5, 0, 4, 29, 96, 2, 40, 86, 20, 10, 384, 11, 3,
+    0, 403, 2, 6, 13, 2, 4, 64, 53, 6, 21, 183, 48, 22, 15, 22,
+    1, 18, 10, 54, 1, 29, 29, 1, 2, 13, 164, 202, 710, 33, 453, -1093,
+    33, 224, 9, 1, 51, 19, 151, -1064, 17, 173, 10, 49, -1020, 43, 1, 1,
+    181, 1, 122, 30, 71, 325, 0, 43, 378, 181, 199, 81, 13, 52, 99, 1,
+    9, 152, 26, 46, 34, 34, 202, 49, 202, -1013, 194, 4, 36, 94, 158, 177,
+    22, 14, 68, 143, 14, 7, 22, 85, 169, 403, 485, 3, 5, 2, 164, 4,
+    138, 4, 359, 95, 13, 103, -987, 358, 3, 13, 17, 25, 540, -972, 4, 161,
+    612, 4, -966, 20, 17, 4, 1, 345, 4, 61, 30, 13, 1153, 4, 14, 249,
+    35, 78, -910, 69, 3, 10, 25, 333, 11, 28, 153, 4, -876, -839, 70, 250,
+    653, 25, 289, 885, 234, -808, 138, 4, 6, 4, -788, 41, 1, 39, 8, 58,
+    -731, 18, 1, 78, 1, 41, 115, 102, 1, -712, 69, 245, -592, 418, 16, 169,
+    49, 35, 336, 0, 6, 137, 427, 36, -580, 638, 92, 120, 203, 4, 667, 123,
+    169, 8, 587, 12, 3, 15, 740, 71, 8, 1, 1, 1, -542, 4, 154, 599,
+    1, 156, 28, 43, 1376, 0, 732, 148, 678, 382, 312, 104, 39, -532, -531, 75,
+    11, -356, -304, 119, 2, 80, 4, 702, -289, 694, 216, 295, 4, 258, 127, 296,
+    34, 153, 417, 6, 13, 37, 541, 3, 84, 0, 275, 381, 294, 22, 1, 134,
+    18, 3180, 1, 32, 12, 96, 1106, 6, 698, 20, -128, 1884, -127, 487, 26, 102,
+    1, 420, 666, 23, 17, 5, 31, 147, -24, 52, 166, 1004, 33, 412, 92, 1,
+    249, 1, 9, 49, 13, 1581, 146,
+}};
+
+constexpr std::array<std::uint32_t, 1500> method_hash_slots
+{{
+    782, 1394, 699, 1367, 0, 327, 1197, 1119, 438, 1365, 285, 997, 877, 706, 347, 16,
+    519, 310, 514, 835, 162, 481, 1068, 1494, 1442, 220, 88, 1027, 1115, 796, 269, 1478,
+    1110, 390, 1179, 216, 85, 1448, 1276, 140, 1413, 879, 823, 5, 450, 1180, 1459, 360,
+    34, 1132, 596, 1279, 367, 1075, 1393, 42, 1059, 987, 108, 635, 942, 1112, 148, 1185,
+    575, 395, 62, 1194, 814, 356, 718, 836, 558, 1477, 58, 521, 193, 643, 1155, 550,
+    1138, 256, 458, 1379, 1310, 1416, 1088, 893, 1355, 1212, 345, 1200, 1470, 283, 1230, 406,
+    1013, 480, 61, 1336, 805, 724, 1414, 1473, 155, 183, 941, 1382, 610, 1011, 924, 144,
+    304, 715, 1258, 1453, 160, 849, 726, 334, 910, 669, 754, 833, 955, 1196, 1338, 702,
+    109, 1172, 958, 258, 37, 710, 701, 1339, 685, 271, 990, 349, 986, 48, 1100, 1302,
+    781, 2, 1161, 566, 673, 41, 244, 545, 601, 1, 1342, 188, 65, 837, 1208, 998,
+    1498, 74, 447, 1274, 513, 524, 272, 697, 1460, 969, 289, 811, 463, 104, 1298, 768,
+    440, 402, 10, 319, 1121, 120, 118, 231, 563, 1272, 451, 1153, 1334, 979, 506, 1066,
+    21, 339, 645, 1215, 72, 1234, 1320, 1449, 1228, 82, 954, 383, 241, 329, 973, 1109,
+    674, 1022, 1260, 546, 961, 124, 863, 1246, 297, 557, 18, 236, 1333, 720, 865, 190,
+    1461, 434, 157, 1191, 1237, 844, 12, 370, 1087, 1483, 147, 1398, 650, 167, 54, 474,
+    1410, 668, 1164, 666, 1329, 1120, 87, 813, 653, 174, 952, 670, 325, 1083, 275, 394,
+    839, 1210, 808, 795, 585, 657, 840, 888, 738, 717, 900, 560, 1270, 984, 972, 1250,
+    75, 1452, 1102, 829, 107, 165, 238, 1426, 386, 403, 826, 1149, 346, 780, 850, 572,
+    311, 1371, 1025, 392, 725, 205, 631, 803, 293, 908, 169, 567, 797, 992, 1381, 485,
+    841, 573, 543, 784, 1135, 1458, 1331, 1292, 63, 476, 629, 632, 512, 1469, 246, 916,
+    1288, 528, 933, 604, 303, 1206, 774, 764, 1065, 727, 81, 937, 1269, 154, 404, 1092,
+    1432, 902, 876, 791, 561, 407, 417, 116, 1259, 1156, 1238, 1099, 1071, 571, 119, 250,
+    1037, 433, 1091, 78, 579, 1340, 421, 884, 1286, 317, 99, 1076, 1178, 309, 1341, 387,
+    704, 899, 53, 1405, 55, 887, 1118, 1326, 273, 1201, 1166, 1042, 752, 1256, 734, 348,
+    1105, 71, 1097, 113, 318, 1124, 237, 1390, 454, 898, 1439, 1358, 114, 111, 517, 716,
+    700, 338, 1249, 976, 676, 696, 247, 1312, 766, 638, 177, 626, 1294, 1152, 1278, 419,
+    535, 648, 282, 1464, 968, 728, 229, 1447, 709, 1009, 1057, 117, 1207, 498, 1438, 948,
+    218, 110, 1186, 1375, 1484, 1211, 594, 1061, 804, 1444, 509, 422, 950, 580, 302, 551,
+    1377, 251, 1108, 994, 482, 1404, 630, 547, 1415, 1313, 634, 1229, 591, 582, 1284, 974,
+    425, 788, 915, 171, 1363, 1335, 1330, 314, 66, 248, 827, 857, 336, 232, 1451, 43,
+    555, 750, 180, 1015, 128, 957, 307, 170, 27, 590, 1389, 612, 689, 1380, 890, 1005,
+    1188, 112, 1261, 1189, 1163, 713, 359, 60, 639, 565, 642, 357, 115, 920, 260, 1142,
+    127, 217, 377, 1304, 203, 595, 809, 44, 479, 757, 22, 714, 469, 257, 1045, 1266,
+    413, 529, 455, 288, 736, 1463, 533, 793, 1497, 1198, 1346, 1067, 326, 923, 376, 906,
+    391, 616, 100, 652, 834, 1111, 1384, 1001, 825, 918, 68, 221, 861, 1412, 523, 420,
+    1287, 228, 1305, 577, 299, 967, 681, 931, 141, 1204, 1265, 1427, 785, 819, 295, 779,
+    1224, 1047, 1361, 497, 1199, 364, 33, 184, 578, 1440, 136, 312, 1445, 187, 953, 1090,
+    925, 856, 842, 1316, 1122, 767, 688, 499, 598, 9, 315, 1205, 901, 202, 69, 504,
+    1182, 1327, 423, 1002, 274, 1395, 1267, 975, 400, 20, 143, 493, 388, 1257, 556, 1113,
+    343, 7, 705, 922, 486, 1139, 3, 832, 501, 1332, 1240, 1487, 564, 686, 1385, 159,
+    755, 166, 656, 448, 1425, 1095, 982, 1173, 149, 355, 39, 1175, 569, 929, 1251, 903,
+    830, 691, 1264, 176, 1323, 1165, 932, 732, 1130, 1293, 869, 522, 1181, 1134, 743, 609,
+    583, 917, 11, 1034, 589, 1397, 1107, 1454, 526, 1126, 1306, 554, 983, 92, 368, 129,
+    707, 1103, 896, 98, 822, 1324, 301, 1499, 372, 892, 633, 1301, 296, 530, 507, 1159,
+    731, 1485, 1193, 1344, 91, 740, 615, 1471, 654, 1192, 208, 623, 505, 206, 912, 677,
+    671, 473, 928, 59, 883, 1354, 1054, 427, 1195, 164, 1053, 323, 581, 1343, 1400, 1140,
+    351, 172, 1041, 1157, 1203, 276, 996, 776, 851, 792, 432, 494, 959, 611, 398, 1369,
+    1420, 1144, 999, 765, 1325, 778, 342, 1351, 487, 234, 1352, 1239, 761, 145, 939, 945,
+    1488, 769, 173, 603, 852, 1096, 1017, 475, 426, 1226, 1217, 213, 1044, 1168, 907, 1085,
+    553, 858, 1486, 885, 168, 1307, 1309, 1407, 380, 94, 1129, 1106, 340, 286, 1242, 1024,
+    83, 1018, 801, 944, 30, 483, 414, 1019, 472, 365, 810, 354, 280, 935, 988, 636,
+    1133, 353, 1233, 1235, 1281, 956, 1396, 568, 489, 500, 313, 70, 1481, 815, 1056, 964,
+    1080, 947, 745, 344, 1462, 14, 161, 617, 934, 106, 741, 527, 1296, 379, 1150, 625,
+    1114, 599, 1055, 1350, 464, 536, 181, 362, 608, 692, 369, 549, 794, 1089, 1177, 484,
+    989, 290, 1221, 662, 753, 204, 1170, 230, 655, 1021, 13, 1388, 772, 97, 264, 518,
+    80, 911, 1345, 418, 503, 818, 439, 846, 461, 1402, 284, 1457, 862, 831, 1406, 548,
+    864, 215, 444, 1429, 847, 38, 1263, 199, 1141, 904, 1399, 584, 1409, 980, 333, 47,
+    619, 926, 245, 1295, 156, 665, 694, 1423, 711, 1419, 921, 23, 24, 789, 817, 871,
+    385, 1456, 889, 430, 1136, 8, 50, 946, 806, 570, 1049, 1366, 759, 737, 1273, 679,
+    178, 1227, 1043, 225, 798, 76, 210, 1020, 1223, 278, 308, 886, 627, 249, 491, 1058,
+    134, 316, 1300, 1492, 64, 873, 637, 552, 859, 1082, 252, 1283, 664, 1353, 405, 1026,
+    1433, 878, 146, 644, 441, 138, 1401, 672, 799, 675, 970, 525, 93, 1072, 1468, 659,
+    712, 695, 1450, 393, 739, 1280, 905, 516, 853, 442, 843, 1357, 1176, 511, 300, 6,
+    209, 40, 758, 122, 437, 189, 607, 914, 457, 1048, 693, 1050, 32, 56, 361, 371,
+    508, 729, 747, 1474, 200, 1241, 812, 328, 773, 79, 1218, 1146, 895, 1262, 532, 574,
+    412, 515, 103, 687, 270, 1348, 978, 576, 1424, 1145, 222, 396, 1356, 478, 1443, 927,
+    762, 1220, 1008, 324, 133, 294, 786, 435, 95, 1225, 542, 410, 399, 993, 132, 930,
+    366, 453, 1467, 1202, 84, 262, 1315, 121, 1046, 330, 373, 465, 647, 1297, 510, 227,
+    1434, 1214, 49, 824, 102, 470, 698, 894, 1029, 28, 722, 854, 1232, 52, 73, 866,
+    680, 919, 1116, 1479, 468, 1014, 1472, 182, 265, 539, 331, 1418, 358, 621, 26, 1094,
+    151, 223, 123, 153, 490, 495, 401, 19, 207, 1386, 1079, 870, 298, 593, 446, 1299,
+    452, 1253, 1378, 981, 1064, 101, 667, 1248, 255, 350, 36, 1070, 496, 991, 1167, 848,
+    1403, 321, 1271, 614, 531, 224, 254, 1255, 197, 1243, 1209, 816, 559, 86, 1151, 1446,
+    320, 90, 1060, 1362, 397, 646, 211, 1086, 198, 1303, 703, 1219, 179, 1039, 1482, 1489,
+    429, 1125, 1314, 382, 374, 175, 1373, 1285, 467, 744, 1016, 460, 1148, 363, 1032, 1422,
+    860, 1291, 868, 281, 641, 1411, 771, 540, 951, 624, 1040, 266, 378, 263, 1495, 471,
+    443, 1337, 538, 1174, 185, 807, 1069, 1190, 1117, 855, 194, 1465, 730, 746, 445, 1359,
+    628, 35, 233, 292, 1317, 544, 57, 45, 1063, 411, 1311, 126, 492, 520, 1475, 240,
+    1308, 1023, 1254, 592, 191, 1480, 1360, 875, 1137, 142, 1183, 965, 1387, 428, 1010, 4,
+    431, 163, 874, 1455, 963, 867, 196, 305, 534, 1289, 735, 253, 477, 690, 962, 606,
+    1051, 760, 201, 1496, 751, 261, 1417, 620, 1408, 243, 1319, 1493, 462, 51, 1428, 1098,
+    1490, 15, 235, 719, 332, 1391, 1222, 597, 684, 678, 613, 541, 651, 488, 588, 1147,
+    882, 375, 268, 721, 1328, 279, 1084, 77, 239, 940, 661, 756, 306, 1012, 1349, 1321,
+    212, 416, 89, 1131, 1187, 25, 683, 1006, 125, 139, 1101, 17, 1127, 277, 897, 1370,
+    622, 186, 322, 872, 949, 67, 1033, 742, 267, 152, 1007, 1247, 770, 682, 1000, 409,
+    1036, 820, 381, 1031, 291, 1143, 137, 1476, 787, 1154, 1004, 335, 783, 562, 838, 995,
+    105, 749, 1277, 821, 1364, 800, 602, 1073, 1160, 341, 828, 1035, 913, 192, 1431, 466,
+    1437, 135, 1252, 1038, 352, 1030, 408, 1435, 936, 502, 195, 663, 1491, 259, 960, 649,
+    1282, 449, 790, 456, 587, 436, 1374, 424, 605, 966, 389, 131, 96, 977, 1162, 150,
+    640, 1376, 537, 1347, 943, 775, 1441, 1368, 658, 46, 1074, 1392, 1078, 1028, 1318, 909,
+    1169, 708, 1184, 1081, 1216, 891, 214, 618, 29, 459, 1093, 1213, 1123, 880, 1322, 600,
+    1231, 1430, 845, 31, 1158, 226, 1128, 586, 1171, 763, 1104, 660, 1003, 1268, 219, 287,
+    881, 733, 1421, 1290, 748, 1244, 242, 384, 415, 1062, 1077, 1245, 723, 1383, 337, 1052,
+    1372, 971, 1466, 985, 802, 1275, 1236, 777, 938, 158, 1436, 130,
+}};
+
+constexpr std::array<std::int32_t, 1> file_hash_seeds
+{{
+    -1,
+}};
+
+constexpr std::array<std::uint32_t, 1> file_hash_slots
+{{
+    0,
+}};
+
+constexpr std::array<std::int32_t, 1> token_hash_seeds
+{{
+    -1,
+}};
+
+constexpr std::array<std::uint32_t, 1> token_hash_slots
+{{
+    0,
+}};
+
+} // namespace xsk::gsc::iw7
@@ -0,0 +1,5938 @@
+// Copyright 2021 xensik. All rights reserved.
+//
+// Use of this source code is governed by a GNU GPLv3 license
+// that can be found in the LICENSE file.
+
+// generated by gen/resolver.py, do not edit
+
+#pragma once
+
+namespace xsk::gsc::iw8
+{
+
+constexpr std::array<std::int32_t, 47> opcode_hash_seeds
+{{
+    -180, 10, 1, 7, 18, 171, 49, 15, 3, 9, 38, -165, 1149, 190, -157, 5,
+    366, -138, -87, 3, 46, 3, 32, 5, 1, 44, 234, 88, 14, 5, 1, 41,
+    15, 45, -59, 1, 59, -36, 36, 1, 1236, 282, 3, 682, 1, 4340, 90,
+}};
+
+constexpr std::array<std::uint32_t, 190> opcode_hash_slots
+{{
+    65, 182, 54, 20, 50, 6, 118, 139, 25, 116, 77, 165, 113, 98, 68, 43,
+    76, 53, 64, 40, 82, 160, 12, 131, 143, 39, 173, 95, 183, 88, 35, 114,
+    152, 49, 186, 146, 34, 75, 86, 27, 121, 89, 178, 123, 96, 94, 159, 161,
+    104, 90, 84, 29, 99, 103, 110, 52, 55, 13, 179, 47, 144, 156, 62, 7,
+    125, 189, 58, 111, 67, 16, 73, 92, 135, 126, 115, 15, 60, 171, 150, 134,
+    78, 155, 176, 97, 105, 93, 26, 122, 4, 63, 180, 72, 151, 81, 18, 112,
+    41, 2, 141, 127, 162, 107, 106, 174, 70, 168, 79, 163, 36, 108, 69, 167,
+    153, 80, 66, 48, 164, 172, 157, 137, 132, 128, 83, 120, 57, 85, 24, 42,
+    136, 148, 22, 184, 44, 28, 46, 30, 87, 147, 14, 130, 17, 177, 74, 187,
+    9, 149, 124, 140, 8, 59, 175, 154, 5, 166, 38, 119, 181, 56, 142, 11,
+    61, 19, 102, 71, 31, 169, 32, 10, 21, 91, 51, 0, 138, 3, 133, 145,
+    109, 23, 158, 188, 129, 37, 45, 1, 170, 185, 33, 100, 117, 101,
+}};
+
+constexpr std::array<std::int32_t, 266> function_hash_seeds
+{{
+    207, 43, 109, 24, 18, 0, 10, 165, -1007, 3, -948, 1, 19, 5, 16, 1,
+    65, 2, 3, 1, 102, 24, 30, 10, 1, 6, 224, 4, 41, 104, 7, 5,
+    9, 47, 1, 7, 8, 56, 47, 6, 22, 1, 8, 24, -831, 38, 4, 1,
+    3, 53, 4, -786, 2, 4, 159, -785, 2, 1, 31, 9, 1, -749, 15, 3,
+    -748, 27, 227, 96, -741, 766, 12, 29, 1, 282, 3, -725, 4, 136, 2, 255,
+    31, -705, 7, 67, 6, 434, 778, 100, 4, -662, 587, 53, 10, 2, 173, 8,
+    34, 410, 22, 347, 16, 2, 1, -411, 469, 7, 325, 2, 2, 177, 91, 6,
+    80, 182, 29, 23, 35, 52, 29, 754, 6, 1096, 4, 1245, -373, 101, 18, 454,
+    227, 1, 1, 224, 11, 269, 99, 9, 7, 111, 43, 34, 91, 1, 5, 28,
+    343, 33, 27, 2, 104, 109, 1, 311, 3, 14, 2, 9, 32, 1, -326, 373,
+    719, 12, 261, 77, 135, 62, 32, 2, 1, 2, 4, 18, 77, 1028, 13, 129,
+    375, 79, 0, 0, 65, 32, 42, 165, 4, 5, -269, 28, 1363, 17, 837, 46,
+    18, 31, 2, 1140, 1, 139, 16, 11, 176, 55, 1, 169, 39, 58, 6, 32,
+    8, 9, 10, 7, -240, 7, 0, 560, 184, 1365, 388, 272, 513, 87, 1554, 229,
+    35, 15, 4, 123, -101, 132, 38, 158, 491, 1, 2218, 33, 0, -91, 85, -78,
+    11, 178, 1372, 527, 2045, 2, 317, 2700, 3551, -37, 105, 574, 721, 251, 1756, 298,
+    323, 370, 29, 1151, 42, 1, 24, 111, 2, 53,
+}};
+
+constexpr std::array<std::uint32_t, 1065> function_hash_slots
+{{
+    378, 248, 354, 36, 190, 353, 937, 308, 344, 129, 292, 304, 194, 935, 472, 801,
+    748, 1038, 471, 834, 394, 636, 942, 789, 482, 133, 1054, 611, 1051, 784, 388, 338,
+    1049, 244, 959, 514, 319, 581, 771, 361, 975, 511, 786, 985, 643, 823, 1029, 421,
+    11, 920, 697, 1060, 419, 138, 822, 709, 61, 681, 55, 839, 25, 1044, 544, 168,
+    67, 921, 508, 385, 912, 161, 62, 553, 694, 267, 833, 592, 189, 1003, 533, 118,
+    879, 271, 800, 776, 442, 818, 397, 107, 840, 85, 428, 956, 222, 678, 513, 1052,
+    657, 699, 60, 563, 239, 427, 618, 743, 415, 872, 1031, 712, 765, 186, 357, 821,
+    386, 243, 1022, 530, 507, 703, 101, 47, 939, 664, 673, 96, 337, 860, 624, 568,
+    256, 79, 609, 182, 512, 413, 722, 687, 844, 453, 210, 641, 947, 335, 876, 650,
+    257, 1028, 167, 1058, 200, 736, 902, 35, 320, 795, 145, 1005, 669, 432, 582, 424,
+    727, 251, 410, 114, 538, 845, 916, 206, 153, 156, 881, 778, 766, 77, 183, 154,
+    1024, 754, 19, 384, 911, 124, 254, 990, 619, 499, 367, 706, 917, 311, 1045, 503,
+    583, 515, 399, 705, 603, 330, 94, 276, 224, 559, 50, 961, 490, 1036, 536, 3,
+    521, 1034, 177, 545, 165, 1064, 718, 489, 343, 283, 429, 946, 54, 769, 297, 984,
+    688, 326, 1046, 270, 906, 880, 359, 363, 1059, 918, 83, 608, 762, 166, 32, 327,
+    1053, 653, 318, 685, 628, 803, 958, 812, 488, 241, 733, 970, 841, 324, 597, 380,
+    648, 954, 747, 629, 227, 375, 130, 525, 12, 69, 729, 807, 286, 790, 1047, 228,
+    332, 726, 485, 242, 502, 788, 435, 892, 57, 634, 652, 264, 792, 630, 549, 677,
+    284, 406, 115, 299, 113, 899, 128, 565, 698, 148, 291, 1040, 66, 742, 231, 98,
+    554, 462, 269, 143, 933, 1063, 846, 184, 889, 638, 457, 74, 492, 493, 208, 347,
+    896, 174, 978, 139, 310, 998, 557, 632, 105, 966, 952, 370, 1009, 41, 964, 560,
+    943, 667, 451, 49, 977, 866, 887, 589, 290, 888, 527, 588, 873, 607, 116, 430,
+    287, 48, 461, 758, 686, 979, 913, 693, 28, 352, 412, 42, 999, 815, 20, 838,
+    391, 690, 649, 178, 196, 645, 707, 150, 785, 1001, 418, 81, 59, 329, 910, 76,
+    714, 497, 775, 847, 392, 574, 56, 566, 92, 476, 903, 862, 414, 701, 741, 280,
+    38, 605, 349, 325, 274, 160, 1041, 573, 858, 491, 402, 396, 738, 1008, 417, 193,
+    484, 1004, 218, 1016, 719, 1017, 972, 334, 465, 356, 1012, 157, 374, 980, 602, 642,
+    808, 798, 1010, 285, 761, 723, 253, 27, 830, 547, 152, 721, 341, 919, 953, 480,
+    300, 0, 411, 751, 119, 626, 793, 187, 219, 268, 745, 633, 991, 526, 739, 871,
+    598, 137, 890, 441, 965, 172, 211, 245, 695, 773, 981, 104, 5, 170, 89, 640,
+    226, 295, 552, 973, 615, 63, 273, 64, 884, 504, 230, 1018, 140, 236, 595, 209,
+    796, 444, 16, 850, 458, 995, 142, 787, 928, 656, 683, 68, 1033, 159, 445, 45,
+    546, 80, 882, 371, 342, 715, 29, 500, 585, 141, 1055, 541, 854, 416, 75, 1021,
+    369, 436, 26, 377, 944, 123, 651, 612, 996, 867, 65, 463, 122, 868, 735, 110,
+    393, 108, 322, 180, 556, 382, 39, 293, 567, 86, 229, 398, 486, 433, 266, 885,
+    51, 298, 475, 460, 819, 205, 770, 1025, 531, 877, 606, 93, 37, 315, 73, 915,
+    31, 7, 931, 234, 580, 395, 749, 832, 941, 212, 658, 757, 331, 40, 456, 22,
+    558, 1032, 1027, 639, 576, 307, 71, 125, 88, 891, 362, 524, 232, 97, 1002, 725,
+    532, 662, 305, 136, 279, 238, 1019, 455, 389, 948, 479, 2, 201, 713, 261, 426,
+    774, 518, 213, 692, 13, 163, 223, 21, 303, 825, 577, 4, 195, 522, 403, 483,
+    314, 816, 498, 288, 33, 249, 539, 646, 691, 1026, 58, 561, 246, 710, 578, 740,
+    121, 220, 986, 87, 188, 214, 600, 824, 811, 859, 1030, 878, 1037, 126, 323, 780,
+    791, 1015, 345, 654, 233, 680, 730, 957, 316, 616, 962, 982, 360, 675, 529, 197,
+    102, 637, 936, 43, 10, 809, 372, 149, 617, 625, 34, 672, 813, 768, 1056, 644,
+    376, 333, 134, 968, 1057, 365, 198, 175, 955, 447, 15, 237, 1023, 408, 135, 820,
+    368, 837, 971, 422, 100, 671, 1035, 501, 599, 945, 387, 259, 799, 724, 537, 203,
+    260, 932, 805, 1043, 9, 655, 336, 717, 614, 464, 44, 604, 84, 364, 103, 976,
+    199, 158, 930, 1007, 570, 390, 146, 622, 505, 173, 855, 46, 477, 909, 843, 407,
+    575, 760, 400, 925, 883, 898, 590, 1039, 929, 826, 255, 517, 127, 95, 870, 579,
+    756, 647, 746, 987, 836, 181, 72, 665, 908, 753, 702, 564, 794, 864, 728, 763,
+    204, 53, 988, 905, 306, 117, 593, 111, 863, 734, 720, 469, 679, 6, 296, 404,
+    587, 301, 562, 806, 750, 278, 474, 777, 215, 668, 14, 132, 459, 294, 993, 894,
+    827, 473, 313, 191, 923, 661, 1048, 901, 510, 716, 281, 470, 572, 78, 828, 348,
+    437, 627, 711, 779, 831, 131, 535, 258, 914, 904, 835, 265, 940, 99, 534, 550,
+    409, 670, 70, 900, 551, 250, 874, 613, 767, 91, 494, 989, 431, 755, 934, 594,
+    802, 829, 922, 814, 346, 309, 963, 949, 1062, 997, 797, 216, 8, 1042, 176, 252,
+    893, 853, 700, 155, 358, 272, 247, 969, 169, 434, 202, 179, 120, 481, 620, 689,
+    555, 1014, 321, 994, 520, 659, 869, 454, 586, 596, 861, 519, 355, 542, 772, 849,
+    112, 621, 235, 951, 207, 1011, 783, 340, 1006, 262, 842, 328, 666, 856, 147, 443,
+    379, 339, 405, 852, 1000, 439, 682, 317, 452, 450, 623, 18, 495, 704, 381, 591,
+    90, 109, 423, 1013, 897, 610, 240, 82, 660, 731, 782, 540, 440, 584, 950, 185,
+    30, 865, 151, 350, 277, 225, 466, 221, 875, 446, 516, 106, 676, 162, 886, 312,
+    23, 289, 857, 52, 506, 192, 523, 351, 960, 144, 275, 373, 732, 992, 543, 804,
+    438, 171, 282, 926, 24, 938, 1, 764, 263, 848, 478, 810, 487, 601, 635, 1061,
+    448, 449, 401, 851, 737, 895, 781, 468, 366, 1050, 420, 509, 467, 528, 217, 684,
+    759, 744, 974, 17, 1020, 164, 425, 907, 631, 752, 569, 817, 696, 383, 967, 548,
+    302, 924, 983, 927, 663, 496, 708, 571, 674,
+}};
+
+constexpr std::array<std::int32_t, 508> method_hash_seeds
+{{
+    0, 213, 128, 47, 8, 38, 5, 46, 90, 14, 10, 1, 35, 1, 33, 3,
+    2, 3, 70, 41, 8, 3, 118, 42, 108, 723, 50, -2027, 91, 38, 83, 5,
+    3, 0, 100, 37, 355, 9, 87, 2, 35, 0, 21, 253, 104, 37, 104, 3,
+    13, -2010, 14, 2, 5, 53, -1997, 4, 6, 2, -1894, 51, 124, 352, 3, 3,
+    -1862, 88, 5, 2, 33, 14, 0, 36, 23, 1, 4, 165, -1688, 29, 22, 6,
+    17, 80, 538, 130, 4, 1, 7, 17, 2, 25, 21, 16, -1678, -1667, 149, 34,
+    3, 100, 63, 5, 54, 291, 222, -1634, 4, 125, 3, 4, 2, 20, 386, 159,
+    12, 2, 3, 15, 81, 4, 1, 39, 9, 122, 4, 1, 49, 27, 1, -1522,
+    67, 1, 91, 83, 9, 169, -1491, 293, 158, 219, 238, 8, 119, 113, -1439, -1420,
+    10, 3, 81, 455, 139, 172, -1322, 285, 87, 322, 102, 7, 206, 9, 671, 33,
+    1, 6, 122, 37, 30, 17, -1311, 80, 4, -1201, 285, 1, 653, 3, 435, 209,
+    46, 27, 999, 1, 68, 11, 4, 44, 21, 2, 85, 4, 273, 31, 4, -1124,
+    -1096, 3, -1015, 4, 135, 1, 1, 69, 25, 95, 2, 2, 8, -861, 66, 1,
+    546, 26, 26, 4, 1, 419, 237, 24, 5, 7, 131, 276, 18, 77, 1, 52,
+    132, 127, 3, 737, 416, 109, 298, 3, 9, 16, 171, 4, -841, 156, 344, 57,
+    877, 246, 14, 37, 398, 1, 475, 21, -824, 1, 5, 24, 142, 33, 6, 50,
+    2, 6, 17, 2, 3, 34, 11, 37, 19, 1, 15, 6, 1, 33, 18, 2,
+    30, 1025, 18, 210, 3, 860, 1, 152, 96, 364, 2, 24, 55, 114, 60, 308,
+    21, 1, -806, 67, 1, 38, 1, 17, 11, 296, 306, 81, 17, 46, 93, 258,
+    816, 142, -804, -738, 1, 1, 585, 50, 33, 604, 3, 207, 5, 11, 7, -662,
+    2, 992, 236, 24, 35, 35, 8, 406, 228, 1, 463, 7, 359, 18, 995, 8,
+    -653, 93, 765, 1, 16, 11, 4, 44, 39, 71, 10, 1188, 31, 12, 5, 3,
+    26, 165, 174, 326, 47, 1, 5, 76, 260, 187, 2, 263, -640, 29, 1, -630,
+    245, 1, 12, 0, 11, 19, 71, 20, 1668, 41, 19, 11, 11, 38, -526, 1416,
+    21, -517, 133, 12, 629, 3, 279, -484, 79, 1177, 40, 67, 20, 54, 2, 41,
+    842, 12, 12, 1, 300, 873, 18, 9, 254, 433, 43, 2, 1, 47, 2700, -455,
+    35, 294, 1, 207, 0, 291, 503, 44, 177, 9, 8, 216, 24, 17, 347, 962,
+    171, 1701, -437, 5, 158, 38, 354, 425, 1, 13, 2, 545, 131, 62, 258, 1,
+    1, 480, 642, 103, -333, 25, 126, 201, 141, 1070, 2, 30, 328, 860, -305, 11,
+    5, 1, 3, 157, 344, 60, 120, 1, 1861, 3, 257, 1679, 5298, 7224, 35, 2,
+    493, 314, 938, 248, 10, 51, 94, 23, 1775, -287, 0, 5, 51, 87, 12, 2667,
+    -232, 145, 117, 221, -162, 25, 423, 92, 388, 5, 1, 613,
+}};
+
+constexpr std::array<std::uint32_t, 2032> method_hash_slots
+{{
+    331, 1732, 368, 307, 1113, 1199, 1598, 224, 1379, 455, 339, 1644, 294, 1381, 1896, 478,
+    356, 872, 600, 1692, 521, 767, 1530, 124, 28, 288, 1823, 826, 985, 1524, 1510, 1827,
+    541, 401, 802, 1762, 846, 104, 2001, 56, 1840, 543, 1592, 58, 78, 991, 640, 24,
+    654, 772, 1362, 349, 1629, 601, 589, 745, 1912, 1723, 815, 186, 1170, 269, 1143, 717,
+    555, 2005, 1078, 1087, 435, 849, 490, 1184, 746, 904, 1476, 1010, 159, 386, 1731, 1980,
+    671, 755, 572, 204, 1836, 574, 1313, 1852, 246, 1838, 388, 6, 156, 313, 1714, 1596,
+    1048, 878, 1145, 400, 566, 1552, 1776, 742, 862, 636, 59, 212, 582, 1465, 1769, 1793,
+    1930, 1133, 152, 26, 29, 494, 1292, 1374, 951, 1639, 16, 108, 25, 65, 1094, 1997,
+    38, 1484, 734, 267, 43, 929, 2026, 564, 1122, 801, 1878, 875, 178, 508, 1819, 278,
+    578, 1409, 1149, 1537, 8, 1710, 1088, 1708, 290, 877, 1370, 472, 1108, 714, 1547, 148,
+    1026, 75, 1804, 1914, 141, 1899, 1294, 1659, 1720, 407, 1034, 1237, 1529, 1013, 1097, 71,
+    993, 1673, 1963, 977, 229, 103, 962, 628, 1711, 1036, 351, 683, 1107, 1875, 831, 1391,
+    39, 353, 1889, 1728, 1786, 7, 791, 2013, 1417, 1887, 1139, 1709, 1357, 770, 563, 146,
+    217, 887, 280, 1813, 1724, 1176, 1219, 1943, 916, 868, 1802, 1154, 1811, 380, 1746, 1160,
+    1395, 1299, 528, 970, 657, 881, 1369, 843, 503, 504, 931, 1614, 540, 84, 884, 1151,
+    354, 445, 1789, 1255, 370, 216, 1605, 1302, 223, 698, 1256, 1817, 1397, 579, 171, 262,
+    797, 974, 1105, 646, 449, 679, 1996, 860, 680, 1269, 597, 1055, 1119, 750, 172, 1687,
+    1903, 421, 203, 1032, 1177, 1288, 825, 1834, 510, 1560, 1857, 1014, 297, 1505, 642, 399,
+    1044, 1400, 538, 787, 533, 1100, 1926, 1927, 1589, 1651, 618, 812, 1318, 748, 722, 1033,
+    621, 1759, 1463, 1521, 1076, 662, 984, 1858, 1585, 193, 1368, 1457, 218, 86, 864, 570,
+    1162, 119, 398, 1394, 1194, 438, 1941, 1410, 1084, 50, 1953, 1384, 1691, 1948, 1085, 412,
+    47, 319, 314, 2, 1664, 910, 1745, 0, 1517, 1696, 691, 440, 854, 798, 1272, 1647,
+    1412, 1007, 1355, 394, 1679, 9, 484, 495, 128, 1749, 1315, 1607, 1947, 1531, 1958, 174,
+    1976, 2017, 1846, 1314, 1938, 663, 1452, 1365, 94, 1929, 1509, 345, 1646, 1778, 1115, 1715,
+    1489, 62, 1822, 1073, 428, 1016, 1923, 740, 1454, 532, 176, 1234, 686, 851, 1079, 1533,
+    110, 27, 61, 396, 718, 1146, 975, 1831, 638, 613, 1757, 1251, 1906, 1736, 1920, 390,
+    1361, 470, 1603, 1253, 1155, 167, 1152, 1206, 1117, 575, 1173, 571, 305, 213, 1310, 1451,
+    1345, 1050, 899, 1954, 162, 166, 1742, 1549, 896, 624, 199, 1283, 1068, 981, 260, 1059,
+    1594, 1270, 337, 208, 955, 1464, 1748, 720, 848, 1908, 1429, 234, 907, 1559, 197, 112,
+    1438, 792, 1157, 506, 1344, 272, 1492, 1799, 558, 614, 1352, 1701, 1801, 1982, 514, 187,
+    422, 1083, 737, 1744, 1111, 1005, 690, 340, 1342, 311, 1564, 1527, 1296, 1271, 852, 1917,
+    599, 375, 1546, 946, 329, 1467, 1939, 426, 277, 259, 927, 251, 164, 1662, 1790, 1825,
+    1335, 1665, 1924, 1434, 622, 1508, 1971, 1425, 1236, 925, 448, 1768, 684, 145, 1815, 1112,
+    1359, 1123, 1884, 809, 1153, 749, 1175, 299, 233, 160, 1408, 434, 372, 692, 1343, 1405,
+    1784, 1092, 1289, 1974, 182, 1347, 1228, 1311, 198, 81, 1911, 101, 1499, 68, 355, 518,
+    37, 1542, 1824, 201, 1935, 845, 1590, 1991, 1782, 670, 2000, 441, 54, 773, 1918, 247,
+    725, 1870, 481, 886, 769, 1730, 1895, 1904, 1045, 1485, 782, 1440, 302, 1965, 1287, 1000,
+    1144, 1495, 137, 756, 1404, 972, 584, 963, 179, 2014, 1072, 1336, 76, 1267, 1309, 1933,
+    1821, 1075, 1668, 1504, 778, 404, 1699, 397, 1725, 1791, 149, 192, 1874, 776, 762, 298,
+    335, 813, 2028, 811, 2010, 637, 500, 1972, 338, 227, 583, 511, 1558, 1455, 529, 1581,
+    885, 1136, 1468, 1849, 303, 1432, 1883, 672, 1163, 469, 315, 306, 1794, 384, 1001, 241,
+    1211, 454, 1021, 1264, 1178, 1670, 814, 1089, 1180, 336, 763, 436, 842, 766, 1636, 1570,
+    697, 437, 1247, 1674, 1779, 1482, 954, 1038, 874, 362, 45, 316, 1572, 1131, 1167, 1284,
+    2006, 678, 1642, 1545, 938, 1208, 844, 741, 1942, 1909, 559, 973, 1460, 821, 432, 978,
+    1366, 88, 526, 512, 1675, 643, 1989, 1891, 1217, 271, 1215, 1200, 531, 924, 591, 117,
+    677, 1764, 95, 711, 1600, 585, 603, 1800, 735, 136, 832, 1218, 273, 230, 1348, 1317,
+    606, 1582, 2022, 2029, 1166, 1293, 1239, 357, 220, 1694, 34, 1987, 1060, 1543, 214, 1109,
+    1760, 1447, 1885, 248, 1844, 1439, 1685, 1398, 1502, 982, 1767, 226, 913, 1706, 377, 127,
+    1248, 116, 1201, 379, 326, 1666, 1298, 944, 1413, 82, 855, 295, 265, 1258, 1574, 1681,
+    1571, 1988, 1727, 1622, 1850, 1818, 660, 163, 1297, 918, 723, 822, 1751, 1535, 908, 1047,
+    1583, 1401, 1528, 738, 1459, 1354, 829, 1551, 1936, 1602, 460, 1792, 1860, 979, 1515, 1110,
+    604, 1061, 1444, 1921, 1216, 623, 590, 327, 133, 1325, 91, 41, 3, 869, 73, 1514,
+    1041, 1998, 912, 1898, 1496, 1002, 1604, 1774, 1877, 1680, 1984, 308, 457, 1268, 1031, 134,
+    1281, 1983, 817, 476, 616, 1116, 485, 1364, 743, 704, 1307, 1812, 1221, 473, 997, 630,
+    129, 238, 498, 1414, 753, 1869, 256, 348, 934, 190, 1240, 1051, 707, 1091, 111, 1880,
+    1196, 527, 819, 322, 595, 1487, 1966, 410, 292, 1266, 1250, 51, 1008, 464, 1243, 608,
+    2025, 952, 1090, 1717, 1795, 880, 1773, 1142, 2007, 1628, 980, 1671, 1925, 905, 1978, 1494,
+    1712, 1235, 1820, 1601, 1319, 1012, 1265, 882, 610, 873, 1735, 1540, 958, 429, 46, 856,
+    1483, 1420, 1511, 1866, 430, 1040, 1956, 775, 1195, 115, 544, 1387, 1580, 1030, 1441, 757,
+    501, 55, 48, 1620, 1689, 535, 482, 235, 1516, 385, 373, 1164, 1023, 996, 1584, 1704,
+    1765, 1569, 1024, 1148, 252, 1677, 496, 461, 450, 1205, 442, 433, 759, 567, 1734, 816,
+    764, 1333, 1466, 1916, 546, 463, 1192, 1203, 1555, 781, 631, 956, 1062, 871, 491, 1772,
+    961, 364, 615, 19, 1028, 1905, 1389, 1523, 309, 694, 1507, 64, 1587, 833, 866, 185,
+    453, 1798, 184, 1650, 21, 1886, 1350, 1446, 1081, 922, 23, 1227, 1190, 1418, 53, 1756,
+    140, 1396, 1161, 1056, 674, 1392, 664, 1726, 240, 525, 1747, 1657, 1606, 1191, 1242, 2003,
+    107, 1848, 1, 645, 1252, 1573, 1491, 1893, 279, 2016, 517, 1683, 1845, 98, 114, 1066,
+    1783, 1132, 67, 1752, 1775, 790, 147, 471, 1339, 419, 153, 1872, 383, 194, 557, 906,
+    945, 312, 950, 17, 747, 1099, 914, 317, 805, 1103, 837, 940, 195, 1854, 1037, 895,
+    1967, 607, 620, 1554, 1018, 1990, 334, 573, 960, 1324, 1114, 1567, 733, 1934, 360, 1437,
+    325, 1915, 587, 1902, 1214, 784, 1661, 1104, 1101, 1579, 132, 1950, 231, 1064, 708, 387,
+    90, 1035, 1469, 310, 1913, 1539, 732, 971, 685, 1575, 1754, 228, 1561, 800, 1999, 699,
+    634, 1286, 1688, 100, 835, 1771, 189, 917, 1280, 2019, 650, 72, 894, 1588, 669, 519,
+    926, 1630, 1634, 499, 346, 1305, 414, 1279, 497, 1861, 69, 1566, 1879, 863, 321, 1301,
+    520, 382, 1121, 1422, 85, 1979, 1130, 1182, 1080, 374, 921, 1423, 706, 659, 367, 36,
+    2031, 1488, 1334, 1830, 363, 1241, 712, 1212, 1231, 1669, 941, 1282, 568, 1403, 244, 1900,
+    696, 1367, 1098, 392, 341, 1456, 1096, 786, 207, 1750, 804, 425, 221, 93, 986, 612,
+    840, 1106, 1415, 1682, 1020, 554, 1652, 893, 1864, 1968, 1621, 237, 1360, 1868, 5, 1329,
+    1472, 1443, 1928, 656, 1261, 1907, 550, 1828, 1856, 1213, 1863, 188, 703, 611, 1332, 486,
+    1839, 389, 342, 1577, 1246, 513, 1433, 31, 509, 1183, 834, 18, 754, 1402, 1698, 803,
+    1992, 1461, 57, 2008, 1328, 143, 1881, 361, 285, 2002, 1049, 688, 418, 359, 1702, 1390,
+    1358, 647, 1442, 705, 1095, 1805, 102, 1676, 1141, 681, 456, 1277, 1513, 853, 1993, 1229,
+    333, 1303, 249, 99, 806, 702, 713, 721, 687, 726, 900, 261, 719, 1763, 939, 665,
+    2012, 576, 49, 138, 736, 1740, 253, 1244, 818, 1128, 266, 1419, 1427, 1331, 1796, 1363,
+    1627, 1070, 1082, 446, 629, 1473, 870, 728, 1462, 1346, 988, 1841, 928, 22, 74, 2030,
+    1074, 892, 206, 1843, 1635, 131, 1613, 1388, 13, 633, 598, 105, 765, 347, 1578, 744,
+    1964, 1169, 30, 700, 1147, 1855, 617, 121, 867, 1873, 1480, 1140, 1719, 328, 180, 1960,
+    196, 1493, 1610, 1851, 1538, 1648, 1129, 1525, 1557, 1134, 937, 1897, 551, 411, 1922, 959,
+    592, 376, 324, 475, 652, 452, 947, 1043, 293, 205, 87, 344, 416, 915, 1536, 548,
+    891, 20, 1238, 901, 1686, 444, 1498, 1171, 1015, 106, 1125, 1568, 1124, 1995, 727, 35,
+    658, 483, 1892, 967, 157, 909, 1430, 1816, 79, 1486, 1209, 655, 281, 641, 276, 888,
+    1615, 459, 1093, 150, 1475, 968, 1695, 1063, 1638, 200, 1478, 1541, 458, 1777, 651, 994,
+    883, 799, 1428, 1471, 1753, 1770, 417, 1435, 1766, 175, 211, 1185, 126, 1304, 1222, 66,
+    889, 1663, 810, 1952, 1102, 1022, 1262, 1065, 2009, 1951, 1186, 330, 1882, 467, 1655, 427,
+    287, 1168, 1722, 1009, 761, 903, 1226, 239, 1810, 1174, 695, 393, 1349, 1416, 1640, 1058,
+    667, 1969, 969, 1599, 291, 1274, 1563, 1204, 619, 530, 1994, 1501, 480, 1940, 1278, 830,
+    158, 1658, 1609, 215, 1431, 780, 465, 1077, 1426, 258, 1249, 89, 1006, 1322, 1207, 1809,
+    366, 1743, 1807, 1957, 300, 1788, 552, 1797, 897, 777, 1616, 1867, 898, 415, 1787, 710,
+    1835, 1608, 1017, 964, 1959, 644, 1276, 1961, 857, 758, 350, 42, 1970, 1497, 1611, 1890,
+    1781, 1700, 709, 779, 948, 83, 1631, 10, 1876, 841, 957, 479, 391, 1086, 715, 1445,
+    1641, 1039, 1156, 788, 1986, 1259, 1421, 935, 1595, 1526, 1626, 492, 635, 1532, 796, 760,
+    1137, 1981, 11, 581, 2018, 1519, 1826, 724, 1474, 462, 406, 1553, 144, 1618, 1503, 2015,
+    1371, 1042, 785, 332, 1353, 1859, 639, 1814, 1436, 275, 318, 1338, 1656, 431, 1654, 40,
+    1245, 1660, 403, 1945, 439, 949, 225, 751, 1188, 1649, 569, 1597, 70, 232, 1576, 1847,
+    1179, 165, 858, 505, 1718, 1556, 729, 1223, 169, 1716, 1612, 1165, 966, 1919, 824, 1057,
+    170, 1285, 876, 626, 1181, 1550, 289, 1138, 424, 122, 1623, 1932, 1382, 408, 789, 1202,
+    524, 304, 932, 998, 516, 1697, 423, 77, 151, 466, 202, 1290, 536, 999, 1327, 161,
+    1544, 1785, 794, 1490, 701, 771, 219, 890, 774, 1520, 545, 1150, 1071, 1453, 593, 130,
+    1193, 1653, 653, 1189, 549, 1477, 673, 1406, 343, 487, 1118, 730, 596, 1977, 1684, 1019,
+    413, 768, 2023, 879, 63, 1703, 92, 1224, 242, 1937, 125, 666, 534, 1944, 120, 1291,
+    1458, 1378, 250, 1373, 675, 181, 365, 953, 553, 97, 1220, 1780, 1562, 1624, 60, 625,
+    1518, 1308, 1341, 488, 1888, 255, 1500, 245, 522, 731, 1029, 632, 352, 4, 1127, 502,
+    474, 52, 1320, 1225, 1894, 609, 1741, 539, 865, 1260, 1232, 1853, 1713, 381, 1356, 839,
+    1126, 920, 1233, 586, 820, 270, 983, 1316, 923, 1254, 135, 1380, 676, 2024, 861, 274,
+    1973, 109, 14, 1901, 12, 850, 1946, 142, 1593, 1300, 1230, 468, 254, 537, 264, 286,
+    716, 191, 911, 1842, 1479, 823, 561, 209, 605, 1808, 173, 1351, 1733, 1871, 1385, 1637,
+    990, 808, 1210, 1326, 594, 1340, 395, 739, 859, 1004, 1806, 523, 1931, 1829, 263, 402,
+    1312, 32, 1448, 1672, 1833, 560, 1707, 1257, 1548, 155, 1321, 1910, 1375, 1275, 1198, 447,
+    1586, 828, 489, 451, 296, 515, 693, 1263, 1187, 1729, 1591, 1865, 1470, 995, 1632, 1619,
+    1625, 930, 369, 409, 1025, 1862, 378, 1617, 222, 493, 96, 1399, 942, 1693, 282, 1837,
+    989, 139, 1067, 902, 649, 580, 1011, 113, 371, 847, 1376, 123, 1738, 562, 1120, 2004,
+    1306, 933, 1027, 648, 1534, 1386, 420, 987, 807, 836, 44, 210, 257, 976, 1053, 1069,
+    556, 2020, 1377, 795, 1003, 2011, 284, 1172, 2027, 1985, 565, 1962, 919, 1273, 1737, 682,
+    1450, 661, 1506, 1295, 1761, 1197, 783, 1337, 177, 1158, 1678, 1159, 507, 405, 752, 1383,
+    1975, 1645, 1512, 1803, 1721, 80, 668, 547, 236, 1633, 542, 1758, 602, 936, 1955, 443,
+    1054, 323, 1424, 588, 477, 1449, 1407, 15, 1949, 118, 992, 1522, 1393, 1565, 1667, 268,
+    320, 1690, 2021, 1135, 283, 627, 1330, 1411, 965, 1739, 243, 1323, 1832, 1481, 1052, 943,
+    577, 358, 168, 154, 827, 1755, 793, 183, 301, 838, 1705, 1372, 689, 1046, 33, 1643,
+}};
+
+constexpr std::array<std::int32_t, 366> file_hash_seeds
+{{
+    6, 176, 20, 9, 1, 99, -1467, 4, 4, 11, -1455, 1, -1451, 41, 4, 68,
+    264, 20, 817, -1431, 37, 33, 4, 46, 57, 5, 65, 23, 5, 25, 2, 36,
+    19, -1373, 215, 7, 10, 1, 33, 87, 62, 209, 1, -1359, 25, 3, 51, 1,
+    68, 46, 5, 208, -1355, 24, 0, 154, 1, 1, 33, 2, 51, 2, 115, -1315,
+    -1238, -1215, 101, 6, 12, 6, 4, 37, 77, 57, 3, 49, 44, 5, 0, 63,
+    22, 87, 17, 11, 13, 249, 562, 96, 126, 3, 5, 16, 170, 14, 16, 34,
+    13, 4, 152, 6, 11, 83, 198, 339, 16, 133, 2, 377, 1, -1095, 2, -1007,
+    0, 66, 2, 501, 111, 83, 1, 17, 34, 6, 42, 67, 89, 6, 185, 16,
+    26, 136, 12, 549, 20, 3, 36, 101, 1, 417, 270, -938, 404, 29, 3, 596,
+    16, 36, 2, 105, 165, 1, 68, 1, 4, -789, 193, 640, 565, 123, 3, 2,
+    1, 254, 15, 7, 1, 138, 31, 8, 192, 1, 30, 6, 11, 576, 82, 9,
+    9, 3, -639, 7, 146, 4, 5, 19, 29, 271, 19, 0, -633, 461, 24, 57,
+    16, 18, 1, 27, 290, 9, 97, 58, 3, 1, 104, 2, 1, 21, 38, 5,
+    749, 13, -592, 17, 36, -547, 29, 4, -522, 8, 189, -494, 10, 440, 391, 15,
+    21, 38, 28, 9, 103, -457, 14, 5, 160, 65, 439, 7, 58, 360, 51, 88,
+    -380, 2, 261, 191, 32, 138, 10, -365, 1107, 3, 37, 4, -351, 24, 8, 25,
+    522, 2102, 1, 342, 18, 1248, 132, 1, 1238, 24, 1, 297, 312, 29, 9, 4,
+    263, 723, 56, 12, 2, 41, 2, -302, 23, 419, 242, 176, 9, 436, 0, 1,
+    496, 6, 295, 625, 3, -273, 1, 348, 492, 808, 670, 2, -208, 3, 1, 211,
+    23, 55, 355, 536, 68, 7, 57, 24, 535, 74, 822, 1684, 43, 54, 1, 67,
+    1464, 411, 324, 7, 3, 1180, 1871, 442, 5, 41, 1433, 10, 1, 32, 823, 353,
+    2057, 65, -148, 334, 20, 712, 1219, 66, 40, 6922, 235, -67, 545, 153, 281, 505,
+    29, 24, 10, 1569, 2, -28, 342, 4, 1, 616, 27, 27, 2, 2312,
+}};
+
+constexpr std::array<std::uint32_t, 1467> file_hash_slots
+{{
+    87, 1249, 611, 1419, 273, 208, 180, 1421, 265, 1002, 199, 698, 885, 1148, 1399, 129,
+    1188, 691, 679, 1414, 585, 776, 482, 321, 444, 1021, 361, 673, 605, 1024, 983, 1368,
+    300, 920, 494, 1112, 106, 1167, 667, 1339, 728, 80, 134, 823, 1351, 1142, 677, 406,
+    994, 155, 733, 546, 688, 1234, 755, 40, 1336, 346, 347, 870, 1159, 188, 501, 1436,
+    638, 205, 872, 474, 1352, 448, 460, 625, 579, 304, 1041, 1308, 63, 1076, 158, 630,
+    1418, 787, 943, 964, 50, 832, 378, 617, 796, 405, 237, 1153, 1361, 77, 541, 10,
+    206, 1455, 1226, 157, 1054, 1216, 136, 1077, 8, 990, 589, 882, 382, 469, 466, 655,
+    1017, 339, 1146, 1230, 201, 1068, 1431, 0, 1331, 1394, 1176, 926, 1298, 1174, 632, 1283,
+    1365, 1397, 203, 930, 975, 38, 909, 154, 315, 172, 998, 1220, 921, 1012, 341, 606,
+    1207, 117, 289, 1427, 422, 1254, 362, 1312, 1319, 706, 412, 1323, 1385, 475, 1023, 379,
+    116, 1390, 299, 808, 231, 1237, 1106, 240, 413, 143, 526, 1301, 316, 500, 198, 278,
+    1086, 1097, 337, 389, 678, 372, 430, 375, 568, 1262, 125, 1114, 573, 1133, 138, 1186,
+    874, 626, 854, 306, 1090, 1015, 1320, 810, 357, 1091, 82, 1362, 353, 1434, 835, 1442,
+    1204, 1355, 507, 364, 1171, 513, 359, 32, 662, 239, 664, 772, 1078, 508, 510, 267,
+    608, 499, 830, 512, 1314, 1454, 799, 256, 338, 423, 826, 66, 853, 590, 977, 1396,
+    68, 461, 392, 366, 373, 1043, 282, 1264, 369, 114, 641, 669, 1056, 380, 418, 4,
+    451, 471, 1164, 463, 1029, 447, 1215, 1182, 324, 1031, 1236, 1197, 783, 350, 1461, 477,
+    517, 821, 645, 45, 769, 1066, 557, 549, 281, 317, 1280, 122, 1131, 962, 225, 431,
+    693, 1338, 672, 1104, 548, 35, 1311, 363, 456, 876, 1072, 946, 685, 612, 274, 973,
+    740, 1082, 13, 711, 355, 303, 1374, 658, 1107, 1087, 479, 209, 1025, 354, 99, 797,
+    1277, 495, 266, 93, 1448, 1121, 1118, 135, 202, 969, 1290, 601, 485, 554, 1003, 140,
+    1270, 545, 394, 60, 1214, 46, 43, 1008, 1211, 1137, 1075, 1332, 36, 178, 1255, 918,
+    923, 1464, 1402, 1119, 792, 1063, 1001, 133, 1267, 161, 726, 1297, 1445, 472, 703, 574,
+    542, 462, 1443, 367, 1032, 1305, 250, 1379, 1400, 1187, 153, 1212, 435, 1258, 1259, 505,
+    74, 578, 591, 126, 75, 1151, 1100, 906, 562, 635, 1345, 1018, 820, 1177, 92, 758,
+    908, 25, 1405, 1373, 1282, 1190, 128, 49, 802, 1386, 276, 167, 1050, 931, 44, 409,
+    1371, 486, 624, 1084, 62, 634, 41, 1201, 1206, 310, 833, 569, 1240, 1060, 935, 715,
+    1245, 213, 271, 185, 110, 692, 864, 496, 1322, 860, 663, 42, 1028, 915, 1135, 746,
+    659, 948, 902, 674, 877, 226, 104, 944, 141, 251, 947, 410, 385, 602, 1284, 326,
+    228, 252, 648, 924, 1170, 827, 1040, 159, 1073, 759, 245, 1453, 1313, 72, 286, 388,
+    825, 1145, 441, 836, 571, 91, 1022, 1147, 262, 987, 1004, 1191, 1193, 862, 1239, 383,
+    103, 1342, 1356, 269, 925, 806, 1348, 639, 1360, 1327, 863, 210, 352, 1444, 1034, 1219,
+    761, 986, 861, 1420, 297, 1407, 972, 933, 334, 682, 1260, 875, 1036, 1183, 520, 628,
+    695, 936, 831, 610, 212, 742, 779, 1115, 490, 29, 580, 1432, 846, 963, 175, 640,
+    370, 436, 1108, 54, 1387, 166, 1169, 1357, 1026, 1202, 1439, 527, 955, 618, 1456, 222,
+    187, 400, 1109, 1231, 1129, 522, 1344, 555, 1222, 401, 171, 1229, 824, 131, 1401, 652,
+    182, 747, 1136, 368, 891, 123, 132, 750, 771, 454, 960, 566, 1358, 1173, 916, 455,
+    1065, 1053, 1292, 488, 643, 1228, 1111, 1038, 84, 1353, 894, 1408, 170, 109, 233, 880,
+    850, 147, 439, 438, 264, 845, 687, 260, 1302, 139, 898, 149, 1375, 762, 247, 365,
+    897, 83, 1253, 794, 1299, 1452, 919, 23, 111, 70, 528, 1321, 246, 148, 654, 1389,
+    1178, 1252, 1462, 73, 1251, 847, 1309, 1070, 788, 236, 230, 1310, 254, 21, 335, 1048,
+    1006, 957, 887, 834, 644, 1039, 856, 976, 637, 852, 480, 646, 1179, 312, 258, 344,
+    498, 200, 468, 31, 1067, 550, 58, 1, 1243, 576, 604, 1286, 88, 534, 559, 572,
+    427, 717, 1019, 631, 255, 1335, 524, 805, 1030, 165, 53, 291, 509, 288, 244, 14,
+    699, 858, 871, 952, 961, 540, 1326, 913, 1098, 27, 443, 137, 525, 342, 1061, 1317,
+    1447, 680, 839, 988, 707, 511, 937, 1263, 1196, 785, 96, 424, 809, 145, 229, 730,
+    1429, 59, 1276, 26, 1466, 829, 1046, 318, 1366, 1184, 328, 1064, 649, 647, 959, 450,
+    419, 848, 190, 336, 1080, 280, 152, 708, 307, 1411, 445, 603, 1367, 1306, 487, 1412,
+    816, 1200, 1157, 186, 567, 1199, 694, 1175, 904, 671, 1150, 1198, 1102, 1035, 314, 910,
+    719, 1287, 452, 721, 1013, 241, 1223, 539, 1346, 767, 12, 798, 52, 301, 851, 838,
+    709, 857, 268, 1381, 1117, 404, 596, 970, 533, 701, 120, 544, 483, 98, 407, 1457,
+    1242, 979, 903, 277, 1304, 1460, 1354, 1247, 1227, 1409, 323, 1337, 784, 101, 71, 530,
+    813, 668, 421, 1250, 242, 224, 743, 492, 216, 1189, 1130, 942, 1139, 1192, 765, 1027,
+    348, 398, 1088, 374, 16, 309, 1110, 849, 700, 795, 922, 433, 272, 1152, 1347, 629,
+    497, 1451, 197, 1328, 351, 243, 1275, 741, 9, 1340, 982, 989, 284, 391, 1205, 464,
+    564, 815, 119, 1266, 1052, 661, 263, 1154, 633, 1140, 1465, 1393, 584, 311, 738, 997,
+    1083, 24, 215, 736, 333, 285, 1010, 1392, 748, 941, 1370, 1051, 1020, 837, 1285, 778,
+    377, 620, 978, 204, 1458, 142, 1334, 967, 1325, 163, 896, 420, 828, 325, 547, 1011,
+    1404, 144, 95, 331, 223, 702, 411, 1293, 118, 371, 294, 727, 296, 597, 1450, 478,
+    1278, 1089, 754, 1246, 1422, 651, 992, 100, 393, 1441, 1272, 774, 917, 949, 586, 34,
+    37, 1463, 1438, 940, 521, 194, 600, 56, 751, 535, 619, 232, 473, 319, 48, 432,
+    1303, 1372, 5, 113, 458, 560, 1194, 737, 807, 1459, 1446, 481, 995, 899, 881, 1099,
+    1120, 249, 1085, 502, 739, 293, 971, 1382, 1273, 720, 974, 1160, 33, 227, 656, 17,
+    950, 752, 1141, 811, 97, 1350, 192, 19, 773, 622, 506, 594, 1416, 47, 650, 343,
+    491, 735, 775, 1165, 1042, 127, 729, 1238, 724, 1349, 504, 593, 308, 999, 1256, 1047,
+    516, 801, 598, 725, 1295, 1138, 467, 800, 1116, 660, 425, 782, 69, 168, 1094, 174,
+    892, 416, 804, 257, 108, 386, 1057, 124, 1265, 1069, 434, 859, 397, 818, 121, 621,
+    790, 1300, 928, 1172, 169, 332, 235, 457, 414, 889, 615, 840, 330, 1415, 890, 1033,
+    329, 714, 89, 873, 705, 666, 1217, 390, 214, 428, 207, 1166, 15, 583, 1359, 360,
+    102, 956, 817, 786, 760, 90, 1269, 290, 160, 878, 1181, 1168, 1062, 1195, 642, 429,
+    716, 1294, 768, 609, 883, 1113, 1014, 900, 164, 537, 1218, 105, 55, 577, 683, 690,
+    538, 984, 1079, 11, 657, 581, 570, 770, 907, 85, 327, 968, 686, 791, 217, 1155,
+    503, 179, 1281, 489, 221, 177, 866, 713, 914, 150, 1423, 1103, 744, 218, 2, 756,
+    18, 1330, 302, 437, 279, 1449, 803, 86, 1430, 1380, 1433, 515, 1378, 1307, 675, 1221,
+    176, 476, 1123, 945, 1125, 599, 951, 954, 1318, 51, 1296, 1161, 298, 440, 173, 676,
+    731, 211, 1081, 1341, 1037, 61, 146, 1391, 1208, 1093, 470, 614, 1203, 886, 1185, 67,
+    732, 1058, 993, 710, 1158, 151, 1376, 1007, 493, 196, 1248, 1134, 696, 867, 749, 536,
+    1224, 991, 681, 757, 1074, 868, 582, 484, 563, 426, 1235, 1096, 996, 1225, 387, 112,
+    1257, 248, 1163, 636, 523, 1398, 712, 275, 183, 1329, 1406, 623, 459, 704, 1241, 781,
+    965, 777, 1274, 449, 399, 1324, 395, 1315, 551, 1428, 1049, 107, 627, 20, 396, 292,
+    588, 376, 115, 934, 518, 1363, 844, 1016, 558, 1369, 219, 985, 927, 195, 130, 1384,
+    64, 191, 1271, 1092, 1213, 780, 865, 841, 1059, 697, 543, 270, 1127, 793, 519, 1425,
+    1289, 1210, 403, 1122, 1435, 565, 905, 76, 81, 556, 345, 408, 665, 446, 592, 723,
+    953, 1388, 980, 1291, 442, 888, 261, 79, 766, 670, 30, 22, 234, 718, 901, 453,
+    1279, 283, 819, 745, 1180, 763, 587, 595, 855, 1377, 842, 895, 616, 607, 1437, 929,
+    734, 531, 220, 465, 181, 1044, 1105, 1410, 884, 1000, 305, 514, 156, 184, 322, 553,
+    1128, 981, 259, 1343, 340, 869, 356, 1005, 189, 822, 6, 1232, 320, 1426, 912, 1424,
+    958, 684, 1244, 1288, 1413, 193, 313, 932, 238, 1162, 358, 843, 893, 689, 789, 753,
+    1101, 1124, 94, 812, 1364, 7, 1071, 1009, 575, 1268, 39, 722, 613, 529, 162, 1143,
+    814, 764, 966, 911, 381, 1383, 653, 1209, 1095, 57, 1132, 1233, 253, 1149, 417, 28,
+    1395, 1055, 1156, 1333, 65, 1403, 1045, 1261, 879, 287, 1440, 1417, 1144, 939, 349, 561,
+    295, 3, 938, 1126, 402, 1316, 415, 552, 384, 78, 532,
+}};
+
+constexpr std::array<std::int32_t, 17635> token_hash_seeds
+{{
+    171, 201, 13, 75, 21, 35, 39, 12, 32, 123, 3, 47, 124, 142, 3, 26,
+    24, -70531, 18, -70519, 2, 1, 11, 0, 0, 38, 2, 7, 36, -70501, 4, 5,
+    -70470, 43, 146, -70442, 18, 58, 2, 2, 5, 4, 6, -70417, 7, 19, 30, 17,
+    30, 2, 12, 17, 191, 22, 51, 48, 93, 7, 301, -70370, 22, 71, 5, 1,
+    131, 1, 3, 51, 1, 1, 1, -70365, 13, 2, 153, 7, 2, 102, 63, 209,
+    1, 202, -70346, 24, 21, -70274, 1, 31, 80, 72, 6, 148, 93, 5, 29, 51,
+    21, 4, 3, 4, 15, 14, -70204, 1, 4, 8, 0, -70183, 32, 81, 3, 2,
+    8, 4, 65, 4, 14, 6, 76, 1, 1, 1, -70120, 29, -70042, 5, 8, 164,
+    5, 1, -69987, 2, 78, 5, 138, 9, 14, 10, 404, 15, 6, 17, 29, 0,
+    5, -69955, 179, 21, 3, 142, 15, -69841, 27, 1, 2, 1, 109, 45, 22, 3,
+    2, 9, 12, 3, 2, 208, 61, 1, 15, 103, 1, 1, 7, 98, 2, 215,
+    7, 131, 1, 4, 151, 4, 5, 25, 107, -69839, 15, 1, 5, 3, 156, 528,
+    21, 6, 117, 43, 5, 5, 2, 3, 25, 2, -69826, 16, 155, 10, 89, 70,
+    9, 62, 13, 17, 1, 23, 51, 82, 101, 25, 59, 38, 25, 54, 31, 10,
+    78, 5, 0, 233, 101, 12, 12, 20, 4, -69817, 113, 8, 7, 46, 1, 8,
+    21, 4, 6, 1, 166, 1, 32, 1, 4, 2, 5, 72, 124, 19, 103, 1,
+    -69786, 2, 3, -69651, -69632, 13, 2, 1, 41, 6, 35, 3, 8, 1, 4, 167,
+    24, 1, 6, 79, 25, 4, 81, 3, 7, 411, 27, -69606, 5, 60, 5, -69549,
+    9, -69531, 10, 3, -69528, 374, 4, 21, 17, 42, 8, 7, 247, 68, 15, -69515,
+    62, 18, 4, 627, 633, 7, -69392, 18, 6, 2, 4, 5, 59, 33, 3, 93,
+    142, 33, 26, 1, 32, 54, 48, 17, 36, 22, 67, 3, 1, 4, 24, 3,
+    1, 166, 1, 17, 138, 45, -69349, 97, 1, 45, 3, 20, 147, 16, 10, 2,
+    7, 2, 1, 1, 25, 4, 12, 6, 61, 4, 106, 43, 5, 1, 6, 1,
+    5, 6, 45, 8, 115, 10, 4, 125, 87, 3, 24, 6, 156, 2, 14, 79,
+    8, 56, 5, 19, 20, 30, 10, 30, 35, 1, 2, 70, 12, 17, 1, 9,
+    2, 85, -69225, 7, 66, 7, 2, 262, 32, 59, 115, 34, 6, -69062, 23, 15,
+    -68993, 25, 150, 6, 48, 16, 8, 3, 31, 6, 2, -68986, 155, 10, 2, 1,
+    13, 62, 41, 22, 5, 0, 115, 34, 15, 45, 111, 117, 11, 177, 19, 24,
+    6, 20, 2, 7, 2, 3, 86, 1, -68961, 1, 113, 1, 0, 1, 496, 1,
+    137, 2, 27, 115, 24, 1, 402, 6, 1, 7, 41, 8, 1, 17, 134, 8,
+    5, 43, 0, 123, 17, 14, 496, 27, 2, 81, 1, 197, 47, 38, 11, 17,
+    -68912, 2, 124, 5, 4, 195, 428, 1, 25, 24, 19, 2, 1, 18, 7, 27,
+    88, 2, 1, 75, 1, -68911, 11, 3, 4, 87, 64, 176, 149, -68852, 52, 9,
+    1, 1, 30, 10, 3, 93, 27, 2, 8, 212, 1, 363, 83, 4, 22, 77,
+    69, 4, 9, 56, 438, -68838, 8, 9, 124, 3, 2, -68828, 4, 17, 26, 1,
+    54, 3, 11, -68750, 126, 10, 4, 17, 42, 1, 231, 12, 53, 47, 295, 1,
+    286, 123, 169, 2, 13, 1, 3, 9, 67, 1, 7, 1, 1, 135, 52, 8,
+    12, 9, 225, 11, 3, 1, 5, 14, 1, 109, 10, 33, 45, 3, 1, 11,
+    54, 1, 5, 1, 27, 17, -68661, 31, 5, 179, 1, 8, 19, 30, 108, 91,
+    9, 0, 30, 30, 3, 2, 52, 1, 13, 0, -68574, 173, 82, 5, 41, 21,
+    4, 3, 41, 4, 25, 103, 122, 7, 1, 155, 2, -68568, 4, 2, 3, 211,
+    50, 10, 1, 9, 334, 210, 8, 9, 2, 76, 1, 1, 5, 1, -68524, 11,
+    2, 46, 9, 1, 2, -68462, 107, 59, 12, -68415, 13, 1, 1, 1, 173, 54,
+    37, 19, 15, 1, -68379, 1, 40, 67, 24, 3, 141, 19, 15, 18, 96, 15,
+    19, 3, 32, -68270, -68246, 25, 13, 7, 18, 42, 18, 6, 139, 36, 34, -68232,
+    -68195, 317, 136, 6, 3, 66, 105, 18, 1, 4, 28, 8, 20, 83, 2, 111,
+    1, 2, 25, 28, -68115, 4, -68074, 29, 7, 47, 25, 3, 9, 4, 5, 24,
+    6, 120, 13, 52, 20, 6, 154, -68062, 25, 54, 74, 35, 1, 7, 30, 1,
+    27, 62, 23, 7, 36, 1, 206, 0, 2, 18, 103, 23, -68030, 58, 94, 1,
+    1, 1, 1, 8, 48, 27, 15, 4, 16, 17, 34, 373, 6, 34, 36, 17,
+    78, 204, 1, 174, 998, 18, 39, 54, 73, 31, 38, 2, 15, 1, 1, 286,
+    -68014, 33, -67918, 122, 7, 2, -67865, 6, 37, 301, 73, 40, 9, -67806, 10, 28,
+    5, -67751, 35, 173, 1, 193, 23, 17, 150, 6, 11, 139, 1, 1, 1, 90,
+    -67741, 2, 79, 36, 4, 9, 36, 1, 26, 23, 4, 40, 332, 98, -67708, 5,
+    1, 18, 81, 162, -67597, 1, 3, 3, 3, 4, 9, -67569, 5, 5, -67559, 146,
+    77, 0, 112, 56, -67537, 4, 7, 2, 2, 8, 3, -67514, 2, 2, 5, 47,
+    64, 4, -67487, 2, 39, 8, 21, 417, 12, 1, -67460, 44, 9, 385, -67366, 362,
+    24, 121, -67292, 172, 74, 1, 15, 1, 17, 62, 1, 11, 10, 425, 6, 1,
+    56, 47, 5, 1, 19, 21, 144, 1, 1, 12, 91, 24, 177, 10, 48, 147,
+    3, 7, -67261, 353, 20, 4, -67217, -67202, 87, 196, 54, 23, 1, 3, 19, 5,
+    46, 1, 51, 9, 1, 41, 6, 30, 3, 21, 184, 1, 3, 23, 19, 12,
+    2, 47, 21, 25, 26, 146, 13, 2, 4, 5, 99, 2, 13, 3, 13, 1,
+    177, 10, 15, 6, 87, 8, 38, 7, 13, 1, 8, 204, 101, 52, -67143, 2,
+    7, 7, 143, 220, 1, 71, 4, 1, 38, -67133, 44, 7, 354, 7, 2, 8,
+    17, 404, 197, 52, 20, 2, 1, -67047, -67032, 2, 27, 169, 10, 182, 3, 37,
+    44, 3, 19, 4, 53, 3, 50, 1, 2, 71, -67004, 1, 6, 2, 19, 13,
+    75, 2, 7, 163, 1, 71, 4, 50, 9, 45, 3, 46, 58, 20, 45, 15,
+    196, 3, -66968, 41, -66949, 1, 17, 17, 10, 275, 1, 432, 10, 38, 33, 257,
+    217, 105, 4, 2, 1, 15, 304, 236, 43, -66852, 11, 3, 298, 30, 134, 19,
+    56, -66829, 25, 1, 4, 119, 129, 36, 6, 2, 8, 1, 46, 96, 23, 1,
+    104, 39, 8, 29, 88, 1, 3, -66766, 2, 2, 69, 59, 12, 89, 9, 168,
+    190, 2, 87, 6, 1, 9, 508, 12, 39, 47, 2, 48, 6, 228, 3, 3,
+    4, 2, 6, 74, 54, 41, 2, 17, 6, 1, -66685, 109, 62, 1, 22, 21,
+    98, 6, -66466, -66465, 145, 78, 9, 1, 2, 19, 1, 33, 0, 11, 28, 6,
+    1, 1, 4, 27, 12, 38, 2, 10, 5, 8, 38, 3, 68, 17, 109, 10,
+    121, 8, 21, 4, 2, 4, 21, 1, 443, 32, 1, 144, 13, 0, 22, 100,
+    206, 1, 94, 11, 1, 0, -66401, 8, -66364, 21, 5, 31, 89, 4, 3, 1,
+    165, 7, 10, 11, 70, 12, 45, 1, 23, 17, 20, 14, 8, 6, 48, 7,
+    1, 262, 1, 25, 51, 29, 1, 3, 108, 1, 56, 8, 2, 24, 4, -66281,
+    3, 2, 70, 593, 68, 26, 74, 20, 12, 126, 55, 13, 129, 2, 7, 251,
+    16, 41, 4, 155, 129, -66267, -66160, 7, 75, 3, 1, 39, 10, 88, 7, 2,
+    1, 9, 29, 34, 1, 59, 38, 2, 0, 8, 10, 6, 3, 9, -66105, 0,
+    2, 35, 0, 20, 36, 76, 0, 24, 16, 1, 6, 18, 3, 1, 175, 23,
+    3, 27, 22, 9, 178, 12, 2, 62, 67, 10, 161, 2, 5, 1, 2, 25,
+    5, 7, 9, 1, 72, 2, 0, 30, 31, 4, 1, 106, 40, 10, 18, 64,
+    14, 39, 1, 117, 15, 21, 69, 243, 0, 158, 61, 149, 54, 77, 260, 568,
+    59, 215, 72, 60, 26, 13, 12, 32, 17, 1, 25, 3, 98, 113, 16, 1,
+    2, 30, 159, 71, 34, 129, 2, 4, 33, 76, 74, 185, 19, 19, 18, 37,
+    199, 34, 16, 11, 139, 4, 34, -66089, 15, 17, 1, 45, 91, 2, 13, 4,
+    1, 20, 45, 64, -66069, 55, 13, 6, 4, 87, 1, 16, 2, 4, 13, 9,
+    4, 9, 30, 73, 26, 165, 33, 101, 22, 1, 104, 11, 98, 33, 92, 1,
+    2, 22, 116, 0, 11, 5, 2, 138, 10, 252, 171, 222, 41, 1, -65997, 3,
+    5, 75, 1, 3, 31, 44, 51, 29, 7, 3, 8, 6, 18, 16, 12, 64,
+    -65801, 4, 4, -65697, 1, 2, 100, 129, 5, 137, 95, 2, -65614, 1, 2, 126,
+    19, 0, 131, 46, 53, 1, 267, 219, 1, 2, 40, 4, 7, 12, -65602, 17,
+    2, 478, 1, 54, 15, 1, 12, 4, 2, 2, 1, 88, 63, 3, 37, 4,
+    3, 3, 10, 346, 96, 11, 64, -65473, 30, 48, 48, 3, 16, 13, 11, 7,
+    253, 180, 3, 67, 3, 86, 64, 8, 3, 38, 430, 2, 43, 1, 4, 1,
+    3, 187, 26, 244, 1, 21, 14, 244, 467, 5, 76, 4, 49, 21, 10, 13,
+    32, 1, 8, 4, 109, 86, 208, 374, 3, 60, 99, 8, 16, -65459, 41, 0,
+    108, 20, 0, 48, 59, 85, 19, 168, 15, 2, -65324, 92, 83, 582, 53, 27,
+    2, 1, 19, 92, 11, 11, 374, 10, 7, 12, 6, 262, 1, 154, 9, 87,
+    9, 15, 2, 1, 2, 1, 35, 11, 82, 3, 94, 2, 13, 357, 45, 111,
+    60, 48, 19, 54, 5, -65280, 4, 56, -65109, 1, 4, 48, 6, -64960, 17, 74,
+    23, 54, 18, 70, 38, 5, 102, 5, 10, 22, 293, 5, 23, 14, 20, 31,
+    237, -64894, 12, 10, 3, 75, 11, 18, 1, 37, 1, 14, 43, -64821, 42, 1,
+    1, 15, 14, 8, 10, 35, 8, 92, 11, -64795, 133, 59, 150, 1, 1, 16,
+    18, 2, 19, -64766, 347, 7, 25, 17, 77, 46, 93, 35, -64715, 17, 2, 14,
+    41, 2, 43, 43, 1, 99, 1, 2, -64609, 5, 2, 29, 139, 2, 41, 26,
+    59, 1, 1, -64590, 5, 118, 33, 41, 2, 5, 26, 3, 149, -64578, 109, 5,
+    1, 1, 1, 4, 3, 1, 15, -64515, -64386, 128, 2, 29, 5, 7, 0, 19,
+    3, 55, -64378, 1, 13, 4, 44, 1, 7, 68, 21, 29, 8, 0, 142, 12,
+    96, -64303, 2, 85, 6, 307, 13, 309, 4, 55, 240, 146, 18, 11, 13, 32,
+    12, 154, 1, 108, -64245, 57, 169, 17, -64222, 252, 3, 20, 209, 5, 4, 141,
+    3, 10, 160, 118, 69, 76, 1, -64054, 172, 11, 3, 16, 10, 5, 29, 79,
+    10, 5, 117, 53, 24, 33, 6, 53, 1, 235, 11, 5, 3, -63996, 32, 2,
+    29, 94, 54, 12, 93, 137, 8, 11, 3, 18, 49, 15, 1, 2, 320, 1,
+    155, 145, 1, 80, 12, 116, 22, 16, 21, 14, 54, 82, -63970, 1, 71, 2,
+    58, 144, 42, 564, 7, 2, 64, 480, 1, 100, 1, 160, 66, 2, 1, 1,
+    335, 15, 14, 4, 5, 62, 1, 2, 458, 21, 2, 99, 123, 1, 213, 176,
+    85, 4, 165, 2, 28, 12, 46, 16, -63810, 102, 179, 443, 23, 53, -63780, -63733,
+    420, 41, 1, 1, 7, 2, 8, 3, -63633, 5, 100, 0, 7, 27, 3, 2,
+    30, 3, 388, 6, 2, 204, 7, 21, 2, 69, -63524, 136, 10, 108, 1, 683,
+    1, 1, 3, 9, 42, 26, 11, 10, 2, -63520, 75, 139, 29, 191, 14, 54,
+    1, 9, 287, 41, 15, -63503, 3, 40, -63446, 3, 37, 1, 23, 219, 78, 1,
+    5, 66, 953, 1, 1, 12, 10, 64, 1, 66, 2, -63428, 0, 1, -63317, 8,
+    18, 109, -63311, 251, 1, 427, -63292, 1, 14, 2, 3, 8, 7, 1, 95, 2,
+    291, 211, 220, 198, 37, 9, 278, -63262, -63191, 215, 9, 26, 4, 14, 2, 2,
+    1, 14, 17, 4, -63139, -63044, 397, 8, 3, 6, 106, 7, 3, 4, 6, 22,
+    28, 1, 26, 109, 5, 106, 78, 1, 7, 190, 1, 7, 69, 290, 77, 4,
+    5, 21, 205, 124, 1, 26, 187, -63028, 217, 1, 121, 13, 0, 7, 18, 32,
+    1, 10, 1, 5, 80, 35, 1, 1, 50, 18, 31, 22, 71, 188, 42, 75,
+    1, 3, 9, 82, 149, 3, 613, 128, -63001, 57, 67, 26, 25, 55, 1, 12,
+    5, -62929, 55, 39, 70, 4, 112, 750, 6, 5, 7, 48, 169, 5, -62904, -62898,
+    1, -62765, 44, -62724, 31, 3, -62711, 25, 52, 14, 1, 112, 230, -62684, 4, 37,
+    26, 6, 74, 32, 8, 1, 240, 172, 1, 58, 424, 4, -62637, 16, 62, 17,
+    10, 6, 125, 1, 23, 142, 126, 24, 205, 22, 12, 1, 6, 0, 0, 49,
+    81, 193, 74, 313, 84, 30, 1, 6, 66, 2, -62629, 8, 323, 75, 7, 72,
+    3, 3, 40, 17, 5, -62606, 3, 115, 8, 99, 38, 4, 1, 131, 5, 39,
+    1, 4, 47, 0, 3, 5, 9, 5, 40, 355, 0, 288, 111, 14, 45, 208,
+    12, 9, 2, 23, 64, 73, 46, 25, 6, 6, 65, 87, 163, 34, 5, 72,
+    2, 2, -62601, 316, 1, 234, 19, 1, 3, 21, 3, 75, 16, 2, 30, 1,
+    -62492, 2, 18, 1, 4, 137, 246, 24, 2, 2, 112, 3, 299, 1, 101, 28,
+    3, -62483, 411, 1, 50, -62441, 5, 11, 311, 98, 23, 2, 205, 6, 5, 9,
+    11, 0, 21, 4, 28, 57, 170, 329, 37, 54, 110, 129, 27, 6, 1, 5,
+    2, 1, 6, 100, 1, 74, 24, 3, 37, 5, 2, 20, 81, 83, 5, 3,
+    1, 11, -62403, 9, 275, 92, 77, 218, 1, 204, 281, 221, 67, 7, 527, 1,
+    25, 14, 32, 63, -62352, 6, 3, 18, -62343, 23, -62265, 10, 0, 3, 222, 113,
+    9, 3, 1, 2, -62250, 4, 69, 46, 2, -62211, 163, 3, 364, 2, 11, -62173,
+    -62119, 3, 0, 26, 33, 9, 111, 139, 279, 0, 48, 3, 82, 11, 103, 7,
+    15, 137, 1, 491, 4, 26, -62088, 134, 12, 35, 46, 5, 37, 14, 63, 7,
+    12, 12, 208, 14, 198, -62050, 128, 54, 51, 79, 84, 157, 9, -62041, -61969, 2,
+    13, 10, 71, 14, 32, 2, 9, 327, 94, 121, 2, -61943, 403, -61887, 142, 119,
+    347, 1, 25, 2, 241, 7, 23, 5, 82, 1, 28, 2, 104, 4, 22, 4,
+    1, 3, 94, 103, 131, 38, 1, 111, 85, 3, 8, 8, 15, 137, 198, 61,
+    7, 9, 0, 116, 57, -61882, -61855, 25, 32, 4, 7, 2, 1, 131, 26, 26,
+    47, 1, 47, 31, 489, 77, 1, 2, 4, 45, 67, 5, 24, 75, 236, 85,
+    76, 1, 11, 27, 49, 65, 33, 1, 37, -61791, 58, 6, 143, 33, 4, -61600,
+    59, -61574, 75, 3, 66, 56, 4, 290, 12, 41, 19, 2, -61515, 13, 1, 2,
+    32, 4, 15, 141, 93, 5, 414, 56, 198, 79, 47, 3, 73, 31, 7, 2,
+    9, 455, 28, 10, 45, 49, 124, 16, 47, 7, 114, 1, -61500, 3, 15, 1,
+    24, 8, 5, 2, -61443, 4, 17, 45, 7, 15, -61437, 33, 151, 106, 150, 29,
+    173, 14, 7, 70, 155, 116, 39, 0, 6, 11, 2, 23, 3, 2, 244, 23,
+    1, 25, 55, 652, 2, 628, 1, 94, 185, 3, 65, -61327, -61304, 11, 3, 2,
+    86, 27, 5, 97, 5, 15, 155, 276, 2, -61145, 1, 19, 8, 3, 13, 278,
+    87, 129, 129, 1, 107, 4, 1, -61102, 33, 0, 138, 4, -61075, 7, 24, 41,
+    5, 72, 12, 324, 25, -60995, 2, 6, 60, 145, 81, 10, 1, 72, 2, 32,
+    18, 385, 1, 38, 41, 94, 80, 0, 4, 6, -60870, 133, 402, 1, 100, -60739,
+    3, 4, 2, 458, 18, 37, 114, 52, 5, 256, 102, 1, 12, 117, -60654, 69,
+    74, 29, 1, 543, 7, 1, 2, 1, 250, -60312, 8, 248, 52, 3, 7, 59,
+    0, 4, 3, 1, 70, 25, 99, 7, 262, 45, 13, 11, -60285, 2, 28, 74,
+    11, 25, -60275, 4, 9, 47, 5, 12, -60217, 14, 9, 1, 15, 11, 4, 16,
+    13, 3, 10, 2, 18, 1, 14, 1, 30, 6, 4, 13, 59, 2, -60089, 2,
+    -60032, 136, 2, 17, 196, 52, 45, 20, 4, 33, 24, 26, 29, 26, 88, 23,
+    10, 1, 7, -59995, 61, 13, 1, 1, 500, 6, 5, 79, 2, 57, 1, 79,
+    -59932, 42, 5, 5, -59865, 3, 136, 248, 43, 203, 387, 14, -59864, 2, 42, 3,
+    74, 22, 291, 66, 907, 14, 5, 1, 2, 38, -59834, 161, 7, 4, 1, 4,
+    -59817, 1, 35, 5, 13, 13, 211, 5, 1, 130, 37, 2, 5, -59658, 89, 0,
+    39, 4, 14, 1, 33, -59631, 10, 6, 150, 1, 36, -59599, 3, 2, 5, 56,
+    107, 28, 5, 107, 4, -59515, 2, 25, 190, 140, 10, 16, 21, 164, 94, 34,
+    60, 121, -59492, 1, -59389, 2, 2, 8, 92, 65, -59310, 1, 26, 34, 1, 83,
+    6, 4, 3, 4, 96, 8, 3, 130, 77, 130, 8, 23, 1, 27, 11, 28,
+    165, 13, -59216, 3, 31, 263, 15, -59211, 59, 8, 7, 1, 2, 115, 124, 15,
+    222, 16, 8, 292, 266, 38, -59209, -59206, 3, -59171, 3, 86, 24, 1, 108, 8,
+    0, 67, 25, 211, 17, -59157, -59111, 82, 231, 90, 60, 222, -59066, 177, 21, 110,
+    4, 40, 17, 125, 87, 2, 10, 18, 283, 2, 1, 11, 1, 41, 26, 7,
+    13, 34, 11, 74, 9, 2, 6, 31, 137, 1, 87, 6, 7, 138, 2, 271,
+    2, 412, 71, 333, 426, 57, 2, 2, 26, 37, 7, 17, 2, 3, 11, -59061,
+    -59040, 11, 270, 0, 160, 2, 14, 124, 88, 7, 15, 5, 120, 5, 85, 285,
+    -58867, 8, 10, 35, 5, 7, 9, 4, 185, 194, 6, 44, 182, 146, 59, 4,
+    -58859, 28, 28, 8, 217, 93, 74, 12, 1, 19, 39, 2, 4, 111, 7, 90,
+    5, 2, 80, 124, 910, 2, 36, -58829, 4, 24, -58753, 0, 9, 1, 14, 0,
+    1, 1, 48, 38, 24, 5, 8, 52, 132, 8, 36, 1, 3, 86, 20, 3,
+    22, 26, 14, 259, -58721, 21, 3, 193, 49, 137, 14, 48, 189, 50, -58622, 30,
+    55, 233, 17, 2, 146, 7, 116, 89, 24, 45, 238, 25, 1, 1, 49, 25,
+    82, 11, 3, 36, 1, 19, 3, 60, 1, 9, 26, 18, 95, 29, 1, 13,
+    0, 6, -58614, 3, 15, 19, 0, 1, 206, 7, 17, 1, 7, 174, 2, 7,
+    12, 64, 1, 25, 4, 1, 287, 6, 22, 2, -58450, 0, 13, 8, 14, 440,
+    -58398, 0, 1, -58354, 6, 290, 19, 26, 223, 36, 114, 2, 4, -58352, 19, 2,
+    152, 7, 42, 2, 5, 69, 3, 21, 203, -58245, 2, 3, 350, 36, 30, 7,
+    -58171, 523, -58133, 174, 3, 4, 21, -58117, 1, 170, 20, 7, 213, 110, 410, 28,
+    4, 15, 1, 91, 2, 151, 40, 25, 17, 17, 11, 55, 0, 125, 15, 6,
+    7, -58108, 0, 31, 205, 3, 272, 84, 18, 180, 3, 28, 758, 48, -58067, 265,
+    90, 50, 23, 8, 47, 2, 1, -58037, 4, 64, 166, 99, -58032, 18, 40, 162,
+    2, 3, 21, -57960, 22, 6, 3, 5, 210, 9, 254, 88, -57891, 73, 39, 4,
+    4, 4, 90, 73, 1, 13, 95, 15, 187, 73, 50, 14, 1, 17, -57767, 11,
+    8, 21, 2, 3, 33, 0, 4, 10, 1, 8, 1, 44, 37, 7, 53, 2,
+    7, 10, 1, 6, 43, 1, 4, 4, 279, 14, 85, 1, 91, 13, 3, 7,
+    1, 63, 213, 79, 173, 59, 5, 8, 92, 48, 138, 4, 124, 114, 61, 20,
+    1, 2, 45, 284, 144, 5, 14, 2, 31, 47, 71, 13, 9, 14, 2, 3,
+    1, 73, 3, 83, 55, 4, 41, 11, 188, 23, 71, 2, -57615, 7, 1, 1,
+    20, 140, 8, 6, 147, 15, 67, 8, 72, 13, 291, 2, 81, 90, 74, 26,
+    31, 10, 52, 60, -57597, 245, 288, 54, 105, 9, 84, 3, 12, 257, 17, 41,
+    23, 11, 20, 6, 59, 1, 57, 9, 9, 2, 20, 6, 3, 21, 15, -57577,
+    3, -57538, 14, 43, 1, 142, 2, 2, 17, 18, 7, 1, 123, 7, 26, 27,
+    27, 3, 128, -57471, 4, 0, -57383, 273, 2, 56, 84, 2, 86, 4, 137, 3,
+    -57365, 31, 300, 1, 0, 22, 12, 4, 1, 11, 5, 1, 18, 19, 4, 1,
+    8, 2, 112, 3, 54, 417, 410, 11, 243, 17, 20, 9, 6, 1, 33, 106,
+    311, 7, 23, 32, 3, 153, 49, 2, 17, 20, 20, 8, 382, 25, -57358, 8,
+    37, 36, 5, 94, 19, 717, 3, 1, 1, 10, 8, 2, 3, -57320, 83, 1,
+    81, 12, -57311, 104, 33, 5, 115, 64, 1, 57, 7, 45, 56, 155, 35, -57274,
+    43, 188, 9, 2, 18, 180, 5, 44, 1, 11, 87, 5, 274, 4, 13, 1,
+    447, 117, 4, 140, 8, 80, 161, 3, 1, 24, 21, 245, 12, 228, 9, 379,
+    163, 1, 2, 132, 3, 34, 1, 7, -57262, 5, 281, -57111, 77, 330, 30, 229,
+    1, 45, 1, 66, 1, 33, 1, 326, 50, 37, 3, 94, 9, 46, 3, 68,
+    1, 24, 4, 24, 2, 36, 274, 219, 150, 1, 82, 440, 41, 197, 1, 180,
+    -57108, -57007, 95, 1, 87, 61, 25, 1, 1, 143, 216, 1, 1, 7, 124, 244,
+    3, 14, 12, 8, 23, 106, 397, 793, 8, 25, 37, 50, 15, -56996, 17, 55,
+    4, 1, 17, 280, 14, 1, 2, 125, 0, 328, 6, 48, 171, 12, 2, -56913,
+    8, 307, 6, 20, 11, 11, -56905, 49, 1, 279, -56842, 89, 9, 10, 10, 0,
+    22, 12, 29, 9, 3, 51, 94, 24, 3, 1, 17, 44, 9, 4, 65, 4,
+    5, 1, 66, 13, 18, 7, 1, 4, 2, 14, 14, 112, 312, 23, 14, 6,
+    30, 171, 13, 341, 0, 12, 5, -56833, 10, 7, 12, 45, 1, 0, 1, 317,
+    33, 18, 25, 77, 91, 1, 5, 33, 78, -56819, 19, 69, 2, 31, 61, 355,
+    10, 14, 30, 84, 1, 13, 6, 35, 38, 20, 8, 38, 1, 55, 1, 3,
+    17, 30, 2, 2, 2, 4, 1, 18, -56800, 23, 408, 493, 9, 143, 3, 20,
+    2, 297, 125, 368, 54, 5, 14, 21, 29, 112, 20, 15, 20, 37, 34, 0,
+    7, 31, 6, 12, 248, -56793, 275, 5, 117, -56763, 2, 5, 59, 1, 3, -56703,
+    121, 1, 0, 4, -56656, 26, 52, 5, 111, 181, 89, 106, 181, 524, 67, -56613,
+    187, 2, 2, 347, 22, 30, 186, 8, -56601, 18, 22, 14, 6, 8, 7, 14,
+    273, 4, 6, 45, 1, -56591, 2, 52, 117, 24, 4, 198, 2, -56467, 0, 73,
+    2, 249, 212, 1, 267, 1, 19, -56416, 14, 194, 1, 48, 17, -56388, 8, 146,
+    13, -56265, 21, 556, 61, 111, 52, 60, 2, -56222, 26, 35, 19, 15, 10, 8,
+    8, 386, 6, 17, 49, 10, 31, 91, 3, 292, 26, 33, 17, 9, 63, 2,
+    244, 1, 0, 38, 4, 69, 130, 298, 89, 21, 184, -56209, 8, 4, 44, 83,
+    186, 1, 20, 18, -56195, 2, 1, 3, 34, 58, 8, 5, -56176, 53, 194, 52,
+    -56172, 1, 231, 6, 122, 34, 2, 2, 7, 152, 403, 33, 95, 36, 158, 45,
+    1, 272, 1, 29, 3, -55964, 4, 34, 53, 156, 74, -55936, 354, 111, 1, 37,
+    344, 3, -55935, 52, 142, 30, 560, 32, 28, 445, 244, 467, 9, 10, -55855, 62,
+    3, 1, 2, 3, 3, 93, 573, 170, 3, 413, 255, 6, -55792, 40, 4, 60,
+    8, 28, -55670, 3, 1, 34, 69, 3, 58, 1, 77, -55639, 348, 153, 26, -55612,
+    -55580, 2, 44, 5, 3, 10, 21, 77, 6, 237, 135, 26, 4, 2, 10, 33,
+    3, 129, 56, 157, 9, 29, 169, 4, 8, 90, 12, 51, 342, 186, 54, 168,
+    13, 94, 35, 82, 1, 20, 1, 13, -55566, 349, 10, 57, 110, 27, 5, 22,
+    0, 1, 14, 2, 21, 14, 7, 4, 16, 55, 1, 6, 306, 1, 27, -55557,
+    120, 131, 7, 32, 86, 287, 48, 7, 150, -55458, 22, 4, 200, 3, 324, 1,
+    -55281, 60, 0, 124, 12, 10, 9, 24, 4, 60, 12, 105, 230, 24, 1, -55253,
+    73, 16, 4, 55, 96, 6, 1, 127, 36, 0, 4, 9, 226, 140, 12, 2,
+    26, 294, 174, 24, 187, 11, 96, 3, 90, 42, -55252, 10, 18, 1, 2, 112,
+    -55220, 40, 1, 40, 205, 2, 46, 10, 81, 2, 4, 1, 29, 1, 1, 1,
+    89, 2, 7, 125, 71, 1, -55121, 13, 25, 7, 4, 82, 11, 127, 4, 87,
+    175, 5, 39, 7, 3, 27, 52, 296, 4, 16, 5, 1, 42, 21, 23, 135,
+    15, 3, 2, 200, 304, 55, -55072, 132, 2, 15, 3, 0, 37, 263, 42, 2,
+    -55040, 20, 556, 139, 1, 28, 4, 68, 5, 43, 13, 92, 7, 5, 18, -54868,
+    18, 1, 25, 388, 43, 7, 9, 11, 1, -54857, 1, 134, 1, 90, 2, 10,
+    3, -54840, 202, 1, 1, 112, 90, 8, 20, 51, 17, 3, 9, 9, 243, -54716,
+    1, 34, 59, 22, 12, 206, 88, 79, 5, 455, -54679, 41, 107, 310, 11, 103,
+    1, 2, 260, 1, 58, 52, 25, 136, 3, 3, 18, 1, 155, 0, -54386, -54314,
+    -54282, 113, 1, 1, 3, 7, 23, 187, -54240, 4, 1, 846, 22, 30, 52, 85,
+    10, 20, 71, -54179, 1, 4, 31, 231, 1242, 3, 9, -54167, 285, 69, 7, 0,
+    4, 288, 148, 135, 1, 20, 45, 12, 55, -54145, 2, 39, 177, 4, 63, 194,
+    6, 485, 60, 14, 158, 342, 29, 23, 85, 10, 35, 10, 72, 3, 11, 39,
+    13, 32, 83, 2, -54089, 8, 1, 150, 76, 4, 68, 147, 116, -54074, 9, -54036,
+    1, -54011, 6, 6, 4, 1, 136, 15, 53, 3, 203, 346, -53976, -53975, 310, -53957,
+    87, 19, 2, 2, 51, 4, 59, 35, 2, 5, -53890, 4, 359, 57, 44, 159,
+    13, 6, 2, 3, 12, 22, 45, 156, 25, 192, 14, 176, 6, 11, 52, 5,
+    50, 8, 81, 20, 7, 5, 7, 1, 24, 381, 29, 2, 7, 35, 214, 44,
+    7, -53780, 11, 3, 150, 6, 188, 3, 7, 5, 50, 0, 23, 0, 24, 39,
+    23, 106, 10, 142, 38, 29, 493, 7, 24, 56, 4, 1, 1, 11, 61, 35,
+    3, 123, 36, 32, 64, 19, 1, 49, 142, 2, 4, 3, 11, 3, 223, 9,
+    26, -53610, 1, 266, 394, 4, 76, 53, 0, 2, 32, 71, 6, 11, 9, 174,
+    38, 2, 1, 3, 66, 185, 21, 36, 142, 11, 2, 542, 137, 133, 1, 70,
+    0, 19, -53586, 2, 225, 4, 129, 1, 178, 21, 4, 14, 66, 7, 6, 29,
+    3, -53583, 105, -53505, 3, 1, 26, 257, 120, 282, 4, 4, 4, 160, 0, 219,
+    4, 102, 46, 12, 3, 118, 8, 1, -53497, 142, 2, 1, 134, 7, 47, 6,
+    118, 2, 2, 58, 262, 1, 71, 230, 18, 20, 497, 42, 212, 115, -53352, 9,
+    46, 123, 117, 13, 27, 22, 54, 8, 10, 7, 165, 63, 166, 4, 151, 4,
+    389, 21, -53232, 5, 346, 65, 53, 21, 32, 220, 35, 2, 1, 40, 14, 32,
+    24, -53223, 32, 75, 10, 1, 25, 22, -53121, 7, -53012, 200, 76, 89, 3, 10,
+    178, 11, 0, 5, 57, 136, 25, 28, 30, 91, 109, 6, 9, 219, 394, 240,
+    1, 9, 5, 31, 81, 41, 2, 1, 1, 55, 52, 45, 76, 6, 198, 37,
+    202, 41, 98, 48, 104, 0, 64, 3, 366, 261, 245, 37, 2, 90, 181, -52940,
+    7, 45, 25, 87, 22, 29, 80, -52894, 491, 110, 5, 4, 58, 44, 1, -52767,
+    -52641, 49, 2, 63, 33, 18, 1, 56, 1, 30, 197, 8, 8, 5, 3, 543,
+    1, -52629, 84, 18, 145, -52614, 13, 60, 185, 9, 274, 2, 130, 6, 1, 6,
+    2, -52580, 21, 99, 6, 4, 451, 6, 396, 180, 29, 283, -52512, 21, 4, 2,
+    12, 21, 100, -52233, 7, 29, 64, 3, 21, 211, 30, 195, -52029, 14, 41, 2,
+    27, 16, 60, 27, 20, 309, 78, 113, 4, 62, 172, -51937, 27, 31, 34, 3,
+    0, 16, 63, 55, 1, 18, -51895, 305, 15, 2, 247, 49, 2, 1, 8, 58,
+    4, 1, 1, -51853, 8, 8, 1, 1, 21, 21, 52, 18, 23, 33, -51819, 261,
+    159, 90, 201, 3, 26, 141, -51726, 41, 16, 5, 53, 7, 281, -51721, 7, 35,
+    75, 4, 19, 115, 3, 30, 87, 96, 5, 2, 2, 3, 4, 196, 33, 8,
+    664, 98, 11, 2, 15, 12, 2, 1, 2, -51719, 51, 91, 51, 13, 77, 1,
+    44, 4, 46, 83, 20, 208, 48, 10, 5, 13, 5, 6, -51704, 26, 1, 272,
+    100, 55, 4, 130, 1, 22, -51499, 6, 7, 4, 615, 19, 3, 0, 7, 1,
+    184, -51415, 2, 396, 3, 61, 1, 36, 281, 27, 5, 25, 5, 105, 3, 60,
+    50, 3, 40, 59, 139, 138, 240, 27, 72, 121, 20, 61, 6, 116, 224, 5,
+    29, 4, 9, 8, 157, 36, 19, 16, 483, 3, 1, -51414, 1, 13, 9, 38,
+    54, 17, 0, 0, 22, 221, 5, 9, -51407, 122, 157, 273, 320, 11, 80, 4,
+    25, 45, 139, 49, 29, 7, 9, 2, 2, 2, 20, 113, -51381, 7, 2, 25,
+    73, 21, 18, 731, 1, 37, 13, 7, 8, 12, 7, 44, -51348, 1, 58, 2,
+    1, 22, 17, 85, 31, -51312, 20, 47, 41, 2, 472, 1, 156, -51206, 192, 8,
+    12, 16, 7, 37, 22, 77, 114, 7, -51191, 9, 32, -51117, 1, 23, 55, 11,
+    2, 2, 6, 4, 46, 13, 97, 20, 2, 4, 4, -51094, -51090, 21, 286, 1,
+    1, 2, 26, 69, 121, 63, -50875, 77, 8, 3, 11, 60, 0, -50868, 5, 49,
+    80, 4, 43, 5, -50755, 170, 3, 4, 3, 9, 144, 7, 140, 1, 3, 127,
+    97, 9, -50700, 464, 48, 26, -50570, 34, 49, 30, 89, 8, 15, 31, 13, 271,
+    48, 24, 118, 314, 7, 32, 17, 20, 2, 395, 394, -50560, 20, 170, 65, 29,
+    6, 55, -50556, -50545, 43, 0, 78, 1, 270, 2, -50477, 6, 17, 13, 1, 1,
+    -50443, 6, -50435, 17, 161, 163, 1126, 0, 2, 5, 21, 130, 2, 8, 78, 3,
+    63, 104, 52, 37, 16, 5, 23, 3, 35, 9, 196, -50347, 15, 276, 2, 297,
+    -50324, 1, 28, 4, 1, 9, 1, 61, 2, 5, 39, 94, 3, 95, 2, 305,
+    10, 376, 219, 264, 1, 43, 366, 157, 23, 22, 1, 1, 11, 215, 2, 35,
+    11, 1, -50321, 39, 89, 23, 3, -50312, 62, 163, 15, 2, 3, -50300, 9, 2,
+    1, 269, 16, 32, 1, 6, 1, 94, 51, 0, -50245, 17, 4, 108, 5, 21,
+    65, 77, 1, 56, 75, 70, 178, 18, 422, 22, 1, 301, 2, 867, 6, 4,
+    10, 11, 194, 16, 4, 95, 28, 1, 153, 54, 3, 1, 4, 52, 20, 11,
+    6, -50190, 227, 135, 1, 1, 25, -50162, 2, 0, 89, 174, 99, 61, 148, 40,
+    364, 7, 34, 3, 7, -50157, 47, 97, 285, 1, 1, 56, 6, 205, 42, 159,
+    332, 38, 370, 34, 277, 553, -50025, 83, 111, 370, 12, 49, 39, 54, 97, 539,
+    -49994, 1, 146, 213, 10, 98, 124, 61, 23, 83, 4, -49969, 2, 280, 64, 4,
+    176, 1, 108, 0, 4, -49947, 1, 14, 2, 0, 84, 27, 214, 35, 92, 100,
+    1018, 7, 46, 2, 1, -49882, 38, 208, 2, 7, 1, 8, 10, 6, 15, 53,
+    9, 648, 38, 226, 47, 8, 5, 3, 5, -49819, -49694, 193, 236, 459, 658, 9,
+    92, 108, 192, 95, 52, 255, 7, -49682, 273, 219, 3, 4, 3, 1, 34, 20,
+    48, 9, 81, 20, 121, 171, 166, 9, 6, 1, 47, 18, 67, 1, 0, 201,
+    70, -49638, 1, 0, 13, 203, 33, 76, 1, -49484, 8, 28, 56, 30, 11, 12,
+    61, 18, 119, 1192, 2, 2, 455, 3, 2, -49475, 92, 105, 1, -49438, 5, 1,
+    2, 23, 5, 82, 1, 4, 205, 34, 49, 54, 181, 105, 3, 24, 123, 60,
+    -49417, 24, -49303, 409, 311, 8, 428, 40, 15, 241, 12, 18, 26, 1, 3, 7,
+    -49301, 1, 340, 2, 3, 310, 48, 10, 367, 76, -49279, 9, 2, 37, 7, 117,
+    98, 8, 105, 332, 65, 114, 276, 333, 387, 38, 51, 241, 33, 26, 234, 274,
+    42, 342, 49, 47, 66, 16, -49108, 13, 8, 2, 50, 212, 6, 16, 55, -49024,
+    38, 56, 44, 20, 51, 77, 107, 7, 198, 11, 6, 5, 12, 296, 114, 11,
+    3, 59, 57, 1, 4, 671, 3, 3, 19, 11, 1, -48983, 6, 1, 203, 4,
+    -48967, -48844, 18, 100, 88, 4, 58, 78, 12, 45, 88, 20, 28, 26, 16, 53,
+    481, 5, 2, -48831, 97, 40, 110, 45, 78, 0, 81, 7, 13, -48807, -48674, 380,
+    203, 93, 45, 79, 24, -48590, 1, 2, -48560, 116, 3, 89, 243, 1, 114, 8,
+    535, 2, 283, 10, 65, 3, 67, 12, 368, 594, 4, 97, -48535, 169, 18, 7,
+    35, 1, 43, 1, 52, 27, 73, 6, 126, 37, 66, 19, 3, 87, 9, 6,
+    415, 21, 1, 2, 45, 1, 24, 4, 1, -48339, 67, 9, 86, 1, 151, 5,
+    -48243, 76, 1, 1, 3, 2, 172, 15, 32, -48127, 344, 25, 2, 0, 145, 159,
+    72, 0, 0, 1, 7, 5, 22, 19, 7, 3, 282, 646, 3, 25, 15, 36,
+    77, 168, 29, 13, 141, 303, 212, 665, 120, 3, 13, 27, 87, 5, 239, 50,
+    25, 0, 25, 2, 62, 60, 15, -48059, 14, 108, 24, 327, 85, 3, 28, 68,
+    53, 653, 432, 1, 100, 280, 84, 93, 487, 167, 159, 26, 13, 109, 407, 2,
+    6, 37, 88, 51, 45, 6, 40, 332, 55, 19, 39, 1, 4, 137, 31, 3,
+    89, 30, 80, 2, 22, 106, 16, 21, 56, 36, 32, 4, 165, 248, 12, 77,
+    104, 23, -47992, 528, 74, 85, 90, 1, 57, 386, 123, 26, 6, 47, 338, 4,
+    8, 62, 87, 866, 1, 38, 1, 56, 4, 1, 11, 28, 16, 348, 6, 40,
+    38, 2, 1, 62, 19, 15, 38, 6, 156, 616, 1, 49, 0, 75, 208, 2,
+    1, 0, 2, 2, 54, 23, -47942, 2, 1, 11, -47914, 10, 68, -47703, 93, 2,
+    1, 2, -47645, 1, 8, 72, -47642, 13, 5, 33, -47519, 7, 5, 29, 60, 7,
+    154, 120, 10, 6, 48, 27, 50, 85, 36, -47487, 7, 8, 1, 22, 121, 46,
+    73, 1, 6, 287, 57, 1, 39, 1, 109, 11, 9, 4, 23, 2, 1, 186,
+    42, 36, 1, 225, 13, 6, 1, 21, 22, 13, 7, 339, 50, 69, 75, 0,
+    44, 11, 2, 56, 112, 6, 14, 9, 29, 38, -47482, 2, 1, 190, 68, 83,
+    5, 8, 6, 1, -47348, 164, 56, -47301, 7, 40, 4, 207, 169, 142, -47245, 352,
+    56, 5, 11, 15, 9, 126, 18, 3, 9, 3, 2, 7, -47173, 1, 13, 99,
+    42, 23, 5, 5, 2, 65, 62, -47163, 1, 4, 28, 21, 1, 195, 236, 83,
+    15, 19, 14, 10, 1, 1, 3, 33, 1, 33, 77, 3, 10, 1, 141, 25,
+    2, 3, 33, 100, 85, 443, 212, -47154, 6, 674, 17, 160, 88, 1, 122, 5,
+    198, 1, 41, 26, 7, 7, 1, -47135, 21, 3, 151, 1, 13, 227, 88, 11,
+    0, 224, 1, 30, -47087, 0, 8, 39, 52, 1, 23, 9, -47044, 46, 596, 2,
+    12, 110, 7, 1, 484, 6, 7, 8, 12, 1, 78, 4, -46992, 4, 14, 9,
+    137, 18, 296, 1, 34, 15, 62, 21, 190, -46953, 182, 232, 11, -46941, 124, 48,
+    115, 9, 33, 3, 314, 278, 752, -46913, 36, 16, 2, 1, 507, 22, 146, 6,
+    508, 336, 44, 61, 3, 18, 141, 107, -46786, 145, 2, 467, 1, -46749, 264, 10,
+    9, 106, 68, 12, 127, 22, -46733, 11, 32, 21, 568, 1, 23, 250, 134, 0,
+    13, 202, 223, 40, 96, 75, 20, 7, 94, 170, 83, 1, 1, 68, 50, 12,
+    1, -46720, 27, 2, 3, 28, 2, 1, 335, 5, 238, 430, 20, 18, 9, 6,
+    273, 41, 28, 36, 34, -46704, 18, 126, 5, 5, 124, 60, 92, 88, 7, 1,
+    740, 5, 218, 3, 17, 33, 32, 33, 3, 75, 699, 44, 13, 145, 1, 390,
+    -46696, 25, -46684, 551, 15, 79, 12, 3, 117, 1, 123, 51, 351, 128, -46593, 188,
+    -46591, 9, 31, 211, 181, 3, 15, 1, -46578, 4, 17, 34, 24, 24, -46551, 1,
+    4, 12, 2, 47, 264, 5, 189, -46533, -46476, 49, 12, 523, 46, 27, 35, 1,
+    389, 124, 184, 8, 26, -46457, 55, 1, 5, 7, 176, 45, 20, 131, 5, 216,
+    51, 112, 1, 336, 125, 1, 14, 88, 16, 10, 88, 101, 48, 206, 74, 330,
+    22, 44, 64, 348, 15, 73, 27, 80, 6, 11, 82, 336, -46380, 5, 485, 118,
+    162, 17, 444, 201, 4, 114, 6, 16, 2, 1219, 72, 50, 123, 29, 21, 567,
+    84, 54, 6, 153, 0, 179, 7, -46321, 422, 136, 115, 234, 1, 31, 187, 654,
+    356, 180, 6, 401, 5, 12, 4, 2, 106, 2, 100, 2, 215, 25, 8, 11,
+    199, 74, 1, 68, 113, 639, 1, -46317, 15, 142, 33, 2, 2, 1, 26, 8,
+    -46097, 52, 5, 87, 136, 91, 98, 70, 174, 27, 1, 59, 24, 396, 79, 13,
+    563, 1, 8, 3, 7, 23, -46061, 152, 0, 257, 43, 48, 9, 149, 2, 107,
+    141, 2, 29, 8, 229, -46060, 1, 41, 2, 83, 256, 42, 137, 102, 278, 261,
+    763, 10, 83, 6, 1, 1, 12, 1, 1, 5, 6, 1, 409, 3, 430, 45,
+    29, 3, 64, 274, 70, 1, 75, 59, 384, 66, 28, 2, 17, 4, 6, 59,
+    291, 26, 3, 45, 9, 278, 3, 50, 17, 65, 323, 566, -46012, 4, 5, 17,
+    18, 347, -46001, 21, 42, 2, 33, 16, 4, 96, 56, 12, -45907, 1, 0, -45751,
+    46, 22, 2, 50, 41, 81, 215, 2, 1, 10, 508, 388, 65, 66, 4, 9,
+    4, 118, 5, 2, 32, 2, 5, -45738, 233, 28, 57, 0, 1, 2, 4, 209,
+    11, 211, 14, 23, 1, 32, 401, 7, 11, 61, 12, 56, -45618, 1, 20, 2,
+    262, 104, 4, 10, 1, 75, -45551, 29, 139, 2, 19, 402, 139, 4, 13, 14,
+    2, 82, 449, 375, 6, 259, 1, 3, 245, 3, 11, 2, 19, 1, 0, 2,
+    6, 302, 18, 91, -45466, 346, 291, -45462, 6, 30, 4, -45457, 11, 101, 13, 18,
+    14, 229, 33, 6, 40, 2, 3, 235, -45433, 28, 727, 59, 3, 453, 7, 130,
+    -45399, 20, 1, 21, 88, 27, 29, 26, 50, 14, 69, 7, 5, 2, -45327, 248,
+    -45259, 1, 1, 1, 21, 15, 213, 20, -45256, 21, 1, 21, 2, 24, 175, -45251,
+    127, 6, 25, 132, 154, 16, 11, 26, 6, 208, -45218, 10, 119, 0, 31, 128,
+    112, 31, 1, 1, 76, 132, 17, 126, 0, 2, 26, 123, 142, 0, 145, 36,
+    377, 398, 2, 3, 1, 21, 866, 9, 0, 25, 13, 18, 3, 1, 9, 37,
+    100, 311, 1, 3, 246, -45205, 7, 14, 1, 26, 1, 2, 1, 255, 435, 3,
+    7, 4, 108, 14, 1, 142, 4, 3, 6, 4, 5, 107, 4, 249, 14, 117,
+    6, 15, 168, 151, 6, 95, 7, 320, 8, 7, 39, -45071, 1, 153, 5, 628,
+    130, 62, 29, 8, 479, 1, 34, 25, 43, 6, 7, 89, 8, 77, 37, 38,
+    1, 1, 8, 23, 323, 38, 34, 2, 389, -45025, -44940, -44897, 166, 392, 204, 7,
+    6, 37, 377, 4, 8, 108, 2, 0, 192, 64, 58, 9, 32, 31, -44876, 305,
+    380, 477, -44837, 120, 23, 233, 1, 166, 1, -44786, 1, 27, 127, 79, 2, 31,
+    -44783, 33, 29, 7, 7, 19, -44767, 113, 322, -44731, 118, 148, 10, 2, 50, 7,
+    89, 118, 5, 61, 694, 3, 15, 301, 298, 159, 5, 2, 5, 68, 251, 1,
+    75, -44653, 11, 314, 435, 50, 234, 13, 24, 75, 181, 27, 6, 11, 0, 37,
+    30, 53, 307, 93, 3, 28, 2, 1, 48, 51, 66, 42, 286, 178, 81, 26,
+    32, 1, 55, -44519, -44439, 290, 8, 14, 73, 9, 12, 1, -44294, -44291, 4, 35,
+    60, 3, 150, 5, 89, 162, 7, 8, 171, 1, 1, 9, 12, 37, 81, -44224,
+    11, 16, 13, 81, 402, 74, 9, 3, 1, 31, 9, 25, 6, 1, 636, 6,
+    6, 85, 153, 351, 145, 1, 2, 62, 17, 204, -44138, 33, 179, 5, 1, 5,
+    4, 11, 2, 92, -44026, 2, 2, 219, 99, 23, -44025, 155, 3, 212, 49, 4,
+    26, 10, -43967, 5, 77, 0, 2, 3, 158, 21, 69, 5, 1, 278, 42, 23,
+    477, 134, 14, 1, 2, 299, 4, 300, 107, 46, 1, 32, 2, 194, 0, 16,
+    17, 6, 218, 1, 86, 532, 48, 256, 2, 3, 41, 532, 46, -43832, 417, 6,
+    -43768, 145, -43764, 7, 1, 74, 197, 124, 1, 29, 6, 51, 19, 3, 14, 1,
+    -43740, 3, 24, 12, 261, 309, 1, 41, 52, 17, -43685, 4, 12, 156, 64, 0,
+    7, 266, 2, 3, 49, 37, 338, -43676, 6, 42, 4, 90, -43674, -43661, 0, 231,
+    1, 3, 13, 15, 83, 5, 214, 92, 3, 456, 8, 889, 3, 18, 1, 7,
+    -43638, 176, 8, 84, 150, 5, 2, 77, 11, 2, 4, 5, -43621, 186, 12, 115,
+    158, 1, 126, 11, 89, 129, 84, 138, 17, 11, 4, -43607, 76, 50, 13, 2,
+    139, 6, 380, 240, 58, 430, 0, 4, 112, 10, 1, 3, 157, 13, 14, 7,
+    3, 35, 3, 25, 534, 15, 157, 32, 68, 14, 121, 185, 1, -43539, 9, 2,
+    67, 69, 24, 281, 2, 12, 30, 49, 0, 603, 2, 0, 2, 10, 1, 6,
+    1, -43410, 1, 132, -43378, 89, 30, 253, 2, -43300, 1, 2, 1, -43299, 226, 164,
+    6, 185, 358, 1, 16, 35, 169, 69, 58, 39, 10, 230, 309, 1, 8, 4,
+    34, 77, 2, 169, 139, 114, -43288, 396, 1, 6, 126, -43273, 1, 14, 34, -43122,
+    -43102, 1, 2, 1, 2, -42999, 77, 4, 12, 291, 33, 93, 225, 157, 21, 21,
+    14, 1, 5, 8, 1, 304, 1, 177, -42989, 734, 3, 298, 34, -42981, 2, 46,
+    8, 62, 169, 83, -42922, 1, 32, 1, 85, 39, 1, 81, 1, 34, 166, 4,
+    23, -42921, 97, -42900, 298, 4, 7, 12, 98, 35, 11, 37, 2, 216, 1, 313,
+    82, 10, -42821, 54, 28, -42715, 211, 8, 14, 19, 415, 111, 18, 202, 390, 43,
+    386, 0, 34, 7, 4, 1, 64, 161, 0, 1, 216, 20, 229, 251, 340, 42,
+    -42636, 105, 2, 28, 43, 138, 75, 1, 195, 9, 21, 132, -42606, 269, 686, 156,
+    9, 1, 25, 5, 1, 2, 719, 50, 519, -42586, 13, 219, 2, 153, 18, 35,
+    5, 85, 277, 1, 32, 15, 1, -42511, 25, 3, 18, 81, 36, 18, 57, 9,
+    142, 24, 3, 116, 23, 117, 17, 357, 15, 109, 4, 1, 7, 80, 373, 56,
+    0, 121, 138, 5, 5, 465, 42, 209, 9, 2, 394, 1, 253, 78, 16, 35,
+    380, 18, 9, 12, 148, 6, 21, 4, 14, 120, 2, 5, 9, 0, 75, 3,
+    38, 59, 98, 706, 9, 403, 12, 12, 10, -42498, 803, 8, 7, 19, 147, 47,
+    116, 1, 4, 3, 2, 372, 4, 287, 150, 189, 0, 3, 64, 52, 38, -42494,
+    171, 30, 33, 0, 35, -42443, 226, 23, 147, 116, 44, -42299, 1, 3, 22, 248,
+    111, 3, 42, 7, -42129, 426, 19, 35, 11, 61, 12, 14, 3, 19, 5, 18,
+    469, 1, 1, 1, 94, 110, 184, 77, 452, 196, 58, 3, 16, 0, 9, 18,
+    396, 2, 738, 1, 1, 45, 8, 31, 0, 1, 363, 38, 115, 614, 166, 42,
+    1, 34, 4, 9, 21, 55, 117, 8, 190, 3, 44, 62, 174, 1, 349, 1,
+    1, 1, 6, 10, 0, 326, 1, -42091, 596, 1, 6, 2, 84, 21, 44, 10,
+    79, 2, 37, 22, -42049, 142, 68, 3, 1, 7, 69, 3, -42032, 16, 96, 76,
+    53, 1, 19, 147, 485, 107, 1, -42026, 78, 0, 12, 6, 28, 425, 234, 362,
+    31, 14, -42025, 12, 172, 3, 43, 67, 41, 2, 31, 6, 762, 45, 59, 3,
+    1, 76, 73, 350, 2, 49, 253, 2, 65, 420, 23, 41, 3, 26, 61, 36,
+    322, 23, 14, 6, 21, 5, 4, 3, 2, -42014, 169, 52, 19, 1, 2, 1,
+    42, 181, 134, 105, 1117, 1, 38, 298, 87, 406, 273, 401, 6, 83, 2, 70,
+    2, 967, 7, 427, 61, 1, 30, 15, 19, 6, 1, 85, 335, 3, -42003, 2,
+    -41963, 200, 4, 8, 89, 29, 1, 120, 7, 142, 39, 713, 30, 1, 38, 1,
+    3, -41958, -41662, -41652, -41635, 366, 5, 56, -41612, 19, 253, 36, 13, 183, 159, 2,
+    3, 1, 125, -41572, -41510, 54, 53, 17, 268, 125, 18, 44, 3, 638, 20, 1,
+    1, 95, 3, 28, 69, 28, 7, 13, 32, 58, -41497, 144, 3, 67, 121, 10,
+    200, 591, 5, 5, 0, 2, 22, 50, 73, 6, 2, 4, 82, 298, 2, 32,
+    53, 6, 1, 4, 83, 5, 5, 98, -41484, 1, 3, 2, 106, -41422, 1, 107,
+    12, -41417, 91, 74, 32, 261, -41255, 1, 446, 1, 27, 12, 80, 219, 42, 1,
+    7, 20, 68, -41252, 16, 72, 47, 407, 4, 2, 230, -41244, -41239, 490, -41208, 2,
+    2, 64, 22, 162, -41133, 348, 42, 239, 29, 17, 2, 9, 72, 2, 40, 90,
+    134, 371, -41130, 22, 95, 6, 3, 3, 20, 9, 226, 1, 5, 314, 496, 2,
+    55, 26, 871, 22, 7, 141, 47, -41038, 583, 0, 2, 59, 1, 30, 6, 44,
+    12, 1, 539, 39, 1, 4, 1, 13, 19, 380, 141, 5, 43, 1640, 35, -40867,
+    19, 37, 7, 2, 1, 285, 25, 397, 0, 22, 58, 90, 253, 33, 17, -40655,
+    349, 3, 4, 198, 5, 111, 3, 212, 158, 2, 291, 6, 32, 5, 1, 22,
+    5, 126, 12, 3, 248, 3, 136, 44, 205, 806, 20, 67, 0, 305, 3, 12,
+    6, 195, 75, 21, 13, -40642, 16, 3, 104, 6, 138, 74, 1, 877, 107, 80,
+    -40630, 1, 25, 3, 3, 12, 28, 9, 289, 37, 42, 9, 11, 9, 324, 174,
+    90, 1, 30, 84, 12, 2, 109, 10, 2, 11, 26, 9, 52, 67, -40615, 69,
+    6, 169, 10, 1657, 567, 2, -40468, 125, 13, 36, -40408, 472, 4, 3, 26, 123,
+    26, 12, 17, 26, 62, 1, 36, 4, 78, 1, 118, 274, 169, 11, 74, 5,
+    28, 2, 73, 6, 3, 5, 69, 5, 145, 5, 346, 15, 9, 13, 3, 75,
+    6, -40366, 119, 118, 198, 3, 65, 2, 7, 322, 0, 5, 13, 13, 21, 22,
+    88, 14, 3, 13, 125, -40334, 78, 16, 4, -40301, 128, -40263, 73, 3, 88, 37,
+    3, 9, 15, 2, 104, 169, 2, 519, 44, 2, 191, 13, 21, 26, -40028, -39993,
+    22, 103, 1, 33, 9, 15, 116, 3, 74, 3, 7, 1, 2, 1, 70, 77,
+    93, 247, 183, 255, 1, 33, 2, 97, 447, 33, 79, 147, -39985, 1, 51, 18,
+    0, 1, 86, 503, 0, 849, 1, 113, 1379, 3, 45, 13, 653, 70, 4, 301,
+    23, 3, 8, 4, 347, 7, 327, 37, 32, 3, -39678, 5, 1, 18, 112, 12,
+    138, 0, 318, 2, 13, 33, 415, 39, 184, 1, -39666, 36, 2, 4, 96, 76,
+    121, 27, 34, 211, 1, 94, -39645, 4, -39633, 148, -39623, 2, -39612, 10, 0, 124,
+    417, 3, 2, 1, 24, -39610, 152, 1, 171, 48, 60, 4, 177, -39528, 2, 68,
+    -39524, 1, 4, 14, 3, 3, 359, 10, 3, -39420, 61, 118, 31, 20, 92, 225,
+    2, 216, 29, 142, 265, 392, 43, 79, 18, 565, 99, 35, 5, 2, 2, 286,
+    203, 70, 88, 21, 3, 16, 255, 46, 5, 1, 10, 367, -39348, 1, 196, 0,
+    1, 110, 171, 8, 233, 6, 2, 12, 217, 5, 69, 10, 251, 2, 7, 1303,
+    2, 7, 83, 10, 11, 1, 112, 139, 2, 97, 188, 1, 5, 96, 21, 173,
+    90, -39252, 66, 9, 1, -39211, 183, 4, 1, 0, 281, 5, 3, 5, 12, -39103,
+    112, 3, 45, 2, 9, -38952, 32, 1, 26, 1, 297, 10, -38936, -38888, 324, 5,
+    65, 8, 2, 51, 341, 193, 22, 8, 264, 32, 98, 91, 398, -38879, 356, 66,
+    96, 14, 5, 42, 28, 9, 262, 460, 8, 37, 9, 7, 46, 4, 91, -38873,
+    677, 200, 1, 8, 1, 18, 284, 44, 911, 1, 0, 39, -38864, 53, 156, 2,
+    30, 2, 172, 44, 2, 2, 1177, 4, 201, 29, 1, 91, 1, 2, 394, 6,
+    0, 11, -38846, 12, 7, 101, 120, 14, 5, 1542, 8, 71, -38749, 2, 4, 1,
+    313, 1, 5, 27, 19, 32, 4, 37, 5, 70, 321, 2, 1568, 23, 36, 37,
+    631, 44, 1, 1, 62, 1, 44, 7, 74, 89, 100, 16, 669, 172, 7, -38739,
+    5, 59, 12, 18, 539, 292, 14, 33, 637, 28, 4, 12, 170, 111, 110, 112,
+    100, 1372, 27, 385, -38658, 32, 1, 35, 72, 4, -38635, -38409, 32, 1098, -38405, 1,
+    5, 2, 4, 1, 60, 28, -38346, 32, 65, 151, 23, 2, 2, 432, 350, 1,
+    480, 115, 76, 148, 249, 3, 8, 524, 317, 637, 9, 2, 90, 2, 8, 2,
+    31, 10, 84, 4, 32, 24, 37, -38227, 29, 31, 59, 1, 417, 59, 2, 358,
+    217, 14, 6, 35, 248, 469, 34, 95, 66, 32, 319, 1, 3, 8, 8, 13,
+    4, 671, 79, 77, 79, -38171, 42, 15, 86, 57, 57, 49, 0, 690, 40, -38154,
+    238, 1, 0, 12, 3, 437, 249, 12, 29, 262, 4, 156, -38138, 247, 39, 16,
+    1000, 93, 8, 9, 131, 94, 83, 207, 72, 2, -38132, 141, 3, 5, 1, 11,
+    2, 15, 6, 0, 2, 173, 118, 6, 102, 275, 151, 1073, 13, 5, 13, 2,
+    13, 2, 329, 86, 407, 348, 271, 120, 1, 6, 455, 391, -38071, -38050, 24, 28,
+    40, 439, 1, 32, -38036, 3, 405, 307, 21, 10, 1, 18, 594, 2, 3, 2,
+    63, 190, 4, 122, 2, 1026, -37996, 8, 3, 856, -37958, 109, 72, 232, 2, 3,
+    0, 6, 412, -37833, 348, 2, 0, 22, 0, 1, 8, 5, 1, 1, 33, 2,
+    130, -37805, 0, 1, 790, 11, 44, 22, 9, 255, 11, 122, 84, 3, 31, 11,
+    5, 112, 246, 18, 340, 13, 24, 68, 1, 6, 147, 64, -37695, 74, -37654, 22,
+    -37608, 46, 1, 2, 12, 79, 64, 1017, -37587, 22, 1, 71, 181, 90, -37459, -37428,
+    -37360, 84, 4, 322, 44, 84, 10, 5, 8, 194, 3, 6, 120, 4, 210, 38,
+    71, 32, 218, 70, 55, 41, 1, 4, 39, 10, 24, 9, 29, 14, 43, -37217,
+    51, 2, 97, -37206, 2, 179, 21, 1, 186, 5, 7, 217, 30, 3, 177, 5,
+    369, 281, 219, 83, 72, 99, 403, 179, 2, 43, 23, 1, 19, 2, 3, 2,
+    91, 42, 5, 533, 191, 501, 81, 46, 16, 294, 1, 7, 26, -37195, 101, 204,
+    -37168, 0, 92, 1, 17, 6, 103, 111, 2, 285, 1, 5, 84, -37110, 2, 29,
+    58, 333, 55, 9, 1121, 335, 123, 22, 2, 62, 38, 107, 28, 101, -37075, 1110,
+    15, 3, 13, 157, 0, 98, 7, 239, 525, 2, 136, 141, 6, 48, 305, 525,
+    2, 0, 269, 27, -37035, 16, 4, 259, 3, -37031, 2, 356, 6, 205, 188, 79,
+    2, 1, 45, 1103, 275, 9, 35, 726, 243, 2, 131, 19, 312, 82, 461, 244,
+    10, 14, 8, 54, 1, 6, 94, 5, 12, 39, 1, 605, 107, 5, -36883, 224,
+    -36746, 33, 191, 18, 21, 2, 21, 4, 3, 185, 5, 214, 5, 1, 1, 26,
+    26, 1, 85, 159, 49, 1, 4, -36669, 931, 2, 223, 264, 4, 158, 22, 18,
+    3, 13, 177, 258, 85, 35, 8, 0, 1, 2, 55, 61, 48, 149, 35, 52,
+    8, 10, 16, 5, 87, 42, 275, 848, 358, -36634, 3, 225, 668, 1, 21, 109,
+    36, 98, 6, 1, 17, 50, 2, 3, -36537, 1, 11, 102, 25, 420, 75, 6,
+    13, 1, 3, 56, 3, -36404, 18, 13, 279, 5, 76, 61, 113, 2, 0, 111,
+    46, 102, 3, -36335, 5, 2, 5, 94, 50, -36224, 6, 55, -36208, 56, 208, -36132,
+    3, 6, 2, 115, 683, 184, 335, 74, 4, 2, 86, 273, 0, 115, 27, 18,
+    7, 54, -36082, 409, 21, 77, 322, 5, 80, 179, 100, 218, 7, 101, 467, 30,
+    4, 4, 37, 3, 83, 10, 89, 77, 42, 250, 732, 392, 3, 372, 202, 52,
+    23, 2, -36032, 2, 332, 104, 178, 90, 7, 1, 1, -35900, 24, 17, -35840, 461,
+    -35772, 318, 98, 56, 24, 10, -35767, 234, 71, 138, 183, 1, 121, 20, 425, 2,
+    1, 28, 74, 1066, 13, 27, -35714, -35606, 113, 83, 2, 53, 184, 341, 12, 400,
+    -35589, 1, -35533, 1, 7, 61, 24, 177, 6, 1, 5, 6, 1, 18, 5, 167,
+    16, 2, 163, 9, 12, 2, 23, 2, 31, 441, 8, 155, 38, 0, 30, 58,
+    7, -35500, 27, 116, 1, 114, 34, 13, 77, 160, 415, 48, 2, 26, 2, 139,
+    216, 23, 246, 132, 448, 3, 91, 59, 72, 33, 0, 82, 210, 20, 9, 1,
+    89, 3, 469, 110, 1, 279, 563, -35445, 323, 692, 257, 89, 45, 13, 81, 51,
+    787, -35206, 489, 8, 5, 0, 21, 118, 116, 561, 6, 9, 214, 5, 125, 83,
+    5, 97, 112, 19, 57, 24, 87, 6, 12, 555, 348, 71, 122, 7, 486, 415,
+    10, 1, 27, 91, 56, 160, 1, 298, 3, 1, 51, -35137, 145, 238, -35084, 33,
+    42, 0, -34884, 8, 61, 24, 61, 9, 272, 18, -34830, 9, 3, 39, 2, 19,
+    1, 797, 879, 8, 6, 30, 22, 26, 2, 30, -34828, 31, 76, 40, 240, 3,
+    1, 81, 44, 26, 7, 1132, 21, 5, 23, 12, 3, 11, 970, 2023, 1, 118,
+    4, 48, 4, 48, 581, 2, 75, 1, 144, 13, 811, 1, 44, 18, 38, 242,
+    121, 4, 3, 10, 11, 55, 723, 79, 54, 1, 28, -34770, 18, 19, 12, 580,
+    13, 1, 9, -34740, 34, 10, 1, 9, 33, 258, 48, 26, 379, 44, 64, 14,
+    42, 29, 10, 1, -34664, 538, -34662, 40, 86, 371, 3, 1, -34589, 379, 2, -34578,
+    69, 143, -34570, 233, 265, -34541, 115, 308, 1, 307, 76, 4, 30, 0, 87, 415,
+    236, 212, 5, 822, 1, 82, 139, 30, 91, 1, 326, 13, -34498, 87, 47, 132,
+    60, 16, 20, -34452, 1, 9, 59, 13, 74, 558, 5, 119, 42, 1, 1, 45,
+    31, 2, 38, 23, 9, 20, 286, 273, 0, 1, 204, 31, 8, 217, 48, 40,
+    193, 61, 8, 31, 2, 73, 1, 1, 4, 887, 11, 1041, 14, 33, 36, 1,
+    0, 891, -34446, 47, 159, 7, 1, 143, 14, 29, 1, 1, -34390, 121, -34304, -34167,
+    30, -34091, 29, 372, 10, 684, 17, 36, 231, -34075, 2, 206, -34006, 111, 5, 27,
+    2, 0, 69, 113, 65, 2, 5, 418, 10, 11, 159, 281, 4, 352, 0, 160,
+    67, 10, 110, 19, 11, 1, 1, 227, 119, 40, 32, 83, 92, 118, 90, 83,
+    1095, 31, 42, 7, -33952, 81, 145, 770, 263, 39, 7, 1, 371, 3, 6, 33,
+    12, -33898, 1049, 611, 5, 95, 33, 19, 75, 64, 7, 185, 206, -33889, 180, 2,
+    57, 214, 379, 141, 19, 5, 44, -33845, 3, 1, -33835, 26, 441, 4, 8, 6,
+    187, 178, 82, 99, 472, 59, 75, 1110, 28, -33829, 8, 76, 796, 6, 59, 3,
+    13, 471, 92, 89, 1, -33776, 57, 30, 594, 424, 259, 131, 1, 1, 1, 0,
+    82, 62, -33684, 29, 57, -33545, 12, 6, 89, 20, 253, 3, 38, 5, 11, -33412,
+    377, 3, -33396, 1044, 146, 511, 17, 186, 20, 678, 11, 910, 135, 0, 105, 60,
+    844, 2, 22, 538, 6, 152, 2, 143, 60, 8, 42, 1, 277, 2, 749, 26,
+    557, 5, 171, 173, 183, 1, 278, 647, 15, -33291, 45, 47, 3, 754, 3, -33248,
+    34, 205, 9, 18, 183, 104, 2, 65, 2, 1, 37, 2, 147, 16, -33192, 3,
+    7, 298, 62, 1, 4, 8, 1, 210, 180, 74, 17, 0, 866, 13, 131, -33154,
+    2, 3, 23, 398, 1396, 411, 12, 111, 2, 9, 578, 6, 10, 0, 18, 8,
+    6, 0, 114, 216, 41, 64, 8, -33125, 196, 108, 334, 4, 85, 135, 20, 2,
+    192, -33082, 28, 94, 191, 2, 72, 2, 1445, 31, 30, 8, 113, 147, 711, 7,
+    38, -33032, 3, 122, 2, 8, 751, 344, 1290, 2, 137, 2, 109, 119, 129, 6,
+    179, 119, 41, 453, 233, 269, 25, 36, 480, 344, 8, 117, 4, 40, 97, 565,
+    -32991, 57, 19, 27, 1087, -32960, 497, 2, 57, 1, 21, 151, 48, 16, -32802, 1,
+    2, 958, 818, 504, 1, 67, 4, 297, 0, 263, 2, 11, 45, 291, -32773, 0,
+    10, 807, 87, 44, 2, 5, 603, 12, 106, 2, 9, 9, 112, 17, 210, 0,
+    281, 270, 387, 236, 2, 2, 35, 39, 29, 354, 414, 32, 332, 1, 59, 176,
+    319, 18, 4, -32441, 39, 1, 2, 2, 6, 17, 11, 16, 544, -32367, 16, 0,
+    29, 92, 2, 1312, 224, 249, 23, 2, 3, 71, -32271, 449, 10, 7, 56, 10,
+    7, 49, 22, 34, 1, 1119, 198, 4, 41, 5, 10, 449, 2, 28, 126, 0,
+    154, 1, 28, 194, 256, 0, 516, 786, 277, 51, 9, 1210, -32268, 259, 35, 46,
+    108, 36, 9, 2, 10, 13, 456, 245, -32210, 147, 3, 189, 57, 26, 7, 63,
+    2, 21, 126, 81, 53, 18, 6, 1, 81, 52, 303, 244, -32152, 1, 317, 2,
+    40, 113, 15, 188, 32, 8, 121, 39, 29, 361, 6, 13, -32137, 31, 687, 947,
+    30, 33, 539, 23, 2, 144, 6, 26, 268, 9, 119, 2, 25, 3, -32136, 50,
+    14, 205, 144, 625, 51, 1, 281, 4, -32075, 53, 1, 264, 9, 32, 15, -32041,
+    9, 451, 1, 14, 19, 253, 619, 114, 13, 320, 478, 8, 156, 12, 150, 2,
+    225, 1, -32038, 1, 1, 25, 231, 8, 8, 71, 161, 74, 354, 130, 11, 34,
+    206, 14, 286, 34, 55, 161, 2, 413, 17, 159, 559, 1, 266, 26, 9, 113,
+    3, 2, 7, 31, 10, 9, 140, 453, 35, 424, 26, 275, 6, 48, 58, 0,
+    152, 6, 1, 11, 197, 84, 8, 279, 5, 613, 22, 78, 89, 446, 2, 213,
+    224, 643, 107, 596, 0, 6, 6, 443, 1, 22, 404, 120, 224, 275, 4, 910,
+    144, 1, 184, -32024, 298, 99, 76, 571, 5, 5, 139, 48, 58, 1, 15, 5,
+    -32014, 1, 145, 13, 2, 36, 12, 349, -31999, 89, 729, 1343, 4, -31865, 61, 1,
+    4, 469, 37, 6, -31801, 72, 65, 24, 65, 12, 6, 93, 1695, 1, 757, 1,
+    20, 91, 1900, 4, 19, 32, 5, 0, 6, 264, 2, 6, 5, 0, -31787, 149,
+    21, 93, -31761, 29, 5, 2, 281, 11, 64, 1, 371, 1, 12, 12, 5, 173,
+    -31697, 62, 3, 51, 154, 263, 2, 855, 111, 103, 0, 19, 6, 2, 13, 59,
+    4, 34, 23, 288, 283, 28, 3, 14, 5, 44, 34, 13, 730, 43, 1035, 18,
+    4, 22, 16, 40, 13, 417, 102, 41, 23, 195, 7, 114, 123, 1, 301, 5,
+    -31667, 572, 11, 17, 39, 755, 2, 7, 16, 25, 8, 1, 306, 30, -31624, -31519,
+    2, 8, 43, 28, 511, 54, 44, 12, 75, 32, 0, 2, 182, 5, 823, 1,
+    115, 65, -31517, 1, 269, 955, 139, -31508, 106, 11, 14, 1145, 58, 63, 129, 9,
+    780, 94, 2, 332, 460, 19, 3262, 59, 188, 372, 2, 36, 586, 245, 101, -31320,
+    5, 82, -31219, 246, 93, 223, 37, 474, 17, 366, 19, 6, 186, 111, 2, 44,
+    149, 55, 1, 12, 459, 43, 9, 272, 1, 1, 0, 458, 0, 2, 301, 384,
+    42, 43, 3, 1, 4, 71, 3, 491, 61, 25, 80, 320, 5, 5, 95, 47,
+    12, 40, 47, -31173, 0, 0, 623, 25, 37, 623, -31161, 9, 58, 9, -31155, 1,
+    16, 793, 30, -31094, 59, 15, 283, 2, 1, 7, 22, 1, 221, 1, 46, 146,
+    1, 13, 14, 36, 23, 150, 1, 44, 200, -31040, 213, 918, 1, 83, 6, 2,
+    40, 10, 160, -31027, 1, 77, 58, 58, 49, 38, 105, 3, 4, 7, 18, 252,
+    1, 62, 1, 320, 2, 3, 8, 13, 15, 724, 265, 205, 4, 3, 102, 1,
+    96, 8, 4, 397, 10, 6, 497, 168, -31021, 342, 7, 6, 45, 201, 40, 317,
+    18, -30994, 283, 620, 34, 39, 5, 182, 108, 21, 59, 7, 207, 561, 112, 13,
+    85, 35, 15, 69, 12, 13, 9, 149, 35, 200, -30962, 3, 254, 7, 2, 18,
+    5, 165, 32, -30815, 104, 13, 262, 160, 265, 3, 569, 1733, 1211, 166, 3, 25,
+    1, 5, 14, 78, 2, 1, 8, 5, 161, -30761, 7, 6, 9, -30759, 60, 134,
+    -30755, 107, 19, 33, 3, 3, 50, 433, 20, 2, 44, 180, 7, -30720, 2, 5,
+    11, 1, -30533, 0, 3, 11, 6, 879, 315, 6, 7, 9, 1, 9, 290, 1,
+    63, 1768, 160, -30524, 95, 114, 3, 104, 52, -30393, 19, 87, 43, 9, 33, 277,
+    5, 411, 2, 553, 1, 36, 17, 110, 29, 111, 4, 292, 779, 1, 13, 25,
+    5, 191, 4, 289, 4, 322, 394, 41, 133, 60, 214, 3, 3, 188, 1, 1,
+    109, 33, 35, 188, 9, 221, 123, 16, 11, 1195, 4, 0, 1, 747, 351, 187,
+    -30385, 3, 17, 193, 91, 110, 37, 23, 626, 3, 95, -30216, 1, 183, 1, 1,
+    13, 319, 420, 1, 6, 10, 13, 3, 8, 167, 3, -30210, 264, 1, 695, 176,
+    2, 61, 138, 306, 106, 5, -30114, 26, 350, 89, 89, 14, 7, 320, 15, 22,
+    8, 1020, 9, 1616, 106, 1132, 239, 97, 99, 469, 1, 3, 132, 290, 40, 737,
+    1, 127, 4, 107, 29, 35, 2, 6, 21, -30072, 13, 205, 208, -30066, 36, 5,
+    41, -30022, 156, 22, 1, 10, 92, 5, 154, 248, -29960, 166, 1, 47, 7, 9,
+    164, 10, -29950, 2, 394, 50, 193, 620, 95, 360, 43, 62, 2, 172, 264, 401,
+    37, -29915, 1, 2, 30, 29, 339, 337, 185, 213, 540, 5, -29879, 22, -29824, 31,
+    7, 135, 989, 9, 451, 1320, 11, 231, 7, 66, 53, 682, 48, -29799, 131, 254,
+    -29764, 27, 875, 170, 257, 90, 8, 0, 744, -29721, 1, 8, 132, 702, 270, 62,
+    182, 34, 152, 41, 22, 1167, 1, 1, 51, 647, 100, -29712, 318, 126, 16, 324,
+    177, 15, -29698, 140, 13, 119, 30, 6, 273, 1, 522, 39, 88, 43, 804, 382,
+    147, 25, 40, 2, 8, 2, 668, 31, 445, 22, 126, -29690, 13, 283, 24, 326,
+    5, 5, 13, 115, 6, -29555, 62, -29540, 332, 209, 1, 61, 244, 1, 19, 9,
+    20, 142, 110, 280, 10, 67, 1, 53, 149, 10, 11, 797, 302, 38, 1, 1,
+    30, 234, 885, 1, -29494, 816, -29366, 4, 8, -29365, 4, 3, 0, 132, -29205, 161,
+    42, -29204, -28993, 57, 3, 296, 4, 67, 287, 31, 28, 24, 45, 148, 49, 262,
+    1, 461, 36, 354, 4, 4, 26, 16, 10, 4, 9, 5, 7, 18, 239, 123,
+    386, 111, 11, 3, 5, 205, 112, 1096, 299, 4, 1621, 42, 86, 4, 28, 114,
+    217, 5, 409, 147, 1, 12, 19, 17, 16, 98, 24, 724, 2, 6, 4, 27,
+    268, 106, 35, 41, 411, -28980, 115, 279, 433, -28950, 161, 204, 54, 381, 623, 229,
+    142, 270, 45, 258, 1, 394, 11, 1040, 395, 47, 85, 127, 1212, 388, 1, 133,
+    -28844, 18, -28838, 300, 5, -28778, 1214, 182, 4, -28719, 41, 0, 48, 208, 0, 115,
+    57, 591, 75, 818, 1, 40, 13, 17, 862, 12, 211, 3, 12, 79, 129, 0,
+    3, 54, 595, 1, 205, 0, 20, 1252, 1, 168, 3, 117, 145, 122, 392, 526,
+    -28698, 779, 412, 448, 19, 949, 24, 67, 1, 117, 23, 786, 795, 98, 577, 188,
+    274, 678, 2, 84, 9, -28695, 6, 440, 370, -28650, -28640, 1, 303, 1, 3, -28579,
+    459, 4, 82, 1, 459, 29, 7, 1378, 4, 31, -28536, -28490, -28402, 41, 335, 156,
+    0, 132, 257, 758, 627, 1, 143, 633, 740, 32, 227, 1, 55, 22, 1156, 480,
+    177, 10, 36, 627, 16, 2, 442, 3, 160, 20, 262, 133, 53, 794, 219, 185,
+    38, 277, -28396, 333, 212, 87, 79, 29, 197, 3, 116, 4, 62, 28, 27, 3,
+    26, 16, 18, 76, 42, 71, 144, 73, 315, 3, 696, -28330, -28284, 3, 1, 14,
+    12, 1, 119, 122, 27, -28264, -28252, 1, 14, 9, -28232, -28231, 837, 278, 67, 2,
+    54, 218, 67, 4, 354, 8, 1, 405, 32, -28111, -27943, -27925, 164, 21, 132, 8,
+    84, 425, 318, 61, 535, 29, 254, 421, 5, 125, 210, 3, 276, 472, 236, -27816,
+    7, 44, 27, 282, 13, 31, 1, 49, 1, 256, 54, 8, 23, 386, 145, 12,
+    15, 10, 25, 146, 6, 16, 135, 0, 7, 482, 19, -27752, 9, 32, 141, 1,
+    30, 1844, 1, 27, 313, 12, 0, 33, 179, 153, 227, 146, 110, 19, 24, 56,
+    1, 9, 554, 1, 464, 584, 4, 21, 61, 22, 0, 6, 395, 53, 1, 41,
+    24, 104, 1, 307, 981, 9, 4, 1, 7, -27747, 157, 112, 99, -27736, 4, 18,
+    -27706, 74, 196, 1480, 65, 19, 249, 4, 1, 1637, 3, 77, 0, 150, 7, 487,
+    898, 65, 3, 399, 1, 5, 5, 15, 249, 7, 92, 738, -27613, 208, 818, 28,
+    154, 60, -27595, 3, 82, 65, 37, 831, 513, -27496, 393, -27408, 57, 36, 29, 7,
+    9, 58, 355, 10, 13, 11, 69, 9, -27397, 46, 24, 1984, 65, 11, 14, 1,
+    116, 109, 340, 1, 538, 459, -27349, 59, 1, 45, 85, 4, 736, 3, 1, 41,
+    52, 104, 714, 1, 124, 442, 189, 47, 392, 0, 54, 3, 1, 747, 24, 228,
+    1, 1, 5, 126, 1706, 6, 407, 1, 711, 574, 102, 64, 1, 1079, 1, 12,
+    -27269, 111, 280, 28, 2, 23, 47, 123, 279, -27262, 1, 685, 17, 193, 218, 7,
+    287, 861, 392, 2, 86, 10, 30, 10, 63, 9, 5, 456, 0, 41, 97, 410,
+    27, 74, 23, 29, 18, 221, 6, 5, 2, 11, 137, 8, 131, 6, 25, 1,
+    -27256, 3, 121, 44, 1058, 26, 16, 12, 33, 2, 5, 986, 7, 18, -27214, 142,
+    204, -27176, 1, 1, -27159, 937, 135, 70, 17, 108, 1583, 5, 19, 15, 7, 484,
+    25, 317, 41, 315, 294, 28, 1108, 20, 1, 7, 1, 588, 41, 75, 1, 5,
+    127, 209, 19, 98, 9, 667, 25, 2, 29, 129, -27146, 566, 33, 40, 265, 19,
+    30, 448, 20, -27115, 23, 2, 23, 58, -27067, 62, 13, -26921, 133, 13, 811, 1216,
+    1, 1, 301, 1, 43, 414, 1, 6, 220, 1, 106, 98, 39, 359, 149, 366,
+    202, 16, 1, 2, 27, 354, 1, -26904, 12, 165, 444, 202, 8, 3, 185, 7,
+    663, 73, 107, 2, 14, 151, 3, 86, 2, 32, 33, 2, 2, 796, 113, 534,
+    2, 5, 196, 55, 128, 27, 614, 399, -26774, 0, 15, 1, 290, 0, 13, 403,
+    182, 81, 19, 59, 98, 46, 4, 1427, 28, 13, 478, 526, 53, 38, 398, 123,
+    -26747, 2016, 2022, 1, 5, 28, -26693, 520, 53, -26683, 125, 735, 172, -26670, 101, 84,
+    829, 142, 383, 1, 51, 10, 0, -26500, 3, 91, 187, 5, 71, 2, 1007, 45,
+    3, 420, 3, -26421, 17, 225, 9, 125, 40, 5, 80, 60, 65, 221, 5, 140,
+    170, 233, -26311, 255, 123, 227, 18, 24, 1, 2, 1431, 8, 1, 1, 130, 478,
+    228, 11, 3, 225, 265, -26279, 3, 1, 400, 31, 63, -26207, 226, 662, 1052, 46,
+    1, 31, 7, 258, 1, 9, 9, 36, 502, 39, 31, 35, 865, 344, 9, 75,
+    5, 86, 1264, 421, 10, 539, 2, 54, 6, 39, -26158, 182, 21, 1, 0, 273,
+    202, 2, 76, -26100, -26092, 1, 11, 13, 254, 324, 6, 1038, 624, 328, 22, 542,
+    46, 760, 19, 126, 21, -26090, 31, 7, 2, 14, 22, 19, 3, 17, 36, 86,
+    129, 88, 268, 21, 3, -26086, 2, 3, 31, 37, -26084, 5, 23, 0, -26054, 665,
+    35, -25997, 3, 23, 280, 3, 126, 284, 2, 3, 0, 14, 293, 29, 981, 398,
+    20, 8, 44, 70, 566, 646, 52, 7, 2, 7, 95, 98, 3, -25937, 193, 3,
+    299, 355, 227, 50, 24, 1378, 77, 45, 15, 26, 7, -25873, 1, 64, 14, 1,
+    53, 472, 17, 1, 1, 182, 111, 0, 38, 16, 463, -25790, 88, 1580, 1083, 9,
+    33, 131, 1259, 17, 48, 1, 166, 18, 60, 53, 346, 8, 7, -25752, 38, 2,
+    84, 156, 62, 1, 2, 17, 77, 6, 21, -25657, 3, -25569, 148, 4, 3, 9,
+    33, 89, 126, 5, 1406, 1, 64, 127, 530, 124, 1, 167, -25474, 1, 889, 287,
+    79, 34, 1, 59, 325, -25468, 269, 557, 4, 977, 135, 92, -25411, -25369, 3, 10,
+    166, 1030, 325, 77, 6, -25295, -25287, 33, 317, 18, 455, 123, 59, 1, 6, -25239,
+    1, 327, 1636, 103, 132, 37, 5, 206, 3, 51, 73, 27, 12, 1, 67, 348,
+    49, 81, 246, 22, 13, 38, 65, 9, 7, 1, 28, 142, 754, 327, 21, 164,
+    6, 1293, 604, 806, 72, -25190, 11, 44, 450, 267, 973, 2, 1, -25174, 35, 57,
+    203, 7, 34, 755, 343, -25142, 20, 11, 600, 24, 29, 314, 20, -25123, 96, 268,
+    432, 13, 9, 6, 11, 24, 508, 69, 50, 149, 41, 1, 6, 9, 5, 29,
+    49, 1, 62, 28, 4, -24907, 229, 1, 72, 29, 216, 60, 6, -24873, 204, 4,
+    3, 724, 5, -24761, 8, 17, 17, 172, 58, 18, 259, 35, 3, 5, 47, 48,
+    724, 92, 19, 14, 11, 527, 28, 3, 120, 197, 61, 9, 460, 500, 7, 236,
+    106, 7, 80, 899, 13, 53, 63, 21, 30, -24753, 15, 104, 116, 266, 6, 2,
+    210, 11, -24557, 82, -24506, 37, 1, 2, 810, 23, -24494, 25, 2, 219, 810, 1,
+    156, 584, 106, 15, 60, 2, 41, 2, 347, 4, 17, 693, 6, 0, 55, 288,
+    -24423, 141, 1, 197, 14, 169, 203, 1, 16, 24, 4, 56, 497, 206, -24319, 5,
+    415, 329, 150, 558, 20, 145, 1924, 1, 236, 333, 150, 186, 856, 234, 950, 475,
+    94, 213, 23, 1799, -24204, 8, 13, 86, 60, 11, 1, 1, 9, 67, 27, 3,
+    710, 308, 1329, 8, 1, 127, 6, 5, 6, 2, 158, 6, 2, 227, 33, 1,
+    1439, 815, 338, 483, 313, 190, 974, 22, 846, 134, 11, -24169, 1188, 1401, 1189, 2,
+    28, 1, 3, 488, 758, 559, 107, 504, 23, 64, -24114, 27, 62, 10, 1, 139,
+    12, 4, 162, 75, 1, 116, 9, -23947, 166, 2, -23945, 3, 21, 7, 49, -23912,
+    441, 31, 5, 25, 58, 104, 252, 2, 1, 8, 176, 139, 63, 37, 164, 332,
+    70, 44, 12, 6, -23608, 973, 7, 456, 881, -23583, 875, 685, 104, 9, 3, 2,
+    10, 4, 489, 36, 4, 803, -23581, -23579, 9, 13, 123, 823, 7, 97, 5, 141,
+    1, 1, 33, 43, 54, -23407, 197, 16, 2, 602, 1247, 931, 302, 31, 591, 72,
+    1, 123, 197, 83, 26, 381, 46, 532, 690, 47, 23, 32, 822, 192, 650, 58,
+    108, 332, 424, 46, 39, 121, 1771, -23362, 11, 18, -23071, 91, 26, 69, 1751, 2,
+    1, 0, 1, 18, 18, 57, 643, 5, 1, 18, 346, 39, 17, 43, 40, 14,
+    59, 71, 125, 24, 115, 278, 452, 23, 18, 9, 1012, 1, 34, 51, -22995, 67,
+    15, 16, 100, 23, 26, -22966, 157, 222, 2, 13, 54, 686, -22963, 4, 0, 81,
+    843, 11, 2, 3, 74, 71, -22957, 57, -22876, 8, 175, 39, 98, 8, 7, 2,
+    18, 57, 4, 1, 280, 25, 42, 1, 456, -22707, 66, 1129, 5, 164, 0, 1,
+    -22672, 2, 52, 10, 123, 5, 28, 442, 1, 56, 1, 2, 8, 383, 1, 472,
+    40, 506, 46, 1082, 32, 4221, -22560, 1133, 6, 289, 9, 4, 246, 17, 405, -22471,
+    351, -22467, 7, 47, 3, 39, 7, 4, 72, 13, 1473, 101, 10, 14, 519, -22459,
+    5, 50, 1, 480, 4, 25, 67, -22458, 37, 1, 479, 182, 760, 95, 220, 1428,
+    144, 13, -22425, 611, 42, 105, 61, -22408, 933, 127, 92, 43, 126, 10, 3, 138,
+    306, -22392, 153, 1, 160, 290, 0, 63, 89, 8, -22367, 218, 9, 499, 7, -22346,
+    7, 0, 412, 1, 116, 1, 43, 0, 8, 19, 121, 37, 31, 3, 1, 206,
+    79, 1156, 5, 241, 9, 1, 164, 7, 3, 46, 17, 0, 17, 382, 551, 12,
+    104, 4, -22253, 6, -22246, 58, 17, 0, -22138, 302, 1, 52, 3, 131, 11, 319,
+    419, 196, 17, 407, 19, 6, 140, 19, 271, 1, 2, -22094, 11, 3, 0, 137,
+    139, 724, 239, 29, 68, 755, 54, 1, 4, 62, 97, -22090, 9, 8, 52, 19,
+    3, 28, 2, 136, 27, 39, 147, -21986, 150, 28, 45, 17, 93, 211, 2, 102,
+    15, 4, 306, 9, 38, 226, 4, -21976, 2, 209, 446, 85, 38, 3, -21974, 933,
+    575, 1, 900, 153, 9, 20, 9, 1, 118, 4, 764, 1, 106, 5, 5, 300,
+    160, 18, 28, 475, 72, 79, 4, 39, 6, -21824, 50, 93, 8, 1, 38, 1,
+    196, 385, 4, 5, 24, 1707, 0, 177, -21748, 57, 567, 114, -21743, -21673, 2, 35,
+    9, 197, 119, 8, 218, 91, 890, 4, -21656, 499, 13, 2097, 7, 60, 50, 497,
+    58, 9, 221, 105, 150, 97, 52, -21598, 168, 6, 190, 1, 224, 20, 702, -21544,
+    643, 0, 88, -21542, 5, 65, 61, 12, 752, 686, 8, 724, 2, 199, 113, 50,
+    5, 2, 314, 656, 51, 158, 1, 601, 13, 89, 1, 1, 2, 505, 504, 500,
+    0, 44, 97, -21386, 4, 113, -21089, 134, 82, 27, 74, 88, 415, 19, 386, 3,
+    26, -21053, 829, 93, 224, 2, 97, 16, 599, 258, 23, 25, 11, 7, 465, 53,
+    9, 12, 67, 106, 5, 1208, 1, 58, 54, 16, 321, 38, 51, 1965, -21029, 39,
+    77, 190, 1, 8, 4398, 5, 1, 14, 1005, 500, 120, 65, 6, 17, 3, 1409,
+    53, 10, 24, 232, 295, 1, 31, 809, 11, 175, 26, 19, 20, 739, 28, 88,
+    143, 2910, 28, 299, 19, 43, -21001, 1, 201, -20987, 45, 2133, 4, 17, 176, 27,
+    1208, 22, 82, 1, 141, 23, 391, 35, 273, 7, 32, 21, 2, 64, 33, -20917,
+    125, 756, 127, 150, 76, 957, 20, 17, 10, 218, 7, 9, 370, 6, -20910, 0,
+    1, 790, 260, 3, -20862, 161, 154, 821, 0, 12, 837, 8, 1, 97, 121, 285,
+    29, 1, 18, 5, 3, 86, 35, 25, 51, 21, 92, 102, 52, 2, 50, 60,
+    15, 71, 1, 26, 392, 139, 27, 148, 2, 14, 199, 53, 190, 1023, 117, 10,
+    8, 2, 252, 140, -20860, 68, 192, 632, 3, 400, 119, 203, -20548, -20412, 1233, -20403,
+    18, 673, 1892, 5, -20348, 94, 11, 81, 6, 5, 810, 492, 476, 638, 974, 460,
+    88, 216, 120, 53, 1145, 1, 787, 283, 30, 1, 1558, 6, 131, -20314, 64, 171,
+    30, 1, 1, 262, 164, 42, -20274, 1, 41, 161, 153, 214, 1, 1508, 7, 298,
+    173, -20195, 1, 27, 47, 1493, 12, 16, 7, 73, 16, -20147, 29, 4, 671, -20103,
+    89, 672, 29, 658, 18, 108, 385, -19828, 356, 154, 71, 151, 12, 147, 223, 28,
+    260, 85, 7, 399, 6, -19763, -19751, 99, -19738, 3, 69, 173, 227, 7, 338, 1,
+    154, 16, 64, 588, 12, -19616, 157, 3, 125, 47, 115, 0, 1, -19531, 330, 409,
+    0, 675, 100, 295, 21, 4, 107, -19448, 19, 306, 6, 72, 2, 130, -19437, 61,
+    161, 575, 15, 1143, 17, 14, 356, 41, 129, 24, 61, 4, 1, 33, -19397, 308,
+    59, -19338, 34, 20, 2677, 80, 8, 15, 5, 13, 3, 574, 1, 4, 110, 139,
+    6, -19326, 521, 1, 276, 359, 1177, 484, 1, 278, 1, 1, 110, 700, 8, 12,
+    276, 300, 63, 47, 68, 27, 130, 16, 254, 27, 1, 306, 320, 33, 249, 191,
+    10, 16, 30, 5, 36, 1750, 1, 48, 629, 1, 2, 28, 3513, 27, 1, 6,
+    137, 20, 139, 10, 655, 196, 2, 1, 142, 15, 869, 119, 58, 9, 217, 2750,
+    2012, 15, -19197, 217, 11, 483, -19148, 47, 289, 2, 6, 48, 91, 1, 2, 200,
+    3, 588, 101, 483, 99, 369, 8, 70, 664, -19104, 34, -19065, -19059, 108, 889, 99,
+    4, 437, 31, 709, 1, 12, 1, 10, 2, 33, 15, 279, 1001, 66, 5, 22,
+    13, 48, -18976, 17, 51, 178, 3, 539, 4, 56, 107, -18893, 25, 6, 392, 16,
+    1196, 1, 131, 69, 19, 123, 1321, 19, 7, 259, 392, 47, 48, 191, 218, 8,
+    1, 199, 27, 500, 218, 2, 1, 25, 277, 505, 140, 19, 54, 215, 80, 949,
+    119, 244, -18875, 2296, 57, 41, 341, 136, 363, 1180, 1, 11, 6, 12, 128, 65,
+    344, 964, 1, 2, 280, 9, 7, 6, 246, 86, 56, 56, 5, 16, 560, 2,
+    640, 90, 48, 16, 765, 92, 14, 137, 71, 38, -18845, 1, 5, 102, 183, 557,
+    11, 3, 22, 304, 5, 533, 6, 244, 1544, -18841, 577, 5, 75, 0, 72, 34,
+    16, 2, 251, 264, 29, 1318, 88, -18820, 0, 29, 932, 33, 31, 9, 128, 17,
+    323, 2, 211, 1, 36, 283, 4, 596, 1, 4, 30, 19, -18809, 4, 1293, 0,
+    5, 7, 163, 776, 1, 13, 5, 27, 1, 269, 39, 20, 267, 3, 764, 5,
+    5, 940, 271, 1294, 27, 12, 3, 1322, 2, 392, 19, 63, 506, -18804, 294, 53,
+    1, 2, -18748, 32, 293, 2, 1, 2815, 89, 120, 165, 3, 81, 56, 12, 39,
+    97, 146, 248, -18744, 24, 29, 8, 206, 44, 20, 9, 3, 55, 2, 97, 2,
+    2, 51, 65, 73, 236, 3, 26, 132, 1121, 1, 451, 88, 309, 2, 260, 10,
+    38, 23, 45, 181, 1508, 292, 1350, 234, 6, 795, 6, -18704, 51, 1290, 1, 102,
+    448, 262, 166, 561, 241, 57, 36, 99, 861, 263, 1, 890, 1436, 8, 260, 1,
+    267, 18, 116, 0, 38, 2, 12, -18700, 11, 362, 4, 160, 0, 117, 382, 5,
+    335, 66, 86, 8, 579, 110, 799, 530, -18680, 677, 369, 28, 268, 45, 18, 241,
+    585, 1058, 30, 48, 1778, 61, -18660, 1705, 219, 429, 10, 307, 101, 3, 32, 115,
+    102, 1264, 154, 182, 10, 1, 362, 123, -18566, 484, 167, -18493, 39, 373, 1, 58,
+    46, 32, 18, 164, 1, 235, 136, 7, 134, 72, 603, 13, -18422, 286, 2, 144,
+    967, 36, 120, 6, 481, 419, 514, 244, 53, 70, 60, 144, 50, 1, 16, 320,
+    248, 451, 438, 488, 6, 168, 656, -18402, 144, 187, 3, -18373, 71, 315, 661, 932,
+    1, 231, 139, 1, 401, 1, 1, 9, 0, 11, 104, 41, 44, -18352, 0, 34,
+    47, 33, 91, 215, 505, -18345, 14, 1, -18304, 755, 0, 160, 869, 108, 3, -18276,
+    15, -18256, 6, 85, 599, 1, 415, 15, 2410, -18234, 5, 10, 2673, 125, 12, 206,
+    4, 166, -18136, 25, 21, 49, -18104, 3, 141, 2, 2, 3, 348, 21, 1111, 1,
+    47, 55, 405, 26, 1, 403, 238, 198, -18098, 130, 2, 1, -17968, 1, 269, 1120,
+    71, 656, 793, 3, 333, 4, 74, 2, 3, 1, 342, 490, 0, 14, 1468, 274,
+    25, 170, 1226, 213, 7, 0, 1664, 1783, 937, 1, 442, 579, 3, 28, 329, 53,
+    15, -17929, 3, 701, 8, 1, 1484, 1, 31, 444, 3962, 109, 779, 482, 68, 111,
+    14, 267, 5, 66, 493, 131, 8, 28, 11, 637, 9, 41, 1028, 2, 1, 2,
+    20, -17902, 0, 69, 11, 37, 220, 816, 102, 1, 24, 31, 42, 12, -17772, -17589,
+    40, 88, 186, 12, 9, 37, 289, 425, 14, 24, 2, 80, 354, 303, 83, 398,
+    350, 4, 130, 417, 397, 1, 82, 174, 17, 51, -17478, 143, 350, 681, 693, 5,
+    16, 1570, 1, 74, 31, 0, 0, 394, 1294, 364, 48, 0, -17464, 33, 98, 25,
+    9, 15, 164, 58, 165, 75, 3, 58, 112, 1, 1, 2, 20, 774, 56, 533,
+    29, 37, 197, 23, 40, 165, 476, 0, 2053, -17354, 479, 198, 2, 15, 21, 56,
+    5, 318, -17339, 1, 148, 4, 8, 1, -17331, 2, 2, 6, 5, -17299, 73, 22,
+    267, 318, 5, 14, 28, 10, 1, 1544, 940, 223, 2, 313, 106, 173, 1, 132,
+    1463, 2984, 78, 141, 15, 7, 318, 2, 117, 14, -17276, 241, 86, 19, 16, 6,
+    202, 323, 530, 11, 1, 13, 1, 63, 373, 6, 10, 0, 96, 123, 31, 37,
+    427, 1842, 562, 92, 15, 106, 4, 32, 2, -17179, 7, 96, 327, 139, -17069, 67,
+    2, 426, 240, 898, -17048, 77, 4, 391, 2, 23, 331, 126, 3, 11, 353, 205,
+    189, 9, 49, 242, 15, 1, 484, 2, -17030, 4, 176, 874, 0, 191, 3, 48,
+    16, 723, 217, 4, 1, 52, 4, 478, 64, 16, -17026, -16920, 205, 374, 3, 31,
+    8, 824, 97, 3, 2049, 81, 50, 16, 786, 189, 9, 266, 206, 1, 27, 1352,
+    74, 64, 16, 125, 21, 223, 15, 14, 637, 750, 2, -16910, 161, 2, 3, 809,
+    12, 89, 15, 153, 1668, 1059, 15, 58, 2118, 815, -16815, 3, 155, 1250, 208, 386,
+    2, 2, -16773, 232, 637, 3, -16733, 8, 4, 656, 5, 66, 1, 194, 18, 10,
+    21, 83, 457, 190, 303, 6, -16691, 38, 1157, 1484, 529, 137, 244, -16667, 419, 248,
+    969, 928, 142, 20, 188, 139, 7, 443, 624, 149, 38, 132, 34, 1, 27, 422,
+    180, 47, 68, 2, 230, 10, 535, 439, 6, 107, 103, 22, 95, 163, 0, 879,
+    54, 26, 4, 93, 346, 0, 1190, 1304, 404, 65, 414, 1, 9, 2, 8, 610,
+    10, 14, 2572, 91, 1, 139, 57, 13, 54, 15, 112, 1, 213, 47, 16, -16539,
+    165, 74, 18, 3093, 3074, -16524, 899, 43, 19, 12, 13, 3086, 23, 637, 13, -16511,
+    103, 57, 1, -16510, 117, 30, 1, 1420, 36, 1, 1, 163, 13, -16489, 1866, 134,
+    36, -16236, 568, 36, 2, -16204, 18, 213, 133, 471, 22, 20, 2, 188, 5, 59,
+    1, 21, 1, 286, 28, 351, 17, 11, 6, 61, 74, 31, -16203, 148, 86, 379,
+    52, 167, 31, 22, 15, 164, -16171, 20, 2, 1597, 1001, 63, 10, 2437, 6, 442,
+    439, 796, 1, 669, 25, 4, 27, 2650, 17, 26, 2, 426, -16074, 63, 58, 414,
+    0, 70, 1153, 1, 141, -16021, 14, -15974, 55, 5, 8, 99, -15967, 1444, 1651, -15903,
+    2426, 1, 215, 385, 999, 150, 8, -15897, 276, 19, -15758, 33, 274, 6, 11, 13,
+    -15708, 2, 20, 216, 94, 10, 53, 44, 8, 158, 21, 31, 4, 199, 34, 2219,
+    -15703, 1305, 116, 1, 71, 113, 0, 101, 80, 3, 1005, 304, 45, 150, 183, 664,
+    2862, 157, 351, -15700, 32, 5, 159, 77, 1, 174, 16, 857, 259, 927, 10, 36,
+    -15676, 1, 23, 210, 254, 45, 336, 1, 37, 1062, 55, 0, 459, 0, -15672, 91,
+    132, -15633, 1, 1367, 14, 267, 18, 1, 237, 1663, -15478, -15473, 169, 359, 445, 3,
+    87, 5, 225, 2, 21, 762, 86, 67, 12, 1269, 7, 228, 5, 3, 357, 525,
+    2, 5, -15432, 20, 48, 174, 13, 1311, 117, 140, 5, 2117, 0, 1, 3, 137,
+    -15408, -15331, 303, 72, 22, 12, 634, 406, 9, 13, 111, 769, 1446, 8, 8, 19,
+    43, 407, 2010, 92, 6, 1, 42, 82, 728, 95, 27, 163, 1, 293, 122, 41,
+    165, 1, 0, 80, 15, 76, 22, 107, 762, 212, 211, 5, 1, 10, 471, -15299,
+    278, 74, 44, 2, 5, 43, 40, 4, 45, 502, 5, 415, -15244, 481, 1668, -15243,
+    51, 223, 245, 523, 1, 164, 1953, 234, 334, 710, 115, 27, 88, 1749, 689, 32,
+    88, 561, 55, 1, 51, 313, 335, 302, 683, 53, 9, 17, 100, 38, 579, 41,
+    921, -15179, 1, 2, 47, 32, 275, -15086, 5, 74, -15028, 728, 6, 268, -15006, 1,
+    223, 175, 6, 910, 179, 1, 20, 690, 1318, 2, 28, 157, 263, 5, 142, 1651,
+    14, 6, 411, 1, 159, 7, -14960, -14924, 582, 107, 2331, 24, 9, 1, 32, 74,
+    170, 1822, 8, 1, 75, 1, 169, 18, 1795, 30, 1775, 2, 3, 6, 4, -14883,
+    6, -14878, 35, 39, 245, 1363, 8, 952, 15, 81, 1093, 248, 1, 48, 145, 130,
+    0, 22, 223, 1, -14877, 31, 236, 143, 5, 1, 3, 1324, 24, -14812, 57, 6,
+    2, 328, 57, 162, -14760, 2475, 1012, 391, 19, -14757, 87, 5, 432, 244, 2272, 32,
+    37, 520, 62, 916, 200, 4, 459, -14628, 1, 9, 27, 4, 354, 9, 3, -14613,
+    3, 190, 26, 20, 596, 4, 583, 7, 1, 37, 31, 311, 0, 81, 1, 11,
+    3, 550, 12, 33, 42, 100, 88, 17, 155, 19, 10, 489, 7, 17, 156, 0,
+    5, 26, 1, 67, 12, 113, 17, -14582, 310, 20, 1, 24, 1207, 22, 134, 4,
+    8, 253, 524, 994, 14, 230, 15, 23, 9, 2, 9, 444, 25, 80, 154, 51,
+    219, 215, 110, 31, 1441, 0, 1325, 19, 24, 33, 14, 30, 92, 35, 1322, 2,
+    8, 4, 640, 0, 366, 22, 3, -14499, -14476, 16, 42, 146, 167, 1308, 4, 738,
+    19, 1081, 65, 355, 4439, 11, 23, 942, 15, 452, 37, 335, 199, 305, -14419, 1957,
+    1, 13, 108, 911, 10, 554, 11, 7, 39, 38, 303, -14331, 56, 102, 63, 1312,
+    14, 8, 18, 140, 66, 1614, 19, 430, 3, 41, 0, 354, 9, 113, -14317, 104,
+    23, 3, 453, 6, 1, 1291, 342, 18, 1065, 12, 2, 311, 15, 115, 121, 177,
+    493, 1, 1, 5, 488, 16, 2, 567, 40, 15, 13, 807, 4, 1, -14308, 111,
+    1240, 104, 44, 1049, 125, 436, 412, 85, 26, 143, 23, 493, 25, 506, 112, 6,
+    40, 202, 239, 206, 302, 8, 56, -14112, 24, 5, 115, 3, 157, 3772, 267, 52,
+    -14087, 42, 25, 167, 30, 169, 6, 592, 340, 318, 215, 59, 25, -14053, 29, 246,
+    187, 237, -14044, 4, 17, 0, 48, 81, 633, 224, 384, 121, -13987, 1, 158, 0,
+    254, 3, 954, 38, 517, 19, 1601, 154, 1712, 128, 214, 619, 73, -13982, 44, 117,
+    -13953, 824, -13924, 30, 1971, 1254, 424, 103, 126, 1398, 207, -13882, 499, 3, 24, 25,
+    114, -13866, 120, 48, 346, 119, 12, 1, 406, 89, 34, 5, 788, 27, -13817, 17,
+    2, 115, 1739, 301, 80, 180, 15, 990, 19, 85, 527, 7, 27, -13649, 168, 1275,
+    -13630, -13557, 770, 4, 2, -13548, 4, 139, 1122, 761, 33, 2711, 211, 1, 141, 1283,
+    5, 32, 4, 4, 2361, 197, 8, -13510, 67, 172, 1804, 81, 90, 7, 2082, 155,
+    192, 5, 15, 28, 27, 54, 908, -13472, 94, 2, 1, -13403, 195, 714, 37, 39,
+    1315, -13376, 13, 747, 1460, 966, 264, 11, -13360, 128, 1, 1605, 241, 378, 477, 197,
+    1050, 29, 311, 21, 17, -13239, 5, 377, 29, 38, 28, 512, 9, 30, 35, 3,
+    264, 682, 79, 918, 0, 5, 1, 17, 89, 1, 24, 948, 144, 112, 35, 285,
+    1933, 976, 6, 148, 1, 57, 1, 7, 948, 136, 780, 4013, 0, 839, 613, 87,
+    353, 53, -13133, 1550, 0, 594, 1043, 1452, 239, 440, 5, 890, 769, 4, 272, 33,
+    566, 134, 3, 141, 685, 436, 149, 42, 302, 1063, 2, 10, 92, 749, 597, 1692,
+    41, 264, -13125, 969, 34, -13122, 88, 2752, 874, 58, 180, 182, 19, 1, 532, 202,
+    166, 222, 26, 8, 667, 283, 13, -13111, 1884, 133, 60, 423, 179, -13110, 9, 1,
+    -13087, 695, 5, 15, 2, 93, 81, 2536, 1324, 33, 5, 29, -13070, 69, 1324, 2,
+    -13027, -12966, 95, -12881, 8, 3822, -12880, 11, 810, 463, 661, 1088, -12826, 143, -12731, 174,
+    1881, 16, -12707, 3, -12703, 35, 175, 5, 28, 571, 73, 163, -12664, 15, -12569, 1946,
+    17, 13, 33, 79, 2, 8, 7, 1, 4, 542, 1484, 126, 12, 497, 44, 136,
+    1446, -12522, 1, 75, -12500, 142, -12405, 2344, 175, 85, 334, 26, 615, -12309, 140, 17,
+    15, 8, 2, 168, 13, 416, 1968, 191, 628, 7, 70, 22, 4, 4, 17, 257,
+    445, 58, 719, 32, 75, 59, 498, 15, 22, 60, 91, -12190, 260, 1, 132, 157,
+    3762, -12116, 102, 401, 95, 350, 10, 0, 3, 4582, 2, 1, 25, 2, 467, -12090,
+    11, 182, 1367, 31, 1, 12, 180, -12089, 16, 4, 1235, 47, 79, 40, 1914, 81,
+    116, 54, 45, 709, 3406, 5, 562, 116, -12081, 58, 288, 624, 4, 1310, 85, 16,
+    23, 197, 1, 68, 114, 817, 2, 1641, 18, 1, 1675, 123, 228, 28, 504, 1110,
+    43, 1, 9, 13, 36, 2, 45, 59, 380, 3, 314, 80, 32, -12035, 336, 145,
+    1183, 3910, 78, 471, 14, 23, -11897, 404, 7, 229, 13, 62, 184, 1, 2766, 167,
+    70, 4, 11, 57, 24, 2720, 45, 15, 2, 18, 9, 19, 3347, 41, 870, 2,
+    125, 101, 43, 1063, 4, 1551, -11839, 67, 69, 541, 837, 7, 394, -11837, -11713, 12,
+    52, 428, 663, -11679, 575, 352, 4, 166, 16, 2, -11647, 347, 154, 873, -11580, 200,
+    29, 483, 108, 3, 2, -11482, 327, 1, 131, 443, 1089, 3653, 330, -11470, 5, 947,
+    -11462, 0, 1036, 69, 630, 1, 68, 182, 79, 1277, 9, 421, 225, 739, 1865, 4,
+    107, 16, 780, 284, 102, 58, 13, 800, 67, 72, 4, 10, 447, 3, 5, 2,
+    13, -11424, 310, 1219, 7, 1, 10, 1502, 14, 3, 3458, 299, 1009, 63, 819, 923,
+    984, 523, 19, -11144, 2, 1853, 1, 2, 98, 284, -11137, 32, 10, 1894, 1, 212,
+    -11130, 91, 527, -11126, 59, 35, 10, -11076, -11071, 17, 20, 1144, 1, 0, 36, 128,
+    -11052, 1, 19, -11044, 229, 1, 56, -10997, 766, 56, 2265, 0, 601, 100, 9, 1336,
+    6, 5, 173, 57, 20, 6, 679, 183, 76, 94, 49, 281, 3, 17, 789, 2860,
+    4, 2169, 1421, 56, 4, 1601, 16, -10942, 30, 148, 40, 39, 1, 1, 1675, 167,
+    18, -10931, 35, 1041, 8, 716, 390, -10899, 1585, 77, 103, 155, 303, -10851, 26, 1146,
+    130, -10714, 65, 1, 456, 69, 123, 0, 60, 1, -10711, 19, 105, 183, 1, 49,
+    77, 2050, 40, 2, 35, -10710, 74, -10706, 77, 178, 326, 984, 186, 83, 1, 126,
+    213, 26, 510, 0, 38, 4675, 16, 83, 7, 93, 255, 14, 384, 12, 222, 1563,
+    873, 491, 15, 2, -10680, 2, 87, 1, 3, 1153, 59, 445, 433, 1265, 3446, 166,
+    64, 42, 727, 240, 3343, -10454, -10444, 704, 13, 26, 34, 107, 61, -10385, 676, 4768,
+    68, 7, 1509, -10341, 1, 979, 10, 5, 293, -10270, -10023, 44, 136, 83, 171, 668,
+    72, 73, -10000, 3, 434, 66, 1, 5, 223, 147, 135, 409, 7, 3, 1, 3,
+    64, 8, 829, 1, 212, 412, 610, 24, 282, 56, 73, 613, -9956, 413, 1, 1064,
+    6, 81, 90, 56, 1650, 47, 13, -9933, 17, -9916, 8, 14, 3025, 147, 41, -9833,
+    1, 220, 46, 791, 2, 3173, 1902, 77, 2230, 17, 310, 280, 14, 72, 297, 748,
+    987, 4728, 533, -9805, -9779, 4, 4, 188, 45, 6, 17, 591, 64, 149, 4386, 590,
+    1514, 2, 688, 2079, 43, 82, 4, 33, 297, 391, 800, 2601, 86, 52, 1, 135,
+    89, 10, 669, 2, -9769, 64, 739, 6, 92, 78, 827, 1, 1655, 228, 3492, 404,
+    126, -9730, 3, 135, 689, 8, 39, -9681, 2, 14, 57, 3, -9680, 41, 4, 0,
+    2255, 1023, 3, 64, 469, 239, 3, 734, 6, 1, 56, 1, 1421, 536, 36, 14,
+    36, 223, -9678, 112, 663, 1849, 153, 10, 3, 27, 4, 69, 2, 1433, 2, 326,
+    45, 1723, 126, 637, 965, 1811, 5, 942, 1832, 298, 3, 1, 1736, 445, 1947, 1059,
+    449, 857, 4, 156, 1078, 153, 118, 797, 4521, 531, 18, 574, 10, 242, 1179, 9,
+    117, 113, 48, 60, 140, 1710, 320, 7, 967, 127, 658, 102, 292, 2, 8, 19,
+    355, 4, 503, 27, 103, 65, 1, 735, 23, 0, 31, 604, 10, 51, 25, 395,
+    13, 5, 469, 1, 262, 4078, 3, 21, 203, 96, 74, 1052, 876, 2, 3132, 0,
+    47, 689, 1625, 167, 246, 421, 995, 589, -9615, 20, 6, 5, 0, 5152, 262, 779,
+    -9611, 25, 1092, 349, 1051, 292, 7, 28, 88, 1, 221, 121, 1, 1303, 260, 0,
+    309, 4, 88, 3, 1338, 290, 984, 546, 384, 118, 7, -9610, 70, 14, 1, 8,
+    71, 92, 67, 1603, 82, 25, 260, 13, 136, 8, 7, -9607, 94, -9517, 99, 26,
+    40, 369, 11, 5, 67, 16, 1, 381, 139, 4187, 170, 19, -9516, 1, 38, -9361,
+    715, 251, 3, 236, 0, 9, 201, 0, 165, 1553, 1, 330, 5, 5, 418, 30,
+    63, 241, 5, 257, 34, 325, 628, -9357, 17, 19, 37, 3226, 129, 10, 280, 395,
+    -9308, 368, 138, 1, 431, 320, 2, 267, 8, -9250, 781, 442, 15, -9168, 524, 536,
+    -9136, -9070, 79, 45, 783, 0, -8990, 325, 37, 673, 9, 321, 43, 42, 15, 1221,
+    460, 3, 158, 1, 45, 13, 6, 2296, 1355, 14, 13, 22, 4, 10, 49, 11,
+    2, 185, 15, 228, -8765, 62, 16, 676, 173, 417, 230, 122, 27, 17, 149, 863,
+    284, 85, 1, 127, 4, 29, -8702, 55, 308, 22, 2976, 5, 2730, 482, 17, 77,
+    0, 415, 253, 30, -8682, 1, 1225, -8628, 2, 3, 9, 1595, -8340, 122, 1025, 374,
+    314, 6, 88, 325, 2835, -8311, 3, 15, 81, -8264, 2, 125, 261, 2984, 1917, 13,
+    0, 14, 148, 4, 14, 9, 2, 84, 947, 524, 684, 2, 3, 104, 8, 155,
+    80, 800, 131, 181, 39, 6, 3071, 57, -8177, 5, 1187, 54, 412, -8104, 26, 1,
+    409, 1080, 3, 993, 25, 587, 1118, 2, 2194, 64, 1, 35, 1, 38, 1, -8084,
+    1558, 98, 23, 14, 101, 1002, 1, 6, 54, 21, 38, 5, 132, 528, 1357, 1235,
+    145, 46, 1, 2975, 30, 260, 1617, 27, 9, 277, 1, 2970, 243, 2, 2, 2419,
+    8, 110, 890, 1625, 615, 3488, 1, 3258, 16, 32, -8062, 15, 136, 3, -8040, 2,
+    -8026, 146, 22, 200, 13, 10, 25, -8007, -7962, 2, 70, 6, 13, 15, 389, 139,
+    51, 31, 4, 2, 42, 684, 1652, 2285, 7, -7846, 80, 41, 743, 744, 2385, 683,
+    -7767, 189, 423, 38, 2327, 366, 25, 346, 65, 143, 2451, 1, 3, 464, 1171, 816,
+    509, -7744, 2, 3783, 245, 841, 117, 6, 1195, -7680, 14, 403, 4, 118, 191, 677,
+    465, 24, 5, 0, 2, 300, 1, 1045, 3, 12, 49, 409, 163, 27, 844, 225,
+    17, -7595, 250, 1, 362, 1298, 54, 436, 725, 83, 560, 51, 18, -7591, 654, -7567,
+    1586, 10, 975, 1917, 9, 32, 431, 54, 776, 2049, 1115, 1576, 12, 71, 1251, 24,
+    1, 1028, 6285, 1064, 6, 122, 62, 19, 102, 300, 1299, 0, 513, -7517, 42, 41,
+    31, 953, 322, 698, 2215, 748, 83, 2391, 50, 1, 3, -7492, 30, 88, 5, 21,
+    12, 2, 541, 1336, 76, 113, 58, 29, 171, 282, 157, 1, 1138, 483, 242, 6,
+    417, 33, 3570, 177, 140, 7, -7435, 208, 46, 38, 19, 1, 1, 539, 70, -7308,
+    899, 380, -7295, 5, 643, 25, 194, 20, 6, 193, 144, 6488, 7, 19, 148, 440,
+    0, 52, 2097, 40, 2, 559, 181, 2261, 28, 350, 110, 4, 3, 12, 22, 3,
+    1565, 260, 4, 9, 11, 79, 1346, 43, 1602, 222, 232, 1757, 889, 38, 1961, 96,
+    1616, 2, 766, 3, 39, -7284, 5116, 538, 2, 287, 21, 86, 57, 220, 135, 633,
+    107, 349, 11, 4, 120, 95, 914, 2911, -7267, -7058, 3, 459, 111, 32, 32, -7056,
+    367, 32, 1, 1164, 561, 46, 2936, 51, 939, 71, 306, 82, 362, 121, 1594, 54,
+    154, 1832, 45, 321, 173, 57, 383, 7547, -7044, 3, 2461, 143, 729, 160, 34, 6,
+    6179, 119, 1583, 3573, 111, 10, 1187, 1393, 3250, 433, 5, 1, 4, 5, 7, 13,
+    293, 1120, 316, 2, 7, 43, 5, 140, 1924, 32, 3750, 12, 198, 26, -6916, 1,
+    14, 1, 1, 847, 51, 80, 18, -6908, -6904, 464, 32, 3884, 69, 2573, 2177, 1364,
+    1, 14, 908, 838, 2010, 206, 6, 7, 2861, 16, -6829, -6780, 648, 41, 1149, 127,
+    79, 1310, 174, 13, 3, 26, 3, 33, 1467, -6580, 328, 200, 419, 66, 3, 1409,
+    122, 30, 2, 6913, 1, 113, 98, 252, 31, -6544, 2, 19, 150, 10, 2, 151,
+    4, -6532, 40, 115, 26, 3, -6528, 89, 30, 0, 4269, 189, 339, 37, -6506, -6497,
+    501, -6474, 403, 49, -6415, 28, 3349, 210, -6360, 5, 26, 182, 0, 3339, -6358, -6355,
+    3, 3, -6237, 1, 142, 1191, 0, 129, 1389, 27, 149, 54, 8, 1095, 425, 1,
+    13, 2, 325, 129, 3, 153, 657, 33, 100, 269, 244, 2626, -6218, 3, -6191, 1479,
+    578, 28, 103, 169, 9, 439, 18, 1, 219, 291, 440, 24, 680, 1577, 234, 1379,
+    3717, 1252, -6123, 6, 1, 284, 663, 38, 160, 831, 0, -6120, 3, 103, 1, 1123,
+    37, -6118, 3, 2, 4052, 36, -5911, 790, 179, 38, -5835, 3, 108, 7, 964, 153,
+    234, 20, 29, 71, 300, 0, -5800, 660, 64, 921, -5676, 54, 430, 5, 12, 568,
+    45, 157, 1650, 167, 267, 82, 33, 215, -5615, 3, 493, 326, 3894, 65, 15, 8,
+    592, 1, 53, 17, 243, 43, 54, 76, 445, 90, 68, 4, 1, 541, 1573, 54,
+    314, 2, 1093, 256, 4697, 55, 61, 4348, 6, -5602, 3, 2, 171, 2, 49, -5521,
+    0, 3174, 7, 144, 567, 7, 90, 122, 205, 219, 53, 238, -5497, 629, 1118, 6,
+    9, 998, 0, 141, 662, 9, 4, 122, -5457, 2316, 170, 76, 467, 1394, 396, 711,
+    4, 25, 15, 109, 0, 12, 324, 6, 18, 311, 215, 382, 733, 1225, 108, 91,
+    774, 1, 2, 2, 3, 197, 97, 9, 13, 446, 2, 36, 94, 45, 1579, 1,
+    116, 224, 138, 8, 1764, 11, 19, 288, 25, 2, 6, 64, 96, 823, 1, 134,
+    65, 0, 269, 266, 131, 10, 426, 358, 356, 49, 984, 277, -5427, 545, 12, 28,
+    3, 526, 3418, 360, 4, 667, 71, 49, 1188, 76, 61, 30, 9, 131, -5288, 150,
+    2765, 31, 655, 1, -5182, 401, 1569, 9045, 138, 169, 228, 0, 134, 93, 7, 2,
+    -5168, 34, 5346, 2265, 49, 3857, 2679, 23, 357, 1, 0, 171, 23, 1, 195, 0,
+    751, 175, 25, 34, 18, 1, 193, 402, 1755, 26, 296, 2010, 1469, 33, 521, 24,
+    111, 6, 5, 0, 1734, 589, 717, 204, 1200, -5155, 989, 6, 1659, 972, 148, 102,
+    -5070, 4483, 1718, 1, 4, 4115, 134, 1971, 115, 3531, 3308, 497, 366, 255, 138, 753,
+    61, 893, 305, 11, 46, 3565, 147, 698, 1, 8, 336, 2, 75, 118, 54, 597,
+    6, 4, 102, 4, 18, 111, 130, -4941, 4859, 594, 1, 661, 11, -4903, 530, 139,
+    3649, 10, 25, 33, 226, 7, 1269, 2, 623, 3, 26, 373, 563, 1698, 371, 10,
+    275, 21, 59, -4900, 6, 338, 129, 38, 16, 491, 4, 7510, 3, 14, 10, 1154,
+    0, 2, 60, 87, 53, 26, 181, 1145, 485, 456, 9, 871, 1569, 1297, 29, 267,
+    201, 3, 2060, 1433, 17, 219, 1260, 30, -4821, 1237, -4804, 2488, 55, 0, 51, 2648,
+    563, 109, 1, 3357, 611, 742, 73, 20, 4, 19, 53, 6, 253, 0, 0, 158,
+    1, 792, 17, 150, 2, 1778, 900, 127, 4, 274, 294, 4, 204, -4734, 37, 2868,
+    2, 12, 44, 202, 3170, 10, 102, 366, 4846, -4707, 31, 15, 1156, 33, 1081, 107,
+    2, 598, 1939, 375, 0, 26, 1978, 1, 4, 3, 2, 4, 6, 51, 5, 1,
+    6, 183, 7057, 330, 68, 4, 218, 487, 352, 3, 133, 67, 1805, 25, 201, 760,
+    2648, 522, 5, 14, 241, 2071, 382, 437, 624, 845, 1, 1966, 80, 1343, 1962, 7,
+    32, 3, 53, 559, 57, 17, 122, 4375, 506, -4697, 23, 26, 21, 509, 219, 267,
+    262, 144, 263, 110, 71, 2523, 67, -4611, 351, 1242, 2405, 141, 2721, 6, 0, 102,
+    402, 696, 1837, 27, 313, 534, 846, 138, 2293, 1194, 22, 17, 24, 112, 84, 272,
+    2, 92, -4578, 2, 16, 9, 159, 2130, 795, 55, 1925, 299, 602, -4508, 29, 6,
+    90, 156, 2717, 1, 298, 0, 84, 70, 2276, 32, 15, 213, 3129, 452, 18, 1562,
+    720, 25, 19, 1, 2, 241, 29, 92, 1160, 221, 16, 103, 332, -4440, 5, 364,
+    212, 1252, 1674, 3928, 137, 207, -4251, 354, 2440, 504, 1706, 56, 13, 252, 68, 88,
+    14, 2417, -4208, 53, 1, 16, 352, 209, 56, 52, 974, 24, 546, 15, 143, 63,
+    2, 603, 26, 20, 350, 3116, 1738, 1631, 129, 2860, 477, -4107, 1098, 639, -4067, 2,
+    -4038, -3991, -3953, 544, 763, 1704, 77, 29, 1011, 40, 6, 5, -3919, 1, 450, -3799,
+    1, 578, 92, 82, 25, 2116, 15, 1, 1, 2401, 2153, 1135, 688, 33, 981, 472,
+    0, 44, 860, 1, 395, 1416, 732, 2881, 10, 22, 606, 1, 447, 2842, 4, -3788,
+    67, 14588, 627, 3, 1, 234, 8, 2084, 3, 271, 1984, 1078, 7, 135, 1528, 26,
+    5899, 263, 115, -3732, 5, 42, 36, 97, 1245, 1723, 1015, 25, 380, 127, -3685, 40,
+    -3587, 1, 16, 107, 3303, 28, 120, 5, 3, 845, 506, 4, 3422, 1226, 109, 7,
+    75, 40, 57, 237, 985, 777, 331, 515, 473, 14, 417, 2021, 92, 5, 18, 503,
+    242, -3575, 692, 56, 20, -3523, 64, 199, 127, -3423, 26, 3, -3314, 357, 6, 2,
+    1301, 3084, 3, 33, 407, 130, 0, 257, 983, 970, 179, 17, 12, 62, 281, 293,
+    1615, 697, 265, 1, 55, 831, 26, 86, 1, 463, -3297, 4, 374, 2, 34, 5,
+    1366, 341, 88, 1244, 385, -3100, 40, 14, -3064, 32, -3031, 3406, 588, -3004, 142, 170,
+    -2918, 787, 29, 14, 552, 1141, 131, 14, 282, 30, 36, 21, 5, 19, 6, 631,
+    -2844, 208, 0, 34, 446, 3442, 3, 290, 185, -2809, 88, 4, 139, -2788, -2588, 5,
+    2104, 55, 91, -2580, 616, -2477, 27, 1114, 34, 5, 34, 4, 6, 159, -2304, 9,
+    476, 2493, 172, -2282, 173, 0, 26, 49, 81, 1171, 551, 5915, 74, 104, 181, 3722,
+    2, 783, 366, 246, 2, 46, 2, -2274, 78, 283, 520, 12, 205, 2, 276, 1165,
+    2294, 2366, 174, 24, 898, 9, 2257, 5, 2167, -2180, 1218, 1, 20, 1355, 16, 1,
+    21, 1952, 482, 1013, 27, 21, 5719, 950, 2567, 1262, 251, 645, 29, 316, 66, 6,
+    18, 10, 4, 22, 1, 73, 28, 216, 8, 57, 105, 529, 2, 409, 51, 114,
+    120, 202, 291, 591, 726, 94, -2046, 392, 900, 316, 1, 1, 8365, 2073, 496, 302,
+    134, 275, 1254, 1104, 906, 17, 1, 143, 1, 10, 6, 6, 585, 942, 69, 412,
+    173, 9, 735, 667, 1564, 11, -2036, 441, -2016, 16, 2538, -1988, 6, 1471, 2, 38,
+    833, 111, 766, 1726, 280, 21, 2, 1, 3322, 24, 8, 201, 1, 674, 5462, 183,
+    4, 6, 950, 288, 7, 16, 1328, 0, 4, 16, 491, 213, 2365, 3, 2, 20,
+    1015, 1, 102, 94, -1957, 975, -1895, 7, 721, 258, 370, 54, -1874, 1, 9236, -1812,
+    405, 1846, 561, 277, -1754, 0, 978, 3537, -1753, 452, 13, 69, -1726, 451, 3, -1692,
+    -1652, 141, 1064, 124, 135, 1, 374, 2294, 68, 130, 316, 205, 1970, 1, 3, 107,
+    0, 43, 966, 57, 2, 1522, 104, 1, 613, 1, 64, 140, 129, 4, 2, 1,
+    2, 6, 1475, 683, 4, 105, 1, 723, 5, 1, -1630, 2407, 669, 126, 1147, 1029,
+    -1551, 227, 193, 74, -1546, 879, 710, 17, 2, 18, -1513, 129, 23, 67, 36, 4,
+    65, -1496, 63, 2, 1, 30, 1, 4, 227, 2, 37, 1295, 2, 975, 217, 262,
+    227, 1942, 25, 3, 232, 1061, 40, -1398, 3, 4, 930, 1358, 814, 129, 1, 387,
+    160, 256, 10, 589, 3, 1, 373, 1310, 8019, 869, 29, 3, 3978, 5, 1187, 707,
+    26, 349, 30, 3, -1360, 68, 1928, 13, 117, 1, 2000, 2131, 10, 9, 3006, 0,
+    243, 8196, 4, 3043, 5, 115, 817, 67, 8, 201, 3, 41, -1301, 1549, -1175, 116,
+    185, 3139, 3, -1162, -1080, 9, 182, 16, 11, 813, 1696, 108, 128, 4, 2, -1033,
+    215, 1, -959, -957, 7, 5, 2926, 2166, 6, 1772, 2, 1820, 76, 1006, 295, 546,
+    82, 67, 202, 3, -949, 11, 5730, 9, 2831, -898, 37, 191, 137, 2339, 22, 268,
+    90, 1235, 59, 2213, 244, 330, 1, 168, 63, 12, 3, 204, 2362, 5, 6, 87,
+    56, 349, -790, 196, 463, -773, 53, 8, 5, 65, 373, 71, 1, 2647, 245, 2,
+    224, 176, 151, 22, 797, -671, 167, 248, 1, -649, 6, 879, 2, 2, 51, 1955,
+    6430, 213, 50, 672, 907, 3, 11855, 1124, 1, 2, 187, -536, 1204, 334, 72, 462,
+    145, -476, 6, 95, 3, 2, 2993, 37, 4681, -423, 5, 17, 0, 5, 2, 46,
+    6, 146, 86, 230, 17, 2, 14, -377, 1, 1741, 278, 4, 33, 828, 54, 711,
+    788, 1673, 8, 59, 58, 57, 1, 1219, 612, 31, 396, 56, 2, 6317, 735, 1671,
+    2035, 826, 165, 279, 219, 67, 160, 47, 3006, 105, 47, 3366, -349, 2, 15, 1313,
+    4699, 1, 1103, 12, 3957, 78, 912, 22, 2140, 2107, 1478, 3064, 45, 9, -315, 0,
+    747, 471, 1884, 450, -274, -262, -260, 27, 8, 2, 47, 13, 7, 88, 4, 22,
+    115, 549, 3, 1262, 1053, 1955, 4, 468, 31, 2, 4042, -213, 4892, 46, 116, 851,
+    -201, 11, 299, 5, 3667, 602, 3, 48, -29, 2180, 3, 32, 104, 176, 2, 4,
+    1, 2, 1,
+}};
+
+constexpr std::array<std::uint32_t, 70543> token_hash_slots
+{{
+    45174, 35674, 69794, 54673, 43186, 60048, 56895, 29832, 68552, 29652, 65135, 67861, 61397, 45604, 70214, 20216,
+    28242, 13464, 14944, 27515, 63716, 42957, 6882, 14236, 2896, 60084, 20263, 20439, 29230, 26671, 36070, 24166,
+    4803, 69136, 60915, 27898, 3388, 47530, 10243, 27971, 31439, 67483, 57674, 28468, 69732, 26994, 21146, 41639,
+    9491, 40406, 4334, 37779, 26928, 37369, 25685, 35064, 48286, 20626, 6644, 28443, 13055, 52724, 19860, 27464,
+    15352, 62587, 35781, 37468, 2206, 4789, 64958, 70290, 66986, 28688, 43160, 62824, 29379, 33626, 2065, 11806,
+    26693, 19389, 7182, 39482, 55604, 7003, 15005, 70256, 58133, 30400, 59122, 14259, 33583, 13430, 60972, 13189,
+    13160, 45795, 62540, 1460, 32341, 45534, 28454, 47355, 43202, 40744, 8658, 46834, 11997, 28167, 17305, 31710,
+    60704, 40938, 2588, 16323, 69738, 9454, 4511, 38361, 20480, 55759, 66370, 65099, 33718, 2728, 47924, 53263,
+    51093, 29849, 30814, 64514, 6719, 57576, 54388, 38814, 69801, 21918, 21397, 10262, 33354, 22293, 37226, 20405,
+    54964, 66180, 36374, 8973, 21079, 43721, 27901, 23301, 70282, 38549, 7899, 4679, 14794, 30127, 56740, 10214,
+    17472, 20787, 9385, 36370, 37698, 49970, 34401, 35705, 4229, 68687, 66153, 36132, 14590, 40378, 31874, 51669,
+    26029, 57734, 261, 16551, 10550, 54534, 48682, 48258, 57560, 22878, 18076, 40724, 49438, 23401, 10882, 22961,
+    13518, 36766, 49258, 36697, 69734, 22916, 54916, 19387, 9713, 21342, 10741, 17235, 42954, 55901, 20460, 29200,
+    52493, 49576, 41300, 50570, 14629, 45833, 44572, 567, 12116, 51939, 14542, 13483, 5364, 10987, 64497, 2159,
+    61121, 4831, 17787, 38853, 2922, 55270, 57643, 30175, 11670, 68893, 25593, 49108, 4354, 24256, 23193, 47788,
+    29026, 10903, 61484, 11394, 1683, 45642, 9108, 468, 57954, 13627, 34766, 2693, 27765, 33799, 59445, 42528,
+    33181, 21932, 10391, 36390, 53416, 17893, 25025, 20308, 54398, 64659, 51196, 36081, 36053, 31342, 14549, 36587,
+    24746, 15219, 12603, 20455, 47043, 14579, 68218, 12295, 65062, 650, 34656, 48852, 57691, 36785, 41227, 52874,
+    11882, 22337, 37302, 23047, 57702, 21928, 9643, 36598, 13514, 31944, 19730, 22327, 28230, 45449, 15247, 46193,
+    62128, 53159, 67297, 51225, 1112, 29690, 1663, 219, 18181, 20963, 31156, 11725, 28338, 63062, 59266, 60305,
+    59929, 36408, 67658, 68836, 45849, 30920, 21907, 11884, 54861, 37320, 16106, 22037, 49870, 23692, 38596, 2745,
+    14745, 60947, 48355, 41961, 15663, 13570, 40881, 67068, 48801, 65225, 12928, 61679, 55085, 40263, 51277, 14922,
+    22868, 55226, 67268, 9692, 45473, 47249, 19369, 18720, 40123, 9953, 60108, 28238, 58217, 13896, 62485, 64139,
+    1567, 8663, 58355, 29752, 28012, 9678, 11688, 29487, 70309, 65095, 22974, 17767, 11875, 66333, 63294, 18394,
+    60875, 57879, 48032, 9490, 69018, 22546, 49041, 36373, 2364, 46067, 39565, 69336, 33072, 46875, 40345, 32090,
+    14450, 68065, 28996, 107, 15113, 24481, 25479, 54776, 60487, 56350, 20819, 67957, 68260, 2836, 7467, 55092,
+    68325, 69090, 52481, 43311, 20093, 23028, 45541, 31492, 49272, 4281, 23883, 7377, 36063, 19717, 50323, 11834,
+    3070, 51457, 5894, 63038, 64087, 26412, 23413, 60714, 47169, 44090, 48077, 17807, 68151, 39264, 55978, 47354,
+    56164, 57887, 6684, 61361, 5817, 53030, 48867, 9091, 61712, 25012, 56722, 34542, 63732, 60327, 43465, 21755,
+    63489, 50917, 19830, 18969, 15482, 68000, 32149, 19828, 65605, 39087, 61828, 44680, 99, 35012, 30821, 38911,
+    42025, 2119, 65972, 26456, 38226, 25225, 43617, 54648, 27785, 40321, 36560, 27772, 7855, 41225, 13614, 51321,
+    917, 29276, 32633, 34273, 69564, 278, 67962, 48166, 60211, 34323, 5919, 26156, 42166, 8148, 47516, 69628,
+    58700, 56579, 17486, 12238, 60919, 44823, 45484, 32897, 6957, 7575, 9757, 51222, 43564, 68029, 70363, 22627,
+    52382, 68931, 61144, 13295, 35697, 61711, 9390, 19060, 21955, 8763, 50845, 33037, 13013, 17094, 66538, 67082,
+    38092, 58234, 61396, 55917, 3026, 58244, 8271, 48299, 22934, 35784, 7091, 4756, 61950, 39476, 22355, 38454,
+    14608, 7896, 123, 38923, 57038, 12085, 34000, 8414, 33586, 20471, 61791, 11911, 49312, 40738, 65581, 57669,
+    3117, 30627, 32642, 49701, 30491, 13937, 10275, 16459, 53321, 55288, 2077, 53763, 24850, 1784, 29245, 60419,
+    61081, 58176, 4367, 25239, 34121, 29614, 24098, 57681, 31011, 12843, 67829, 63329, 15451, 21953, 56109, 27194,
+    28983, 48361, 37884, 3455, 32825, 9420, 1264, 68189, 18742, 10682, 12138, 56384, 25279, 36161, 35324, 21621,
+    1345, 55959, 56186, 12659, 16447, 55615, 15337, 17735, 15564, 60663, 63526, 55807, 56994, 2715, 9620, 31612,
+    67524, 55772, 25642, 3999, 67526, 63023, 21245, 50630, 44327, 48783, 48954, 45886, 21086, 5657, 25555, 38852,
+    5698, 64190, 59818, 34387, 36180, 66409, 43289, 56589, 67028, 368, 66753, 25784, 54943, 5534, 7962, 53570,
+    37557, 31666, 41821, 60395, 17184, 47842, 50093, 46960, 7456, 15928, 40355, 54251, 2956, 6697, 14723, 11286,
+    19412, 53972, 58811, 63660, 25518, 52271, 13045, 52222, 59211, 41228, 3359, 31084, 1583, 62605, 70047, 37602,
+    54865, 57381, 5704, 32998, 21888, 28160, 15895, 34021, 58938, 6688, 55467, 1689, 16460, 13442, 52473, 26743,
+    31281, 56639, 40260, 42588, 33475, 37039, 4819, 20083, 59161, 36708, 5111, 65641, 37875, 45730, 40351, 61690,
+    49482, 56890, 52289, 58680, 160, 32121, 63885, 38153, 67085, 37177, 12049, 27692, 64928, 58711, 15479, 16877,
+    19869, 50178, 47507, 41184, 48377, 15265, 56796, 20715, 39511, 52362, 57997, 17030, 37006, 42658, 47416, 13358,
+    59462, 50125, 37042, 49750, 66748, 68438, 21880, 5464, 29354, 38898, 67202, 64192, 13961, 69329, 21255, 15927,
+    43053, 40334, 23238, 33548, 37855, 44688, 6117, 679, 34253, 59158, 53879, 58981, 2494, 29969, 63908, 4788,
+    24402, 19670, 4124, 43539, 25918, 70060, 27823, 59719, 37694, 23027, 52620, 25617, 1486, 23241, 6772, 4203,
+    32353, 51261, 13177, 9484, 68346, 45583, 42767, 63393, 54258, 32955, 40212, 57890, 61105, 1849, 69700, 67933,
+    4108, 19651, 39114, 52255, 54155, 40189, 35182, 51066, 49338, 32254, 56002, 7304, 58897, 10655, 32747, 34712,
+    52396, 1253, 14331, 7994, 69835, 59568, 60558, 34751, 65114, 47214, 14787, 18131, 49449, 54712, 22020, 49408,
+    7765, 43754, 51144, 16832, 13284, 10491, 28293, 926, 40708, 36054, 14712, 26772, 32684, 7954, 39762, 15912,
+    10081, 25533, 68544, 37869, 53271, 61832, 63218, 21152, 40255, 22066, 7370, 8834, 9863, 2621, 19397, 36971,
+    5368, 5144, 33844, 9293, 13052, 970, 8132, 32967, 60859, 51070, 66118, 52983, 61526, 60253, 31004, 27480,
+    898, 40262, 8010, 41297, 20918, 40215, 54477, 23438, 11486, 57842, 57967, 24099, 9338, 11344, 64203, 42978,
+    28582, 18326, 28187, 23567, 32696, 11571, 66600, 32912, 22766, 15588, 44264, 15456, 35980, 58015, 9838, 21383,
+    24246, 47426, 56633, 5472, 44241, 253, 48289, 11640, 7750, 5041, 2840, 7039, 1185, 42666, 14381, 7650,
+    25190, 62639, 18649, 25362, 38942, 53366, 1317, 26634, 7810, 24831, 64642, 4282, 22763, 16238, 16168, 69060,
+    28557, 26432, 24145, 18144, 61620, 106, 67092, 18188, 62671, 43142, 32091, 4882, 20746, 67417, 68142, 60920,
+    6845, 12158, 62159, 54457, 40843, 24023, 32413, 6036, 20384, 6451, 2070, 21717, 42399, 15869, 57699, 37942,
+    55086, 12216, 67764, 7331, 28265, 20072, 54963, 7060, 43112, 63364, 54891, 51902, 13243, 5613, 64419, 47641,
+    11814, 67370, 19145, 209, 35894, 56050, 54491, 17850, 18072, 38757, 24229, 464, 24439, 16375, 3845, 10374,
+    25826, 63935, 69403, 50838, 34894, 45388, 20364, 54528, 22646, 14506, 33516, 25353, 31887, 60681, 12572, 43158,
+    28207, 37454, 66173, 20765, 7022, 43566, 887, 62791, 59160, 24330, 47964, 29173, 42551, 10295, 67178, 1648,
+    4305, 62099, 50009, 69373, 42125, 17437, 31950, 56865, 25121, 51230, 27608, 61384, 44779, 33277, 7964, 2602,
+    41452, 2671, 17772, 12401, 46843, 15682, 55875, 12648, 66272, 58000, 43482, 39930, 26290, 59947, 13120, 26314,
+    16688, 64430, 23724, 34511, 66182, 28412, 36749, 18444, 8440, 13392, 61358, 2646, 28334, 46283, 48425, 59371,
+    8135, 44543, 9022, 70373, 10348, 68427, 45702, 20123, 1851, 50577, 26286, 68207, 31650, 30350, 38342, 2513,
+    25120, 56309, 49448, 18479, 39990, 5712, 22407, 11770, 58398, 16210, 46508, 58177, 617, 16219, 61603, 35004,
+    67634, 51142, 29851, 68178, 30772, 58285, 43204, 30213, 15829, 62321, 6885, 55722, 58474, 60080, 54482, 40982,
+    58722, 11097, 11264, 22057, 41291, 59506, 11108, 54986, 40153, 34051, 39591, 14068, 26788, 65297, 22760, 54233,
+    70121, 32187, 18871, 40985, 29654, 46182, 43042, 60401, 24479, 69348, 64994, 48659, 47124, 53147, 5103, 33411,
+    2467, 70, 17224, 27885, 38736, 40435, 63124, 27384, 10801, 3138, 7856, 30672, 31135, 32772, 58519, 17998,
+    2914, 24755, 30319, 9601, 30573, 56700, 34996, 18387, 37419, 60595, 67598, 66287, 65198, 34514, 23380, 63953,
+    47848, 27755, 47652, 6675, 38545, 67132, 17839, 8694, 43286, 19525, 13278, 35971, 53867, 58250, 6432, 53824,
+    6987, 11083, 53303, 69114, 7345, 60304, 34634, 28458, 1076, 56082, 8622, 35628, 43801, 14513, 19989, 22694,
+    64924, 25277, 18068, 49916, 43757, 5856, 38741, 8886, 26058, 60088, 7983, 14690, 40362, 49463, 9257, 44926,
+    32952, 16636, 63532, 51243, 34493, 40016, 51635, 53453, 14376, 10166, 9941, 40290, 13785, 11979, 56331, 25778,
+    12812, 4911, 5693, 13315, 28116, 50980, 23061, 13330, 48601, 5800, 32789, 48608, 53525, 4614, 307, 49801,
+    13875, 5197, 65020, 42243, 64147, 32942, 31151, 43145, 41220, 38784, 12131, 39510, 27725, 48879, 6413, 46301,
+    8439, 39432, 15749, 46269, 68897, 7444, 51130, 30268, 31185, 39083, 64246, 60161, 19122, 48013, 57062, 19011,
+    45509, 63511, 28974, 5135, 13909, 25230, 69021, 32359, 24421, 3380, 17550, 29081, 65686, 5879, 63097, 49417,
+    62848, 47195, 6460, 16251, 11712, 30957, 17478, 43538, 30399, 68934, 5915, 54315, 34317, 11063, 36824, 13419,
+    10830, 48735, 24031, 7560, 57429, 6746, 46863, 35197, 21844, 64927, 49223, 58791, 45898, 28420, 64852, 28748,
+    34348, 48998, 36742, 50156, 60086, 20242, 52203, 20537, 53022, 18226, 17272, 6488, 36324, 59127, 69979, 68865,
+    59118, 52425, 9040, 46601, 24367, 60341, 54480, 64209, 21591, 58949, 34235, 13039, 42815, 69823, 15331, 15225,
+    40987, 17945, 44513, 35936, 16669, 2223, 33486, 35545, 58975, 9144, 59361, 6910, 56304, 17195, 11907, 21260,
+    39369, 13787, 50568, 69543, 9497, 45465, 41072, 29758, 68504, 62710, 16659, 38869, 12207, 1239, 7023, 28285,
+    28637, 69603, 17900, 66436, 68355, 16002, 5819, 24622, 17284, 64715, 53341, 63899, 62691, 35310, 4579, 5035,
+    51357, 36497, 20376, 69070, 42969, 14153, 50760, 47657, 35979, 37322, 67113, 61382, 68521, 15842, 20443, 57104,
+    57752, 43868, 12792, 41006, 60044, 10441, 51642, 4966, 49582, 53108, 30679, 23489, 64535, 66777, 34144, 9439,
+    10892, 42413, 36086, 47553, 58401, 61994, 69050, 58460, 56653, 58618, 34867, 49148, 564, 44535, 21311, 2891,
+    9146, 18789, 39703, 5002, 32500, 51880, 1100, 12558, 23628, 62976, 65799, 62202, 69037, 62334, 24641, 51012,
+    41215, 68546, 8537, 45439, 35604, 12274, 55182, 58887, 56327, 41133, 8228, 25248, 45495, 51943, 1885, 14133,
+    20735, 20298, 42785, 60103, 27562, 43726, 41904, 66965, 45309, 47036, 54454, 31048, 20135, 4245, 59025, 63673,
+    37724, 49424, 9182, 52744, 62870, 14249, 2921, 42881, 19017, 40303, 65000, 68986, 66628, 24249, 62417, 47367,
+    5869, 60842, 2156, 42748, 31350, 12019, 40902, 59629, 68241, 58521, 30302, 48035, 18979, 30720, 27854, 53840,
+    33440, 8218, 47591, 53473, 68185, 62608, 40138, 22354, 29168, 7355, 42271, 34693, 54787, 19341, 60116, 69976,
+    22883, 64485, 26958, 5628, 56654, 31025, 35636, 38872, 27264, 2764, 30343, 66105, 30811, 39329, 7244, 36729,
+    37212, 37771, 24016, 49768, 63112, 34019, 16060, 22082, 69520, 27407, 32356, 28253, 50266, 3182, 38624, 4709,
+    61270, 5532, 68323, 54552, 59569, 19997, 52725, 51531, 58768, 3827, 7673, 12410, 62640, 59142, 50642, 17639,
+    15322, 34002, 37395, 64169, 46920, 25958, 68609, 48747, 35660, 41783, 64571, 36422, 30866, 28976, 55973, 44776,
+    28313, 39833, 58106, 27521, 26133, 39024, 12185, 11508, 44815, 69247, 8509, 1951, 45408, 17677, 54329, 33784,
+    57096, 6903, 67680, 15615, 38912, 36793, 67397, 12299, 52194, 42649, 13184, 2612, 43118, 17666, 64396, 55545,
+    49260, 60854, 37730, 15614, 54735, 67015, 28163, 36827, 68693, 9175, 23777, 56523, 66577, 51844, 10111, 10190,
+    29598, 67854, 66842, 22055, 33015, 58626, 32242, 13385, 18489, 5306, 11015, 33232, 67834, 7980, 50295, 39346,
+    40700, 24523, 9735, 24881, 49479, 10141, 54801, 46334, 34563, 12091, 47432, 53198, 41655, 13171, 35518, 29243,
+    24557, 50588, 28613, 1602, 33377, 63048, 22955, 66578, 18690, 60531, 48219, 6402, 21243, 16657, 70498, 65059,
+    27305, 36122, 14408, 15618, 49050, 18533, 37791, 59558, 55628, 27880, 40192, 7624, 14377, 64930, 31349, 62571,
+    12941, 26128, 20996, 53716, 60410, 40632, 18989, 34402, 37123, 6902, 30083, 11281, 67469, 2531, 2203, 11265,
+    13299, 14517, 65511, 60097, 65026, 29773, 9876, 30933, 67298, 13779, 35617, 11706, 5558, 54505, 21132, 27684,
+    52611, 43206, 16220, 49458, 58256, 28493, 49841, 28568, 6838, 39016, 60315, 14642, 61494, 34219, 38235, 39491,
+    23136, 3030, 30180, 11811, 41577, 40490, 52322, 64774, 30108, 16563, 68449, 7190, 15280, 43994, 28558, 29043,
+    31400, 40550, 33828, 27022, 19444, 27593, 52211, 3057, 8162, 7465, 37255, 8685, 64905, 10906, 34660, 55007,
+    9260, 1254, 70216, 4174, 35903, 53744, 23716, 68933, 36296, 2438, 56040, 33480, 13079, 37289, 51100, 13611,
+    21367, 37139, 44231, 41648, 61005, 59701, 58701, 19019, 70126, 15205, 22507, 22014, 59227, 10429, 14362, 10694,
+    32064, 37394, 9510, 52850, 59224, 34931, 68592, 42405, 44876, 44115, 7128, 59772, 63068, 30584, 3965, 49329,
+    64116, 40779, 19898, 32320, 29685, 32348, 22008, 20007, 20396, 6664, 6420, 52825, 15150, 17172, 30376, 37760,
+    66873, 42914, 69099, 59405, 31132, 64496, 34734, 15511, 11617, 16030, 31754, 69771, 20170, 57836, 48520, 52297,
+    48999, 44583, 14803, 69709, 25157, 16592, 36619, 66162, 27886, 11757, 18471, 51941, 8792, 61863, 66209, 24703,
+    941, 33807, 6378, 69374, 40169, 62424, 4420, 17537, 28439, 32146, 59571, 6780, 49865, 53054, 49675, 5473,
+    13143, 35054, 64899, 19316, 26596, 27633, 32340, 32384, 70184, 28807, 42786, 33614, 25688, 17956, 28373, 8041,
+    27093, 27610, 65285, 66970, 50739, 36198, 3555, 41553, 58484, 4391, 7904, 23576, 62416, 54071, 2966, 487,
+    63553, 29491, 8740, 61565, 49236, 41858, 33666, 43415, 10478, 20687, 30651, 9732, 21787, 38987, 41997, 42855,
+    14131, 33405, 35126, 47706, 5433, 58868, 6419, 4049, 23488, 40540, 3780, 26687, 40593, 33881, 68255, 11384,
+    26280, 48387, 64669, 32612, 47683, 20604, 5577, 35976, 30572, 67154, 49107, 39922, 16723, 24468, 41224, 14478,
+    36340, 66279, 42791, 37224, 9412, 8745, 52389, 37403, 27010, 55890, 3817, 24859, 38540, 50143, 45538, 62602,
+    34837, 36686, 47385, 69173, 31386, 63078, 54151, 28731, 62996, 46241, 68817, 52144, 6236, 54191, 7228, 50145,
+    61109, 45262, 25736, 49065, 51723, 2860, 10028, 57243, 31317, 25799, 64211, 63352, 17183, 46661, 69798, 23480,
+    32882, 59541, 8962, 34201, 38032, 49697, 64871, 12738, 24732, 43778, 27484, 11584, 23879, 55195, 45046, 10675,
+    33686, 41166, 29976, 32661, 34486, 62504, 47445, 9094, 26781, 61758, 43382, 63422, 27677, 46400, 9879, 29419,
+    4634, 49945, 51557, 46541, 38074, 24816, 203, 17881, 61802, 68637, 33789, 47786, 56508, 17523, 5531, 12071,
+    48144, 48758, 38568, 39687, 33787, 61228, 48502, 24601, 43360, 10918, 13543, 24550, 3407, 13048, 35254, 56016,
+    41420, 54671, 8770, 13265, 39912, 45452, 7139, 3311, 58107, 65415, 27111, 1324, 31684, 19366, 37198, 19962,
+    4314, 26278, 50764, 26873, 36591, 11270, 63237, 1049, 16548, 4825, 34059, 7842, 28435, 7143, 63012, 370,
+    38070, 69772, 62132, 41957, 52169, 20019, 5154, 65231, 11382, 60633, 49978, 14751, 52589, 7915, 1346, 23956,
+    63623, 62178, 26006, 18651, 26940, 36292, 47001, 1263, 54750, 16259, 18094, 32707, 62351, 39011, 37060, 57740,
+    18625, 15302, 36571, 50253, 59347, 637, 39054, 56993, 44735, 37399, 43526, 37467, 64946, 5164, 66437, 3100,
+    19194, 42391, 645, 21895, 16617, 54588, 63961, 33845, 4459, 10064, 7524, 41209, 34167, 19219, 12901, 49525,
+    65598, 2722, 27513, 46464, 4811, 50302, 23851, 3593, 63374, 4507, 4100, 16230, 37738, 24419, 5426, 54541,
+    10068, 26276, 20157, 70002, 14181, 25402, 48567, 59162, 61401, 6310, 5284, 2988, 44548, 29875, 4950, 26037,
+    41322, 17908, 8709, 29096, 457, 27442, 67230, 68101, 65665, 9153, 13179, 3596, 48541, 4493, 58212, 28442,
+    45089, 20758, 45841, 60725, 2827, 24108, 9250, 43449, 41841, 34831, 36096, 10997, 59159, 60372, 2243, 64000,
+    58235, 69982, 36277, 37596, 12595, 39438, 4370, 7809, 62390, 11763, 59709, 56879, 39098, 31954, 60149, 45413,
+    48074, 34801, 64443, 64621, 20502, 9872, 27323, 40239, 58251, 27800, 37695, 52927, 886, 48310, 27952, 24925,
+    44855, 69381, 9982, 24054, 68474, 15571, 63453, 20186, 18529, 16204, 64160, 67816, 54199, 11031, 48406, 15726,
+    70358, 31615, 9890, 41050, 57875, 54809, 34845, 39526, 52682, 31688, 33488, 21198, 13558, 28104, 62709, 13008,
+    57927, 31358, 16174, 11543, 48889, 35358, 66385, 8087, 21030, 50684, 12367, 45196, 2288, 50216, 34330, 33772,
+    27872, 19736, 6351, 15298, 14462, 8011, 39290, 63890, 58373, 52070, 2790, 13816, 34267, 32547, 27694, 58222,
+    50313, 36873, 8466, 45037, 50599, 4890, 13975, 63139, 31633, 58571, 43093, 62521, 44053, 7547, 5327, 62708,
+    20972, 50471, 7354, 17171, 7082, 15936, 38729, 26656, 740, 53289, 27063, 68562, 34583, 29697, 62634, 3751,
+    24869, 20357, 25785, 69513, 3204, 41753, 61516, 12646, 61283, 52923, 48250, 41483, 69803, 54983, 17034, 64750,
+    48768, 67410, 33175, 32650, 41277, 36865, 16585, 24655, 39407, 51641, 53607, 44664, 22801, 64835, 44528, 70345,
+    8617, 67456, 924, 9608, 29954, 26112, 38334, 22718, 44095, 790, 24891, 56719, 33817, 70411, 61440, 10714,
+    25480, 42560, 31193, 9311, 63008, 24057, 31971, 63413, 5992, 43808, 42163, 5905, 7947, 16358, 48308, 5699,
+    61398, 45544, 57495, 50777, 6949, 22496, 2339, 65629, 24590, 25576, 22196, 67340, 25496, 3450, 63184, 11386,
+    18422, 27088, 16717, 24351, 62315, 31855, 12413, 15994, 10849, 69449, 2317, 46719, 63312, 61487, 6207, 55456,
+    31673, 22827, 24678, 46441, 2380, 10535, 606, 69902, 15672, 28032, 41658, 44436, 42368, 27313, 32784, 28602,
+    21878, 8829, 42939, 49600, 38695, 38251, 22172, 20199, 62653, 55652, 50264, 4733, 49948, 39616, 12929, 45770,
+    6932, 4574, 32810, 18937, 24998, 43315, 51095, 1783, 1277, 48784, 6786, 33544, 51974, 7117, 18975, 30971,
+    41939, 66192, 49599, 50416, 3172, 66565, 27453, 45969, 24542, 56505, 67200, 64524, 7764, 1325, 8483, 43157,
+    21213, 6088, 59303, 12237, 43183, 4820, 16045, 28898, 4993, 27643, 69301, 40373, 5861, 18644, 52986, 70476,
+    50322, 62054, 52730, 44091, 42507, 32407, 32879, 54900, 60005, 44912, 18976, 4168, 47400, 44325, 8281, 18137,
+    10228, 3010, 23141, 69848, 61218, 26198, 43767, 45271, 56414, 35323, 41792, 6852, 62927, 4478, 23458, 60755,
+    24617, 10883, 58810, 68084, 17943, 21208, 16655, 38754, 46215, 3364, 42119, 55375, 20927, 53823, 40812, 50799,
+    44154, 67375, 14547, 39158, 38375, 37189, 49780, 70279, 12261, 40784, 35119, 56887, 26340, 838, 33045, 41134,
+    36238, 1233, 19385, 441, 66365, 35580, 68492, 55330, 16981, 6322, 45785, 4736, 62836, 46144, 63791, 32816,
+    25779, 45505, 69787, 33170, 54633, 10554, 36530, 52502, 26103, 22475, 24043, 29762, 20610, 20245, 68200, 12517,
+    34578, 23918, 69911, 26508, 69102, 3737, 20562, 9882, 37933, 12634, 32628, 24285, 47809, 23070, 21964, 64008,
+    53210, 39992, 34274, 25105, 15018, 2694, 62413, 61523, 49731, 49608, 20026, 61044, 7133, 23163, 51659, 1181,
+    19495, 1959, 65394, 70042, 63638, 42562, 42189, 42836, 4560, 69857, 40999, 25888, 13166, 66054, 23271, 25425,
+    4061, 44085, 61048, 11529, 2601, 65334, 49370, 44679, 32148, 26045, 33350, 25366, 34586, 52557, 11235, 6587,
+    29949, 66353, 24673, 2654, 2174, 69547, 15899, 47174, 63583, 34856, 24067, 4489, 8334, 19661, 21518, 12344,
+    35907, 12336, 36713, 35145, 45488, 63625, 54948, 59402, 48378, 52180, 53866, 2917, 28610, 22543, 37293, 38161,
+    31273, 44280, 4764, 33522, 36909, 18027, 16696, 13071, 37836, 27415, 23949, 58263, 24991, 56813, 54413, 34944,
+    43704, 11800, 21535, 63141, 68677, 55283, 32056, 16938, 44975, 40522, 9032, 68767, 8802, 33462, 42135, 68098,
+    58857, 18331, 3326, 56870, 30942, 27437, 53452, 37330, 55153, 32602, 64670, 44081, 47488, 45761, 32105, 2410,
+    47353, 29661, 30643, 11796, 37056, 64883, 39209, 58099, 32217, 17659, 58036, 19163, 56635, 66879, 5723, 60096,
+    946, 18698, 29420, 68800, 6073, 2962, 40863, 26269, 55277, 56351, 30875, 22838, 63354, 42297, 46892, 15303,
+    63105, 23519, 14639, 45831, 55685, 17218, 43920, 48304, 70008, 50019, 53891, 61199, 21832, 16980, 8356, 10747,
+    32970, 57862, 25391, 63912, 69358, 37381, 26895, 6233, 64829, 51186, 23933, 66447, 15944, 33873, 67772, 3772,
+    69171, 10693, 65947, 12666, 14849, 44537, 30085, 8352, 35258, 26059, 19930, 19079, 28646, 7687, 30106, 19688,
+    69134, 5478, 19486, 28025, 64813, 56816, 49440, 35295, 68462, 42, 6712, 7334, 59751, 681, 13884, 58139,
+    23995, 40677, 36784, 2893, 4179, 63860, 5851, 43990, 10042, 69027, 13717, 5773, 8699, 34536, 34611, 8328,
+    68107, 30966, 69559, 31886, 63485, 33470, 36009, 29167, 30749, 27510, 40423, 5914, 31416, 12325, 46800, 322,
+    63219, 27119, 19360, 61065, 64586, 69304, 18177, 17840, 52529, 47243, 16601, 67771, 9023, 40043, 69175, 31630,
+    7451, 68053, 58660, 36085, 46151, 27246, 61883, 48965, 31133, 46529, 62003, 65165, 20054, 7137, 6730, 39238,
+    58682, 41914, 34231, 13022, 10428, 427, 65131, 47926, 27459, 34529, 3734, 2437, 20312, 1879, 44846, 24420,
+    57570, 66290, 2240, 6482, 12638, 56973, 60517, 37711, 40976, 23649, 55702, 5797, 46912, 41298, 12717, 4860,
+    9647, 39408, 16705, 45329, 39050, 36820, 12262, 59948, 41365, 48470, 25700, 34286, 38106, 33546, 57283, 46337,
+    2971, 34846, 30056, 41789, 30969, 46916, 48365, 47554, 12057, 38024, 41736, 19386, 18269, 1688, 20614, 60330,
+    1662, 26672, 21674, 63164, 27259, 65402, 16326, 28627, 54779, 54186, 38044, 39627, 15082, 49699, 67753, 18458,
+    61918, 33566, 6596, 41242, 25560, 28355, 66978, 37679, 18862, 3603, 26875, 57939, 64601, 27354, 57193, 66151,
+    35141, 55272, 9751, 17777, 8767, 47624, 67457, 11166, 44872, 61251, 20981, 54641, 19610, 45281, 56600, 56229,
+    46714, 2907, 43925, 25921, 55794, 52773, 40248, 23749, 41692, 36502, 64264, 22375, 42713, 64904, 61113, 21067,
+    22234, 53129, 66674, 18568, 2781, 36586, 69402, 40807, 5537, 22197, 62753, 28781, 41661, 56848, 66470, 69946,
+    57790, 7869, 36526, 23330, 13713, 29970, 35596, 50833, 23945, 38341, 49423, 49722, 42703, 56777, 44787, 15109,
+    28980, 18198, 59053, 30307, 61779, 1616, 10399, 16009, 11377, 47596, 36545, 32126, 16374, 31691, 20360, 4336,
+    58392, 41147, 19135, 50082, 38368, 40460, 65911, 68536, 1922, 24265, 28447, 29193, 41754, 14601, 6584, 50422,
+    6216, 31965, 58987, 47264, 58760, 14876, 6492, 15619, 42869, 30879, 68056, 15750, 27478, 43383, 11006, 63827,
+    20090, 34396, 26071, 27198, 63762, 9808, 61023, 48272, 15974, 46977, 36913, 44667, 14711, 63172, 47782, 48088,
+    45007, 35562, 62852, 17671, 64591, 53681, 70478, 46078, 62809, 8343, 45215, 34287, 62994, 3142, 19871, 310,
+    27921, 45768, 40718, 52696, 65585, 9624, 31170, 7287, 43789, 18253, 8444, 26377, 22768, 32159, 6958, 33638,
+    26893, 7543, 42253, 9214, 27114, 10639, 42490, 21711, 61622, 33849, 57103, 14011, 44938, 17794, 44649, 28223,
+    53599, 25644, 3662, 28284, 61172, 27077, 34157, 43563, 25455, 4838, 16971, 11749, 29185, 10257, 35946, 51459,
+    37341, 30907, 32764, 14171, 65909, 17321, 33673, 56241, 58592, 9994, 56978, 38870, 32510, 59496, 56518, 20929,
+    67004, 27815, 23702, 24540, 48255, 17699, 66807, 67452, 34244, 14023, 16153, 65740, 48396, 21320, 17271, 8270,
+    43737, 48240, 22628, 23085, 36663, 18228, 8304, 59171, 41454, 64134, 35648, 4992, 42665, 22598, 18971, 38314,
+    10013, 59886, 8857, 35233, 54439, 62644, 18047, 35926, 1438, 26921, 2961, 7363, 68425, 55577, 3629, 66475,
+    67741, 70234, 53161, 26649, 3372, 5256, 64615, 151, 11503, 20191, 8395, 61426, 70482, 33471, 11358, 50406,
+    54403, 46476, 55813, 68962, 32982, 24758, 65520, 16068, 19950, 60712, 51788, 53856, 38874, 63394, 60045, 52832,
+    44152, 24872, 37002, 48782, 23004, 57796, 8655, 49635, 15373, 43768, 11754, 69544, 48692, 58456, 44317, 68139,
+    32991, 3783, 61012, 2181, 4502, 40666, 4996, 38585, 1837, 24120, 43263, 4606, 64373, 29089, 61181, 44002,
+    30926, 21722, 3, 32295, 53153, 41892, 45414, 67632, 59856, 44127, 11398, 29582, 17444, 12481, 40253, 18943,
+    17506, 36772, 109, 11551, 8379, 21188, 56405, 42931, 11026, 6900, 8103, 40867, 55239, 7257, 40392, 1610,
+    33483, 19128, 42475, 38030, 30822, 37308, 68744, 56826, 62405, 3866, 53861, 46659, 14197, 59754, 13833, 36919,
+    30037, 51146, 13280, 8581, 42741, 16851, 30005, 51180, 8984, 65779, 63508, 44374, 67103, 53299, 42449, 10344,
+    3069, 32637, 5584, 69965, 6052, 37614, 22804, 66262, 33653, 12621, 52757, 54137, 7886, 1752, 1998, 532,
+    40719, 66196, 20244, 38772, 49361, 23595, 69465, 37663, 6411, 22162, 65186, 32306, 38363, 29137, 50710, 55664,
+    32084, 66505, 49544, 53914, 26357, 65815, 2699, 23974, 28463, 4482, 15887, 49715, 13318, 22528, 63126, 51824,
+    66117, 29083, 40163, 17912, 67945, 24449, 32301, 11976, 49855, 43353, 270, 14340, 19233, 42108, 61632, 23342,
+    50134, 42835, 12202, 50353, 21424, 25290, 31373, 16879, 55960, 21268, 28682, 36923, 2286, 8941, 51278, 6930,
+    38254, 8461, 17976, 52822, 64549, 68225, 40694, 67621, 18634, 56076, 29498, 4797, 68472, 3039, 6089, 39419,
+    24784, 33959, 59216, 15398, 65056, 16556, 49559, 19325, 10247, 12197, 56294, 15485, 11666, 14507, 16763, 13708,
+    28101, 2450, 63584, 55063, 65532, 38264, 68656, 21062, 5818, 55212, 989, 31921, 48106, 23087, 68738, 43573,
+    19052, 36612, 35759, 28949, 20414, 52279, 2817, 27644, 65178, 34924, 20291, 64387, 19620, 15676, 47901, 28088,
+    37953, 46044, 65656, 32842, 38759, 50444, 31576, 57552, 63515, 1249, 58255, 9415, 61035, 58079, 35061, 36147,
+    13675, 22548, 17585, 5722, 23156, 32376, 57572, 36284, 23265, 18099, 12397, 34197, 18287, 64440, 12322, 2169,
+    25045, 52873, 40854, 6989, 6879, 56526, 23419, 45869, 23849, 11501, 61424, 62619, 29320, 54914, 54275, 3634,
+    39093, 35566, 33394, 28367, 23228, 25990, 24937, 20568, 12252, 5678, 1569, 63499, 30242, 40299, 12960, 64082,
+    34225, 68756, 15813, 62932, 9378, 64066, 65953, 737, 42431, 49334, 54649, 65363, 8492, 59379, 62289, 36327,
+    12524, 58727, 48816, 34927, 50051, 49367, 59673, 44027, 39817, 12189, 49070, 56177, 42067, 52949, 28460, 10186,
+    24027, 69515, 26311, 3812, 45226, 53987, 5550, 60569, 26361, 13185, 61527, 9464, 9867, 51855, 19674, 15115,
+    4321, 25618, 59360, 52722, 45988, 38337, 66566, 17832, 13207, 47362, 17806, 67001, 40347, 48576, 14811, 6975,
+    16229, 30254, 2015, 21012, 41280, 64022, 54204, 37682, 51564, 52552, 21222, 23754, 64598, 70176, 68554, 38425,
+    36969, 2989, 1174, 61959, 38824, 3904, 12902, 34815, 30880, 389, 37465, 33316, 36830, 52706, 38155, 16629,
+    16471, 65638, 2498, 51625, 48551, 6147, 69592, 27575, 62717, 67320, 32197, 57950, 27274, 14689, 20309, 62760,
+    59761, 35959, 13452, 31536, 43975, 6553, 69739, 3453, 40618, 47313, 4404, 3414, 3735, 42728, 108, 18182,
+    46699, 32859, 11999, 65505, 42536, 34261, 32535, 12424, 26601, 12880, 3702, 24424, 29776, 24307, 34612, 19636,
+    7621, 22161, 68990, 21920, 49036, 24357, 68, 67647, 18891, 31235, 26882, 9017, 32913, 43836, 41131, 27586,
+    17141, 41216, 28069, 40605, 58505, 59940, 50648, 54242, 45429, 1928, 51501, 506, 54976, 65608, 60003, 67356,
+    52987, 21945, 10788, 33060, 14950, 64553, 51732, 18774, 40806, 51819, 14809, 38430, 55803, 34516, 4959, 38442,
+    27418, 51735, 31285, 36669, 60892, 15520, 22192, 54011, 65723, 32174, 34359, 51176, 16056, 22852, 63501, 10953,
+    57190, 2912, 67218, 4952, 35505, 56092, 1314, 11555, 7121, 22320, 16652, 46302, 31293, 47878, 67928, 31367,
+    26041, 14101, 21470, 33986, 17419, 57635, 16360, 16456, 49598, 55221, 38907, 27539, 67441, 62792, 40182, 52779,
+    34984, 16611, 9537, 21782, 52039, 17961, 11708, 42311, 46798, 51263, 36953, 62190, 70163, 7707, 41223, 55125,
+    60009, 53008, 13945, 67122, 14348, 1237, 16282, 20049, 64320, 62436, 62944, 28222, 25672, 60807, 21799, 14091,
+    9509, 5052, 66911, 16582, 41038, 6795, 54179, 37591, 46395, 49503, 67073, 6947, 56920, 31262, 44901, 67431,
+    15538, 3864, 6832, 11127, 58267, 55482, 54288, 4150, 46604, 19750, 54719, 14205, 48994, 39552, 66792, 37120,
+    55892, 36029, 69930, 11315, 31041, 61753, 42128, 35084, 52908, 56096, 41383, 32199, 18778, 21737, 56776, 13615,
+    56540, 16400, 2705, 53635, 19008, 68042, 54358, 63076, 42359, 41843, 3143, 2883, 21167, 32075, 12478, 54178,
+    23563, 10192, 61529, 39463, 12133, 16306, 59232, 58563, 6964, 46168, 26984, 58814, 26650, 46505, 35196, 8993,
+    48713, 98, 46527, 25452, 54185, 56787, 13468, 29228, 2738, 27067, 6677, 57711, 68262, 69974, 57793, 7908,
+    11172, 60501, 7321, 21219, 37092, 31925, 56833, 7733, 45159, 928, 61520, 6006, 5276, 31019, 2606, 42285,
+    15864, 34420, 3740, 14235, 10587, 14784, 29010, 42749, 15103, 33705, 36577, 21676, 24954, 66305, 51471, 25854,
+    60277, 50536, 20300, 7153, 59565, 50174, 27875, 59937, 31016, 58183, 64783, 39761, 27451, 28881, 63385, 38847,
+    29253, 28828, 28824, 26461, 28441, 15124, 53789, 13670, 22608, 55472, 791, 19844, 23943, 50656, 37328, 48624,
+    7629, 33648, 45677, 19559, 27870, 11056, 3741, 40496, 31500, 47638, 33846, 40846, 41794, 13636, 54600, 34448,
+    28196, 8500, 11272, 12840, 54013, 57910, 1349, 53979, 58504, 64916, 53534, 28886, 21725, 27680, 42942, 26366,
+    39249, 69100, 30464, 21019, 28378, 40733, 10591, 51346, 15760, 51237, 51628, 23052, 5546, 36972, 64304, 29125,
+    39295, 17023, 39671, 59914, 69150, 24299, 65419, 63858, 17622, 47428, 2984, 17480, 15490, 26348, 47076, 55115,
+    26736, 62762, 37157, 32181, 44350, 10128, 43675, 62140, 51555, 63904, 64631, 24276, 23191, 67341, 70419, 15411,
+    13709, 9333, 43883, 64322, 56998, 23202, 3920, 17797, 1845, 13467, 17447, 13003, 34005, 4593, 44277, 38567,
+    34001, 56575, 25296, 30719, 25821, 18626, 19050, 56746, 21064, 27664, 53846, 46910, 43785, 17715, 2473, 38411,
+    12250, 48388, 58562, 36723, 22785, 60924, 48189, 53469, 43733, 62067, 59350, 48030, 37705, 10278, 25186, 16936,
+    46148, 60575, 7366, 57469, 55024, 56874, 24294, 35206, 17491, 48610, 16298, 38616, 50154, 19829, 16518, 23353,
+    330, 39267, 3627, 16458, 40901, 59967, 67295, 7789, 61589, 55367, 59064, 36106, 8991, 61908, 20236, 30362,
+    31816, 49388, 27759, 33329, 56778, 27115, 23383, 41076, 14617, 37271, 69490, 10237, 41828, 14607, 38063, 30724,
+    28674, 45859, 10582, 60823, 60765, 22130, 56170, 21482, 50929, 23128, 13233, 1566, 43787, 46684, 61949, 64397,
+    67879, 2909, 52215, 69243, 47664, 52219, 26120, 6518, 52385, 35626, 50615, 17875, 4695, 7317, 46205, 10811,
+    70486, 12011, 44417, 5830, 69755, 23064, 46773, 25032, 49628, 39714, 35096, 30578, 2205, 67791, 32314, 66361,
+    4232, 31642, 7769, 36469, 32902, 16685, 35195, 48565, 56814, 15652, 31941, 30364, 65921, 37805, 58668, 48779,
+    65017, 31286, 48284, 56190, 10820, 19959, 25135, 58659, 46438, 63080, 26299, 24837, 7057, 23580, 2099, 44864,
+    2344, 28787, 61955, 12981, 69261, 21915, 27568, 17739, 32001, 29789, 22015, 29069, 1920, 30917, 44822, 6100,
+    15765, 39233, 39205, 59500, 50990, 61208, 45552, 10144, 35450, 193, 33137, 58336, 64399, 67617, 54860, 65830,
+    61336, 50350, 53536, 68411, 24677, 12772, 47632, 8677, 16906, 47578, 10322, 11158, 34723, 29946, 17654, 61562,
+    66241, 35023, 50296, 20542, 44922, 10547, 10585, 37233, 13612, 61375, 25640, 12446, 6515, 60604, 18356, 13799,
+    59528, 60175, 9240, 65821, 41675, 8042, 50531, 15264, 62210, 9898, 24509, 67631, 13092, 41352, 64301, 10149,
+    9951, 10821, 47034, 27910, 40101, 27078, 6177, 22926, 37503, 34965, 66590, 36527, 49795, 26238, 16817, 9974,
+    2443, 38491, 35002, 57209, 53627, 9327, 2954, 33300, 1766, 62285, 41606, 14193, 45766, 48598, 42010, 69370,
+    36664, 13193, 12554, 29523, 58117, 40064, 15789, 11244, 41009, 14109, 23584, 66589, 7826, 6362, 45577, 31839,
+    28380, 53730, 37118, 58307, 53935, 19767, 45745, 11785, 23396, 53683, 35700, 40487, 23372, 68749, 69098, 33589,
+    50453, 39590, 27032, 67584, 50290, 6559, 14271, 5054, 53538, 67347, 35304, 38367, 37016, 65576, 8459, 12696,
+    30856, 64599, 5642, 29769, 3447, 42132, 64260, 38012, 57404, 3953, 69081, 55493, 34421, 450, 67011, 7392,
+    19265, 41040, 9964, 2420, 10756, 68209, 42547, 5423, 49182, 23198, 61320, 34501, 62740, 31799, 48677, 29623,
+    15990, 29294, 26216, 21024, 63796, 66844, 51814, 65783, 62458, 55537, 18211, 13852, 43795, 65401, 42402, 51046,
+    61956, 30892, 37473, 26195, 36013, 70037, 6822, 39584, 39876, 5169, 5265, 7991, 34997, 34782, 29673, 16439,
+    56951, 53603, 7409, 16716, 60030, 47251, 56019, 14157, 47044, 16407, 17374, 27082, 12474, 51602, 28131, 16759,
+    18878, 28726, 31806, 50363, 31390, 65431, 29310, 4427, 30368, 23874, 25727, 21098, 56650, 57049, 59561, 29386,
+    70239, 66284, 17705, 10376, 22004, 11611, 51275, 5748, 5474, 32943, 207, 41922, 8963, 40523, 46666, 19062,
+    58261, 63314, 52022, 52933, 59193, 21824, 13879, 58413, 53298, 54177, 41026, 29533, 17569, 4323, 2391, 22941,
+    420, 17459, 48125, 7514, 9636, 13780, 25214, 9652, 5972, 46768, 1279, 33921, 20904, 37154, 64077, 37774,
+    27950, 38289, 20137, 19278, 14022, 45229, 2813, 40415, 54775, 25552, 6737, 30900, 11150, 39690, 22918, 42885,
+    62597, 10965, 58517, 6610, 1658, 36761, 29984, 51430, 52378, 46591, 24210, 33903, 13389, 22845, 2680, 10165,
+    12702, 35886, 22040, 35464, 1280, 52710, 12754, 4086, 41632, 31803, 32541, 53736, 48203, 32873, 55208, 26365,
+    45893, 58191, 34212, 42682, 29102, 46986, 60683, 60298, 67593, 21875, 47447, 16876, 26709, 53988, 61195, 6916,
+    62631, 24070, 34428, 61241, 43943, 39008, 3755, 49904, 22064, 25690, 50904, 69440, 46584, 7586, 37699, 1685,
+    56788, 18931, 52619, 52388, 23499, 56682, 42987, 43039, 63251, 41740, 10687, 31935, 35953, 25668, 38052, 42295,
+    51308, 68093, 64146, 3841, 27794, 3688, 62163, 5429, 68979, 27766, 31909, 23173, 28916, 2027, 25414, 63955,
+    47168, 42776, 6471, 48835, 883, 65039, 7292, 9419, 55103, 14245, 66524, 66331, 20966, 42001, 12777, 11200,
+    48333, 16055, 36386, 51112, 1495, 63089, 29613, 4586, 26000, 48464, 47810, 15299, 8981, 31822, 26178, 27754,
+    69152, 26694, 50834, 18613, 47114, 61901, 58350, 22920, 26503, 18849, 17590, 21624, 30709, 35807, 66617, 42738,
+    28303, 30054, 31824, 58274, 3966, 34308, 54040, 14389, 17122, 51900, 29571, 11965, 4725, 62816, 58761, 59423,
+    58253, 61780, 14522, 29538, 67642, 43249, 1568, 52543, 27224, 58348, 36720, 11583, 32349, 14932, 65738, 58502,
+    37577, 56977, 14710, 40925, 18183, 20756, 6873, 10369, 36759, 67486, 33869, 10566, 7055, 34643, 6079, 23006,
+    12394, 51074, 50335, 39287, 69753, 49144, 27868, 57125, 49384, 48870, 58296, 53393, 4496, 62706, 47540, 54139,
+    31533, 8465, 44469, 28727, 68496, 64290, 38201, 5721, 19282, 10868, 50185, 20962, 32907, 65971, 2318, 3246,
+    17103, 12084, 32944, 47348, 43265, 26935, 49491, 3437, 3248, 15481, 66051, 30205, 33135, 23142, 20556, 55889,
+    20707, 63426, 13041, 6175, 41687, 6434, 59617, 26929, 52338, 67756, 20044, 3876, 34367, 36090, 63255, 35167,
+    24502, 57828, 50479, 8412, 25007, 39002, 8520, 25261, 41028, 36321, 69934, 1305, 40386, 60966, 7718, 32997,
+    64020, 11476, 45592, 15452, 23000, 55451, 70403, 6721, 24549, 16383, 22566, 24687, 29543, 6346, 8942, 49313,
+    6520, 22849, 57670, 40556, 36522, 60622, 46599, 32799, 52346, 66700, 42193, 63437, 24923, 36662, 24490, 66583,
+    46364, 12894, 19863, 16928, 35641, 25019, 42207, 20256, 19824, 3613, 45328, 8047, 51675, 25594, 10282, 60289,
+    17434, 1416, 34666, 37651, 16362, 30965, 15246, 9769, 69519, 52438, 1659, 66698, 6915, 55069, 59580, 33592,
+    65146, 50616, 36365, 58194, 44433, 44699, 62386, 54621, 2682, 40116, 5825, 6696, 39464, 28276, 7205, 42622,
+    28087, 48162, 47111, 37777, 52495, 56088, 68370, 58790, 54560, 13510, 49434, 46589, 66301, 42952, 24833, 57385,
+    42436, 31119, 50502, 23532, 68009, 9381, 56198, 29589, 7627, 50842, 68212, 38042, 3137, 42237, 36384, 490,
+    16285, 37571, 48902, 56827, 20467, 55524, 33003, 13536, 10783, 16308, 12151, 42173, 21289, 1533, 37229, 58430,
+    22609, 30751, 7626, 54430, 33345, 60611, 62803, 24283, 867, 29247, 37061, 68626, 36167, 22841, 44575, 34848,
+    3066, 62847, 75, 52516, 40428, 39308, 56462, 32737, 8839, 56919, 24340, 23725, 10959, 46801, 18415, 33280,
+    6493, 432, 69899, 45036, 2725, 12569, 18886, 41769, 3460, 8589, 56062, 30649, 21314, 53528, 22930, 32539,
+    65305, 32309, 27188, 61372, 38580, 55831, 46250, 59297, 50937, 38574, 64630, 6440, 33459, 2735, 43872, 1480,
+    40814, 41313, 18984, 65955, 64561, 37127, 26978, 38079, 14543, 49742, 24776, 8314, 21821, 39989, 10433, 36496,
+    64197, 51282, 25967, 36544, 19856, 15407, 58050, 48078, 15437, 8922, 40106, 69204, 55186, 33595, 46525, 70297,
+    56578, 67114, 65741, 244, 11792, 4133, 41823, 12687, 60995, 64173, 36872, 5617, 23525, 62137, 26459, 48753,
+    43783, 63051, 58206, 63408, 30286, 29915, 29823, 8827, 46752, 5793, 3977, 48646, 13851, 42701, 62146, 36074,
+    44605, 25069, 37726, 52870, 67086, 57139, 29505, 30853, 66238, 58546, 69125, 46383, 53275, 17053, 53792, 15249,
+    43951, 63176, 63030, 63476, 29322, 33332, 49972, 20548, 70449, 12007, 47994, 68216, 66462, 61862, 32540, 52907,
+    10421, 68276, 26891, 24585, 14835, 4024, 34214, 4101, 49273, 69224, 32367, 11612, 5459, 63463, 57653, 13880,
+    34964, 46160, 36961, 37808, 56820, 31260, 8345, 44736, 36786, 394, 21149, 39162, 30342, 54106, 3743, 21168,
+    61662, 32620, 66139, 36895, 54123, 12771, 11532, 46200, 51126, 23889, 46290, 20192, 13860, 58553, 39786, 12925,
+    4270, 58041, 43734, 16320, 61028, 41679, 39471, 47650, 38954, 18815, 43890, 5175, 34390, 63229, 52119, 42417,
+    47116, 6108, 24510, 57641, 29489, 28628, 55584, 9006, 44527, 586, 59476, 52729, 59901, 31598, 12101, 64040,
+    66394, 14283, 21394, 10046, 34518, 26062, 47365, 65933, 18417, 68077, 44511, 25953, 52857, 50268, 39826, 49081,
+    18592, 28945, 19280, 31248, 62056, 34818, 54562, 7070, 50953, 59058, 63878, 64341, 24343, 4530, 7759, 51783,
+    1631, 32292, 37200, 50578, 16396, 10001, 1753, 56434, 7356, 27701, 69557, 58648, 35843, 69876, 47871, 2052,
+    55097, 28643, 6545, 30558, 6727, 6145, 1987, 33455, 42191, 41179, 61902, 27599, 4, 61071, 16728, 53637,
+    7672, 33539, 65917, 63256, 19902, 46046, 35806, 2708, 69811, 52404, 6099, 14502, 58161, 64501, 55437, 35752,
+    16181, 35189, 31848, 53292, 58894, 2226, 39294, 30791, 16875, 38434, 41940, 11909, 2141, 62486, 31230, 36313,
+    59505, 62371, 46933, 7276, 18258, 28289, 7858, 31613, 41882, 49330, 39915, 11923, 3970, 11443, 27878, 69881,
+    43525, 33388, 58541, 25381, 55481, 70079, 7397, 12622, 32797, 59945, 65986, 52527, 34817, 8204, 50341, 40754,
+    17497, 23928, 52315, 27309, 30266, 16338, 50169, 27805, 54263, 59073, 45967, 18831, 3008, 60634, 17210, 3733,
+    36976, 9414, 22289, 23324, 49363, 3552, 29653, 14887, 44924, 25637, 44577, 51350, 27884, 33229, 8902, 46343,
+    24393, 42949, 33048, 52174, 24469, 32093, 26410, 48395, 39597, 62194, 49256, 18593, 62180, 5597, 66454, 30110,
+    17327, 31426, 62483, 25995, 23950, 21706, 70230, 35010, 47471, 58446, 10715, 21375, 1284, 16496, 16725, 61700,
+    59274, 42241, 35152, 45011, 33111, 45501, 12980, 1617, 41751, 38267, 8081, 3356, 10782, 5275, 12728, 70145,
+    35104, 31990, 59474, 8347, 6683, 38316, 47671, 25210, 8951, 48685, 23435, 2931, 14370, 11751, 46134, 22557,
+    55508, 66732, 12909, 39106, 27470, 25717, 3270, 45610, 58390, 14351, 4781, 41979, 42227, 29427, 16824, 2103,
+    21362, 27064, 52026, 45450, 26600, 51387, 16020, 4681, 46802, 22602, 43946, 19628, 56581, 66205, 11994, 41844,
+    8301, 34667, 14347, 46010, 4201, 35750, 17040, 42275, 4812, 50836, 16714, 56542, 34044, 2995, 38019, 24966,
+    66311, 67678, 28672, 46857, 49003, 14866, 53756, 5566, 16108, 59394, 204, 66525, 65908, 31776, 3985, 12374,
+    42352, 21181, 34850, 38087, 38690, 45821, 67964, 56326, 26721, 51116, 51802, 6740, 65457, 19268, 15949, 48708,
+    48743, 48723, 34291, 10397, 70330, 54690, 30625, 66425, 22592, 2132, 17223, 35025, 34258, 64897, 43844, 6613,
+    25333, 50563, 28085, 13033, 54257, 32890, 9981, 55928, 61421, 21044, 14986, 68777, 15493, 23179, 15611, 35093,
+    15223, 64453, 60241, 63646, 38013, 48117, 18801, 8599, 2433, 51147, 982, 51829, 24781, 35629, 43562, 54483,
+    6364, 26885, 53235, 48417, 68678, 37282, 36, 52735, 27522, 1213, 27092, 66952, 10739, 18916, 26220, 57066,
+    17812, 7310, 64502, 35395, 21646, 17810, 10381, 46287, 14192, 34830, 12350, 28972, 27783, 14561, 12693, 57148,
+    18934, 58980, 36804, 24207, 66207, 25079, 38151, 38057, 41283, 2887, 21779, 1670, 31131, 3230, 48055, 26074,
+    42921, 1318, 35445, 54545, 34350, 29346, 66642, 42029, 43765, 17153, 60398, 22518, 7258, 45021, 7328, 59548,
+    42015, 62861, 39864, 68440, 45129, 24159, 19177, 2970, 731, 48701, 37297, 61571, 67099, 20133, 52383, 9174,
+    11873, 41650, 18709, 23365, 28158, 52243, 12895, 11303, 58956, 11213, 12643, 32184, 20071, 139, 7303, 10475,
+    67548, 2965, 22894, 45394, 24516, 14226, 5079, 17588, 48270, 47166, 67025, 66908, 35330, 43357, 33437, 48785,
+    18185, 21811, 36658, 14061, 28049, 15976, 38188, 54844, 25849, 65778, 46292, 837, 9228, 47364, 16416, 31745,
+    33059, 21248, 47234, 61040, 60727, 10853, 19614, 19776, 61107, 60601, 55506, 10813, 68731, 36233, 20210, 68631,
+    67106, 3612, 29986, 58888, 45148, 61536, 3518, 41003, 44563, 40056, 54262, 5486, 19835, 56960, 67049, 23339,
+    11256, 36926, 53388, 62166, 2499, 53132, 59180, 52368, 7247, 24904, 4636, 49851, 58137, 32103, 12345, 39701,
+    14769, 8482, 13626, 67853, 52549, 13978, 30452, 50996, 23167, 29266, 13214, 29313, 24407, 55870, 31771, 63632,
+    4453, 65411, 42149, 36826, 23896, 6654, 55606, 46114, 56367, 32118, 3044, 27009, 65038, 31425, 12435, 14893,
+    28115, 52436, 444, 56537, 1558, 8956, 9200, 32624, 27824, 39045, 19109, 70201, 25434, 34289, 40301, 41749,
+    50751, 48280, 4112, 53589, 12831, 15860, 13729, 54615, 59698, 60745, 64149, 3897, 59393, 8346, 51956, 65902,
+    38193, 5159, 51781, 62643, 13485, 65867, 34312, 2074, 49878, 38610, 18224, 2188, 28893, 60121, 12475, 38672,
+    53858, 19474, 62971, 54235, 63757, 37762, 2806, 12943, 6055, 43561, 48493, 29848, 13984, 59648, 51769, 66344,
+    60641, 44626, 6285, 37583, 1704, 5178, 21712, 66426, 56793, 59428, 28594, 67446, 9799, 39472, 759, 770,
+    66672, 6673, 34399, 9401, 5210, 21600, 59414, 69527, 56378, 34887, 17655, 1687, 43085, 975, 50814, 67659,
+    41077, 53909, 46637, 20306, 43816, 26605, 56743, 16840, 42573, 16403, 21810, 67677, 13527, 43071, 701, 20724,
+    65996, 29803, 21233, 56533, 38091, 34803, 18940, 49314, 38129, 61230, 25348, 52283, 27233, 5126, 1918, 13724,
+    42918, 28927, 56188, 27018, 18375, 28109, 5399, 10302, 48638, 28576, 61913, 12058, 69820, 35647, 27324, 35091,
+    42592, 63542, 29734, 4592, 61653, 44120, 7196, 58652, 55286, 53051, 34863, 54391, 46169, 45584, 54440, 4971,
+    22024, 42092, 58230, 35899, 67238, 69650, 49254, 51637, 556, 48207, 36265, 64668, 990, 45084, 14326, 32927,
+    13407, 58704, 18524, 40038, 10415, 21288, 47141, 20198, 6597, 13266, 49433, 26305, 36419, 2347, 36359, 39102,
+    19608, 61719, 11621, 4805, 26190, 65201, 26597, 7823, 38180, 20018, 38886, 27662, 67285, 9405, 63844, 57230,
+    41473, 7609, 30369, 63009, 58052, 67111, 2507, 2260, 23862, 3562, 18217, 1208, 17988, 59540, 56761, 18961,
+    44683, 69991, 65934, 38258, 15867, 65012, 10544, 18060, 47815, 56343, 15379, 43735, 37231, 27023, 30283, 39304,
+    133, 50957, 15666, 21430, 33744, 35587, 45930, 19951, 18289, 40380, 38173, 67759, 42088, 37916, 31152, 40375,
+    38628, 34118, 28865, 55042, 14754, 34151, 66347, 57280, 32905, 27011, 14367, 27514, 44556, 68435, 1393, 48343,
+    13916, 39531, 1799, 19602, 63266, 15036, 60986, 46741, 664, 45176, 27171, 18463, 53270, 23448, 65390, 7542,
+    64372, 12332, 53273, 67390, 16319, 37202, 53876, 51371, 31936, 11141, 35732, 28011, 55036, 49668, 1018, 65618,
+    3840, 17331, 39606, 38000, 12573, 12869, 29926, 59358, 24524, 27516, 13727, 70472, 29338, 3218, 16888, 21100,
+    24498, 63092, 59875, 2659, 70481, 41382, 28182, 55779, 26602, 27089, 58094, 24221, 24715, 27202, 66982, 15525,
+    49400, 43113, 7145, 21630, 16177, 39318, 35113, 14843, 53725, 34714, 58361, 13733, 48683, 11695, 32743, 32716,
+    67185, 338, 62277, 31139, 8426, 55413, 67007, 42889, 65887, 54565, 66947, 21939, 64738, 22927, 18852, 60388,
+    55248, 62059, 36376, 36165, 49890, 67963, 39180, 59002, 39863, 10831, 66627, 13552, 10318, 36317, 41319, 58947,
+    33365, 18682, 32691, 22923, 51551, 34551, 21069, 56117, 61789, 34251, 49263, 15803, 48559, 10683, 40655, 60737,
+    33702, 10301, 10960, 27881, 47170, 15, 60185, 35347, 54536, 19355, 10115, 15283, 26904, 6883, 47630, 17073,
+    45331, 35930, 28963, 15997, 19771, 64581, 59135, 36753, 27717, 4531, 64810, 8843, 16473, 49681, 33281, 1110,
+    11360, 6105, 44643, 36941, 15182, 4542, 4461, 55958, 50765, 4221, 35192, 9696, 63225, 6140, 27634, 1936,
+    65063, 46972, 60747, 31558, 31504, 53261, 13329, 3826, 40461, 57140, 30016, 53344, 64709, 7126, 21193, 6896,
+    15953, 68612, 47905, 26085, 30060, 32165, 69313, 49692, 42303, 63337, 37065, 25608, 31786, 17999, 24434, 53430,
+    46614, 32144, 37947, 27240, 38184, 34440, 5100, 33880, 52032, 4121, 57196, 51940, 54678, 4247, 2115, 60343,
+    20025, 59202, 37015, 29695, 37733, 16469, 43747, 31303, 11165, 53066, 58102, 68415, 63870, 32893, 55851, 60484,
+    23623, 57646, 68486, 68015, 69039, 12862, 66640, 23936, 8868, 18392, 49997, 52100, 51722, 69959, 50029, 51214,
+    24436, 24489, 4523, 6458, 63991, 50283, 3384, 43800, 64737, 56801, 27711, 32423, 21172, 65400, 54206, 63159,
+    60576, 43164, 2983, 25683, 649, 5932, 46654, 12109, 33238, 43494, 67652, 30423, 20699, 19928, 8028, 15151,
+    63695, 44647, 25839, 63873, 56290, 4263, 70328, 20890, 29663, 47721, 27639, 9221, 26660, 28154, 14452, 18820,
+    17601, 9778, 66026, 37990, 12698, 3049, 27989, 26334, 39080, 30197, 3837, 33168, 24004, 38191, 59098, 62004,
+    57389, 19801, 67176, 42342, 44970, 62341, 46376, 16982, 50393, 15675, 55111, 26757, 13268, 10509, 44133, 42175,
+    29909, 33225, 6604, 62595, 52719, 35108, 17295, 62924, 40418, 47204, 66313, 14156, 31311, 43611, 53498, 68603,
+    35785, 26692, 29836, 961, 38225, 36703, 15447, 38952, 35916, 45167, 31496, 36272, 62369, 65569, 1248, 61374,
+    5083, 40916, 60978, 24416, 4798, 1143, 46071, 1075, 56974, 41521, 53043, 4917, 36719, 43590, 31590, 16967,
+    6811, 5592, 6084, 52716, 53070, 13987, 50319, 40570, 68773, 18290, 61149, 1717, 59366, 23133, 63216, 38956,
+    58597, 55505, 66654, 2812, 2071, 53905, 61143, 42627, 59628, 15474, 16555, 29076, 1839, 48146, 13476, 61004,
+    6189, 16828, 53484, 40829, 31734, 33497, 27253, 67972, 20922, 61190, 59705, 35768, 40824, 16044, 42408, 16463,
+    36102, 14342, 20303, 19611, 21593, 68490, 3707, 66633, 11603, 26194, 64044, 7049, 57158, 44381, 14928, 35495,
+    31867, 40968, 56368, 44238, 56322, 64151, 1591, 29669, 9945, 60025, 2237, 15781, 58595, 54632, 2275, 29988,
+    44880, 65412, 50977, 7220, 65510, 58029, 67522, 23897, 20132, 33941, 31499, 38486, 45173, 6137, 40177, 27877,
+    18009, 21173, 29402, 62513, 32373, 13521, 21650, 49353, 53230, 9517, 34657, 66692, 62182, 42300, 49515, 44164,
+    17283, 42153, 6157, 67570, 19237, 35694, 50086, 8142, 34875, 67348, 34048, 34922, 50035, 18132, 46479, 7042,
+    64522, 27160, 27671, 60363, 60180, 21151, 3431, 30767, 39768, 5489, 57306, 64035, 54881, 38160, 10044, 66995,
+    34189, 63571, 70396, 51533, 27368, 48008, 34844, 30091, 1671, 7950, 28110, 12757, 57658, 63940, 19301, 11040,
+    57830, 29019, 67294, 7824, 4460, 45617, 23776, 13423, 40789, 51488, 25436, 56279, 1336, 20706, 52083, 57832,
+    65257, 21598, 18653, 50976, 26784, 20766, 7917, 55420, 60535, 30270, 23068, 35996, 16131, 35020, 10280, 41784,
+    26275, 3793, 45339, 2026, 36399, 21185, 65881, 69621, 47334, 34969, 55474, 43654, 11173, 68652, 13046, 20100,
+    44791, 24069, 20082, 4172, 3107, 25221, 68095, 21364, 11945, 59269, 35992, 17799, 49856, 60346, 17084, 45107,
+    55549, 66576, 7822, 60939, 27189, 58856, 48312, 45241, 20903, 64689, 37025, 31442, 56564, 30906, 32981, 59536,
+    18555, 5151, 55933, 54586, 13375, 31195, 51493, 43075, 56588, 7035, 37138, 59534, 47503, 1642, 21110, 57016,
+    66134, 22123, 1755, 41058, 10779, 27157, 17660, 38345, 36700, 20713, 66240, 21731, 38028, 44964, 36610, 58288,
+    15603, 13372, 66615, 5887, 36171, 55919, 13754, 30708, 55548, 35942, 47050, 54184, 12407, 7052, 37554, 50212,
+    47016, 7976, 32802, 46726, 51288, 24900, 38985, 30473, 41864, 41694, 49781, 53833, 29529, 31507, 56771, 34608,
+    4312, 38124, 56345, 49845, 53642, 4219, 21333, 44564, 62951, 35428, 12450, 60474, 64210, 48004, 49101, 24061,
+    15038, 16156, 10142, 54582, 67012, 30487, 26322, 65236, 67885, 39224, 4815, 13456, 66713, 19851, 23594, 58858,
+    65671, 39365, 14616, 24820, 67433, 38646, 54543, 22316, 62549, 58328, 63812, 33581, 37496, 31216, 42735, 70540,
+    1292, 68557, 26291, 34865, 36615, 22424, 51460, 24778, 40216, 45760, 46830, 20208, 56626, 9792, 40092, 33231,
+    23570, 57367, 466, 67229, 30818, 18610, 18042, 30414, 59866, 15133, 1825, 5781, 2488, 51952, 26523, 56028,
+    64706, 42218, 23371, 6452, 5127, 6235, 31795, 16649, 53746, 68126, 24704, 62280, 69458, 48178, 43411, 53048,
+    29358, 58508, 43662, 63665, 35669, 57718, 41719, 9963, 15195, 36621, 61680, 36556, 20822, 40536, 39036, 29952,
+    68250, 7092, 67131, 63436, 20642, 13693, 46176, 50203, 35871, 44581, 52420, 29348, 31489, 69165, 31325, 43416,
+    3624, 13960, 3849, 19985, 58929, 29577, 4477, 42307, 13334, 45047, 52786, 42959, 13597, 34864, 1595, 9878,
+    39660, 50092, 39062, 11502, 62338, 42841, 56138, 38065, 60844, 46416, 14879, 55544, 39735, 32552, 10600, 43134,
+    35553, 18369, 22977, 8707, 46097, 55295, 47549, 21302, 64448, 4198, 60085, 28640, 6093, 68041, 27412, 5406,
+    69256, 6224, 5646, 41741, 65263, 57026, 36439, 21351, 26746, 11323, 59309, 17790, 22133, 8269, 18285, 31497,
+    38793, 17719, 19447, 1798, 58656, 50678, 69488, 13482, 3271, 44439, 4689, 42447, 643, 39988, 972, 39619,
+    66411, 16350, 58169, 32212, 61003, 70399, 63664, 53183, 55303, 58545, 7955, 23013, 26799, 8516, 67551, 41654,
+    14680, 30206, 947, 42059, 37619, 61595, 62217, 48437, 16065, 36573, 16651, 46194, 48354, 57935, 15210, 68096,
+    47697, 51273, 47206, 20836, 34881, 8174, 50256, 26515, 14078, 62025, 48389, 42878, 30740, 7005, 44177, 3027,
+    65121, 12877, 7241, 47429, 46355, 25085, 53639, 39221, 42079, 51578, 11898, 5167, 15889, 29973, 69107, 18041,
+    537, 20118, 11546, 5415, 13620, 45033, 28914, 11188, 58072, 3258, 24130, 23697, 67066, 15156, 34918, 31833,
+    56976, 59834, 55655, 52962, 60375, 69648, 3300, 67038, 32885, 43351, 25985, 49393, 53145, 50221, 10231, 18294,
+    68970, 31292, 14312, 63288, 56697, 43447, 22678, 41787, 31162, 29907, 32623, 21635, 31739, 64641, 13588, 7372,
+    7729, 18282, 49807, 69314, 6890, 52254, 60739, 70162, 31767, 16942, 43068, 62306, 45901, 19813, 70474, 4396,
+    59017, 15314, 14387, 58620, 59597, 14428, 33998, 15153, 32104, 13309, 21266, 44016, 7212, 56412, 48338, 19908,
+    65893, 57156, 6443, 3165, 52014, 51463, 31179, 41260, 65424, 30074, 17161, 23828, 64431, 610, 47856, 10696,
+    46729, 57456, 30260, 40589, 9334, 43949, 41121, 58232, 17533, 9433, 8916, 27026, 19246, 44435, 22241, 62908,
+    59803, 43325, 64410, 6249, 70436, 41344, 48557, 11491, 69330, 62062, 57468, 53549, 45504, 15193, 4724, 14411,
+    29833, 12168, 9556, 43281, 3745, 58683, 52797, 53819, 47244, 5050, 63360, 54897, 36276, 59618, 9594, 26607,
+    510, 18437, 6395, 55449, 24337, 55670, 14739, 42441, 22777, 13761, 37776, 3036, 33, 17398, 12346, 21058,
+    42910, 43668, 27902, 25490, 35802, 47533, 53265, 54313, 65888, 16946, 55922, 45209, 28081, 6640, 53234, 14889,
+    41370, 8102, 61846, 66779, 7316, 68453, 6577, 16381, 33068, 36951, 32253, 58650, 10276, 33837, 3789, 14100,
+    41392, 37213, 18091, 59139, 39743, 40268, 46362, 50352, 6190, 53200, 36828, 8632, 5096, 26005, 13818, 64716,
+    17783, 29147, 50740, 18536, 40269, 68802, 53201, 20776, 6496, 4968, 31617, 25180, 40148, 55918, 60442, 8285,
+    2230, 18864, 7665, 34203, 52665, 38260, 40018, 2368, 13854, 12330, 62975, 44883, 47221, 25426, 65903, 20743,
+    25524, 64593, 61818, 42614, 28555, 62665, 26262, 70102, 569, 49129, 11982, 41071, 27396, 28977, 1205, 37737,
+    38752, 56513, 43641, 69013, 59655, 6797, 60497, 26435, 3461, 9173, 33008, 23919, 42457, 62017, 12616, 34459,
+    57183, 54224, 55383, 16827, 26404, 66261, 31249, 17928, 48884, 20422, 51209, 52160, 32481, 38652, 54296, 21137,
+    14953, 63477, 1654, 32329, 69851, 53199, 58068, 27031, 15840, 27820, 65377, 53229, 40919, 12411, 7251, 4353,
+    20003, 35515, 3112, 39939, 9717, 19290, 55653, 31672, 29668, 48441, 25820, 21385, 47772, 43055, 45775, 42246,
+    12499, 20544, 17110, 54531, 37125, 51925, 62374, 33002, 7468, 61591, 68448, 54661, 62254, 9795, 15504, 3891,
+    30760, 66697, 15877, 50604, 59490, 66427, 12200, 11513, 168, 55576, 30332, 51446, 66303, 40372, 48325, 47466,
+    4810, 50742, 27122, 1757, 15056, 47761, 1215, 28219, 50651, 44446, 41866, 20561, 1934, 42936, 38801, 38062,
+    5983, 59199, 46320, 30635, 52562, 56958, 31474, 22559, 6551, 48967, 45163, 15795, 20075, 36201, 52292, 66489,
+    50527, 8975, 10479, 67445, 11202, 25208, 29251, 51816, 22708, 39633, 51148, 56645, 67556, 27455, 35978, 43354,
+    54599, 65502, 62649, 56402, 34966, 32932, 57010, 18007, 56306, 28476, 16290, 58386, 65861, 57086, 5945, 3804,
+    45608, 33318, 52654, 19334, 1810, 67100, 69214, 40470, 7615, 20268, 41047, 36028, 5759, 14842, 46687, 39588,
+    25825, 13304, 20399, 28961, 38927, 7938, 46555, 13702, 40476, 3908, 34646, 22080, 29004, 36840, 35095, 3694,
+    67502, 22184, 44290, 53561, 22384, 15964, 27972, 2709, 6927, 28395, 22279, 32308, 6892, 30574, 28872, 68283,
+    23206, 46288, 67717, 11778, 63306, 28086, 61187, 23224, 36236, 4578, 9702, 33116, 37945, 12736, 35202, 58245,
+    69352, 42589, 28431, 14353, 53256, 6018, 63768, 17689, 33600, 59865, 66058, 9577, 56273, 31043, 27802, 33736,
+    29993, 16490, 53643, 29035, 67135, 16825, 56628, 62682, 45921, 25534, 14718, 13263, 9112, 58339, 57128, 20677,
+    48741, 21197, 22483, 61727, 41185, 56140, 3368, 52826, 41308, 68037, 16970, 6317, 47235, 1455, 23661, 32059,
+    48818, 44856, 36806, 34409, 11663, 172, 31690, 62288, 36716, 11310, 47814, 34598, 64480, 1183, 10778, 62465,
+    58977, 2528, 13944, 34839, 44094, 36736, 58188, 7531, 66231, 54660, 22673, 33688, 47750, 27930, 17098, 61215,
+    56786, 58381, 66387, 51992, 22599, 24378, 46639, 65124, 23842, 67291, 64762, 68373, 1483, 28295, 55112, 31069,
+    48486, 50247, 18, 11950, 51177, 24824, 57398, 31144, 6844, 36886, 70010, 47225, 22861, 1412, 53543, 66175,
+    13498, 13342, 52592, 28305, 39603, 55133, 43063, 52164, 26516, 28757, 43745, 50565, 9667, 22830, 527, 61861,
+    43720, 52759, 70490, 9205, 52470, 55266, 23431, 42610, 18346, 27255, 64313, 68864, 47330, 7737, 43648, 37143,
+    14567, 1655, 68088, 69079, 18523, 9307, 23245, 35460, 18327, 31651, 25185, 65709, 55271, 53091, 64876, 25270,
+    58808, 19676, 23262, 63395, 61938, 34521, 30795, 44423, 41143, 54836, 25356, 33282, 29333, 18075, 50018, 34131,
+    31399, 50310, 21652, 43819, 62345, 29405, 45847, 7480, 25043, 57960, 56908, 14238, 32, 13580, 22743, 33764,
+    66761, 10418, 45772, 28702, 34703, 5119, 56252, 29290, 13720, 39812, 13153, 65693, 55244, 65210, 3967, 35328,
+    53427, 41169, 45403, 13839, 10363, 37508, 44239, 13532, 28121, 30450, 13194, 45365, 39549, 31053, 26318, 58012,
+    63569, 24843, 69874, 4821, 32830, 31735, 59752, 31417, 55107, 69711, 21122, 44380, 56570, 68284, 11668, 27024,
+    57337, 63482, 1769, 6807, 14963, 32170, 39496, 28504, 18822, 55081, 53390, 16748, 6578, 27999, 46327, 13396,
+    30615, 29500, 58363, 34802, 29814, 33415, 37478, 1650, 56219, 56803, 39798, 26659, 2137, 27703, 55242, 9254,
+    64503, 44934, 36583, 35702, 40127, 291, 18538, 44754, 14246, 18741, 39921, 46282, 39160, 68577, 14872, 32576,
+    49864, 61492, 21031, 33395, 34652, 58475, 39031, 38315, 44639, 29110, 28197, 34306, 64438, 35050, 8887, 39891,
+    26614, 61395, 2785, 19066, 25308, 58477, 64576, 43056, 34067, 25897, 6806, 55937, 39358, 14200, 34296, 15896,
+    45378, 47769, 48327, 37975, 12222, 43758, 39656, 10305, 33745, 68155, 35836, 3404, 52756, 43531, 54894, 39060,
+    20823, 11189, 12293, 5394, 31578, 42058, 58164, 11154, 31297, 31835, 32990, 68286, 41963, 37773, 51588, 42031,
+    49137, 2399, 34979, 37608, 66362, 65202, 35427, 27932, 43499, 19229, 46328, 54500, 16790, 51800, 12718, 58789,
+    23096, 33032, 48442, 46341, 17358, 39680, 48456, 23640, 35716, 10946, 43864, 4333, 7710, 46103, 19157, 51656,
+    47595, 43279, 17392, 15393, 24094, 68904, 26664, 45330, 29384, 45946, 43086, 52168, 46814, 30396, 11254, 47789,
+    27858, 921, 56934, 23619, 52349, 215, 68627, 666, 43594, 52535, 54770, 2252, 710, 27180, 16099, 49071,
+    36116, 54751, 34736, 27071, 50380, 69829, 786, 35662, 29560, 42967, 54937, 25264, 13698, 66580, 351, 36393,
+    13848, 65655, 36436, 31305, 28605, 44686, 67120, 23450, 64464, 51085, 22876, 44726, 6320, 14851, 10567, 64317,
+    63363, 63121, 60358, 30750, 48277, 63850, 17849, 24473, 48138, 38327, 40683, 42478, 25408, 35949, 49679, 24020,
+    31952, 3330, 15477, 17788, 9349, 57797, 22647, 15915, 65654, 14961, 30637, 36348, 47338, 50666, 10780, 67362,
+    31087, 23184, 48712, 46146, 4961, 10577, 67350, 17858, 5176, 68792, 18445, 53216, 19502, 166, 30947, 54824,
+    62712, 59934, 46350, 47119, 8780, 16786, 5138, 11823, 11001, 14369, 52913, 11658, 42974, 15203, 57611, 45625,
+    47597, 41901, 52899, 32074, 21994, 51576, 64675, 26529, 6637, 47373, 51056, 4392, 22761, 38494, 6617, 64371,
+    61963, 37409, 52712, 8796, 12618, 59649, 28417, 42442, 39677, 31600, 15033, 40795, 7910, 56943, 31029, 34004,
+    16003, 51727, 3374, 58443, 32779, 5749, 46469, 42824, 25670, 50308, 20296, 52515, 6219, 1210, 46308, 51598,
+    7831, 32002, 2117, 39911, 17490, 19723, 47030, 19963, 19692, 37740, 10360, 51808, 24258, 11348, 38467, 62281,
+    14949, 37024, 28201, 46663, 14691, 23757, 40871, 20986, 62923, 70459, 314, 15399, 46216, 11029, 4669, 24448,
+    3323, 57097, 57194, 18048, 29576, 65446, 33403, 58560, 36401, 31046, 66723, 66040, 10634, 38848, 18353, 51049,
+    2424, 13830, 27410, 59426, 28521, 59011, 6867, 35351, 39175, 10932, 5984, 59872, 62434, 24179, 63838, 50822,
+    36943, 36305, 45238, 19333, 628, 66786, 67164, 44594, 62964, 2302, 61602, 8064, 43016, 46272, 62213, 5322,
+    38206, 33967, 27112, 35928, 11748, 27291, 64390, 18265, 27486, 49594, 67245, 23295, 4345, 20832, 47065, 6407,
+    7453, 39311, 55627, 67265, 13029, 60774, 61066, 11076, 35782, 7830, 37438, 61278, 47485, 51004, 59757, 67281,
+    52419, 11363, 12844, 53906, 36107, 55390, 62275, 21735, 49664, 62272, 13405, 26273, 66581, 47333, 47146, 44172,
+    41049, 68505, 66924, 12166, 49181, 9575, 38904, 38170, 32143, 59144, 13412, 48636, 59685, 14208, 54142, 18694,
+    20665, 23467, 3085, 43502, 62367, 16931, 19904, 54160, 17426, 15508, 65892, 6954, 25674, 28345, 37992, 62983,
+    6689, 31253, 20108, 17786, 66418, 19274, 50097, 43770, 6426, 11174, 21987, 62473, 3820, 40217, 35950, 27216,
+    42965, 53163, 68196, 38215, 10530, 31077, 48934, 8023, 6278, 55486, 35634, 52401, 63773, 39220, 8169, 43072,
+    8401, 6498, 56832, 28894, 52704, 6733, 3609, 67490, 10457, 39581, 24021, 52883, 24115, 62248, 1983, 15893,
+    229, 52896, 5965, 59355, 20275, 46680, 1834, 47675, 7231, 26467, 2484, 66802, 56684, 18853, 59184, 17391,
+    12841, 19102, 4573, 5709, 12598, 8039, 69756, 22812, 7461, 33843, 38466, 49264, 17973, 31584, 63550, 61205,
+    45158, 12355, 45307, 52395, 55126, 36328, 9463, 50331, 16240, 16719, 7553, 3152, 44774, 46884, 50414, 65347,
+    55243, 65704, 50153, 9060, 31868, 7838, 31747, 58229, 23807, 63239, 33386, 13500, 64887, 38893, 54428, 24051,
+    35198, 28629, 41722, 42404, 60759, 55257, 40139, 38058, 40202, 8063, 34108, 17554, 30849, 61570, 23421, 10672,
+    37822, 66308, 23247, 2651, 59861, 34052, 42860, 31208, 5555, 33423, 63541, 23780, 38107, 56609, 38947, 64780,
+    58098, 56101, 13811, 40631, 55657, 37451, 62492, 27322, 5120, 69972, 34138, 40944, 42503, 21353, 38078, 63287,
+    39729, 40680, 48034, 26977, 33265, 5353, 55835, 21781, 52969, 66603, 6255, 62786, 15255, 40838, 7277, 27346,
+    62769, 34728, 6871, 45586, 59250, 34857, 53465, 39040, 54026, 21574, 29989, 46289, 27208, 65073, 17754, 12496,
+    38881, 35259, 9787, 68828, 44898, 50676, 1362, 63721, 67697, 12472, 22670, 69579, 49349, 35686, 12164, 2951,
+    18950, 29160, 25273, 36226, 22480, 37372, 7508, 13707, 52499, 65043, 3696, 12046, 14890, 17761, 29300, 25049,
+    5183, 50920, 46128, 51738, 2990, 49227, 5460, 55915, 62243, 63196, 3775, 14997, 46053, 30506, 8690, 52098,
+    1664, 35943, 18620, 8201, 1328, 6473, 38739, 24765, 55421, 24397, 53232, 37235, 41155, 55821, 26329, 1399,
+    37443, 22446, 3527, 55966, 8040, 68748, 62097, 57749, 8154, 60188, 64103, 11473, 30356, 60098, 25662, 31737,
+    40441, 67153, 44386, 1529, 51140, 6272, 2686, 9662, 48126, 4627, 70375, 26792, 56651, 46544, 30072, 62112,
+    2991, 65691, 40670, 19458, 50810, 19644, 37142, 24930, 66853, 44847, 25028, 20733, 8239, 64821, 12368, 27889,
+    12577, 17667, 52615, 43495, 43689, 52020, 17929, 18830, 30063, 11307, 33268, 18276, 55460, 43250, 18251, 57924,
+    6558, 63443, 6580, 20770, 45779, 9848, 26876, 16684, 58653, 48847, 68720, 30411, 45732, 29187, 52110, 45976,
+    57725, 65975, 11679, 44579, 4362, 67823, 64138, 47738, 38109, 15104, 36524, 38276, 54537, 7638, 48076, 4165,
+    3034, 14106, 40033, 46894, 4766, 68776, 65448, 58057, 56008, 43074, 30775, 47792, 25881, 53346, 18805, 52659,
+    67436, 54299, 25931, 41445, 26402, 58755, 4211, 31914, 33649, 65525, 62995, 37480, 34363, 70225, 37349, 38653,
+    4457, 67030, 56807, 67412, 21514, 15496, 20032, 34177, 29627, 18865, 23112, 25955, 27034, 25969, 54935, 17978,
+    31408, 44697, 56044, 11325, 22242, 56080, 11664, 40335, 24104, 6977, 37460, 35044, 47280, 7166, 45471, 31172,
+    26987, 51365, 67180, 40753, 14840, 19340, 12760, 18681, 36314, 46486, 42188, 25790, 15506, 63028, 23345, 67681,
+    57073, 12729, 23522, 66901, 54341, 52012, 1108, 65262, 28325, 35289, 23154, 52312, 46435, 32762, 33353, 4944,
+    63284, 21315, 28498, 36955, 43346, 36714, 31289, 33076, 21480, 25129, 14044, 54956, 26830, 28502, 38167, 41487,
+    60887, 12935, 27452, 14167, 1502, 29219, 14823, 23503, 56363, 34345, 55077, 66104, 38192, 16054, 6800, 14970,
+    33381, 96, 21437, 65280, 7350, 55408, 55139, 10489, 62771, 36678, 47943, 33696, 10770, 9802, 33385, 53680,
+    61042, 9178, 37525, 70222, 10664, 992, 9681, 32993, 1010, 17669, 53188, 17847, 6971, 56775, 9743, 30375,
+    49829, 23761, 42721, 43017, 17838, 37313, 64617, 30836, 26506, 55328, 6328, 15725, 19819, 62678, 62406, 63552,
+    10501, 32817, 66573, 65306, 22631, 16365, 34060, 30251, 54138, 65551, 67970, 36235, 31012, 11896, 23601, 29395,
+    26872, 37617, 60872, 68725, 55232, 704, 14463, 70083, 6974, 27427, 58633, 65325, 35381, 31596, 39946, 36394,
+    51073, 39421, 6656, 67832, 16058, 27876, 7959, 44196, 60955, 3479, 39142, 65386, 47558, 1613, 16975, 43893,
+    49568, 36389, 27724, 65565, 26347, 31379, 38132, 50815, 2776, 30273, 55816, 63290, 46702, 955, 15824, 49517,
+    63460, 22915, 24951, 60226, 32337, 50602, 35803, 21374, 27099, 55041, 13303, 9646, 57265, 12103, 29689, 58515,
+    27401, 37963, 33001, 51904, 18419, 58750, 20412, 14187, 25506, 30427, 62184, 49909, 44066, 30418, 805, 64839,
+    5360, 20864, 14000, 10445, 67207, 5348, 35754, 14028, 46708, 32617, 57263, 44056, 64828, 56928, 69121, 24929,
+    20951, 44210, 26910, 4485, 67831, 35961, 4508, 45498, 49848, 62611, 49471, 19637, 4499, 13470, 60918, 28047,
+    57004, 39492, 39968, 6133, 59813, 26046, 56573, 22005, 30582, 16486, 41724, 21498, 15395, 33624, 41637, 36482,
+    57959, 60026, 69123, 24808, 25040, 8979, 17341, 20611, 44751, 66662, 7306, 43897, 52050, 10565, 56541, 4352,
+    57583, 13690, 2643, 33550, 46551, 54616, 22406, 30480, 42282, 1121, 1924, 57528, 6359, 51223, 10455, 69570,
+    53241, 54911, 25781, 4233, 67290, 38234, 240, 23573, 7817, 56408, 21849, 49265, 5948, 14703, 17759, 7548,
+    58458, 16411, 36184, 23723, 59013, 51211, 67531, 42879, 44347, 8587, 48003, 21942, 12094, 34858, 1329, 69740,
+    17114, 2000, 37543, 62412, 16568, 16443, 56884, 48558, 40376, 4153, 54980, 4790, 26302, 36136, 49918, 53898,
+    30852, 18800, 34505, 13786, 70257, 16612, 21971, 21107, 16734, 12530, 38916, 13899, 62235, 48926, 31422, 3989,
+    45325, 27574, 61041, 25008, 11897, 36562, 24197, 30770, 3561, 13714, 11938, 77, 2392, 67136, 3512, 43507,
+    45931, 27327, 8900, 19466, 49398, 43123, 43423, 35452, 54266, 20620, 40276, 25060, 26300, 25390, 42400, 43918,
+    55327, 64699, 5673, 31949, 57958, 4041, 36002, 30458, 22248, 30620, 28723, 2769, 27141, 29227, 19283, 44215,
+    10869, 33180, 29293, 64233, 29205, 45257, 31609, 44987, 25949, 4194, 65544, 52948, 18302, 870, 14936, 35745,
+    22000, 38105, 24429, 33454, 48913, 44312, 11925, 49538, 68092, 43163, 19818, 38559, 48113, 68483, 56158, 11585,
+    59242, 7555, 56982, 636, 14089, 33220, 59972, 66616, 46427, 25280, 38018, 60889, 13731, 19984, 57397, 712,
+    8033, 57450, 28407, 69578, 26465, 49274, 69550, 58608, 12433, 29409, 20479, 44653, 59456, 23357, 26137, 16838,
+    68593, 35117, 42856, 22765, 55416, 59683, 17821, 51955, 31376, 7761, 23268, 30216, 46281, 61496, 13068, 46988,
+    3585, 49956, 15198, 17238, 699, 24384, 57205, 66029, 58529, 57900, 16668, 44695, 21726, 64374, 1545, 68013,
+    67724, 53375, 47005, 21491, 55279, 14415, 8633, 69103, 35069, 64516, 30687, 17320, 30492, 34746, 45839, 55963,
+    18067, 56868, 2016, 54793, 66932, 20545, 23750, 62765, 38996, 18927, 28332, 18957, 19448, 42185, 17178, 40917,
+    30925, 34976, 7104, 19171, 50428, 25116, 40076, 23209, 4730, 3302, 21360, 22583, 5357, 16610, 2327, 21564,
+    30097, 28485, 61860, 45091, 46784, 46403, 13471, 54675, 1195, 57181, 67360, 32590, 2370, 16604, 52095, 28583,
+    63441, 57902, 66663, 38660, 67687, 36902, 32708, 10337, 10681, 53994, 46566, 587, 63520, 27969, 36119, 32410,
+    40173, 54939, 48698, 44139, 14981, 63350, 56937, 9922, 56590, 48736, 28288, 15206, 11895, 32286, 54902, 49971,
+    44681, 16242, 39658, 69371, 53354, 11511, 61183, 36651, 56224, 470, 29825, 23135, 32946, 29541, 70255, 16225,
+    69155, 63446, 39319, 36067, 6781, 26119, 6969, 38896, 51280, 58735, 37246, 34101, 53290, 50099, 16335, 59280,
+    64333, 39189, 8894, 56471, 35199, 63748, 49021, 3425, 2158, 21852, 26765, 19769, 12132, 9801, 44159, 66244,
+    39925, 46352, 979, 13388, 56246, 39352, 51193, 56182, 39140, 1301, 38050, 18406, 41633, 62445, 35581, 24698,
+    37236, 37620, 14064, 24301, 38384, 50773, 51001, 59737, 49295, 34335, 49288, 35045, 32241, 11563, 14212, 25023,
+    31559, 66591, 36725, 63047, 51885, 68928, 20382, 24460, 39320, 9493, 24695, 8061, 8893, 6526, 67184, 2928,
+    38783, 23558, 2461, 6060, 10153, 32677, 19338, 48807, 40151, 5808, 41641, 55714, 51806, 10823, 5740, 14456,
+    68265, 53333, 2207, 9798, 55680, 36706, 39127, 29122, 28621, 45788, 24088, 22179, 30973, 56250, 24347, 66383,
+    10139, 64280, 51343, 22416, 64731, 12597, 8912, 67528, 59421, 10494, 62697, 1098, 38792, 59829, 36042, 24738,
+    24193, 16097, 67101, 3307, 46037, 7635, 56174, 31876, 54379, 17625, 68127, 9001, 63058, 49174, 25368, 328,
+    22689, 16949, 5912, 13107, 55249, 27788, 67865, 18396, 30232, 51996, 17574, 57728, 10812, 63111, 1232, 68432,
+    17734, 59258, 50362, 55769, 42460, 22305, 15576, 23825, 29960, 3210, 15970, 411, 27937, 59440, 59236, 3129,
+    5672, 16325, 27668, 31775, 14195, 50405, 11036, 22498, 22619, 6206, 18900, 5823, 1856, 39022, 57126, 21214,
+    27110, 47494, 59268, 25961, 12461, 21885, 22687, 40161, 61319, 8530, 54583, 7479, 32045, 29101, 65173, 31794,
+    1355, 34644, 40934, 47763, 43505, 1366, 62350, 15708, 8769, 30221, 9995, 31180, 63630, 14254, 53338, 14943,
+    52118, 14079, 38802, 54281, 6598, 62667, 57778, 52691, 31320, 9134, 50210, 49727, 7285, 29655, 10158, 11132,
+    62169, 2479, 34246, 438, 32155, 54685, 7666, 10661, 2034, 51562, 28488, 37288, 18784, 54642, 46662, 22363,
+    47075, 20474, 61246, 6467, 21099, 21171, 33241, 8137, 11343, 1861, 40691, 12254, 40517, 27397, 52739, 37009,
+    54962, 24593, 34729, 19764, 36245, 48511, 49633, 10894, 32996, 23869, 67820, 33630, 3115, 16483, 30771, 64823,
+    1692, 51910, 21560, 4422, 24373, 31701, 469, 66903, 28739, 10911, 27271, 34686, 63574, 47620, 6114, 7499,
+    32806, 39976, 14209, 65713, 27220, 5880, 27214, 41992, 30220, 64786, 35187, 51823, 59057, 53050, 48693, 33547,
+    4976, 26186, 30111, 35318, 5313, 48268, 21497, 43399, 331, 69993, 6573, 39785, 60689, 52393, 40283, 68165,
+    61432, 60434, 22959, 16958, 65616, 37186, 22523, 50442, 53813, 62364, 58829, 1804, 21525, 19429, 57656, 17717,
+    36493, 2045, 37917, 28140, 30125, 16017, 14261, 13377, 4347, 33253, 40603, 31875, 38241, 56637, 34389, 27408,
+    18175, 35947, 30861, 23103, 47331, 49655, 63197, 33946, 38240, 62683, 30935, 3103, 56957, 54448, 3179, 28907,
+    32099, 56388, 25298, 48090, 50975, 68733, 30877, 24651, 17580, 8292, 16831, 2445, 29235, 26227, 2157, 42256,
+    23713, 9281, 47212, 43115, 38282, 39372, 56353, 37300, 47350, 57157, 262, 43028, 37877, 67461, 25403, 35622,
+    66818, 64315, 11084, 53551, 61394, 23539, 28068, 8593, 45654, 48912, 11643, 38031, 64296, 65378, 60476, 7132,
+    49968, 52418, 20860, 5806, 17406, 9374, 59966, 8294, 29005, 7298, 46378, 1842, 3174, 64025, 45463, 43146,
+    7399, 17344, 34166, 5895, 13448, 8495, 6047, 57503, 22813, 23155, 57302, 47422, 70483, 37688, 27626, 28799,
+    5885, 21740, 53296, 65847, 59463, 24169, 13232, 66670, 51870, 60131, 45743, 24788, 19436, 15160, 59486, 64467,
+    41465, 8761, 59605, 28195, 65910, 7978, 1200, 32516, 65771, 53946, 24871, 63801, 22043, 15921, 55547, 55725,
+    40955, 18299, 30908, 12826, 5236, 15433, 58996, 67399, 11295, 41582, 44953, 1323, 16671, 57191, 64911, 58803,
+    48177, 35974, 65295, 9782, 59425, 44520, 25472, 28673, 9586, 63794, 53959, 21196, 9430, 51810, 50171, 38433,
+    63735, 62718, 46950, 59961, 47130, 31453, 26608, 25168, 27087, 64753, 58318, 1656, 58606, 11581, 30897, 17456,
+    41418, 52210, 51599, 17617, 43138, 43756, 24661, 53703, 42136, 33831, 33347, 31977, 38767, 28925, 5517, 22655,
+    61843, 18574, 2520, 65560, 58594, 42094, 16129, 17085, 3930, 55814, 50811, 38521, 69220, 63407, 59537, 35703,
+    45385, 3252, 26633, 35361, 3473, 34993, 48321, 27012, 57290, 37514, 31388, 61381, 54848, 1506, 3410, 6745,
+    26965, 17067, 3016, 13933, 39577, 40687, 61594, 20195, 65179, 28388, 53524, 24312, 60838, 27541, 63692, 39813,
+    12682, 64625, 69188, 7385, 20128, 65175, 45810, 7044, 60447, 22212, 40529, 11954, 4545, 16703, 13711, 8435,
+    36921, 4525, 57169, 25577, 64511, 68507, 33652, 51948, 60753, 4753, 53063, 758, 14020, 45372, 57727, 6449,
+    70291, 56389, 25586, 51102, 45687, 10315, 65647, 47642, 38504, 20102, 9165, 34531, 18468, 40466, 59072, 47987,
+    20445, 60359, 36133, 41099, 26387, 42688, 57618, 34871, 1994, 36454, 12850, 61931, 43448, 61575, 68757, 55626,
+    13317, 49401, 29679, 35406, 2463, 54883, 7014, 59494, 31130, 36113, 68669, 18295, 44000, 30759, 12479, 50948,
+    42717, 25625, 61675, 15686, 5405, 52226, 13932, 32145, 17765, 64405, 62211, 38401, 52598, 20847, 58069, 35349,
+    51287, 14319, 52855, 13564, 11085, 789, 67655, 29388, 45673, 36846, 17128, 22019, 21796, 46705, 67361, 52442,
+    47536, 45999, 69202, 46969, 60367, 60020, 52947, 15523, 33578, 46513, 34973, 15003, 35417, 36022, 9076, 25846,
+    14508, 40516, 41019, 50096, 22625, 17757, 19540, 67749, 31906, 60418, 5939, 37988, 6513, 41595, 34741, 47898,
+    62692, 66980, 20711, 25412, 16672, 36516, 48653, 9761, 46043, 23336, 58463, 49031, 16537, 50901, 2698, 19144,
+    42320, 14040, 49799, 59755, 8069, 22715, 24119, 9966, 20926, 64153, 27931, 64627, 25998, 58454, 20371, 36466,
+    30426, 50368, 20204, 52437, 28571, 50476, 6282, 43155, 36134, 61406, 68213, 15226, 27070, 23836, 38407, 6065,
+    15323, 61608, 17576, 59973, 54794, 27887, 22711, 4644, 58777, 21686, 30621, 34949, 56735, 23430, 63451, 29742,
+    13316, 27440, 67499, 20342, 29910, 26011, 10840, 51846, 46903, 36728, 26556, 63992, 45860, 34991, 36893, 897,
+    3843, 46638, 63039, 33692, 59642, 48147, 44814, 35325, 37507, 25519, 37109, 32252, 30815, 2977, 1227, 70053,
+    45397, 23369, 62721, 28985, 57638, 53035, 51536, 35399, 38224, 55673, 39731, 30008, 4418, 5395, 21441, 19401,
+    966, 38699, 24399, 58770, 51835, 30502, 61990, 24750, 43972, 27723, 30827, 6016, 28532, 33123, 46605, 62011,
+    7313, 65701, 48733, 18844, 15191, 63462, 8037, 11789, 40051, 32372, 49754, 7836, 40297, 7723, 34123, 65082,
+    23223, 60446, 30940, 67112, 15023, 18906, 40561, 61553, 41269, 53773, 15078, 19977, 53548, 18367, 8238, 60660,
+    31542, 62993, 21006, 53038, 49477, 59041, 17428, 29982, 18195, 28740, 55869, 24679, 60128, 29443, 33590, 41414,
+    3650, 51178, 20272, 45038, 13770, 23530, 56399, 60566, 12535, 56730, 29795, 45803, 41281, 33090, 40035, 16336,
+    34165, 51302, 10229, 58356, 24563, 26681, 42566, 42771, 931, 28461, 7160, 45277, 70415, 5163, 16263, 38142,
+    47527, 60750, 20872, 30727, 62258, 61537, 68568, 67438, 69025, 51541, 15079, 3621, 34800, 101, 34694, 17185,
+    46865, 36822, 46199, 63264, 35500, 4470, 59954, 19909, 63601, 40478, 66861, 55590, 42081, 42443, 16257, 51618,
+    64512, 11285, 63922, 51876, 35821, 45249, 55611, 63728, 27670, 35433, 10542, 44604, 22588, 45934, 52299, 942,
+    2431, 26580, 70192, 6015, 16235, 26640, 22590, 45633, 44608, 58089, 22640, 55255, 19226, 304, 35022, 41087,
+    20944, 26617, 18492, 62867, 63633, 35071, 17508, 61530, 31221, 30979, 29504, 16165, 28599, 60067, 20235, 10573,
+    30445, 1173, 39019, 28520, 128, 45228, 895, 21766, 37647, 18163, 52877, 69990, 16072, 62752, 64982, 68436,
+    10359, 23099, 57414, 61403, 4099, 12822, 62331, 53136, 32906, 4721, 11277, 30308, 34230, 15394, 30562, 22359,
+    41570, 50280, 14742, 45542, 23055, 43232, 44971, 3928, 52767, 12080, 11917, 46391, 61280, 2637, 48358, 14215,
+    1448, 47460, 44584, 68180, 22748, 17570, 25194, 17135, 14548, 9564, 16957, 39867, 8627, 21729, 42994, 26881,
+    32607, 41270, 33628, 35585, 55961, 34672, 29126, 26586, 47867, 15542, 58372, 30352, 21468, 68763, 22484, 36266,
+    41404, 35102, 2196, 9902, 50240, 42448, 22007, 22967, 22604, 52390, 43062, 3713, 53787, 70281, 32047, 20519,
+    52501, 65157, 42439, 39009, 29746, 19774, 28364, 22131, 53930, 47461, 1146, 10154, 55820, 63265, 69293, 39568,
+    12224, 57911, 8697, 40530, 53379, 11196, 56143, 19164, 27896, 66438, 2349, 61024, 1115, 38084, 64449, 4850,
+    7449, 36685, 61438, 10196, 49981, 31618, 8551, 67685, 57840, 14255, 22317, 38006, 37191, 8303, 13414, 11251,
+    14863, 56634, 15220, 27151, 48886, 49416, 54183, 29871, 34519, 63231, 17899, 26192, 53886, 9726, 7805, 6297,
+    62296, 8429, 66150, 61612, 21349, 3653, 22850, 24475, 27301, 61378, 11266, 61734, 13074, 36308, 67381, 23880,
+    47382, 52143, 63193, 66057, 33078, 67639, 17882, 47343, 8891, 65755, 6377, 59658, 6860, 59091, 33640, 50601,
+    43544, 22521, 49774, 7916, 51059, 41953, 16594, 54514, 38589, 61131, 58793, 55324, 27803, 35914, 52001, 11419,
+    58216, 46673, 63161, 24792, 62111, 28867, 63320, 69526, 45417, 45643, 17902, 25945, 64794, 46957, 26315, 47179,
+    26630, 67597, 7642, 994, 44547, 12523, 4187, 53082, 53932, 4698, 65600, 11159, 19528, 40309, 34227, 62328,
+    43584, 37426, 46164, 3464, 60431, 3974, 43497, 19499, 18059, 23603, 22489, 11735, 43337, 7041, 35698, 28376,
+    6810, 68762, 6828, 33343, 59442, 51409, 2217, 28130, 60778, 8233, 45491, 49877, 47688, 48749, 5448, 50252,
+    37373, 68529, 41122, 61240, 31736, 5918, 14576, 65984, 37903, 69809, 45710, 60961, 32122, 20350, 20984, 62669,
+    35896, 8375, 30043, 37841, 65161, 63122, 51568, 18222, 6641, 29452, 5602, 55717, 12548, 54195, 50788, 31246,
+    42471, 24821, 62607, 25892, 36343, 63421, 2937, 27252, 40194, 34879, 2512, 44927, 12172, 51156, 51529, 34594,
+    31553, 65631, 55099, 39119, 68039, 66178, 65367, 7897, 21264, 34523, 18470, 18519, 64846, 47434, 17024, 39675,
+    21871, 40477, 19209, 36213, 28315, 47976, 20566, 34066, 66951, 61150, 48989, 16862, 15405, 50069, 25686, 45794,
+    3116, 25714, 14256, 55373, 23844, 53413, 65345, 5104, 63359, 9024, 29503, 25893, 49158, 39100, 24530, 68320,
+    34109, 33101, 63914, 8874, 40402, 52133, 67996, 48696, 25372, 43887, 52991, 66107, 33235, 45656, 61568, 28644,
+    49027, 35895, 28263, 41791, 63994, 64127, 46907, 10393, 39213, 15492, 38376, 33753, 64693, 33466, 30604, 3888,
+    67732, 60662, 48014, 54559, 16808, 63474, 29079, 66461, 9993, 9137, 65561, 50191, 10317, 24025, 9466, 60449,
+    59760, 9347, 34217, 38786, 5836, 19775, 46020, 42723, 52127, 24303, 38674, 3080, 56329, 27036, 33812, 31389,
+    63865, 40511, 42651, 39643, 64540, 46373, 33786, 27576, 55757, 35305, 30113, 15688, 30424, 59330, 26680, 60036,
+    42463, 24889, 2823, 63027, 8424, 37492, 35559, 51218, 25400, 6929, 21519, 13260, 45366, 18972, 58163, 3770,
+    69076, 58028, 4271, 50881, 44464, 24368, 14556, 54644, 53816, 19581, 18333, 23039, 44758, 16357, 25913, 21247,
+    35866, 12328, 10133, 67842, 6934, 30187, 28508, 50738, 68103, 46178, 14294, 841, 6936, 12063, 59611, 67006,
+    28968, 46838, 11328, 45964, 47695, 31095, 55931, 1718, 67695, 47211, 66602, 61920, 38181, 54489, 12002, 58377,
+    62026, 40931, 40356, 42977, 40946, 40346, 53194, 23214, 25905, 10239, 41767, 41375, 625, 22688, 4945, 42371,
+    27134, 28578, 29299, 16128, 26067, 26549, 11215, 51887, 43682, 7594, 42048, 15567, 36500, 66998, 51813, 37757,
+    48149, 28565, 32821, 12112, 14494, 11107, 60278, 13034, 40933, 46090, 555, 22369, 60896, 40111, 8361, 9846,
+    11637, 15521, 62895, 42972, 53455, 29051, 15916, 10467, 63152, 31061, 1520, 45081, 67851, 42432, 46155, 7197,
+    50928, 1643, 21158, 42249, 228, 69967, 15424, 21728, 50441, 67786, 58096, 58374, 65480, 23208, 25254, 5588,
+    19133, 34786, 42744, 18834, 977, 22571, 68517, 62484, 64559, 32409, 19254, 3862, 40559, 31926, 23076, 11241,
+    67219, 64851, 40506, 22027, 66323, 47260, 7159, 44205, 50608, 12044, 68737, 30428, 47172, 21968, 16771, 25042,
+    6765, 20833, 44445, 64707, 39299, 62016, 33776, 4705, 23846, 52280, 5402, 28231, 16489, 10406, 47380, 45812,
+    36618, 32018, 19927, 2233, 29424, 14151, 31354, 13680, 36718, 41726, 43212, 3312, 32419, 67466, 43804, 56534,
+    44237, 28888, 47258, 24227, 18581, 23394, 16431, 33161, 62144, 68382, 29025, 43986, 63129, 36250, 57258, 16249,
+    15017, 45521, 1908, 47424, 2454, 34535, 41523, 2792, 6020, 9408, 1949, 8418, 49425, 28406, 25102, 55748,
+    27048, 16122, 53857, 38517, 32804, 69599, 13228, 58365, 57388, 56411, 18485, 26429, 45154, 16137, 102, 24160,
+    57044, 41282, 21547, 42129, 5235, 2227, 59641, 16330, 42440, 25084, 67190, 27867, 24823, 60062, 24545, 64526,
+    61731, 26917, 19213, 20332, 17035, 42222, 13333, 35564, 11134, 30190, 21629, 15413, 31741, 51251, 42512, 24431,
+    22372, 10797, 655, 28950, 19584, 25934, 62014, 4381, 24903, 61339, 21966, 7498, 34561, 63818, 26807, 56450,
+    52649, 66309, 56742, 31951, 48323, 49216, 46451, 58241, 37870, 64775, 47370, 67319, 39585, 36986, 40876, 15591,
+    5354, 46585, 47252, 69461, 5231, 10905, 69548, 43141, 57485, 13253, 19763, 30052, 38671, 13841, 36131, 49444,
+    39948, 13952, 12226, 1641, 44763, 21123, 1877, 49651, 29723, 42140, 64078, 69435, 25930, 21113, 23953, 16979,
+    33953, 19169, 51043, 7207, 34584, 5098, 41145, 20165, 59900, 54129, 11012, 61027, 55393, 583, 32634, 5934,
+    64654, 42896, 37915, 33905, 5492, 36726, 61867, 60268, 32167, 61618, 32389, 18345, 19289, 67419, 5133, 19230,
+    38204, 14882, 2048, 5383, 54092, 9806, 28540, 63102, 15774, 46491, 59805, 52888, 28514, 11122, 25951, 68998,
+    36698, 1085, 57814, 40129, 12194, 67780, 9442, 37748, 49104, 65288, 47520, 67409, 54119, 39706, 36627, 7249,
+    61625, 39949, 16945, 39773, 34668, 16829, 24080, 14010, 45115, 36150, 6276, 22389, 5615, 877, 69642, 7847,
+    8117, 33792, 32875, 60328, 60399, 57476, 9745, 59205, 64807, 29779, 31755, 50410, 42009, 21148, 35527, 60874,
+    14412, 32530, 70545, 67142, 16816, 43198, 26450, 20555, 4131, 67309, 28184, 21294, 8415, 50935, 7322, 16918,
+    66679, 5282, 5676, 68364, 29565, 4926, 44885, 65748, 7953, 3682, 24907, 55494, 15475, 33110, 39359, 23341,
+    29674, 5326, 21809, 33704, 50034, 45574, 14036, 9530, 10324, 62450, 42671, 23118, 20505, 23683, 5784, 18818,
+    19722, 5822, 67464, 39196, 62387, 21588, 39109, 61809, 14322, 42065, 21950, 36121, 54363, 51190, 245, 36595,
+    46457, 32431, 18884, 50785, 17498, 51865, 20419, 69743, 40110, 65498, 63001, 27700, 57312, 63840, 47929, 69029,
+    65307, 68540, 27642, 55553, 554, 52973, 67797, 20682, 21999, 30203, 39851, 68296, 42637, 68266, 51674, 51404,
+    59151, 15453, 58228, 37493, 28815, 2974, 31486, 31708, 54952, 38424, 38321, 64222, 39094, 22093, 51561, 55106,
+    30013, 33494, 61442, 42361, 19332, 6336, 67096, 42875, 45384, 45000, 10310, 28917, 32599, 22272, 33939, 63610,
+    7348, 68524, 4515, 46832, 7040, 56420, 10648, 62290, 58959, 14299, 32150, 40100, 66874, 20477, 15741, 10795,
+    56295, 63846, 31150, 66085, 62929, 22822, 60471, 6789, 46575, 34371, 56454, 15821, 36232, 25282, 54724, 37428,
+    68306, 42043, 47783, 47000, 3180, 35574, 56097, 59585, 31770, 10338, 42210, 28678, 42192, 23717, 51730, 28982,
+    44636, 24112, 8188, 30277, 39755, 9089, 42066, 31853, 51181, 44760, 15961, 360, 17148, 38450, 31718, 16234,
+    38284, 47911, 30569, 43503, 29454, 26219, 37721, 43099, 11429, 31870, 44673, 65811, 16826, 50715, 8702, 19121,
+    19955, 2357, 62621, 43149, 13687, 25494, 14708, 60216, 16104, 37435, 47821, 67762, 14386, 13640, 37940, 6858,
+    53539, 63319, 13162, 10395, 45693, 54925, 10931, 30409, 24231, 38500, 45641, 41082, 17970, 26563, 1478, 39485,
+    33757, 53039, 11081, 12093, 45958, 27592, 10101, 44340, 800, 47176, 24408, 62819, 43651, 69814, 46635, 11229,
+    26582, 14854, 40098, 8236, 46342, 52581, 48154, 2231, 129, 26540, 58773, 40307, 44207, 46492, 60204, 64686,
+    48763, 3294, 56131, 61068, 63668, 13123, 70293, 12485, 31423, 16885, 44996, 8252, 40515, 41064, 39527, 22873,
+    63879, 13735, 47008, 19754, 60832, 17697, 60267, 5062, 29649, 7721, 59739, 70253, 323, 51762, 62477, 17117,
+    64167, 46415, 62755, 70171, 8145, 45031, 10750, 24440, 13072, 29, 47785, 2428, 18478, 49993, 67093, 22970,
+    27489, 39666, 5421, 48132, 41752, 70492, 47275, 8423, 41834, 11249, 9421, 17989, 13259, 25611, 61194, 64206,
+    2355, 24888, 29786, 45662, 44275, 13075, 26751, 7043, 32718, 6058, 15159, 69854, 21184, 12441, 33162, 1017,
+    11692, 7512, 65538, 49402, 70191, 9672, 21521, 33108, 27015, 38626, 65781, 53436, 70063, 20092, 29953, 21318,
+    49778, 40475, 68993, 34135, 22028, 65979, 8646, 17036, 2320, 29049, 44295, 32864, 35524, 13178, 14252, 42790,
+    49645, 36499, 66335, 46980, 25317, 18579, 3715, 10884, 12923, 15798, 66459, 6438, 51381, 49990, 10178, 28322,
+    54125, 37280, 9741, 12214, 50207, 42947, 54438, 45101, 20517, 19562, 9424, 36452, 12816, 47728, 42038, 16791,
+    62600, 52575, 37997, 51291, 20031, 39779, 31760, 8315, 50534, 18189, 3245, 60646, 38066, 38917, 38988, 31677,
+    46987, 66108, 55511, 24446, 9506, 48770, 447, 62133, 1649, 66350, 7867, 57235, 61706, 27104, 19507, 36739,
+    50325, 63302, 44021, 58021, 39225, 49055, 16169, 64661, 5541, 66827, 24795, 8546, 31256, 58953, 41266, 51341,
+    50525, 23900, 23452, 54866, 57420, 45757, 25941, 69156, 51305, 5940, 36050, 57542, 10281, 55583, 4677, 37886,
+    39829, 55651, 13341, 27613, 7661, 27434, 55844, 37743, 56053, 2870, 44889, 25847, 53871, 61598, 21909, 23536,
+    22610, 28953, 33519, 13344, 30420, 57843, 65123, 2916, 26636, 8562, 7946, 14836, 32370, 39509, 2165, 54467,
+    56791, 52003, 12099, 45591, 13484, 63749, 37071, 68914, 68884, 35303, 15402, 39371, 26722, 42673, 3787, 9695,
+    46821, 63464, 55308, 3239, 30839, 54059, 69500, 65362, 34184, 46120, 32311, 7271, 49105, 63487, 20663, 35965,
+    44778, 3859, 39129, 14955, 61885, 7706, 36676, 3520, 8888, 6252, 35432, 64589, 60770, 54397, 10355, 45344,
+    38145, 65800, 18403, 37746, 56270, 4479, 54247, 6422, 34341, 64109, 41652, 23967, 15800, 35226, 70454, 11550,
+    60599, 14027, 40880, 40932, 66122, 62201, 64987, 53880, 63220, 14420, 20959, 62688, 1401, 727, 34962, 36643,
+    22574, 54667, 42231, 67315, 22213, 575, 26963, 7326, 26993, 41977, 10304, 11549, 27192, 9411, 46740, 24230,
+    17518, 62657, 10838, 56640, 68834, 44220, 34171, 23044, 5044, 30547, 3009, 33536, 36702, 28107, 61645, 9098,
+    22255, 67751, 37561, 45075, 23605, 43825, 43586, 58842, 31044, 16047, 8933, 14683, 59518, 16444, 5858, 33149,
+    49939, 57165, 67747, 1309, 67565, 43012, 36351, 558, 26353, 18025, 8934, 40622, 61551, 27795, 65681, 32172,
+    70505, 34892, 49029, 14104, 11854, 61636, 15324, 69082, 39028, 9500, 8123, 60465, 61803, 30553, 46757, 19140,
+    43135, 9721, 51279, 57489, 48533, 16506, 25835, 4943, 6607, 58526, 18954, 50991, 7895, 36647, 41005, 20225,
+    23294, 28340, 60519, 58671, 19247, 31958, 27894, 57341, 53937, 65529, 14831, 56956, 15606, 41084, 29550, 68089,
+    47054, 33267, 13921, 39705, 68882, 3564, 59344, 28517, 13792, 22933, 21590, 13397, 21359, 49359, 67109, 29446,
+    55805, 61086, 1125, 68184, 22938, 28973, 32658, 64531, 29552, 51486, 2472, 30697, 17386, 52803, 19107, 22824,
+    60922, 22512, 33126, 61444, 9160, 21279, 28863, 55798, 48129, 39336, 11203, 53944, 13858, 23021, 44359, 53431,
+    36813, 14560, 8498, 68051, 38040, 67537, 46521, 20283, 23502, 9648, 60340, 67934, 45515, 16572, 41895, 10174,
+    22301, 2644, 56160, 37158, 6127, 49737, 44637, 69624, 51645, 19509, 69886, 45122, 35823, 9864, 31761, 43251,
+    55981, 34279, 59731, 17722, 47477, 17309, 52925, 54679, 29722, 29979, 4264, 17589, 11370, 8336, 10407, 29108,
+    3744, 41954, 38643, 2561, 39504, 12354, 9203, 55284, 43013, 4962, 55104, 58039, 7912, 57553, 56603, 25987,
+    3320, 7966, 14632, 37136, 35317, 38635, 50820, 43222, 58146, 21271, 37209, 8212, 33320, 15988, 18986, 64101,
+    29834, 67349, 62230, 30778, 60119, 49928, 62149, 17175, 4735, 51906, 63189, 15045, 43807, 53259, 16890, 31258,
+    67985, 10642, 10615, 26815, 66087, 43811, 61987, 963, 30289, 67228, 45980, 19524, 5145, 2524, 31872, 20923,
+    21410, 59887, 59925, 70208, 66379, 63396, 54078, 46695, 60507, 656, 55762, 67496, 54165, 58839, 67057, 56171,
+    4317, 48095, 5185, 3810, 38207, 36031, 14454, 13142, 58609, 41756, 17835, 51612, 63707, 68586, 20366, 40741,
+    34275, 60581, 5232, 67742, 69921, 67052, 57918, 29980, 44366, 21684, 23892, 19439, 64065, 58623, 46547, 52678,
+    30080, 62945, 37455, 33484, 49709, 30657, 3022, 4275, 8450, 48552, 56522, 37516, 33983, 35718, 54680, 51709,
+    28636, 59795, 17951, 69077, 32899, 65352, 20532, 7435, 68969, 16024, 67895, 43874, 65494, 36035, 53286, 20780,
+    66490, 30150, 46514, 25441, 59060, 9379, 8297, 54757, 56494, 20684, 58162, 23982, 35034, 40184, 13653, 8660,
+    35829, 8855, 2453, 3944, 43464, 37984, 53378, 24202, 56265, 20587, 18180, 45885, 7549, 53798, 42813, 16069,
+    34791, 5902, 6741, 7940, 66988, 40749, 59234, 2900, 64552, 33809, 49389, 29184, 26070, 19103, 34577, 63115,
+    19055, 47724, 15187, 24200, 15164, 34920, 35741, 63714, 19047, 69324, 50593, 39217, 12323, 26233, 5540, 17509,
+    5570, 62702, 15371, 23843, 19308, 26557, 44909, 4656, 25984, 15752, 3405, 47717, 40579, 63157, 42002, 61233,
+    62612, 53970, 57671, 12689, 64796, 17756, 68247, 50245, 37686, 67889, 22137, 43467, 29084, 13197, 41982, 47046,
+    17564, 11118, 57689, 9704, 19129, 44255, 55689, 65607, 35379, 14773, 17129, 37067, 26877, 52788, 70055, 48171,
+    17174, 30432, 58495, 60885, 4421, 1710, 49561, 62311, 35402, 33611, 1796, 37531, 61610, 70134, 33373, 52547,
+    18191, 29899, 38974, 63106, 10470, 11889, 34651, 38420, 21884, 54411, 35970, 65487, 16266, 28817, 19253, 20434,
+    31703, 61200, 42187, 30373, 13796, 31957, 40965, 12951, 59984, 66775, 66130, 47844, 51215, 38543, 59910, 46859,
+    626, 67930, 58472, 66124, 405, 46848, 48587, 41747, 26491, 30382, 18475, 19694, 171, 18863, 48036, 35668,
+    56754, 18552, 57091, 44039, 11222, 32256, 70431, 68028, 67198, 8609, 31333, 19534, 49578, 16985, 15012, 37494,
+    64144, 3493, 19852, 31792, 61242, 11023, 40713, 11426, 64458, 49441, 23804, 54961, 51037, 5034, 56253, 28534,
+    43218, 23019, 60700, 60757, 39286, 59530, 48702, 15853, 14313, 11124, 42858, 31049, 7799, 37267, 9070, 64820,
+    8553, 40810, 27553, 6446, 32562, 51572, 3128, 61316, 16142, 63071, 52190, 22175, 6955, 49833, 10691, 64477,
+    33782, 62313, 8360, 66049, 61485, 38978, 16633, 64303, 7401, 65946, 26889, 41486, 11807, 53077, 15112, 19272,
+    31476, 62048, 10851, 60653, 4676, 39204, 17561, 29442, 16839, 46453, 28827, 68198, 47945, 69306, 50190, 55010,
+    4327, 28357, 27559, 19689, 15695, 25260, 54108, 18953, 59461, 21421, 37532, 60234, 10095, 43244, 58027, 507,
+    48201, 50025, 65205, 16013, 64836, 11851, 21041, 52695, 47283, 14345, 56894, 50450, 45291, 29612, 41021, 41941,
+    449, 40009, 196, 12853, 63391, 39869, 21477, 55573, 40943, 48122, 2755, 2423, 17452, 69741, 10995, 18981,
+    4088, 30777, 29121, 25841, 65737, 24845, 14864, 57845, 51811, 64212, 52982, 53731, 5000, 18085, 51334, 57841,
+    3048, 57580, 67277, 70090, 48744, 60095, 47970, 55858, 60994, 70245, 45303, 8139, 70385, 39766, 67710, 61771,
+    38557, 66661, 64097, 27125, 50123, 47135, 30602, 43427, 26460, 14976, 38340, 26306, 53859, 25763, 15513, 16943,
+    40417, 4197, 58862, 50597, 30398, 51985, 54949, 20952, 40274, 28425, 33749, 54561, 58634, 5881, 31035, 9866,
+    40703, 18238, 3988, 67270, 24761, 26943, 67376, 33505, 32475, 6713, 11112, 30026, 57135, 164, 28713, 23877,
+    49343, 1863, 15583, 10521, 18382, 41808, 32347, 52381, 9215, 65468, 1046, 44236, 34328, 60192, 60413, 49126,
+    60274, 26344, 6064, 47031, 32385, 13176, 58568, 19170, 44422, 59110, 25756, 42603, 45807, 30721, 45004, 19449,
+    40720, 15444, 67434, 45729, 49955, 54345, 55388, 10545, 32051, 38060, 25643, 54768, 38756, 1881, 32484, 68331,
+    58605, 51289, 39433, 42315, 17263, 57582, 7893, 25776, 5392, 26706, 17958, 11577, 54420, 19154, 67719, 43532,
+    1883, 6652, 67305, 13974, 1490, 31698, 30258, 32055, 4647, 479, 55678, 30645, 26081, 63685, 16031, 45758,
+    3415, 39738, 7845, 4859, 60113, 27502, 25508, 4807, 15096, 8411, 39153, 5389, 54317, 68144, 15491, 63672,
+    49808, 52116, 46901, 34880, 32542, 58433, 24314, 21647, 22168, 36993, 23970, 17411, 40424, 7154, 29471, 42347,
+    47009, 51238, 50404, 25898, 42095, 1672, 43828, 64965, 50217, 23414, 41780, 13573, 68076, 11142, 70200, 27660,
+    44504, 47062, 44917, 55849, 41831, 24618, 32052, 69831, 49663, 14346, 64572, 50037, 5956, 66899, 16521, 3635,
+    63448, 24458, 21475, 5172, 10792, 23786, 16244, 44657, 33144, 37934, 44304, 5579, 22898, 65398, 41207, 46939,
+    1035, 61147, 34307, 38854, 21013, 25774, 36788, 58733, 38482, 40896, 47194, 33955, 47711, 53386, 43252, 59356,
+    41571, 39076, 68940, 52091, 12451, 47946, 1790, 28034, 64368, 36950, 49740, 28132, 28661, 4425, 35112, 64484,
+    17968, 17925, 1828, 19281, 69512, 38779, 26213, 52650, 32469, 19679, 46606, 53488, 37485, 43177, 46833, 51129,
+    5911, 2055, 10107, 46545, 1289, 7751, 60016, 62086, 31707, 37074, 42565, 7006, 37053, 29753, 46371, 34182,
+    62943, 15910, 23370, 37304, 12556, 7660, 20508, 29933, 25143, 57378, 631, 40118, 46060, 50786, 6778, 41774,
+    37745, 426, 42063, 50177, 31201, 36904, 25438, 19547, 49311, 47965, 10039, 16741, 64067, 49047, 66701, 1504,
+    19359, 47148, 40459, 22345, 53104, 30297, 30799, 52145, 53617, 14473, 45919, 16908, 52034, 21925, 51524, 37625,
+    37014, 33130, 9000, 55791, 67035, 36994, 30257, 28387, 64059, 33529, 10087, 24652, 41508, 32027, 55946, 11121,
+    63018, 34096, 53137, 61617, 19582, 66476, 54385, 61929, 689, 18264, 45540, 50420, 8957, 37821, 54982, 61309,
+    42329, 63603, 65078, 55755, 256, 7337, 40721, 45848, 17108, 66027, 5391, 1444, 13183, 9522, 57445, 54174,
+    50346, 1524, 20280, 20487, 68328, 23111, 7943, 13067, 17684, 57217, 38560, 31414, 3852, 10680, 60951, 36021,
+    68166, 30195, 69245, 29497, 66072, 52309, 24740, 905, 14659, 9186, 67600, 62746, 43965, 48107, 12289, 39558,
+    46494, 51114, 52720, 57018, 63758, 44365, 5147, 54703, 36829, 12529, 4159, 15282, 24044, 65862, 28784, 59782,
+    3399, 38122, 20020, 31753, 57477, 33934, 21052, 29389, 3391, 12356, 57609, 15467, 40287, 1805, 15472, 59835,
+    442, 17583, 19376, 54277, 48964, 41936, 65596, 2084, 56338, 68380, 10522, 19075, 47955, 65810, 69233, 7535,
+    43421, 18179, 11336, 28585, 40711, 29198, 1574, 63428, 16658, 50481, 40740, 51779, 52189, 64580, 21139, 1876,
+    34939, 52352, 67723, 67328, 17070, 70113, 9277, 23868, 30790, 59419, 33245, 37033, 12650, 36802, 62578, 48369,
+    16573, 41913, 44448, 11903, 1787, 64892, 18995, 45357, 54638, 55205, 60301, 69148, 12083, 15127, 9633, 23505,
+    59097, 56818, 742, 52683, 50794, 59890, 55093, 32003, 28546, 5165, 21589, 43460, 26038, 64099, 8621, 32545,
+    21118, 18662, 51872, 44852, 51458, 31455, 55322, 6199, 12303, 40658, 32719, 34543, 44925, 29407, 4829, 60618,
+    65189, 10526, 10336, 27222, 57721, 23729, 64155, 53922, 12661, 49987, 14855, 68476, 18442, 3557, 37755, 42940,
+    46089, 953, 10559, 11921, 4822, 12564, 18498, 53883, 49513, 27530, 44991, 14071, 18746, 33443, 24201, 6837,
+    27277, 25581, 41813, 2451, 59372, 17291, 54047, 39480, 41150, 64854, 31449, 27296, 37642, 12205, 66046, 44675,
+    12608, 40787, 18915, 45992, 63594, 66747, 44118, 12440, 56285, 60928, 41519, 39354, 36965, 31526, 14276, 26310,
+    26184, 30147, 22624, 10230, 45778, 28561, 22555, 39312, 54753, 60671, 28549, 28366, 63419, 57947, 39051, 61880,
+    3098, 35212, 47274, 44587, 41255, 49166, 55363, 6087, 51993, 42290, 41646, 38603, 67577, 40819, 47138, 18548,
+    69494, 20885, 46462, 22447, 42055, 7492, 29060, 45254, 39993, 64913, 57822, 4483, 27228, 46941, 64747, 65835,
+    36256, 13656, 22675, 16727, 2013, 70473, 41043, 44109, 68721, 49403, 53336, 60424, 65816, 67134, 31420, 59946,
+    57660, 49946, 47209, 38723, 21134, 35247, 47384, 35755, 49823, 15463, 27584, 67956, 38446, 36738, 69199, 40861,
+    38769, 33380, 29425, 38593, 34175, 29220, 46300, 53590, 13127, 52391, 67995, 25059, 40809, 55405, 62318, 40398,
+    65132, 52530, 43673, 646, 8982, 30064, 64564, 38310, 48553, 19488, 47277, 10769, 32657, 42740, 27174, 2886,
+    52047, 2587, 52410, 10864, 37051, 27984, 62493, 67900, 50175, 25509, 65696, 7443, 11129, 6701, 6836, 63473,
+    16126, 62207, 31056, 22236, 28053, 51145, 17211, 28665, 21673, 37116, 59080, 70317, 36691, 66420, 30958, 10339,
+    20240, 38977, 45987, 34233, 17274, 67959, 70407, 40207, 67609, 41276, 64340, 27968, 35287, 58366, 46001, 19440,
+    32109, 59301, 10, 41600, 49394, 36261, 56447, 1937, 38196, 24842, 65356, 42808, 3471, 68417, 3902, 11378,
+    28172, 5101, 32768, 52125, 19379, 68057, 55326, 18922, 58358, 61558, 31309, 42110, 14841, 20114, 34464, 9291,
+    40256, 31042, 10452, 69255, 55792, 38913, 45299, 711, 35846, 38369, 33127, 111, 44967, 58813, 12636, 17018,
+    30112, 68488, 35828, 64551, 15636, 60468, 68650, 68396, 44484, 15987, 39984, 12871, 23769, 39890, 51657, 42262,
+    24331, 6983, 23411, 43217, 32840, 67492, 31406, 69586, 31781, 35213, 45150, 49632, 65122, 49035, 29327, 32731,
+    1041, 4857, 60065, 10008, 59554, 54437, 9602, 21084, 15459, 39866, 26139, 13635, 61379, 23832, 17662, 11523,
+    40859, 28141, 66225, 19592, 58187, 36845, 33099, 28098, 2277, 43550, 32603, 70468, 34112, 60360, 50198, 15357,
+    33995, 6135, 39693, 47408, 9184, 46519, 50954, 57251, 13, 23954, 38338, 12126, 69375, 2283, 26388, 48804,
+    38684, 57606, 26558, 41527, 27706, 60428, 58324, 28278, 5691, 62472, 37995, 53719, 52227, 59262, 20521, 66544,
+    8168, 3402, 51347, 63661, 1852, 68061, 8896, 48992, 15008, 3266, 20030, 63269, 28267, 66170, 33201, 12156,
+    45854, 23097, 8475, 67444, 30932, 11872, 892, 53222, 8615, 27959, 35401, 37818, 22667, 21721, 61368, 53799,
+    38331, 65251, 58471, 37338, 44718, 42078, 23320, 54240, 50458, 34460, 55382, 37768, 51771, 28718, 33331, 55492,
+    56563, 38211, 23105, 37782, 26098, 35284, 64690, 58982, 10167, 10934, 34179, 23495, 20808, 36432, 37923, 16680,
+    11863, 9952, 7757, 7696, 67788, 26256, 37129, 33954, 16462, 59437, 1107, 6122, 25283, 3511, 34826, 24935,
+    56359, 62823, 22244, 26780, 41651, 42146, 9290, 8254, 66814, 63315, 68691, 4589, 4236, 31517, 14674, 37161,
+    49743, 43784, 25460, 11311, 60853, 10143, 33363, 46837, 61056, 47635, 23361, 57340, 27155, 11422, 61708, 58804,
+    11552, 6269, 26696, 66739, 41100, 58156, 598, 12366, 40710, 19673, 36592, 37924, 35678, 76, 37008, 55753,
+    20070, 21454, 53106, 43524, 38281, 13364, 69884, 62881, 21941, 47876, 24747, 43390, 65002, 23187, 51632, 23393,
+    25176, 17624, 3042, 8205, 47975, 58739, 8263, 61548, 13699, 69996, 15969, 63144, 37981, 9826, 19563, 8522,
+    42461, 27473, 15024, 38104, 27635, 15898, 45456, 67045, 10590, 34688, 21438, 51166, 14228, 7497, 44601, 7708,
+    40699, 55360, 22181, 14948, 5988, 27519, 53668, 16482, 50384, 24192, 234, 22282, 36897, 32358, 23542, 12000,
+    23313, 26598, 70073, 4026, 45407, 17060, 27290, 58997, 37599, 9105, 53208, 32006, 21637, 59049, 67387, 64491,
+    66492, 33208, 45995, 20265, 62626, 46394, 25233, 39376, 61343, 5030, 448, 37749, 64426, 50358, 43915, 46102,
+    18785, 2568, 47611, 25289, 25047, 60902, 43345, 46127, 56099, 50115, 787, 1094, 26217, 55662, 49466, 8227,
+    42590, 28306, 1898, 24465, 25789, 25257, 48589, 5908, 38349, 2495, 68957, 53510, 53166, 37446, 36391, 20156,
+    25468, 27579, 70500, 19303, 38742, 60345, 54384, 68846, 1446, 6022, 26396, 7509, 14021, 44698, 61220, 66381,
+    27298, 5719, 17086, 11485, 52787, 54136, 18241, 18646, 46021, 13040, 57675, 52587, 35360, 49590, 66997, 45531,
+    59566, 65884, 69477, 69235, 66167, 28588, 29315, 34332, 26368, 10777, 51159, 27146, 46978, 35984, 48184, 37897,
+    46026, 43924, 65230, 66407, 49935, 9603, 43153, 64327, 70376, 9475, 65658, 12645, 60420, 28089, 59497, 31362,
+    7649, 44173, 16974, 68585, 27299, 2855, 41191, 36814, 64261, 2929, 65640, 33542, 44807, 1344, 54198, 34322,
+    60406, 53489, 23322, 68619, 53320, 3958, 61615, 31418, 2387, 6556, 43178, 63822, 36101, 51429, 4057, 47086,
+    16342, 2058, 63567, 60740, 61273, 24026, 9521, 60950, 32050, 24252, 22445, 24945, 65728, 39615, 14519, 22079,
+    7236, 1538, 22969, 913, 40233, 25418, 15694, 69631, 63609, 66474, 16040, 17752, 61129, 64027, 26012, 64238,
+    45923, 36088, 807, 64286, 21276, 57425, 51654, 9665, 39135, 5629, 63507, 52342, 17957, 10271, 68961, 50749,
+    10105, 55423, 46989, 9661, 63371, 10269, 57085, 34033, 22292, 23537, 51328, 25094, 67533, 24766, 40848, 24892,
+    4547, 60607, 4274, 62905, 43945, 55006, 56206, 31570, 3367, 6945, 20012, 28952, 34263, 4771, 38764, 12519,
+    20325, 53522, 41760, 48012, 55912, 69153, 1601, 19622, 20738, 5782, 4325, 9856, 47060, 54994, 52677, 65215,
+    40538, 15559, 50182, 68862, 18639, 10350, 33823, 27281, 9437, 36498, 4799, 27911, 35419, 53631, 65790, 53110,
+    69094, 25349, 46236, 33712, 19501, 592, 27375, 45535, 45207, 6201, 28869, 22922, 11059, 35178, 48781, 45026,
+    38570, 690, 27226, 48220, 357, 56875, 4114, 62965, 13998, 53608, 33081, 70019, 60386, 23994, 10242, 39283,
+    1891, 38948, 10569, 53268, 19657, 17955, 30517, 15408, 66000, 1029, 53566, 65546, 15048, 63651, 22862, 35032,
+    17146, 50345, 7883, 59899, 28749, 61253, 58483, 29017, 6495, 47134, 28136, 41492, 22425, 32325, 16178, 67918,
+    45674, 27929, 14672, 28689, 48962, 42702, 23267, 31997, 26102, 11962, 42880, 20982, 9671, 10251, 61255, 9585,
+    62502, 7180, 47850, 22954, 59800, 53809, 44167, 61363, 35281, 12417, 36417, 53582, 34636, 33826, 21301, 30945,
+    63127, 68976, 967, 40790, 65858, 46211, 58699, 19700, 43558, 862, 69587, 4241, 17208, 15349, 12947, 48430,
+    27738, 12818, 61777, 17586, 36800, 65958, 60072, 63490, 29134, 7371, 51540, 37481, 9332, 39544, 28650, 17545,
+    36410, 10309, 27520, 8841, 50121, 49804, 20307, 56136, 59836, 49342, 48928, 52753, 65015, 56124, 8133, 55724,
+    823, 31351, 57083, 43681, 66464, 23144, 47872, 22221, 62045, 7237, 36835, 61225, 29499, 69312, 55979, 5384,
+    55052, 35620, 30734, 19727, 8568, 40288, 35048, 60821, 59459, 48518, 18119, 69773, 79, 62153, 6463, 53952,
+    49271, 51444, 59838, 17277, 25071, 48544, 40136, 8341, 25973, 21419, 60225, 16146, 70086, 59763, 38899, 70356,
+    57762, 48319, 22958, 59186, 15385, 56503, 14088, 630, 43793, 41586, 53079, 32355, 37411, 39507, 41350, 38961,
+    12234, 66256, 2821, 21529, 36665, 4434, 64381, 49405, 38688, 7813, 18749, 9389, 22612, 65987, 14457, 51658,
+    23186, 58900, 42941, 70247, 525, 55531, 41107, 37530, 10116, 23555, 45010, 66435, 50139, 15382, 64086, 47411,
+    51202, 66070, 26438, 43697, 62027, 5977, 55656, 1728, 17462, 61332, 70199, 10890, 36345, 26082, 9903, 14048,
+    46786, 12908, 49325, 4716, 57815, 28015, 17834, 32597, 8388, 43429, 37529, 57715, 18670, 52115, 42577, 64486,
+    57328, 16148, 42924, 23743, 63558, 35726, 26868, 32191, 40808, 43454, 36816, 10037, 11538, 26162, 7797, 53450,
+    4654, 54549, 47598, 12504, 42950, 25627, 30616, 2668, 24220, 23814, 22793, 24083, 51286, 56929, 15605, 3673,
+    54903, 20755, 67614, 64779, 61008, 36818, 32271, 4205, 55477, 31878, 34, 57436, 27037, 26206, 21382, 39567,
+    70031, 5020, 39655, 40444, 58978, 19375, 50732, 23783, 28124, 56621, 66668, 34926, 21127, 51921, 69906, 38766,
+    53157, 60324, 20346, 43822, 15566, 9336, 3149, 64158, 35635, 20709, 2444, 12612, 7478, 59203, 17417, 34945,
+    41788, 41295, 47113, 17229, 38980, 33010, 45941, 61201, 4908, 13273, 29978, 40528, 38017, 40597, 24885, 30653,
+    11371, 49917, 68324, 55543, 57114, 21738, 15512, 53372, 32792, 52175, 11565, 38702, 65484, 17901, 21242, 52995,
+    25815, 29104, 46632, 66567, 69523, 18146, 64417, 62237, 66885, 69568, 28000, 20516, 15227, 26445, 56422, 12171,
+    6165, 4115, 38287, 28144, 7825, 58101, 69620, 43280, 24029, 12497, 45915, 44303, 38799, 40580, 28040, 53964,
+    58124, 21775, 43031, 34790, 58681, 58070, 23511, 28206, 70150, 54101, 9187, 33115, 2664, 62421, 46229, 26932,
+    46792, 9302, 55188, 52218, 4398, 28997, 1986, 69003, 19880, 60851, 20793, 11821, 63454, 3924, 22699, 44104,
+    6265, 10250, 53205, 50306, 39819, 1131, 58326, 41563, 9487, 33770, 31593, 39995, 68367, 56439, 201, 40590,
+    40296, 33541, 11211, 20572, 67922, 54603, 49103, 3491, 68374, 9324, 66067, 10291, 13641, 53382, 27445, 4979,
+    8897, 44804, 62175, 57155, 26725, 20773, 65298, 34186, 18512, 26686, 15991, 25540, 34321, 56048, 9222, 66119,
+    59415, 33093, 45082, 58479, 31903, 37610, 25737, 38391, 33512, 2629, 49360, 9179, 28362, 13085, 23160, 68478,
+    13000, 64291, 48099, 7365, 22665, 2353, 58641, 29633, 19085, 44424, 46983, 18235, 54563, 17604, 2858, 16595,
+    3029, 22265, 19026, 69379, 48229, 44324, 6913, 56514, 50721, 37804, 1707, 68572, 5396, 4532, 35442, 36361,
+    23477, 68922, 19986, 26014, 58491, 3708, 25216, 39026, 2054, 2195, 23516, 62292, 11002, 9201, 30523, 69231,
+    5004, 13348, 60969, 25193, 32194, 46259, 23334, 16662, 68063, 56989, 46598, 19208, 12236, 43999, 22174, 36077,
+    18039, 981, 32268, 13882, 37339, 61977, 63063, 43912, 40604, 68177, 63892, 29696, 54359, 35179, 61824, 61794,
+    59790, 55089, 31817, 37080, 20774, 22070, 35219, 10181, 47374, 33793, 58607, 14905, 38986, 50956, 53572, 68923,
+    23078, 856, 15180, 26711, 32054, 63209, 7439, 36975, 27355, 16446, 28984, 48130, 28904, 57215, 54744, 48938,
+    57046, 20928, 63662, 1493, 11194, 51809, 56286, 42322, 63250, 13970, 26321, 35408, 38256, 11775, 48252, 54620,
+    33794, 33226, 37244, 67468, 24628, 44230, 51089, 56592, 35017, 27791, 61362, 29736, 12010, 45287, 69036, 4300,
+    56065, 37311, 10759, 64268, 1413, 47047, 44862, 28536, 63228, 753, 28683, 13056, 57868, 24517, 43998, 27663,
+    70506, 68187, 1207, 3971, 69698, 53115, 28228, 18867, 54721, 51480, 37925, 27076, 56944, 17353, 65034, 19695,
+    12006, 49570, 61186, 32088, 11797, 55876, 32156, 59525, 13326, 18061, 6775, 49749, 59141, 9126, 52813, 36397,
+    18792, 48538, 26383, 11915, 18557, 37285, 13585, 20600, 36315, 69057, 43455, 52000, 32203, 26539, 47686, 58320,
+    31353, 6512, 50607, 15885, 40160, 61483, 66731, 44114, 4338, 61461, 50155, 22298, 19327, 17317, 31461, 11497,
+    30689, 69178, 12539, 37400, 26325, 1222, 33326, 6659, 15978, 41529, 39725, 46112, 30532, 7135, 11357, 23304,
+    54364, 10604, 49247, 19372, 13009, 67689, 61417, 10414, 46963, 35801, 36630, 29942, 69777, 24260, 12652, 38456,
+    53513, 21338, 11714, 2850, 62463, 7762, 68132, 11046, 16712, 11416, 23748, 38177, 46240, 8543, 44040, 10928,
+    53772, 2059, 44972, 1700, 22329, 12631, 3566, 34699, 63730, 1047, 11133, 57631, 41557, 2441, 13591, 28227,
+    67191, 44038, 6220, 4802, 15022, 6031, 25939, 62300, 62057, 69342, 35995, 53481, 65541, 59084, 70049, 62065,
+    67743, 25312, 2198, 44101, 67721, 45121, 62102, 3898, 60060, 35833, 22322, 21982, 16593, 58333, 9590, 34936,
+    61972, 46553, 15923, 1967, 63227, 44554, 65129, 25947, 34720, 29615, 40225, 33095, 8163, 29453, 65296, 33117,
+    41261, 27411, 12663, 8514, 45884, 7201, 10773, 37410, 32218, 30250, 41738, 26390, 38670, 67325, 46511, 60054,
+    48514, 12, 35421, 12642, 12484, 39251, 10131, 58787, 26147, 61816, 19876, 21550, 33797, 6246, 3549, 25920,
+    28266, 12277, 28936, 55838, 35592, 58955, 36888, 70280, 25940, 41017, 36743, 57229, 21719, 38102, 23752, 59383,
+    29475, 35211, 62719, 26247, 36007, 5029, 32867, 15177, 9019, 37170, 28434, 67394, 24257, 24985, 8545, 32258,
+    51969, 34136, 46579, 43653, 67088, 18273, 23130, 55989, 15184, 44313, 12536, 58452, 23057, 8312, 20588, 34534,
+    11217, 18772, 60790, 64653, 40989, 34143, 8410, 40660, 54423, 68183, 36710, 31657, 52330, 15692, 32838, 41869,
+    27351, 59477, 40205, 39836, 22707, 31728, 56333, 58065, 52866, 4040, 2338, 53034, 31763, 42642, 707, 34400,
+    31440, 218, 24771, 49378, 47822, 64543, 32062, 5574, 34878, 18656, 68068, 54953, 13550, 24802, 24272, 68468,
+    1064, 12376, 64029, 36881, 18073, 3685, 4476, 20634, 37167, 46794, 35852, 62555, 47136, 17395, 57349, 23493,
+    39005, 13130, 5057, 40031, 54581, 49112, 1971, 45221, 55309, 1573, 43033, 11372, 19827, 54890, 54157, 62261,
+    10803, 35643, 51513, 43083, 20744, 63070, 2329, 2418, 11646, 47670, 63718, 55741, 40017, 30042, 22347, 35613,
+    53184, 59917, 42012, 27017, 482, 21962, 32134, 12833, 64200, 39268, 22842, 25884, 39814, 34194, 43359, 25612,
+    57022, 11941, 39788, 39473, 40972, 22073, 23924, 12106, 28854, 24684, 70243, 38147, 23433, 36734, 35657, 64563,
+    31920, 63470, 61134, 59133, 4210, 64740, 44337, 37232, 64007, 69328, 7194, 36285, 51021, 46024, 46265, 34264,
+    24478, 65652, 53931, 12733, 28759, 179, 25192, 30431, 46921, 30212, 18044, 32587, 14121, 34503, 46958, 58132,
+    23917, 40431, 59870, 53765, 37856, 19259, 62037, 42774, 40463, 67422, 9317, 17162, 35461, 51671, 35890, 11869,
+    40575, 32828, 15881, 46650, 7384, 61701, 44190, 4497, 32078, 30153, 29428, 15811, 46440, 32723, 27471, 25337,
+    13775, 65849, 416, 44618, 51926, 547, 64421, 66638, 43610, 15313, 15633, 10440, 10958, 29995, 46854, 66211,
+    23288, 21450, 57095, 63318, 59038, 52689, 13175, 13738, 42867, 33465, 34882, 39270, 56987, 45897, 58384, 69391,
+    45242, 703, 692, 3505, 356, 42643, 30227, 18328, 38266, 33474, 18647, 10328, 11245, 53412, 22458, 18668,
+    54602, 2232, 35954, 49375, 65300, 23389, 56511, 68694, 60112, 47931, 55945, 27853, 39234, 50002, 35001, 57390,
+    34169, 42195, 18054, 54743, 10114, 29015, 55159, 24895, 64754, 16992, 41567, 60110, 18522, 4847, 45874, 35477,
+    56949, 37343, 59212, 25076, 69061, 8842, 64466, 66181, 55754, 39711, 19789, 23981, 38302, 23544, 45621, 46257,
+    44012, 20189, 58141, 35355, 2238, 8076, 36451, 63650, 68644, 41448, 45250, 37896, 45905, 27581, 15706, 67129,
+    8280, 45223, 36016, 22142, 23839, 23647, 17813, 54503, 36179, 45490, 20428, 7802, 45106, 31996, 4754, 21111,
+    50966, 32265, 14584, 45853, 59014, 18277, 53353, 3220, 4468, 51361, 15670, 65452, 46217, 55513, 33070, 59806,
+    69239, 63770, 47890, 47202, 11403, 60348, 2947, 44216, 26106, 70284, 66789, 61469, 17910, 17805, 6702, 32808,
+    21747, 56463, 21723, 8070, 14488, 45672, 30744, 22757, 42753, 14624, 8487, 25705, 1246, 51748, 21837, 47103,
+    15762, 6334, 41615, 65499, 41872, 33019, 1862, 15783, 10135, 4449, 38520, 35260, 60015, 15188, 62921, 22399,
+    56079, 6760, 46888, 749, 49470, 9103, 31956, 64667, 37461, 60582, 23830, 10023, 19566, 35283, 50355, 6275,
+    9198, 37137, 60150, 42224, 4616, 18665, 29189, 28170, 56711, 46369, 8557, 6097, 49281, 42030, 13971, 54589,
+    31445, 50250, 29261, 49267, 41700, 41912, 2751, 30747, 56465, 39871, 11300, 6186, 63384, 25450, 19256, 15946,
+    55793, 35075, 68289, 20609, 37958, 14704, 62883, 45063, 30835, 24600, 6343, 16901, 42257, 57244, 45843, 63580,
+    24572, 51838, 18947, 24582, 12371, 44654, 14398, 20417, 67763, 3309, 7900, 67402, 19725, 5191, 16768, 6979,
+    27283, 65627, 48133, 66735, 20702, 18154, 47077, 33396, 48131, 69892, 53149, 48625, 18997, 56648, 54289, 16123,
+    26520, 46968, 16028, 64122, 3667, 10737, 44444, 25529, 25417, 55306, 36347, 36712, 36392, 52209, 40751, 62534,
+    60083, 16532, 3225, 17591, 2241, 40853, 51241, 20796, 34715, 27775, 68344, 32588, 5680, 56192, 31522, 39355,
+    40913, 50862, 6840, 35262, 50401, 8592, 9616, 40600, 30902, 20214, 29009, 19825, 52053, 16915, 53950, 60189,
+    52629, 55823, 34290, 37168, 47099, 69891, 6479, 50644, 26447, 44075, 62919, 55108, 12139, 39878, 15556, 3844,
+    64349, 58678, 32015, 41355, 70244, 1944, 32112, 4748, 39952, 37417, 16313, 7678, 14311, 53597, 5850, 43639,
+    18147, 20768, 36172, 56942, 20447, 57748, 50431, 14727, 56205, 3018, 67378, 15348, 57437, 67480, 41910, 13440,
+    16172, 9080, 58313, 21306, 51831, 43934, 6353, 21528, 30430, 57405, 47309, 7210, 49381, 57985, 52669, 30057,
+    64270, 36906, 63386, 20091, 39231, 47061, 2875, 11420, 12167, 66795, 66693, 25161, 29401, 32898, 13542, 28786,
+    26489, 7794, 21183, 17061, 23820, 17091, 65379, 62650, 20055, 27275, 30025, 31368, 68421, 33109, 57599, 39167,
+    32894, 39648, 42377, 57129, 25335, 22569, 13350, 51300, 8742, 25041, 30301, 5925, 43445, 10558, 29667, 30062,
+    16119, 13577, 63966, 52693, 14194, 10294, 47544, 38537, 62745, 41110, 31789, 35868, 8811, 23550, 48056, 55201,
+    67312, 61050, 28895, 31841, 21743, 18902, 66434, 22033, 44951, 46331, 64032, 3791, 44866, 28391, 4072, 38587,
+    25842, 37961, 48918, 27708, 11, 51894, 25692, 37681, 431, 30482, 18205, 61473, 54906, 42168, 3167, 47588,
+    57733, 49615, 42844, 57986, 56073, 37549, 37447, 45192, 66764, 11047, 21116, 17784, 19480, 61942, 28225, 10191,
+    54870, 5258, 10880, 67611, 36477, 41601, 32154, 40952, 32635, 40171, 39832, 20603, 52318, 55245, 63534, 53711,
+    14211, 12191, 67048, 70188, 50010, 56437, 35248, 36754, 29935, 13892, 3605, 44772, 56427, 69572, 23045, 11152,
+    38387, 14665, 15163, 42252, 2831, 47663, 27764, 48182, 9627, 13229, 9266, 40235, 59292, 61122, 27350, 31270,
+    67916, 34647, 62933, 2627, 1348, 3508, 62433, 9111, 67757, 69703, 68254, 37363, 30675, 59346, 41959, 60221,
+    21709, 47920, 38627, 17966, 31026, 35076, 25234, 2457, 37631, 60788, 66022, 38301, 22928, 30017, 35333, 43040,
+    37030, 31732, 16252, 43405, 68782, 25164, 41983, 17017, 34978, 62542, 36616, 57516, 7295, 50840, 39305, 31905,
+    3765, 8837, 66084, 14862, 37476, 27739, 17844, 38747, 1999, 67336, 63559, 66848, 14865, 26394, 2997, 41498,
+    49173, 47727, 1780, 7378, 60240, 11494, 21379, 26092, 28294, 52040, 24949, 18528, 50734, 41720, 40841, 477,
+    2788, 7854, 67784, 27620, 32071, 33118, 63004, 60078, 33044, 30622, 35415, 3883, 51987, 32936, 45725, 19755,
+    10916, 53685, 20347, 54826, 32190, 65795, 3602, 62757, 43713, 9418, 54249, 17891, 58077, 11434, 18705, 5653,
+    33942, 43598, 8460, 53088, 28691, 53223, 32248, 14308, 17764, 30120, 49584, 18689, 34196, 6961, 52146, 3786,
+    18429, 20913, 14440, 65222, 37742, 62862, 54015, 3020, 31398, 51007, 8247, 42751, 5594, 68191, 956, 21350,
+    47298, 7386, 21048, 17713, 38034, 819, 3176, 35857, 6829, 66112, 40381, 4549, 20968, 7521, 14583, 62533,
+    35390, 54300, 28075, 29375, 23107, 20946, 21251, 4432, 28259, 56416, 45735, 50074, 1882, 64476, 42870, 49270,
+    65845, 16250, 2648, 40770, 716, 32255, 69447, 7101, 33228, 32880, 66547, 1640, 44470, 47140, 46949, 57473,
+    66245, 62875, 57064, 65936, 11340, 66413, 15507, 61515, 14118, 53071, 57923, 28788, 68805, 28509, 29921, 64436,
+    33212, 708, 66340, 54748, 46828, 25170, 15330, 62530, 39366, 25659, 61660, 53965, 40785, 44378, 1191, 13028,
+    28346, 9438, 37204, 18334, 64649, 23533, 20153, 29360, 31322, 1044, 52375, 24284, 9909, 58249, 57309, 46158,
+    30911, 38470, 65659, 3170, 13629, 27845, 2321, 10697, 51268, 47556, 40588, 33199, 34544, 14214, 21583, 695,
+    22515, 46692, 11050, 69668, 24731, 65912, 9371, 35416, 32068, 67623, 4296, 64545, 18170, 66956, 34955, 14799,
+    12968, 7264, 10983, 65807, 19539, 57601, 66597, 43851, 29157, 15041, 25770, 66529, 43749, 19665, 126, 33642,
+    66790, 70525, 3795, 12930, 40746, 63307, 35795, 56217, 39173, 56515, 69859, 793, 28687, 70205, 40767, 67247,
+    4858, 55378, 38210, 49124, 25607, 70100, 14931, 20909, 15218, 25083, 14868, 63942, 47791, 41944, 45663, 63731,
+    46235, 61766, 64346, 12495, 56034, 60856, 47774, 62648, 69897, 13058, 23015, 54219, 22455, 52634, 60938, 19335,
+    30407, 52343, 12565, 62894, 14512, 70441, 60051, 10990, 2289, 5171, 18388, 54265, 56661, 14738, 14154, 27602,
+    15948, 48086, 24158, 39967, 63916, 23219, 45872, 56268, 33537, 10290, 41014, 69297, 66769, 19106, 15244, 54340,
+    3943, 26700, 41775, 13957, 26956, 44871, 46008, 25914, 22482, 38613, 24742, 43097, 8594, 21029, 15495, 18097,
+    30471, 49331, 38611, 40872, 6247, 66803, 18391, 68070, 17387, 35264, 22454, 31138, 4920, 9809, 22615, 38649,
+    6687, 35665, 22573, 5401, 60371, 21917, 12791, 37898, 10120, 29459, 34899, 42117, 49225, 68361, 6592, 51734,
+    28399, 44998, 46764, 46213, 4749, 25823, 24096, 43474, 56858, 57279, 46454, 6489, 32266, 19574, 29551, 68870,
+    34937, 902, 51927, 1678, 35646, 10632, 39667, 40105, 14631, 54781, 65673, 16468, 65213, 1311, 15131, 59809,
+    44621, 42509, 55407, 157, 19916, 44246, 64427, 4568, 16291, 5958, 68238, 4714, 25492, 48390, 25305, 11548,
+    10571, 37575, 33152, 57531, 59001, 35570, 26261, 30401, 4276, 51131, 34641, 44103, 42556, 31712, 63166, 52038,
+    41332, 52875, 33561, 18621, 67761, 30930, 4110, 66229, 42715, 64006, 49927, 46401, 3169, 23657, 22393, 61260,
+    44719, 24883, 64607, 22401, 40777, 49703, 19269, 57888, 5667, 38979, 2839, 602, 55550, 12934, 1739, 67130,
+    30079, 16076, 60364, 11772, 70075, 50876, 69999, 66794, 27719, 28663, 22100, 8008, 28179, 59708, 18687, 45064,
+    60144, 3092, 40429, 6077, 61958, 59320, 19218, 57538, 16023, 45701, 66720, 48881, 61667, 39503, 17984, 46412,
+    13622, 60302, 54061, 66164, 3750, 13145, 37436, 52128, 28871, 56809, 58417, 31214, 37689, 8853, 5518, 27787,
+    52463, 70382, 65293, 38231, 67920, 26575, 12220, 20498, 14998, 39682, 19240, 50336, 62443, 41419, 57645, 66497,
+    37683, 18459, 11010, 1509, 61063, 46643, 43270, 25162, 53554, 61750, 38143, 3529, 50489, 65033, 62900, 36148,
+    3835, 1306, 52920, 68670, 63475, 2414, 26821, 43952, 16561, 45499, 19200, 26316, 64366, 31625, 18135, 1258,
+    36260, 69469, 24394, 58864, 69508, 44562, 41786, 19053, 67907, 60691, 61373, 62893, 33069, 35640, 9940, 65651,
+    32139, 23207, 50612, 18467, 8682, 3877, 35960, 9294, 65805, 67668, 5549, 6893, 46724, 10537, 24003, 65241,
+    44273, 16602, 27458, 22423, 31927, 69046, 14676, 42121, 19420, 31091, 38374, 59056, 35100, 33163, 56398, 11716,
+    64287, 34854, 63412, 40690, 4050, 65566, 31117, 32765, 8397, 18836, 60623, 49898, 46841, 8366, 60736, 68491,
+    56209, 66634, 17616, 51352, 23030, 49347, 68201, 22851, 62630, 24710, 26320, 25583, 64444, 55302, 51423, 9837,
+    64800, 51626, 50089, 44113, 70354, 822, 49773, 30353, 55804, 38073, 44373, 53614, 47833, 46807, 44753, 28091,
+    68316, 1536, 68735, 49771, 51002, 50408, 64319, 25520, 40206, 56111, 58135, 17802, 46772, 53519, 16598, 31891,
+    32509, 32137, 49950, 24501, 40882, 26961, 15117, 65151, 25378, 46835, 70353, 4441, 39830, 11540, 63381, 37565,
+    60176, 38507, 44669, 6774, 34566, 43036, 58781, 50776, 38131, 29250, 30099, 35556, 27721, 42294, 8653, 13005,
+    42298, 32966, 69116, 230, 13250, 46723, 44353, 57835, 313, 32929, 43870, 25900, 66809, 15272, 13705, 15053,
+    26995, 12915, 20247, 13404, 54763, 65578, 58371, 45587, 29584, 52542, 18256, 23639, 4191, 3779, 27425, 19823,
+    35255, 33490, 48498, 59851, 22825, 50912, 9038, 25384, 24967, 8080, 30828, 28624, 69750, 14796, 31168, 59245,
+    49208, 22152, 55138, 46409, 27051, 13221, 18071, 52837, 31277, 43205, 66010, 3344, 6980, 3739, 37312, 18549,
+    5580, 55633, 38732, 44960, 6676, 58524, 68001, 55362, 41158, 14873, 31634, 24486, 55083, 42255, 29382, 10070,
+    38223, 965, 67037, 8578, 60475, 9149, 55841, 67594, 21451, 34981, 64782, 65109, 36262, 7069, 11156, 20654,
+    64895, 7572, 40647, 26739, 29234, 62500, 10086, 40608, 5974, 54578, 16189, 34164, 15518, 64142, 68269, 2596,
+    67226, 34610, 30956, 53769, 28618, 13617, 37193, 34557, 30047, 15120, 1057, 18357, 61954, 12566, 8043, 43400,
+    24861, 41663, 61292, 58821, 17005, 10817, 10968, 27476, 57410, 40739, 41890, 59509, 62854, 35804, 16950, 5688,
+    59359, 27386, 29295, 69426, 55128, 17886, 45198, 9141, 44750, 5987, 65058, 45836, 36383, 53803, 35448, 21768,
+    16690, 10080, 38230, 67676, 30211, 48353, 42454, 44201, 29688, 46396, 44193, 56466, 64746, 41000, 60165, 67083,
+    53294, 25483, 27777, 18166, 48969, 58590, 38185, 39612, 5025, 39920, 27204, 9579, 28122, 31520, 64801, 16295,
+    22432, 14532, 62916, 65276, 50316, 10222, 64245, 59977, 46754, 6225, 16961, 19868, 32173, 56112, 18580, 11041,
+    6922, 55659, 6722, 51942, 30505, 51879, 13129, 12897, 22010, 14337, 5312, 18611, 25228, 29867, 1646, 34210,
+    545, 14750, 28715, 13475, 33926, 65243, 51604, 48141, 65328, 18511, 59612, 37063, 27165, 29763, 52008, 54905,
+    51820, 60323, 36947, 4739, 39025, 26226, 29469, 30465, 55574, 15062, 64445, 27963, 6918, 61349, 7174, 29716,
+    7098, 3342, 33766, 28192, 52952, 60811, 49169, 66845, 4463, 23152, 55744, 44316, 51191, 28059, 61569, 30844,
+    40261, 22011, 34104, 62040, 28073, 49550, 30787, 17708, 3308, 70224, 59024, 41868, 60362, 44630, 1449, 52672,
+    37038, 2924, 28327, 61304, 5461, 53664, 25666, 48872, 35374, 28177, 33886, 55062, 28791, 15671, 10889, 66943,
+    7218, 51188, 15080, 66533, 68515, 48686, 53448, 13846, 61723, 42871, 5324, 2471, 4416, 12027, 59066, 44593,
+    51857, 48374, 23810, 20314, 36248, 38823, 36190, 54580, 60968, 9972, 32852, 40325, 55311, 774, 38530, 12351,
+    59010, 62454, 51312, 61926, 20810, 63002, 5264, 68170, 36135, 30288, 14992, 47278, 29226, 36258, 4537, 35340,
+    59223, 5760, 33150, 43775, 23203, 64918, 52058, 62195, 27771, 38751, 44551, 53212, 9319, 24963, 53324, 7066,
+    34814, 22105, 60198, 57459, 64272, 6813, 2925, 49565, 3185, 41865, 57676, 9706, 38038, 40602, 57055, 24086,
+    43253, 10252, 3617, 51390, 16434, 61271, 48750, 9155, 17268, 8015, 16894, 53376, 36764, 37384, 36782, 41359,
+    49418, 31107, 29175, 45560, 57428, 66358, 14257, 44599, 23551, 56259, 49575, 17845, 23065, 11049, 54746, 13335,
+    25457, 23178, 69689, 31465, 15610, 43614, 33080, 33607, 11758, 11759, 24647, 65649, 38515, 26451, 10740, 26236,
+    66886, 39793, 56213, 61751, 66318, 59291, 69912, 14134, 1723, 14785, 58580, 50877, 53167, 28083, 51517, 2592,
+    29591, 64725, 53514, 13346, 3339, 69522, 11025, 24463, 54035, 45731, 5440, 6028, 13548, 2546, 51653, 32733,
+    6054, 45124, 31838, 64187, 28852, 31176, 2358, 68718, 25103, 42308, 69412, 36193, 366, 69, 61783, 45088,
+    24235, 51143, 38382, 3396, 20777, 47684, 20295, 27184, 46620, 48022, 49529, 59864, 52479, 18701, 27330, 13236,
+    9125, 67776, 56297, 6128, 1037, 60619, 14715, 33801, 70368, 59317, 18105, 8073, 24825, 70186, 53350, 55152,
+    36448, 34071, 38383, 11531, 41796, 35057, 45214, 5033, 8001, 18016, 45706, 21372, 4843, 66890, 47345, 5309,
+    60944, 31632, 9396, 25487, 32424, 38335, 64695, 63450, 54605, 22469, 54237, 6085, 10625, 26327, 61988, 26274,
+    65712, 67926, 44291, 22226, 22463, 11103, 19187, 4879, 1639, 14758, 9860, 3477, 66064, 44860, 19697, 60236,
+    63563, 49280, 19077, 55854, 26931, 12647, 14578, 37678, 39048, 11573, 5350, 27161, 50144, 34208, 20496, 27797,
+    2822, 26806, 64416, 68226, 54333, 52045, 61508, 1482, 19836, 21763, 6049, 5303, 12824, 35396, 41721, 21611,
+    58306, 67557, 63556, 61067, 37879, 68131, 29524, 31797, 42522, 36023, 31695, 25867, 60229, 54640, 16677, 51760,
+    14800, 30804, 36014, 42458, 57138, 6110, 57075, 49875, 19786, 6384, 16833, 4195, 20022, 21567, 42775, 19568,
+    51162, 65168, 48679, 11681, 66441, 60787, 16280, 1178, 34896, 18355, 1542, 37662, 23545, 65244, 59881, 33907,
+    58585, 39342, 18833, 9152, 24701, 48796, 3776, 41103, 47870, 37664, 10609, 55982, 3435, 39389, 63504, 55595,
+    1745, 16854, 28994, 212, 40797, 57237, 20119, 63380, 65976, 15584, 21812, 13812, 38330, 657, 24391, 45744,
+    21531, 18595, 65184, 28642, 6154, 52746, 38394, 3764, 15098, 19896, 20260, 67371, 53815, 18212, 48509, 44783,
+    54960, 39198, 51254, 6214, 50516, 57029, 37021, 31401, 49653, 35571, 18851, 55575, 29955, 2522, 63242, 26221,
+    46124, 4222, 57788, 21061, 12034, 9435, 66243, 19381, 17661, 23987, 64655, 11332, 51511, 18024, 11580, 32273,
+    3769, 27699, 3719, 66945, 51192, 40198, 16432, 70374, 11572, 39828, 70132, 6965, 70305, 64850, 6491, 49164,
+    6700, 26028, 17493, 27403, 54529, 22579, 3964, 57218, 5344, 51543, 49246, 37512, 39236, 43434, 31571, 3060,
+    24435, 14230, 15720, 17930, 66095, 28173, 51161, 41475, 15892, 25853, 19250, 67451, 19753, 53013, 56266, 21131,
+    21153, 27687, 46970, 49170, 64424, 56394, 57363, 5385, 720, 66909, 2675, 20849, 19493, 43553, 29726, 17595,
+    21210, 16782, 22163, 26930, 64614, 40434, 22288, 43601, 59004, 31937, 21506, 15818, 15503, 1316, 43285, 25342,
+    59284, 22639, 16893, 7020, 38487, 4628, 59962, 50769, 13749, 40574, 19794, 57753, 46573, 2747, 29914, 16231,
+    29170, 13834, 52509, 38687, 26609, 40304, 12043, 35675, 53285, 69467, 29422, 60070, 27645, 2903, 56031, 298,
+    1474, 64587, 59299, 57586, 1282, 61214, 27045, 62969, 29572, 46944, 49822, 26544, 16289, 23698, 26632, 51032,
+    65456, 6665, 18161, 65091, 23428, 54236, 9372, 23548, 29376, 40488, 4972, 37639, 54068, 21660, 48462, 17607,
+    12212, 23993, 2312, 38305, 63519, 29479, 48508, 48276, 24528, 28552, 22383, 41763, 18021, 31005, 42618, 18288,
+    8773, 39152, 38322, 52858, 16166, 24696, 1811, 45351, 7662, 46329, 57421, 44545, 65194, 30504, 8260, 17160,
+    26612, 52256, 60873, 30236, 16571, 50470, 16586, 56488, 33662, 68459, 42866, 22205, 63373, 69655, 3051, 7887,
+    68638, 37986, 14130, 65072, 40521, 28570, 10157, 28877, 57458, 47137, 40519, 28256, 47787, 11918, 62481, 17455,
+    56597, 55923, 66750, 61366, 38703, 16904, 32313, 6859, 57817, 51510, 2756, 29992, 18586, 51607, 67224, 28316,
+    54347, 6764, 12195, 4169, 31226, 3136, 31594, 45070, 62956, 8053, 49012, 3618, 69431, 39960, 54657, 69731,
+    29319, 61965, 15316, 20241, 3732, 53855, 38395, 20059, 47646, 32234, 63744, 7488, 39200, 64314, 42198, 8591,
+    47487, 59375, 634, 35680, 2783, 23686, 4495, 48082, 28061, 40928, 70489, 6888, 28331, 44186, 27648, 24630,
+    58085, 48836, 59855, 868, 63439, 52684, 69174, 36414, 48614, 17045, 38493, 65126, 52655, 12363, 48482, 8355,
+    55009, 10745, 33492, 68376, 54057, 42904, 28382, 67206, 30766, 17383, 57441, 56392, 69286, 33952, 62324, 39931,
+    70084, 57339, 30172, 52977, 37948, 68133, 41779, 9716, 41932, 23631, 41096, 43132, 65103, 42519, 32282, 28462,
+    24146, 2464, 42690, 7616, 57754, 32166, 42155, 40831, 4848, 2754, 30964, 18496, 17304, 61897, 42427, 8793,
+    65832, 18895, 61331, 59728, 67706, 50104, 59889, 42981, 9675, 36908, 14743, 55213, 37259, 33613, 26482, 208,
+    11298, 12903, 4185, 39855, 31696, 46762, 33469, 10480, 32615, 17037, 3637, 47640, 56247, 45217, 10487, 34031,
+    39379, 12364, 48645, 70355, 42759, 60158, 11730, 249, 10413, 40546, 60260, 40949, 58584, 12705, 26838, 37107,
+    40244, 51086, 61795, 44617, 57533, 51713, 47567, 32641, 46293, 39174, 20924, 36212, 7988, 5512, 32249, 18378,
+    68067, 33025, 33179, 35704, 61266, 69497, 34776, 27103, 19671, 53487, 2466, 56657, 46578, 60784, 64528, 829,
+    39293, 29242, 29578, 51109, 12486, 22260, 57536, 18710, 8116, 33748, 20257, 43041, 18679, 28257, 62590, 15483,
+    11288, 31757, 37340, 64732, 50716, 11341, 53308, 13400, 47123, 21575, 59891, 28721, 7515, 60296, 8166, 64757,
+    29458, 27726, 38436, 55690, 64250, 55887, 37353, 25325, 54132, 69168, 27237, 24504, 31495, 12392, 69683, 53727,
+    41782, 28339, 20159, 45049, 65949, 609, 53784, 5024, 22006, 66588, 26123, 40852, 13269, 67427, 30015, 32432,
+    4452, 69705, 54643, 3392, 27446, 55145, 456, 68995, 54595, 22358, 38377, 59336, 47247, 36344, 68868, 38041,
+    55381, 56153, 32730, 67958, 31083, 40609, 63432, 24062, 55329, 59768, 8967, 58110, 17343, 61369, 22776, 33730,
+    25596, 5233, 45679, 64239, 51247, 28887, 1915, 11843, 34645, 24724, 4246, 29123, 10140, 42984, 14137, 17372,
+    9635, 20002, 36416, 12681, 30116, 35764, 1004, 30433, 66855, 40664, 64308, 48238, 13018, 41372, 31065, 38940,
+    61049, 33670, 35377, 62298, 67260, 41164, 19724, 32861, 48822, 63597, 7865, 61555, 61408, 69392, 15037, 69191,
+    40370, 24219, 62317, 68257, 25548, 61411, 7214, 48024, 2678, 7219, 65973, 37551, 35082, 1484, 64769, 26421,
+    41924, 3310, 65762, 20094, 54978, 6505, 37644, 11233, 18303, 10000, 30118, 14599, 7019, 24156, 50603, 50001,
+    26030, 52173, 25787, 44930, 37273, 28850, 22271, 16175, 70285, 43725, 64102, 12785, 1634, 26398, 29556, 11924,
+    67774, 62015, 69808, 41772, 30922, 6163, 56547, 8194, 65644, 6132, 22808, 46489, 15266, 4310, 17743, 2285,
+    46503, 27619, 62478, 61357, 69234, 60512, 13339, 34778, 46367, 68658, 69489, 18254, 53097, 61768, 14186, 59220,
+    19045, 52, 14504, 48667, 32933, 59453, 60147, 63110, 53825, 34411, 35794, 24267, 69048, 63275, 5026, 29545,
+    65769, 13114, 23768, 29180, 30904, 44742, 39898, 67775, 60222, 2394, 50900, 55422, 40929, 60293, 53812, 10117,
+    5528, 12271, 7472, 50893, 69516, 6711, 42085, 27654, 22581, 32246, 59833, 59723, 61764, 47115, 55642, 68484,
+    26172, 33442, 42524, 16614, 17197, 69315, 8420, 21426, 67256, 661, 10514, 54443, 60059, 15601, 10836, 7922,
+    1439, 35721, 58300, 45332, 13492, 55020, 34861, 61820, 33491, 22397, 26785, 31902, 6942, 70452, 65625, 68946,
+    34206, 41683, 39530, 68563, 41358, 28905, 70321, 34406, 38154, 27866, 35889, 9685, 7975, 32058, 65218, 28133,
+    45948, 13158, 11594, 22686, 59086, 66143, 60156, 62278, 14717, 13283, 39973, 176, 14132, 30677, 54892, 3155,
+    20825, 68590, 15738, 68935, 1147, 16935, 41552, 39668, 62778, 6817, 3798, 7652, 30166, 57813, 9893, 15335,
+    67404, 6861, 10103, 29485, 38665, 41481, 9768, 67428, 52964, 48726, 58322, 25395, 62548, 34116, 50909, 68810,
+    63628, 12820, 9740, 45283, 30619, 57124, 36668, 56835, 723, 18767, 7410, 52506, 29012, 62, 16209, 40166,
+    19479, 26505, 44933, 5519, 51187, 3319, 12248, 62609, 437, 28666, 49915, 38849, 22039, 40481, 27241, 6794,
+    37965, 51252, 37294, 46804, 53456, 24137, 18062, 25578, 8143, 1942, 19937, 21730, 62699, 4435, 53141, 11019,
+    26714, 24780, 914, 42138, 56102, 59830, 47687, 2017, 32028, 34990, 1699, 13877, 9079, 30176, 38475, 56560,
+    21546, 42473, 15416, 20728, 54374, 39085, 33671, 66934, 29457, 23909, 1771, 10679, 64080, 47925, 21408, 47831,
+    55799, 51743, 59457, 34773, 63044, 69694, 64345, 48513, 38908, 53695, 24835, 67478, 60376, 34094, 26599, 25693,
+    33527, 60217, 18418, 11279, 8404, 3401, 18020, 28413, 48672, 16737, 40368, 28760, 9341, 1788, 25566, 19586,
+    51212, 9803, 54592, 66158, 30524, 8613, 22519, 11659, 16500, 65883, 5999, 18816, 57028, 59069, 18509, 40712,
+    34477, 46196, 6924, 8992, 23048, 32178, 58305, 24499, 12452, 19873, 16185, 65117, 14407, 8477, 16923, 63974,
+    35933, 64406, 65729, 22545, 57989, 32534, 65294, 2493, 31480, 53738, 51581, 1792, 27841, 2574, 55065, 69687,
+    49591, 38362, 56203, 66532, 37069, 65483, 62519, 14801, 23863, 49687, 35712, 24335, 50036, 36474, 6398, 15845,
+    48904, 51478, 12710, 66306, 27903, 92, 26024, 68451, 39831, 50402, 8224, 32692, 25514, 23116, 5891, 44087,
+    15336, 39938, 35808, 50369, 24346, 16492, 24072, 11675, 39252, 39631, 53490, 1742, 17068, 33853, 38195, 9067,
+    25427, 62784, 1501, 46047, 30841, 63926, 35261, 69746, 66444, 42895, 14397, 25222, 44890, 58080, 24757, 34908,
+    32648, 52828, 37337, 27019, 62403, 32160, 32989, 28328, 66550, 4612, 16567, 9061, 21645, 29224, 4266, 65556,
+    23386, 18996, 40875, 67716, 22348, 19587, 10755, 10364, 705, 7004, 22963, 828, 21732, 57895, 12105, 58628,
+    32948, 56551, 29144, 14085, 6609, 63565, 8567, 27993, 50189, 10781, 23328, 20427, 67746, 47626, 35354, 41626,
+    12997, 64198, 67474, 54710, 37833, 47407, 13432, 65637, 24403, 31240, 42636, 38743, 38381, 1702, 30838, 33805,
+    67313, 67625, 34449, 17181, 35504, 38416, 52701, 49763, 6978, 56655, 4439, 2729, 62084, 11163, 63836, 42526,
+    52867, 18296, 53670, 34469, 40755, 67859, 59478, 15214, 15454, 61019, 4138, 840, 11480, 14469, 40048, 29053,
+    36217, 56877, 12651, 53099, 15139, 59353, 11862, 32022, 62961, 10879, 62072, 4932, 46785, 34491, 5278, 59078,
+    19641, 58042, 37378, 64382, 60588, 70464, 35691, 22593, 4346, 26032, 68349, 30124, 55501, 17861, 63787, 47010,
+    30050, 68798, 68702, 42935, 23283, 60628, 65626, 36547, 43343, 43522, 33141, 61095, 61799, 61062, 16550, 34961,
+    26967, 16697, 28988, 41688, 985, 17357, 21602, 22826, 58715, 43403, 27542, 40437, 61806, 59848, 54464, 41971,
+    13313, 65506, 64253, 27556, 16964, 35081, 58569, 58582, 68849, 65985, 37055, 33861, 287, 9085, 257, 18499,
+    17633, 9407, 34623, 48140, 68414, 27709, 19706, 16147, 36823, 16861, 31919, 4692, 44620, 12770, 64378, 56460,
+    50774, 14668, 35986, 43105, 28300, 7814, 40571, 10684, 13871, 2940, 65878, 2183, 16579, 29898, 640, 34229,
+    32463, 56157, 4875, 64093, 7835, 53679, 42462, 25207, 10852, 25197, 60498, 42130, 52601, 30632, 13497, 4768,
+    32763, 19971, 10314, 63798, 68300, 30545, 27614, 27583, 63946, 28006, 10814, 28603, 1168, 35298, 50411, 35883,
+    51344, 46365, 38785, 62593, 23958, 1368, 52580, 34958, 2824, 43837, 33746, 62259, 18381, 25722, 40085, 66210,
+    46218, 46543, 57179, 62863, 45801, 10917, 11321, 19906, 52980, 14830, 59392, 37172, 50334, 34458, 22122, 47660,
+    18306, 55517, 42244, 27447, 50265, 23852, 9781, 17714, 69232, 47689, 11255, 16155, 9617, 19853, 66044, 2864,
+    5581, 43207, 9668, 62239, 58129, 52223, 58103, 37243, 61387, 63289, 38909, 7187, 28377, 18674, 41044, 64893,
+    14848, 6476, 15281, 57522, 7493, 56674, 60797, 43791, 24841, 26181, 37264, 44289, 49199, 36032, 1977, 50003,
+    68048, 1606, 14373, 16897, 4577, 18108, 47818, 59688, 25556, 11184, 6759, 49871, 25628, 49231, 63334, 51937,
+    1158, 35542, 16090, 42270, 33659, 8865, 48484, 18587, 10129, 50278, 57686, 30566, 5904, 7611, 23123, 17169,
+    26914, 36302, 17433, 5045, 19183, 26042, 22030, 14410, 67796, 61605, 336, 22791, 44225, 68625, 60199, 62491,
+    67700, 61699, 11522, 81, 66092, 6142, 2393, 7358, 407, 26298, 46806, 7562, 56519, 70106, 1829, 41159,
+    14678, 1841, 66535, 2179, 4458, 56926, 10040, 8384, 41287, 12827, 30889, 22076, 50195, 62295, 31846, 2773,
+    47768, 30035, 43882, 69320, 23190, 38021, 24598, 49074, 5323, 49729, 46539, 1422, 12886, 8416, 719, 34669,
+    22585, 60707, 14964, 3337, 14443, 50365, 68700, 70392, 23641, 56291, 19048, 56245, 16882, 39041, 65613, 18084,
+    60356, 62036, 17127, 6549, 49455, 38914, 60574, 62737, 7774, 31961, 45671, 22307, 29444, 23420, 22350, 29415,
+    64663, 89, 64570, 19491, 32858, 30540, 34787, 68915, 44023, 63679, 3790, 36100, 38417, 47425, 5664, 8728,
+    50503, 47847, 63737, 182, 27438, 5376, 5810, 27107, 65602, 56105, 18401, 63338, 3397, 54942, 68645, 19554,
+    3901, 22481, 1295, 46028, 31749, 51096, 65676, 55459, 34222, 15907, 6662, 41080, 13624, 49147, 3927, 7155,
+    68229, 27065, 34239, 41514, 30379, 32450, 67024, 23285, 31110, 9933, 39928, 62911, 6181, 40109, 66582, 47227,
+    50802, 23691, 63205, 70308, 2038, 20740, 16349, 8261, 60903, 1900, 69034, 59294, 34126, 32653, 68854, 15289,
+    41202, 30346, 59271, 25889, 67793, 45786, 12508, 45882, 68267, 17198, 69085, 54749, 61184, 30183, 51977, 22438,
+    50094, 25074, 37696, 8648, 16809, 42635, 14371, 10334, 27262, 16026, 4529, 68423, 3692, 70322, 39190, 52428,
+    22773, 16653, 28741, 69266, 22222, 4752, 10716, 66940, 48985, 22626, 52446, 38819, 19632, 55701, 25044, 11657,
+    62357, 52533, 54947, 17836, 19886, 2458, 61302, 41665, 61420, 51052, 33574, 27564, 41025, 31085, 9919, 38388,
+    44888, 15710, 7700, 29447, 40295, 45733, 66338, 27490, 61991, 42480, 34247, 60212, 57185, 68035, 65291, 21026,
+    51946, 65851, 43813, 68357, 63328, 25416, 57720, 25735, 22807, 37867, 57554, 64364, 47013, 2163, 55916, 30684,
+    32436, 36299, 37717, 41033, 46669, 24901, 27707, 35236, 57878, 67898, 41743, 26415, 67406, 49846, 60620, 58226,
+    27935, 42434, 44729, 65806, 22335, 69562, 34545, 59817, 2547, 2691, 20180, 69992, 34176, 65312, 25223, 21046,
+    44262, 53619, 43657, 67867, 48394, 24793, 35800, 28095, 4447, 28143, 32447, 10069, 31675, 52444, 44704, 3531,
+    29816, 66726, 60983, 4118, 59964, 3033, 58809, 13002, 14658, 54473, 930, 62089, 23481, 47409, 3314, 25891,
+    44744, 45910, 27420, 28612, 13007, 3855, 62287, 26719, 30855, 36790, 3065, 64259, 51676, 48547, 12547, 16545,
+    66905, 28, 69095, 17650, 2552, 51442, 21023, 3480, 14587, 31764, 52247, 59300, 15632, 15766, 25380, 28512,
+    34738, 11098, 65196, 40141, 40187, 52295, 67442, 70484, 63678, 49556, 42005, 64961, 55168, 56495, 68906, 34242,
+    27732, 41607, 50704, 57688, 32860, 46377, 27497, 17313, 6762, 61436, 64070, 59312, 14724, 6647, 59796, 62177,
+    24686, 67975, 27596, 1523, 53358, 45681, 57168, 3969, 41118, 67582, 22972, 1137, 39726, 3809, 37770, 38046,
+    40348, 56779, 6129, 70194, 35565, 43604, 42799, 68413, 38972, 19992, 62205, 36428, 34593, 49936, 49082, 21614,
+    65812, 68519, 30526, 22656, 14056, 55305, 55788, 49497, 3156, 18018, 10210, 13661, 25766, 17293, 20964, 38561,
+    53092, 5223, 51087, 5946, 19505, 22237, 86, 35453, 20539, 45022, 2093, 23858, 60303, 33560, 12210, 6588,
+    22908, 7164, 12235, 11366, 29902, 64923, 15965, 66055, 54747, 44937, 36507, 23520, 23083, 47837, 37278, 32284,
+    1020, 16334, 45920, 54831, 18409, 11017, 13116, 3892, 49963, 67994, 68835, 48803, 48068, 17064, 48582, 69766,
+    38599, 41457, 61579, 13793, 49204, 58991, 23794, 51363, 17663, 54687, 16632, 45700, 33114, 19891, 1607, 22111,
+    44813, 43304, 57716, 35474, 57355, 65092, 64943, 15007, 69569, 14871, 25629, 52241, 65697, 25817, 68210, 49907,
+    69386, 49092, 57881, 34764, 11762, 32161, 3833, 57080, 32701, 31605, 12956, 52820, 44616, 47566, 47665, 31978,
+    41097, 53497, 19009, 65396, 20671, 59302, 55198, 25571, 61376, 58726, 27753, 60530, 4386, 30474, 25543, 20529,
+    41981, 9279, 6404, 30449, 17137, 11283, 32980, 21073, 49462, 55585, 55131, 17922, 53269, 2716, 48620, 63206,
+    37432, 62918, 57574, 1691, 66423, 53360, 63253, 62790, 40305, 36462, 1677, 67760, 32272, 60496, 48232, 13831,
+    35029, 53173, 11977, 65160, 10980, 22314, 5626, 49573, 21180, 25906, 35722, 65005, 63775, 39607, 14952, 29881,
+    55975, 36863, 24783, 61249, 565, 37595, 55904, 27217, 39478, 17816, 59720, 50590, 6424, 49876, 50797, 50417,
+    53742, 6166, 24132, 45211, 2915, 65425, 69264, 57863, 60640, 43059, 48575, 19399, 16534, 36093, 58730, 15465,
+    40959, 60099, 37486, 37716, 8831, 43394, 8476, 23416, 11803, 44047, 18250, 30003, 51644, 31669, 22296, 28574,
+    52674, 2185, 11275, 1653, 5829, 34805, 58331, 29056, 56562, 17191, 57277, 20961, 12813, 15550, 69810, 7595,
+    65417, 5073, 50714, 11645, 37985, 20402, 69670, 69717, 47880, 48854, 55033, 8299, 53993, 41967, 43510, 33643,
+    53984, 12097, 50288, 18939, 7464, 31424, 64704, 63469, 28884, 17820, 23678, 22962, 21112, 14372, 36659, 52628,
+    21145, 58466, 49606, 50868, 63212, 55346, 16239, 20436, 43913, 36983, 67862, 67857, 38997, 34147, 15698, 58148,
+    44432, 4090, 44578, 62567, 67805, 6337, 10461, 27105, 17895, 41871, 572, 3853, 23462, 10203, 23634, 4400,
+    15400, 65009, 41849, 41697, 33558, 15552, 63713, 18431, 25171, 7414, 19393, 11944, 47953, 22932, 54115, 39856,
+    42608, 9529, 6649, 10211, 38462, 61446, 40358, 14908, 27231, 11452, 4731, 70066, 50930, 52377, 30663, 46900,
+    27121, 22270, 70016, 5447, 55796, 14170, 53252, 17521, 25925, 40006, 27106, 25654, 49357, 63397, 39364, 40839,
+    48445, 52183, 69625, 45143, 4585, 64578, 56961, 24981, 16141, 59444, 1390, 33999, 20645, 46810, 64120, 29885,
+    44703, 40737, 4760, 50650, 19057, 51975, 2166, 42777, 38189, 42863, 48694, 43287, 27227, 68215, 42366, 28041,
+    62198, 68587, 56696, 22968, 2383, 15208, 66983, 26933, 51839, 19630, 27062, 1645, 41653, 21960, 45978, 17001,
+    58946, 19034, 7034, 61300, 61804, 68975, 48318, 53790, 4032, 12281, 21507, 43201, 25420, 2774, 52946, 24238,
+    57035, 29595, 10316, 28832, 28482, 46935, 26674, 1452, 31466, 29852, 3134, 54023, 23885, 21339, 59354, 63136,
+    67977, 35234, 46108, 7387, 30177, 49464, 23300, 15737, 68902, 27786, 11740, 60050, 52905, 6191, 65711, 56487,
+    68239, 32569, 29344, 27948, 69551, 61413, 17436, 45023, 39932, 33410, 8997, 32703, 20227, 60403, 28782, 55536,
+    15757, 38572, 42318, 60547, 48982, 58799, 15279, 38928, 19406, 19078, 6530, 39425, 31731, 36278, 35923, 29912,
+    13912, 49989, 40300, 48957, 66631, 43961, 21623, 8396, 39006, 821, 41461, 32800, 303, 54755, 45875, 15368,
+    49085, 54769, 15527, 29877, 31380, 33733, 69778, 4411, 14138, 19120, 69274, 45576, 11937, 69552, 31392, 16081,
+    59863, 70034, 66530, 13152, 45634, 8783, 6372, 36149, 5468, 20943, 10518, 12538, 63894, 10861, 10034, 47442,
+    22975, 32505, 49873, 29229, 59467, 12784, 56071, 29153, 60457, 2573, 60310, 64533, 39169, 11782, 62851, 40142,
+    44712, 47974, 9911, 20965, 13917, 45065, 62499, 33556, 51695, 12814, 20456, 69258, 31687, 36112, 6376, 45371,
+    21327, 30294, 6923, 32685, 37043, 58353, 14757, 52099, 65045, 26814, 3351, 4818, 23175, 62886, 43376, 25010,
+    38246, 10402, 64891, 54079, 68116, 22903, 67910, 23201, 25495, 28249, 31014, 11929, 56244, 10549, 47015, 38,
+    26628, 30151, 66737, 13490, 49177, 41991, 4419, 54055, 15221, 37113, 69584, 52224, 38939, 65500, 15342, 56792,
+    28056, 52605, 50354, 44270, 35293, 12768, 24893, 18654, 36375, 34484, 19803, 53425, 69138, 12275, 65927, 2173,
+    31814, 42985, 13454, 66536, 60111, 19994, 15183, 36942, 69873, 69383, 13139, 45983, 37087, 12932, 31879, 35165,
+    58860, 6211, 3725, 21157, 38618, 25429, 54039, 65859, 1463, 42532, 69287, 40555, 3443, 15374, 55395, 68888,
+    42697, 59843, 42346, 16694, 68659, 44916, 4107, 17364, 47803, 32460, 66137, 48759, 55504, 6373, 63210, 64403,
+    67251, 15000, 60385, 54421, 49498, 69517, 38787, 27004, 51481, 11228, 29042, 5824, 12013, 63029, 38883, 17640,
+    49726, 30117, 59020, 22321, 893, 54105, 33014, 33565, 55842, 15819, 21580, 44665, 24274, 53464, 13938, 20233,
+    55018, 43559, 47483, 50693, 146, 47742, 8307, 1963, 44129, 32030, 35532, 7680, 36661, 48243, 16390, 863,
+    19006, 57979, 2098, 3961, 49836, 22744, 34362, 45104, 19773, 14148, 2964, 35878, 31614, 15653, 42944, 4696,
+    30833, 42934, 13781, 50854, 9026, 15932, 32667, 34029, 24181, 10736, 54913, 17347, 19864, 44458, 3784, 17011,
+    38465, 12414, 64755, 60667, 46502, 15212, 43642, 33188, 10984, 40639, 38464, 36433, 38882, 37891, 6456, 37538,
+    34571, 5783, 51861, 69012, 15252, 33960, 63280, 47991, 47478, 59616, 38238, 21516, 33053, 30355, 879, 19261,
+    61739, 65413, 56017, 43634, 68045, 68697, 61592, 8160, 67583, 5757, 69325, 15135, 6731, 51203, 46825, 33798,
+    27733, 57707, 24268, 25702, 48478, 30076, 23755, 43605, 11699, 5967, 66967, 59363, 68242, 10974, 50498, 65743,
+    64585, 581, 54244, 52358, 28563, 17427, 67181, 46537, 55862, 32426, 11838, 6107, 44506, 20468, 58090, 49785,
+    4148, 41467, 18655, 62802, 3446, 28202, 13361, 58549, 69184, 52498, 55415, 8221, 65905, 11961, 17342, 34056,
+    19785, 38228, 68350, 20635, 28676, 5961, 32639, 14184, 50866, 4078, 40282, 9844, 32021, 59051, 37534, 41817,
+    29749, 4538, 62157, 3530, 41290, 43049, 35858, 1229, 24015, 58603, 24877, 21996, 64273, 47746, 41970, 41195,
+    33895, 41790, 45364, 56660, 8455, 5251, 9216, 5014, 12266, 22051, 53625, 32406, 9081, 55740, 63612, 20580,
+    51386, 49654, 65397, 51016, 23473, 29286, 195, 44850, 7881, 10436, 57490, 56838, 5706, 43692, 35225, 63535,
+    13252, 28233, 22501, 34282, 24896, 53249, 3913, 43387, 43955, 27142, 28112, 17260, 69007, 27462, 33391, 31582,
+    26026, 68058, 47830, 55312, 4140, 49106, 46586, 48453, 10539, 44249, 32761, 48357, 32065, 19854, 14640, 31355,
+    48048, 49301, 66812, 9106, 43000, 22176, 62703, 60833, 12290, 17896, 52177, 57479, 45963, 63208, 2649, 32429,
+    29889, 22451, 59894, 60063, 69115, 36421, 16269, 38183, 57794, 25394, 45146, 4928, 69748, 41735, 47196, 19395,
+    9448, 33055, 67497, 60794, 6260, 1013, 57892, 48064, 35007, 3272, 4648, 60921, 44306, 42659, 27992, 29373,
+    30168, 45100, 20461, 11135, 58199, 51397, 55802, 12506, 30903, 56004, 32123, 56629, 49597, 17302, 4685, 19549,
+    50063, 47812, 55634, 55620, 43362, 27474, 39, 25813, 67539, 59045, 70307, 51661, 61355, 48710, 42733, 41822,
+    29535, 6839, 13574, 44757, 12774, 5568, 7529, 30874, 43172, 13091, 55275, 63347, 66984, 67981, 15415, 14307,
+    36539, 59687, 38209, 42498, 32826, 40865, 379, 27270, 62320, 44645, 47149, 35072, 292, 50075, 30164, 5481,
+    18759, 14062, 58877, 31261, 36300, 62070, 9460, 52831, 8225, 14810, 32662, 48251, 11930, 53897, 69821, 6441,
+    11715, 63778, 17407, 16856, 1148, 6585, 36453, 53760, 34995, 3992, 20459, 9296, 22208, 30830, 55377, 57963,
+    34592, 59595, 14233, 43182, 31535, 36980, 64840, 32228, 38669, 67942, 7134, 33987, 62126, 8776, 60631, 39337,
+    8002, 65734, 65777, 50208, 9472, 36269, 15545, 10923, 36281, 30581, 33176, 14019, 13885, 26900, 56794, 14190,
+    61021, 52593, 60960, 56752, 51606, 66690, 51366, 17880, 18065, 7168, 49063, 1123, 51638, 20745, 48740, 21446,
+    13526, 69962, 35444, 24128, 15166, 12386, 14589, 69020, 32245, 4332, 33020, 53016, 25504, 2536, 63677, 47004,
+    52602, 24553, 28054, 52823, 222, 8539, 17742, 63544, 13596, 10159, 39580, 19452, 45348, 41973, 60676, 49603,
+    35120, 34633, 55784, 51359, 36977, 34589, 31215, 53325, 43438, 24546, 28965, 57644, 52559, 57195, 63120, 38832,
+    48945, 1773, 4602, 14913, 56467, 117, 66273, 58294, 7743, 27745, 17889, 29999, 9676, 56685, 7500, 47889,
+    7085, 46113, 26319, 21803, 46353, 4132, 38725, 8059, 13903, 40472, 29570, 66963, 34760, 52679, 12860, 13199,
+    34170, 26808, 11459, 15363, 62305, 54969, 6167, 42479, 61845, 18505, 31608, 45781, 31933, 30946, 50192, 56347,
+    12937, 38463, 51432, 40449, 503, 27534, 7967, 59166, 24932, 61903, 27014, 21223, 4286, 1551, 29171, 12302,
+    29098, 32649, 39820, 47726, 27782, 53033, 6431, 25843, 36155, 33156, 44413, 21681, 4767, 47230, 44756, 27487,
+    20287, 24726, 69725, 35627, 57130, 58931, 37799, 25952, 59178, 41119, 21691, 7719, 15678, 12102, 13883, 11147,
+    5018, 46556, 48352, 6599, 44064, 59150, 5788, 38862, 406, 47755, 41135, 38765, 25991, 19100, 29662, 10643,
+    45680, 3760, 8026, 69840, 9851, 44642, 43645, 65423, 22290, 64063, 41619, 3831, 3089, 27221, 59531, 46461,
+    70511, 16621, 3131, 48914, 41435, 31800, 39972, 36372, 18758, 55852, 45585, 12658, 63712, 11043, 8298, 8013,
+    38512, 15114, 7286, 39799, 43496, 57325, 31313, 43130, 53559, 46129, 35619, 15129, 55023, 37299, 64658, 46399,
+    61892, 66324, 14470, 58112, 43821, 42374, 3024, 64907, 58045, 41081, 27475, 1360, 20465, 58478, 8628, 64833,
+    38745, 43993, 43922, 45134, 2559, 44966, 1705, 25389, 62385, 56362, 26811, 51150, 15723, 69422, 34600, 41874,
+    14652, 15101, 7538, 16353, 64974, 32594, 28022, 31668, 37559, 51960, 66402, 46255, 28234, 25935, 50419, 10725,
+    45410, 23153, 58889, 51567, 58198, 68930, 62171, 27098, 47535, 2100, 5738, 48956, 59876, 17190, 29321, 47826,
+    3915, 15516, 8907, 18726, 34833, 44242, 70115, 37741, 53369, 56690, 62373, 40007, 26241, 42492, 37980, 16087,
+    30758, 7878, 14509, 42932, 58694, 11226, 9747, 7961, 50944, 49542, 53851, 68052, 24768, 22306, 69338, 65944,
+    44434, 25510, 49009, 604, 7368, 50767, 11776, 13060, 30114, 49758, 35356, 8187, 6499, 53532, 37702, 33120,
+    45952, 61118, 8000, 1931, 20504, 37615, 51242, 4037, 42157, 30597, 3191, 26682, 2913, 10635, 20441, 25089,
+    69744, 3937, 39578, 5239, 36095, 9623, 32844, 2814, 49996, 46651, 42980, 24611, 25078, 54984, 1597, 31640,
+    14850, 15882, 48376, 61486, 39959, 22285, 5645, 53870, 61935, 10562, 25195, 10065, 60469, 41171, 24860, 19049,
+    55469, 44650, 17883, 670, 10668, 28426, 45051, 2018, 24694, 43356, 56652, 39079, 29632, 188, 2426, 7536,
+    3499, 18165, 30123, 23059, 19112, 60256, 47098, 57742, 53401, 62382, 63780, 40594, 25491, 69177, 60789, 58116,
+    29484, 68384, 55899, 25895, 26355, 56893, 65136, 61206, 8881, 47476, 50703, 5944, 27318, 27696, 66682, 32958,
+    65898, 25865, 54140, 42553, 28213, 4408, 15555, 44265, 20027, 55068, 64638, 19483, 35041, 50459, 53203, 9322,
+    39341, 10233, 22767, 7963, 65677, 41667, 14350, 47299, 4793, 1997, 23104, 61714, 53636, 57223, 4763, 56134,
+    5639, 57537, 33195, 50735, 20591, 2029, 42583, 59873, 29732, 12136, 39123, 50062, 46678, 14232, 63573, 50512,
+    8559, 47173, 70015, 27657, 44269, 43385, 40219, 61238, 55079, 2111, 28398, 30413, 27149, 248, 28150, 55687,
+    59778, 4703, 30786, 17267, 17189, 44407, 41240, 18151, 66539, 19901, 26289, 41761, 40619, 19530, 60029, 795,
+    70268, 26578, 4942, 31237, 52699, 45055, 62325, 68690, 20418, 27079, 4757, 52326, 42973, 18744, 49132, 31917,
+    17092, 12243, 67003, 3338, 15111, 20155, 14451, 47518, 13365, 65323, 12801, 32627, 32305, 60115, 40226, 12749,
+    54998, 53262, 30214, 62125, 34743, 65096, 39879, 2057, 5091, 61585, 35987, 33699, 53820, 27362, 14039, 16515,
+    38432, 39063, 12341, 40243, 30521, 25731, 34953, 55019, 12978, 28716, 36409, 14886, 6693, 31072, 63483, 51949,
+    48523, 16143, 6329, 66884, 31989, 24363, 60827, 326, 43724, 53154, 25703, 11628, 58611, 41533, 58104, 67264,
+    33720, 40181, 32680, 33765, 39804, 12627, 18342, 13764, 8730, 61593, 46035, 41153, 43739, 15179, 16288, 62779,
+    12438, 13267, 48929, 20838, 6589, 28414, 48840, 34498, 55638, 69791, 25095, 58315, 66042, 11510, 68553, 50706,
+    67351, 5715, 21640, 33404, 6507, 57852, 6158, 12620, 2341, 49581, 66093, 12952, 14491, 65299, 7787, 64919,
+    57680, 62766, 14670, 43679, 2262, 62887, 14844, 41349, 31128, 36441, 59793, 23482, 17205, 1333, 70011, 35940,
+    69511, 25501, 67374, 42802, 58364, 56486, 5590, 51718, 51786, 20941, 45152, 50469, 40492, 45462, 40179, 43243,
+    63156, 29188, 47634, 21814, 17846, 10800, 18923, 41167, 14482, 29080, 31115, 62598, 5640, 33891, 70041, 66649,
+    1905, 18695, 42520, 34733, 61013, 28319, 44468, 52988, 23541, 53847, 23575, 49545, 250, 9800, 63258, 46932,
+    61326, 51260, 41497, 7580, 24369, 31284, 29687, 21905, 24395, 55824, 63492, 50747, 61479, 63575, 51175, 35835,
+    17606, 49432, 32971, 60143, 11788, 34098, 12186, 30325, 27430, 14227, 63536, 55834, 41395, 27928, 32855, 8790,
+    41264, 37813, 60738, 52054, 15116, 66250, 10232, 43570, 33018, 21788, 53934, 51434, 17247, 39987, 12778, 28719,
+    36143, 33487, 70240, 23222, 48339, 8208, 52294, 63178, 69718, 52775, 57517, 39980, 35249, 20798, 70306, 21551,
+    3871, 18763, 19588, 41474, 2425, 16929, 30598, 3014, 40409, 49549, 68785, 37840, 13864, 29309, 26296, 4539,
+    4852, 62804, 19193, 48244, 52379, 61697, 16569, 26774, 16466, 46312, 45427, 56021, 29368, 24355, 3567, 37383,
+    35039, 44891, 68613, 9790, 49794, 55347, 47188, 14043, 37159, 33860, 56492, 42208, 18598, 10083, 53439, 27441,
+    987, 59479, 10977, 57838, 30685, 19216, 31462, 41933, 14988, 49044, 18321, 7631, 1682, 58852, 31742, 18245,
+    57909, 10871, 51068, 33911, 67107, 27042, 23911, 39805, 7278, 49391, 40167, 51293, 44185, 3665, 20886, 19494,
+    6474, 3353, 67420, 63715, 20142, 14172, 43282, 1300, 19793, 38108, 30059, 7299, 37802, 48191, 50750, 33227,
+    38810, 36026, 55282, 36569, 25336, 32281, 58685, 35733, 24266, 53304, 57475, 23374, 58629, 54513, 28579, 50204,
+    6250, 33169, 2502, 67684, 19888, 43011, 33637, 7026, 6621, 37050, 31269, 13213, 32280, 25912, 57119, 68844,
+    50846, 57423, 49827, 2683, 17477, 25435, 39730, 22150, 19108, 55771, 18563, 25139, 55394, 48949, 8873, 8794,
+    54554, 25428, 35510, 66833, 64036, 8918, 12294, 3551, 27722, 54058, 48324, 69346, 35350, 6970, 65533, 34713,
+    10261, 11841, 54306, 16264, 21893, 66900, 63524, 69657, 32656, 67227, 6444, 38320, 53124, 375, 22492, 24645,
+    21422, 45419, 29477, 41367, 16644, 13169, 45040, 21638, 54884, 45252, 5250, 54517, 2844, 18754, 62429, 44048,
+    60479, 38421, 26878, 50222, 62501, 15439, 70275, 4907, 42365, 44919, 44463, 61640, 30365, 50105, 21141, 39183,
+    16574, 30537, 10548, 51913, 34373, 60597, 48924, 25804, 57461, 21762, 10772, 26561, 48134, 28506, 33582, 32986,
+    57487, 51892, 14627, 14030, 14107, 596, 37401, 47069, 11709, 22500, 26707, 65438, 40898, 31450, 58092, 41815,
+    28776, 13077, 58158, 27294, 70543, 39759, 37220, 38059, 62007, 60329, 70013, 25599, 854, 55314, 60674, 59022,
+    66283, 5005, 67798, 61626, 44828, 5900, 60735, 9979, 50632, 7046, 69084, 47672, 69663, 40572, 29248, 59337,
+    23744, 61973, 45244, 12576, 61865, 39962, 21200, 53621, 37096, 68275, 30857, 27328, 4431, 8012, 2033, 68023,
+    54784, 1875, 35240, 54144, 66851, 46954, 66942, 58159, 61687, 66378, 6383, 49189, 7357, 642, 63125, 21479,
+    53187, 70530, 59021, 18332, 2608, 15715, 29233, 28120, 39532, 19291, 7438, 57188, 23354, 34032, 30986, 62309,
+    51954, 64282, 67808, 36611, 33610, 5462, 11467, 8186, 62397, 52225, 55447, 7320, 2342, 58647, 22805, 66788,
+    2311, 14947, 27345, 30773, 32163, 39750, 1465, 27779, 15922, 67534, 34262, 335, 63370, 27978, 51851, 12798,
+    27741, 43964, 6153, 47674, 46428, 63180, 4113, 48901, 33568, 26249, 41203, 17143, 66267, 472, 3074, 62064,
+    15026, 21283, 60937, 3663, 4632, 23307, 70471, 64508, 30703, 19185, 32660, 65574, 19374, 11771, 40468, 32574,
+    49588, 25340, 46315, 63605, 25341, 43221, 32827, 28694, 6066, 7633, 28566, 17592, 60444, 62262, 58138, 31402,
+    34008, 47361, 56797, 9873, 22701, 60523, 64009, 42014, 49541, 51313, 61812, 6645, 69216, 9331, 22264, 37653,
+    3161, 59112, 70533, 69786, 60139, 59823, 46710, 62291, 34963, 44015, 48405, 66656, 25615, 8329, 1182, 29682,
+    4036, 18457, 35509, 48829, 61642, 4272, 12146, 21270, 22283, 16559, 18293, 68080, 67413, 45690, 52432, 41267,
+    21627, 42041, 51521, 37466, 40, 69984, 64777, 2500, 11870, 17104, 10608, 9868, 13230, 63561, 13014, 69242,
+    7790, 1594, 8209, 6209, 13533, 42684, 20624, 15358, 40927, 17299, 55051, 2144, 41376, 36771, 24627, 41569,
+    10551, 29702, 5504, 3583, 23782, 59516, 32081, 19979, 59632, 30475, 7482, 46560, 13813, 1235, 21530, 30585,
+    33806, 41907, 6240, 29555, 59789, 19759, 27311, 15941, 53916, 30805, 58330, 42096, 37272, 21325, 41812, 66159,
+    21005, 62068, 48114, 35270, 27996, 49397, 16052, 28604, 61087, 57694, 23940, 40188, 24770, 68301, 41430, 68974,
+    37112, 66819, 20613, 41425, 50652, 20522, 14960, 65766, 19616, 39541, 56897, 66992, 3219, 51770, 30848, 53406,
+    58874, 59562, 19344, 45759, 18532, 15134, 26678, 3451, 15913, 48739, 13757, 13578, 51266, 64768, 25411, 42778,
+    66629, 35501, 14105, 35715, 14791, 40650, 63799, 49759, 3247, 41190, 33075, 21218, 20081, 6638, 48475, 18004,
+    45618, 22577, 12004, 17665, 10405, 62191, 56501, 60353, 34989, 4608, 50321, 4794, 48218, 47884, 63615, 23978,
+    39483, 49010, 9, 24124, 30051, 51200, 36537, 14521, 61833, 65177, 3522, 7808, 9436, 42850, 46840, 47708,
+    69988, 32928, 17054, 7704, 39150, 24269, 1312, 62539, 52018, 47608, 69783, 7250, 7442, 16124, 28240, 17132,
+    66554, 21938, 31595, 37354, 47568, 60322, 37346, 54867, 41411, 69925, 37555, 16738, 35862, 42392, 38894, 70173,
+    25743, 6926, 25236, 44921, 55864, 5705, 52288, 40636, 52743, 17605, 69268, 54940, 22398, 6436, 49714, 533,
+    66592, 41597, 6825, 41833, 14991, 18123, 61219, 59321, 49868, 9395, 46386, 5302, 14511, 5888, 29537, 67953,
+    66994, 39927, 20882, 62348, 68353, 45041, 12769, 523, 35831, 50427, 44333, 16746, 56815, 46106, 39500, 59862,
+    39958, 4905, 54711, 60437, 6541, 4572, 14771, 35860, 66743, 57088, 66560, 26652, 60146, 64863, 57315, 50674,
+    33184, 60871, 46224, 25663, 69317, 39285, 32673, 8443, 18126, 47363, 5724, 52961, 5670, 2707, 4895, 39163,
+    35468, 10850, 47164, 44345, 55163, 10866, 30794, 52411, 34901, 48742, 23348, 38205, 55578, 17057, 26212, 43782,
+    54231, 26161, 51595, 45402, 38293, 6540, 26055, 31711, 25968, 38740, 26724, 4039, 69837, 63037, 26848, 7936,
+    12709, 10574, 39201, 8138, 19005, 19130, 69219, 23887, 22513, 14764, 60454, 65726, 63081, 51245, 52847, 37416,
+    66658, 5067, 67396, 1268, 63336, 53435, 54214, 66314, 56591, 51466, 70350, 26638, 57551, 32476, 69349, 19039,
+    18583, 55464, 7720, 4251, 42497, 9309, 35440, 6486, 4349, 43088, 54449, 9750, 65154, 45904, 20230, 17623,
+    43209, 50532, 48752, 41002, 60408, 61980, 11195, 11077, 69439, 61890, 41310, 27109, 2455, 60542, 9985, 53571,
+    12674, 65940, 38949, 38782, 59802, 16841, 69478, 51697, 3190, 57137, 47623, 6544, 38082, 54429, 50541, 43896,
+    14797, 11271, 49373, 3157, 15047, 57972, 34541, 54756, 17833, 58439, 1626, 51796, 4158, 13994, 61655, 7653,
+    28858, 21572, 31009, 38278, 41702, 7821, 27914, 44875, 64909, 33248, 58882, 41748, 53601, 3923, 10570, 10274,
+    46459, 68073, 67563, 10506, 43687, 49680, 24046, 27370, 7312, 44049, 2307, 5017, 29316, 33678, 65055, 62891,
+    51297, 52868, 15874, 9313, 25695, 28708, 28162, 66133, 64181, 18526, 66517, 8357, 57953, 31363, 53029, 51554,
+    53808, 24290, 2256, 46049, 5890, 6071, 14544, 29225, 46344, 6798, 14074, 68471, 44079, 61925, 45906, 53902,
+    27958, 52637, 2036, 2810, 43328, 68953, 22818, 13696, 14423, 41199, 10357, 40688, 22134, 36352, 47968, 51733,
+    59018, 659, 40914, 39538, 15406, 33874, 31502, 66510, 9615, 15816, 18883, 66368, 10215, 49037, 22450, 28039,
+    36740, 28393, 52922, 19153, 20551, 59730, 48052, 44560, 8749, 40939, 31225, 57247, 54169, 57364, 9476, 61757,
+    61886, 43506, 18341, 37106, 27526, 66481, 35214, 37537, 9015, 62179, 50206, 31750, 40410, 51673, 26076, 66398,
+    54319, 65052, 5906, 34043, 12291, 27244, 1038, 31785, 62342, 19897, 45116, 66936, 21756, 37188, 47087, 35681,
+    57666, 24136, 34893, 36456, 33956, 51853, 53567, 4773, 2140, 22225, 23585, 28510, 1809, 54096, 48856, 52251,
+    27444, 40115, 51400, 1953, 13927, 30287, 35159, 49048, 6183, 17744, 58721, 53151, 29473, 28304, 3469, 31551,
+    54989, 40320, 69179, 34777, 6348, 45582, 64739, 64606, 6501, 59767, 23407, 37761, 60593, 63171, 62664, 21896,
+    10802, 34900, 66327, 7458, 47661, 25288, 32938, 6528, 12699, 55999, 59926, 53057, 32506, 59447, 28403, 48939,
+    52626, 25072, 23888, 4075, 7739, 58714, 49328, 67987, 50787, 58, 66512, 64, 48490, 13174, 68248, 47088,
+    54629, 46485, 7561, 17062, 2247, 68624, 21126, 17496, 24827, 23650, 48549, 6835, 42755, 14526, 30053, 18859,
+    41512, 6933, 30298, 67334, 13422, 56695, 35384, 25497, 53405, 30323, 16485, 47824, 63418, 29880, 48263, 32756,
+    18790, 35810, 11412, 45945, 49115, 19976, 20162, 57874, 39459, 32007, 4726, 26110, 34377, 9365, 31616, 32020,
+    45376, 21177, 52290, 45840, 48479, 5289, 59990, 48917, 32785, 14292, 50664, 8914, 4583, 11579, 34690, 31890,
+    26048, 23715, 1071, 9145, 56567, 55462, 4792, 60134, 32736, 64602, 55380, 15438, 69367, 48671, 51375, 8387,
+    936, 57264, 63652, 22855, 20794, 26209, 51928, 34613, 58468, 42563, 31007, 7872, 33984, 11963, 60064, 1835,
+    67080, 2236, 59939, 10676, 52073, 70104, 62469, 56888, 4430, 55733, 8129, 39307, 38586, 19751, 12369, 12586,
+    39782, 36707, 68746, 23066, 51890, 46867, 45668, 1592, 69033, 12949, 44668, 13628, 44955, 60649, 17182, 18760,
+    34938, 30768, 39071, 20172, 70433, 29372, 10089, 11060, 49454, 58759, 61741, 66060, 54025, 15820, 45539, 38519,
+    41810, 23726, 28076, 43366, 38093, 20222, 66622, 28844, 22683, 8265, 29073, 39570, 42938, 41161, 12675, 45850,
+    29996, 1886, 45728, 59577, 23183, 53940, 16647, 54211, 26019, 69194, 62353, 14647, 64945, 5187, 34395, 20429,
+    6385, 29095, 34139, 18597, 53224, 69419, 65162, 61532, 1, 2994, 14503, 14275, 35134, 59820, 15372, 67529,
+    50440, 64995, 6442, 56619, 54922, 36485, 57906, 50386, 40526, 47270, 48473, 11639, 9295, 5682, 50351, 63990,
+    53284, 39416, 2269, 38165, 15009, 16873, 47543, 55572, 38117, 7096, 27691, 3357, 55935, 55532, 62452, 18731,
+    11171, 66665, 29052, 68244, 40585, 29393, 22714, 5737, 27883, 19365, 12311, 13086, 29778, 69183, 65819, 13766,
+    61661, 31934, 30728, 57975, 38868, 15059, 68245, 43846, 26337, 20693, 30075, 51859, 49844, 17314, 6366, 55337,
+    11289, 55947, 26960, 31103, 15690, 10824, 49161, 57550, 56605, 57293, 39053, 27945, 19627, 8394, 1866, 38761,
+    43580, 57858, 33894, 54597, 10986, 28932, 48281, 12765, 21335, 12893, 30421, 6834, 69765, 69666, 24178, 7905,
+    1941, 23038, 10073, 32230, 52778, 5708, 67221, 30599, 47156, 32829, 22185, 24388, 50014, 57654, 53667, 55458,
+    62104, 36273, 57948, 52777, 53610, 67353, 49821, 14918, 38524, 22840, 32034, 8235, 52031, 21313, 13870, 23010,
+    10437, 56249, 61, 14471, 35242, 43425, 48756, 3796, 27383, 9700, 40553, 20937, 69137, 26581, 63119, 6668,
+    25167, 40053, 61524, 66507, 25334, 48139, 57335, 19756, 34012, 55703, 69244, 70202, 19266, 11718, 58510, 40213,
+    53936, 46528, 391, 11223, 21072, 24467, 46524, 41899, 69604, 14298, 57500, 25396, 4641, 64398, 12758, 9813,
+    64647, 61744, 51125, 812, 42698, 65852, 48368, 62979, 40623, 29394, 65094, 19472, 37606, 24633, 51454, 36558,
+    41579, 41102, 60233, 59420, 34972, 50183, 58431, 30082, 49641, 43293, 62736, 29020, 60450, 14525, 49818, 22786,
+    35938, 6966, 58447, 21156, 50806, 22049, 8529, 38336, 21124, 33982, 68871, 14220, 47291, 54901, 26487, 29794,
+    58995, 39859, 38498, 37000, 57639, 59407, 40596, 43663, 45997, 34722, 2856, 53084, 15401, 10504, 62066, 31843,
+    31945, 66082, 27865, 45425, 40366, 41856, 64148, 30918, 8219, 37482, 41321, 64940, 52919, 34241, 65787, 20812,
+    21699, 9888, 44700, 11208, 60404, 4650, 14533, 51364, 68140, 59949, 65765, 66730, 51537, 13837, 21056, 53002,
+    63341, 9003, 34049, 66037, 48745, 26755, 2401, 42054, 48799, 35161, 19139, 6194, 20375, 26077, 62510, 53957,
+    46095, 64434, 5148, 22474, 41574, 65053, 44257, 2926, 45922, 20264, 29048, 60867, 70332, 10576, 64662, 23881,
+    61659, 18918, 66061, 32869, 5831, 62167, 67217, 52475, 18650, 48883, 48237, 39620, 2308, 7404, 59631, 595,
+    44318, 47451, 14059, 6716, 1384, 31438, 28601, 37703, 12936, 39753, 39937, 26268, 3489, 47315, 31751, 63417,
+    26618, 57520, 5649, 4598, 20484, 65050, 49487, 9776, 56668, 56601, 3646, 46069, 12365, 7860, 17546, 23972,
+    23, 34919, 68747, 28957, 64672, 50079, 38641, 15906, 36683, 3459, 23259, 67641, 40499, 29708, 13050, 27890,
+    15755, 5849, 43980, 15234, 26742, 4776, 57307, 33128, 13991, 18129, 15930, 2501, 12297, 39186, 54614, 24830,
+    5255, 9409, 66197, 34476, 19961, 48067, 21496, 58824, 3514, 7496, 20992, 2189, 32211, 32614, 4177, 59994,
+    24512, 57510, 1586, 17687, 42669, 13750, 2053, 69832, 14444, 7374, 3850, 43136, 63095, 57604, 30872, 56995,
+    58639, 17874, 46247, 21060, 66382, 17457, 12242, 14199, 19617, 69671, 9711, 11822, 29658, 60031, 67866, 43578,
+    33210, 14125, 53109, 61614, 14239, 47521, 53757, 1556, 18261, 21420, 15014, 60668, 58304, 23968, 34685, 17131,
+    16133, 11578, 62909, 64778, 18983, 16525, 59267, 11689, 58548, 8075, 64862, 52340, 30509, 2415, 25959, 23733,
+    44153, 40757, 9406, 43540, 18136, 51027, 6555, 10010, 45380, 12629, 28097, 46664, 18484, 53992, 43352, 8326,
+    16232, 21025, 10584, 21913, 38806, 36446, 53470, 60132, 43309, 68293, 9256, 49691, 16707, 35456, 63882, 35756,
+    58561, 42091, 19612, 31028, 58944, 874, 22479, 52944, 44192, 21619, 42468, 19244, 13306, 41256, 20694, 26748,
+    2190, 8813, 50627, 38871, 15972, 5501, 61896, 13725, 36227, 1732, 29765, 40878, 48103, 48408, 57799, 26163,
+    64180, 25765, 67168, 1608, 54946, 36127, 277, 69812, 56175, 70158, 68621, 64588, 35817, 28778, 57729, 9220,
+    16910, 20024, 66096, 6124, 7924, 2811, 49151, 36920, 70017, 42209, 53409, 60435, 2175, 169, 4253, 33338,
+    6428, 60287, 13025, 34915, 11146, 61664, 16405, 52435, 16041, 54837, 54434, 13544, 27388, 44977, 59606, 56413,
+    2779, 59980, 10055, 36515, 11352, 15241, 16274, 49793, 5113, 24035, 36559, 55967, 56426, 69187, 20552, 57182,
+    33893, 68494, 38525, 52134, 24225, 9361, 58540, 22917, 31291, 10774, 65860, 61756, 26493, 35499, 67405, 35905,
+    59071, 52074, 50520, 57945, 27163, 38488, 29296, 43069, 22516, 51118, 64493, 38325, 18722, 3332, 2688, 69981,
+    55251, 28438, 21484, 842, 9354, 7914, 64433, 281, 20392, 29148, 41374, 62435, 31724, 23014, 54086, 13117,
+    20215, 64092, 11832, 51712, 5414, 55264, 28767, 22554, 63750, 7156, 12531, 46655, 56346, 25160, 56401, 69159,
+    65836, 5315, 13322, 1638, 6345, 65224, 65208, 16857, 53985, 6790, 8110, 18932, 14870, 2030, 13868, 52317,
+    15325, 57152, 10991, 14611, 6406, 26031, 3452, 60580, 4824, 21282, 616, 2298, 8538, 4951, 3133, 622,
+    40578, 255, 38252, 32232, 45792, 34095, 38929, 64191, 35578, 34889, 57905, 69071, 63505, 24946, 24674, 24464,
+    25163, 9673, 21166, 43477, 40954, 11507, 18343, 15102, 59586, 47100, 69154, 62553, 9654, 6484, 53712, 70161,
+    64306, 33299, 38563, 62009, 17963, 57704, 19037, 3336, 22214, 37932, 63403, 10379, 27749, 11808, 41126, 40083,
+    23151, 50663, 63017, 40401, 55455, 4250, 48950, 61451, 38733, 69464, 45156, 57714, 36982, 56630, 55021, 38135,
+    27629, 63234, 56385, 15067, 9542, 55682, 49500, 17242, 41889, 20891, 6884, 7890, 37350, 97, 7618, 3062,
+    32177, 68281, 37393, 22704, 51986, 46063, 47472, 47372, 13118, 68322, 24944, 43439, 50259, 29478, 12520, 23688,
+    57697, 62050, 25883, 3573, 32023, 54731, 31663, 27934, 16281, 70507, 61616, 51799, 36992, 28849, 24953, 57443,
+    11842, 42177, 70140, 8921, 11469, 63033, 44310, 58040, 35160, 47294, 20381, 38578, 41628, 3075, 61554, 39784,
+    65273, 62898, 21442, 41478, 68830, 47570, 13017, 56015, 36326, 41476, 53657, 33878, 52494, 221, 60314, 12331,
+    66003, 44268, 35158, 21344, 23793, 47510, 45913, 11547, 11191, 20111, 33479, 25712, 286, 69311, 1382, 28523,
+    19770, 62035, 49813, 59277, 61742, 14141, 1791, 60528, 55783, 46934, 7065, 48973, 21493, 13218, 23113, 19409,
+    54406, 40062, 26230, 32398, 22816, 34872, 19302, 10897, 63026, 36601, 31729, 12665, 4438, 18952, 33155, 40663,
+    40285, 18929, 6485, 60168, 9669, 8743, 27278, 3589, 34132, 6004, 59627, 43170, 33750, 66959, 11817, 11216,
+    25112, 27774, 35201, 63243, 31705, 7084, 60101, 21992, 22278, 68055, 2218, 54800, 47456, 6038, 62787, 18319,
+    18946, 32904, 46372, 20524, 11306, 64600, 49409, 2978, 42034, 67715, 60365, 37603, 66714, 2920, 7016, 21414,
+    60412, 63581, 24718, 39328, 32427, 53276, 49450, 31808, 40323, 15536, 16297, 39101, 68561, 15457, 62535, 40020,
+    15378, 21017, 61666, 12807, 25557, 3086, 34039, 65182, 9642, 32473, 68442, 9596, 24804, 43911, 37763, 21070,
+    42144, 10004, 51064, 70152, 62257, 62100, 10936, 46779, 8974, 32448, 66876, 27133, 28090, 50725, 44478, 22256,
+    18652, 1091, 36358, 10082, 47816, 9625, 46775, 58437, 18544, 60594, 60769, 29644, 32026, 18562, 38710, 61114,
+    13226, 65434, 43471, 12672, 31491, 51232, 57916, 4216, 22728, 48602, 18869, 41149, 530, 47918, 21793, 65974,
+    63331, 54298, 62078, 1781, 65220, 42906, 62579, 37526, 62393, 54742, 22957, 8173, 9763, 20237, 18022, 39187,
+    40503, 66076, 67576, 67145, 47832, 29377, 54228, 52273, 39457, 24878, 12979, 1315, 5926, 18876, 3556, 56187,
+    26663, 63517, 24938, 58462, 13756, 63984, 1304, 2024, 7643, 62354, 51418, 5419, 16494, 51406, 55151, 17938,
+    68589, 58706, 17779, 50359, 52606, 33832, 58999, 45276, 60846, 18373, 43957, 39097, 26115, 5298, 13242, 10652,
+    30916, 57610, 53628, 5261, 67401, 55908, 23992, 30864, 39605, 14935, 65200, 23547, 44363, 2319, 16903, 29356,
+    53037, 32920, 43841, 65742, 51010, 43224, 32725, 17926, 9961, 7418, 61743, 30371, 16179, 12292, 36978, 42670,
+    49859, 48431, 14216, 33209, 61763, 69133, 70344, 5937, 56566, 13859, 67508, 29037, 37495, 9118, 55357, 68608,
+    15656, 17300, 18425, 16449, 28070, 47106, 69677, 48944, 14816, 7879, 58511, 12849, 14017, 37450, 37783, 38451,
+    25547, 25580, 35052, 11466, 32267, 67542, 20948, 9687, 66421, 69226, 43386, 67692, 66772, 19304, 37169, 13637,
+    7027, 26645, 70000, 13409, 33213, 40170, 13132, 68703, 18623, 44989, 42354, 10223, 60696, 57153, 69166, 26819,
+    412, 25728, 5189, 23253, 50638, 44017, 46099, 4584, 67736, 36455, 23741, 25153, 66345, 56415, 68234, 38775,
+    39547, 33778, 35824, 50496, 63084, 28135, 69456, 23237, 46031, 60893, 14945, 40456, 4809, 7284, 1575, 25500,
+    65624, 5031, 60337, 38137, 44123, 45434, 16331, 34191, 19188, 34759, 43024, 41551, 44662, 5336, 1074, 33379,
+    31120, 59692, 22799, 44573, 48259, 16963, 51382, 37261, 57067, 26101, 17632, 36861, 11375, 26248, 29777, 68547,
+    20164, 21772, 365, 35927, 26642, 30022, 41604, 44293, 53761, 42428, 41727, 50464, 13240, 14934, 4672, 62460,
+    46877, 38709, 56195, 25405, 38654, 2121, 11462, 31851, 46948, 50343, 15931, 35043, 42425, 65167, 70195, 44138,
+    55607, 29421, 59168, 46756, 54740, 35364, 4178, 58698, 44406, 24638, 20850, 66696, 68193, 57375, 25890, 55341,
+    50187, 1721, 60231, 15030, 41368, 19143, 28668, 8754, 67544, 29350, 70167, 18894, 51888, 44394, 58506, 23091,
+    48471, 42872, 10076, 59345, 48060, 14344, 22069, 23772, 37319, 41911, 10956, 65013, 55150, 6490, 49006, 12426,
+    65115, 56431, 52548, 732, 41236, 27563, 12270, 55400, 61014, 11644, 65547, 53692, 55445, 53359, 1376, 69785,
+    23565, 42621, 65615, 1418, 21066, 60470, 46758, 36735, 64671, 15074, 1310, 8988, 34445, 47439, 40443, 64068,
+    23991, 47760, 8471, 48152, 28912, 56580, 38820, 29647, 69355, 7375, 62777, 872, 40769, 61982, 32868, 11116,
+    13362, 31963, 40591, 21879, 62496, 24034, 6459, 42032, 46896, 52993, 35884, 41092, 32494, 63795, 54485, 40369,
+    47685, 29774, 49324, 6144, 36517, 57709, 40332, 34245, 21174, 59944, 52171, 24005, 8005, 5656, 42305, 61434,
+    46975, 27606, 51667, 55202, 25926, 38298, 30436, 45390, 4135, 43330, 10426, 68634, 55761, 47335, 16497, 50048,
+    51317, 46777, 50332, 69299, 68125, 14539, 63835, 33296, 32380, 44178, 48585, 60864, 59107, 12173, 60355, 63611,
+    23581, 10245, 59121, 24495, 39015, 65534, 38921, 31992, 27720, 12307, 43391, 8948, 59196, 10646, 29630, 45857,
+    68186, 36672, 8478, 9140, 48530, 49120, 42645, 60815, 65461, 9046, 16241, 2894, 25780, 22400, 34434, 105,
+    24905, 59449, 37361, 20269, 33384, 31066, 12986, 6037, 40427, 44282, 68698, 42087, 28697, 52566, 44565, 55952,
+    51050, 6857, 35655, 66220, 25330, 662, 65855, 43374, 345, 17603, 15872, 10645, 11199, 29013, 27456, 20370,
+    69796, 39177, 48483, 24867, 1419, 13110, 69396, 23589, 6634, 35286, 57771, 30806, 64411, 34819, 18347, 23362,
+    45707, 38590, 38378, 34277, 54168, 64013, 58486, 32391, 25128, 39548, 5624, 16769, 23708, 34874, 7697, 50675,
+    7234, 1855, 20784, 57496, 61289, 6305, 54492, 64367, 24121, 20536, 18050, 29216, 42574, 58239, 54226, 40404,
+    13094, 43929, 9908, 37670, 19361, 42647, 43937, 65732, 37976, 67214, 55222, 24383, 19432, 42578, 18846, 40899,
+    15436, 67395, 20372, 23707, 10017, 41836, 21453, 24518, 21634, 61094, 26566, 21827, 12087, 41251, 29410, 32560,
+    15263, 24313, 27152, 4556, 45308, 23051, 30974, 32263, 50970, 43051, 21758, 53998, 5789, 61670, 29844, 49154,
+    36080, 55871, 14366, 24074, 19526, 25960, 43308, 57695, 30000, 20920, 69339, 69442, 19035, 19214, 53793, 27590,
+    68869, 5039, 32032, 70024, 46397, 62748, 23737, 19348, 64354, 46051, 11402, 70276, 22021, 70508, 24956, 26708,
+    61159, 49853, 27891, 64760, 18035, 29824, 40531, 13772, 9742, 30023, 38358, 56883, 40791, 23031, 19779, 12420,
+    29861, 32854, 6280, 21757, 33933, 62624, 36492, 29715, 4500, 44105, 51075, 45959, 53652, 25297, 20069, 13035,
+    42514, 44827, 68458, 22749, 26955, 7785, 9651, 33608, 47493, 38071, 69140, 47522, 70347, 25653, 63979, 38642,
+    16835, 4217, 3144, 25061, 14437, 14384, 35063, 41031, 5557, 34346, 52885, 35577, 23996, 46407, 69969, 23090,
+    55332, 57275, 51860, 67215, 46715, 43370, 4378, 14421, 45962, 12357, 41516, 15040, 5886, 17048, 21959, 10945,
+    19634, 60193, 21911, 25104, 28038, 45098, 19, 22403, 1744, 1179, 42105, 55688, 43812, 50229, 38677, 32017,
+    25908, 49135, 68960, 19378, 23524, 39391, 49226, 3025, 15940, 39923, 67307, 54486, 2657, 37326, 24300, 69038,
+    44655, 55723, 43379, 8527, 20612, 33260, 36952, 63733, 44124, 37816, 11381, 58617, 57198, 62150, 28572, 3041,
+    17227, 47517, 22797, 45774, 17971, 47301, 54508, 40879, 50226, 58884, 35579, 19842, 56074, 55563, 54822, 44371,
+    2475, 454, 34504, 68952, 40587, 27848, 65067, 48987, 27604, 2557, 45185, 21940, 56299, 64505, 19500, 25218,
+    48273, 25020, 18456, 34444, 21228, 55029, 26430, 6042, 43173, 5270, 56194, 677, 56316, 18360, 3283, 30647,
+    33325, 64384, 6092, 38197, 33850, 19532, 28392, 30249, 17356, 38412, 50918, 22067, 58948, 55739, 3299, 56006,
+    27808, 31928, 41423, 57273, 15228, 47827, 62033, 69241, 1109, 22127, 44691, 42656, 16664, 12415, 32131, 56939,
+    23252, 68655, 50947, 12761, 13170, 10493, 54907, 37314, 62936, 65475, 55331, 65304, 53529, 31635, 88, 21716,
+    34353, 50399, 59454, 34097, 44213, 48061, 34268, 20322, 65695, 20469, 23638, 40640, 66071, 24271, 9151, 7232,
+    43985, 69390, 15100, 33383, 63889, 1273, 15435, 44151, 33707, 62498, 7383, 39303, 20354, 65497, 21815, 21081,
+    53357, 1398, 43077, 42240, 50687, 33871, 68392, 2585, 39039, 41830, 54405, 55436, 44980, 15088, 30320, 25993,
+    54745, 10127, 29768, 46426, 43719, 25431, 44495, 43446, 2028, 24730, 45635, 18510, 37796, 44874, 57803, 34520,
+    24794, 49527, 55691, 5174, 58861, 66101, 21229, 57402, 34349, 46914, 25462, 57060, 33251, 5099, 57987, 53677,
+    29872, 59511, 37111, 11061, 40132, 69920, 16898, 64071, 41157, 48887, 35520, 17672, 59892, 13128, 44800, 55396,
+    24643, 69309, 47582, 66785, 10636, 61895, 38373, 3292, 57233, 18169, 21687, 40498, 55404, 68424, 66186, 29937,
+    68966, 45255, 69331, 24011, 18948, 60137, 50748, 37329, 57955, 40834, 25080, 64462, 46076, 32724, 9344, 16424,
+    767, 15822, 33756, 59888, 47322, 54806, 7226, 63866, 54928, 62684, 38958, 69472, 15817, 27693, 60952, 5848,
+    31683, 35561, 3848, 13351, 53237, 34807, 20726, 31228, 32024, 65064, 15597, 43342, 22061, 36581, 13555, 61431,
+    6568, 53429, 58275, 29522, 14853, 67814, 50673, 8392, 20249, 53663, 63525, 15377, 18982, 5449, 30928, 16630,
+    53105, 52239, 56981, 24153, 66169, 53709, 15758, 45796, 8199, 52603, 44128, 65098, 41511, 40390, 67098, 67017,
+    70544, 67978, 29714, 37545, 3363, 51283, 283, 28471, 34614, 49156, 43523, 55078, 38237, 55811, 7793, 10056,
+    22352, 41610, 48053, 64216, 68391, 25894, 33938, 18488, 33017, 50981, 13684, 33922, 26804, 4610, 8535, 9143,
+    18500, 60814, 12690, 66975, 11355, 29512, 66356, 27927, 65904, 31969, 36207, 54546, 61869, 568, 13791, 8348,
+    1395, 21487, 3677, 11847, 27611, 20217, 39454, 54888, 7211, 40157, 46348, 56666, 16670, 10966, 42070, 33821,
+    59517, 53400, 25352, 28472, 17470, 29717, 11090, 20960, 50591, 19477, 35282, 36059, 28155, 34326, 46405, 48287,
+    15788, 70526, 9934, 43514, 8643, 4289, 2155, 17415, 23157, 26644, 43363, 48466, 39427, 25393, 46909, 15733,
+    15341, 2124, 57518, 18000, 59695, 62250, 29464, 30334, 7599, 5605, 67997, 8107, 19396, 43139, 55738, 37022,
+    8287, 40889, 48525, 6393, 3832, 45756, 3983, 11463, 6963, 21705, 10500, 4927, 23410, 2056, 51579, 24344,
+    62759, 66028, 57121, 50235, 28843, 29210, 62141, 57127, 29739, 24838, 22149, 57118, 2235, 68148, 60171, 21486,
+    62912, 45530, 68754, 19423, 58347, 52523, 17680, 2201, 62049, 15095, 20997, 2982, 30372, 53025, 10126, 6034,
+    44492, 51792, 49667, 45313, 11000, 51530, 23977, 26758, 35181, 5036, 67635, 33824, 19964, 14168, 60480, 12110,
+    39602, 69279, 68078, 42495, 14575, 58627, 23273, 38140, 51489, 41061, 29620, 9280, 43581, 21502, 26297, 30646,
+    38175, 4127, 65267, 20617, 3794, 66185, 53850, 67744, 50548, 61264, 64061, 66062, 36018, 35521, 30081, 65757,
+    26651, 64375, 54444, 62963, 31192, 7709, 45362, 69849, 17641, 17611, 29815, 19553, 41085, 52610, 5335, 6866,
+    3631, 41384, 47537, 28958, 63270, 52630, 4227, 27319, 27382, 20017, 6314, 43655, 51024, 52843, 50488, 38664,
+    49379, 13076, 34905, 56527, 26466, 50626, 10579, 11574, 39275, 1375, 25911, 27310, 7623, 30437, 39066, 69096,
+    19202, 59185, 56373, 46437, 36512, 21944, 26844, 20426, 65540, 58689, 14054, 41268, 29179, 17781, 12720, 27413,
+    380, 56736, 3951, 49734, 15278, 26710, 44716, 40393, 7576, 17688, 40419, 64736, 44808, 34671, 53877, 22254,
+    68108, 29650, 34552, 64793, 56332, 29943, 5720, 58334, 18955, 9035, 31894, 44557, 22985, 9900, 37769, 51136,
+    47467, 16701, 16, 2164, 8057, 12863, 4960, 62260, 48534, 8786, 25433, 27245, 53215, 59382, 19544, 69893,
+    12439, 45177, 28114, 21887, 60824, 59665, 26703, 12546, 47317, 42662, 68840, 50197, 11123, 19178, 60768, 32379,
+    66360, 44932, 10236, 39996, 49560, 41482, 2718, 29666, 58742, 3680, 59270, 43552, 29135, 55359, 55050, 11225,
+    16265, 54456, 30567, 43818, 49757, 43603, 54691, 26627, 18896, 70352, 36821, 2042, 26828, 797, 44793, 9450,
+    9300, 2487, 66422, 32364, 62155, 48507, 23587, 19407, 8501, 10063, 11333, 7398, 20497, 16018, 50095, 66734,
+    21452, 64461, 70313, 21352, 19815, 70124, 8111, 675, 63608, 33174, 23592, 50072, 45324, 67016, 8164, 43129,
+    49266, 39375, 35834, 45487, 44292, 17461, 69882, 23257, 49277, 52590, 141, 782, 45458, 64983, 52668, 15321,
+    34727, 20902, 37026, 1508, 60167, 59316, 37579, 1196, 52917, 44010, 32317, 24286, 59197, 60374, 26887, 27833,
+    13133, 27173, 50167, 6001, 7423, 44107, 8835, 29262, 43516, 34731, 14586, 6636, 60539, 66783, 37031, 33283,
+    67790, 53535, 49638, 21109, 22313, 9443, 9772, 20813, 70264, 28021, 19718, 9764, 48285, 24392, 53419, 378,
+    55780, 39971, 40568, 37676, 47585, 39744, 67193, 61748, 63886, 54102, 47387, 20178, 62467, 47845, 36856, 43533,
+    49812, 724, 43126, 8044, 16029, 37809, 45698, 13898, 52212, 5332, 21949, 17782, 54704, 18152, 52791, 29908,
+    2354, 22249, 39919, 41536, 52517, 13647, 54526, 44482, 13282, 69045, 30680, 66414, 51909, 10809, 37414, 13336,
+    66570, 8582, 64566, 49579, 69702, 17145, 54634, 52519, 27922, 35920, 31468, 47862, 26242, 22943, 45526, 1665,
+    47450, 15396, 22395, 59416, 33131, 67675, 8109, 57745, 25447, 44651, 50847, 47418, 56189, 33088, 22159, 9588,
+    38705, 23280, 64156, 25723, 70023, 42050, 57596, 56231, 29858, 30650, 3102, 11379, 65317, 38608, 55520, 31916,
+    34772, 69350, 48349, 62246, 755, 41614, 5744, 48440, 52459, 63140, 1022, 206, 685, 59253, 24223, 50327,
+    22901, 65675, 46979, 28190, 7645, 6612, 43369, 10807, 31893, 15509, 68069, 63853, 67532, 19377, 53826, 3870,
+    62227, 29050, 14815, 11106, 28790, 57418, 43015, 22944, 49832, 11438, 45144, 40448, 18370, 14135, 17256, 64809,
+    8990, 61318, 32866, 36338, 61455, 19174, 44395, 33499, 26800, 42806, 33100, 33266, 19744, 48802, 68360, 9970,
+    69482, 13618, 56391, 56167, 1435, 3954, 978, 10818, 21377, 48297, 19516, 2082, 48359, 15152, 34057, 53650,
+    28363, 22653, 65853, 68120, 62507, 45514, 3184, 66194, 62546, 32781, 112, 44816, 17450, 17593, 50497, 23557,
+    24906, 60804, 23510, 9410, 33800, 10434, 32575, 67839, 7305, 66741, 51083, 67650, 68393, 43931, 40732, 59485,
+    20830, 44957, 17335, 57626, 34379, 51189, 45370, 64227, 23859, 43574, 43555, 37659, 51931, 65648, 5767, 761,
+    2143, 50381, 53267, 12899, 68040, 22596, 20243, 34825, 10510, 2326, 13444, 6571, 3206, 33714, 15296, 3053,
+    27057, 18781, 65722, 55002, 57984, 36854, 19001, 8517, 66188, 18383, 14122, 67845, 60883, 39430, 12613, 10706,
+    9461, 8909, 45523, 66669, 28848, 36869, 34718, 55888, 19113, 25732, 35483, 1867, 42750, 4129, 34376, 27826,
+    46490, 31873, 67335, 69127, 30837, 42020, 59278, 42016, 59515, 12541, 37690, 45096, 9235, 20851, 31487, 11299,
+    18160, 24614, 46744, 5021, 25871, 10708, 3481, 11949, 511, 54304, 7198, 41906, 41989, 28335, 59373, 59411,
+    41380, 45438, 14018, 64832, 45593, 62208, 18316, 780, 58912, 10325, 41431, 67547, 65458, 52302, 49437, 53420,
+    54631, 13557, 2768, 69205, 16855, 20000, 28159, 60695, 37794, 45805, 31664, 8108, 58192, 70386, 17682, 65937,
+    31436, 67079, 27641, 39281, 39909, 69362, 28764, 69182, 65338, 46905, 10644, 50429, 11980, 52524, 6172, 19895,
+    8258, 21916, 25916, 61083, 13599, 63016, 11756, 68988, 5739, 12396, 25246, 45863, 69805, 1831, 33153, 59050,
+    70196, 41458, 15773, 47908, 67389, 35825, 52844, 36642, 42784, 44702, 60430, 7157, 2908, 5090, 69865, 52645,
+    28323, 56000, 1352, 21485, 68615, 34756, 25568, 60541, 47210, 49504, 24846, 13277, 6953, 44743, 58081, 47,
+    47980, 6615, 22534, 34853, 23778, 56922, 60682, 41194, 64414, 25902, 69389, 11004, 46061, 44174, 59570, 18410,
+    40906, 15883, 54617, 30501, 49886, 28500, 8946, 61493, 39739, 13977, 1736, 22909, 49719, 144, 30607, 65,
+    17328, 48584, 25744, 11073, 49201, 66033, 12977, 8434, 69484, 65392, 29893, 62241, 1096, 9539, 717, 65796,
+    63313, 20893, 38435, 62585, 16661, 2363, 9355, 39661, 21998, 59976, 47562, 57377, 55430, 26339, 27638, 17408,
+    40599, 3910, 53130, 11230, 59634, 56577, 67727, 38576, 61730, 6878, 69641, 33669, 5599, 66751, 31972, 64228,
+    65928, 68676, 49240, 35028, 69660, 32291, 10767, 26124, 24451, 43798, 13810, 13433, 8083, 16157, 32375, 61517,
+    51487, 20720, 2434, 50130, 18907, 54759, 5439, 54764, 44078, 38573, 10555, 47228, 27588, 67588, 24815, 21285,
+    24616, 34556, 16380, 57319, 27960, 48161, 1139, 66509, 7403, 30936, 6179, 67167, 61715, 31346, 48529, 46084,
+    34719, 15945, 58763, 33892, 38535, 63962, 53179, 22839, 15174, 22460, 55625, 8214, 11530, 48500, 65042, 67310,
+    16776, 4814, 67605, 8584, 47052, 10653, 57143, 61613, 1453, 15753, 5860, 20299, 56935, 17109, 67662, 62789,
+    56324, 30293, 27029, 29260, 14730, 408, 70414, 65603, 33524, 54210, 45965, 54706, 64865, 33854, 52636, 2351,
+    46657, 46855, 35931, 3350, 56287, 61649, 68162, 6197, 41917, 875, 63738, 23824, 52531, 38966, 61815, 32909,
+    12395, 28264, 13964, 48031, 50449, 32746, 11078, 68075, 53563, 62565, 64864, 54171, 7024, 20753, 40686, 41320,
+    28307, 7113, 68759, 69172, 60393, 13906, 52627, 43120, 23381, 48851, 11182, 52109, 65316, 13716, 9629, 30865,
+    47109, 30422, 7807, 58963, 25909, 40801, 56512, 67855, 67787, 61893, 45444, 62715, 30896, 30049, 26923, 34923,
+    2874, 34041, 8833, 38845, 11520, 34443, 30963, 51603, 9196, 28743, 8024, 47666, 37245, 46142, 59668, 28819,
+    65760, 54619, 59349, 46993, 20842, 42007, 24342, 12793, 65341, 24689, 34998, 40665, 63368, 33990, 52715, 37018,
+    7338, 52398, 19450, 31089, 70410, 31113, 51311, 65011, 30483, 17614, 1369, 16091, 19571, 34347, 53686, 23571,
+    3721, 31994, 6202, 48996, 46054, 42150, 62042, 3584, 63585, 64124, 32961, 10456, 44377, 46577, 22794, 25475,
+    42946, 49187, 31428, 69051, 20575, 15285, 50140, 57865, 56586, 64730, 69853, 34295, 61556, 39265, 38638, 50969,
+    19343, 33249, 66523, 16101, 25086, 1913, 63031, 55183, 62834, 50284, 49977, 8851, 67233, 37952, 14995, 49665,
+    52617, 59636, 29521, 14402, 56330, 43312, 62249, 660, 23170, 57493, 1820, 20339, 2300, 14565, 62873, 8182,
+    1712, 9263, 38174, 52648, 66699, 20148, 65756, 30329, 69619, 6724, 45943, 68050, 62402, 24092, 52460, 4867,
+    35963, 69842, 29268, 31082, 55144, 62859, 8850, 30275, 56531, 26833, 51094, 17463, 33419, 61352, 30193, 58314,
+    46048, 22338, 14290, 13778, 9163, 31435, 23082, 9939, 68858, 65720, 30557, 14637, 14158, 43096, 26990, 42823,
+    5076, 14221, 17594, 12767, 27799, 67072, 8560, 24453, 40137, 67189, 48911, 45179, 49128, 65084, 32950, 13856,
+    61671, 29222, 66941, 56132, 38889, 51582, 36286, 15968, 25704, 66740, 44910, 10377, 1467, 58201, 18107, 26763,
+    2114, 66161, 56303, 43329, 47118, 50724, 3181, 20404, 44030, 20011, 19600, 44638, 13642, 20472, 29896, 21277,
+    52252, 845, 48173, 21836, 4053, 26620, 3587, 25229, 26974, 44415, 41426, 56739, 44865, 32809, 13603, 26202,
+    35611, 33500, 13853, 46277, 60249, 14688, 14243, 44284, 13807, 33308, 40162, 19580, 25004, 66618, 17920, 10079,
+    37500, 55976, 36158, 10057, 59076, 24189, 60562, 66801, 42820, 33639, 66204, 68551, 12781, 39862, 44108, 55848,
+    52112, 6894, 8025, 42506, 29791, 47916, 25837, 44496, 55884, 28483, 9388, 45466, 57331, 349, 32598, 38271,
+    21246, 859, 59791, 40407, 16603, 41685, 48422, 13752, 43947, 5535, 8597, 19777, 65449, 45938, 49951, 61356,
+    46982, 35710, 58344, 34554, 39229, 24450, 60614, 50234, 24009, 28655, 2753, 15863, 4765, 68878, 6646, 48079,
+    62431, 27349, 16732, 38245, 24913, 40504, 64870, 29977, 61204, 64744, 26653, 14191, 26594, 60719, 62673, 64698,
+    15370, 6430, 4619, 68249, 53083, 27213, 54910, 40438, 23607, 10760, 3598, 18305, 25818, 51631, 63248, 66132,
+    16778, 7579, 63010, 18736, 3079, 41333, 36385, 54245, 57530, 12989, 56196, 40564, 34380, 57663, 50435, 59455,
+    56970, 18213, 58756, 57765, 58734, 58945, 17400, 26771, 6620, 27587, 18087, 11314, 35238, 36254, 24579, 11877,
+    68992, 15590, 3625, 6072, 41729, 42594, 2199, 59466, 2436, 27852, 35279, 11458, 39344, 58572, 37887, 20670,
+    70182, 45141, 60220, 1517, 47937, 359, 55525, 60954, 694, 46549, 67144, 16385, 43266, 51684, 55874, 55301,
+    55487, 60123, 67739, 39034, 43928, 54282, 10368, 64234, 57937, 38750, 34546, 5285, 37938, 13275, 46270, 42383,
+    53437, 54702, 49580, 61858, 11294, 42465, 24947, 17265, 52728, 12009, 36733, 19288, 53053, 13083, 38510, 42046,
+    67894, 28837, 14585, 69890, 1758, 39049, 67672, 14897, 44403, 9703, 12734, 5922, 47489, 45568, 26793, 59985,
+    57002, 35517, 68094, 27517, 58496, 37437, 48267, 55231, 58237, 67026, 15466, 37798, 23117, 60124, 59816, 16205,
+    44609, 26643, 56931, 58836, 15558, 38933, 31611, 20293, 11536, 7960, 67506, 69883, 34783, 50438, 21380, 15286,
+    68604, 32862, 42720, 29223, 37464, 10284, 60312, 8878, 54425, 45266, 38682, 60466, 11795, 57837, 23775, 15318,
+    2081, 12263, 10982, 19638, 62047, 58903, 4445, 9545, 49612, 56440, 47121, 62547, 19939, 64199, 58967, 67365,
+    11319, 48885, 69916, 40079, 51998, 15600, 42422, 10343, 35939, 264, 8656, 63465, 66733, 41496, 65489, 17,
+    28818, 14417, 10649, 31155, 903, 36778, 56419, 38758, 43277, 5378, 1624, 42983, 13587, 39210, 2910, 30995,
+    65003, 41811, 62200, 54501, 44063, 10915, 24961, 13286, 66976, 403, 31523, 67806, 18678, 64537, 65876, 68932,
+    22874, 439, 14467, 621, 21620, 43301, 48975, 66508, 46891, 46879, 33006, 120, 54239, 18038, 47357, 60895,
+    19653, 12286, 41032, 16830, 59682, 15934, 14620, 27211, 30546, 10400, 61443, 35177, 34698, 27846, 50475, 51031,
+    12022, 39847, 70289, 55192, 44724, 19575, 31287, 36939, 43833, 3640, 67460, 66709, 68011, 69485, 10599, 59325,
+    7744, 68085, 40884, 58846, 48639, 22495, 39553, 7724, 14753, 50562, 39636, 42056, 11905, 42351, 20916, 44672,
+    47853, 9871, 49091, 53623, 21378, 21445, 59943, 53171, 52126, 61284, 48995, 34784, 64307, 28931, 16303, 57484,
+    52043, 14143, 1761, 15154, 64953, 10435, 30121, 6718, 22834, 60441, 13936, 46677, 28019, 25053, 44143, 60366,
+    44462, 25275, 59713, 65272, 41462, 37621, 42100, 20015, 1957, 4975, 26794, 50114, 53158, 61704, 20355, 27585,
+    46924, 21792, 12828, 2172, 369, 7021, 53576, 63629, 22336, 40695, 27836, 41881, 24261, 29838, 8895, 67331,
+    42421, 29784, 69410, 39718, 36097, 5345, 27811, 59254, 33314, 43406, 8140, 3997, 19946, 43227, 9814, 52278,
+    49769, 5287, 25442, 63273, 12568, 49442, 27844, 3652, 38794, 814, 23932, 17280, 14084, 26584, 46285, 19606,
+    18477, 48434, 7077, 12810, 64339, 47877, 37843, 47205, 43958, 9340, 29957, 31142, 41410, 42805, 64963, 29958,
+    64237, 12208, 25003, 8237, 11576, 59968, 49176, 30498, 21524, 32931, 19975, 54795, 19935, 25720, 36012, 30126,
+    17106, 21104, 49555, 8854, 20884, 57760, 56282, 49753, 17077, 5969, 13601, 59845, 23903, 63192, 32702, 60409,
+    57173, 41339, 11138, 53385, 11812, 8512, 29436, 70379, 63405, 35779, 25803, 9987, 27814, 242, 38879, 20683,
+    15308, 68752, 68404, 11177, 58602, 30525, 36051, 66296, 59630, 6354, 27243, 30813, 9793, 51253, 12335, 15977,
+    31597, 29027, 50031, 66221, 17935, 21997, 22224, 61115, 46004, 12431, 60056, 10462, 30910, 24854, 46937, 56548,
+    54103, 9932, 61581, 24672, 34758, 15640, 39873, 25498, 46996, 53499, 8977, 2310, 32846, 58867, 33689, 31577,
+    2404, 1226, 63557, 69585, 1084, 33000, 14899, 20337, 63823, 17352, 52621, 58800, 682, 6672, 10654, 51874,
+    5454, 30002, 56805, 1386, 60013, 2333, 20190, 23439, 61873, 36974, 54544, 38837, 30763, 62877, 44117, 13082,
+    46116, 39702, 28251, 22428, 29345, 68617, 15793, 47145, 19092, 2532, 23425, 13062, 42381, 30141, 20557, 70139,
+    56469, 60153, 40152, 61600, 55431, 11490, 27659, 10403, 34968, 42810, 12514, 48828, 46999, 38575, 55586, 60513,
+    50168, 18122, 35799, 39486, 31606, 67872, 51490, 38445, 60654, 66354, 550, 60781, 64619, 26705, 50049, 17156,
+    8055, 53655, 6833, 35183, 36354, 9230, 61819, 10798, 12998, 2246, 30171, 20106, 33616, 66599, 24339, 43850,
+    26170, 69263, 38004, 43462, 27130, 53640, 29510, 61915, 39625, 41545, 1332, 20515, 5271, 3237, 6312, 11442,
+    66866, 31624, 29983, 8552, 64626, 1102, 61983, 43880, 57167, 1097, 16392, 6734, 6311, 13108, 46385, 3918,
+    52812, 6187, 20203, 7918, 15732, 69387, 20657, 31203, 21873, 16730, 38771, 14555, 46844, 13305, 10043, 21409,
+    1794, 3394, 57732, 3664, 14393, 27770, 28774, 15137, 69327, 46943, 50780, 13021, 13520, 18304, 557, 488,
+    9973, 58927, 51505, 39543, 44661, 48647, 43226, 5094, 29279, 33695, 47305, 66686, 14055, 7293, 5833, 24772,
+    25212, 31591, 32872, 32412, 57030, 22504, 45645, 12512, 267, 6750, 64106, 32604, 32396, 1067, 47519, 67173,
+    17933, 68787, 37331, 5997, 37392, 1746, 49072, 55692, 58455, 62052, 32454, 15572, 52488, 7677, 45657, 11773,
+    67408, 3090, 38651, 70149, 22220, 35370, 4922, 58764, 33949, 51630, 49642, 55297, 5080, 57738, 67578, 30429,
+    48256, 42403, 63431, 62512, 39592, 62768, 20876, 64085, 3108, 17919, 17025, 19263, 70211, 18440, 52068, 66334,
+    35652, 10366, 14127, 53611, 2593, 47797, 58969, 13621, 55555, 26136, 39900, 16006, 26986, 44648, 12069, 51666,
+    13320, 18622, 20712, 24526, 1040, 58308, 4534, 37268, 4506, 38410, 33927, 52234, 68648, 41884, 4074, 48937,
+    28816, 39456, 38630, 3691, 47110, 36138, 5985, 22098, 48023, 58928, 64053, 66265, 36523, 61371, 59526, 53093,
+    18614, 37013, 56506, 45236, 57216, 1297, 49317, 9505, 8451, 28829, 43509, 14357, 42035, 54256, 55071, 36468,
+    3590, 8449, 10169, 44766, 3642, 13582, 12623, 17631, 40377, 8184, 18116, 60658, 56683, 46181, 16481, 15204,
+    69062, 40775, 44486, 58990, 44830, 9423, 12922, 16637, 21761, 8518, 31182, 29059, 39300, 34768, 35649, 31660,
+    22101, 27678, 55457, 27832, 13434, 22227, 40331, 52931, 30304, 70082, 17558, 54161, 32425, 50320, 1706, 33302,
+    2851, 35188, 69887, 33676, 24594, 68452, 43941, 50443, 66168, 52713, 11932, 63934, 46871, 34285, 64441, 63146,
+    52186, 12460, 27058, 33909, 61414, 70405, 10464, 2200, 8852, 36636, 27567, 33526, 65343, 67074, 41213, 34216,
+    12938, 2800, 11204, 59155, 19481, 43061, 51680, 15383, 46928, 16226, 18078, 7173, 17825, 3306, 10921, 33016,
+    56802, 16937, 38453, 29263, 63815, 16933, 13689, 15388, 55609, 34983, 35658, 13649, 30239, 68261, 4240, 64420,
+    58844, 11496, 30824, 20200, 51964, 14979, 13258, 60976, 65594, 8242, 57820, 11456, 47064, 1308, 58869, 7952,
+    21082, 29240, 495, 40971, 29807, 64429, 41709, 65247, 11783, 5110, 41289, 69611, 42893, 47655, 11978, 30601,
+    25957, 22452, 34211, 46019, 64811, 39466, 40634, 23615, 69894, 43591, 18861, 6294, 12152, 21541, 57770, 69278,
+    49335, 58579, 35985, 55039, 68214, 40958, 65680, 54001, 37367, 7740, 26972, 58951, 8542, 22979, 53982, 67773,
+    21032, 24409, 30977, 23287, 17149, 50039, 46088, 27353, 17216, 37920, 24637, 69790, 39787, 36279, 68924, 42214,
+    9328, 44634, 19866, 20509, 15979, 69203, 39115, 39852, 67960, 58128, 56642, 59787, 43904, 3058, 32205, 25794,
+    54455, 69693, 45381, 3125, 58915, 70286, 12803, 12819, 43030, 45002, 56842, 20394, 706, 16753, 35813, 67503,
+    11601, 25109, 53480, 34200, 68485, 61429, 14218, 5636, 15954, 35912, 65632, 69393, 34223, 58125, 42700, 15434,
+    25614, 65542, 11702, 65839, 38890, 47897, 58832, 10656, 50519, 57957, 6098, 53217, 35420, 12513, 23292, 60526,
+    8344, 38700, 34259, 34180, 30417, 42164, 41116, 4660, 29703, 62022, 7745, 3498, 32922, 61547, 48586, 31394,
+    11741, 4670, 63142, 51115, 11857, 28862, 18069, 11175, 36346, 58121, 54808, 33319, 51907, 36574, 53975, 14053,
+    60645, 24619, 47879, 686, 21011, 41768, 57464, 23676, 5790, 65156, 30402, 14464, 30655, 55207, 24445, 36626,
+    49052, 7275, 16406, 3047, 57123, 68347, 25649, 35376, 46433, 50117, 1470, 42540, 43424, 54856, 42712, 53913,
+    41168, 55818, 42586, 37623, 62160, 16874, 66683, 15233, 64975, 21906, 25729, 52373, 26552, 4106, 55480, 66281,
+    70212, 50853, 23606, 7985, 58464, 34115, 20373, 8701, 29870, 29411, 65664, 19172, 34205, 37388, 61997, 38918,
+    26606, 3736, 56107, 45891, 50759, 20701, 683, 15083, 6205, 39506, 65775, 29071, 61351, 916, 3678, 23535,
+    57318, 52968, 35999, 41062, 31550, 30030, 52423, 32871, 39902, 5901, 19639, 40692, 66152, 15719, 4280, 64084,
+    18266, 14969, 23599, 32066, 68060, 11350, 20628, 57034, 5297, 50529, 30306, 52768, 34500, 67644, 16135, 56916,
+    19515, 14005, 17006, 64724, 15001, 34114, 45907, 25130, 36988, 1434, 49874, 48955, 34447, 27557, 51924, 14749,
+    8570, 52914, 14318, 50111, 29686, 56677, 42200, 22906, 53120, 6824, 18308, 28675, 50452, 5863, 15284, 58849,
+    59451, 58223, 69296, 4199, 55385, 69364, 65682, 60254, 37881, 54005, 58292, 50581, 43388, 23063, 43796, 9251,
+    62349, 40176, 10874, 1358, 44803, 34834, 10996, 53721, 35809, 33567, 20582, 66135, 26376, 8926, 36061, 26764,
+    34912, 451, 43780, 32140, 17359, 9087, 55293, 3166, 14485, 15744, 68968, 29492, 23016, 1303, 2224, 9342,
+    29725, 56912, 70372, 56525, 7494, 39970, 32914, 37665, 516, 24774, 17078, 47927, 51711, 37208, 35414, 68863,
+    49197, 23826, 49221, 36770, 10505, 36297, 9538, 66039, 54110, 5177, 41303, 37027, 40991, 33092, 62265, 57929,
+    46007, 46475, 47058, 7880, 58518, 2281, 49296, 36094, 4094, 15613, 26589, 1748, 6169, 50821, 23092, 37336,
+    52518, 7937, 54564, 30634, 15355, 15427, 60589, 9072, 60907, 3328, 64519, 20786, 9367, 61157, 30499, 200,
+    42549, 41539, 20277, 5596, 23665, 27304, 18904, 14223, 47139, 15422, 66351, 17095, 68511, 58056, 51699, 13677,
+    12580, 8206, 50723, 60731, 51164, 9674, 23593, 60572, 67138, 69284, 2142, 62775, 52400, 54050, 27269, 47616,
+    33171, 28100, 39630, 57698, 46295, 37457, 19310, 55399, 58352, 56843, 7592, 20328, 6040, 59376, 5774, 46636,
+    50378, 64079, 13499, 60840, 63906, 33439, 25836, 43408, 25558, 68550, 30774, 23351, 502, 6017, 33513, 40709,
+    64045, 63643, 14615, 42819, 61646, 63188, 66295, 8408, 56089, 24699, 15391, 41644, 6827, 25530, 31470, 17027,
+    34732, 63523, 41526, 11931, 28193, 16584, 12465, 12856, 6014, 9139, 70078, 1797, 63656, 55053, 30224, 44741,
+    8513, 23025, 34884, 42226, 2050, 1101, 33950, 25575, 3976, 33978, 38426, 46248, 16646, 64785, 15514, 70397,
+    4718, 39367, 67172, 65827, 62142, 10244, 55047, 38033, 20700, 11339, 37041, 30185, 28451, 5418, 26842, 56435,
+    16070, 45699, 36949, 28899, 45274, 49732, 12808, 55, 64604, 35540, 29759, 23172, 48757, 259, 68807, 32851,
+    14501, 3418, 13736, 21059, 70056, 44073, 45322, 49609, 13408, 20989, 49596, 69927, 428, 8462, 11092, 44430,
+    62568, 42550, 38162, 25169, 7968, 67585, 40257, 54876, 41599, 44848, 2258, 13042, 11148, 5008, 55790, 56863,
+    7169, 41716, 43229, 54082, 22333, 20470, 40642, 10453, 60033, 48961, 55997, 36202, 68959, 40730, 49854, 49637,
+    9428, 17469, 23479, 19662, 333, 57735, 38546, 65250, 63636, 54318, 13874, 24912, 51627, 33968, 7941, 30529,
+    29549, 60672, 37597, 31592, 45083, 32690, 63100, 54261, 51451, 63257, 17163, 30490, 7110, 18588, 50878, 15307,
+    52113, 33606, 22378, 2060, 30084, 47600, 47080, 31658, 26228, 37778, 17927, 51525, 14643, 46123, 52666, 41444,
+    30395, 22570, 31514, 31047, 15345, 25166, 51018, 69010, 43823, 20534, 11024, 40975, 34574, 33617, 56135, 49893,
+    21129, 37560, 36176, 24506, 185, 46011, 31726, 23719, 12790, 43875, 26835, 57655, 30468, 6399, 33681, 9875,
+    55665, 42710, 2866, 39315, 11537, 63117, 51683, 17905, 67241, 49320, 7679, 36956, 34419, 29951, 45310, 45191,
+    39070, 18023, 10123, 70310, 67674, 64964, 58415, 25238, 46994, 24033, 30626, 27272, 24310, 29257, 60777, 32790,
+    17707, 45316, 67881, 41075, 2386, 67293, 46040, 62680, 58252, 70033, 30046, 11680, 2456, 13384, 62552, 62333,
+    50059, 4387, 42327, 57826, 19096, 14285, 27020, 53076, 64986, 5010, 55428, 7420, 30222, 36798, 21765, 55977,
+    4625, 35030, 52776, 17248, 57465, 4173, 66440, 44536, 760, 31361, 27938, 7429, 68674, 13809, 42625, 67342,
+    58243, 289, 48253, 20501, 28924, 7848, 62212, 69609, 2640, 4596, 48043, 15404, 30743, 11278, 41903, 55894,
+    4130, 5621, 49053, 49736, 63222, 47133, 33847, 23454, 27511, 59314, 20398, 19820, 50067, 65374, 43119, 39651,
+    5320, 12649, 53374, 14974, 939, 66157, 49374, 35488, 17555, 32891, 61308, 68711, 40486, 58016, 52129, 69804,
+    39384, 40977, 8672, 30493, 64019, 19354, 40314, 9128, 29994, 58555, 36760, 29312, 29182, 65057, 51849, 60136,
+    55463, 23817, 35218, 62561, 15500, 45120, 6756, 52062, 29884, 13572, 64254, 51045, 21280, 42114, 67860, 3802,
+    53087, 21934, 35724, 5075, 32247, 56474, 40967, 8472, 30691, 10614, 53794, 28522, 10331, 68407, 14338, 12878,
+    36008, 67266, 32926, 43299, 25591, 43730, 42882, 26517, 23870, 30741, 47482, 42004, 41123, 31561, 39327, 55570,
+    57628, 14978, 56520, 56371, 42414, 58672, 65403, 43147, 35312, 54056, 28077, 37160, 62796, 57999, 42933, 17543,
+    33042, 56432, 40330, 57502, 32086, 63959, 48351, 2545, 6478, 8741, 49327, 56602, 66960, 39721, 70181, 59581,
+    40507, 4023, 38110, 56706, 61202, 60238, 42546, 51692, 34416, 34299, 17700, 4989, 66259, 9865, 9833, 1893,
+    51847, 39542, 26754, 34303, 44832, 8428, 21595, 22420, 11690, 27847, 540, 2083, 51651, 4330, 15248, 7149,
+    66399, 43104, 16640, 44897, 34425, 23659, 25449, 19840, 14202, 69862, 55562, 44968, 21047, 52849, 363, 53114,
+    56710, 17732, 3005, 8706, 16956, 49323, 22240, 22740, 27879, 54006, 45208, 40272, 31213, 11250, 61399, 64879,
+    42846, 58143, 7829, 68469, 50344, 2985, 5795, 21865, 55253, 11723, 14183, 47263, 43517, 48830, 68388, 51057,
+    55419, 21759, 34886, 63687, 25464, 59960, 27750, 18432, 68359, 66830, 29301, 18913, 42023, 12125, 48094, 68223,
+    11989, 32571, 5373, 55760, 39405, 50110, 9036, 34506, 2706, 32775, 23767, 21612, 16566, 60037, 48137, 64838,
+    50741, 47273, 58776, 48057, 23771, 33205, 20146, 30131, 60230, 5410, 32019, 38991, 66258, 59807, 66102, 20463,
+    42247, 48261, 70455, 5638, 68003, 16587, 19451, 17219, 17798, 52196, 51862, 5204, 16925, 47253, 32414, 22779,
+    61256, 24320, 24461, 63310, 62222, 18340, 6729, 55174, 47012, 62990, 60506, 24887, 60775, 63809, 64321, 55466,
+    8486, 46246, 55012, 44235, 41860, 30182, 10724, 60455, 49755, 14906, 52815, 54855, 47736, 56854, 34604, 60514,
+    20950, 40900, 67648, 9996, 37385, 66917, 26691, 43238, 55951, 50180, 16498, 29287, 15771, 46550, 14959, 23041,
+    40811, 25174, 60568, 41513, 49372, 53242, 54802, 49005, 40229, 56692, 10071, 6542, 13338, 49300, 65941, 32591,
+    16399, 48797, 41672, 48239, 33559, 32983, 19560, 34547, 63445, 34883, 45773, 901, 35021, 49684, 26345, 41381,
+    21881, 10498, 35955, 9789, 57534, 20718, 373, 31370, 23515, 48790, 603, 21778, 43504, 70081, 14465, 48474,
+    49059, 54143, 7818, 25924, 25741, 56046, 45188, 15315, 31160, 60433, 18838, 2980, 43794, 19086, 55886, 14679,
+    22725, 68724, 57467, 69797, 17173, 30095, 46347, 30045, 16869, 41065, 63913, 63420, 67123, 55646, 35103, 30648,
+    52583, 5671, 22300, 70206, 40275, 22394, 18246, 46446, 37744, 8684, 33964, 51201, 10647, 55996, 2476, 25698,
+    33916, 49535, 55827, 47383, 9942, 43271, 21784, 7537, 70283, 66520, 42646, 69806, 58022, 30987, 8211, 51685,
+    30477, 62181, 24873, 48595, 31473, 31332, 11948, 63905, 66695, 52154, 10390, 14846, 13745, 20877, 66549, 26767,
+    39650, 21753, 35814, 57684, 38339, 47131, 39508, 55098, 31100, 19270, 45182, 62843, 21278, 1030, 24714, 21708,
+    56315, 47648, 15295, 69307, 54339, 44392, 41656, 38728, 64701, 47002, 46561, 62006, 10054, 3037, 63592, 58120,
+    63724, 50903, 64938, 69779, 48019, 58312, 15568, 36495, 35822, 16968, 69054, 63046, 45738, 24270, 48943, 42781,
+    64465, 39145, 18832, 8732, 42948, 36979, 27616, 58643, 62408, 3885, 46707, 24168, 37210, 5684, 23609, 47849,
+    57872, 44165, 65428, 2002, 38431, 19400, 29115, 45302, 9548, 4436, 61786, 34331, 37162, 34407, 46162, 50398,
+    63389, 3838, 12942, 18010, 67923, 17345, 41946, 66933, 31521, 65170, 61161, 4806, 66235, 28018, 38717, 19195,
+    51219, 64360, 31197, 2378, 36488, 36182, 17803, 53127, 38490, 48501, 23534, 67868, 67095, 45533, 26057, 4043,
+    2389, 31922, 59756, 46615, 49938, 47859, 2945, 30159, 9931, 19217, 65916, 25942, 8927, 15696, 37971, 18176,
+    59146, 57150, 69074, 56472, 1124, 16777, 5047, 9440, 54981, 5049, 1600, 13272, 4674, 60157, 30285, 69399,
+    55217, 51153, 27727, 40926, 53112, 61506, 62415, 38564, 6614, 55560, 28487, 60975, 24209, 45648, 18897, 9382,
+    52369, 4521, 19198, 3494, 37962, 66479, 55840, 7209, 8911, 32831, 22095, 36696, 30, 29007, 14073, 13982,
+    35138, 3856, 56337, 41402, 13394, 39296, 22939, 2249, 22169, 43727, 24194, 34691, 57782, 14954, 63247, 62347,
+    24144, 22276, 8295, 2398, 52335, 55880, 18755, 68770, 50824, 33364, 5089, 33975, 16676, 32759, 5947, 23865,
+    49782, 66406, 50730, 23866, 21120, 36079, 8273, 38604, 2760, 39573, 64934, 27757, 46439, 35307, 48566, 45991,
+    26237, 35140, 14663, 47127, 38548, 47631, 60389, 56026, 18779, 11488, 25456, 8978, 22953, 53553, 44396, 51784,
+    64509, 55565, 22266, 39012, 48891, 12855, 49348, 18310, 7544, 54053, 47332, 37445, 11719, 17870, 47561, 65357,
+    67807, 17071, 46258, 61490, 8210, 5192, 49356, 56242, 44644, 1703, 54203, 41094, 57403, 60308, 799, 14892,
+    39835, 50805, 8485, 49095, 69768, 18812, 61476, 49252, 31031, 5152, 16038, 16075, 57409, 21281, 36005, 37646,
+    25938, 22366, 56707, 46431, 3502, 50274, 58745, 13352, 53869, 42183, 50474, 49613, 10062, 68861, 34072, 64051,
+    31652, 9246, 47766, 48260, 22476, 68416, 37562, 56091, 48275, 69634, 16588, 7663, 15891, 69378, 52600, 34137,
+    51003, 36833, 35291, 18797, 5359, 8644, 26510, 65823, 38706, 39110, 32162, 7359, 70249, 28734, 49847, 65313,
+    39361, 54042, 62829, 45044, 60866, 58342, 46100, 68791, 57001, 4042, 58817, 46163, 2853, 22427, 17944, 9718,
+    49049, 65130, 34079, 26308, 44978, 26428, 11711, 53040, 47279, 5314, 18106, 12147, 57003, 50560, 9135, 24649,
+    55105, 23714, 64869, 22729, 67289, 14374, 47048, 514, 59533, 31158, 59651, 9183, 30354, 12946, 23282, 7416,
+    27819, 53113, 54502, 23409, 57451, 37431, 63057, 12549, 49016, 9264, 31780, 35915, 69627, 60196, 11500, 64756,
+    39269, 30513, 10719, 27544, 27069, 34453, 37488, 23504, 5273, 12550, 3955, 26673, 15967, 68647, 63108, 66513,
+    42353, 32474, 52021, 57481, 60107, 69719, 40727, 25323, 45436, 30617, 48183, 1406, 5683, 4008, 21978, 18268,
+    53656, 65389, 68595, 60164, 15414, 14566, 39239, 22820, 26174, 56899, 42719, 21856, 11859, 14520, 47391, 38182,
+    32745, 47101, 55121, 26571, 6326, 51947, 28282, 38242, 51957, 52503, 19655, 54533, 32774, 28955, 8399, 8409,
+    35482, 18941, 22092, 36510, 50504, 38011, 57434, 55269, 57099, 13249, 9818, 28543, 63792, 12381, 37817, 50618,
+    67392, 21596, 53012, 4414, 70204, 223, 25350, 4777, 24636, 1294, 62123, 48563, 63467, 38851, 3614, 20859,
+    3327, 46536, 26008, 18909, 64002, 13815, 21870, 23878, 12423, 49489, 44253, 28474, 7622, 43879, 25358, 17170,
+    52754, 66015, 42450, 12671, 12321, 10659, 60699, 57597, 13367, 9773, 12383, 11448, 61146, 5226, 28271, 56750,
+    43020, 67302, 2674, 35514, 52981, 7074, 57094, 68955, 50631, 39271, 51583, 2762, 38089, 59229, 63204, 58220,
+    7012, 42026, 1850, 45549, 63452, 6331, 41590, 51994, 10025, 56293, 62878, 59871, 34471, 67815, 28024, 41198,
+    64276, 57667, 70451, 2452, 37251, 22473, 7059, 8096, 18603, 49910, 19392, 7455, 29536, 39708, 22077, 3383,
+    31828, 22171, 61058, 43236, 65018, 21020, 35977, 30667, 50552, 60729, 22402, 51368, 42609, 49211, 20625, 68855,
+    34497, 47092, 20987, 57587, 44959, 32564, 26385, 45537, 30315, 57913, 24597, 26738, 36959, 69316, 66291, 33215,
+    53218, 1392, 63383, 18661, 32683, 35897, 56991, 31013, 37675, 6761, 58001, 47266, 36866, 19043, 17916, 47703,
+    65683, 56748, 40249, 5650, 10744, 16674, 21463, 721, 36797, 39166, 22257, 21192, 32421, 44582, 15628, 31227,
+    33359, 33333, 32435, 66626, 792, 13584, 68044, 65278, 6264, 48337, 67166, 15340, 64058, 68122, 61252, 22719,
+    44319, 30952, 30327, 10372, 8006, 61823, 6864, 30243, 31626, 54886, 33273, 6263, 27789, 52643, 39521, 57106,
+    37307, 47610, 14980, 52339, 63235, 14394, 27572, 69176, 58279, 41013, 32600, 19729, 36040, 22575, 27907, 16762,
+    28045, 44570, 8473, 35342, 11170, 8836, 62013, 19012, 5864, 61217, 41070, 47328, 14385, 4359, 62046, 7029,
+    21886, 41336, 62632, 6508, 20581, 1535, 45335, 48689, 13777, 11515, 56069, 27084, 58972, 46760, 31899, 54150,
+    61274, 8193, 13913, 66075, 59257, 24993, 10516, 26789, 9786, 39033, 3465, 66016, 22230, 25300, 23165, 49237,
+    35462, 28729, 37291, 33262, 16397, 2334, 43900, 37865, 14885, 2953, 1160, 4998, 6106, 14057, 17234, 34704,
+    1443, 43991, 4896, 12848, 155, 26015, 13463, 28962, 53415, 31538, 32744, 28814, 57825, 56737, 56669, 52187,
+    47972, 9791, 14250, 21710, 17165, 25101, 3568, 66116, 38781, 55234, 55906, 55427, 40827, 26497, 28410, 53018,
+    59093, 6059, 57859, 16540, 38348, 37765, 54977, 31654, 44019, 66165, 59194, 53507, 3315, 10975, 31241, 8437,
+    47082, 7255, 52057, 41307, 69495, 39462, 25099, 7902, 27365, 53768, 56852, 45469, 29787, 23436, 41200, 18324,
+    65301, 14360, 36987, 1903, 55418, 66482, 10053, 47718, 251, 28386, 62186, 44759, 6752, 34779, 62247, 1578,
+    25658, 31883, 24113, 61597, 3475, 14498, 31882, 41346, 45400, 36268, 5188, 51539, 35684, 1764, 9632, 7162,
+    35767, 29138, 70421, 22439, 41928, 55091, 5032, 64763, 39823, 60004, 16256, 65212, 50943, 52918, 62255, 24239,
+    10150, 26740, 27715, 40054, 36478, 33790, 19709, 25355, 39411, 19919, 23378, 12498, 17531, 10380, 5792, 22700,
+    58425, 8524, 11186, 33295, 17467, 13771, 39330, 63259, 21191, 31472, 13126, 53834, 12399, 33311, 23980, 3118,
+    15171, 9479, 69213, 66467, 19151, 2784, 35763, 67554, 51022, 61377, 13886, 24482, 339, 43231, 68688, 3361,
+    26255, 52244, 25363, 62888, 28954, 59108, 19831, 58850, 70058, 60962, 1803, 36076, 46170, 5382, 34631, 9343,
+    293, 33525, 23608, 45512, 10556, 32954, 22530, 59671, 27116, 22034, 135, 5669, 10463, 34591, 10768, 39888,
+    54859, 26330, 18363, 54441, 49611, 67248, 12077, 27698, 64971, 66893, 19476, 14234, 51127, 45018, 59430, 68330,
+    748, 5508, 61160, 29780, 51807, 19708, 46335, 35941, 5935, 50162, 30823, 26166, 9915, 20605, 11892, 10622,
+    31942, 64711, 63114, 22251, 56451, 54601, 35418, 10613, 22753, 4290, 36887, 31555, 10011, 17751, 23635, 471,
+    16552, 13390, 21274, 44279, 225, 11973, 51668, 55943, 55162, 3911, 11900, 58544, 69867, 63098, 16279, 9935,
+    57917, 24650, 46345, 19746, 68618, 2765, 70159, 51011, 10450, 16222, 11753, 62618, 21520, 16457, 65465, 65789,
+    25907, 48411, 43116, 40956, 17233, 63194, 18517, 44332, 49217, 61648, 41343, 37283, 21767, 10490, 55509, 26909,
+    16085, 42477, 70032, 66754, 21665, 1156, 14363, 38730, 34364, 2069, 23388, 1948, 22692, 14174, 24217, 4849,
+    64288, 52422, 67915, 14937, 50985, 16795, 70270, 61549, 59081, 46608, 27532, 7974, 10949, 34437, 32456, 56675,
+    46294, 38295, 45867, 26689, 2579, 41618, 16807, 64112, 48746, 44851, 30831, 35593, 51789, 7504, 56215, 14178,
+    55994, 9573, 58855, 32039, 9297, 25419, 55030, 26091, 53067, 45954, 26177, 67414, 17685, 40191, 52372, 5456,
+    2409, 60114, 33674, 49649, 27874, 33142, 10765, 34681, 68398, 30333, 48347, 9843, 35730, 54515, 59667, 59289,
+    11389, 8282, 23110, 23478, 4331, 51383, 30278, 41714, 49607, 36791, 64409, 3038, 45071, 11064, 42384, 28235,
+    27646, 9547, 27195, 28467, 42484, 25293, 45373, 64162, 12829, 41870, 9375, 23931, 33389, 21993, 350, 48651,
+    66882, 12180, 30801, 16437, 21858, 14779, 60166, 36044, 53309, 61509, 19105, 36283, 33573, 22441, 36288, 16098,
+    17909, 3159, 16853, 15596, 70495, 7086, 11837, 67070, 66443, 59228, 21553, 68268, 17817, 29174, 6138, 18096,
+    21286, 50391, 49015, 2616, 23492, 63921, 58740, 60525, 42286, 27061, 69514, 63696, 214, 40762, 42452, 66999,
+    51155, 39297, 7610, 35607, 14951, 32362, 42580, 10926, 1848, 46880, 9366, 66477, 14856, 16112, 32582, 39670,
+    43919, 15897, 11318, 24544, 20482, 68671, 33664, 5476, 29664, 28607, 24763, 16787, 880, 28030, 25052, 5308,
+    114, 39842, 30570, 59147, 68768, 64326, 1043, 30189, 36905, 61761, 42591, 13969, 33540, 35276, 28475, 10367,
+    8965, 24658, 49567, 20341, 1519, 36387, 44624, 9738, 21299, 69923, 19210, 58880, 11274, 67495, 65804, 38414,
+    64356, 64026, 60686, 38800, 44720, 27843, 70515, 15333, 53011, 55345, 19892, 68972, 54566, 52148, 3628, 5734,
+    37515, 21165, 38311, 5351, 40060, 10307, 19152, 12040, 54885, 60642, 16109, 56783, 35735, 25634, 46171, 63813,
+    54664, 45006, 59027, 41847, 49930, 61981, 36825, 68450, 8497, 25276, 59700, 68271, 10822, 44952, 14740, 22144,
+    47532, 58961, 17449, 36253, 38623, 51128, 25645, 21457, 29406, 16151, 19978, 38704, 38081, 39918, 31481, 41603,
+    52399, 20284, 4368, 9724, 63987, 61974, 39733, 7656, 49042, 64861, 29399, 9524, 30098, 52749, 67170, 52090,
+    65724, 25858, 6327, 5375, 11113, 30937, 66823, 60034, 13205, 38708, 18411, 49496, 26418, 60073, 48906, 58778,
+    20183, 1914, 60534, 30160, 39586, 42613, 44631, 12400, 22676, 47801, 38370, 61728, 50064, 41980, 19942, 7703,
+    53404, 29866, 56703, 3007, 44894, 61567, 38111, 8474, 27167, 20801, 67586, 34061, 2178, 70001, 59410, 27543,
+    57608, 53743, 69632, 50863, 40764, 62794, 60, 8748, 27143, 11984, 64490, 46286, 49661, 32120, 17599, 56528,
+    5471, 31544, 381, 34524, 63920, 2804, 36724, 25474, 14325, 67357, 42611, 35602, 9116, 13509, 41573, 9077,
+    50645, 48922, 16299, 64447, 50999, 67500, 69019, 47779, 38022, 9207, 14004, 46034, 60316, 7614, 69553, 23815,
+    63766, 45073, 9427, 36608, 63596, 70390, 5227, 7589, 42794, 17628, 49881, 35575, 21557, 63546, 64981, 7850,
+    3484, 3135, 10031, 59727, 16654, 58295, 11928, 43044, 4832, 27702, 25386, 44260, 54767, 45666, 65388, 3975,
+    31892, 1431, 40577, 64959, 67077, 39340, 2935, 56587, 36575, 61836, 30338, 41930, 38873, 62245, 29756, 43683,
+    29039, 65181, 62785, 27597, 6360, 60370, 49994, 524, 56095, 42101, 26121, 67110, 50098, 42485, 20667, 7,
+    15169, 3742, 5786, 31485, 45912, 500, 1223, 18657, 27199, 49837, 61132, 59298, 48418, 12327, 52711, 10658,
+    59334, 55621, 11881, 45206, 20087, 57662, 50348, 6204, 57831, 1932, 14204, 20727, 20385, 4761, 31948, 18315,
+    26727, 19594, 34149, 4328, 57342, 30587, 82, 6357, 33564, 14968, 69189, 55594, 59217, 48842, 16453, 2952,
+    67943, 13891, 22520, 54149, 14596, 61966, 50702, 25983, 28835, 25354, 12637, 24, 44198, 8704, 67140, 60850,
+    46195, 35274, 20731, 36506, 54504, 26122, 69889, 6454, 20648, 15497, 70453, 3002, 52122, 29165, 60792, 9276,
+    60636, 15519, 31265, 2474, 10299, 30793, 30100, 45327, 47492, 46700, 22758, 44335, 18782, 51801, 69470, 18446,
+    2719, 13374, 33288, 46274, 52912, 67896, 49789, 13507, 43242, 67720, 41366, 19032, 6830, 55223, 15805, 65399,
+    20285, 42811, 62173, 2541, 30223, 48370, 39746, 48021, 738, 33196, 34254, 43892, 31738, 13881, 44411, 62591,
+    54700, 68240, 36883, 31915, 67595, 18118, 39493, 33818, 4512, 44508, 2040, 45899, 1378, 61481, 29092, 55454,
+    44588, 10466, 66755, 65153, 66736, 777, 29548, 1032, 42644, 69964, 54396, 32274, 3773, 19345, 46534, 45420,
+    44633, 10787, 6223, 61425, 26697, 69151, 41490, 48496, 55995, 17180, 45815, 28933, 45054, 19647, 26565, 69132,
+    39728, 69691, 60926, 39130, 5572, 20601, 20586, 11883, 23979, 40293, 28969, 53363, 24531, 31636, 44542, 25443,
+    20089, 49305, 58210, 5655, 58488, 27477, 12961, 21830, 21790, 51088, 59783, 38998, 16144, 34999, 63137, 24801,
+    49253, 1269, 10220, 67372, 38054, 64247, 11554, 56565, 58825, 60140, 7446, 25946, 39081, 10754, 61531, 9762,
+    63895, 40817, 52363, 4484, 26829, 68657, 49241, 11349, 42236, 47969, 70045, 980, 64680, 51609, 5085, 9827,
+    16514, 39811, 56041, 48503, 42178, 18244, 28773, 53227, 26816, 43046, 44131, 28855, 7431, 3333, 44274, 14597,
+    40679, 35077, 7885, 56155, 53467, 4377, 67640, 46478, 26585, 33453, 68761, 12276, 17257, 50271, 39764, 12361,
+    54371, 66330, 59982, 33306, 31174, 69926, 39571, 24273, 48451, 62822, 53493, 51206, 24992, 17339, 67509, 56769,
+    32479, 60018, 42103, 65361, 64214, 39621, 44070, 57578, 40145, 5221, 18798, 16628, 13353, 49889, 17471, 51208,
+    21882, 50620, 6708, 48866, 15772, 7289, 57076, 21101, 50902, 10561, 41328, 62946, 16073, 56001, 56137, 5765,
+    34085, 31804, 51246, 32294, 14272, 1111, 41208, 66689, 45689, 49929, 20932, 22951, 25370, 6868, 19956, 63824,
+    36036, 13659, 42316, 13061, 11698, 55038, 36859, 55559, 34358, 5444, 41630, 54810, 62214, 39868, 68297, 2526,
+    54547, 5228, 922, 25415, 60039, 663, 1817, 41591, 33977, 54064, 30335, 62926, 11685, 30374, 66862, 62810,
+    14414, 55441, 69970, 13958, 3105, 69002, 48592, 70183, 49179, 1735, 11409, 50457, 65191, 1162, 2624, 20606,
+    9779, 17822, 42112, 17231, 59869, 67467, 29468, 45383, 15312, 14553, 39262, 33286, 20453, 10499, 19707, 28469,
+    6435, 30825, 58407, 47651, 22582, 11079, 42182, 26655, 30281, 50382, 64772, 3887, 9734, 56861, 56152, 44944,
+    67602, 4488, 13125, 44826, 70197, 29206, 64385, 58642, 14343, 18628, 65120, 43666, 47051, 16164, 5616, 35606,
+    59993, 42263, 34771, 49131, 17100, 22281, 54287, 33046, 19957, 65920, 31194, 65590, 42567, 15381, 53447, 25848,
+    32676, 16580, 33105, 41089, 31686, 8104, 4486, 18643, 64926, 56173, 1580, 41896, 55005, 21554, 22982, 28948,
+    62987, 6995, 37594, 42763, 45613, 65628, 44301, 70157, 37073, 17860, 51731, 62188, 41201, 49013, 57567, 34601,
+    2540, 48070, 51772, 24006, 29107, 21983, 70518, 23022, 63710, 46254, 48510, 47996, 39947, 69944, 53624, 26538,
+    38673, 37758, 59008, 37368, 67750, 25476, 56261, 20271, 54725, 68712, 19040, 63877, 55124, 28956, 11590, 58385,
+    4261, 7177, 18184, 51326, 27589, 14293, 6623, 25098, 48896, 10212, 7827, 70072, 25537, 9944, 24000, 1088,
+    4629, 6564, 69365, 19686, 3052, 40826, 2733, 57281, 10619, 61914, 64277, 60828, 33979, 56264, 67471, 49954,
+    47366, 45375, 32400, 15902, 48681, 44055, 33703, 63372, 56176, 11899, 19071, 94, 10481, 50766, 56185, 7591,
+    19598, 52403, 10552, 19890, 10804, 27342, 54610, 58319, 57713, 19424, 52248, 70424, 59243, 39461, 48751, 55410,
+    14861, 47397, 33007, 62457, 16115, 17877, 49218, 205, 17879, 8362, 7147, 23694, 67573, 23942, 68500, 69917,
+    26588, 50659, 590, 31962, 59088, 10695, 32754, 65393, 66706, 60666, 61173, 8526, 22252, 4732, 43670, 31278,
+    31714, 30595, 21261, 62302, 48555, 885, 56676, 41037, 36858, 11140, 43577, 55932, 5521, 50116, 839, 67036,
+    70365, 23690, 31296, 54932, 15660, 48163, 57078, 24155, 57603, 20097, 33543, 48603, 26007, 25927, 5821, 53778,
+    19339, 23316, 4182, 28436, 66012, 4651, 36489, 57589, 1826, 69924, 65519, 49495, 56686, 7267, 10121, 52780,
+    48174, 21641, 41873, 58301, 68646, 40159, 1527, 5093, 40936, 22652, 26168, 58380, 34315, 54966, 68129, 3574,
+    68117, 36429, 62420, 15292, 27260, 38133, 39697, 56275, 66632, 41086, 6997, 36178, 16619, 27804, 55190, 69004,
+    43595, 42446, 20481, 67243, 50804, 29904, 1894, 49262, 53596, 65460, 18567, 69606, 64575, 45092, 55828, 1857,
+    5872, 23205, 42825, 69493, 36246, 63261, 69580, 55700, 38244, 68335, 10723, 18602, 3340, 4117, 15130, 70337,
+    11848, 29809, 46533, 40805, 54604, 28046, 25301, 32260, 14355, 27361, 59396, 54145, 14476, 55810, 26926, 28128,
+    69101, 53863, 46965, 59635, 21808, 55485, 63949, 50921, 60713, 20008, 7268, 21924, 20253, 20084, 52718, 22444,
+    10283, 33211, 29618, 49944, 1514, 48578, 11257, 59042, 10662, 51790, 30207, 5498, 68203, 40745, 59625, 8573,
+    45481, 48650, 20036, 67343, 55566, 44266, 14242, 60981, 31656, 20437, 39837, 32502, 19305, 65978, 60946, 45235,
+    45003, 3121, 35345, 46626, 60897, 21685, 10877, 53733, 48622, 42494, 1152, 28418, 25406, 51898, 13956, 37345,
+    30186, 63854, 52204, 59544, 70539, 12309, 28681, 38600, 45110, 9502, 925, 66337, 67904, 59951, 22638, 31173,
+    28280, 13934, 10176, 37084, 65818, 37569, 7440, 28490, 47997, 10688, 9326, 1437, 20313, 38103, 42575, 44929,
+    41060, 3305, 32000, 59770, 63167, 5340, 56429, 13746, 52811, 27132, 2906, 64824, 2136, 51848, 1888, 59115,
+    2736, 34038, 5731, 2010, 32338, 41432, 55280, 46092, 36721, 866, 70536, 36637, 22048, 49894, 15986, 18546,
+    27320, 47191, 67008, 54130, 18810, 64853, 15092, 6288, 36656, 45518, 62303, 13686, 40937, 52124, 49233, 67407,
+    26536, 4471, 19353, 61341, 20358, 16224, 17330, 372, 40798, 20541, 16631, 33192, 10439, 65226, 28614, 28979,
+    44510, 19518, 36817, 12066, 68837, 47151, 58482, 62189, 60053, 30385, 66710, 5853, 52694, 36899, 37004, 23930,
+    61489, 29062, 57376, 10776, 38099, 34913, 27120, 19619, 4111, 22988, 27537, 751, 69388, 50998, 24329, 25302,
+    48892, 16785, 40028, 43984, 39662, 6601, 68008, 33089, 26718, 25379, 22319, 39848, 62268, 50463, 39684, 46032,
+    53274, 13006, 45940, 3411, 29195, 51185, 6412, 28699, 33402, 55705, 12581, 22164, 17488, 8, 51455, 39791,
+    68252, 12800, 29328, 30392, 18673, 15796, 29705, 55990, 4599, 26741, 53476, 26380, 51613, 29032, 34564, 26802,
+    31985, 54087, 6053, 37029, 53314, 31063, 33780, 48898, 18267, 11192, 65623, 59622, 4973, 55756, 67259, 38892,
+    10375, 33813, 60698, 53180, 42379, 45798, 50361, 12907, 62656, 52525, 12124, 59893, 28652, 15939, 32077, 66047,
+    38790, 20387, 28029, 63430, 59974, 51702, 67991, 43492, 47032, 51435, 44457, 54113, 43196, 36335, 54030, 21021,
+    23215, 58409, 14188, 48293, 45589, 22800, 8859, 30588, 41673, 56568, 33145, 12716, 24605, 17567, 27966, 47160,
+    31164, 45636, 37413, 51349, 21492, 69582, 54427, 1726, 8339, 61767, 18615, 65344, 16033, 62764, 18172, 26683,
+    19147, 38398, 26525, 6785, 63734, 7788, 42849, 69843, 35621, 52360, 19982, 34427, 15806, 51768, 62329, 51376,
+    69157, 15445, 66149, 12198, 69430, 11519, 45823, 16896, 40430, 11095, 6552, 48628, 26367, 51758, 43942, 41262,
+    61852, 67561, 31060, 63753, 36424, 66053, 41189, 45387, 54368, 49001, 18745, 37626, 9234, 44018, 40061, 33293,
+    9359, 26422, 36060, 38318, 24722, 58367, 16140, 18676, 15361, 4297, 4930, 60246, 41759, 41593, 22790, 37911,
+    20207, 60319, 27432, 25201, 4728, 48688, 38190, 32111, 59726, 4475, 14505, 31080, 56606, 42489, 5037, 53472,
+    1070, 42911, 26288, 63049, 1252, 21169, 45691, 31646, 31337, 14570, 29113, 59318, 42420, 1777, 38118, 51256,
+    4278, 22987, 56572, 5758, 31326, 63200, 17350, 54164, 37513, 15952, 30868, 8515, 55969, 47336, 58284, 23742,
+    22388, 55070, 66930, 27460, 63937, 68814, 15585, 62021, 16754, 51716, 29047, 34354, 56510, 25597, 2653, 4680,
+    8147, 68405, 33290, 16686, 26847, 23423, 11958, 5153, 68233, 34154, 21610, 55368, 24430, 37907, 59524, 11062,
+    67276, 43195, 13147, 57449, 17693, 25339, 66688, 26333, 61138, 49088, 47290, 49724, 68479, 51248, 14009, 24635,
+    16388, 35292, 49096, 59286, 35820, 47949, 12839, 8639, 28401, 36189, 53675, 33495, 66375, 50151, 49772, 22089,
+    33867, 32102, 318, 32957, 41125, 62010, 59195, 58907, 39775, 20666, 32326, 67087, 60701, 50809, 17261, 5907,
+    24537, 65930, 50008, 19861, 45201, 31062, 67908, 12619, 22888, 21825, 17857, 56417, 69615, 43372, 18307, 56627,
+    60591, 18298, 54538, 33202, 42632, 18376, 137, 27466, 43409, 1629, 14939, 39126, 21262, 42328, 64363, 64470,
+    51036, 37103, 69063, 60538, 57921, 28825, 9701, 13842, 35937, 53981, 22738, 8105, 55681, 49291, 47989, 52071,
+    38405, 1553, 51646, 3674, 9425, 56812, 31366, 27827, 31641, 56780, 36289, 22522, 66613, 51441, 17884, 63128,
+    63409, 15274, 63512, 36597, 15170, 36115, 57761, 15125, 14930, 51563, 21648, 26350, 53330, 7534, 8400, 9589,
+    59265, 34921, 50494, 55165, 63971, 37998, 25810, 60280, 39961, 19675, 9047, 48611, 4745, 45069, 67163, 3365,
+    67199, 15287, 2470, 48658, 49621, 8812, 39647, 29163, 14536, 69577, 17818, 10240, 10293, 41974, 10964, 41701,
+    3253, 18003, 34808, 45637, 26142, 44329, 64172, 36152, 35036, 26726, 68307, 22787, 62110, 41041, 41548, 67222,
+    28505, 66401, 41725, 9946, 3704, 67979, 7437, 4303, 29211, 41502, 20411, 5846, 11655, 47490, 27569, 58983,
+    14282, 33064, 46938, 9560, 36673, 65514, 52202, 651, 6627, 51688, 47255, 51622, 67023, 59799, 57891, 27920,
+    40907, 61155, 35208, 34461, 43137, 70437, 45261, 62085, 63468, 3178, 16304, 36912, 14829, 63852, 31603, 55372,
+    64258, 40984, 10618, 334, 64305, 17670, 20528, 40992, 9370, 5494, 18716, 27279, 54305, 29283, 19199, 56328,
+    44488, 69888, 21396, 45377, 54066, 51968, 24296, 55164, 4027, 47914, 15051, 7434, 50855, 63484, 20408, 38903,
+    9097, 38152, 51335, 56483, 45517, 4126, 68395, 42466, 44100, 44162, 40259, 45619, 34650, 14860, 46789, 69366,
+    37866, 46771, 64660, 34726, 53526, 42223, 59230, 54927, 66824, 47509, 12375, 51512, 20640, 43320, 45467, 12122,
+    9805, 60486, 24775, 12632, 27524, 4214, 55080, 37767, 58394, 27377, 6241, 37122, 16509, 10952, 46359, 11039,
+    4555, 12809, 23997, 68919, 10901, 57448, 20259, 10090, 38499, 56341, 23326, 23293, 43152, 9101, 10497, 59341,
+    62039, 42722, 4543, 6999, 834, 6872, 27632, 7017, 28649, 24259, 24733, 51323, 4361, 44677, 11561, 4492,
+    19537, 20029, 11297, 67794, 67303, 21820, 65329, 4723, 17865, 20064, 38551, 11385, 1176, 24519, 35536, 50367,
+    7360, 41279, 67555, 70180, 37750, 45470, 51818, 45486, 57755, 60232, 49815, 47725, 9224, 56302, 43451, 37274,
+    57053, 11338, 53706, 46811, 30425, 7307, 56869, 35964, 61967, 68329, 43738, 40962, 33036, 37913, 62884, 30780,
+    20379, 69861, 52092, 8623, 9252, 34548, 5668, 50297, 2583, 58576, 64985, 30238, 42923, 24916, 60726, 63674,
+    50707, 31743, 19923, 20993, 38439, 68898, 22586, 11901, 37059, 65467, 58395, 43167, 57070, 67852, 61277, 62228,
+    2666, 19329, 29800, 49857, 54880, 3633, 9794, 26761, 53512, 33532, 41592, 1557, 69713, 49369, 57351, 61755,
+    61573, 9075, 54460, 68006, 39007, 45248, 12873, 15924, 734, 16322, 40990, 39717, 7270, 69597, 37996, 434,
+    18088, 37472, 9449, 58507, 10066, 18397, 54596, 10847, 21039, 26363, 28344, 13402, 16404, 35783, 55130, 38150,
+    22666, 34077, 16495, 4089, 57374, 66329, 22857, 66023, 8640, 45985, 34680, 61781, 28359, 67386, 4666, 43267,
+    12385, 26976, 55637, 13222, 20125, 16314, 44218, 32196, 5310, 49362, 15217, 56608, 45477, 40254, 42390, 2255,
+    28756, 56867, 25332, 6525, 26351, 54786, 9828, 68811, 3960, 38962, 56798, 57219, 50795, 45828, 12073, 19117,
+    46311, 65228, 48233, 44226, 39052, 31127, 24534, 56146, 22404, 46117, 53837, 69723, 30073, 56913, 70439, 13907,
+    42483, 60405, 60831, 39191, 40306, 17917, 44036, 20267, 11940, 12326, 40364, 62776, 43481, 64596, 46522, 28244,
+    2613, 52394, 51420, 47021, 66871, 66921, 33330, 46111, 16626, 40119, 55340, 30192, 11151, 16039, 47843, 8883,
+    4969, 57438, 36275, 63457, 4675, 17501, 17381, 65199, 41742, 62818, 48678, 65522, 162, 59844, 46971, 42072,
+    16049, 61725, 7939, 8734, 40383, 40156, 241, 65516, 54112, 12427, 3201, 7727, 42993, 28164, 42269, 48271,
+    56257, 65854, 42612, 57897, 46613, 68516, 51850, 55639, 20708, 69841, 37083, 53941, 27871, 40707, 579, 58200,
+    28896, 24532, 58754, 44244, 21494, 48231, 60826, 34218, 29743, 37613, 14329, 51497, 39520, 45588, 25318, 39195,
+    60258, 66478, 12668, 8463, 52376, 33222, 13638, 33324, 40549, 49867, 29730, 50360, 19083, 12036, 41243, 57784,
+    52972, 41623, 56372, 12614, 48630, 26559, 7806, 9968, 30412, 4224, 25114, 57241, 35519, 47502, 4141, 47864,
+    62825, 26004, 19416, 49205, 36017, 26294, 59707, 13165, 1716, 263, 47636, 33994, 10260, 48665, 35429, 55180,
+    34301, 37624, 38957, 69097, 11504, 57005, 78, 67196, 59172, 409, 22831, 54830, 36843, 40264, 60761, 64389,
+    45661, 60383, 14760, 5714, 5279, 24305, 67769, 29488, 42141, 2265, 70014, 30290, 68891, 28535, 37922, 33680,
+    25636, 23904, 51469, 34120, 44323, 46851, 22493, 23646, 62449, 60416, 17382, 3728, 46137, 36777, 69501, 30034,
+    23664, 69530, 41883, 2797, 47545, 64136, 41699, 4874, 60544, 64030, 11693, 28941, 15553, 45128, 68965, 24232,
+    52371, 39840, 57370, 23811, 54571, 45653, 52789, 52461, 30330, 22642, 5778, 13568, 46850, 37228, 27005, 24890,
+    3718, 21105, 46115, 5212, 58891, 58283, 39688, 40396, 21307, 26924, 53895, 34638, 58190, 34775, 17892, 36252,
+    64316, 32686, 51067, 9562, 35313, 28309, 65942, 10689, 58720, 2515, 40512, 66926, 34091, 24882, 32446, 19020,
+    31264, 14499, 55558, 9495, 59779, 53573, 64921, 59798, 66922, 48721, 31294, 70169, 52568, 37964, 54623, 65633,
+    2942, 69664, 53438, 32371, 11791, 63362, 12380, 25137, 44338, 14912, 64592, 68775, 55993, 1955, 46630, 19388,
+    57908, 5986, 49084, 40231, 43006, 31136, 46382, 1673, 63186, 48041, 12025, 21863, 53090, 25327, 68781, 68062,
+    35490, 67159, 70504, 51014, 40322, 33079, 62584, 58465, 28913, 1869, 52882, 28161, 65981, 57557, 5137, 69537,
+    3550, 7123, 66374, 28882, 10819, 49943, 66021, 4900, 62970, 48971, 60865, 5457, 21689, 8200, 20383, 40394,
+    56751, 57256, 4643, 54821, 47866, 6603, 37316, 69561, 501, 58214, 29456, 63203, 60266, 8724, 9117, 57860,
+    53312, 67117, 49923, 52569, 37519, 66380, 36311, 2604, 46706, 23497, 3303, 18527, 12140, 25454, 48909, 18624,
+    37656, 57359, 9758, 61769, 6090, 24462, 22195, 26229, 12339, 20570, 52893, 5380, 61025, 53491, 69221, 16947,
+    38591, 5051, 43554, 62635, 49404, 30170, 37019, 30711, 43698, 65041, 21842, 620, 10323, 19167, 39908, 55956,
+    3297, 31288, 36576, 63950, 2440, 30152, 30039, 67032, 67661, 13866, 42356, 51062, 34338, 55983, 53693, 33349,
+    63276, 65919, 25021, 7862, 10970, 46075, 44200, 65515, 9323, 69710, 2402, 52329, 55429, 54758, 45627, 24105,
+    13019, 48794, 70091, 68168, 6581, 30210, 28841, 51566, 62864, 44629, 44232, 26197, 3535, 7340, 18053, 65668,
+    7758, 32208, 624, 9897, 52915, 55323, 2496, 55800, 35185, 35409, 15599, 9991, 46886, 16296, 42161, 21504,
+    31939, 45955, 1287, 49690, 21322, 4918, 6237, 40203, 36746, 63088, 46050, 2123, 28010, 61272, 2309, 62738,
+    42411, 61933, 45424, 68813, 13241, 10698, 26265, 13581, 52909, 61177, 30782, 47508, 40197, 23552, 40308, 37568,
+    36332, 41254, 70136, 51915, 36937, 47948, 58286, 31540, 4283, 18201, 12962, 37140, 52940, 54630, 29531, 62389,
+    34024, 9010, 69251, 30204, 62798, 20947, 32921, 68729, 9858, 13173, 45079, 31231, 26519, 43133, 48860, 53003,
+    41832, 33706, 25184, 5071, 6511, 57225, 36006, 48051, 46951, 61039, 1056, 20558, 22606, 62730, 32720, 64324,
+    46974, 63765, 38605, 65203, 38910, 17598, 63303, 5156, 16200, 19368, 5870, 64140, 47917, 32978, 5428, 38850,
+    24791, 63705, 56336, 436, 68719, 53250, 12830, 30454, 60917, 12660, 2278, 22846, 47984, 31812, 23730, 26039,
+    44585, 59846, 64370, 64091, 51039, 12719, 35689, 28801, 4204, 36578, 24325, 31599, 17460, 6425, 51354, 42042,
+    62428, 30157, 1510, 12528, 18490, 16145, 6792, 55100, 65968, 40581, 8071, 16162, 51132, 59148, 17276, 37040,
+    19585, 8246, 2882, 8150, 4682, 65265, 6217, 58964, 67809, 3730, 32415, 38457, 51028, 8124, 6709, 22823,
+    29169, 7381, 9113, 63299, 15849, 2892, 44252, 16152, 26343, 69401, 26413, 24297, 67324, 10474, 19841, 45881,
+    5567, 69395, 24234, 52305, 26604, 66624, 33422, 16187, 9054, 16523, 42254, 13946, 23192, 21040, 43629, 67558,
+    62024, 31722, 61043, 68548, 15044, 58414, 21739, 17621, 7871, 9523, 15920, 64579, 64906, 38731, 25624, 52504,
+    21876, 58792, 51785, 66184, 33920, 50132, 56702, 13755, 49976, 50784, 42912, 30489, 57577, 27223, 69162, 60311,
+    32524, 16412, 4704, 19364, 63456, 66834, 70359, 41854, 25311, 11359, 43627, 18734, 62729, 32973, 37146, 34585,
+    13762, 67950, 33655, 67171, 8215, 18750, 41451, 50817, 32378, 31234, 58075, 53482, 3264, 9021, 29483, 35092,
+    24425, 35131, 21713, 29370, 61106, 15594, 64567, 33473, 8243, 44341, 64947, 16804, 61164, 757, 65478, 27837,
+    51503, 39727, 68280, 50477, 38261, 45062, 23199, 38813, 15200, 35122, 43314, 7011, 3255, 23809, 2135, 69333,
+    1522, 22847, 65768, 4389, 47707, 43676, 55149, 22250, 48414, 41898, 12301, 18384, 15649, 60186, 2295, 1165,
+    44414, 65150, 57673, 8629, 3275, 3073, 41800, 8146, 49184, 11586, 16562, 2530, 33579, 30444, 25569, 14925,
+    3957, 68156, 21225, 32549, 12221, 48670, 63285, 33523, 9824, 16455, 39872, 47941, 44555, 57203, 54269, 25816,
+    8585, 38749, 39860, 13124, 65592, 67377, 33272, 44416, 47770, 48923, 62985, 9817, 31434, 66575, 35164, 41640,
+    16766, 43903, 54612, 3811, 50113, 65679, 53407, 26866, 11267, 35344, 10942, 31038, 55523, 11829, 39495, 59272,
+    30755, 25343, 38299, 5959, 28118, 42113, 30027, 26856, 2160, 52240, 35788, 52840, 15617, 6313, 34749, 20503,
+    32487, 48838, 6626, 20486, 33906, 316, 12404, 29374, 5538, 1130, 70118, 69699, 70418, 65090, 69847, 56532,
+    50580, 7738, 65145, 8370, 20047, 69354, 10496, 54611, 65405, 39165, 51703, 47499, 2138, 58153, 64507, 38166,
+    42360, 10734, 51137, 24976, 46642, 24692, 29802, 10855, 26408, 6418, 21211, 48695, 7628, 14300, 23699, 26391,
+    39539, 16211, 11752, 64972, 63897, 8249, 34036, 28575, 2660, 69056, 66233, 29430, 12053, 52476, 33427, 43375,
+    51979, 63587, 12920, 11296, 63925, 24186, 37287, 67424, 1940, 47484, 19357, 6433, 28692, 50083, 46747, 8838,
+    68801, 14705, 6776, 27182, 63282, 68135, 13867, 40736, 7894, 6115, 19295, 33928, 40168, 2113, 22465, 28595,
+    8259, 68847, 15534, 45628, 41229, 40121, 38139, 5060, 66902, 30196, 60720, 23636, 66579, 28379, 15121, 891,
+    67729, 27923, 17906, 17118, 50233, 36884, 53925, 24688, 16920, 23512, 3724, 33511, 52558, 54401, 69421, 9269,
+    22565, 40164, 64057, 9037, 19207, 4588, 17721, 25613, 14714, 48375, 60262, 864, 35454, 6188, 56632, 59404,
+    36644, 22408, 65372, 6899, 68576, 67421, 55556, 11326, 22114, 35582, 54054, 46324, 55300, 3214, 54060, 12469,
+    12703, 41846, 23197, 68769, 19859, 69661, 25850, 35534, 9064, 9881, 56636, 14775, 53226, 1321, 12834, 2534,
+    56077, 64968, 4369, 59676, 50614, 32558, 51491, 31161, 32583, 6126, 45688, 24058, 67160, 64391, 6881, 28793,
+    69014, 30968, 64978, 19252, 11744, 48633, 55058, 10218, 23884, 28935, 65635, 36210, 48488, 6298, 1080, 69017,
+    47388, 25191, 29539, 40281, 69626, 61435, 1051, 41373, 49355, 1657, 19146, 38679, 21140, 2511, 59295, 60082,
+    35770, 34670, 67249, 1926, 25115, 58834, 49452, 54424, 64504, 25587, 66502, 16300, 10179, 35747, 18225, 21159,
+    36219, 54987, 54121, 12994, 7223, 14327, 48348, 1103, 37524, 37832, 57270, 18786, 18675, 33360, 17872, 69474,
+    56121, 47552, 23939, 68927, 17446, 6358, 20085, 58658, 28422, 51827, 11392, 48123, 37977, 5294, 35363, 32706,
+    14035, 30934, 46856, 63763, 30028, 14622, 42521, 53609, 67282, 2647, 63365, 639, 59724, 10430, 55476, 17904,
+    49752, 52049, 70098, 1293, 7658, 58008, 57995, 51421, 25563, 9504, 8091, 35993, 8714, 34016, 39943, 38461,
+    22009, 19264, 64818, 60758, 30341, 27081, 47440, 26109, 2996, 48230, 63847, 66728, 3914, 3698, 62489, 26252,
+    68337, 13371, 39776, 26862, 44402, 60373, 24814, 66219, 51445, 43835, 42533, 32689, 41625, 48038, 7103, 54688,
+    8241, 28494, 51523, 6981, 13466, 65871, 31469, 13951, 7735, 37250, 43380, 16641, 15529, 22419, 61850, 47181,
+    45282, 58399, 20806, 20039, 15879, 11562, 26894, 39598, 36968, 8950, 9541, 41347, 37826, 19090, 13027, 64221,
+    68314, 2905, 1334, 62625, 27295, 66007, 25937, 70531, 12488, 28215, 38746, 6470, 4382, 42491, 26898, 14593,
+    1129, 7253, 47183, 56477, 54739, 8422, 37739, 40135, 64547, 66643, 297, 59589, 2672, 11598, 9861, 56886,
+    64248, 21078, 11983, 35882, 68123, 30240, 12196, 33962, 31098, 14878, 64024, 3168, 21347, 39065, 4597, 17729,
+    56983, 41317, 58213, 35762, 28372, 42375, 18451, 44592, 56033, 53282, 51752, 36589, 23663, 17303, 9682, 43154,
+    47297, 3187, 56120, 24604, 10370, 6044, 10597, 25286, 19973, 24151, 25974, 63829, 1016, 3722, 42913, 59867,
+    26332, 50907, 24693, 60194, 589, 45878, 45404, 67151, 51108, 51104, 64979, 14537, 60629, 26512, 28031, 60000,
+    28286, 23251, 13380, 145, 46296, 22191, 57665, 32395, 20650, 65874, 9084, 53954, 69298, 69337, 57036, 48419,
+    42344, 21389, 64722, 38508, 60467, 37086, 15630, 18428, 6182, 6103, 12419, 2623, 61231, 35535, 33254, 67530,
+    51837, 19615, 20321, 3263, 57880, 15346, 37556, 35173, 46077, 57933, 39444, 19800, 36363, 10303, 62827, 52287,
+    14571, 119, 51436, 15359, 38737, 50461, 69706, 65568, 11743, 35121, 60669, 4235, 24799, 54338, 64884, 20917,
+    31076, 593, 30272, 31575, 61837, 32192, 19604, 48454, 39058, 7460, 59398, 69124, 30143, 4443, 39452, 20193,
+    65503, 70538, 24798, 27100, 16744, 47773, 2193, 64164, 38692, 35404, 16393, 7454, 29030, 22299, 64332, 35863,
+    24350, 64848, 30058, 47386, 42000, 15081, 44710, 6948, 69237, 63333, 1491, 18187, 70458, 32298, 34430, 14907,
+    8316, 49316, 30163, 18558, 47431, 61905, 61559, 44383, 64266, 35368, 36304, 42731, 8650, 61073, 25680, 53134,
+    5427, 12107, 47587, 59840, 66321, 47360, 46184, 1767, 39230, 45791, 43435, 55274, 34357, 15224, 40729, 20218,
+    11354, 9628, 11404, 29622, 49516, 28444, 43392, 48596, 7644, 17255, 4658, 24610, 66621, 5301, 4770, 35038,
+    22781, 39333, 29022, 8231, 31946, 7036, 39470, 22858, 65562, 17275, 54997, 2652, 68025, 41504, 13703, 31360,
+    63150, 19862, 67884, 5397, 17741, 36730, 49583, 11614, 27086, 67000, 44887, 33802, 59613, 42148, 20444, 7067,
+    40527, 14782, 41596, 33138, 24472, 32005, 52824, 40436, 62515, 1186, 60173, 44516, 67543, 57988, 53544, 52176,
+    44175, 50682, 62953, 7009, 21144, 40360, 13606, 45346, 63055, 1731, 6606, 21427, 41691, 49336, 62221, 69105,
+    16236, 16228, 56806, 64168, 66771, 29215, 11819, 49952, 3676, 41525, 35576, 56972, 58516, 275, 6643, 31482,
+    26824, 67740, 70488, 12604, 69824, 57659, 9162, 29770, 8468, 15231, 43829, 14852, 7942, 17915, 67999, 10893,
+    4575, 58746, 44857, 67890, 45136, 23020, 66763, 67822, 62616, 36851, 62409, 13915, 15573, 383, 66887, 67738,
+    61080, 4576, 22119, 34869, 4472, 53689, 69819, 19607, 55953, 25619, 49196, 12747, 3686, 28763, 33258, 14527,
+    66430, 65066, 38415, 1405, 46109, 17150, 60655, 7882, 40057, 36995, 23358, 45655, 43162, 61992, 20209, 33835,
+    3600, 47609, 19936, 65841, 31405, 36876, 55679, 36553, 47310, 27230, 34785, 35659, 2841, 46696, 6213, 1095,
+    20213, 36247, 20231, 68014, 31247, 24167, 46739, 48815, 6403, 60145, 64344, 28530, 13743, 34499, 8880, 28333,
+    56003, 59522, 30754, 35031, 22442, 13217, 871, 38634, 40981, 48257, 64541, 9486, 36838, 28421, 42238, 60485,
+    66024, 35625, 11125, 50101, 35837, 17473, 39370, 42199, 13926, 31102, 5515, 66704, 16775, 9485, 65879, 25522,
+    43419, 3836, 63356, 18139, 56410, 68375, 5716, 17237, 43572, 27197, 68278, 25051, 52513, 39892, 62529, 44285,
+    29941, 22886, 37810, 58909, 43712, 26375, 45072, 21401, 69462, 41406, 41004, 17676, 49806, 8932, 37573, 6380,
+    61127, 41728, 59208, 9258, 56030, 15390, 66326, 18925, 29246, 28479, 6291, 14286, 64175, 1911, 54091, 46074,
+    3301, 32798, 23540, 31059, 17334, 54474, 61090, 6650, 38112, 19015, 25140, 12402, 67440, 14321, 24141, 9609,
+    36071, 24607, 45579, 14591, 23239, 12463, 3183, 39907, 61244, 10624, 11840, 24554, 56234, 11866, 11599, 30145,
+    36934, 63976, 30282, 57683, 40847, 3011, 64920, 44202, 7373, 68903, 12072, 49532, 69428, 48179, 35713, 39736,
+    58823, 51229, 70269, 5238, 18547, 8574, 17252, 7859, 26616, 55479, 51741, 15742, 67039, 28427, 31300, 9181,
+    55094, 27332, 37949, 46165, 52830, 3595, 66749, 641, 67902, 3419, 58899, 53698, 67877, 25635, 38069, 12117,
+    41416, 19084, 26971, 51440, 28166, 47144, 67819, 69656, 12163, 11885, 20931, 45536, 47625, 60174, 40214, 39663,
+    21433, 27630, 38187, 698, 34512, 41023, 52035, 59322, 38332, 32328, 19492, 19010, 5601, 67982, 33432, 37110,
+    53047, 5400, 36368, 62271, 20182, 61267, 18866, 50131, 32630, 58084, 43557, 9391, 8630, 30812, 14996, 49520,
+    45455, 44195, 33194, 54175, 58906, 4615, 39502, 13609, 43628, 12378, 2514, 28751, 4018, 39324, 45127, 42369,
+    1754, 22563, 57668, 2849, 50553, 6849, 9210, 52994, 40353, 585, 20478, 46942, 31864, 40706, 43165, 10808,
+    55597, 39723, 415, 47990, 50961, 24606, 11678, 61943, 9289, 59401, 25564, 41547, 31884, 3140, 21075, 6116,
+    63927, 56254, 48690, 66237, 22771, 20490, 21566, 17207, 28113, 6061, 26379, 8067, 17979, 62917, 37001, 63091,
+    26416, 50394, 32895, 30571, 51183, 40349, 44454, 57930, 60550, 61525, 55371, 13634, 40850, 56933, 10162, 45422,
+    67271, 14880, 44356, 60776, 25988, 42704, 47560, 28553, 64224, 24222, 61482, 50223, 33451, 69588, 52737, 51938,
+    38505, 62576, 21935, 67698, 41863, 38715, 35666, 31387, 18365, 16268, 52613, 9049, 70025, 2345, 40094, 28108,
+    13869, 69277, 11597, 59773, 26047, 22848, 1548, 61327, 58442, 51124, 41503, 44491, 67061, 19248, 39853, 19363,
+    59591, 17981, 52928, 3962, 37404, 37851, 58970, 40420, 27049, 58596, 55867, 68797, 32202, 14592, 24364, 52036,
+    33367, 56068, 28544, 42410, 38538, 18233, 54018, 47548, 21236, 55171, 64275, 17644, 35451, 10050, 16005, 21336,
+    45119, 58586, 45711, 10097, 20343, 17643, 10910, 34607, 59725, 47491, 27266, 34847, 69948, 45566, 49385, 68513,
+    44369, 43444, 21304, 48936, 9697, 63533, 3347, 38836, 31727, 61495, 15674, 15106, 59804, 26446, 26425, 39999,
+    9639, 27381, 21206, 68704, 47673, 27339, 39978, 53178, 68985, 2701, 33531, 36216, 21523, 9581, 6439, 5526,
+    29481, 59007, 18474, 11308, 69334, 30469, 43859, 37266, 66322, 66098, 65255, 69594, 55696, 28017, 49453, 58613,
+    3468, 14489, 3946, 26533, 31243, 34959, 53322, 53632, 9610, 11239, 51121, 28247, 5842, 38829, 68348, 24326,
+    60677, 56625, 34278, 46656, 57015, 40270, 48988, 45669, 40625, 19459, 3907, 41446, 17475, 4218, 2129, 32288,
+    36084, 27994, 68205, 67076, 14573, 48711, 42013, 41798, 46709, 62106, 26837, 69059, 3194, 63224, 33555, 60656,
+    68588, 31101, 20988, 39522, 27414, 53228, 56535, 36431, 64539, 6025, 29675, 26979, 65577, 56617, 39524, 41152,
+    62866, 66813, 353, 39945, 15505, 62732, 53119, 18454, 12223, 7892, 18565, 19349, 44589, 3273, 44939, 3900,
+    22086, 66189, 12028, 62308, 35917, 45105, 15071, 19907, 11390, 12775, 55924, 57497, 53236, 20129, 34478, 33877,
+    25465, 8157, 49617, 17634, 40464, 60021, 13279, 7000, 49800, 56168, 23212, 39686, 10164, 4510, 48489, 16921,
+    40537, 32892, 4380, 40095, 217, 45090, 8335, 47523, 18796, 5896, 63414, 15532, 53069, 69445, 31143, 35335,
+    9315, 38840, 18507, 30713, 1550, 37429, 66511, 6185, 9285, 38389, 61522, 35047, 51999, 15609, 45035, 50758,
+    40524, 136, 18339, 19796, 9052, 20639, 59235, 35053, 40361, 17370, 38936, 57322, 69640, 66469, 36181, 239,
+    21625, 57983, 36715, 61829, 51405, 64948, 58287, 54097, 15086, 24370, 63722, 27094, 55832, 50812, 2763, 68559,
+    30061, 325, 15458, 31431, 6973, 64033, 50482, 38518, 11985, 19742, 62937, 66796, 33378, 11846, 26801, 60673,
+    40273, 14160, 1540, 27821, 45268, 2757, 42358, 56795, 69432, 58248, 9353, 37592, 24675, 58654, 2854, 22486,
+    18756, 37483, 26323, 34810, 40759, 32333, 61430, 24476, 62495, 54584, 32053, 73, 10575, 67803, 52702, 51394,
+    3805, 52316, 8405, 27710, 27612, 22721, 27219, 8558, 34069, 68709, 13382, 40960, 69900, 38119, 1808, 4248,
+    23720, 35118, 63842, 54202, 14430, 67115, 48108, 32726, 40822, 2449, 25572, 59512, 15488, 18312, 58290, 28437,
+    49066, 35547, 44287, 33140, 33693, 35851, 13512, 60218, 61746, 59610, 44684, 36129, 35589, 3236, 51055, 66227,
+    13223, 55660, 6710, 58440, 61685, 16989, 46984, 59573, 7546, 65164, 7711, 21240, 68285, 50680, 48087, 54038,
+    69190, 28658, 49319, 52989, 7124, 60489, 29601, 6502, 48880, 10764, 36603, 31459, 40022, 12118, 26211, 14807,
+    5097, 29799, 59119, 42481, 71, 47084, 50377, 20846, 18821, 11498, 57962, 14973, 59950, 65926, 67278, 52300,
+    58346, 61882, 2544, 19091, 67626, 11075, 60118, 61192, 26157, 39356, 57426, 59310, 66619, 9958, 26281, 66073,
+    16398, 47025, 65242, 50856, 53365, 34513, 4988, 43982, 48282, 52221, 60453, 7692, 61577, 43148, 52567, 19850,
+    17959, 35062, 26790, 46122, 52282, 6532, 24729, 9725, 43646, 57007, 21578, 47394, 25768, 54331, 17154, 27263,
+    69998, 22110, 25295, 47368, 22167, 22726, 35058, 36504, 63684, 22485, 66074, 608, 46847, 5768, 40454, 1521,
+    52037, 42336, 16721, 21897, 5625, 13073, 15691, 28746, 50831, 56, 16613, 9917, 42451, 38884, 46003, 66063,
+    25058, 62808, 32504, 21910, 6818, 53852, 62538, 34674, 43327, 27924, 20868, 25857, 10525, 16505, 69662, 55743,
+    69680, 48972, 50798, 20160, 35230, 30442, 37505, 57804, 46576, 39559, 69443, 44676, 50727, 53061, 47185, 24669,
+    20255, 58211, 57737, 61673, 28529, 18762, 51165, 44480, 49572, 43440, 3202, 59378, 28405, 16260, 56055, 33234,
+    15593, 32495, 10170, 38937, 15865, 29659, 404, 33463, 53737, 68167, 62197, 47594, 29100, 25701, 36058, 16201,
+    59963, 21894, 17746, 60647, 23309, 5149, 66359, 67127, 48047, 35968, 48290, 68542, 28229, 51834, 41369, 48334,
+    50170, 25015, 56480, 20329, 41068, 4220, 6516, 28298, 40569, 17936, 48360, 67535, 45233, 48176, 11684, 26637,
+    65552, 46339, 63613, 50801, 22553, 10523, 8637, 66708, 49942, 47226, 43457, 55048, 69471, 13191, 16522, 49586,
+    33177, 51757, 29139, 29640, 63900, 33932, 30241, 14047, 30148, 55836, 10938, 47574, 28780, 61505, 23487, 23181,
+    69813, 413, 9320, 45753, 36418, 49574, 43284, 21404, 60722, 62204, 29599, 35529, 6208, 45916, 23447, 53468,
+    64098, 15900, 41550, 63857, 45078, 6802, 47302, 21178, 10583, 40069, 47027, 56810, 34943, 61692, 8381, 44914,
+    58066, 45609, 43060, 28317, 12875, 20006, 30486, 543, 64765, 5483, 28706, 50279, 52653, 40544, 45058, 26766,
+    50865, 63138, 64558, 44839, 9950, 32070, 51553, 43443, 66316, 24898, 45181, 9688, 28593, 67013, 38290, 39027,
+    15620, 8845, 67240, 16184, 11755, 29353, 49899, 48697, 56911, 58467, 10035, 14896, 9997, 61538, 23227, 4055,
+    54908, 18723, 27603, 29288, 31509, 8625, 22308, 22349, 69636, 17209, 59406, 4986, 7242, 3068, 25855, 58270,
+    39886, 32748, 27439, 61514, 10738, 15761, 42847, 53575, 13559, 63472, 18713, 7539, 67696, 21789, 21764, 18092,
+    50871, 9176, 60042, 34319, 30710, 26717, 11128, 59712, 9600, 68758, 33337, 49646, 50823, 25948, 38594, 15194,
+    60422, 18551, 63500, 40265, 39067, 47117, 51262, 35918, 43518, 26117, 52834, 26033, 56029, 23827, 54124, 2094,
+    28686, 36303, 35711, 42430, 54194, 22016, 58697, 40013, 24931, 31477, 42828, 22466, 61849, 22274, 19954, 49004,
+    13976, 13605, 31410, 42714, 67686, 8799, 10508, 54217, 17536, 9008, 32796, 20975, 1468, 38812, 3163, 20862,
+    66605, 12916, 38554, 18633, 66721, 59510, 34361, 52663, 34910, 4840, 37540, 3803, 53899, 57134, 26002, 48861,
+    852, 52950, 55984, 67944, 7025, 12304, 54167, 59784, 5857, 64500, 14619, 19613, 10041, 27752, 27916, 20174,
+    52976, 8866, 62422, 59019, 50424, 24608, 3504, 5889, 38113, 69001, 30439, 44844, 2019, 52192, 35297, 8170,
+    62098, 60905, 30311, 41621, 39709, 35046, 70198, 61254, 10136, 20692, 36536, 55102, 14382, 2332, 24454, 58662,
+    58934, 1357, 57145, 2509, 23491, 60829, 51883, 32923, 31207, 3001, 5989, 48100, 64355, 58332, 67358, 19299,
+    25451, 50057, 17516, 8872, 46101, 18768, 29302, 55829, 4467, 35011, 40868, 9042, 43944, 59734, 35875, 4341,
+    63493, 15629, 15364, 61470, 24426, 3354, 14295, 47679, 16729, 3982, 31539, 27547, 63390, 14449, 67157, 19781,
+    6417, 25661, 63622, 11252, 21776, 21358, 6, 39021, 29131, 66815, 17730, 68816, 55155, 7766, 66556, 68503,
+    19941, 4808, 7344, 44054, 23474, 60690, 65653, 57011, 23518, 7605, 12884, 11304, 43401, 3349, 4145, 56317,
+    11738, 48546, 33710, 30688, 28239, 58812, 25904, 12244, 47307, 57870, 50545, 66460, 37918, 15637, 19197, 35049,
+    31274, 19029, 4886, 10202, 24295, 31090, 36170, 37358, 40961, 59469, 29677, 6134, 19821, 1197, 68258, 54116,
+    15409, 47242, 54637, 29269, 23327, 34928, 17552, 12876, 37453, 43786, 50397, 12233, 48175, 20035, 8713, 67430,
+    40820, 4412, 7323, 355, 69351, 22871, 279, 34040, 11445, 24685, 28710, 68153, 50587, 2406, 17573, 32462,
+    49481, 9999, 58254, 30380, 53162, 42915, 400, 60423, 13505, 26405, 24122, 14613, 36041, 42859, 50490, 2043,
+    11926, 6805, 19683, 57289, 56320, 34987, 17270, 45614, 61563, 3403, 42437, 36307, 43215, 37890, 54929, 55529,
+    70026, 45140, 40788, 1471, 39256, 7749, 62355, 41510, 44842, 2234, 12338, 34369, 10885, 41617, 40783, 13900,
+    20124, 69473, 50636, 53056, 47053, 63600, 50304, 50807, 34084, 22362, 60265, 49922, 33668, 23662, 47720, 14633,
+    65030, 41066, 8638, 62418, 25532, 56646, 2064, 4620, 46086, 7875, 20234, 30198, 65239, 35244, 63693, 33233,
+    61314, 47966, 29913, 38471, 41175, 60796, 68401, 20857, 23829, 56946, 46080, 68176, 41278, 43693, 28859, 5070,
+    20957, 23951, 64135, 53058, 2003, 68582, 5917, 41146, 48292, 46094, 16061, 48728, 5016, 48976, 47542, 31932,
+    69453, 35256, 63449, 28503, 67232, 32741, 68311, 23343, 23284, 36039, 17126, 9821, 60283, 33154, 17323, 43054,
+    45029, 34429, 58752, 60963, 55095, 28356, 37011, 16926, 47220, 51330, 26400, 20115, 566, 4827, 62074, 15061,
+    19220, 49130, 35543, 49983, 2711, 48968, 37937, 42539, 57400, 3777, 19022, 51249, 44853, 45968, 11839, 31931,
+    19431, 8668, 70487, 41987, 18095, 56658, 14483, 9301, 65875, 55737, 42287, 69608, 48159, 54752, 27913, 69658,
+    65872, 35315, 60848, 42789, 66798, 47882, 39895, 38968, 41449, 34204, 57513, 63217, 67955, 63727, 5381, 12343,
+    16986, 6155, 66006, 33901, 15712, 46618, 54461, 56785, 59841, 28455, 63800, 25082, 1821, 22182, 17859, 27939,
+    31447, 52930, 67704, 16895, 30808, 22672, 42925, 61082, 10049, 34811, 45602, 58476, 34181, 8197, 29660, 40440,
+    56386, 3370, 40547, 64980, 46221, 54395, 17534, 22199, 27649, 58878, 38075, 63875, 64877, 17793, 13857, 32227,
+    23094, 20788, 60661, 5990, 21459, 64640, 9771, 31198, 10113, 67273, 40172, 16507, 69446, 41441, 60445, 54590,
+    70339, 28548, 27728, 22727, 70039, 66249, 13665, 59037, 56409, 64656, 8176, 38526, 70267, 36900, 37077, 31191,
+    70190, 13658, 15420, 6535, 68224, 15844, 25873, 50640, 61930, 41104, 22139, 43176, 48165, 33428, 68892, 34575,
+    67826, 61301, 21465, 51264, 68136, 58025, 17985, 21512, 41757, 66923, 28937, 2503, 56891, 8606, 28810, 30295,
+    58419, 31045, 26232, 48931, 59293, 47515, 8825, 2068, 66115, 26733, 26514, 2422, 27531, 58233, 38542, 61032,
+    19926, 13172, 14562, 43004, 55014, 1363, 20815, 54280, 39156, 40343, 60127, 17549, 62562, 16954, 4403, 61491,
+    1122, 64584, 66929, 4096, 3980, 55258, 8190, 25527, 6793, 41945, 40747, 11733, 9767, 34942, 44790, 64856,
+    41443, 30561, 31863, 45746, 3905, 33182, 9399, 13093, 28538, 28766, 63527, 7474, 67416, 9177, 21576, 62882,
+    38324, 3346, 52266, 2110, 27806, 34855, 44538, 10249, 59417, 58784, 16173, 53064, 25022, 45087, 61884, 25141,
+    45298, 61657, 42718, 3071, 19889, 39610, 22346, 16027, 38721, 8717, 13949, 29129, 28792, 47861, 60685, 66974,
+    1667, 3439, 63540, 8549, 69907, 68043, 22018, 70535, 7111, 53676, 48613, 64955, 3815, 13453, 6481, 60977,
+    37622, 37930, 50945, 68321, 50770, 66607, 24348, 35332, 62330, 41388, 16770, 62724, 37968, 68945, 44566, 37641,
+    19552, 30515, 56214, 18466, 34128, 18542, 4080, 37563, 65770, 67711, 37535, 66776, 57864, 45865, 60052, 31991,
+    42600, 19712, 55567, 33012, 41401, 28632, 30693, 45288, 6370, 62957, 47186, 8391, 9566, 55473, 2667, 28569,
+    62034, 25797, 529, 4958, 67905, 25063, 33387, 45142, 57057, 2491, 50813, 1832, 66961, 33200, 58215, 54381,
+    10311, 59769, 17388, 42268, 51151, 17503, 7087, 57692, 8817, 20897, 38005, 70528, 8456, 61788, 19933, 40352,
+    58636, 51988, 44709, 35944, 61268, 31693, 18751, 33598, 4888, 12447, 16757, 28839, 51573, 48335, 67666, 26865,
+    48737, 10468, 31409, 29788, 19080, 36470, 35267, 17318, 67657, 56400, 3031, 14013, 55785, 58416, 9316, 45572,
+    18193, 47902, 47404, 38965, 67359, 61923, 177, 45168, 11253, 5611, 69119, 18777, 36819, 65054, 9810, 23274,
+    70128, 52236, 49906, 1593, 47829, 16645, 39513, 11280, 69665, 52546, 59385, 37899, 28986, 5742, 14422, 25219,
+    57043, 5367, 13261, 22755, 34914, 62849, 5009, 35849, 5563, 40862, 67812, 61468, 47321, 61800, 41776, 50257,
+    24786, 62488, 39689, 1925, 25772, 41, 56455, 49159, 63059, 46429, 66746, 12016, 33777, 50058, 4861, 5205,
+    19324, 8661, 37941, 17206, 55863, 2374, 35316, 47557, 21366, 69126, 62031, 633, 739, 57546, 35066, 2645,
+    21439, 3197, 37722, 22910, 9967, 1133, 18098, 65809, 16394, 39316, 27374, 56147, 3046, 61305, 48664, 63486,
+    57821, 19642, 37706, 4983, 17991, 14541, 6437, 45234, 50585, 23989, 57052, 43433, 62686, 2407, 44522, 67084,
+    30154, 18057, 3571, 56921, 57266, 32354, 52673, 33085, 60724, 69454, 52272, 4564, 24338, 60711, 2599, 34436,
+    60273, 62599, 54845, 33620, 8676, 48634, 43671, 226, 50224, 34948, 65564, 16731, 68925, 26427, 3899, 31097,
+    37, 35070, 30040, 55516, 34618, 49420, 17855, 9604, 41565, 33515, 69685, 24602, 10842, 50047, 56430, 68194,
+    45341, 37449, 23148, 60612, 13487, 64713, 52426, 11717, 3746, 43826, 14726, 39806, 55512, 3234, 62224, 63168,
+    26053, 69644, 2429, 49733, 64428, 382, 7441, 8389, 25769, 24188, 61402, 51184, 2044, 38941, 64201, 25013,
+    49901, 28630, 63803, 5554, 60592, 41542, 13939, 65287, 14092, 46675, 7522, 65105, 57344, 12635, 31178, 29441,
+    8712, 58097, 8654, 23835, 59936, 58564, 41562, 34058, 7199, 16311, 8430, 50060, 18086, 61921, 32557, 56910,
+    46091, 16806, 5862, 24705, 65110, 68936, 56374, 58182, 53342, 44690, 44595, 50077, 62319, 24970, 15207, 34975,
+    17718, 29772, 34930, 20615, 30563, 29280, 46145, 26537, 56571, 43710, 37928, 21597, 70304, 25864, 43076, 24521,
+    37221, 49119, 10326, 33924, 53764, 18666, 65694, 45612, 53279, 28138, 33148, 59248, 61037, 18209, 62092, 44358,
+    52011, 24441, 45448, 66859, 54825, 5951, 9895, 36319, 39368, 57286, 48039, 33654, 58357, 66050, 40286, 69637,
+    65282, 5662, 53266, 2619, 35067, 20074, 672, 11521, 20771, 8310, 10605, 62203, 11647, 32863, 50056, 20110,
+    18874, 31134, 45334, 65580, 5038, 69590, 23731, 12885, 24459, 12333, 21972, 15339, 65106, 969, 7405, 23787,
+    40080, 25056, 4433, 40964, 57170, 8867, 25251, 44999, 65572, 17649, 9976, 67688, 16420, 9731, 31184, 59538,
+    22413, 37649, 15013, 2943, 70408, 59099, 9363, 57463, 21332, 18839, 17266, 40771, 65890, 12974, 69869, 15602,
+    9720, 49136, 25638, 37260, 5761, 17430, 52996, 5957, 51079, 9068, 50919, 19795, 56197, 62800, 36003, 34724,
+    5618, 34570, 43547, 14706, 47564, 58280, 43, 16160, 22380, 8555, 49269, 40635, 39846, 62646, 46318, 12714,
+    20323, 12735, 3113, 9535, 24289, 33218, 29775, 35845, 35706, 65211, 16103, 2830, 2305, 58875, 6174, 52156,
+    26911, 30816, 728, 28424, 9788, 21908, 60462, 15746, 20390, 34256, 44714, 991, 59475, 48020, 20224, 40455,
+    5337, 41301, 53564, 67748, 47551, 59547, 60351, 54506, 5652, 22166, 20127, 67912, 63498, 50303, 31820, 21115,
+    32704, 52009, 48568, 35753, 26846, 57724, 25100, 38194, 55752, 26179, 5816, 55238, 6293, 36267, 69915, 61904,
+    11736, 4176, 49501, 33004, 35757, 2741, 37567, 69452, 32766, 61322, 43774, 33811, 31149, 29057, 50994, 10342,
+    44420, 34412, 46770, 29729, 62806, 63833, 67520, 65714, 33263, 38323, 45337, 44918, 66964, 64171, 9690, 19990,
+    25819, 51204, 34492, 23277, 66270, 64967, 59837, 53422, 60929, 13354, 56081, 58083, 24625, 34093, 53776, 32749,
+    47606, 2469, 16237, 23891, 42180, 40890, 56538, 46735, 38390, 65611, 65010, 14698, 4390, 19319, 42990, 65982,
+    52167, 67734, 47271, 40479, 62714, 21376, 68983, 56986, 52085, 44281, 58037, 44801, 12639, 46515, 62772, 10596,
+    8121, 42438, 64582, 31759, 48291, 23086, 63704, 61539, 61325, 31560, 30700, 51380, 20228, 70446, 31519, 46321,
+    53962, 27818, 15673, 41407, 24078, 11825, 51342, 56274, 45979, 59663, 12640, 51649, 6261, 47778, 56904, 64521,
+    8092, 541, 58673, 47526, 23962, 35966, 8035, 39348, 57541, 62781, 44086, 49075, 40832, 27175, 13788, 31024,
+    31532, 22421, 62002, 18204, 55666, 30219, 3348, 24567, 70093, 66765, 55721, 69131, 39134, 39105, 41499, 37974,
+    44963, 32565, 49485, 42596, 15311, 43272, 58076, 4883, 51015, 23121, 305, 34174, 46829, 70193, 64529, 4012,
+    53842, 19752, 52856, 58600, 24657, 28180, 64844, 20066, 69633, 22026, 58044, 12963, 23352, 13063, 40904, 37332,
+    10503, 47237, 4155, 57787, 10902, 48392, 49220, 62652, 7475, 34089, 33876, 34992, 33244, 20038, 7934, 70116,
+    48663, 60331, 50038, 30589, 7297, 2419, 46201, 55693, 57261, 66384, 43260, 52792, 39046, 43884, 46424, 64196,
+    45640, 32491, 19843, 28564, 10015, 12362, 42396, 28619, 131, 47216, 14971, 41629, 54765, 12078, 48264, 48029,
+    18248, 32089, 35268, 9862, 8127, 46131, 3544, 50030, 658, 51448, 61092, 50596, 62906, 24101, 35485, 54213,
+    51698, 9998, 44809, 29337, 45014, 53065, 67856, 49730, 20651, 50927, 39783, 57759, 39460, 16461, 15582, 18481,
+    20042, 36434, 17983, 11437, 12260, 67393, 12039, 3578, 27468, 47324, 48607, 49239, 41609, 7584, 68583, 5943,
+    12310, 5012, 7775, 48481, 50517, 7839, 4524, 69607, 33498, 23527, 7949, 33875, 18901, 42661, 42743, 8034,
+    26240, 34588, 5820, 47743, 49888, 26871, 27127, 43608, 16410, 13150, 69459, 70378, 12587, 26576, 34757, 19621,
+    28525, 36467, 31831, 10886, 68567, 50884, 35015, 31381, 59491, 17245, 24116, 46153, 34382, 22510, 29934, 4120,
+    70333, 45435, 27743, 53531, 24583, 6898, 21267, 40923, 60092, 15176, 58100, 16254, 60387, 65990, 4637, 53963,
+    51614, 12462, 11227, 21702, 61964, 48332, 4800, 22669, 65360, 29936, 13758, 60953, 37842, 62310, 10177, 735,
+    12857, 42769, 2537, 24133, 37812, 22742, 50569, 6583, 70370, 70351, 28770, 68270, 33489, 44437, 13769, 20633,
+    15419, 21503, 23654, 55601, 14251, 54817, 41916, 2859, 65493, 3124, 47851, 12137, 18155, 22165, 44986, 48579,
+    20979, 36579, 5747, 9284, 11527, 25517, 3004, 3669, 29683, 26050, 60652, 66292, 55853, 48888, 44781, 8373,
+    58126, 45500, 34967, 35838, 38816, 66366, 63155, 14260, 47007, 44020, 26183, 55259, 15832, 64857, 44984, 48346,
+    27624, 22650, 20413, 53220, 64425, 29298, 39088, 70294, 31986, 8244, 26392, 4653, 44615, 10431, 43080, 36295,
+    63025, 40183, 66691, 7752, 61637, 42515, 12599, 10492, 70513, 18043, 62232, 48675, 3111, 14563, 57054, 17348,
+    11828, 38233, 19190, 67252, 42331, 45345, 5333, 52656, 58402, 51284, 7779, 66041, 55587, 10629, 13678, 3223,
+    50213, 12711, 20955, 65727, 18604, 34527, 51600, 39518, 62147, 17939, 21186, 28432, 39712, 37849, 28326, 22580,
+    47702, 54647, 12032, 44882, 8493, 66646, 52304, 12065, 48517, 52130, 50157, 64700, 15626, 27289, 62304, 38919,
+    2397, 46846, 67472, 28639, 66757, 64996, 33599, 18438, 27242, 31620, 22041, 65593, 69908, 1408, 18680, 38553,
+    28448, 34495, 52066, 36561, 58771, 19294, 36639, 55307, 63576, 48809, 64310, 32812, 60762, 33840, 32856, 10012,
+    16557, 31437, 17038, 29718, 13822, 21162, 58184, 34304, 17940, 68508, 12534, 62899, 13602, 35856, 40562, 14258,
+    3463, 59006, 60688, 33679, 45932, 41681, 49209, 70012, 27251, 26051, 52139, 25200, 12444, 55589, 59458, 1890,
+    11852, 55770, 25802, 70125, 21586, 55612, 27393, 5641, 23819, 37912, 65599, 68312, 52582, 47059, 43855, 56762,
+    38946, 46610, 1694, 51623, 40969, 51535, 29930, 27760, 53660, 9733, 51778, 41891, 37797, 36203, 23696, 17424,
+    57636, 5237, 7302, 62127, 35397, 882, 13190, 5892, 37576, 38469, 45911, 42616, 5246, 63304, 42655, 27508,
+    1507, 49685, 45835, 16261, 14090, 12804, 54375, 11804, 38036, 65988, 58487, 68999, 18274, 57039, 35434, 31699,
+    11478, 61611, 14821, 66828, 2525, 220, 13398, 67439, 67368, 20052, 63802, 16107, 49202, 66568, 15983, 54766,
+    16339, 9597, 57591, 46568, 24002, 39440, 33393, 16247, 35554, 29058, 61772, 44802, 30736, 70443, 21215, 4364,
+    64446, 17476, 56584, 39400, 7783, 59686, 45343, 25376, 58621, 63675, 60245, 44682, 14117, 39059, 7714, 41558,
+    44410, 33889, 45074, 40598, 64546, 36645, 16198, 62162, 41057, 43194, 21037, 9528, 58136, 1853, 23432, 29164,
+    6714, 39010, 51569, 2972, 60010, 43066, 31629, 54044, 42111, 7600, 31006, 42602, 23944, 68038, 43541, 31257,
+    1874, 50513, 47892, 68277, 62497, 67878, 65963, 31524, 30690, 33026, 56831, 44408, 63917, 7260, 5374, 51967,
+    12437, 36160, 6510, 31357, 54815, 18486, 31304, 33370, 32595, 40840, 70127, 30194, 70288, 1313, 34678, 42098,
+    51042, 62666, 47719, 47752, 66445, 62215, 4509, 5064, 21749, 62131, 56232, 54452, 39881, 59441, 1513, 66465,
+    34804, 44906, 58841, 27849, 894, 9921, 58831, 623, 25320, 55830, 58033, 14946, 11260, 49000, 16913, 68202,
+    49350, 15850, 51617, 55900, 24984, 66297, 41111, 68264, 9593, 20120, 41705, 16275, 26440, 39965, 16872, 62263,
+    6388, 43691, 17058, 41354, 25268, 521, 26989, 11201, 58418, 4688, 6159, 44840, 57224, 178, 49098, 54469,
+    15275, 54029, 10006, 59776, 65387, 35024, 61245, 16553, 30723, 65550, 55777, 59062, 55955, 63717, 53795, 30695,
+    44905, 4073, 20658, 39874, 69525, 14828, 49766, 25660, 38900, 42676, 56130, 27126, 27282, 14845, 7001, 21490,
+    26980, 53881, 37099, 5078, 6876, 36717, 48317, 48990, 39474, 28804, 7819, 37943, 21967, 63361, 32638, 5659,
+    44995, 48953, 8119, 45573, 13929, 24666, 63252, 68538, 24466, 69223, 49193, 65087, 49891, 46603, 17418, 3984,
+    27391, 36985, 55766, 12373, 32508, 28268, 11018, 37982, 57969, 14580, 41976, 28004, 19468, 61599, 63647, 30951,
+    45845, 33172, 15689, 40337, 29720, 60275, 62094, 9058, 60943, 20489, 10722, 53540, 53169, 5883, 12246, 3641,
+    41819, 26983, 62091, 51168, 41397, 32038, 32312, 48403, 35132, 54163, 3094, 55879, 39306, 66154, 55944, 54253,
+    55709, 16180, 66729, 26553, 59424, 31081, 35921, 57204, 68786, 35013, 13135, 38859, 484, 30101, 4319, 36195,
+    9756, 41666, 70178, 7324, 41505, 70154, 44041, 44267, 63, 55579, 7903, 435, 21613, 58723, 41305, 36954,
+    26496, 39168, 40315, 30488, 65959, 16608, 33444, 42382, 62928, 50205, 37839, 34055, 15669, 7395, 25009, 43210,
+    58005, 16084, 38827, 49858, 33930, 39800, 1106, 23093, 23746, 10796, 69571, 68336, 52285, 4257, 9012, 61175,
+    36780, 7073, 46238, 13836, 49045, 14495, 48773, 61188, 8198, 140, 35887, 25209, 21545, 32223, 23250, 10118,
+    7362, 36473, 67482, 32632, 11651, 10628, 68695, 61621, 46079, 15996, 1958, 61353, 64230, 2242, 34843, 54336,
+    23898, 47748, 29771, 4007, 18247, 68470, 2306, 27545, 51304, 28014, 61946, 58631, 50040, 4769, 68071, 2197,
+    41129, 63513, 55397, 18949, 51869, 68866, 58816, 42115, 44546, 41840, 10022, 61501, 56671, 42106, 14824, 48516,
+    48774, 20716, 17051, 64334, 47604, 44005, 51775, 67989, 29974, 70369, 39436, 4880, 9416, 32082, 34078, 18504,
+    43647, 50342, 29145, 46410, 5130, 56024, 5081, 54356, 56042, 22630, 65490, 5438, 46658, 4786, 31327, 8766,
+    7601, 12999, 22724, 7998, 69069, 65234, 70260, 19215, 29063, 36403, 7630, 57260, 43891, 11560, 33868, 30664,
+    42663, 9489, 63283, 24832, 4395, 4590, 54074, 67601, 65772, 3173, 40734, 41746, 48789, 19028, 38533, 11993,
+    44170, 28812, 2417, 27997, 34935, 23457, 58870, 53802, 10700, 33822, 3987, 32233, 53547, 48652, 20388, 66232,
+    21423, 53046, 64298, 15136, 57314, 39626, 15875, 61074, 55267, 20888, 61533, 27798, 61534, 42747, 11435, 32561,
+    45650, 47399, 26480, 12762, 5591, 57951, 21802, 37397, 45830, 4357, 31960, 54182, 54080, 44427, 49228, 22373,
+    45222, 15291, 2553, 5598, 53397, 69423, 67064, 57174, 18793, 30007, 34454, 7167, 8667, 6243, 2607, 64383,
+    65481, 32477, 63551, 49625, 44836, 9774, 10444, 1713, 14301, 22099, 22809, 31027, 37256, 58150, 61179, 15841,
+    58236, 40534, 48209, 24587, 16997, 8029, 37119, 18938, 49624, 5703, 60561, 62069, 31924, 31715, 17733, 6340,
+    5412, 61971, 13850, 11781, 18725, 35924, 46617, 9519, 54270, 38095, 60074, 12177, 38865, 32714, 68506, 10650,
+    62401, 29480, 69961, 56260, 53391, 31827, 25606, 7726, 63032, 29404, 57605, 26086, 53645, 16667, 46885, 60344,
+    63793, 48242, 7240, 10641, 34941, 54212, 27102, 68771, 29657, 37893, 55635, 7279, 3516, 41272, 18167, 67182,
+    65172, 22471, 62518, 28211, 31183, 43797, 5516, 10727, 62183, 56698, 29267, 53133, 46463, 22170, 22540, 66687,
+    62858, 21207, 56064, 22660, 34909, 54840, 23164, 15647, 19031, 36689, 43688, 29273, 59987, 52770, 51933, 6178,
+    40766, 20664, 24036, 50066, 2582, 11634, 18190, 40802, 54539, 50669, 34517, 64285, 12745, 33827, 22003, 15369,
+    50286, 53206, 63064, 10835, 68190, 12092, 14550, 61631, 9938, 22297, 39635, 30975, 56269, 50357, 21868, 3444,
+    5807, 16034, 37994, 7636, 53496, 19881, 31930, 20144, 29201, 17010, 26879, 34753, 42681, 24264, 56932, 4594,
+    4967, 46305, 68072, 20078, 58420, 16995, 14335, 57869, 4385, 60901, 57795, 15929, 65416, 3386, 9239, 54920,
+    40474, 14606, 55569, 44398, 21481, 64229, 52365, 68641, 65606, 57271, 39534, 14395, 26730, 61262, 53060, 55370,
+    1403, 9351, 49484, 2517, 1188, 66808, 31339, 49352, 23559, 53714, 27705, 60732, 38595, 9936, 55608, 12473,
+    8317, 21395, 9896, 66068, 63657, 61091, 36069, 17890, 17711, 28005, 58663, 34603, 46136, 11013, 46310, 38492,
+    266, 19743, 4342, 49365, 37093, 5393, 52784, 60508, 58762, 3196, 19142, 35793, 8318, 13981, 68963, 2405,
+    57810, 35352, 45567, 19672, 60638, 19660, 13324, 34560, 56236, 56502, 52507, 54669, 28027, 47912, 63560, 63488,
+    11602, 59578, 45478, 54173, 55120, 8725, 50826, 42890, 671, 26858, 49200, 53581, 68804, 67385, 61876, 20473,
+    43588, 61601, 4623, 54871, 49346, 38029, 67448, 68066, 66948, 15471, 30551, 70219, 54622, 47649, 20440, 21381,
+    62384, 21877, 65672, 13439, 15959, 62368, 52810, 39752, 12448, 4655, 36458, 58986, 27190, 17365, 16673, 36907,
+    41803, 53907, 27395, 23100, 44798, 61078, 57395, 27618, 70005, 10297, 55402, 26018, 44076, 20171, 63893, 12088,
+    33715, 37484, 16581, 19273, 48200, 4481, 45590, 2489, 49554, 35455, 55596, 24874, 42874, 55833, 33304, 26518,
+    68197, 50242, 36614, 64941, 48621, 68806, 16812, 26511, 67339, 32264, 63296, 2562, 26023, 63783, 40382, 37825,
+    52075, 39699, 34410, 5006, 6619, 47959, 12552, 5998, 69040, 15515, 36244, 24442, 59596, 7193, 66977, 55629,
+    35948, 2167, 4836, 46644, 62935, 49835, 44692, 48115, 27792, 49980, 69479, 44992, 28236, 22576, 54936, 16233,
+    24322, 29600, 34228, 44137, 69186, 17019, 33694, 34482, 19960, 42242, 45461, 24852, 45459, 21538, 46436, 51058,
+    49315, 69922, 48058, 19434, 66712, 33399, 67187, 62734, 7415, 15537, 40271, 69457, 386, 19131, 22837, 50370,
+    2035, 30066, 42040, 61279, 8153, 51845, 38934, 68497, 11020, 38200, 11261, 66355, 66004, 35746, 22730, 64073,
+    21055, 64133, 40251, 27947, 60980, 39143, 46209, 36551, 33510, 65527, 54294, 43305, 38329, 18051, 51559, 51416,
+    41234, 11068, 53917, 60746, 48188, 17115, 45483, 43349, 32758, 41708, 23275, 22506, 17613, 44794, 27335, 39951,
+    12405, 39694, 5194, 32678, 35742, 22919, 35277, 2973, 3998, 11604, 61817, 24140, 74, 69816, 12641, 34100,
+    17864, 60402, 23923, 38199, 56615, 41222, 65900, 38458, 55101, 67906, 21089, 70007, 21119, 30753, 58221, 35322,
+    45034, 20912, 36052, 8327, 33434, 14289, 32458, 57889, 35251, 56461, 3767, 11880, 43211, 14445, 57876, 2721,
+    28036, 11179, 56969, 1776, 44730, 50955, 17653, 37227, 1740, 17290, 66928, 31068, 68332, 27392, 66109, 26526,
+    55746, 30714, 43685, 64766, 5524, 19839, 34829, 3879, 38100, 19097, 3114, 243, 10704, 67550, 50526, 33728,
+    56379, 18564, 21444, 64050, 51629, 44401, 33815, 3017, 46135, 58966, 25806, 64714, 19760, 45114, 14461, 52766,
+    15338, 48915, 19227, 24690, 561, 54487, 3778, 51777, 42213, 34426, 47462, 22422, 1511, 8596, 5202, 5976,
+    22138, 13337, 30165, 23171, 29272, 30340, 803, 11160, 33709, 4743, 26034, 68885, 7767, 47802, 1935, 44147,
+    50200, 36427, 22561, 51997, 51966, 17706, 39977, 64683, 11556, 51577, 52384, 17186, 51550, 13996, 35633, 66156,
+    5123, 11276, 68874, 36624, 52314, 53428, 35859, 5292, 12583, 27558, 61830, 16577, 4562, 10204, 33243, 44942,
+    44623, 42409, 48540, 15261, 45551, 4329, 66586, 7603, 60670, 11242, 37967, 68263, 35983, 64896, 12921, 46121,
+    22869, 57093, 2603, 60912, 20053, 24278, 11605, 56428, 15410, 50832, 60270, 51914, 67316, 23127, 11414, 31974,
+    33429, 50287, 44288, 30817, 37824, 14086, 19384, 57267, 17028, 52253, 49243, 55522, 33656, 62756, 64348, 50328,
+    28738, 15476, 42552, 21205, 20219, 63843, 17749, 39443, 24875, 65956, 67965, 31412, 23963, 51307, 56556, 48812,
+    38357, 37269, 28959, 16739, 66703, 13862, 34559, 22872, 25515, 35080, 22751, 37527, 31369, 34339, 16312, 14253,
+    64898, 52970, 5936, 45189, 13121, 1427, 3656, 35645, 5898, 549, 64281, 14229, 22145, 1407, 34141, 2408,
+    42842, 57685, 45876, 20938, 28577, 3563, 1221, 18974, 58917, 64749, 43622, 36333, 7380, 69905, 12456, 1539,
+    17222, 39131, 22058, 41421, 16270, 6394, 19189, 8288, 42631, 37047, 3028, 54049, 20512, 50835, 46925, 13888,
+    20789, 14496, 33011, 49493, 56093, 64902, 44771, 3408, 10270, 9357, 20560, 25554, 23442, 19004, 43711, 20527,
+    68298, 18513, 11393, 70542, 51060, 17502, 55920, 40557, 54260, 43500, 3824, 5325, 24800, 41931, 42667, 31970,
+    61072, 4854, 28139, 15914, 153, 47269, 62240, 50448, 31175, 19155, 62925, 49751, 65710, 67150, 67345, 31074,
+    38640, 52474, 55877, 59016, 8353, 53377, 29586, 27505, 9680, 60882, 4910, 33358, 69139, 43365, 44211, 21577,
+    66521, 44328, 14388, 60105, 66410, 70179, 19402, 35891, 47978, 49099, 54570, 32346, 53007, 31457, 69712, 30024,
+    19728, 52105, 3847, 38239, 57949, 2245, 4516, 59992, 27050, 60035, 34971, 28966, 64004, 1912, 31299, 31525,
+    20330, 61693, 16627, 4307, 14096, 34365, 7527, 28273, 39809, 49738, 24390, 68853, 21478, 6361, 46817, 16994,
+    26966, 12494, 24571, 51408, 4238, 70215, 30592, 42162, 26189, 70412, 11798, 58302, 158, 31210, 13782, 8506,
+    7732, 45342, 11676, 43310, 20262, 67574, 36420, 36230, 57509, 44739, 20655, 38631, 7051, 36151, 19314, 36140,
+    4465, 6234, 47304, 12582, 67152, 21310, 69486, 47402, 46816, 21649, 28975, 58712, 63147, 53620, 52852, 42373,
+    45057, 30500, 53729, 69581, 42273, 47193, 8141, 55986, 55256, 66639, 23069, 59219, 2697, 21734, 35375, 10961,
+    31233, 49275, 48919, 54585, 60285, 26959, 9920, 28384, 54065, 29514, 8737, 59995, 30999, 33051, 34393, 70237,
+    46482, 47577, 65409, 224, 40144, 36660, 44920, 55452, 8058, 7520, 12165, 31488, 8691, 12590, 61108, 30991,
+    32616, 35605, 399, 38125, 33976, 44302, 9227, 18227, 2723, 33083, 60904, 44399, 31093, 2221, 68334, 11481,
+    15980, 47433, 69303, 50933, 45231, 21857, 61017, 15269, 46703, 55541, 50872, 61934, 47376, 67383, 63175, 42660,
+    23471, 69733, 31010, 42505, 47820, 19069, 11894, 44025, 55218, 227, 29448, 42341, 69593, 66195, 8727, 69574,
+    42345, 19787, 53915, 54650, 44181, 2527, 44946, 12457, 11703, 48724, 27855, 38249, 68302, 22817, 39263, 46166,
+    42109, 6514, 33406, 64054, 26469, 18300, 26874, 46203, 14746, 67735, 13001, 36970, 14406, 27419, 50672, 7032,
+    45705, 12229, 51319, 5160, 24110, 51812, 29105, 8217, 53402, 42044, 50564, 47531, 42992, 69283, 60159, 14302,
+    22603, 40027, 54792, 10061, 47122, 23856, 44945, 51538, 17123, 4242, 45675, 54369, 17482, 69729, 13995, 61894,
+    21348, 11627, 27949, 55016, 27212, 7925, 29516, 34659, 58403, 5355, 10954, 6111, 57903, 9002, 964, 7671,
+    69737, 54463, 57089, 62437, 22844, 15575, 27172, 53433, 60586, 27016, 23910, 7990, 44834, 55787, 29944, 49998,
+    12673, 21540, 35734, 32841, 24241, 14700, 57980, 7291, 46911, 53920, 64611, 23837, 52975, 54593, 63548, 68501,
+    30894, 32387, 39211, 4456, 8369, 23894, 56349, 16972, 6565, 16914, 68708, 25054, 37754, 15646, 22126, 34602,
+    1359, 67220, 34300, 32803, 32130, 8556, 52430, 37253, 15713, 37376, 59740, 53301, 17562, 69752, 47852, 40696,
+    27300, 44481, 53044, 24240, 9467, 8293, 35336, 26442, 6303, 27314, 62425, 43596, 63572, 8547, 44509, 34761,
+    68680, 45213, 19747, 26072, 36963, 54627, 46381, 54362, 10515, 16813, 30858, 34925, 59374, 17960, 54022, 57470,
+    50028, 17031, 29878, 61891, 30929, 52452, 61360, 62865, 13054, 29728, 15524, 12553, 30941, 36263, 35998, 58534,
+    48421, 59335, 23079, 11034, 63024, 48026, 9120, 62874, 52298, 4522, 44191, 66448, 48537, 42601, 58940, 41826,
+    43413, 65901, 14244, 12579, 14598, 12593, 22219, 39861, 23882, 3242, 54626, 55542, 56729, 65232, 38268, 19346,
+    63496, 59969, 70110, 31396, 19945, 42090, 5633, 19351, 60511, 62623, 59026, 23465, 49630, 10296, 8507, 44694,
+    26840, 15901, 30829, 63369, 10027, 69973, 39349, 55056, 28381, 11413, 14045, 53000, 22529, 8607, 69767, 69207,
+    22116, 27988, 28354, 51596, 22487, 35778, 29790, 27636, 3304, 40842, 35709, 53579, 47318, 4255, 67400, 59104,
+    64622, 26732, 42706, 36812, 10878, 19993, 64392, 22971, 55004, 63680, 42572, 65148, 44382, 62509, 29371, 43856,
+    51133, 66725, 18988, 47180, 13220, 15356, 34725, 14066, 29335, 16510, 12288, 53713, 28103, 61354, 12945, 34250,
+    45581, 13081, 67836, 58131, 49831, 50892, 49506, 45212, 55518, 69868, 2609, 22284, 18229, 59031, 40678, 65235,
+    21536, 22328, 12615, 55172, 21720, 31475, 43296, 39964, 24079, 67553, 4180, 33997, 53305, 40924, 43876, 41887,
+    64882, 26954, 10930, 28064, 30878, 58625, 23795, 57561, 14497, 5717, 61117, 9984, 40508, 65143, 26716, 750,
+    19306, 22736, 2376, 59264, 38222, 648, 1666, 41888, 50971, 62439, 34907, 57369, 50026, 56507, 32664, 17566,
+    63366, 14103, 37564, 8820, 33376, 20995, 5068, 13940, 34305, 56839, 63531, 44810, 62622, 51678, 69933, 53272,
+    65227, 47825, 49139, 67, 30792, 20126, 5575, 24007, 42077, 60852, 70463, 58819, 51891, 1970, 53315, 23029,
+    28477, 18696, 49824, 14222, 62113, 18323, 22376, 52263, 8469, 52465, 58115, 1159, 50887, 34414, 68377, 10134,
+    60255, 11955, 56582, 32671, 18130, 60524, 20150, 66854, 69147, 48765, 4123, 52836, 29450, 67919, 67789, 63769,
+    43034, 13819, 19271, 49457, 21615, 53605, 32076, 65964, 58798, 42561, 4407, 56849, 31649, 2778, 41415, 48124,
+    18049, 68473, 55003, 5746, 17052, 7948, 3726, 37211, 58481, 8264, 45928, 67116, 4664, 36098, 2761, 37301,
+    50772, 8846, 67418, 12135, 24609, 24127, 66611, 45866, 52350, 37095, 65977, 45111, 19287, 22568, 3828, 62574,
+    43631, 60069, 59450, 52623, 16912, 50091, 47729, 68111, 63998, 43599, 55214, 50434, 38953, 26734, 6333, 57543,
+    70232, 52060, 14827, 15035, 59495, 38068, 5316, 11704, 61064, 38931, 849, 65725, 40242, 52814, 46351, 12732,
+    12001, 21644, 6600, 63826, 41463, 43936, 69730, 46693, 60837, 19711, 21745, 35832, 9131, 56027, 57884, 64412,
+    69763, 7188, 24111, 14716, 27097, 12864, 69005, 4635, 59711, 43512, 8251, 47458, 65512, 763, 4302, 22436,
+    65256, 5556, 7369, 23747, 16998, 22723, 49183, 53888, 2460, 41117, 26713, 38047, 31815, 41007, 32209, 66875,
+    12121, 44044, 16760, 39253, 899, 61590, 48204, 65414, 42807, 65333, 13999, 40154, 68535, 57245, 45272, 20061,
+    65866, 11439, 68956, 2150, 53195, 59679, 44727, 5129, 8054, 59983, 35493, 33398, 1236, 32224, 24959, 48560,
+    38025, 7144, 22720, 60697, 9208, 5838, 57380, 47421, 10329, 37094, 66213, 6113, 19551, 19966, 56862, 13553,
+    42694, 35272, 54250, 67833, 53335, 35339, 16305, 5141, 33737, 7957, 16535, 54819, 60247, 14814, 11044, 53319,
+    50729, 69321, 24927, 30435, 3942, 38659, 24566, 20629, 4175, 52063, 33084, 64311, 1228, 27970, 3938, 22074,
+    67209, 70423, 60008, 15714, 65797, 27040, 6109, 58503, 21224, 20365, 24082, 2213, 26942, 6567, 52698, 8708,
+    33785, 22434, 70146, 35988, 30090, 39182, 67966, 33690, 952, 41036, 13325, 22662, 59368, 48780, 5991, 27941,
+    13234, 1785, 57731, 50255, 68629, 43909, 59256, 12794, 64235, 28385, 24163, 513, 40773, 60170, 47246, 21715,
+    33322, 10564, 19570, 52434, 3276, 10267, 58360, 52536, 49540, 16208, 9337, 61165, 19036, 50968, 40026, 62840,
+    57809, 40012, 3235, 41929, 12258, 55968, 36990, 62233, 20829, 6130, 51105, 27625, 55261, 1789, 18576, 66449,
+    38833, 6992, 34525, 12021, 55630, 6342, 47497, 24328, 41364, 62788, 41022, 37718, 3417, 20338, 21088, 68381,
+    45742, 15786, 13331, 52220, 34555, 68545, 30358, 70218, 31054, 35000, 69589, 48609, 23444, 11003, 36073, 7225,
+    60639, 28590, 8996, 8903, 67042, 39247, 37364, 16513, 68668, 12454, 43143, 18686, 26925, 36449, 44142, 37661,
+    584, 588, 62220, 32886, 57566, 53508, 39916, 22377, 49467, 26282, 46861, 21890, 23451, 37616, 22607, 27267,
+    69503, 32043, 22334, 20976, 67432, 60239, 45225, 41128, 53587, 53146, 27917, 1880, 65843, 56084, 67830, 47676,
+    2336, 6227, 25747, 68628, 28761, 6655, 45368, 53735, 23774, 25561, 60546, 51833, 17322, 14956, 23799, 54458,
+    18455, 64111, 38835, 33716, 9299, 271, 16558, 56618, 30876, 44007, 45230, 44461, 22309, 18515, 1255, 57433,
+    47694, 35714, 62081, 47741, 70346, 64454, 16689, 60047, 45508, 47647, 17620, 16391, 61085, 17333, 26985, 46243,
+    30954, 62551, 70038, 21074, 48046, 51705, 32279, 38720, 63145, 3594, 7577, 29151, 15993, 14734, 4103, 24595,
+    47923, 37377, 14076, 29255, 41231, 8048, 9133, 47894, 39803, 30783, 5539, 21526, 19243, 63133, 53392, 70022,
+    28055, 25852, 63232, 43649, 31212, 36398, 30959, 43576, 60780, 67205, 8406, 44602, 60702, 37141, 53586, 66756,
+    2848, 6125, 38863, 9551, 49069, 39818, 39013, 4933, 36879, 2222, 36330, 15250, 49138, 47392, 34334, 66446,
+    47799, 2154, 13849, 43515, 25879, 14161, 42909, 52351, 30065, 61810, 24038, 45353, 62742, 49712, 41479, 10259,
+    25796, 3654, 10216, 2578, 6056, 49964, 39326, 1750, 60361, 36089, 6855, 5769, 16428, 69249, 13119, 27493,
+    43300, 61504, 42069, 40120, 10300, 16278, 49399, 35168, 42995, 45162, 48581, 47096, 11207, 15430, 56085, 4105,
+    25872, 12516, 15259, 39465, 46625, 35393, 26782, 25956, 55893, 29607, 23240, 40542, 21287, 25360, 42232, 56009,
+    64456, 50231, 25859, 40778, 28736, 60818, 40068, 6628, 60956, 18283, 44818, 40681, 31250, 34700, 14747, 9558,
+    53593, 56169, 65586, 38138, 35541, 4160, 52107, 36605, 54033, 34567, 35827, 53568, 67699, 34549, 23620, 69521,
+    6875, 14692, 6919, 31911, 33022, 31938, 33632, 38619, 45391, 1276, 43476, 12183, 5055, 66685, 2634, 16781,
+    9189, 56380, 53865, 51154, 59471, 34152, 28111, 54201, 18905, 5352, 70054, 55224, 2005, 38577, 13345, 1411,
+    10306, 31758, 34717, 63085, 68387, 66694, 66852, 37164, 59594, 44597, 45382, 9115, 5614, 21403, 2958, 53160,
+    13271, 2253, 36809, 66005, 32238, 1243, 44913, 3649, 35441, 38698, 49960, 17941, 49842, 12971, 18724, 62044,
+    17251, 46484, 1505, 27731, 64634, 15429, 986, 54520, 47998, 37082, 46590, 24010, 12005, 44297, 49595, 17519,
+    56225, 30600, 45155, 45416, 57356, 20723, 17281, 27148, 53953, 36756, 31790, 48153, 5157, 8319, 9469, 44219,
+    26591, 12477, 47486, 4902, 12358, 22936, 24447, 67306, 30068, 53055, 13360, 21680, 2209, 50547, 11968, 41055,
+    29002, 32916, 31537, 69198, 64005, 31295, 14660, 4503, 5186, 11232, 53202, 52303, 53150, 7870, 53442, 44619,
+    10024, 24736, 58459, 2427, 59306, 16102, 30972, 49110, 38803, 35609, 18747, 63344, 22937, 52469, 45475, 9957,
+    41549, 40250, 4980, 1630, 15064, 65351, 25713, 63817, 42406, 34684, 58492, 54512, 7390, 56948, 54804, 36480,
+    26907, 23376, 35003, 33328, 9515, 4047, 13583, 37192, 29928, 42102, 38163, 59206, 9842, 4249, 22782, 53209,
+    44670, 18977, 41389, 28928, 22661, 19292, 1447, 63185, 7571, 22632, 43866, 5203, 69332, 29141, 5571, 46581,
+    61412, 20759, 56458, 56108, 48831, 576, 48066, 22925, 41842, 56355, 15070, 46497, 53591, 39244, 50995, 60583,
+    66787, 30739, 6862, 58710, 20433, 68921, 17997, 43436, 45275, 70030, 13784, 20014, 3291, 5061, 19322, 47993,
+    31579, 58741, 29465, 55795, 30149, 61359, 49536, 13925, 68157, 35154, 1367, 42493, 18684, 68751, 31432, 41436,
+    62580, 25470, 44721, 32175, 32008, 65260, 236, 33257, 28080, 48556, 35969, 57415, 6173, 32956, 52842, 13276,
+    32330, 3334, 49593, 66641, 51205, 8489, 29088, 52114, 25812, 18554, 16367, 6258, 27140, 41657, 18619, 50312,
+    4784, 59452, 13064, 24914, 23732, 5741, 13209, 20362, 33278, 45871, 50103, 2360, 2791, 12372, 68105, 28511,
+    50606, 5465, 9218, 35378, 3106, 63902, 48814, 15595, 13728, 64176, 12329, 45399, 44612, 22275, 62145, 4466,
+    3643, 15703, 15326, 45896, 23344, 26152, 21631, 62376, 16120, 2888, 53123, 22478, 34324, 26107, 22996, 32042,
+    19929, 6897, 14248, 53552, 20892, 20915, 50356, 21555, 24978, 9829, 50451, 6306, 62284, 56220, 40836, 61724,
+    18281, 9458, 62000, 42052, 17831, 7031, 53009, 31788, 31772, 63305, 35271, 69618, 62461, 16150, 63325, 37528,
+    27730, 45184, 59831, 23618, 23263, 7131, 16755, 28389, 14534, 16452, 37846, 35911, 6988, 49008, 55909, 1061,
+    30842, 24646, 1055, 6041, 62914, 45218, 52838, 785, 63910, 4626, 61541, 1224, 51919, 17500, 16899, 18764,
+    68717, 34119, 2957, 24341, 7772, 55641, 18242, 9468, 53502, 1374, 18465, 66114, 21473, 44199, 59721, 48371,
+    69707, 23143, 49957, 44518, 45224, 70119, 59786, 9451, 39004, 68054, 46633, 2702, 45479, 23276, 12225, 60011,
+    2096, 58291, 9132, 19166, 58687, 66865, 65539, 26104, 59801, 50299, 68290, 13800, 13773, 3731, 2313, 28670,
+    25407, 38821, 46674, 63789, 20051, 29919, 55751, 36425, 36964, 988, 687, 30321, 17736, 544, 69035, 15947,
+    58154, 36228, 27488, 27268, 43200, 27256, 1561, 13694, 12337, 11600, 11337, 67063, 41515, 43549, 45986, 11879,
+    45446, 32519, 46323, 9225, 64969, 40821, 45099, 64867, 13215, 10833, 4339, 11185, 50388, 35491, 56032, 67874,
+    56727, 23893, 22102, 53186, 36606, 9531, 37509, 18968, 46349, 14958, 8605, 30507, 63190, 7346, 38480, 50543,
+    37321, 46465, 17362, 46126, 17780, 41246, 12918, 8910, 30004, 20196, 41804, 24721, 58589, 52431, 48168, 18677,
+    25304, 53329, 300, 4122, 15530, 68386, 51257, 59023, 23876, 62700, 3406, 1822, 24291, 16032, 36043, 50165,
+    36183, 3807, 15880, 53197, 3990, 59389, 30871, 15638, 44203, 16902, 38744, 56449, 46072, 35014, 50237, 19094,
+    41660, 42357, 49261, 3072, 30990, 24492, 61445, 25589, 69356, 4566, 46027, 50867, 13031, 1562, 19168, 21284,
+    47958, 60733, 42657, 60880, 21142, 55185, 61367, 23469, 54945, 11038, 7163, 27967, 32285, 51714, 29112, 69775,
+    31850, 62043, 46623, 3626, 59275, 65007, 7300, 63518, 31530, 67664, 21562, 10030, 50349, 39469, 68502, 49257,
+    8488, 59722, 61834, 21201, 7570, 20368, 61606, 59493, 59183, 51971, 11070, 24106, 65840, 52486, 38002, 54387,
+    66551, 36055, 7047, 50898, 8248, 45545, 20907, 65385, 43802, 11033, 16293, 2969, 7550, 37165, 21194, 7466,
+    39748, 21133, 33221, 36471, 48787, 38366, 60400, 51665, 58436, 6826, 46022, 51092, 2576, 57593, 11912, 32847,
+    69781, 4059, 64518, 3986, 4711, 713, 67709, 58329, 62005, 9377, 2122, 33034, 15815, 12677, 32647, 32129,
+    35327, 66190, 23914, 59703, 1906, 9854, 1711, 341, 34010, 63655, 55011, 5979, 68211, 61248, 51619, 7741,
+    16154, 9229, 3929, 50298, 59340, 17008, 16417, 49299, 35919, 36141, 54495, 70450, 64154, 48307, 31407, 44877,
+    11069, 29258, 17996, 31913, 18771, 46472, 23735, 35595, 59666, 54207, 57474, 47793, 51972, 35688, 18318, 22259,
+    62360, 22148, 37581, 56298, 12911, 39207, 56272, 67175, 25006, 51167, 22795, 69535, 1079, 32141, 7598, 25029,
+    41975, 56678, 44352, 18208, 31079, 374, 52041, 18685, 66702, 37885, 30146, 55729, 55776, 63973, 27247, 5490,
+    30980, 65366, 51782, 1424, 5573, 18120, 44229, 5118, 37611, 51179, 62880, 33609, 25122, 11327, 17230, 4834,
+    3381, 11302, 28653, 37305, 56453, 30718, 52934, 43332, 61629, 38612, 15731, 4116, 37853, 37566, 65865, 51041,
+    62392, 50374, 65142, 27027, 63346, 32682, 51795, 55911, 30737, 65375, 17351, 28409, 63864, 69492, 5477, 27605,
+    42746, 37736, 62269, 12127, 34767, 17258, 57246, 22856, 44666, 46737, 67485, 16067, 64939, 34605, 14574, 39451,
+    4690, 32219, 3884, 7339, 7574, 12264, 40715, 68439, 57199, 17515, 6369, 10743, 16966, 24818, 39600, 16773,
+    58565, 29819, 59603, 69281, 19411, 25783, 21296, 2139, 55444, 7909, 59395, 8427, 66537, 58645, 59853, 59329,
+    70177, 14833, 36220, 69326, 45171, 3611, 36653, 53811, 22811, 46945, 28622, 67752, 29000, 65229, 1896, 9666,
+    64797, 41620, 6707, 19228, 39104, 48142, 8603, 44574, 57525, 43047, 59715, 17385, 42333, 37222, 22435, 35885,
+    21977, 4995, 15237, 40131, 48506, 57946, 28542, 20660, 60396, 22017, 20292, 57031, 1285, 61651, 11570, 9739,
+    22180, 50557, 11815, 1086, 59077, 14219, 44271, 36047, 1259, 24182, 60786, 28878, 2182, 61383, 64475, 59464,
+    15090, 20333, 53509, 35601, 52755, 12015, 45401, 21679, 8066, 35078, 32136, 55622, 40874, 26125, 35136, 7152,
+    24676, 28189, 22956, 35348, 2447, 45210, 42943, 37747, 18491, 35584, 69475, 50965, 48542, 6691, 10308, 51035,
+    12425, 55348, 42826, 44769, 70477, 47049, 43094, 14081, 43294, 65708, 25202, 46500, 22984, 19900, 3470, 729,
+    57855, 8049, 55290, 32158, 7463, 25675, 14093, 46493, 53355, 29467, 48468, 59774, 9664, 16186, 15586, 43565,
+    58497, 48311, 26843, 54609, 68991, 10345, 1302, 60264, 21071, 56283, 478, 7651, 33771, 9417, 39679, 15843,
+    54019, 37382, 39924, 1429, 46332, 49531, 23075, 29490, 35296, 47704, 9062, 56734, 49057, 61859, 35106, 41098,
+    20406, 27428, 60502, 42500, 34679, 52616, 30730, 16435, 33724, 10843, 21872, 18348, 66881, 11405, 35148, 65286,
+    55365, 29676, 44349, 44831, 27776, 56184, 14707, 61163, 25694, 2881, 29920, 55763, 57558, 33587, 17815, 61488,
+    57296, 66677, 17563, 54979, 13247, 3519, 56442, 11334, 35594, 50911, 17507, 18462, 5735, 17863, 21833, 41662,
+    67840, 62297, 57848, 69437, 70517, 30611, 48983, 61153, 57941, 17962, 60626, 18715, 57811, 30652, 23318, 63093,
+    48951, 53841, 60610, 49947, 44227, 56947, 23196, 59552, 32259, 44361, 50042, 28419, 65773, 35614, 22253, 49145,
+    45464, 29213, 56856, 47529, 69252, 17329, 12113, 1618, 10048, 9621, 59850, 3749, 33077, 51601, 47888, 50515,
+    42545, 12750, 40644, 29231, 61145, 29155, 21883, 9270, 65702, 60537, 50379, 32551, 24942, 12715, 38098, 18366,
+    32580, 59259, 24250, 37807, 4469, 53475, 15554, 55339, 5727, 37584, 44515, 10180, 6674, 43678, 4561, 60817,
+    41273, 64628, 56643, 46510, 54805, 15462, 11145, 65549, 40518, 45432, 14128, 24928, 55141, 9923, 3215, 51884,
+    10610, 40835, 67415, 62365, 39645, 29518, 63367, 12993, 54481, 56841, 43002, 64283, 30133, 56277, 28486, 39887,
+    33759, 66325, 44032, 58676, 12384, 59391, 59040, 66526, 18291, 25828, 13820, 7781, 44071, 51736, 8849, 44441,
+    49926, 12704, 2067, 48843, 66376, 51063, 12797, 43746, 44412, 57776, 16959, 49512, 33593, 41994, 43854, 49412,
+    42426, 26797, 2459, 4448, 66752, 59063, 16337, 13901, 61275, 44426, 252, 14765, 68901, 58123, 69980, 45306,
+    24908, 45769, 3818, 47569, 4936, 23588, 41252, 65149, 65639, 35191, 50311, 1472, 7222, 1149, 18082, 15428,
+    22078, 68569, 16984, 26474, 3668, 68841, 48798, 9989, 40471, 41966, 32525, 52703, 35306, 66252, 58298, 46006,
+    21258, 10581, 63784, 33414, 34320, 38007, 16802, 50698, 4513, 53095, 67512, 51840, 10937, 54309, 50925, 2949,
+    46836, 1581, 58974, 50720, 34673, 14324, 63013, 6152, 17044, 29843, 35386, 16346, 64130, 47161, 35588, 69042,
+    44135, 31146, 2720, 37882, 43938, 31823, 31451, 38943, 54322, 37829, 54882, 8131, 25173, 51345, 16095, 18420,
+    17952, 13664, 52286, 3076, 33940, 37572, 9649, 51377, 57532, 21138, 61416, 64673, 17775, 45284, 17785, 14540,
+    38306, 40701, 65523, 49039, 14675, 2963, 10122, 56256, 47967, 13311, 10827, 66839, 54002, 29629, 14341, 33230,
+    5701, 28008, 63743, 1400, 18877, 65619, 13655, 63510, 48450, 29761, 17994, 5606, 18192, 26513, 37044, 13651,
+    25329, 43736, 36810, 32976, 12232, 115, 32221, 8938, 37471, 8257, 59750, 12149, 54674, 6136, 39291, 50967,
+    34068, 69617, 42708, 54394, 54972, 22890, 13319, 24663, 3657, 37463, 4157, 2714, 53849, 13134, 50510, 47749,
+    62782, 13973, 67969, 63052, 27021, 40624, 55540, 56656, 43853, 45676, 57621, 68019, 48487, 7080, 67835, 60012,
+    69363, 54070, 27068, 46796, 47349, 37344, 20594, 9393, 46219, 13043, 26880, 3087, 27546, 56067, 509, 43268,
+    36380, 36936, 9193, 55398, 32915, 62685, 38650, 22344, 3286, 38116, 19533, 24702, 3792, 4480, 35302, 36199,
+    18013, 54176, 39410, 68047, 43752, 63316, 15908, 30913, 50281, 20475, 14459, 20661, 56804, 25579, 10484, 25204,
+    26778, 18881, 32351, 20783, 69106, 61707, 2366, 27552, 10340, 21234, 5502, 18026, 51422, 39740, 68208, 36087,
+    41677, 11139, 69782, 31910, 14847, 16359, 64289, 69605, 65086, 13289, 26126, 18030, 49486, 54653, 18600, 29449,
+    11399, 35099, 25870, 56094, 39751, 54741, 53474, 66680, 23597, 68429, 48786, 36124, 51720, 65261, 69885, 33808,
+    23026, 27683, 19204, 51276, 59251, 46279, 16214, 29070, 63568, 29343, 46749, 67212, 59959, 57614, 12727, 26776,
+    23770, 17112, 24183, 27801, 34911, 34765, 14477, 51527, 42604, 247, 65518, 12664, 38905, 28205, 52310, 16976,
+    52440, 24547, 21859, 1525, 7246, 17474, 30389, 32180, 38544, 24586, 31403, 26615, 10748, 64460, 33727, 9578,
+    91, 59645, 67802, 27052, 27235, 45279, 45511, 46448, 11674, 55187, 25652, 48397, 48097, 56950, 60299, 57471,
+    60906, 24536, 48850, 26890, 26621, 6494, 46230, 56774, 47895, 59030, 52347, 17636, 24503, 61907, 47784, 16635,
+    3078, 49669, 8755, 4454, 21927, 18965, 27656, 49849, 63034, 30262, 44344, 24739, 4924, 25478, 15973, 53244,
+    44935, 44096, 27196, 53682, 11853, 64018, 29367, 68390, 18827, 25677, 20446, 68555, 12211, 26770, 15417, 53884,
+    8619, 64925, 26043, 17004, 14805, 38855, 25745, 33741, 61340, 43901, 14776, 17177, 36837, 45868, 50633, 65163,
+    12669, 38527, 5115, 12153, 4964, 33412, 60490, 10495, 19276, 42076, 63342, 18823, 15707, 46694, 42558, 64954,
+    54532, 65692, 35769, 15039, 38726, 11974, 60985, 16415, 59852, 25383, 24971, 21128, 37155, 66304, 32523, 67081,
+    1709, 32434, 63995, 5514, 5973, 55930, 69676, 35309, 44552, 11779, 26657, 53728, 4473, 19784, 43179, 24480,
+    65340, 1496, 37223, 62645, 10560, 54507, 29530, 50102, 42133, 30494, 50984, 4402, 2149, 23005, 14748, 67250,
+    35387, 37090, 65292, 33098, 3889, 69678, 1027, 70527, 4719, 4308, 46973, 31224, 60522, 68282, 58127, 69997,
+    61174, 21979, 56917, 60499, 34394, 22396, 29029, 27961, 2480, 9965, 1756, 1939, 64357, 44145, 65501, 69937,
+    16575, 48381, 56161, 12314, 4744, 32596, 56056, 56880, 28598, 31998, 30246, 50641, 67827, 26688, 32613, 67367,
+    69294, 10753, 68327, 4528, 24920, 40815, 42979, 44738, 51227, 65966, 53688, 66864, 29847, 58002, 21295, 69075,
+    18134, 50989, 41934, 2373, 69253, 51272, 60835, 12150, 46260, 848, 30233, 70340, 62116, 55140, 41848, 26945,
+    65197, 7448, 47722, 41015, 65373, 16607, 21854, 22595, 69424, 63466, 4630, 5450, 18888, 68419, 11750, 14354,
+    67329, 57919, 17454, 42770, 18589, 17089, 14162, 14609, 31574, 38403, 45799, 24910, 48932, 57192, 19111, 49382,
+    51402, 65822, 4189, 25767, 45445, 175, 65462, 59916, 57994, 2572, 13078, 1456, 7816, 30336, 40399, 49705,
+    22833, 28524, 8885, 53594, 65233, 38663, 52880, 64432, 11487, 10854, 14082, 20867, 14274, 1461, 65470, 67592,
+    52275, 18728, 16871, 61139, 70465, 60730, 5962, 64837, 23440, 1499, 57122, 52417, 57679, 49302, 18344, 13908,
+    36339, 64474, 35346, 56348, 48413, 11956, 65320, 46947, 30575, 20169, 22267, 58311, 46087, 38123, 41138, 19116,
+    26180, 32655, 48037, 61928, 29474, 41434, 55883, 41361, 61840, 37240, 18608, 63392, 57607, 30802, 45594, 21505,
+    23952, 46330, 63977, 38808, 40222, 47014, 26010, 37474, 20239, 52468, 49191, 18729, 2350, 9283, 4071, 30122,
+    21549, 49155, 57291, 65837, 66953, 29745, 12515, 9894, 5470, 9626, 18178, 25030, 43753, 61639, 59653, 9007,
+    43122, 18617, 44418, 32210, 21495, 53352, 61552, 33918, 65206, 22997, 39032, 65330, 17220, 51426, 64255, 29740,
+    60967, 51963, 58937, 17063, 40743, 69860, 42511, 64023, 40509, 59669, 25829, 13997, 51492, 33250, 47470, 192,
+    2861, 38762, 24308, 8548, 17243, 18452, 47085, 22685, 18642, 24148, 59482, 54297, 46045, 41106, 51044, 28145,
+    18872, 53381, 59307, 31513, 58581, 53521, 69420, 54048, 11726, 33433, 890, 44182, 38427, 32153, 63375, 60040,
+    11813, 61002, 65450, 11874, 58984, 12500, 27372, 63077, 63245, 40400, 47241, 64081, 64536, 16927, 23286, 10993,
+    58702, 35288, 9770, 24796, 58258, 57041, 67498, 31140, 42917, 38053, 22889, 37262, 66858, 48222, 30656, 42385,
+    41274, 22381, 26809, 2184, 24933, 13567, 20340, 1267, 67523, 29670, 18561, 27964, 31546, 57588, 17204, 1916,
+    26901, 58930, 66034, 31236, 40885, 5552, 64788, 38555, 11707, 11356, 6468, 31157, 15776, 48673, 43479, 29594,
+    49966, 70112, 64776, 32833, 13953, 37658, 11236, 61726, 66223, 48719, 784, 21754, 41455, 16395, 39170, 70108,
+    55971, 36768, 53786, 26509, 22950, 49629, 7868, 28048, 43022, 18730, 60936, 69377, 5780, 65025, 38930, 8302,
+    52514, 43842, 59065, 61033, 5455, 25512, 35929, 33507, 43636, 21154, 56025, 68860, 8101, 19438, 6248, 7406,
+    20141, 8569, 29760, 15222, 29036, 49153, 63000, 29352, 45507, 31548, 54572, 69319, 67475, 65559, 58122, 49292,
+    63267, 45199, 55498, 69802, 58943, 38839, 61580, 62361, 61872, 51866, 13461, 64376, 60320, 808, 18543, 58758,
+    12578, 43748, 55964, 21432, 2145, 23801, 29580, 41362, 61813, 2550, 63309, 9335, 67516, 7911, 11609, 7811,
+    33362, 14165, 28785, 6618, 21861, 32742, 15091, 56061, 44523, 17056, 45570, 67014, 6661, 54447, 20874, 50326,
+    40439, 29573, 1140, 26690, 35337, 35656, 6704, 60007, 57033, 22189, 57239, 37883, 24438, 54926, 68179, 64069,
+    36290, 62404, 57640, 21337, 37862, 67838, 62168, 29721, 34763, 33335, 64193, 10841, 11589, 32777, 17942, 42691,
+    67384, 29274, 14358, 35586, 18817, 62234, 6850, 37292, 2803, 15587, 70541, 3548, 21272, 52046, 67373, 3534,
+    10330, 57248, 48792, 20820, 46622, 16845, 15792, 16345, 9870, 5262, 24014, 37469, 58225, 11221, 37298, 29119,
+    22611, 54651, 46068, 4490, 1136, 3434, 35997, 33448, 57442, 34606, 62962, 35027, 8937, 21867, 20809, 30485,
+    70233, 38607, 60782, 20324, 21199, 27170, 67234, 18847, 58833, 46172, 4567, 37604, 15397, 49234, 27316, 58725,
+    33457, 69895, 16354, 16742, 25232, 9707, 18993, 43722, 19609, 27465, 64188, 24753, 64761, 68681, 11836, 15118,
+    13992, 7481, 1625, 48661, 39975, 22741, 2340, 45393, 23053, 36318, 7513, 21326, 20785, 35840, 39310, 54951,
+    22499, 9887, 6630, 57751, 37790, 40543, 8155, 70009, 55054, 16815, 58881, 12731, 40063, 42685, 2549, 2046,
+    55281, 9434, 4048, 26013, 4316, 14087, 50700, 19093, 55209, 62837, 35359, 15442, 6405, 41105, 49640, 13905,
+    37389, 53699, 30271, 63153, 12551, 22893, 70324, 54858, 62713, 14767, 43954, 6095, 66625, 18917, 16952, 42137,
+    36490, 12269, 69353, 56159, 47292, 53584, 62427, 55468, 33416, 57965, 40014, 50870, 48776, 69645, 12904, 4143,
+    69340, 69943, 22623, 41337, 3488, 2382, 45960, 30890, 69130, 36257, 57447, 37145, 34705, 65337, 65432, 63754,
+    57079, 54699, 14333, 45525, 3123, 13569, 3217, 9481, 61196, 69341, 25603, 11479, 15823, 7993, 51053, 31898,
+    62122, 2618, 20485, 39991, 8760, 43950, 36613, 1487, 45750, 61409, 43319, 60810, 54899, 3766, 1768, 23926,
+    59433, 43978, 14012, 46499, 11606, 10032, 38346, 3423, 38970, 57981, 31023, 14097, 10200, 24374, 23037, 11169,
+    44245, 56850, 61364, 37830, 32365, 61519, 69573, 8390, 4020, 48805, 12490, 1933, 58193, 38444, 45529, 30639,
+    15448, 39250, 37580, 34433, 2063, 30984, 504, 65248, 44974, 39159, 35237, 23009, 67590, 50432, 27209, 18140,
+    48278, 36927, 49168, 4570, 28396, 40866, 46110, 54158, 7569, 14455, 57637, 4684, 48362, 51889, 45280, 66319,
+    70416, 3433, 2023, 1859, 40573, 50869, 43258, 62196, 34710, 51691, 28664, 55135, 23455, 59055, 42317, 2097,
+    37939, 19059, 55786, 63859, 47592, 24400, 21653, 12115, 39609, 28084, 7523, 49054, 17448, 64525, 37638, 53807,
+    18571, 62586, 12544, 53785, 40689, 32394, 38045, 45692, 9571, 5840, 48254, 38981, 40326, 58207, 2566, 69681,
+    17016, 65040, 32321, 25746, 34127, 46374, 63415, 24443, 67941, 45175, 25760, 45716, 43453, 44749, 34148, 46338,
+    51017, 49195, 59819, 4889, 49924, 8847, 29828, 49706, 10972, 7075, 50318, 41090, 41766, 58051, 63819, 36565,
+    64703, 16922, 59620, 67792, 29931, 54624, 7351, 15360, 40001, 53479, 52955, 40107, 44309, 23857, 49620, 65504,
+    12688, 65364, 38522, 7760, 12434, 32278, 14207, 2328, 37433, 41294, 62410, 3821, 16327, 21785, 57785, 50409,
+    2669, 62008, 940, 43450, 67235, 20098, 29109, 36542, 42773, 61978, 42486, 14438, 42629, 52293, 40327, 14655,
+    17074, 48399, 31391, 51239, 26338, 57943, 62505, 42585, 24665, 17423, 42638, 45651, 46159, 21584, 24180, 30317,
+    64021, 36163, 17083, 18040, 55000, 30554, 42818, 15386, 43568, 42699, 13136, 38992, 48322, 24024, 45251, 40412,
+    33865, 63461, 35990, 66664, 39904, 66572, 37334, 15267, 56223, 53583, 10907, 21501, 52336, 20977, 69669, 5949,
+    21744, 50300, 15054, 37931, 68016, 28337, 62942, 19624, 55096, 67931, 33317, 23138, 40195, 4428, 37542, 28615,
+    23456, 59670, 33925, 24488, 40986, 15764, 64052, 4535, 19915, 3660, 20672, 53297, 41245, 35430, 35124, 68848,
+    27286, 16042, 43930, 30299, 50220, 46081, 9599, 44544, 47928, 66065, 20410, 67929, 49230, 24569, 56647, 27976,
+    56599, 18607, 41357, 68199, 54330, 23088, 14819, 23818, 43672, 20879, 18648, 39334, 60564, 67091, 65780, 3774,
+    61457, 5328, 57773, 57548, 9559, 63543, 57928, 14175, 12268, 23564, 6782, 49025, 2968, 38477, 68598, 53485,
+    26477, 11471, 55118, 21513, 54189, 4828, 2610, 7506, 62701, 2865, 57523, 34102, 19878, 30386, 968, 59697,
+    43899, 31490, 63327, 50963, 57164, 63132, 19998, 31316, 70516, 65027, 33535, 57800, 46532, 21663, 59738, 64494,
+    62527, 9906, 13381, 26658, 27357, 788, 64463, 1628, 62503, 54122, 50886, 41192, 51706, 21569, 69009, 27000,
+    5387, 15334, 5775, 21035, 35729, 53928, 57074, 36815, 58538, 57756, 2384, 59604, 25133, 55250, 23244, 1981,
+    41538, 61448, 19782, 26364, 3251, 65368, 51739, 70445, 32654, 11632, 36109, 48764, 12686, 62629, 24940, 18104,
+    70430, 40617, 18220, 58573, 14305, 51740, 12017, 42555, 36847, 11110, 61453, 65185, 19899, 54172, 22693, 288,
+    31329, 52644, 37989, 59377, 30983, 65219, 40813, 7502, 22429, 46667, 44339, 28550, 65214, 51945, 30594, 69011,
+    27169, 36196, 15778, 1577, 47217, 24836, 16780, 46432, 11457, 42679, 37359, 17894, 32231, 5182, 35087, 4974,
+    9990, 41439, 22193, 57298, 9924, 52573, 3413, 23833, 32823, 30887, 43131, 61609, 63981, 62526, 19156, 19690,
+    7112, 65332, 51494, 34977, 7648, 62083, 10793, 56166, 57693, 48715, 32721, 21700, 61031, 60295, 31648, 25762,
+    53118, 33963, 31108, 43751, 49268, 40221, 32466, 28165, 26089, 2712, 23611, 31384, 20636, 57146, 54849, 37708,
+    16183, 15607, 33178, 55507, 37258, 33417, 4344, 45263, 47379, 3882, 613, 63880, 725, 52953, 36259, 3616,
+    22695, 32969, 41893, 25978, 25738, 27973, 39678, 39572, 2403, 29177, 34374, 67914, 2523, 12910, 29882, 2343,
+    34640, 29254, 32310, 49557, 26744, 18112, 2323, 63339, 61338, 59883, 19496, 64860, 26622, 35683, 18210, 10442,
+    67654, 41447, 23633, 70220, 30451, 45709, 38778, 27905, 33285, 54954, 12079, 5219, 46930, 30018, 17379, 25811,
+    32681, 41140, 37102, 65171, 63021, 24497, 14595, 28037, 60734, 50743, 53081, 12204, 53777, 29621, 53239, 28082,
+    34082, 53923, 50897, 44364, 13182, 54782, 48015, 12360, 64231, 25215, 27718, 28178, 25067, 27861, 15767, 37456,
+    3231, 41285, 45166, 60836, 59957, 56141, 40333, 25798, 18207, 42962, 19024, 68017, 28587, 62636, 38506, 53248,
+    25272, 52327, 49087, 56083, 35573, 36534, 2202, 65661, 41211, 34553, 31154, 16784, 4444, 36153, 6035, 24973,
+    57384, 21300, 44863, 35051, 30797, 35962, 34620, 62326, 28939, 22671, 20062, 16206, 43050, 49351, 61713, 62082,
+    3865, 50136, 18216, 64814, 16944, 60718, 13835, 7945, 26369, 37296, 67018, 17657, 27317, 6616, 29950, 16796,
+    54975, 51479, 17495, 1708, 61475, 53516, 50108, 33951, 9694, 50011, 24807, 69502, 50523, 47256, 29292, 6928,
+    38101, 69208, 4021, 44300, 23890, 18572, 45443, 28897, 46316, 61380, 1674, 49076, 69413, 5799, 8457, 58973,
+    33761, 47511, 48452, 9352, 41544, 27293, 36687, 51922, 44116, 49676, 22207, 47120, 4394, 56148, 62286, 20407,
+    11861, 69929, 31104, 64710, 55001, 38443, 29826, 41379, 69940, 16212, 33121, 28909, 50084, 49210, 65290, 49002,
+    16273, 67463, 68418, 39178, 10620, 58830, 802, 42019, 56005, 38592, 19284, 52006, 27734, 8523, 1555, 33274,
+    23235, 16911, 51065, 24309, 48279, 67337, 65485, 5295, 15560, 15294, 25903, 30510, 10707, 12653, 29106, 45827,
+    30699, 18875, 27178, 52467, 60452, 29588, 29289, 13474, 55113, 36443, 57406, 42424, 20143, 22526, 26044, 12430,
+    41809, 272, 53717, 47857, 36118, 17360, 22415, 32467, 15185, 14859, 19323, 66214, 68571, 63236, 7770, 3619,
+    67141, 4038, 19810, 17965, 26155, 53989, 51139, 70422, 21388, 32695, 3110, 38283, 7421, 4759, 39298, 54373,
+    56114, 41353, 29040, 61207, 47995, 34917, 37734, 7097, 41218, 49558, 7920, 67027, 3949, 59138, 16000, 65687,
+    53361, 27371, 24756, 63321, 30717, 41335, 32783, 70298, 31441, 38547, 2739, 26647, 57059, 70444, 33779, 59164,
+    12725, 2322, 66110, 6321, 11167, 18990, 30996, 23033, 33132, 41304, 54043, 14900, 3754, 34391, 62835, 27210,
+    44521, 4225, 64515, 29365, 68601, 14185, 48571, 20073, 33327, 16015, 43197, 66831, 34568, 43960, 67262, 32171,
+    51507, 50753, 6096, 65842, 27500, 7038, 49810, 50389, 37578, 17888, 43959, 2676, 6350, 39742, 40467, 8645,
+    60680, 49718, 11100, 19650, 34490, 15651, 6076, 33298, 818, 66198, 50686, 44659, 44502, 13923, 70050, 50392,
+    23935, 39517, 55499, 3647, 36850, 40329, 25551, 57455, 27857, 765, 14484, 58271, 30347, 12190, 63103, 1371,
+    27187, 55534, 19519, 37541, 24520, 19790, 34695, 17851, 53138, 39646, 60251, 13748, 49469, 18424, 21544, 39906,
+    41875, 15775, 14788, 13732, 21984, 24936, 10633, 42851, 8719, 31204, 60932, 12780, 59209, 14645, 14965, 34934,
+    53838, 19893, 69143, 39642, 26342, 3213, 54225, 70165, 28050, 46890, 31429, 16093, 51797, 50366, 67783, 14014,
+    41771, 26522, 52323, 12056, 17202, 67078, 47988, 19968, 1636, 39399, 24539, 68087, 40997, 6574, 61100, 58531,
+    2799, 34480, 41829, 7784, 38288, 19905, 31837, 24411, 54077, 19394, 41233, 56183, 56165, 44058, 7866, 33047,
+    9857, 11451, 7919, 1693, 36891, 20513, 28003, 49696, 53396, 49533, 41659, 52563, 33981, 63745, 43078, 64723,
+    41391, 36623, 67344, 43035, 54654, 54490, 11345, 26853, 24580, 7428, 57690, 12532, 31908, 57439, 19461, 11258,
+    5102, 69206, 34215, 34168, 53417, 25172, 9274, 16805, 53622, 29948, 49604, 29665, 13747, 53844, 8791, 60563,
+    49518, 29038, 28320, 46418, 40793, 69600, 68788, 20448, 5996, 63020, 8889, 41905, 30472, 35773, 53659, 832,
+    1603, 34381, 1006, 36270, 66762, 25, 7541, 41805, 28995, 23289, 3317, 47950, 25565, 70021, 33057, 67663,
+    16889, 20828, 66106, 31968, 18453, 4379, 11636, 53318, 39537, 39734, 63263, 17974, 61460, 3717, 27254, 3257,
+    15709, 13538, 22273, 57012, 68354, 14077, 38273, 47295, 63554, 45719, 58438, 16057, 17468, 54308, 18973, 32710,
+    12542, 65137, 60223, 70035, 67587, 5467, 19391, 13359, 44707, 67204, 39030, 58046, 46038, 38157, 42916, 35720,
+    16990, 31907, 11470, 26948, 48111, 48933, 67937, 57726, 41611, 10944, 8610, 49776, 5582, 31725, 13472, 69215,
+    67513, 55898, 31411, 38615, 10933, 49999, 22739, 13244, 29116, 49502, 47020, 3712, 18046, 26812, 29842, 23415,
+    69566, 10224, 62446, 67954, 65643, 68560, 5930, 49157, 15032, 2411, 58020, 38343, 29232, 17907, 9050, 11967,
+    21952, 60017, 45630, 53890, 34812, 21670, 34816, 17221, 22216, 41413, 69161, 62577, 56953, 37552, 38556, 38386,
+    15440, 8151, 8781, 9785, 26521, 62826, 52954, 29699, 30139, 33157, 57019, 66248, 32113, 20356, 32383, 63348,
+    11975, 32080, 29965, 65558, 29932, 57867, 68273, 68397, 31581, 43245, 55412, 62869, 19245, 39595, 13935, 3145,
+    66569, 67993, 24381, 13554, 30967, 53432, 35146, 6075, 35109, 6008, 5755, 59222, 15557, 8338, 33672, 32025,
+    26312, 23260, 29472, 38637, 40093, 60706, 37819, 40970, 34172, 25605, 24135, 23528, 18879, 19013, 55868, 47063,
+    31498, 16747, 1572, 54591, 11972, 2876, 40897, 57186, 36435, 52941, 52911, 41165, 31527, 3261, 50712, 59650,
+    67239, 14924, 13616, 37199, 36162, 39018, 22203, 51856, 55387, 49483, 5363, 23521, 44348, 28291, 43235, 9398,
+    12982, 14813, 48532, 35243, 59915, 5377, 17800, 49494, 50535, 69248, 31444, 10351, 65969, 13790, 66889, 26476,
+    40108, 50567, 22991, 24950, 62966, 22867, 46204, 21324, 29883, 5139, 44248, 58186, 15894, 20734, 70470, 47869,
+    37217, 20858, 62398, 53580, 47714, 15328, 16996, 21361, 53613, 42843, 56086, 65037, 65666, 57024, 5975, 50695,
+    63491, 38693, 41853, 19201, 62494, 9954, 43511, 12048, 65899, 31534, 7349, 46732, 70413, 31506, 54146, 52785,
+    15886, 8458, 18553, 7619, 69950, 10104, 59039, 55698, 12655, 49941, 58879, 7061, 2828, 43669, 17193, 54135,
+    28404, 65869, 60492, 15498, 65270, 62986, 63591, 40947, 2595, 5216, 22178, 63999, 57789, 35761, 43254, 65961,
+    12159, 37405, 59190, 26414, 19404, 11986, 14535, 32251, 48429, 10078, 29603, 59920, 69540, 60684, 42541, 70380,
+    18404, 30199, 49435, 64163, 49689, 17113, 26264, 17396, 61213, 26952, 21946, 63154, 54705, 47796, 50746, 37680,
+    28800, 53020, 24097, 25834, 20297, 39665, 11966, 15859, 22188, 43269, 1274, 36349, 68580, 62264, 65125, 52004,
+    39628, 31889, 22636, 51433, 4212, 13168, 31819, 67029, 41711, 38483, 65662, 58772, 61805, 42037, 29900, 29011,
+    31413, 50215, 7311, 16546, 6848, 17013, 12390, 5088, 53449, 9310, 5220, 23200, 52030, 9253, 43241, 15178,
+    15639, 58063, 10805, 57904, 50932, 15460, 42907, 27570, 34974, 24032, 17720, 46755, 5242, 63626, 34507, 57970,
+    3148, 39479, 16118, 57187, 31147, 12305, 54466, 62741, 54895, 53107, 60863, 67656, 66208, 13435, 13070, 539,
+    26803, 27712, 61344, 11450, 43848, 12967, 2109, 9429, 8772, 17923, 29886, 21003, 6986, 40425, 8490, 69146,
+    66660, 46820, 50277, 61154, 26454, 13565, 6803, 23159, 4701, 16743, 22552, 37864, 69667, 18518, 22531, 28194,
+    36174, 1762, 17517, 18359, 22879, 20834, 44994, 59052, 10791, 24013, 10686, 34198, 1774, 32697, 63353, 3762,
+    57207, 58692, 39551, 16301, 63996, 69659, 3933, 6773, 635, 3212, 30093, 49872, 37183, 30961, 15494, 22391,
+    26947, 49920, 48531, 14902, 7851, 5087, 33691, 62020, 37391, 39132, 56664, 58731, 14693, 18743, 2556, 6725,
+    23711, 28186, 62143, 24644, 49880, 51217, 35059, 54051, 55730, 4791, 34662, 24719, 22459, 46763, 34558, 28861,
+    24095, 7511, 65784, 47628, 4527, 24769, 29806, 28700, 40180, 42758, 16554, 47459, 66439, 22038, 34178, 16859,
+    7928, 21275, 7413, 56485, 29217, 70099, 52324, 56498, 62462, 31232, 45149, 52937, 16348, 16983, 28584, 5218,
+    46718, 54573, 54073, 36142, 33066, 45374, 64292, 58807, 29681, 45800, 392, 69975, 2938, 40652, 42151, 58061,
+    39774, 62876, 4068, 69914, 69141, 7532, 58147, 10412, 51516, 32235, 1680, 55087, 62913, 31697, 24994, 19162,
+    24745, 43489, 30603, 15768, 47777, 13662, 37201, 29439, 6877, 28797, 24336, 43979, 15635, 55342, 8393, 49163,
+    42624, 13357, 7617, 16709, 62294, 61297, 11727, 6853, 26603, 64312, 68766, 42401, 10188, 44197, 36048, 4313,
+    1204, 43461, 57555, 21254, 58854, 36242, 33261, 8966, 60878, 12334, 68822, 65322, 49569, 70303, 52692, 36617,
+    6905, 57259, 3198, 50885, 46563, 68741, 39824, 45561, 4772, 762, 9544, 30997, 23023, 28125, 25066, 25840,
+    34940, 24039, 1066, 56407, 66388, 4720, 49007, 50041, 8943, 7792, 8750, 65430, 57333, 19558, 13524, 19807,
+    61557, 21160, 57208, 62432, 51864, 14083, 22702, 8744, 62018, 4750, 39763, 48420, 49333, 19457, 37149, 18717,
+    16864, 41897, 10979, 23311, 53072, 42648, 820, 40818, 29362, 48236, 14336, 52313, 47930, 70018, 29214, 20752,
+    63709, 38867, 58767, 58599, 64343, 17087, 18206, 9765, 7233, 53004, 6944, 53181, 60860, 30781, 3523, 12667,
+    38186, 14993, 3507, 29961, 47218, 64361, 13959, 67892, 44915, 6387, 52660, 56836, 30105, 18791, 51791, 11539,
+    23871, 8588, 48196, 58522, 40864, 3925, 2677, 59847, 8504, 31981, 69104, 67844, 19181, 629, 67089, 11971,
+    43905, 13623, 32865, 46017, 30732, 13131, 53901, 47108, 30256, 3506, 37588, 2148, 21926, 70241, 10438, 54522,
+    20880, 40046, 59443, 20797, 30654, 58695, 30888, 467, 50333, 29712, 56688, 52903, 39676, 44130, 40973, 15856,
+    63086, 38675, 66635, 32698, 61985, 51895, 19569, 29918, 68973, 8262, 42233, 14881, 50228, 57408, 44102, 39533,
+    23610, 35725, 58962, 53530, 60250, 2998, 33190, 59811, 52013, 19160, 34474, 1290, 47289, 29183, 28947, 49430,
+    42302, 64225, 69407, 29835, 60630, 29862, 35544, 61447, 36486, 60988, 11969, 41678, 34730, 52345, 38437, 6475,
+    14594, 41030, 5743, 41258, 15172, 59152, 34897, 11713, 9206, 49682, 42891, 29077, 13149, 57432, 27139, 16538,
+    58014, 55847, 25445, 31805, 6477, 51258, 40019, 57993, 13876, 47771, 48027, 12142, 12412, 42752, 50622, 57575,
+    29045, 51138, 34129, 34397, 18702, 8402, 44014, 49626, 22663, 38015, 38292, 31860, 2297, 70469, 54535, 45513,
+    43188, 54007, 24382, 5713, 56126, 58646, 24654, 58178, 68158, 68243, 17946, 34642, 52257, 58876, 29964, 1604,
+    44861, 6500, 7140, 65342, 64038, 61550, 63644, 24941, 55008, 62453, 13890, 44082, 11516, 43180, 53281, 49869,
+    25764, 59931, 63158, 14687, 35492, 65133, 5873, 37366, 44553, 27287, 9595, 19041, 66968, 18803, 518, 31319,
+    27312, 50218, 41012, 50194, 45973, 23279, 58369, 57346, 44223, 39550, 40010, 62723, 52155, 47420, 34538, 66806,
+    4953, 58892, 48225, 52596, 49762, 21464, 62051, 1370, 49974, 62218, 668, 59149, 42817, 44660, 19635, 70231,
+    21891, 18194, 49038, 57772, 45739, 55617, 5511, 43857, 57472, 5697, 8452, 64548, 16774, 36646, 61993, 17842,
+    38632, 6990, 57249, 35957, 61696, 66389, 53098, 37586, 55391, 68083, 63855, 38694, 36935, 17731, 63918, 9797,
+    12905, 66835, 58494, 7530, 43058, 9330, 65093, 4872, 30226, 19766, 33147, 27008, 3963, 20899, 31503, 56923,
+    22108, 38440, 58382, 64236, 32679, 64492, 25773, 49068, 61747, 13312, 2095, 59100, 18829, 67005, 65684, 63345,
+    16810, 30845, 22682, 52555, 3490, 48248, 18079, 61178, 18412, 63631, 58610, 35537, 13212, 50861, 10255, 66228,
+    23216, 67976, 45437, 34113, 9512, 50403, 12906, 59732, 24262, 53172, 30470, 53247, 61467, 60440, 64881, 21203,
+    5330, 32611, 46430, 44276, 35892, 8890, 52402, 16779, 13415, 30670, 46627, 19845, 28656, 66671, 49086, 47781,
+    42184, 9580, 10225, 12683, 64942, 57687, 32377, 2001, 57807, 60598, 4186, 3243, 66715, 65315, 24204, 68894,
+    55066, 32257, 38707, 15240, 6184, 8419, 56339, 66651, 35180, 55178, 32919, 24251, 61392, 13828, 41925, 58765,
+    5114, 31219, 57886, 64011, 11198, 12644, 22549, 7689, 40117, 60357, 60529, 11608, 28358, 28063, 23402, 3495,
+    69053, 59729, 14940, 57226, 67589, 33271, 6230, 6870, 52594, 67599, 60488, 25274, 19076, 24723, 3096, 50068,
+    28156, 61480, 34762, 62967, 22315, 12559, 42996, 53701, 60397, 56758, 43193, 41183, 6791, 53370, 16440, 42349,
+    37124, 31341, 63972, 66954, 60276, 59764, 11988, 64407, 3720, 16965, 63099, 29602, 59742, 21405, 63776, 65376,
+    29793, 48528, 30764, 34276, 4956, 6921, 42538, 26870, 8479, 60461, 17710, 36197, 14772, 64003, 51091, 12143,
+    52752, 42453, 31039, 12854, 52337, 50733, 31331, 6593, 14602, 12591, 54659, 8084, 51392, 32848, 64422, 15230,
+    48676, 6203, 45451, 28248, 41029, 55998, 29929, 57276, 42768, 70314, 39420, 33856, 20878, 2220, 20942, 51250,
+    16423, 23243, 25265, 8511, 1343, 45015, 67731, 32124, 9527, 50118, 27186, 63223, 34105, 22141, 6210, 49809,
+    49064, 24245, 49318, 24728, 26531, 52370, 31268, 47886, 26542, 34237, 66849, 6349, 64251, 28375, 58716, 28547,
+    38418, 25175, 50347, 42523, 69643, 36231, 45977, 43318, 32795, 6959, 50679, 16307, 8913, 14636, 64577, 18855,
+    37190, 14169, 44799, 15561, 17377, 39710, 25087, 16197, 9969, 12742, 58574, 44705, 6121, 55424, 33447, 58453,
+    59413, 42339, 30668, 31862, 31798, 13457, 65324, 29061, 21804, 16702, 19373, 45347, 21226, 30390, 46781, 17664,
+    58954, 42887, 32568, 54326, 35676, 51194, 45825, 24317, 4462, 2911, 43171, 24288, 45130, 11269, 8575, 16886,
+    41073, 35994, 22258, 45734, 1730, 27982, 46672, 40078, 27166, 8018, 47982, 56714, 66558, 27995, 18908, 29265,
+    19051, 26203, 1552, 16849, 48330, 16867, 15878, 59342, 67364, 48846, 4977, 25266, 57661, 39381, 35037, 329,
+    48150, 10630, 37252, 67887, 18714, 57006, 59646, 46572, 49224, 23948, 302, 21995, 33804, 22286, 68723, 53912,
+    33420, 6931, 43220, 53726, 29340, 54193, 61034, 25910, 69113, 12403, 8189, 8308, 147, 1003, 46731, 44067,
+    43618, 45195, 66328, 49413, 14278, 46267, 56881, 5923, 15473, 47261, 32117, 25484, 35922, 9114, 24203, 8764,
+    16430, 57116, 64062, 53779, 1000, 49830, 23617, 70094, 53999, 36518, 33351, 34988, 46554, 47590, 63945, 38864,
+    70189, 48778, 54677, 455, 57278, 52076, 70070, 54254, 37732, 59012, 43225, 58208, 23363, 39434, 48198, 26016,
+    25284, 39789, 42284, 10021, 68760, 22859, 39696, 62073, 24543, 42961, 41083, 47808, 17692, 63577, 3426, 67253,
+    39357, 32767, 44453, 13146, 1612, 14699, 26502, 36379, 17686, 61236, 40340, 34739, 19033, 7852, 857, 8089,
+    23693, 42363, 43983, 56377, 25488, 25673, 20674, 63607, 45016, 25203, 26535, 6318, 35651, 26292, 21179, 417,
+    56149, 36640, 8752, 43239, 4405, 36667, 4613, 25665, 8167, 34625, 53665, 26867, 47936, 23335, 3097, 44346,
+    62172, 258, 54141, 6590, 33106, 44775, 47538, 35772, 58806, 401, 25868, 60772, 48249, 68829, 34037, 56799,
+    61682, 53192, 69879, 22330, 58219, 18219, 58717, 37935, 53766, 16316, 15659, 54992, 12393, 35511, 36774, 49415,
+    2004, 23233, 3648, 48769, 68778, 15093, 29563, 63915, 43442, 57338, 33269, 24075, 65429, 66320, 36130, 52902,
+    20602, 29841, 29692, 5726, 35736, 50149, 29194, 17609, 43831, 37290, 24725, 30624, 33758, 11820, 30104, 65960,
+    60930, 60908, 37184, 65314, 68383, 29342, 46252, 15148, 11365, 24493, 13296, 16372, 26382, 2901, 13080, 26919,
+    44940, 10670, 70130, 25824, 5660, 38049, 14729, 20985, 5190, 68790, 63399, 12030, 53089, 41293, 61927, 23999,
+    44456, 66484, 51370, 46872, 44140, 35494, 59614, 12228, 53654, 26153, 41900, 70534, 56811, 59390, 38971, 58615,
+    3389, 20112, 27123, 46138, 22042, 25307, 53356, 7773, 11180, 59826, 42445, 5565, 21357, 1354, 57460, 20767,
+    63777, 8364, 33502, 21334, 22788, 44835, 17269, 64951, 27817, 37993, 9576, 45902, 24154, 55521, 40039, 17214,
+    48033, 37756, 52201, 30174, 69257, 24834, 56900, 13424, 54829, 10594, 37533, 28831, 54509, 56808, 19073, 40649,
+    37800, 26235, 50654, 19678, 12959, 18545, 22887, 17076, 6389, 59061, 573, 69949, 19874, 1565, 62558, 57101,
+    13349, 51069, 29876, 57931, 22885, 24500, 5803, 55446, 1339, 49083, 21147, 55031, 29853, 67484, 66606, 46154,
+    29381, 29363, 25271, 2120, 31479, 41744, 36931, 12722, 47904, 29561, 68843, 19445, 46379, 63856, 8226, 3438,
+    36334, 7526, 4734, 60509, 61936, 59239, 64674, 22365, 26777, 14479, 7419, 20226, 16750, 18297, 2, 26025,
+    43339, 45317, 62307, 7929, 63849, 17600, 33684, 9807, 22085, 49249, 65193, 60687, 67603, 452, 5446, 32138,
+    69416, 55074, 60914, 22643, 11074, 45237, 52675, 27494, 58278, 7956, 52258, 59189, 69623, 33291, 44477, 8358,
+    3385, 24161, 51558, 29805, 9905, 4884, 50964, 17524, 63135, 68031, 62187, 23600, 7970, 46697, 67069, 13967,
+    13113, 4161, 55433, 8467, 21297, 41405, 22732, 13516, 67022, 13983, 61784, 27336, 16046, 45453, 15681, 10858,
+    65634, 33418, 53545, 32813, 65699, 24102, 63537, 3298, 63311, 4002, 25093, 58383, 54618, 50324, 49883, 46070,
+    28744, 69836, 62407, 54736, 15073, 28717, 60093, 54889, 61801, 64478, 4293, 13751, 41048, 66251, 41634, 14983,
+    11661, 47723, 20622, 50232, 14514, 28369, 31033, 37815, 57505, 2598, 29075, 34627, 8085, 34183, 65521, 46237,
+    9238, 10912, 54218, 40289, 60933, 42848, 29731, 61029, 61110, 32115, 39255, 37153, 6392, 70143, 51836, 27341,
+    20691, 62117, 40823, 50934, 11373, 15935, 25119, 1990, 31271, 58429, 12455, 63876, 41226, 62817, 33409, 40021,
+    70120, 64028, 18012, 39138, 67568, 9480, 24413, 23759, 45169, 67683, 59094, 53661, 12003, 14173, 44006, 58708,
+    27352, 23632, 12852, 11947, 17254, 61970, 35506, 37306, 3886, 33734, 14920, 54778, 64767, 12527, 48666, 15392,
+    10994, 10713, 52584, 27329, 17868, 30455, 40974, 18966, 45829, 10392, 66011, 38156, 29888, 9684, 30674, 52861,
+    47681, 70401, 69288, 1206, 7747, 69531, 13224, 62958, 14, 17363, 46538, 69170, 167, 64936, 45892, 6960,
+    32342, 47893, 28860, 41442, 14719, 11007, 33660, 25132, 41348, 54701, 19255, 11506, 5, 67768, 48562, 67690,
+    52357, 66745, 55046, 48000, 4081, 33888, 63756, 23377, 5342, 66045, 8563, 28283, 48617, 53074, 35650, 16793,
+    54479, 8692, 40099, 46961, 59429, 69764, 48372, 17000, 45147, 69601, 58552, 57973, 38581, 1815, 36214, 38714,
+    12470, 42289, 16987, 29559, 59207, 63246, 14838, 58202, 25469, 22556, 57829, 12846, 42634, 9699, 36064, 22896,
+    40565, 20163, 2877, 10913, 22387, 5837, 64471, 35667, 19640, 21227, 28902, 60945, 68091, 8027, 60602, 21094,
+    37379, 43478, 27918, 34035, 39313, 41500, 64413, 55878, 38887, 51097, 52892, 17947, 55728, 19833, 43776, 5084,
+    33309, 20757, 35074, 52250, 7982, 66036, 26661, 24332, 4948, 33431, 20377, 8323, 55934, 62780, 61759, 52017,
+    1078, 47806, 57213, 21929, 55206, 12764, 19002, 44821, 62238, 54525, 57000, 64031, 18361, 68859, 8438, 49279,
+    4855, 59592, 6391, 21114, 32461, 64931, 58175, 1440, 33049, 33321, 54166, 12958, 9190, 36763, 51958, 67745,
+    9138, 39583, 213, 27147, 14304, 16309, 33545, 65335, 27615, 28142, 52319, 62164, 38326, 27957, 28241, 35123,
+    54835, 10601, 13256, 12055, 52651, 46419, 18921, 25091, 22541, 29357, 22115, 66103, 5234, 39810, 59369, 17903,
+    5048, 55797, 3906, 44723, 59156, 8620, 59182, 21220, 47979, 18848, 20970, 14915, 53976, 44902, 20105, 52772,
+    64702, 46253, 41501, 33973, 30850, 24868, 63891, 31563, 36312, 8152, 1163, 15579, 15876, 50505, 3398, 10254,
+    59129, 1873, 43361, 43790, 63272, 25669, 36628, 52199, 11876, 22544, 10265, 58034, 46149, 5916, 51660, 3524,
+    57615, 47617, 38468, 43407, 58111, 36773, 9655, 31334, 27591, 13528, 58411, 3972, 67447, 36541, 59201, 46864,
+    65065, 17082, 19925, 3517, 28660, 21355, 47758, 62028, 55160, 3467, 37814, 24206, 15645, 57063, 69833, 8715,
+    47575, 8267, 14339, 2007, 70319, 48709, 69830, 67108, 36341, 25481, 13059, 57521, 16941, 45095, 3268, 43624,
+    19565, 52793, 22268, 52497, 49913, 21850, 34187, 13491, 70494, 27006, 69877, 53705, 43322, 56554, 42122, 66059,
+    51020, 26218, 39760, 66555, 58086, 69280, 30676, 53926, 56012, 8425, 2079, 56358, 50894, 23789, 3360, 28516,
+    63954, 22705, 1142, 18159, 4697, 3259, 61733, 57623, 23682, 45957, 70156, 56325, 57678, 7849, 28129, 19593,
+    55778, 8968, 30179, 65080, 45311, 4322, 70514, 27990, 55600, 58058, 371, 47073, 41148, 52140, 53351, 54931,
+    64358, 47933, 8496, 68880, 21618, 29735, 58670, 46558, 1921, 52361, 26619, 69898, 69896, 57412, 5121, 7013,
+    53143, 19127, 2689, 21973, 41627, 43640, 66274, 38055, 66069, 30862, 3429, 1947, 26939, 46245, 4144, 38272,
+    11890, 43546, 47921, 52895, 14144, 29391, 18780, 34487, 23466, 30612, 24247, 55169, 38097, 28402, 37759, 23049,
+    51514, 13571, 38146, 64455, 62537, 16708, 50508, 15058, 46866, 10957, 1184, 13593, 37360, 66486, 47045, 55292,
+    51959, 9819, 55490, 66417, 28809, 59501, 36593, 3659, 34316, 54014, 64380, 57717, 63566, 40554, 51298, 29525,
+    19811, 15777, 30208, 29972, 33441, 49587, 64719, 59261, 17619, 10198, 43849, 43321, 5107, 40782, 52526, 58632,
+    28464, 13401, 4518, 23920, 25513, 61136, 30809, 9211, 35424, 61857, 31832, 17215, 508, 26205, 46384, 53747,
+    1733, 6891, 39279, 28592, 28428, 17168, 51449, 51336, 16035, 31836, 10346, 43402, 28938, 34243, 39884, 59170,
+    9796, 38016, 28324, 43809, 58747, 46066, 65703, 11465, 14975, 15119, 68543, 6286, 39934, 29339, 20068, 29625,
+    7763, 1946, 22921, 38582, 39986, 20900, 28908, 42006, 7841, 44362, 22892, 18889, 48145, 40134, 19772, 39654,
+    2092, 41580, 37487, 45077, 39601, 44298, 13239, 51030, 40350, 14673, 23299, 13650, 57087, 2869, 17499, 46962,
+    16745, 48439, 7176, 18393, 36487, 43548, 38208, 4795, 20194, 53690, 42830, 66019, 577, 1503, 64534, 56966,
+    10875, 52764, 62511, 68591, 35503, 2225, 70320, 64692, 23384, 9248, 26307, 22696, 22109, 29140, 33472, 43070,
+    35623, 21853, 42571, 24224, 5910, 59608, 7670, 61962, 10458, 18783, 45751, 11193, 47475, 20831, 47190, 62479,
+    15644, 16564, 11282, 52904, 56127, 39594, 58441, 59400, 26593, 69504, 37070, 40086, 49605, 18703, 18704, 4954,
+    7185, 44155, 67449, 51565, 56569, 8915, 15782, 41867, 34639, 25134, 7647, 66877, 25065, 433, 9164, 17774,
+    41162, 57360, 18077, 45749, 19504, 19435, 27690, 42963, 46266, 46005, 2112, 17226, 32009, 64735, 21828, 22311,
+    65077, 24615, 6308, 2626, 45318, 34522, 15662, 70111, 10060, 56539, 7426, 17990, 35343, 4921, 12837, 46927,
+    32939, 68886, 61720, 49537, 31565, 24138, 13561, 33186, 56713, 54020, 44755, 5612, 43259, 44179, 67722, 46873,
+    44046, 20547, 69335, 5349, 61792, 31845, 32834, 6906, 57310, 12868, 68466, 170, 8134, 12972, 28752, 57304,
+    66052, 3700, 35265, 56104, 46895, 8368, 33430, 70349, 8954, 59999, 44376, 9104, 33029, 51355, 10857, 67988,
+    21373, 42147, 17405, 23727, 13095, 16171, 51082, 53339, 9710, 48121, 29099, 2838, 17704, 52229, 14006, 31717,
+    11472, 19123, 21948, 67002, 3064, 37398, 53710, 12123, 50571, 58630, 24211, 627, 61588, 20590, 68481, 41387,
+    28597, 51265, 29639, 55313, 29971, 22635, 68635, 18164, 65886, 37701, 68578, 43612, 56063, 57362, 55175, 50070,
+    35546, 13097, 7702, 32361, 70217, 15704, 32036, 7206, 23298, 11623, 8220, 18056, 37281, 31452, 30943, 37775,
+    42194, 40025, 57212, 23368, 46952, 36310, 22769, 39171, 9109, 41908, 38198, 50973, 39116, 44278, 17443, 43761,
+    66868, 25739, 60106, 60504, 48668, 827, 61247, 58863, 8376, 24659, 59048, 50556, 8756, 52705, 61477, 6841,
+    51821, 24293, 32352, 18148, 21943, 62138, 28874, 42975, 49321, 56903, 65118, 55319, 30726, 37317, 59971, 9943,
+    61069, 55941, 16836, 41409, 43144, 68046, 24040, 12169, 23763, 65788, 68948, 45714, 38317, 23218, 37052, 36634,
+    50146, 5086, 27607, 25647, 49543, 3947, 53103, 19212, 7217, 61250, 2548, 52102, 49215, 52019, 64369, 67828,
+    3442, 27288, 1379, 19591, 17130, 56782, 58818, 70259, 62674, 52366, 28533, 12721, 56459, 39562, 49892, 53343,
+    26069, 6976, 37407, 68409, 64265, 57595, 13920, 22806, 56882, 44505, 52591, 60006, 37442, 19837, 20585, 10362,
+    26223, 45412, 10459, 2801, 3171, 35758, 48570, 22810, 57677, 65076, 22622, 37275, 66857, 90, 60998, 17151,
+    42687, 1391, 38716, 41053, 39288, 13038, 46628, 19110, 13789, 26052, 56011, 18914, 34821, 13103, 28711, 21252,
+    67766, 35372, 12509, 35670, 9170, 33103, 66645, 53367, 53503, 23290, 64194, 10075, 34980, 32663, 53924, 54551,
+    41205, 36396, 8863, 21415, 19025, 23803, 1878, 22620, 32315, 46256, 16253, 30522, 44625, 64914, 39335, 24001,
+    23758, 50128, 24324, 15903, 1060, 11761, 5553, 28299, 63249, 19733, 46874, 56999, 7597, 28873, 11395, 54717,
+    28445, 2742, 27653, 64170, 6874, 62815, 51636, 26679, 58240, 16934, 1846, 9053, 55045, 13549, 55535, 13441,
+    45043, 30092, 61093, 51749, 41862, 29249, 8908, 6162, 15546, 5506, 6951, 17646, 33357, 61287, 42370, 6622,
+    1989, 37479, 43743, 38333, 56938, 32420, 57705, 69254, 53854, 8185, 34111, 906, 42312, 28079, 8531, 54955,
+    64047, 37239, 47465, 42966, 7582, 44296, 29006, 52458, 15065, 24922, 46966, 70409, 6231, 7863, 59885, 7756,
+    8590, 15155, 13084, 55434, 40384, 40643, 18520, 19816, 2101, 28060, 46190, 35086, 14987, 56342, 9874, 39401,
+    7981, 22746, 50305, 19455, 8870, 35205, 5003, 22651, 18540, 37097, 36371, 16722, 30107, 24254, 18460, 66574,
+    20099, 68475, 34689, 31826, 63666, 61510, 61454, 1488, 66971, 38354, 41556, 2170, 10826, 6522, 41311, 546,
+    43597, 4909, 1271, 48460, 66393, 1296, 4738, 5241, 7361, 11694, 34288, 51360, 7979, 35331, 10519, 2749,
+    19382, 31549, 3873, 16519, 51235, 26662, 24318, 58493, 32168, 63006, 29028, 22457, 44057, 28992, 54357, 6242,
+    11802, 16623, 62114, 19124, 27066, 39933, 51098, 63165, 43340, 48543, 40563, 42053, 48825, 20526, 63834, 57323,
+    15693, 16960, 38976, 47710, 29797, 68287, 19442, 57991, 57098, 48404, 40704, 63455, 60160, 36144, 9456, 10806,
+    9029, 36538, 49212, 49034, 4151, 6527, 24749, 29967, 11080, 4188, 22664, 51815, 67292, 52553, 59117, 57042,
+    45102, 37999, 12975, 2390, 54707, 61607, 56191, 16909, 4192, 9557, 11011, 8810, 9267, 2808, 23158, 36799,
+    62941, 20048, 41241, 66172, 53414, 3536, 44425, 11316, 13255, 66598, 65028, 59672, 16433, 16788, 12836, 68102,
+    27002, 19913, 28934, 42145, 41063, 4779, 45903, 39566, 14196, 58826, 22895, 65495, 31720, 66540, 27498, 53010,
+    38938, 4301, 7130, 63130, 24656, 69052, 11401, 59351, 26992, 16426, 13163, 14098, 27501, 24897, 11209, 26532,
+    15089, 65609, 25866, 12996, 64560, 29093, 54761, 12245, 34629, 197, 59909, 4093, 30788, 44421, 40957, 66604,
+    15747, 20990, 50227, 4548, 36459, 63079, 52985, 27621, 10472, 29023, 14820, 59842, 19150, 68663, 13088, 30234,
+    32428, 22332, 38043, 43873, 35438, 15687, 35398, 8698, 56221, 31464, 39274, 58753, 70485, 30178, 41114, 4844,
+    66128, 30188, 14901, 1985, 2078, 8541, 22012, 24773, 25461, 35190, 49322, 10409, 43045, 1033, 4600, 4415,
+    31275, 54131, 11624, 11259, 36156, 14060, 42680, 18503, 17282, 17771, 34806, 55822, 18516, 4360, 34122, 26912,
+    52652, 36564, 38203, 20514, 48336, 16465, 41212, 18612, 51485, 21813, 12487, 62455, 68498, 61170, 50090, 32937,
+    58017, 37868, 52804, 22198, 6259, 42857, 3851, 10201, 26475, 65395, 36103, 38514, 64787, 58535, 65083, 13504,
+    21559, 12239, 4783, 37926, 19038, 40911, 17924, 5254, 48295, 52771, 35245, 60625, 25226, 33096, 33833, 47147,
+    16565, 35115, 13264, 61500, 21317, 39455, 31190, 11361, 4999, 18813, 12359, 1961, 48151, 37057, 20641, 56039,
+    904, 50705, 60281, 1614, 39047, 36125, 51616, 32672, 24811, 62868, 14284, 66869, 64001, 56680, 57262, 45646,
+    52851, 42337, 33989, 69411, 53253, 65754, 23109, 14063, 58822, 42245, 47232, 35085, 70377, 14306, 9956, 25588,
+    43643, 35294, 42833, 69160, 23494, 69295, 17338, 59714, 33623, 26078, 15995, 4426, 42165, 14610, 69715, 7669,
+    22912, 51756, 962, 67188, 34248, 54472, 54682, 69067, 5042, 30531, 40155, 40426, 19430, 24371, 41575, 49478,
+    48594, 34209, 69065, 4019, 3995, 63404, 5288, 46813, 70107, 66609, 4982, 50487, 62939, 54807, 53626, 17043,
+    63958, 50819, 39587, 33134, 37230, 53904, 10729, 61722, 27402, 3890, 40432, 69016, 50239, 33375, 43847, 45516,
+    53949, 60705, 48687, 39917, 2832, 5687, 23220, 22882, 24060, 36505, 14621, 37237, 54734, 17853, 347, 46393,
+    9518, 32388, 29813, 6267, 13489, 11721, 29508, 6002, 35472, 68033, 13710, 30284, 34150, 30901, 40698, 26056,
+    56530, 45205, 44031, 61180, 55022, 26712, 33247, 32619, 23773, 58926, 5208, 7664, 12737, 64488, 64096, 66804,
+    63751, 29513, 12823, 37878, 64605, 36933, 16502, 59403, 18599, 8324, 644, 150, 69834, 40000, 16258, 21831,
+    24191, 49387, 68728, 23449, 49900, 37003, 28645, 64977, 67712, 60984, 50546, 30351, 43971, 47819, 4659, 27600,
+    50275, 60710, 49652, 66782, 4082, 28750, 18899, 27756, 4062, 63982, 362, 67924, 22747, 15754, 43970, 878,
+    34202, 67536, 53441, 23043, 19082, 29680, 45125, 12052, 51608, 65140, 59532, 46767, 12145, 67564, 1373, 12987,
+    33323, 38796, 52301, 6720, 47091, 63481, 67257, 24589, 59439, 26279, 65447, 22183, 25621, 20934, 32116, 59338,
+    52805, 49897, 62662, 33024, 67208, 70503, 52511, 46582, 41263, 55861, 26017, 16663, 1442, 53578, 48241, 69418,
+    67246, 63377, 13676, 25542, 4269, 17725, 57515, 58583, 2787, 30978, 46406, 36540, 19922, 62694, 50657, 23373,
+    25523, 29520, 17703, 7045, 68114, 912, 26750, 12607, 65183, 25448, 1410, 1326, 31670, 17540, 41453, 30535,
+    61096, 41951, 63620, 60659, 35699, 33355, 37806, 25584, 27689, 13523, 58578, 63814, 17397, 19618, 54148, 5224,
+    15484, 6767, 32114, 59092, 59609, 38528, 34265, 53720, 4371, 55037, 22877, 34711, 27679, 20223, 26483, 28714,
+    31774, 14225, 47875, 43861, 38895, 62490, 37593, 5542, 20790, 45703, 20540, 56930, 18081, 67435, 56731, 13644,
+    32668, 17029, 15702, 33504, 37028, 3067, 25630, 32457, 47798, 41151, 3420, 199, 65371, 34163, 41806, 41588,
+    69954, 1530, 62833, 25046, 57936, 65074, 25656, 35412, 44829, 42131, 38945, 55957, 56689, 20327, 9525, 40023,
+    5710, 19003, 12522, 61684, 69275, 35841, 4631, 45982, 48340, 56829, 23281, 65195, 35797, 62855, 57816, 66472,
+    25422, 38770, 54714, 18427, 51172, 52079, 47868, 32455, 18671, 1813, 29507, 44180, 33035, 52561, 24581, 32738,
+    7204, 19710, 19485, 21431, 13493, 8009, 37684, 43458, 15541, 58669, 60675, 35850, 40742, 27344, 45139, 55806,
+    33073, 20953, 28292, 54850, 46915, 26336, 23317, 59825, 27234, 7184, 41689, 317, 12898, 47501, 67244, 47437,
+    1476, 17315, 61996, 56116, 10730, 28168, 346, 20086, 5953, 36767, 25328, 57, 41773, 42104, 54728, 32910,
+    60877, 11805, 22472, 60325, 8703, 68909, 1414, 7884, 9630, 16870, 53135, 53288, 60556, 20045, 27627, 4856,
+    31573, 22983, 54451, 67242, 25188, 30161, 1377, 56049, 34117, 8078, 44370, 62668, 15937, 63686, 61036, 16442,
+    1307, 13109, 46790, 20763, 45433, 70109, 41302, 3606, 60493, 10219, 65302, 56840, 9271, 30810, 8700, 14638,
+    36680, 1697, 28870, 61313, 26293, 54820, 41027, 4823, 42372, 27404, 2432, 30031, 29782, 11071, 66236, 10394,
+    9598, 68441, 39724, 64998, 16740, 68232, 42062, 42272, 21291, 68581, 15705, 34386, 17012, 7588, 15751, 48857,
+    59153, 17483, 68772, 51877, 1917, 42343, 10611, 45993, 39475, 47691, 41345, 30438, 16865, 64644, 59965, 33862,
+    41965, 44533, 57109, 62592, 38459, 3146, 35369, 39107, 30252, 39374, 34916, 563, 19232, 64482, 61561, 57882,
+    5963, 21083, 52588, 8919, 49862, 56098, 935, 2296, 43973, 30441, 7559, 12991, 60613, 53892, 60728, 37789,
+    15072, 4244, 33910, 246, 66684, 57020, 3666, 15290, 33897, 48180, 64682, 60560, 68774, 70510, 9886, 33732,
+    66348, 43763, 1498, 8179, 18377, 3638, 47300, 69856, 54069, 3091, 39439, 2847, 8007, 2180, 17133, 32497,
+    14990, 48223, 60352, 31348, 34158, 26902, 27987, 30661, 40236, 30538, 46473, 57559, 7705, 43723, 28181, 43009,
+    39216, 7640, 51314, 61564, 40237, 26913, 17432, 32646, 1426, 53533, 45001, 29581, 46596, 31301, 33993, 45354,
+    9749, 17458, 7081, 52245, 3207, 7213, 20574, 33493, 52817, 69322, 17898, 25324, 64435, 28093, 10873, 16932,
+    64483, 4388, 41670, 26547, 58651, 10287, 58757, 12409, 28033, 6994, 55914, 8814, 8144, 8234, 6663, 43102,
+    5771, 2133, 20762, 37219, 4925, 49026, 2510, 20351, 60927, 23464, 49186, 41698, 68235, 934, 11960, 41612,
+    27601, 39121, 38774, 46002, 26695, 14559, 56491, 69193, 12342, 26231, 66056, 18727, 67608, 8093, 3056, 42628,
+    14472, 55812, 1024, 20318, 20804, 35569, 37979, 32471, 3539, 44459, 57361, 39118, 35217, 6895, 43995, 64843,
+    50757, 48296, 58451, 32397, 11768, 42675, 3486, 51650, 1954, 11143, 42259, 63497, 56323, 36670, 23270, 10524,
+    50690, 10603, 54075, 38617, 45686, 51424, 56313, 27485, 61053, 1974, 38622, 49914, 7412, 3035, 60263, 15052,
+    9431, 44261, 23405, 43091, 52790, 14600, 69217, 60822, 11009, 12776, 13393, 24578, 52929, 7296, 58786, 32480,
+    54733, 29605, 10385, 21552, 29149, 31762, 62839, 65954, 50959, 20145, 23766, 1150, 1242, 56925, 1069, 28671,
+    26182, 44043, 24700, 39554, 48656, 65895, 5576, 55129, 10616, 31181, 6554, 24847, 17723, 61919, 12213, 66993,
+    24682, 48410, 45652, 49657, 47414, 5122, 67754, 49911, 39681, 6950, 62282, 62610, 41555, 36781, 21471, 47254,
+    37636, 4260, 48958, 18987, 36412, 27893, 59877, 23653, 12872, 63772, 61583, 1425, 52608, 67169, 31321, 45300,
+    10557, 31051, 3756, 70209, 68420, 39258, 43845, 58696, 27751, 40702, 25440, 25546, 3289, 32496, 69149, 19148,
+    41428, 25833, 15455, 24819, 13824, 27168, 29072, 66778, 11037, 44899, 58019, 43703, 36092, 50583, 61665, 58873,
+    33246, 26164, 1500, 30706, 24410, 67636, 64822, 19952, 24226, 25831, 10029, 2815, 8777, 826, 55564, 16248,
+    39574, 16803, 39914, 18632, 53569, 33028, 19719, 40723, 40520, 27113, 1001, 67694, 56208, 13535, 32778, 28620,
+    44600, 62523, 54772, 49798, 5933, 42970, 55859, 16191, 45838, 10637, 49380, 38495, 41613, 22104, 51930, 51373,
+    47448, 28758, 19398, 57710, 51773, 26495, 64510, 2131, 27405, 62557, 69195, 69209, 3559, 27685, 12740, 46520,
+    57861, 45506, 32751, 27399, 48648, 20499, 66457, 64110, 22065, 10072, 6560, 50688, 59639, 27025, 63948, 64956,
+    30608, 8929, 18594, 9147, 66009, 32276, 66485, 57585, 32401, 24552, 52942, 48662, 9986, 62654, 20352, 61540,
+    10900, 67210, 54666, 48006, 23621, 14558, 65071, 42389, 29128, 19081, 57136, 27666, 45939, 39157, 49919, 49287,
+    29631, 11913, 68149, 37518, 30593, 28712, 13481, 56308, 33031, 26884, 48245, 68145, 18951, 68639, 39582, 855,
+    41923, 56396, 62107, 39490, 36402, 50282, 42376, 43295, 12406, 44259, 28754, 25000, 11902, 63278, 57494, 5878,
+    19182, 63401, 57594, 6457, 13843, 31245, 43652, 24456, 19778, 29925, 11845, 4985, 17003, 20933, 58905, 6595,
+    43702, 46062, 62845, 46119, 31857, 31345, 14798, 46242, 45667, 10726, 31315, 11051, 68530, 64874, 21539, 50460,
+    70434, 54863, 29281, 8533, 65104, 58908, 60559, 42653, 3063, 43168, 15301, 66431, 64299, 64745, 27507, 15665,
+    32949, 23149, 1676, 60748, 67559, 30953, 29593, 20273, 12883, 62968, 29619, 38479, 39772, 13829, 42782, 60326,
+    19721, 13674, 47089, 39273, 18113, 63774, 28311, 43626, 183, 50896, 67051, 62411, 20911, 28058, 43741, 70301,
+    58272, 45426, 27859, 22551, 65289, 7457, 10692, 41962, 2348, 63832, 63602, 30981, 68794, 19257, 10398, 10825,
+    63599, 68620, 55720, 33307, 58354, 13808, 46542, 19848, 21049, 37609, 47840, 26349, 52166, 25585, 26918, 53445,
+    49111, 50649, 60228, 16125, 30776, 52265, 29462, 28123, 68715, 5112, 31984, 19014, 27421, 33580, 23360, 69792,
+    1819, 23562, 42900, 779, 37955, 45273, 48366, 53758, 5361, 4853, 7637, 26234, 49511, 12045, 42534, 53818,
+    70384, 69384, 29068, 40084, 27469, 60855, 28795, 66872, 64901, 15522, 38662, 18802, 22778, 25181, 48071, 9261,
+    44475, 63479, 40258, 61203, 34266, 8815, 44322, 56228, 68640, 34489, 9086, 67411, 46634, 69433, 15276, 11739,
+    64141, 343, 43700, 67800, 10033, 20438, 37888, 66419, 24042, 46118, 13363, 15057, 36602, 37151, 54159, 17066,
+    44460, 69817, 23486, 51163, 16605, 15569, 59918, 41181, 18956, 768, 65036, 10173, 32940, 69789, 2780, 69291,
+    17136, 582, 13508, 44591, 41427, 32057, 18001, 14375, 2930, 56821, 37324, 65991, 35551, 64401, 64819, 594,
+    9095, 50825, 13657, 36209, 38393, 45569, 50653, 43420, 11996, 56365, 40316, 57942, 39248, 65622, 13480, 17977,
+    8762, 43393, 60763, 63845, 28732, 24926, 56749, 52959, 6296, 20158, 16195, 53781, 68941, 59507, 2638, 69872,
+    61226, 48704, 50646, 5268, 69476, 47757, 45994, 50473, 5794, 2641, 55123, 27834, 32532, 45117, 27398, 9656,
+    69770, 45193, 15004, 49547, 33985, 2435, 28183, 43487, 52332, 65442, 63011, 17384, 13700, 47081, 1972, 22326,
+    47586, 23822, 62476, 32889, 6521, 62754, 50579, 43620, 7076, 55200, 48823, 49123, 47576, 49627, 43910, 35157,
+    63244, 62267, 27236, 66821, 7072, 60292, 60754, 10268, 9364, 19656, 33588, 43718, 53630, 4633, 54788, 68465,
+    52999, 764, 32179, 25595, 40620, 52414, 62999, 11786, 20488, 7224, 11747, 17402, 11492, 60177, 13100, 38083,
+    410, 29438, 48212, 35533, 37375, 1113, 47951, 26611, 612, 68651, 48573, 70334, 45851, 50514, 49931, 16370,
+    2614, 57565, 29626, 25878, 37650, 54754, 39659, 52249, 32709, 51585, 55719, 39181, 32959, 2211, 4717, 21608,
+    44208, 4035, 51724, 57763, 61212, 63308, 9199, 52741, 44733, 43441, 15578, 21406, 53678, 9885, 56211, 1719,
+    66127, 58043, 62475, 33866, 70287, 58935, 39501, 70357, 29385, 10699, 56425, 67263, 67998, 60032, 1609, 51704,
+    21801, 50507, 24558, 9308, 25064, 21819, 5733, 34587, 40049, 62850, 44761, 62276, 44943, 63201, 47341, 17079,
+    33458, 39084, 56823, 12279, 28465, 37195, 50643, 41737, 34110, 68172, 9478, 38668, 36860, 1978, 13894, 63702,
+    9645, 33303, 28635, 49298, 50852, 38925, 40091, 49866, 70519, 37406, 23002, 5931, 54548, 64437, 45157, 5132,
+    60439, 443, 41045, 49509, 53814, 47003, 26641, 25970, 20023, 28591, 59952, 70521, 1361, 42607, 49198, 15531,
+    30543, 12518, 5116, 60900, 18083, 57535, 67581, 34832, 13477, 65863, 36137, 12353, 50088, 65089, 64105, 48844,
+    15942, 6112, 9546, 51198, 24508, 15565, 13604, 53440, 67021, 56144, 48208, 496, 34862, 48545, 25388, 46125,
+    31336, 61698, 53831, 28341, 54268, 59935, 54715, 11206, 46940, 17612, 12217, 37216, 1234, 26095, 11240, 25256,
+    19583, 31900, 51281, 67511, 21933, 9532, 69417, 11850, 51670, 68343, 56576, 40113, 48102, 57834, 6218, 960,
+    34616, 39713, 40088, 4409, 34190, 27343, 11391, 3644, 22128, 70236, 49528, 14626, 57023, 49102, 53207, 1342,
+    57311, 25734, 45724, 58091, 43486, 10888, 55136, 69826, 30020, 69536, 44785, 49222, 9780, 27138, 2941, 38169,
+    63195, 69218, 21384, 54328, 12445, 46326, 27897, 31324, 10156, 18317, 9754, 8816, 18688, 40446, 52585, 8747,
+    54607, 67494, 63170, 26188, 27340, 15235, 42206, 56583, 47500, 46107, 14405, 39276, 20305, 58796, 24372, 31756,
+    52181, 4624, 17119, 21053, 1690, 46517, 16733, 8693, 55392, 24691, 47090, 61120, 4702, 6319, 42834, 1161,
+    69022, 1737, 22717, 65918, 14050, 66829, 57008, 44795, 10665, 41948, 10541, 67936, 5435, 5585, 50625, 22836,
+    43824, 5868, 8671, 1356, 19799, 12285, 29700, 34090, 45367, 44843, 41643, 66920, 16245, 38502, 34284, 19203,
+    52117, 62274, 61643, 70395, 65829, 28478, 33104, 14635, 1464, 1050, 42011, 21500, 49933, 49896, 18606, 62998,
+    60577, 6251, 33944, 54874, 50246, 60557, 41814, 64107, 59000, 21135, 10171, 64583, 59744, 11324, 20690, 68824,
+    7200, 51171, 46501, 14858, 58501, 769, 19663, 42278, 59694, 40102, 32550, 21042, 23018, 69265, 20871, 13458,
+    53408, 56051, 38134, 17993, 22494, 33923, 58667, 69780, 25536, 30682, 19224, 14910, 67465, 69292, 48795, 70135,
+    23946, 50148, 57547, 9947, 61452, 34581, 53762, 62606, 28470, 67627, 58885, 67321, 17139, 43175, 55855, 38588,
+    27162, 7503, 69032, 20013, 64075, 25011, 18063, 59903, 2049, 18472, 60024, 26572, 61458, 19286, 43926, 4668,
+    50053, 54842, 18591, 57622, 57492, 28733, 21237, 16660, 50982, 45571, 4166, 15785, 36929, 7178, 8180, 11514,
+    44072, 22904, 1992, 16499, 18735, 43082, 10592, 61922, 13032, 39017, 61119, 20816, 29671, 33450, 9836, 28998,
+    31679, 25975, 51103, 5764, 40318, 16207, 58691, 45879, 69674, 54216, 61848, 22035, 62314, 65813, 30446, 38571,
+    29558, 61513, 45492, 50107, 52235, 66996, 44603, 21585, 1054, 26372, 41237, 58859, 37876, 3130, 66499, 19275,
+    53287, 44148, 30638, 6738, 70537, 4001, 8056, 33369, 53739, 25319, 20523, 21417, 2726, 10606, 34351, 6119,
+    64720, 58387, 3857, 9658, 32618, 8385, 2089, 59749, 2631, 69267, 43637, 20451, 58338, 54577, 26849, 48495,
+    42542, 65507, 36548, 60545, 1526, 46611, 46609, 23988, 44713, 7333, 64957, 35909, 21548, 50314, 13368, 33819,
+    17673, 38846, 15175, 69499, 14735, 3487, 41485, 26805, 4348, 22032, 22186, 35449, 53848, 51990, 49308, 46683,
+    39418, 3244, 15909, 15716, 57110, 31682, 16837, 1929, 31643, 48738, 41730, 38583, 22374, 9477, 14790, 6146,
+    2625, 38838, 5610, 15580, 53843, 38397, 34485, 38027, 61638, 34932, 2008, 40828, 51356, 4876, 25213, 64712,
+    41477, 11433, 41363, 35175, 55344, 55938, 56054, 52537, 23364, 18787, 9907, 23614, 32570, 33563, 31106, 61059,
+    59279, 63782, 33124, 26097, 831, 56448, 51610, 43125, 17354, 26253, 4661, 11330, 67102, 55706, 6754, 11430,
+    24149, 6504, 26592, 70228, 53170, 2039, 41998, 2385, 61263, 47112, 31298, 57719, 17597, 61076, 29330, 4239,
+    8985, 69726, 47961, 53080, 35137, 67437, 36194, 11660, 56262, 43026, 25964, 14713, 45123, 16351, 33551, 52064,
+    42045, 32626, 37215, 40752, 31078, 60783, 6611, 52965, 62960, 40816, 21707, 19061, 46420, 56018, 60974, 17075,
+    26839, 7248, 59276, 39894, 57353, 18828, 12713, 57938, 1909, 59326, 25306, 51624, 19159, 53466, 46214, 34841,
+    61582, 1560, 26852, 54846, 23800, 56704, 41422, 30914, 36177, 61916, 57178, 55470, 10705, 27735, 23823, 54147,
+    43456, 48515, 54655, 67986, 12692, 28349, 5505, 54422, 3874, 1099, 60191, 44792, 33965, 62430, 56444, 51213,
+    69818, 62594, 32108, 32887, 59912, 37731, 59583, 48433, 38805, 55926, 25623, 12755, 22132, 36404, 64034, 3515,
+    5751, 20389, 1322, 44447, 19629, 54321, 34408, 3909, 35366, 56052, 63271, 26285, 30544, 29860, 8100, 69936,
+    49294, 9107, 35673, 3513, 38219, 34455, 34344, 25002, 39064, 67149, 31159, 50851, 44841, 51594, 15668, 41130,
+    35618, 40388, 13004, 9339, 14523, 67618, 19677, 65543, 63279, 65435, 20348, 7768, 23860, 42901, 15955, 54367,
+    52097, 27417, 7202, 25165, 14316, 29534, 64799, 36154, 6464, 578, 37327, 26787, 24052, 18329, 57413, 17326,
+    7282, 6325, 50938, 69745, 63104, 23400, 51754, 14681, 23937, 1241, 17647, 22698, 32213, 58805, 21794, 48288,
+    56433, 3560, 48705, 3579, 22151, 24282, 57634, 55582, 43974, 20973, 31976, 49109, 24375, 42293, 5654, 60336,
+    27035, 48054, 42955, 12387, 26424, 60213, 22935, 36166, 26374, 39841, 32236, 59619, 11014, 20458, 46839, 13321,
+    38566, 61151, 32441, 35458, 60584, 12900, 50270, 68809, 580, 5496, 11633, 56452, 33936, 55658, 60553, 18421,
+    18236, 46033, 67481, 35692, 26560, 44035, 56550, 58316, 23221, 49884, 20869, 37874, 12067, 38229, 49790, 60992,
+    45485, 12449, 53310, 63691, 62931, 20659, 24737, 11483, 23861, 48409, 7094, 53588, 54893, 48748, 23303, 9462,
+    7179, 66491, 17494, 68917, 6909, 53687, 32049, 53955, 64952, 5170, 7058, 50761, 23119, 59210, 55084, 27919,
+    124, 59435, 69651, 63682, 2993, 14067, 24707, 32968, 40495, 8031, 1701, 23975, 52334, 42783, 14265, 5108,
+    30167, 13065, 38077, 12068, 24812, 15257, 19126, 7716, 46483, 42348, 60061, 24233, 11380, 59198, 69118, 27965,
+    7407, 16576, 44598, 45877, 8858, 47525, 68887, 1786, 3806, 35403, 14480, 45247, 21425, 39199, 44222, 40497,
+    48826, 43528, 43087, 69463, 18230, 37803, 48426, 7053, 17296, 61137, 24862, 37521, 64513, 29754, 38126, 24150,
+    23234, 24668, 44507, 1943, 34462, 38625, 22310, 28685, 43898, 16053, 34599, 53600, 29897, 32984, 62695, 49028,
+    7119, 60463, 23553, 66925, 59249, 30735, 24118, 60637, 25001, 22945, 61952, 31778, 29031, 52080, 49022, 37277,
+    5608, 66179, 9554, 44973, 25965, 42725, 9729, 7921, 29579, 60152, 25493, 13767, 17096, 12061, 57562, 33030,
+    19720, 70096, 4237, 29892, 23080, 3485, 22509, 64279, 48894, 52489, 63480, 63291, 9499, 48364, 26378, 39219,
+    33256, 32240, 50055, 23899, 68378, 51157, 39057, 53349, 19885, 29236, 57856, 21603, 19875, 29390, 31704, 53796,
+    52708, 16194, 19535, 67338, 47286, 34013, 12575, 41394, 12129, 17262, 50500, 44214, 30893, 37632, 29455, 20940,
+    9540, 22343, 15780, 14999, 43283, 21760, 28497, 59126, 68722, 14869, 59529, 60284, 63101, 35805, 17440, 5386,
+    22614, 64300, 62352, 494, 6024, 54478, 63118, 43592, 16792, 48808, 611, 37390, 43297, 6193, 32517, 7632,
+    22637, 46480, 18089, 42905, 19180, 62093, 33682, 66938, 48981, 31338, 43881, 13328, 20844, 67514, 33553, 22405,
+    32999, 65782, 48215, 42695, 55425, 62451, 27232, 5480, 22, 38232, 425, 61960, 28559, 44354, 47547, 67871,
+    55789, 47505, 58705, 25689, 70020, 47464, 5198, 59059, 14874, 11329, 68434, 63624, 10663, 13248, 47858, 7812,
+    42274, 57206, 12950, 6594, 53302, 67388, 63641, 33711, 34472, 2936, 52491, 18856, 61400, 8386, 54000, 50537,
+    52926, 27962, 63545, 10352, 63406, 45301, 63230, 39556, 37046, 48135, 36364, 50696, 54636, 36206, 59741, 28221,
+    39889, 54383, 70133, 23406, 69111, 37660, 56747, 10867, 43290, 54698, 29641, 34404, 70512, 34007, 47272, 56996,
+    48550, 65761, 52635, 29355, 62441, 6029, 46411, 49505, 67105, 6151, 11082, 26791, 42804, 6123, 12865, 19419,
+    16675, 63169, 41676, 22913, 61337, 69728, 18239, 6196, 20894, 30854, 12429, 40473, 54274, 16892, 54353, 61576,
+    16302, 49700, 19231, 38877, 63968, 20811, 13157, 22843, 5814, 55268, 55949, 3083, 6222, 22153, 57708, 42623,
+    10349, 23453, 35207, 44209, 31310, 55210, 61209, 23168, 58238, 51528, 59192, 847, 12265, 48435, 16216, 4193,
+    22120, 55987, 52733, 26946, 37674, 38489, 15697, 37880, 7319, 4017, 58925, 48599, 42945, 23272, 18541, 44950,
+    20116, 38922, 37858, 62336, 35367, 53828, 52631, 51274, 18752, 30419, 17986, 34579, 16105, 47200, 57242, 45937,
+    22370, 23667, 47359, 13020, 33452, 23210, 41035, 1189, 3748, 40482, 64074, 58922, 32250, 43709, 45554, 54930,
+    14709, 19285, 2264, 19072, 11400, 17090, 11161, 51755, 52094, 3693, 18806, 64997, 58910, 42435, 50860, 6715,
+    8994, 47097, 37270, 11094, 60100, 68444, 53996, 55742, 27261, 19531, 41958, 26624, 45118, 68007, 9501, 1119,
+    32567, 22989, 65365, 44499, 34062, 56497, 39515, 48494, 23684, 31092, 66395, 24417, 25545, 46507, 20535, 54027,
+    17349, 22616, 4142, 24828, 25189, 294, 60075, 43701, 24134, 4304, 36528, 54468, 13089, 47066, 324, 36655,
+    3412, 38597, 16624, 57321, 53062, 44150, 30909, 6993, 70398, 55276, 60179, 8322, 68217, 53662, 40567, 5082,
+    12096, 21190, 63887, 61995, 25950, 18944, 67133, 29003, 57480, 8917, 39722, 45989, 17294, 7973, 36885, 64041,
+    45723, 54915, 67255, 6281, 47644, 50888, 63042, 66653, 58074, 40087, 64696, 44110, 34467, 18739, 38655, 23626,
+    65384, 52307, 54243, 44576, 70246, 2151, 64100, 64827, 33803, 50850, 42340, 32220, 9534, 60342, 24089, 31587,
+    52284, 26116, 56733, 53403, 20969, 28318, 39997, 15084, 14231, 31206, 65476, 46797, 48164, 17513, 49814, 6461,
+    61018, 7800, 67094, 36415, 39745, 66466, 2146, 67304, 20294, 42809, 18469, 46676, 52632, 3670, 48986, 64479,
+    52407, 4694, 26731, 12592, 69855, 46803, 1217, 62322, 45076, 19943, 61405, 30757, 68259, 66177, 56403, 51545,
+    66503, 8923, 52500, 32791, 58795, 60717, 4663, 29596, 58686, 42678, 11906, 16287, 26140, 19192, 9033, 25309,
+    65802, 29963, 63041, 69622, 62362, 59868, 49861, 32771, 14034, 54334, 8256, 15727, 40211, 22246, 17852, 39428,
+    8371, 29408, 23734, 44501, 21130, 63293, 67629, 56945, 45562, 21106, 60094, 32287, 20854, 3586, 22412, 232,
+    61070, 4285, 59664, 49741, 53500, 41056, 36862, 34452, 59662, 59827, 12510, 19737, 16758, 58788, 26246, 67379,
+    33372, 60791, 5978, 52572, 57250, 11696, 31153, 22884, 24969, 58661, 23054, 65614, 35672, 11780, 51428, 27509,
+    26949, 37854, 39035, 4839, 59260, 64213, 20589, 3757, 7402, 66914, 36072, 54017, 37477, 5058, 65482, 33991,
+    28922, 24125, 54153, 68675, 67515, 29923, 69688, 24525, 24376, 44204, 27406, 35855, 55618, 31585, 62346, 44540,
+    10256, 59468, 41576, 29672, 33683, 50043, 33838, 58142, 30796, 63881, 21087, 43656, 21965, 54887, 23312, 24084,
+    68365, 57488, 58893, 11990, 7695, 52484, 31335, 21892, 43140, 63281, 44450, 17565, 51271, 29306, 50339, 32490,
+    21238, 55215, 54713, 38963, 47985, 45527, 17346, 19578, 27784, 3015, 64984, 35989, 54412, 741, 33988, 19527,
+    39450, 36776, 53373, 37827, 44817, 45615, 52096, 33562, 2703, 47443, 50329, 1976, 58389, 55683, 69827, 23147,
+    6886, 28067, 47841, 8464, 21558, 58410, 3554, 64150, 48574, 23403, 43127, 64527, 53125, 46466, 11827, 16329,
+    22998, 53641, 15827, 69951, 69529, 62426, 2533, 32572, 45811, 12525, 63970, 50561, 30128, 22829, 33945, 68683,
+    48806, 47659, 27145, 35215, 49475, 38773, 1445, 13701, 60417, 55857, 32801, 17125, 51195, 7573, 16086, 36395,
+    7944, 1353, 46139, 17273, 46449, 58351, 9312, 17020, 25253, 32492, 44512, 9607, 50293, 51701, 42082, 21368,
+    35110, 27640, 10226, 21209, 49717, 28102, 45202, 33436, 13517, 35790, 17336, 30265, 66463, 31318, 28026, 116,
+    11291, 5507, 16176, 756, 3679, 17762, 36520, 9835, 42525, 40915, 35751, 63667, 35910, 53176, 51634, 14446,
+    13274, 41581, 51932, 26083, 51388, 12678, 51333, 64089, 51078, 4912, 37412, 60605, 23071, 23718, 63640, 15812,
+    58277, 37425, 11545, 42248, 49721, 8618, 40341, 40792, 25090, 59911, 42301, 8014, 36903, 65750, 62252, 34466,
+    61162, 9937, 42997, 58575, 58412, 39983, 38312, 59858, 31676, 30381, 22331, 11998, 19806, 28210, 36620, 1457,
+    11410, 46174, 27729, 42730, 24974, 48363, 45741, 23959, 38901, 15480, 9191, 39822, 67703, 5321, 59388, 28208,
+    10002, 20656, 46778, 45695, 16860, 31700, 31983, 25398, 65486, 47468, 48386, 10112, 62679, 28679, 12352, 2396,
+    44610, 13845, 59285, 36218, 68739, 56962, 9432, 12283, 12349, 30666, 47449, 48469, 23990, 4785, 58157, 69047,
+    9483, 113, 26796, 24805, 47999, 5604, 62119, 50120, 40416, 31302, 20618, 65864, 26108, 68602, 21102, 16436,
+    35171, 667, 21981, 8862, 4871, 14867, 45219, 43773, 46985, 30247, 33173, 39351, 485, 43466, 39940, 61193,
+    27906, 36483, 50164, 11248, 64195, 21399, 68803, 70462, 14396, 21125, 58119, 28368, 40284, 12466, 23475, 14116,
+    66193, 33604, 26564, 70367, 9816, 32548, 68967, 28224, 68455, 23796, 25292, 40277, 49386, 55442, 25880, 8797,
+    28446, 2400, 34086, 10378, 44868, 53829, 65630, 18032, 9653, 1910, 35223, 16464, 55203, 62148, 33129, 31242,
+    70166, 20567, 19342, 55318, 2250, 17324, 55119, 7266, 59839, 45864, 66637, 60982, 38020, 32877, 59545, 65736,
+    36557, 1870, 44387, 14046, 652, 68221, 49419, 58264, 31988, 8045, 69083, 58337, 55167, 62545, 2216, 20319,
+    57649, 30406, 37983, 57285, 32048, 20653, 10735, 21483, 25639, 36599, 9978, 41170, 13630, 8082, 59882, 24302,
+    49921, 4424, 2485, 45170, 27594, 41885, 25278, 6254, 38413, 9611, 9686, 24049, 60876, 49046, 54862, 55905,
+    55903, 54558, 27925, 66979, 42672, 6642, 8680, 13954, 22125, 39523, 70312, 40629, 67897, 56145, 61210, 20290,
+    68895, 64679, 6777, 60257, 51123, 43233, 1884, 55204, 66648, 10876, 52781, 35696, 42930, 35257, 34582, 69276,
+    18775, 61663, 43384, 36751, 66681, 50837, 29757, 46325, 63199, 47159, 31217, 38127, 2889, 12657, 60307, 7566,
+    25751, 26728, 12054, 32440, 60957, 69272, 67707, 20138, 27716, 12842, 1554, 17232, 31586, 38830, 6253, 46887,
+    31801, 53968, 33193, 50150, 44797, 69953, 7195, 43956, 23011, 25024, 61335, 19649, 47811, 31859, 67669, 25609,
+    55552, 45293, 1278, 9622, 30229, 29610, 59788, 30745, 46594, 67031, 28789, 20168, 26409, 14330, 43111, 14115,
+    34481, 2430, 28978, 56106, 56604, 62596, 19654, 50485, 62658, 6396, 28188, 35019, 3122, 15253, 65348, 43885,
+    19932, 42570, 39385, 29831, 70362, 1063, 31556, 30705, 61752, 2600, 67876, 29055, 34073, 24962, 67047, 34162,
+    54332, 5730, 61793, 8532, 17575, 20181, 10763, 269, 41312, 65088, 24353, 17975, 51255, 24117, 69129, 41235,
+    64394, 30312, 36803, 35326, 47132, 22775, 60438, 62659, 8998, 16243, 1007, 54032, 3290, 43313, 22754, 9004,
+    49310, 18480, 16284, 29710, 46849, 58871, 60940, 51009, 69541, 28169, 13737, 22907, 40539, 27681, 25915, 53750,
+    27763, 58168, 64114, 36752, 34649, 458, 23579, 61888, 48187, 47735, 29859, 10507, 43264, 20476, 65792, 23095,
+    60335, 5663, 48350, 27647, 5495, 18006, 44405, 19947, 37655, 55758, 65406, 8669, 63708, 13697, 9634, 49429,
+    34470, 783, 20803, 48002, 5106, 50225, 14262, 49019, 28823, 58321, 50828, 45949, 59572, 42008, 30514, 16077,
+    8665, 8433, 56150, 54470, 38680, 62904, 64331, 4673, 58950, 15851, 15271, 49711, 766, 49879, 15145, 60785,
+    47775, 14832, 535, 53629, 2187, 67649, 56007, 67148, 64393, 26020, 10138, 21675, 13413, 238, 46140, 15161,
+    36755, 18171, 60090, 43230, 23007, 24565, 51858, 57511, 19260, 46824, 13715, 17841, 53618, 2273, 11649, 10356,
+    13955, 65798, 16414, 57446, 5403, 50962, 5966, 51072, 11855, 20403, 23802, 16880, 36298, 67059, 56115, 1619,
+    66985, 65453, 22062, 6548, 67453, 31075, 16134, 7564, 70432, 15667, 7243, 20748, 2105, 58449, 63043, 47938,
+    4605, 68796, 66146, 27265, 51099, 36711, 19958, 20450, 64215, 31040, 9889, 64866, 5801, 25981, 53189, 15918,
+    58266, 8320, 28203, 30528, 68911, 35009, 3249, 46408, 54252, 60942, 7846, 61315, 47326, 68742, 41470, 49507,
+    14435, 10427, 55354, 69692, 43953, 5756, 15826, 68908, 27560, 37128, 24983, 65808, 19134, 67459, 21164, 45909,
+    43014, 51174, 18408, 7932, 63202, 6940, 18434, 58513, 30927, 70029, 12562, 33039, 65069, 49805, 11953, 47603,
+    57743, 1793, 26964, 34026, 54567, 24433, 24359, 52738, 20491, 4652, 46251, 57214, 63929, 63233, 49499, 2412,
+    68143, 27059, 9082, 12617, 43997, 26953, 36159, 21370, 29433, 23445, 20732, 42821, 9455, 52205, 5023, 10404,
+    57189, 9329, 39056, 53853, 53860, 8647, 68251, 60849, 46571, 43865, 42677, 65454, 70006, 49695, 26169, 49341,
+    34572, 38313, 63590, 47197, 51231, 23081, 10908, 70277, 24576, 9453, 23875, 11722, 16272, 15728, 7347, 23613,
+    44357, 62582, 37960, 50701, 63459, 66931, 43150, 21155, 28243, 13722, 10881, 45472, 6480, 64302, 42928, 7989,
+    31375, 51437, 61128, 47795, 22770, 59502, 24452, 21460, 47281, 60261, 51520, 40903, 7175, 66767, 65925, 55406,
+    24870, 45227, 10411, 65443, 30891, 60515, 618, 16940, 118, 40661, 3208, 26973, 42073, 20939, 676, 25123,
+    65674, 11517, 39137, 21462, 19680, 14826, 12756, 35612, 26267, 3822, 49816, 68464, 60022, 32408, 23195, 68110,
+    1089, 61370, 13387, 59546, 31055, 8969, 18732, 5217, 997, 70148, 51970, 68812, 12712, 10333, 39161, 8278,
+    30010, 62633, 52487, 7459, 36648, 56975, 10669, 66357, 57781, 64523, 6469, 6669, 43219, 47129, 45961, 16418,
+    20010, 62136, 16699, 36704, 5897, 61641, 4558, 5143, 25730, 57827, 5607, 25262, 53604, 10666, 7391, 21161,
+    33043, 27191, 59273, 49720, 58719, 42123, 30019, 22677, 34626, 65965, 58500, 59997, 36584, 65331, 17878, 23577,
+    497, 58071, 364, 1214, 26036, 24176, 6139, 55593, 69995, 61282, 37462, 68994, 35639, 40870, 65923, 55808,
+    38365, 45138, 69109, 15190, 14731, 22261, 21587, 51548, 56110, 54670, 29804, 68366, 43940, 10651, 17738, 59470,
+    26423, 60071, 6410, 38319, 14094, 6547, 57847, 49152, 55913, 1952, 39618, 45363, 28043, 39415, 26629, 66113,
+    22031, 47613, 156, 48367, 30096, 14792, 61176, 274, 50775, 12744, 8600, 15239, 12624, 53672, 17033, 21034,
+    3077, 54312, 57569, 21212, 23612, 18912, 20397, 55181, 44176, 10989, 43871, 191, 51182, 26831, 1532, 65689,
+    34947, 11411, 18436, 52238, 4171, 993, 57844, 29557, 58738, 29196, 19463, 18737, 32644, 64646, 21411, 21103,
+    28880, 12984, 3441, 63930, 57571, 1661, 11104, 47452, 54303, 53327, 39790, 17637, 18015, 22206, 9925, 52661,
+    64274, 9273, 19119, 40611, 45340, 27661, 1275, 815, 22681, 39339, 42711, 58448, 18638, 28217, 57180, 32151,
+    32786, 3553, 26524, 15097, 6226, 46870, 53821, 68379, 60616, 17081, 12973, 36674, 56667, 54813, 42332, 47142,
+    47957, 10536, 68034, 47207, 65318, 67179, 62707, 20705, 10007, 28581, 5547, 19872, 21319, 27436, 21817, 49826,
+    5523, 17789, 69260, 17528, 45951, 14280, 1843, 14744, 56649, 13753, 32925, 54128, 68195, 56493, 44541, 13102,
+    31070, 45926, 16681, 6063, 43877, 36065, 52512, 24485, 38404, 27796, 20344, 31782, 2152, 16643, 29869, 11724,
+    4826, 57602, 64418, 68121, 24975, 42250, 28662, 67541, 34496, 26888, 58728, 65721, 9018, 40480, 56468, 31955,
+    58866, 13051, 23012, 7771, 23998, 26201, 41315, 43760, 57996, 17249, 43587, 38678, 51817, 4146, 23947, 35792,
+    1132, 57295, 67161, 7712, 47473, 56670, 33929, 26096, 13307, 29785, 3528, 37901, 18202, 65303, 5826, 51090,
+    40693, 20662, 17484, 63871, 28803, 6228, 29067, 18237, 65051, 28648, 34125, 69846, 46056, 4710, 3956, 41583,
+    17032, 39719, 14041, 68689, 13872, 42033, 40104, 31344, 22426, 42576, 32013, 60407, 4397, 33071, 70265, 58993,
+    36104, 22083, 3916, 34868, 26087, 33650, 25365, 43686, 11642, 65014, 37709, 50889, 37954, 1858, 1216, 57332,
+    53102, 14418, 63919, 25249, 45804, 12203, 31964, 13806, 68447, 32369, 2597, 37669, 9459, 28989, 32399, 55260,
+    48921, 50390, 23375, 38402, 44767, 927, 11322, 69041, 39692, 29820, 65545, 53827, 42927, 24822, 63788, 42504,
+    64293, 64121, 60126, 57851, 46616, 18645, 65882, 24743, 22716, 2846, 9869, 49903, 35250, 51199, 32101, 30348,
+    680, 26260, 58718, 49306, 11865, 6996, 21537, 3448, 45660, 30476, 70479, 59771, 46898, 11197, 11826, 44188,
+    30274, 30448, 15243, 63932, 3378, 33898, 36169, 53872, 58536, 43303, 5950, 37420, 57971, 12966, 62363, 14146,
+    57818, 20454, 13195, 5209, 68086, 34580, 65873, 5488, 48181, 46141, 68351, 50076, 51475, 47371, 54088, 28423,
+    14572, 5369, 60555, 42754, 67501, 63956, 37673, 35151, 35830, 65359, 8036, 11126, 36175, 42220, 70300, 68274,
+    43064, 43292, 9386, 60478, 57393, 63340, 48627, 64451, 26999, 61232, 18550, 3819, 61295, 53517, 55708, 16924,
+    61545, 17954, 46180, 15068, 19118, 20994, 61762, 43895, 66091, 2717, 50623, 46156, 67237, 45253, 55379, 3622,
+    38681, 10145, 61770, 24960, 22325, 50619, 33056, 29347, 30202, 57176, 1459, 65980, 57777, 14904, 61298, 33742,
+    14364, 26148, 33972, 70273, 9445, 24114, 70360, 20252, 42745, 65477, 32132, 41636, 6771, 53501, 37499, 23722,
+    31419, 44438, 64015, 66131, 5343, 30071, 11587, 42423, 36234, 55228, 66166, 4873, 15643, 12589, 5136, 60665,
+    5281, 28528, 56724, 59290, 6341, 31940, 63330, 18249, 49666, 55713, 7491, 47700, 22158, 13734, 5420, 4406,
+    16117, 27424, 46671, 58299, 7612, 28698, 22600, 47883, 69610, 55417, 54827, 56235, 25050, 40657, 58408, 41696,
+    24648, 23382, 39240, 59542, 51470, 65767, 63087, 37860, 43886, 58853, 51295, 14210, 50800, 14072, 12574, 16693,
+    51787, 16472, 28669, 8614, 39545, 18358, 32012, 30530, 33966, 31365, 33426, 40606, 19312, 4540, 42179, 12192,
+    10922, 30130, 40674, 70389, 55510, 66008, 18667, 58170, 3547, 43632, 6692, 59654, 1394, 61887, 64556, 33005,
+    66155, 5843, 34070, 22525, 69583, 8311, 21542, 67616, 52808, 12964, 52137, 2267, 54475, 21522, 16364, 20579,
+    36554, 49160, 46670, 31680, 63067, 21345, 44954, 40067, 11673, 65567, 3287, 8446, 34356, 50158, 37182, 70497,
+    5475, 18423, 70051, 6067, 60540, 22356, 33552, 2375, 7245, 2293, 39516, 13115, 25347, 22117, 17244, 9910,
+    68876, 29764, 3358, 17099, 1632, 60959, 5019, 40200, 56090, 7551, 7079, 1083, 10955, 64208, 14152, 44534,
+    47155, 27356, 45547, 8687, 66002, 22245, 8952, 2826, 23349, 55475, 3922, 6531, 1494, 59743, 56529, 28586,
+    56201, 17203, 39838, 43417, 30568, 64137, 54192, 38148, 25199, 44981, 25631, 7114, 13015, 461, 63438, 69506,
+    7181, 5366, 35507, 62366, 12347, 62344, 6920, 48383, 56258, 8216, 41400, 68815, 39802, 21016, 47963, 54109,
+    27091, 13688, 52477, 48384, 28747, 19541, 70088, 18476, 35341, 4087, 17368, 39875, 27467, 62109, 64094, 34827,
+    13506, 59498, 47903, 35006, 40684, 64812, 19666, 12739, 24491, 24107, 65049, 61291, 64377, 46782, 8003, 60368,
+    52028, 54718, 52067, 54878, 51694, 28174, 20553, 3132, 11005, 16199, 48727, 16639, 50595, 14653, 9852, 40873,
+    21974, 919, 37834, 8502, 33948, 25259, 55237, 46759, 39777, 22505, 65739, 475, 60845, 21632, 29094, 22679,
+    52259, 65924, 38408, 51040, 47182, 25321, 68518, 36744, 21467, 53434, 13012, 21806, 22490, 33082, 38691, 46955,
+    5844, 65326, 61998, 43437, 49238, 22312, 13673, 47513, 38474, 4621, 23226, 52544, 51611, 34011, 46621, 50572,
+    28250, 60899, 16096, 37570, 397, 22071, 17627, 1623, 6150, 22535, 2805, 60458, 11765, 59998, 11464, 70262,
+    43019, 44870, 70278, 4929, 39203, 7192, 41484, 59821, 3599, 2085, 7129, 48345, 14630, 1299, 16474, 64178,
+    45320, 55668, 59412, 52671, 28185, 56233, 26141, 52879, 24632, 24631, 7376, 27248, 32776, 30497, 43483, 67755,
+    24764, 4913, 40008, 5125, 1515, 5921, 9637, 45017, 14095, 69532, 29191, 28556, 40147, 18868, 21038, 10386,
+    22601, 70062, 9570, 26915, 44059, 13646, 62637, 12442, 50875, 27944, 63952, 54606, 54230, 47396, 29542, 66275,
+    16539, 59514, 37242, 23114, 54062, 31810, 30357, 53995, 32705, 64186, 46587, 45431, 7364, 49686, 19362, 49693,
+    64439, 50317, 43569, 9169, 19529, 6143, 46893, 43018, 62520, 50509, 23813, 37333, 52984, 70480, 36099, 47751,
+    13719, 31071, 37905, 43764, 67607, 27360, 62660, 46761, 29798, 6736, 56545, 63720, 65349, 61124, 24345, 27529,
+    62564, 31111, 60603, 54696, 68256, 56193, 35016, 18372, 43166, 62676, 42124, 13918, 25997, 32750, 44149, 37637,
+    56227, 39792, 21065, 1854, 27828, 69549, 37441, 70187, 11120, 43008, 40576, 61979, 36870, 35446, 21592, 11331,
+    49765, 31073, 40310, 6164, 9712, 64267, 68124, 2777, 7888, 42335, 10371, 53317, 42922, 57234, 21563, 33622,
+    13691, 43607, 33538, 48631, 44088, 4923, 860, 5379, 20147, 66991, 65877, 69380, 9422, 7780, 55015, 57368,
+    66527, 42797, 9167, 21305, 4267, 4287, 57956, 45806, 37811, 25364, 9567, 37951, 12267, 65894, 13986, 15147,
+    65948, 8673, 66455, 13395, 22532, 3576, 63621, 53316, 21402, 34797, 32640, 14989, 61191, 46967, 50267, 42581,
+    19981, 65085, 28336, 70252, 65970, 61463, 48761, 65249, 2492, 39235, 58902, 47403, 37692, 14917, 6445, 4607,
+    23602, 28092, 44936, 3164, 36337, 51652, 17582, 29840, 68710, 32675, 44106, 64597, 6339, 27842, 63036, 46130,
+    13208, 21356, 8649, 68164, 66216, 42362, 7280, 33397, 51526, 27205, 12600, 15825, 37194, 59169, 39998, 41024,
+    57419, 52466, 18019, 3630, 29709, 39417, 3808, 5329, 61694, 51197, 63262, 34752, 46953, 42554, 39380, 18521,
+    32740, 18390, 55767, 38722, 32874, 12023, 47375, 52496, 48604, 10432, 7507, 57366, 52658, 41306, 43412, 26654,
+    58224, 24782, 36868, 36694, 2955, 38026, 41605, 69080, 63072, 15866, 36282, 44034, 32363, 62096, 44740, 8442,
+    61808, 30361, 4991, 9321, 52179, 12560, 4787, 13251, 25550, 59311, 44519, 66892, 37035, 62940, 22993, 25016,
+    28755, 5213, 54382, 59812, 62468, 10074, 50671, 3313, 47167, 62989, 65889, 16811, 52364, 34473, 63726, 63530,
+    22709, 36369, 14224, 56047, 43690, 28350, 35209, 4683, 27331, 10448, 67948, 30337, 26021, 5587, 42487, 14198,
+    43575, 52625, 42394, 4544, 28281, 52618, 68726, 69496, 746, 4207, 21365, 15006, 9901, 38858, 61189, 11607,
+    64816, 22437, 17578, 36503, 50573, 41877, 20998, 56406, 55122, 41489, 69638, 6000, 33342, 49925, 3127, 27512,
+    17615, 110, 31602, 52827, 36123, 22392, 3205, 51648, 56321, 42696, 65717, 35685, 12408, 55216, 42937, 40621,
+    50719, 55731, 66944, 12955, 39208, 67971, 60394, 51753, 20714, 18280, 12315, 63786, 60300, 64012, 57100, 14149,
+    30565, 66415, 67899, 54965, 28453, 13681, 37249, 52974, 36787, 12050, 49248, 46717, 21693, 41093, 55057, 46233,
+    25005, 15711, 13948, 69556, 68996, 20695, 34528, 12144, 42324, 54576, 25667, 46649, 984, 66860, 47126, 35555,
+    54041, 8030, 38250, 61587, 3088, 42584, 15981, 8711, 65915, 57336, 9959, 66307, 65350, 31802, 57901, 64042,
+    4450, 13639, 44788, 46728, 5299, 13730, 11557, 3462, 16948, 56100, 20131, 51362, 32106, 59315, 64565, 11089,
+    15807, 13310, 20910, 24995, 44391, 25982, 11214, 68851, 68964, 13803, 13560, 6690, 42027, 48190, 39001, 20229,
+    67645, 44531, 60041, 31259, 38951, 53986, 13090, 31740, 3701, 22697, 43820, 52471, 11939, 35839, 11710, 48424,
+    54003, 54134, 66346, 69947, 63388, 51863, 4678, 68520, 53457, 62770, 1157, 54215, 31966, 7777, 424, 45726,
+    6748, 3500, 13111, 57871, 26243, 16939, 52089, 61286, 37101, 46600, 13942, 45519, 45430, 43124, 18314, 67888,
+    18349, 13024, 2257, 54126, 25896, 34970, 1778, 68539, 19698, 40298, 5750, 21690, 45379, 54838, 43117, 54238,
+    41450, 50, 15612, 5158, 5168, 11238, 21594, 35864, 22448, 47184, 7668, 58539, 21666, 28044, 26094, 29962,
+    63435, 56694, 69110, 20853, 15989, 16063, 67186, 38051, 9158, 33788, 41568, 67843, 39673, 23472, 46883, 49674,
+    53175, 15855, 43151, 28051, 4034, 11833, 45844, 14551, 4646, 69931, 56038, 26468, 47405, 34372, 24849, 56352,
+    23507, 48463, 40483, 30269, 14702, 18719, 46398, 7540, 25499, 18008, 70272, 53775, 41820, 20782, 45172, 34451,
+    33915, 50744, 46889, 27369, 63066, 53745, 13922, 13237, 33769, 58067, 50539, 27481, 42326, 5409, 56980, 58457,
+    32687, 47358, 48527, 29159, 53240, 48600, 66001, 21091, 12507, 22449, 34792, 37921, 11533, 35222, 21007, 67825,
+    41495, 56010, 3545, 59324, 619, 60879, 6284, 47907, 65441, 25681, 54780, 49979, 22866, 67619, 6908, 66048,
+    24507, 30508, 31359, 16751, 39194, 41296, 30512, 5835, 19223, 51461, 20898, 20563, 13610, 43674, 17808, 38891,
+    9083, 14546, 67398, 7987, 22147, 24806, 4202, 62972, 37895, 24511, 11591, 8306, 37929, 19917, 29325, 31706,
+    25753, 12453, 36693, 63941, 7450, 2786, 5637, 67737, 19021, 47599, 4091, 42756, 10845, 23790, 31568, 60380,
+    34860, 63478, 34475, 58567, 26061, 43742, 11268, 22584, 47572, 30921, 1964, 38120, 15002, 65828, 3799, 10483,
+    20792, 60934, 36322, 48438, 18150, 15450, 28353, 35299, 2091, 4410, 17080, 26841, 8634, 64970, 27655, 1669,
+    3716, 10717, 62984, 52081, 64681, 63425, 14404, 49468, 5248, 47293, 30606, 33661, 2642, 26834, 16988, 37318,
+    37657, 45975, 28314, 18325, 18585, 42598, 27159, 29727, 47762, 27364, 46981, 41850, 35228, 15957, 16422, 56955,
+    10924, 30785, 31323, 62739, 37936, 8624, 37908, 22853, 5214, 65019, 22537, 61259, 35481, 26991, 21930, 45813,
+    19443, 33969, 20254, 20151, 15837, 35844, 62129, 17239, 6967, 48062, 13411, 46809, 30119, 17510, 8795, 40041,
+    12464, 68673, 67546, 56237, 6483, 7172, 29256, 16650, 61721, 20569, 54255, 32100, 68980, 69211, 7263, 15273,
+    45389, 20187, 62922, 11407, 52881, 64495, 30748, 3919, 10834, 67801, 25616, 59598, 47942, 38924, 63861, 63830,
+    59590, 31202, 59296, 27380, 39963, 21683, 35055, 48760, 50566, 17750, 42304, 26903, 54818, 41271, 37497, 52103,
+    34550, 35114, 69031, 63221, 30088, 306, 18036, 55765, 21323, 2565, 60195, 43680, 66647, 11631, 68371, 54511,
+    28606, 8175, 67864, 22759, 50882, 38056, 59132, 58498, 13300, 25980, 64878, 34195, 4699, 66246, 17332, 44859,
+    25684, 44884, 53724, 47427, 24170, 68714, 39136, 66608, 68779, 26498, 41424, 2186, 48977, 28783, 41480, 52260,
+    64365, 56773, 43395, 37859, 31015, 51878, 52042, 12625, 23922, 60751, 38878, 60297, 6972, 5134, 29959, 50244,
+    36832, 63442, 6694, 57301, 37892, 53026, 18433, 51639, 13534, 35129, 2767, 19731, 28361, 23134, 55921, 47446,
+    31454, 44722, 39404, 19924, 68222, 58664, 0, 7742, 54220, 55603, 43582, 39023, 21985, 40403, 60624, 43806,
+    43426, 40130, 10422, 31661, 10213, 46280, 43459, 63286, 58693, 5619, 39037, 65610, 54852, 63690, 52554, 50258,
+    70229, 47378, 61796, 23886, 18718, 39289, 9912, 48448, 49526, 68819, 61702, 69498, 45442, 24213, 4762, 41160,
+    4691, 70417, 69344, 25039, 9286, 54789, 45947, 45784, 45321, 23427, 56395, 15736, 10919, 57365, 35, 58827,
+    18618, 25345, 33159, 30462, 45137, 48849, 12789, 43728, 17980, 23867, 67121, 10238, 37248, 70174, 4617, 10829,
+    37978, 26773, 42976, 36984, 53651, 39095, 38795, 12199, 1868, 15158, 42350, 66018, 62038, 26941, 68082, 66372,
+    25808, 65751, 49284, 68163, 56478, 36911, 30403, 43623, 60533, 64278, 8114, 11672, 41259, 40241, 39223, 9078,
+    46496, 52217, 41506, 68981, 10298, 15539, 53254, 40950, 38999, 61790, 16797, 36211, 18870, 2268, 61911, 39442,
+    4778, 27358, 46640, 31189, 40725, 5092, 45793, 4833, 276, 5430, 10947, 38379, 58684, 37179, 34537, 10009,
+    20791, 46685, 35549, 64342, 25574, 12985, 65650, 5466, 47874, 33825, 54550, 33708, 66317, 57883, 23666, 21874,
+    67850, 29396, 35385, 51081, 60378, 58152, 1250, 23161, 17288, 4343, 5866, 54692, 42501, 38478, 35314, 38303,
+    56732, 51303, 7485, 66644, 31112, 66811, 30800, 39164, 47698, 68596, 15502, 14697, 48800, 45113, 16377, 51399,
+    44472, 69450, 68237, 68537, 56847, 16710, 41943, 62103, 42080, 44717, 68564, 22052, 26455, 18156, 41144, 51401,
+    30899, 6685, 58559, 2731, 22497, 57231, 51868, 37203, 11342, 46346, 11067, 44696, 6788, 60472, 27225, 35371,
+    37720, 55291, 66515, 11595, 22177, 9154, 6591, 4098, 55942, 49058, 61497, 57144, 66405, 58952, 46143, 9737,
+    37618, 32225, 48654, 42919, 50254, 54516, 4878, 235, 25932, 51886, 7018, 19482, 28374, 13314, 25031, 49339,
+    6681, 29252, 17608, 29324, 12543, 19279, 11622, 43371, 56445, 21937, 66594, 30642, 18663, 51745, 38609, 29651,
+    62663, 8491, 44561, 58421, 61986, 56280, 69673, 27839, 62974, 10981, 48091, 67517, 28456, 69904, 8383, 23379,
+    49779, 61007, 68115, 26720, 30478, 17758, 26009, 4206, 57802, 43048, 39579, 36960, 68997, 38136, 50163, 20430,
+    5952, 49792, 10612, 42876, 2818, 28929, 45369, 65833, 47436, 37801, 33663, 7238, 64218, 65857, 51113, 65471,
+    68090, 39133, 16735, 19646, 23333, 1887, 32128, 16999, 17194, 16071, 39227, 24573, 49985, 19023, 38385, 9980,
+    48978, 35661, 27955, 41250, 10163, 12370, 42988, 26049, 4604, 21866, 25791, 62438, 56593, 38275, 53520, 35125,
+    6851, 8571, 26193, 67940, 20415, 57163, 63547, 775, 37335, 53878, 16373, 15197, 13805, 10172, 62256, 70326,
+    18405, 53264, 56824, 42225, 40238, 26626, 41713, 30915, 36657, 34740, 39373, 14042, 54104, 3525, 55927, 65764,
+    103, 18601, 20896, 55675, 45067, 58405, 24171, 7141, 29540, 3655, 48423, 55819, 25719, 2684, 20525, 32845,
+    51077, 8340, 30135, 13511, 17188, 37263, 69875, 51991, 12606, 7607, 15740, 11553, 50895, 18005, 30707, 57142,
+    66495, 27991, 36600, 67333, 19469, 58149, 69938, 26562, 37714, 58428, 23656, 38598, 38115, 48313, 34325, 22090,
+    15971, 44590, 24556, 41718, 64623, 33292, 32147, 15535, 47474, 15862, 9618, 29318, 11115, 64573, 231, 14108,
+    3846, 42211, 48519, 3369, 41839, 21609, 58657, 34432, 66981, 60812, 44294, 37522, 34675, 15367, 15661, 55389,
+    20914, 34595, 18447, 49539, 67521, 24195, 68528, 3355, 20033, 34236, 4963, 15890, 46682, 29617, 29284, 21187,
+    37076, 22129, 43398, 6524, 46936, 38448, 3823, 68951, 18215, 64718, 30729, 51244, 63241, 65283, 9195, 68701,
+    29821, 53148, 14524, 20349, 17532, 54847, 50478, 23961, 13057, 6842, 29502, 21508, 27164, 31748, 41360, 14933,
+    43863, 27367, 14291, 50230, 36677, 53052, 28480, 21458, 58530, 56723, 26723, 55219, 60148, 56364, 46039, 43731,
+    65258, 31263, 30144, 4279, 56154, 36999, 50778, 4295, 34510, 7215, 42668, 44157, 33339, 22756, 26127, 44217,
+    45596, 56037, 41682, 37284, 26335, 49043, 22617, 39953, 1800, 61511, 65166, 23139, 43317, 46222, 1660, 57633,
+    32087, 22280, 18066, 31020, 19027, 11868, 67886, 45032, 23854, 6300, 53384, 54985, 4881, 57854, 1065, 42154,
+    68315, 58769, 48025, 9373, 2041, 29366, 47528, 11801, 45990, 24880, 40040, 54324, 21163, 64125, 16881, 36762,
+    32757, 57696, 60858, 48827, 57440, 53633, 29585, 40143, 38121, 3695, 37605, 62744, 13979, 53152, 6625, 5434,
+    68431, 53770, 26528, 26753, 47680, 29646, 31463, 17982, 1518, 11086, 11137, 48401, 70074, 34744, 13576, 10258,
+    32629, 68020, 42615, 60043, 2633, 3352, 22464, 32331, 37325, 27578, 9093, 65663, 39489, 18911, 462, 19805,
+    29956, 14972, 4740, 57027, 56864, 5317, 40413, 8925, 43707, 19704, 18964, 24142, 51425, 41707, 7118, 14114,
+    63760, 28440, 24185, 14352, 49673, 35530, 30012, 34985, 21499, 11964, 1991, 58965, 17176, 25361, 24548, 9096,
+    64727, 66013, 16600, 31541, 20056, 798, 18439, 33931, 64652, 1534, 1715, 18860, 47039, 87, 67346, 13383,
+    23644, 36243, 48, 10546, 32518, 42757, 69695, 32824, 63582, 17560, 56892, 70461, 29495, 24964, 41608, 26065,
+    39077, 52597, 39797, 59704, 38932, 41069, 12730, 48865, 56020, 6657, 20921, 43977, 62813, 56318, 61984, 14213,
+    53956, 4722, 55988, 18322, 56057, 49117, 25097, 29241, 37144, 63701, 30633, 11654, 20386, 30359, 51721, 38297,
+    20462, 56142, 70076, 55246, 68303, 18978, 273, 48298, 59136, 54868, 52237, 6779, 1341, 22002, 36853, 8484,
+    976, 25752, 48655, 29998, 28214, 34709, 13930, 27201, 14058, 46765, 17489, 12398, 59399, 4903, 7191, 62988,
+    5257, 19410, 55401, 49422, 13821, 62588, 43867, 68949, 12178, 64220, 13196, 46417, 3175, 9728, 32888, 24474,
+    65817, 53647, 16794, 23643, 60271, 43708, 30731, 48309, 61290, 66843, 59551, 70387, 65745, 4862, 2758, 15421,
+    46358, 38798, 32110, 21786, 22524, 30756, 64790, 48059, 22948, 11362, 11625, 34065, 58593, 55374, 63109, 37852,
+    32734, 7557, 13098, 46192, 13847, 12931, 492, 53036, 327, 40966, 43326, 26567, 16379, 52274, 39955, 30459,
+    10003, 60570, 55304, 46748, 25521, 60079, 68713, 33883, 3941, 46368, 19938, 58049, 26187, 33400, 58053, 26668,
+    55640, 9127, 23797, 32963, 10124, 36164, 48485, 45480, 14070, 8051, 59543, 59214, 45694, 37490, 44315, 51532,
+    69487, 47734, 937, 56301, 27582, 8788, 23847, 59797, 53140, 47658, 50081, 51589, 54325, 50771, 52195, 49,
+    11246, 26820, 3492, 52732, 18033, 54496, 67317, 29891, 36692, 2102, 61462, 49658, 10093, 20279, 40081, 27736,
+    25531, 26258, 7832, 43089, 49134, 44212, 3615, 7146, 65700, 29527, 45595, 60911, 1039, 20211, 55749, 60125,
+    63671, 42998, 45532, 8363, 30383, 1291, 29894, 13156, 51828, 27363, 2075, 33187, 67450, 54118, 8651, 18138,
+    34053, 31953, 62118, 56767, 22087, 30683, 57211, 27674, 65579, 54264, 64126, 2331, 45944, 69466, 4442, 60760,
+    43307, 22517, 9516, 51348, 21244, 48356, 12676, 5855, 43534, 56226, 5578, 27525, 7782, 39120, 46442, 45502,
+    37966, 18168, 4294, 3973, 53347, 7288, 7235, 47067, 1543, 57746, 15165, 32522, 39117, 38804, 39068, 44026,
+    21838, 65897, 22644, 32044, 69347, 4775, 12120, 39179, 51586, 50000, 52029, 20185, 57288, 27983, 31733, 6605,
+    50437, 58024, 28099, 70185, 10449, 45971, 3658, 47198, 7430, 20584, 29431, 55809, 50617, 2555, 48477, 37645,
+    52765, 34140, 32659, 2569, 9971, 33700, 26810, 23728, 7923, 62981, 23969, 22056, 39781, 62897, 9403, 52951,
+    43007, 17107, 10382, 51391, 24152, 34130, 34388, 47541, 57379, 35147, 21321, 52541, 22022, 9563, 1118, 47213,
+    57172, 14147, 6678, 61878, 5533, 32386, 17547, 2192, 11957, 57352, 17678, 7127, 58174, 20593, 64550, 26406,
+    58087, 14007, 48878, 43600, 31165, 42276, 36479, 63538, 32201, 33596, 3572, 57524, 25182, 46881, 39124, 33576,
+    22706, 45856, 5791, 34207, 35744, 60606, 34124, 4125, 68531, 33305, 58933, 53753, 14110, 66990, 46212, 10992,
+    58289, 3714, 21096, 25231, 1319, 40799, 36461, 50511, 60014, 42378, 8716, 5777, 64872, 8508, 64648, 8576,
+    58268, 1775, 16262, 43650, 6586, 37729, 22539, 21616, 4298, 28204, 21746, 9840, 45012, 64639, 7804, 53041,
+    70114, 61130, 20380, 34870, 26798, 51210, 27623, 56424, 17285, 8657, 68929, 30360, 63343, 6863, 26897, 951,
+    37415, 28310, 54386, 64629, 560, 11057, 63495, 44948, 6629, 65358, 50020, 63689, 43095, 47316, 16402, 41837,
+    54727, 25346, 43234, 40030, 15320, 29511, 61503, 25125, 7083, 8659, 62620, 19367, 3278, 53398, 56781, 10488,
+    47250, 54361, 19667, 21570, 3466, 42235, 39148, 57968, 56691, 50506, 14176, 2819, 9074, 49895, 55599, 16528,
+    8958, 47231, 64728, 5798, 10703, 21363, 19473, 58525, 63806, 52921, 25404, 38285, 30416, 64609, 31979, 37667,
+    25439, 6030, 25026, 34063, 6268, 45603, 36476, 68021, 69742, 24809, 51468, 14166, 20431, 23236, 31621, 17830,
+    17918, 51767, 55850, 15468, 40845, 44493, 63226, 17253, 70406, 45319, 27013, 17403, 15256, 15654, 1270, 15743,
+    35739, 34384, 48127, 62193, 54958, 64798, 48504, 52136, 20685, 17451, 30339, 63837, 5500, 13343, 10771, 57427,
+    38866, 48970, 67491, 53550, 17932, 1199, 53243, 70207, 2542, 63179, 52088, 43715, 20543, 51903, 36745, 3575,
+    51474, 39447, 14614, 32334, 60162, 64152, 23509, 65536, 22645, 27203, 57357, 69652, 36229, 66969, 48199, 30503,
+    57071, 11525, 17246, 12691, 57812, 22762, 16767, 54365, 57149, 2239, 12825, 54034, 15353, 27303, 27551, 49819,
+    22201, 27491, 51351, 29597, 21839, 68227, 66066, 45441, 52424, 42873, 28433, 55495, 42171, 63924, 31505, 48536,
+    50899, 68487, 53649, 14111, 59637, 34755, 4243, 31501, 31114, 57287, 65957, 37421, 282, 3229, 1973, 20046,
+    67124, 11635, 48172, 5155, 38656, 53245, 2615, 80, 13180, 35558, 810, 10094, 53006, 26441, 53280, 12031,
+    51301, 64530, 27366, 50558, 33890, 40246, 14786, 50731, 36082, 62846, 57625, 38569, 47992, 10920, 25155, 7587,
+    22467, 26950, 14883, 22547, 35615, 56156, 28654, 33050, 24939, 33713, 34677, 51728, 14241, 16821, 8564, 33407,
+    23319, 25525, 63005, 18336, 11891, 33313, 8165, 29515, 21573, 21671, 43037, 56851, 9899, 66263, 34615, 64329,
+    13943, 23984, 66310, 40941, 47401, 55236, 54990, 70223, 24236, 33062, 63143, 3186, 3510, 2128, 3875, 32805,
+    22750, 5971, 31415, 63162, 51318, 68666, 35200, 55817, 59175, 47457, 60694, 28813, 2713, 31467, 6699, 43714,
+    60227, 23483, 35362, 30496, 28964, 1751, 57297, 7327, 607, 45713, 41010, 51076, 25761, 56212, 44134, 13832,
+    58030, 27435, 34950, 45736, 54154, 6356, 49125, 31783, 5211, 38828, 37927, 29509, 40830, 20076, 11910, 45644,
+    1387, 3216, 9150, 68881, 63863, 59602, 55310, 7028, 52153, 21834, 43839, 41221, 933, 44663, 44811, 19454,
+    36805, 38064, 43023, 4935, 489, 27598, 6766, 47369, 60235, 44878, 53942, 49014, 25657, 67527, 33618, 37693,
+    11575, 31768, 40199, 17393, 24315, 27549, 48265, 23957, 20154, 51322, 57329, 69759, 12588, 46506, 24277, 26555,
+    23115, 5441, 1738, 27043, 19330, 30129, 23246, 6455, 28910, 19074, 37544, 67274, 125, 42929, 27882, 21412,
+    41762, 58204, 67604, 52863, 66367, 44141, 59932, 28134, 39683, 17773, 1154, 64562, 4254, 20177, 38614, 66129,
+    8809, 24613, 41861, 56872, 43214, 26899, 46882, 57240, 43860, 61717, 42897, 60578, 56310, 62340, 33937, 41540,
+    15835, 33602, 51590, 16371, 42641, 28302, 34632, 41778, 7054, 43025, 69542, 51805, 21829, 45924, 62023, 48136,
+    20576, 47178, 63589, 59523, 42482, 1272, 58551, 12633, 68753, 5827, 43527, 49465, 62689, 39321, 12317, 24471,
+    43414, 66148, 5207, 36684, 29486, 2772, 57912, 722, 60269, 8367, 18371, 65718, 3503, 28720, 8695, 64929,
+    33957, 58489, 3226, 1256, 56344, 35463, 67552, 70097, 4464, 68890, 9268, 52745, 23310, 21904, 11367, 47614,
+    57092, 55273, 42884, 50472, 47406, 63332, 39827, 1802, 57047, 2219, 10358, 4399, 19421, 57823, 57236, 49959,
+    32573, 48788, 28701, 18034, 37180, 5274, 16589, 46913, 3284, 42796, 5056, 60627, 31619, 30440, 22430, 35925,
+    24680, 42513, 54493, 66528, 34255, 44194, 2107, 58635, 60644, 4580, 36325, 66174, 23042, 52453, 69565, 34450,
+    1231, 43432, 55674, 9362, 39398, 38353, 46690, 50916, 56340, 41886, 62459, 41968, 47956, 22059, 64166, 58003,
+    24626, 39014, 47311, 46745, 14102, 8775, 58666, 36025, 17465, 51518, 28889, 9508, 34903, 41034, 33554, 17142,
+    54302, 13437, 69481, 30155, 44144, 32381, 20839, 45187, 41197, 7400, 23629, 53817, 22187, 51236, 11766, 19918,
+    5753, 62743, 45606, 46202, 50914, 18115, 59188, 6869, 40781, 12521, 60214, 49602, 10199, 39222, 19567, 34494,
+    63831, 52142, 19857, 16478, 33974, 48416, 28457, 29608, 6195, 27483, 62892, 14297, 69468, 65922, 29207, 49796,
+    69554, 34665, 58523, 4226, 22231, 28020, 43613, 8284, 2880, 17701, 45900, 1036, 49677, 60503, 45858, 25567,
+    21841, 2346, 6799, 2692, 66891, 26040, 29437, 68916, 8758, 39314, 14834, 28176, 32820, 23907, 26210, 39280,
+    63659, 69815, 18443, 45970, 7552, 3316, 59792, 21980, 44990, 24513, 27156, 39343, 10465, 44189, 12867, 53277,
+    59689, 21822, 20925, 62223, 10538, 8674, 43852, 68399, 1019, 55230, 53558, 66534, 51804, 15730, 15858, 14429,
+    46679, 25742, 5334, 888, 20698, 44514, 3177, 59333, 12318, 42433, 3099, 67545, 32975, 33534, 7926, 2845,
+    40389, 63980, 20835, 39082, 25331, 56267, 48089, 46624, 12443, 70258, 70203, 30931, 36251, 30698, 18364, 43766,
+    66099, 19658, 30586, 39360, 41955, 59880, 14468, 52321, 2560, 41331, 31397, 1011, 55386, 18692, 25392, 42595,
+    28352, 4885, 48492, 56072, 40047, 31793, 10052, 1052, 26860, 23529, 31003, 17026, 25034, 19489, 60290, 6375,
+    63113, 41356, 28772, 18214, 63379, 65952, 64791, 45097, 5249, 22036, 45611, 61844, 65268, 31122, 23470, 45914,
+    52065, 23538, 47314, 11593, 55925, 33810, 28507, 161, 16814, 25014, 17021, 33760, 23642, 30267, 38085, 31865,
+    17015, 41340, 36938, 24059, 5994, 41248, 54419, 28709, 30244, 50127, 11544, 37173, 34456, 52291, 4595, 21008,
+    11995, 38409, 34418, 45712, 38647, 34360, 50660, 15162, 17401, 65004, 13595, 7690, 19758, 57424, 53251, 66519,
+    44640, 48606, 22533, 41674, 35874, 52956, 3711, 69708, 24385, 55891, 14516, 54628, 60155, 6465, 52443, 50454,
+    36437, 66080, 65079, 1960, 36625, 8074, 10815, 39388, 528, 35632, 40140, 31849, 45068, 25758, 23306, 33217,
+    19326, 37715, 2212, 39467, 38159, 22798, 31580, 65174, 4671, 39808, 58537, 59559, 44526, 70456, 64616, 65537,
+    11406, 35854, 37020, 14492, 33477, 66919, 67284, 51897, 61838, 17698, 41770, 68910, 65119, 3050, 18109, 56180,
+    67779, 10234, 68220, 52048, 68018, 21826, 33461, 60464, 45809, 68422, 32592, 8960, 44652, 9063, 56716, 53644,
+    5559, 68368, 53759, 28466, 65190, 47410, 30912, 35166, 49340, 28901, 63297, 20550, 61111, 49885, 62525, 66973,
+    8736, 62615, 50426, 16620, 25721, 32465, 36543, 14762, 61976, 29392, 33255, 7746, 56620, 21797, 54024, 36128,
+    58247, 17557, 7424, 21235, 50462, 15549, 68755, 16955, 17340, 5647, 60379, 31583, 62889, 48001, 55229, 13962,
+    64469, 42267, 10285, 21329, 31086, 20483, 4084, 4563, 64174, 25235, 68406, 25503, 58423, 60382, 36381, 68527,
+    4916, 24228, 66780, 7713, 66623, 11951, 30156, 38724, 7393, 61634, 20464, 17823, 7165, 37910, 11292, 32732,
+    56918, 30556, 48213, 24720, 39637, 5244, 40748, 13122, 13455, 11493, 11518, 38536, 2793, 59386, 28798, 17869,
+    1087, 46173, 32610, 62372, 68808, 4060, 8183, 31896, 25351, 21093, 30681, 52132, 68154, 56036, 10553, 36024,
+    43203, 16347, 7563, 17581, 4899, 37700, 52150, 18980, 61158, 60201, 64973, 52829, 40995, 35637, 51048, 47074,
+    29329, 2591, 60510, 56744, 9016, 54417, 9444, 25632, 56181, 61654, 31430, 16448, 23302, 59623, 43968, 21777,
+    63719, 25923, 66650, 57072, 11035, 8746, 21628, 4326, 39406, 40082, 16170, 54292, 55985, 14644, 61718, 352,
+    46597, 17642, 27773, 944, 50491, 29178, 53155, 15199, 46389, 17527, 26545, 40849, 10595, 1635, 26850, 28274,
+    69534, 11700, 69491, 15254, 59179, 46083, 938, 53027, 12555, 59438, 63752, 26699, 50465, 65147, 32514, 53283,
+    23424, 48398, 57294, 45684, 27807, 64624, 2529, 2584, 44873, 6448, 25877, 39525, 52932, 24711, 46263, 2999,
+    21216, 40374, 35539, 42543, 10098, 54446, 47455, 2879, 2902, 67177, 53951, 60679, 32577, 19995, 20232, 18173,
+    67283, 51681, 53075, 5201, 13671, 55865, 26080, 21369, 54271, 65492, 11742, 5877, 35695, 48247, 21657, 17514,
+    29172, 21678, 19176, 70064, 47514, 3768, 21976, 37418, 31050, 58378, 57401, 20652, 44752, 50044, 2012, 38296,
+    20134, 5358, 20954, 16622, 13763, 63003, 5685, 5899, 19403, 44452, 49289, 24165, 63151, 27504, 33203, 41781,
+    52052, 51867, 15202, 6925, 34161, 25646, 52579, 3147, 51944, 46530, 47323, 48040, 62283, 39672, 11844, 66562,
+    39144, 41531, 35749, 57407, 8372, 11505, 54376, 38172, 62229, 12763, 35531, 38460, 52230, 17492, 46619, 29136,
+    2743, 47079, 30870, 8112, 3228, 32788, 64297, 53411, 44476, 58675, 69169, 52462, 65102, 4154, 45027, 39446,
+    1002, 18707, 27273, 60414, 50493, 68192, 12076, 49011, 70426, 39043, 25471, 32526, 2986, 60651, 65354, 21805,
+    45683, 64489, 29738, 16609, 39769, 17530, 22462, 36580, 67728, 68109, 19713, 50243, 31372, 63851, 45678, 29924,
+    59226, 68783, 50793, 34417, 25142, 37546, 28802, 49443, 9219, 47947, 31229, 6819, 61323, 1058, 41755, 61437,
+    64452, 33166, 61871, 56239, 59028, 57915, 51765, 52748, 68825, 60184, 5627, 67725, 52807, 38008, 42544, 61391,
+    20149, 36765, 43067, 52939, 12811, 36011, 16477, 58227, 49592, 26132, 24839, 52647, 9715, 25048, 21472, 61079,
+    52916, 29719, 35796, 29822, 19877, 39629, 43108, 344, 15354, 53977, 50589, 15242, 52550, 40918, 21263, 5648,
+    63277, 3690, 59599, 39611, 55910, 64612, 8528, 31433, 10862, 51464, 23035, 30055, 4109, 68889, 70323, 24787,
+    14977, 42197, 3814, 48246, 4897, 19161, 36240, 31557, 30641, 17652, 10657, 29208, 57920, 66352, 21864, 54409,
+    41088, 68022, 48718, 18031, 60948, 33315, 14822, 37838, 37547, 35677, 32073, 6003, 12082, 41635, 14490, 10486,
+    44949, 4687, 69591, 66766, 38834, 46592, 57045, 9471, 70391, 3753, 55974, 52270, 46523, 58444, 33852, 27946,
+    7604, 68605, 21599, 58913, 67505, 18854, 54435, 10137, 7891, 14695, 62830, 18535, 55461, 66856, 42845, 45873,
+    39481, 28616, 59777, 3683, 33899, 37712, 31171, 17702, 2878, 21626, 11155, 12253, 59680, 910, 54918, 36223,
+    51398, 27747, 68734, 15293, 27280, 57922, 67525, 68333, 56387, 15616, 40223, 8733, 33752, 59928, 13928, 12388,
+    64532, 34340, 25075, 571, 42068, 1596, 54232, 61678, 53669, 32688, 34648, 6283, 28137, 53190, 13291, 51496,
+    67223, 27454, 1599, 37950, 20649, 45126, 36475, 53697, 32468, 47346, 67702, 8222, 48732, 62506, 24988, 23356,
+    12596, 43927, 1621, 37788, 66396, 15306, 48637, 2367, 9041, 1402, 37205, 34488, 45996, 50012, 31912, 4365,
+    11231, 57507, 19765, 35973, 31967, 30029, 32229, 12467, 28631, 3565, 38088, 21658, 32699, 56967, 63681, 4092,
+    68279, 31251, 59367, 21136, 22976, 64337, 49090, 1081, 54036, 2665, 22046, 18627, 7693, 52860, 18569, 3608,
+    61459, 8032, 26143, 3939, 19054, 64123, 70261, 54200, 20643, 43545, 57549, 38164, 26570, 57592, 26729, 24864,
+    56296, 1497, 47105, 19225, 25196, 24634, 67968, 55157, 52341, 22684, 31721, 39086, 62879, 60477, 63429, 59557,
+    55605, 30618, 18824, 37847, 66758, 42765, 2446, 18738, 7290, 1031, 58026, 21051, 10279, 22589, 30322, 25944,
+    27028, 21241, 42795, 14500, 69528, 21436, 5909, 52178, 7510, 58598, 69093, 27780, 67423, 54046, 17679, 29078,
+    8803, 25651, 12799, 65180, 67056, 35738, 24735, 62856, 20824, 5269, 9303, 54354, 66825, 61386, 18963, 53997,
+    64183, 996, 38171, 64457, 66278, 64915, 70242, 68984, 18945, 38718, 13563, 19940, 21774, 59677, 27128, 39944,
+    41052, 4440, 22342, 66614, 29218, 480, 44083, 58195, 30939, 26996, 39634, 37654, 20409, 66123, 55561, 39147,
+    44247, 39865, 20644, 8818, 18430, 18658, 6239, 52492, 65437, 14474, 50605, 45059, 30162, 21969, 50061, 32544,
+    7272, 59746, 51294, 65473, 4259, 43536, 61969, 31604, 7273, 68682, 38842, 42788, 37176, 27472, 57556, 16683,
+    20152, 34737, 45186, 54811, 52328, 33851, 2611, 29947, 23323, 54783, 59128, 18149, 38067, 31840, 36666, 15917,
+    30230, 11824, 28944, 12418, 60657, 50455, 36188, 34822, 47395, 16590, 58343, 54355, 7170, 35780, 24199, 61760,
+    1598, 32794, 26507, 35227, 60532, 10963, 27503, 33634, 35631, 1262, 63986, 61535, 1281, 57783, 55189, 62728,
+    15066, 52184, 65259, 50859, 40653, 41535, 26546, 24162, 26035, 9660, 1266, 48641, 52762, 55285, 13897, 17913,
+    63688, 8413, 25444, 17187, 37121, 28347, 29445, 32917, 27136, 35766, 5280, 32222, 31562, 27334, 56756, 43878,
+    10266, 32636, 35654, 49670, 20980, 18495, 41173, 67691, 58774, 67458, 24709, 1203, 6050, 47381, 65587, 58172,
+    53806, 38995, 26864, 39259, 28885, 28967, 52731, 51803, 16294, 16852, 32152, 2134, 47469, 43368, 33885, 12858,
+    19682, 7265, 48684, 10742, 33820, 52374, 49760, 33374, 19315, 43762, 14487, 12090, 34780, 43159, 66086, 43335,
+    69024, 58171, 38218, 17390, 14741, 2519, 19465, 12680, 14650, 21068, 48979, 16756, 53836, 68943, 32404, 531,
+    50176, 41142, 20564, 18636, 66226, 27813, 44184, 20814, 7015, 33485, 36688, 38861, 66727, 61874, 21143, 66416,
+    66332, 67194, 17792, 24779, 65646, 61542, 10678, 31427, 35484, 65620, 14403, 64468, 45782, 37444, 26171, 62844,
+    50745, 64999, 26399, 12802, 57914, 11512, 50946, 21862, 39393, 19115, 30248, 37766, 58775, 9614, 15365, 51337,
+    7715, 12602, 5681, 31830, 46926, 19239, 25326, 22902, 45846, 3150, 58461, 1180, 21290, 19173, 58144, 61051,
+    64691, 17367, 53873, 55897, 37078, 51751, 3993, 39426, 17911, 40837, 36438, 33739, 40074, 41247, 50655, 22731,
+    41238, 45109, 66910, 8351, 66339, 15801, 66456, 69956, 28308, 32472, 45895, 23180, 30559, 46734, 14666, 9804,
+    58095, 35224, 21724, 11648, 60334, 7342, 50375, 17278, 69614, 32335, 25709, 23485, 23347, 49018, 2508, 7325,
+    53700, 1806, 33191, 16541, 69357, 44869, 19645, 36336, 29656, 21661, 31052, 35210, 34099, 10419, 10045, 39497,
+    55064, 59313, 23441, 14510, 64544, 28515, 15562, 7889, 65945, 19999, 30009, 37036, 31314, 1547, 61347, 16213,
+    6101, 17481, 51158, 62670, 35760, 27981, 8255, 23685, 60764, 33763, 31494, 36066, 49678, 47175, 697, 23232,
+    22587, 41564, 55502, 10096, 8113, 29192, 37374, 9231, 34655, 11818, 40165, 40566, 10598, 69240, 26938, 34185,
+    49366, 29874, 53947, 30577, 6423, 3538, 44734, 20852, 31094, 68204, 3427, 19238, 41329, 58393, 65838, 32345,
+    19484, 23625, 64805, 29501, 8602, 48597, 19739, 20109, 39499, 9904, 26613, 1327, 37012, 67778, 19988, 28023,
+    56717, 54093, 36208, 49530, 35111, 4258, 1009, 55158, 40893, 12701, 23211, 12976, 20750, 10423, 14427, 33625,
+    30228, 32527, 4355, 1202, 11053, 52876, 10607, 49614, 63663, 9400, 64781, 11615, 15608, 67053, 68826, 53835,
+    53718, 58904, 15432, 30860, 46557, 7593, 3260, 40979, 59780, 33768, 27915, 30712, 45180, 19300, 1247, 64232,
+    48991, 23077, 64677, 57160, 69323, 29008, 23675, 23256, 62120, 40066, 42265, 13825, 6012, 14612, 21077, 38220,
+    23798, 42159, 60650, 43908, 52159, 53204, 3428, 9533, 63676, 47607, 15347, 18560, 17934, 25750, 61932, 20855,
+    395, 55432, 4337, 40042, 25933, 16789, 23872, 11526, 46823, 66716, 59691, 9172, 6051, 15680, 69675, 16378,
+    61814, 61038, 7256, 14677, 58470, 20288, 254, 32296, 19267, 61578, 18616, 12912, 44305, 35253, 19685, 38826,
+    47754, 63911, 41799, 61265, 69646, 55774, 9027, 35818, 1979, 38875, 33935, 46443, 32300, 59446, 17804, 66915,
+    3994, 38639, 50027, 7545, 23269, 53017, 39363, 16167, 61705, 58729, 64880, 59163, 66141, 63797, 16368, 29493,
+    61669, 40032, 23296, 10586, 68097, 12160, 48305, 50782, 13513, 46516, 28496, 64055, 19437, 7844, 67785, 69238,
+    46157, 62158, 54663, 24275, 10036, 59588, 21736, 66793, 7230, 3012, 51216, 3867, 36930, 47412, 19141, 39477,
+    45024, 20088, 45889, 63173, 20080, 7717, 31124, 10914, 4498, 15998, 47935, 36731, 61257, 14379, 17538, 47817,
+    65938, 39707, 69228, 22654, 18691, 41990, 55644, 16246, 53911, 39402, 18605, 49426, 67213, 64795, 18660, 6141,
+    10085, 11787, 10047, 27359, 29282, 65530, 61312, 52152, 53387, 70371, 7107, 35142, 53423, 28554, 58828, 10540,
+    70299, 66738, 14839, 12753, 30851, 39322, 59955, 33775, 65141, 20113, 59874, 30397, 10971, 32437, 46152, 57932,
+    43508, 20416, 60744, 66471, 55677, 4429, 63521, 27, 53505, 35876, 62735, 6382, 68643, 65913, 32945, 63163,
+    4309, 59879, 28942, 13980, 44029, 50988, 40371, 15464, 29865, 27347, 38344, 33481, 1170, 20378, 53380, 39122,
+    20749, 42853, 33501, 49908, 6011, 34795, 65844, 51047, 4866, 2076, 4384, 15015, 6381, 49033, 11136, 49326,
+    54499, 45440, 11908, 34441, 12174, 19487, 44397, 70151, 5530, 53073, 23404, 61864, 9689, 65275, 52490, 64119,
+    26823, 49723, 40667, 68081, 55591, 41984, 999, 38158, 22204, 60869, 33816, 60390, 50942, 41351, 63588, 39870,
+    32368, 2294, 57768, 15167, 26920, 31627, 1014, 27258, 46474, 63653, 15810, 37408, 19797, 29846, 43169, 34842,
+    41801, 12759, 34836, 8062, 59857, 9845, 32760, 20173, 22560, 14368, 29091, 11418, 20057, 58259, 2590, 20936,
+    47199, 25541, 45696, 21293, 27697, 43695, 18414, 24762, 11105, 33216, 32316, 22235, 66506, 51285, 10182, 25220,
+    32752, 18374, 16977, 63549, 36567, 42334, 20289, 31987, 2009, 29895, 31512, 6266, 20250, 37386, 5432, 7239,
+    11284, 28212, 52685, 46340, 53001, 11669, 32390, 45780, 22157, 10794, 38885, 37704, 2570, 14766, 23578, 50668,
+    36034, 48640, 1622, 16698, 48569, 21986, 23596, 55073, 5245, 48314, 40070, 26747, 35060, 19523, 29403, 56613,
+    9275, 38048, 46860, 26389, 66288, 67973, 46299, 59748, 57624, 53246, 30550, 18693, 27535, 46268, 52839, 31631,
+    60805, 38428, 35026, 30173, 35469, 29917, 48156, 33087, 31975, 4200, 55028, 9413, 57896, 33947, 14390, 18335,
+    29470, 24085, 64651, 41330, 3224, 49643, 32459, 37957, 61854, 46795, 69429, 56610, 21718, 12008, 43814, 48385,
+    22113, 62299, 60543, 37902, 25582, 35101, 46082, 5651, 1927, 59488, 11178, 9496, 62079, 2581, 62174, 44355,
+    39720, 16706, 18994, 29016, 7876, 35273, 31692, 49451, 25198, 29066, 55235, 10160, 68412, 32769, 47896, 8664,
+    34745, 57504, 51414, 6301, 26263, 6519, 62731, 33027, 51008, 23217, 5077, 54812, 60809, 60481, 52197, 36607,
+    67624, 44379, 53260, 35787, 2605, 40953, 19780, 49229, 56708, 36910, 1104, 43079, 69913, 61787, 27496, 66247,
+    55972, 61089, 60248, 3188, 21443, 63947, 28343, 46264, 31877, 43520, 66912, 42579, 54222, 42160, 3917, 26854,
+    38788, 13446, 41560, 18402, 2486, 56968, 15581, 15839, 44833, 4609, 13502, 13418, 42742, 64223, 30086, 5072,
+    16900, 13167, 42837, 50913, 43805, 59513, 35241, 1627, 46223, 52686, 68740, 66972, 18413, 68362, 29278, 32289,
+    52726, 58035, 33627, 54366, 53, 60237, 1892, 22433, 35130, 57347, 2021, 24022, 19545, 26129, 60913, 51742,
+    34565, 43106, 54729, 11168, 56151, 45304, 30725, 59702, 53164, 53754, 43364, 56464, 30630, 48274, 21449, 48876,
+    37894, 20870, 30820, 65880, 48703, 48192, 38347, 68954, 48193, 56060, 46593, 60057, 63298, 24279, 37959, 58055,
+    54833, 10732, 61333, 2696, 1372, 63411, 66587, 55839, 68428, 47712, 20592, 5293, 50754, 30869, 26003, 66377,
+    3081, 42036, 56481, 23864, 54726, 8550, 25687, 11959, 27793, 2577, 49407, 69942, 67043, 49290, 12537, 15412,
+    2862, 17577, 4553, 48301, 45290, 50159, 31528, 6582, 3645, 55179, 38227, 11273, 57701, 52405, 42296, 14763,
+    3785, 65601, 2291, 58624, 67054, 27461, 1590, 64117, 5109, 38727, 42822, 30819, 3432, 26257, 11484, 59615,
+    34676, 32403, 17435, 30533, 32513, 35904, 38539, 50692, 28312, 19814, 15852, 21780, 35475, 7516, 23561, 57133,
+    54521, 56992, 37772, 4292, 34885, 13202, 12611, 57632, 10051, 53801, 34951, 40646, 65380, 29987, 40895, 67366,
+    42626, 21818, 53506, 22648, 12188, 69635, 52943, 5001, 13887, 65583, 48632, 30169, 30591, 46665, 28149, 63816,
+    50540, 39218, 40266, 57824, 51905, 8447, 58118, 55929, 51935, 61471, 51509, 65281, 16866, 10602, 4746, 49589,
+    29435, 54316, 22674, 51393, 42221, 28911, 65035, 52667, 19555, 4164, 36108, 30378, 59519, 9755, 35496, 70271,
+    6009, 39929, 28993, 30580, 39529, 19016, 33382, 62575, 40174, 70164, 43324, 30694, 4097, 51591, 9446, 22680,
+    37539, 64917, 35568, 41206, 36997, 40075, 21581, 27744, 66199, 66927, 42203, 6367, 14481, 44098, 50501, 7898,
+    48210, 45286, 12545, 19311, 40245, 11376, 57600, 13257, 45145, 17200, 19681, 13104, 41693, 31821, 20826, 36173,
+    16451, 43344, 53454, 32498, 22690, 9237, 5893, 16008, 57051, 42779, 45232, 39042, 26113, 10168, 47662, 33361,
+    15624, 43348, 45950, 68827, 41589, 62627, 22229, 57545, 4842, 52206, 15232, 2809, 1383, 43428, 24514, 43021,
+    1397, 18279, 45264, 41186, 38503, 8789, 18483, 55732, 43121, 14164, 34617, 58424, 42003, 62583, 61464, 61776,
+    19987, 38789, 4587, 9766, 55613, 50466, 38667, 31220, 28262, 55907, 64295, 57613, 62997, 7341, 59970, 61596,
+    66836, 31177, 35269, 65528, 54694, 22136, 51117, 37845, 24066, 39561, 56764, 37380, 50818, 50949, 11893, 16508,
+    66224, 62152, 18240, 52997, 5069, 51061, 9376, 48315, 38371, 69971, 19462, 36271, 32559, 11066, 22802, 51912,
+    19277, 56905, 18998, 28416, 58779, 40036, 63174, 983, 70343, 15724, 7965, 21054, 65455, 27321, 54555, 36280,
+    29361, 18753, 47813, 66450, 57974, 16801, 55161, 45631, 60169, 26434, 56574, 48497, 68049, 53874, 29336, 51852,
+    13308, 14349, 70142, 46574, 4005, 70499, 23604, 43341, 66094, 37574, 54462, 25807, 47262, 63434, 36944, 6338,
+    65715, 23673, 27302, 3868, 3371, 54343, 64271, 7382, 65526, 38777, 41101, 4782, 7227, 42412, 31280, 47224,
+    4700, 45267, 52740, 16488, 59032, 152, 55369, 18962, 3861, 35638, 38396, 66442, 34046, 6160, 60027, 23916,
+    66659, 51951, 38817, 39215, 32417, 28042, 45297, 32735, 35353, 49647, 15627, 4136, 35391, 34877, 34020, 44671,
+    41745, 45009, 42049, 51780, 20, 49286, 67488, 14530, 70067, 5479, 58160, 12700, 55676, 53042, 67946, 361,
+    43381, 67580, 41532, 5968, 21340, 40668, 26486, 24741, 38476, 63082, 67287, 40408, 31694, 21936, 13288, 1864,
+    70318, 68106, 17159, 2622, 59660, 59499, 10016, 54613, 47739, 9180, 13718, 40887, 68446, 7634, 28191, 58010,
+    54974, 55061, 7731, 13225, 19056, 57220, 6027, 3006, 9555, 60990, 70117, 3940, 61046, 30658, 40857, 22511,
+    24068, 32488, 36917, 43498, 46085, 17369, 20331, 14966, 46918, 70440, 11048, 18769, 56421, 38248, 8432, 34088,
+    13460, 14781, 5841, 2750, 61057, 62071, 36078, 18669, 27307, 7913, 39317, 66888, 68299, 18074, 11569, 4315,
+    320, 67893, 5875, 21770, 2108, 7833, 66895, 43262, 30576, 27378, 39966, 23166, 68705, 45239, 47622, 9226,
+    25715, 64815, 57590, 69749, 56070, 31421, 55127, 22899, 45005, 56915, 61688, 12746, 43288, 12726, 65994, 35881,
+    5063, 41710, 6013, 59564, 53919, 42429, 12432, 24319, 54099, 42181, 17116, 3101, 33204, 9368, 46812, 39512,
+    6566, 5718, 6324, 59539, 66203, 42902, 54378, 68317, 49094, 9243, 39429, 27400, 69822, 49309, 3834, 45411,
+    19911, 59661, 28847, 66312, 15229, 22217, 42459, 58269, 22634, 6743, 46261, 3329, 6019, 65188, 30678, 8359,
+    8723, 62641, 61518, 20166, 7791, 4898, 16217, 50694, 29562, 58445, 58527, 1889, 69269, 33040, 46161, 5804,
+    28360, 24527, 42816, 41292, 50269, 9383, 36890, 68341, 55199, 30765, 23131, 7639, 39498, 21668, 37548, 10020,
+    66215, 16021, 23637, 57786, 50241, 47939, 1714, 19511, 1782, 44685, 17740, 64937, 39897, 7864, 53421, 24427,
+    37439, 20818, 47215, 44375, 8172, 64817, 66770, 15563, 65914, 40607, 23648, 2834, 40627, 70274, 15621, 64808,
+    59601, 58088, 39657, 43187, 56500, 7578, 29748, 21387, 54594, 5411, 55147, 49817, 58114, 45200, 69720, 3045,
+    13723, 58180, 50439, 44539, 42569, 7332, 7150, 21063, 30434, 3424, 41937, 20845, 62063, 48864, 55166, 46716,
+    33585, 10148, 63790, 64636, 186, 13801, 51106, 47463, 62154, 8718, 10206, 45861, 39593, 52002, 18330, 49650,
+    46509, 63191, 63326, 64708, 11374, 47233, 53555, 41008, 51570, 48612, 16570, 58197, 35748, 66230, 34820, 68174,
+    14877, 69028, 50792, 23058, 8534, 61234, 3343, 30944, 52862, 384, 7755, 57021, 7608, 1062, 65047, 24876,
+    4780, 3607, 29161, 36834, 20510, 11652, 1365, 24915, 24977, 45421, 66840, 49121, 1396, 4638, 2558, 69425,
+    56760, 6271, 17768, 67949, 62130, 52106, 39883, 474, 67811, 52093, 44060, 29781, 69008, 56770, 62337, 66655,
+    1209, 49571, 62135, 11417, 48045, 31377, 35107, 17969, 64825, 26669, 69460, 58644, 26393, 51412, 35466, 53023,
+    37666, 4393, 59690, 50307, 62370, 32035, 63516, 69023, 70168, 31881, 18133, 53293, 63820, 9891, 57808, 26250,
+    6292, 57417, 33102, 40097, 37506, 1171, 24405, 63134, 29642, 17972, 18153, 42496, 8268, 49080, 42716, 48216,
+    33058, 70315, 60432, 25562, 25707, 13469, 68867, 26449, 68253, 28254, 26358, 61198, 63382, 37303, 6763, 18837,
+    36631, 42606, 56845, 25146, 28623, 68832, 22190, 12990, 56984, 948, 20571, 46064, 1028, 54697, 57061, 30738,
+    8875, 30305, 29887, 29751, 2946, 13726, 25316, 1423, 2748, 1432, 18814, 69612, 42152, 51173, 10533, 5027,
+    45246, 51325, 64185, 33112, 55335, 30659, 43694, 58427, 36747, 4095, 31067, 26313, 7105, 35717, 12256, 64841,
+    47828, 64742, 2381, 58558, 21579, 8580, 46559, 48521, 8118, 5763, 51224, 57090, 52528, 63828, 50890, 54335,
+    57893, 36353, 12924, 33164, 63933, 35701, 66744, 4031, 21456, 60888, 10221, 42364, 53830, 67391, 15962, 58059,
+    13216, 32992, 61566, 18080, 12697, 27284, 14808, 66950, 62226, 49969, 27740, 41684, 26704, 44013, 24253, 8675,
+    58062, 61423, 60001, 44786, 24810, 42228, 29569, 52451, 27682, 35906, 40114, 53337, 33992, 31662, 2580, 6192,
+    40682, 27838, 67591, 4816, 38061, 1860, 38447, 63198, 39468, 64072, 52380, 53774, 2919, 4045, 53165, 64993,
+    53139, 33136, 39844, 32324, 32489, 59054, 19067, 55571, 33518, 4618, 38550, 44384, 24187, 3454, 15201, 11205,
+    308, 41018, 52761, 48428, 62216, 15770, 62885, 61499, 29968, 2934, 26737, 28970, 68493, 5811, 48016, 5543,
+    48098, 20179, 44156, 67322, 64189, 16059, 45664, 33294, 57491, 34355, 52565, 66612, 28875, 62339, 55581, 8949,
+    31205, 53231, 42074, 68649, 30665, 2789, 10896, 13245, 12630, 43208, 57976, 56612, 62076, 31266, 17325, 15846,
+    14240, 33366, 70238, 66673, 69360, 10828, 52478, 64386, 1823, 30032, 10891, 41554, 54291, 52331, 48925, 15700,
+    45819, 10119, 14400, 51776, 55557, 8088, 62124, 42664, 38753, 34193, 16858, 36382, 40234, 1351, 54834, 3610,
+    68024, 5074, 37286, 8136, 4277, 62613, 56889, 66593, 21250, 16799, 57107, 63292, 2266, 51427, 60552, 37163,
+    49207, 34590, 42982, 65931, 63562, 60798, 9247, 58185, 68611, 17596, 18252, 28609, 12319, 11461, 45639, 37427,
+    30484, 54418, 51310, 68600, 8983, 69799, 31272, 46742, 43799, 40722, 6543, 28765, 4939, 68918, 59465, 32204,
+    9159, 43717, 34876, 59109, 23679, 37598, 5859, 22368, 30408, 41647, 4265, 23710, 32652, 63300, 25027, 30078,
+    28876, 22194, 32098, 37787, 17885, 15122, 29142, 69754, 53741, 67314, 64770, 3570, 13378, 1492, 58703, 37058,
+    63764, 32793, 60338, 47453, 24415, 8989, 44393, 52108, 11130, 20632, 1563, 48205, 69128, 64318, 10940, 36000,
+    53462, 5658, 60949, 50238, 13495, 25486, 47239, 36186, 59815, 65589, 19741, 15847, 42017, 3279, 51506, 53032,
+    23231, 33751, 46858, 12014, 43996, 10865, 23332, 70475, 57257, 63741, 29305, 57563, 65321, 67332, 12571, 9325,
+    4056, 56013, 40090, 15469, 57573, 43333, 61334, 9305, 19561, 45762, 28489, 11243, 41543, 19536, 33122, 35932,
+    29463, 3526, 21015, 26883, 53211, 25401, 1042, 2656, 69282, 50071, 64733, 32962, 32195, 65355, 29202, 32226,
+    16283, 54111, 13590, 53585, 45243, 32011, 41507, 31685, 51419, 35194, 23700, 11447, 15028, 48841, 7078, 12128,
+    19740, 48899, 67327, 67730, 31671, 65274, 6039, 35981, 11109, 1528, 67567, 17286, 6171, 28272, 34851, 47454,
+    844, 40935, 14875, 30261, 15577, 2263, 57282, 27492, 59521, 19441, 40551, 55298, 39146, 19125, 56757, 26488,
+    28175, 48817, 20799, 12503, 63759, 38711, 10460, 59046, 781, 10416, 4517, 44976, 23658, 47656, 48170, 8774,
+    42854, 50803, 42991, 54209, 57452, 22045, 63358, 6755, 22215, 13924, 22994, 10387, 61385, 9013, 42288, 53185,
+    44796, 37781, 67921, 51054, 15189, 52723, 22772, 29506, 6200, 67033, 23418, 24053, 26458, 69845, 27829, 51080,
+    48075, 52464, 65962, 30264, 12215, 64771, 32533, 29616, 60415, 68606, 57651, 43090, 35170, 64400, 7452, 61307,
+    22468, 20188, 30881, 13016, 6912, 44331, 32625, 40367, 35873, 30014, 15838, 3689, 68272, 48821, 64325, 20935,
+    33013, 42051, 19798, 1966, 23554, 34257, 26448, 64620, 21696, 45358, 19475, 56375, 2842, 41466, 6753, 35174,
+    67880, 45832, 23484, 48619, 12567, 65906, 41493, 16704, 31993, 28826, 44958, 31064, 46468, 15196, 58082, 46698,
+    30367, 29323, 44479, 6180, 14661, 9507, 4446, 49447, 12741, 58898, 32924, 48303, 28152, 37671, 8441, 17987,
+    41995, 64336, 2316, 7590, 34083, 39576, 29691, 3842, 31276, 31813, 13776, 43830, 17464, 61243, 36857, 3541,
+    28991, 2228, 20136, 25036, 38897, 60102, 19321, 20096, 37171, 65116, 9847, 23756, 16409, 6043, 66424, 20848,
+    37066, 28930, 7567, 33698, 52963, 21795, 26284, 62225, 833, 63767, 23925, 61826, 46736, 57506, 67118, 11065,
+    14604, 58542, 38359, 18711, 29332, 55317, 12148, 13429, 67363, 31844, 13802, 47835, 27239, 55551, 29990, 55650,
+    8953, 31255, 59015, 38888, 11397, 23840, 63096, 9811, 50781, 58203, 27385, 50768, 22891, 69372, 3233, 22737,
+    49564, 69144, 64330, 8757, 60743, 15551, 24352, 3250, 6732, 2948, 54377, 6078, 51574, 55592, 18111, 6523,
+    22075, 46738, 48306, 47962, 62812, 43010, 66299, 19186, 38009, 184, 13547, 463, 57722, 70003, 66563, 24205,
+    60294, 28279, 33635, 65557, 63260, 49688, 32133, 43098, 30549, 50691, 51006, 61441, 4004, 10621, 15570, 2594,
+    7657, 49739, 27053, 1164, 46998, 69795, 39394, 26457, 46016, 27830, 51832, 4611, 28226, 61703, 70103, 34891,
+    27183, 23508, 66408, 63522, 30636, 14033, 4546, 47017, 19735, 63213, 33312, 38797, 18110, 10446, 35740, 8731,
+    57899, 49704, 19191, 32119, 1681, 41537, 42260, 19522, 69686, 32953, 53233, 11431, 60109, 18570, 5589, 24866,
+    26735, 41624, 36991, 58281, 13947, 54350, 62655, 54681, 34769, 32302, 12679, 54351, 31545, 1615, 28519, 5762,
+    67128, 54327, 67758, 56641, 14686, 21150, 68027, 56988, 11474, 28062, 65426, 48834, 17093, 58166, 46725, 14314,
+    21292, 8678, 16887, 44559, 53900, 27429, 40447, 28659, 20161, 32107, 24990, 55315, 32585, 42832, 9591, 3395,
+    63083, 696, 15911, 70172, 70141, 12723, 4970, 47601, 68565, 29830, 4070, 321, 7007, 2655, 18320, 58895,
+    33143, 35425, 57386, 38565, 29628, 24713, 40662, 27980, 36316, 12501, 10502, 49934, 12175, 57723, 6427, 55450,
+    11427, 48195, 68512, 8004, 39857, 10859, 53868, 22536, 25754, 54465, 15648, 41377, 56404, 21418, 62379, 21988,
+    62799, 64205, 3318, 1257, 12313, 42093, 43567, 69704, 52586, 41824, 31448, 12896, 30886, 67628, 233, 11234,
+    68369, 15992, 29451, 29380, 5675, 47805, 17144, 29162, 46333, 55353, 68597, 45066, 46276, 33557, 68443, 25303,
+    38149, 35900, 65466, 67489, 61624, 13540, 33870, 63022, 41176, 29634, 30291, 56361, 28879, 10999, 51640, 55704,
+    53673, 10832, 2775, 27179, 46774, 68309, 31973, 22340, 67925, 69117, 47187, 57177, 36001, 1531, 40584, 36638,
+    30461, 32819, 376, 385, 5609, 23964, 9683, 55954, 744, 28491, 1127, 40860, 36709, 22029, 25641, 54205,
+    56179, 26997, 51746, 36590, 60715, 53182, 4230, 30539, 20493, 29114, 28296, 54957, 2960, 10701, 34952, 49244,
+    35203, 2724, 20495, 54639, 17548, 59177, 42762, 34509, 33496, 67519, 47767, 11588, 68636, 48824, 44745, 45360,
+    20221, 16547, 64859, 23841, 56866, 49902, 5296, 22269, 34333, 40354, 52687, 57387, 26352, 49912, 52482, 13105,
+    41390, 22277, 46225, 40501, 3382, 8738, 35847, 19089, 36120, 5425, 52721, 390, 4845, 22124, 68630, 63471,
+    23681, 60202, 62219, 64076, 26207, 17310, 14288, 56248, 70105, 42306, 66404, 4474, 19417, 12111, 48505, 5548,
+    29927, 67673, 13292, 60554, 59520, 25749, 10321, 46746, 59859, 68575, 59033, 8726, 7840, 14123, 50291, 61449,
+    40942, 42508, 836, 18055, 8844, 50610, 63539, 2031, 48096, 12917, 38584, 44770, 18958, 38844, 9641, 28892,
+    64729, 19413, 56819, 414, 17694, 48081, 30033, 35116, 45852, 674, 69558, 33571, 47177, 41217, 54934, 2051,
+    2700, 7095, 52599, 24356, 65943, 32418, 62614, 58591, 33575, 26173, 46845, 52798, 51327, 57457, 68352, 35089,
+    11499, 45717, 65929, 68134, 57422, 5882, 52269, 56423, 66217, 10728, 28834, 16022, 21466, 69518, 70138, 53864,
+    62192, 19699, 28625, 2895, 18351, 3269, 6277, 30989, 43404, 26199, 62105, 50880, 46869, 21393, 66043, 65820,
+    41642, 49702, 4003, 25801, 39449, 18804, 3474, 35193, 2635, 48893, 24157, 29991, 19453, 59503, 30834, 58205,
+    18788, 27748, 8987, 67275, 59810, 69784, 64241, 5981, 45131, 33334, 31929, 27538, 21455, 8540, 68171, 36146,
+    54708, 64908, 50711, 27101, 54284, 38621, 56712, 65107, 10746, 45632, 3267, 42829, 56441, 5482, 15027, 36411,
+    48465, 29413, 13161, 32402, 61474, 22364, 43316, 54497, 64351, 34859, 28400, 2737, 31343, 69545, 68146, 25992,
+    44206, 39935, 47756, 55241, 61182, 16583, 17259, 38738, 22657, 6846, 43488, 6131, 36405, 19543, 5561, 65731,
+    28450, 25187, 5955, 35098, 67883, 32482, 58060, 6102, 60339, 40451, 17376, 67034, 41777, 47873, 12890, 44251,
+    32693, 70467, 65998, 20301, 46105, 40615, 37511, 24311, 16679, 36531, 31478, 59191, 60742, 20737, 66817, 34706,
+    54290, 39154, 52024, 43543, 12817, 23417, 10863, 9709, 46822, 52709, 26892, 14515, 70335, 30138, 6937, 6758,
+    16010, 60771, 13302, 3023, 40978, 46612, 34794, 53595, 36839, 57508, 34352, 70077, 60839, 13902, 55602, 20676,
+    56473, 31713, 1969, 1584, 65645, 13968, 9949, 9394, 26176, 48214, 3400, 40626, 52162, 52016, 53542, 33783,
+    54645, 40833, 60609, 23808, 56954, 45546, 61466, 40545, 10543, 60130, 41001, 51450, 9853, 53045, 12184, 45178,
+    14113, 11424, 65023, 61821, 42894, 22952, 49171, 44228, 39801, 25809, 7093, 45355, 56906, 5536, 62950, 35220,
+    51717, 23146, 23122, 31244, 23506, 7216, 11737, 16678, 9457, 58848, 33857, 2899, 5307, 54872, 59409, 5195,
+    41734, 66557, 54310, 34014, 1338, 42097, 36205, 13449, 5095, 21050, 39854, 43174, 66958, 60800, 50841, 13462,
+    24412, 25313, 47633, 63181, 9955, 1053, 61197, 1605, 55156, 48771, 2125, 47033, 42126, 68175, 23674, 1871,
+    13187, 60183, 6347, 28851, 64179, 7203, 14315, 14605, 14911, 55764, 2490, 52185, 62388, 4051, 34442, 45818,
+    2244, 43032, 48148, 62134, 13530, 49428, 8382, 52027, 45510, 2315, 41408, 27561, 93, 61022, 59979, 3521,
+    22854, 62841, 18776, 22503, 61544, 6751, 67909, 45153, 64922, 22287, 57221, 13798, 40395, 23955, 65144, 63997,
+    54426, 7996, 52734, 32515, 2448, 24629, 64056, 12766, 53889, 5630, 16218, 18835, 20887, 69807, 29285, 22470,
+    10088, 68036, 24361, 16159, 29698, 16718, 8641, 25205, 65491, 35229, 29304, 5865, 29239, 34249, 16470, 174,
+    48063, 55694, 55648, 64676, 69444, 54037, 23941, 59106, 63376, 25299, 36472, 25733, 62206, 28626, 37590, 34465,
+    54722, 45165, 34716, 55252, 8245, 33520, 47423, 46531, 8060, 28526, 67795, 56123, 9318, 58165, 33597, 36320,
+    50272, 61388, 56553, 36915, 44161, 54797, 63957, 28725, 17241, 10454, 32470, 46319, 41051, 44080, 50891, 36377,
+    1844, 37459, 32261, 40058, 47944, 66373, 42793, 15025, 14569, 65433, 1988, 36239, 3687, 3706, 63323, 69852,
+    52979, 54598, 55528, 42416, 28567, 5290, 32237, 50373, 41996, 23806, 48772, 18221, 26745, 50033, 28078, 51934,
+    66666, 60332, 52306, 9784, 52871, 27533, 68433, 29766, 51961, 8583, 66667, 45647, 30640, 29564, 42999, 653,
+    49577, 1421, 43038, 13096, 42960, 43377, 28573, 13683, 24797, 61782, 850, 42216, 35411, 15021, 15344, 6074,
+    21903, 24248, 18174, 6080, 5772, 8050, 65240, 68128, 12033, 42705, 34280, 67849, 12773, 52560, 57712, 16333,
+    62448, 24100, 2011, 65308, 6371, 35128, 28845, 14554, 34025, 36366, 40279, 47899, 56496, 40905, 15861, 28351,
+    35956, 66144, 36924, 19564, 59157, 43699, 46923, 2897, 4167, 45020, 33577, 5631, 44221, 14432, 13692, 66480,
+    38993, 51575, 59656, 56292, 41880, 39396, 51267, 57568, 24242, 54188, 68944, 29166, 7681, 62471, 58843, 28981,
+    70046, 54843, 55352, 55530, 24123, 29856, 24817, 8626, 60803, 40728, 68950, 63593, 38935, 25748, 61112, 54408,
+    41468, 31163, 27150, 47705, 55631, 45061, 20736, 14424, 7776, 19914, 19573, 12324, 4557, 35867, 69735, 26698,
+    41669, 50415, 12060, 39771, 2147, 19550, 63978, 46314, 15060, 59362, 10335, 1144, 237, 33872, 58785, 6968,
+    50013, 51447, 2630, 56023, 34159, 70520, 12064, 8525, 3019, 69300, 64182, 37148, 18573, 15739, 24902, 41520,
+    9677, 23816, 16441, 16480, 45607, 21330, 44693, 33773, 42587, 47303, 6332, 69598, 52172, 51982, 32700, 39564,
+    16484, 19669, 64423, 51411, 58890, 38701, 16973, 62236, 23630, 11058, 14761, 69576, 23398, 35172, 36514, 34383,
+    24979, 62604, 36114, 9360, 41534, 5520, 55090, 5066, 28722, 4931, 60708, 53910, 13188, 50906, 44111, 38926,
+    57934, 68059, 14529, 57232, 1897, 38128, 35382, 58556, 69776, 8403, 20725, 25154, 54259, 32713, 11387, 21695,
+    29796, 50924, 62720, 69510, 63402, 57846, 20841, 49492, 33755, 6453, 34006, 1008, 29783, 28501, 47583, 9892,
+    37751, 52978, 12874, 32216, 2284, 23934, 39074, 31518, 60999, 28840, 34199, 38452, 64284, 27900, 60749, 18145,
+    70087, 70069, 49100, 5620, 6070, 34160, 53797, 41765, 40158, 57317, 41299, 62532, 25258, 42516, 16520, 43667,
+    7684, 6576, 37677, 20863, 66017, 55970, 51976, 26154, 65254, 40336, 13814, 27047, 56311, 59308, 41816, 11346,
+    47580, 806, 55321, 57411, 47745, 18841, 15756, 61088, 47038, 42039, 57058, 42120, 9265, 31364, 56985, 58886,
+    40616, 8931, 7301, 17292, 50873, 8688, 67258, 12119, 13827, 53255, 67510, 51962, 30988, 25876, 35502, 30384,
+    49747, 58872, 50960, 65310, 46445, 64131, 5903, 31312, 21440, 69055, 26982, 49563, 15540, 32041, 70004, 3771,
+    21413, 55184, 15470, 48649, 19910, 40804, 52084, 60321, 50112, 1450, 40645, 10084, 49546, 19506, 62391, 69030,
+    54853, 40232, 35073, 1637, 37023, 45682, 18243, 20367, 17658, 51324, 11477, 49116, 56369, 7490, 37088, 36413,
+    26969, 66584, 42593, 830, 8099, 34336, 13619, 58713, 17072, 27550, 22960, 34576, 43291, 62550, 19791, 4363,
+    36342, 19757, 59113, 25710, 47312, 56964, 14026, 48642, 11117, 36878, 54857, 8986, 6094, 7688, 68002, 62075,
+    11764, 63810, 43894, 7930, 49788, 9402, 17199, 29176, 1840, 41825, 20001, 22980, 30279, 10155, 53565, 52433,
+    50219, 19318, 15327, 21582, 62726, 37643, 52087, 24358, 61709, 55227, 66111, 66759, 23651, 7436, 43716, 14434,
+    600, 40697, 63240, 20311, 48629, 46132, 13148, 52821, 43589, 55478, 8240, 13797, 58820, 52990, 3632, 57483,
+    32985, 59621, 21532, 27686, 42582, 35583, 57885, 8800, 59181, 12870, 49784, 22835, 5854, 56822, 16401, 55580,
+    69483, 55109, 56103, 33214, 51995, 47839, 67824, 8086, 21057, 43358, 27933, 1441, 14328, 22232, 58514, 68294,
+    14439, 4025, 33657, 18525, 25505, 36491, 43772, 22304, 45783, 34750, 64752, 22703, 40103, 15622, 36215, 42279,
+    60834, 4223, 56971, 45338, 55366, 45767, 21669, 51221, 36722, 58677, 32584, 68750, 19983, 26225, 18286, 47438,
+    53116, 6416, 2208, 42258, 42387, 64855, 17748, 16025, 33119, 60215, 9663, 40888, 62828, 24422, 24077, 46653,
+    68838, 2543, 55338, 2369, 40485, 38661, 27046, 22228, 56846, 46964, 44343, 18596, 46012, 52505, 47037, 65407,
+    4366, 11220, 28846, 24879, 31282, 754, 33841, 4085, 53732, 69684, 1337, 57238, 21835, 39664, 30560, 2885,
+    15857, 68660, 24596, 43192, 13562, 69066, 33449, 38712, 12100, 36925, 40726, 12047, 59575, 27536, 52483, 72,
+    25467, 60970, 15784, 56516, 15123, 44748, 63907, 44283, 42597, 15403, 730, 28342, 15215, 10100, 32061, 12308,
+    24216, 47960, 12927, 34838, 63993, 63494, 53111, 47846, 69414, 29724, 14277, 34692, 70144, 44467, 67911, 26271,
+    58533, 46244, 21889, 29864, 3903, 10019, 6046, 28921, 19921, 3193, 50827, 37342, 8864, 43659, 39765, 3932,
+    9088, 62566, 14531, 48085, 68875, 1993, 48952, 4937, 68118, 11101, 16800, 56830, 69044, 2727, 5222, 42559,
+    51763, 36588, 42812, 58988, 16355, 11164, 45323, 3335, 40280, 35525, 9783, 53804, 39858, 60208, 29606, 56045,
+    33151, 67308, 43916, 25281, 10473, 35498, 41438, 49791, 824, 51830, 13112, 54519, 6624, 38648, 52182, 14634,
+    5942, 2176, 13972, 7120, 5941, 35861, 45294, 23523, 52333, 12779, 50395, 14150, 46629, 21807, 17897, 8505,
+    19471, 35035, 1389, 52010, 25650, 49949, 58406, 43422, 47158, 53752, 51038, 35410, 23672, 10447, 55684, 34293,
+    26481, 49488, 22527, 49062, 29130, 1698, 9839, 6695, 14755, 54924, 47701, 23677, 58847, 3362, 28430, 38644,
+    48554, 32303, 67518, 66989, 1930, 50340, 55299, 40502, 31628, 17289, 66268, 60091, 28987, 25696, 31947, 34424,
+    61419, 55072, 61099, 18385, 28146, 67562, 19595, 66020, 15794, 6653, 50521, 61060, 50007, 36748, 41712, 35008,
+    5356, 38023, 37089, 60894, 6245, 1765, 54709, 48907, 11301, 36967, 18400, 36996, 20619, 20391, 48266, 5283,
+    24505, 14365, 3729, 22803, 13301, 25626, 47337, 13420, 43430, 202, 32072, 57037, 4044, 40552, 21391, 57498,
+    25062, 3296, 35972, 6562, 16951, 17866, 39000, 42075, 49232, 58362, 35872, 54968, 1026, 18199, 47377, 9102,
+    32444, 41180, 47319, 6804, 58404, 67575, 1995, 58189, 45597, 54431, 52485, 43817, 47413, 31852, 10751, 27609,
+    6509, 35789, 4134, 25489, 57907, 65706, 14929, 32814, 44494, 39103, 31118, 56595, 39954, 37174, 13613, 18037,
+    62524, 17553, 61348, 62466, 66791, 40582, 12821, 13486, 42229, 10469, 22121, 7335, 61898, 12468, 23261, 23906,
+    41952, 55514, 38213, 64889, 9272, 48320, 52612, 17157, 55568, 50661, 8126, 59989, 43771, 57151, 59895, 45765,
+    27714, 65791, 43463, 48341, 17047, 1695, 68533, 14383, 69236, 13712, 29001, 59102, 5252, 7977, 40338, 13914,
+    28074, 41587, 5954, 56616, 50574, 11626, 19846, 41638, 1473, 15604, 32903, 7259, 21752, 49662, 41703, 13993,
+    18880, 8365, 59244, 45826, 47496, 2976, 45164, 5458, 11021, 47627, 45817, 52894, 14159, 61868, 50309, 50315,
+    36200, 32269, 33902, 62528, 68457, 43389, 18664, 68685, 57453, 24173, 58007, 26331, 18141, 29434, 23569, 35486,
+    5300, 31610, 33814, 45638, 68877, 1145, 63983, 17420, 30132, 43248, 46458, 52845, 55734, 35599, 11933, 24012,
+    41016, 60291, 6386, 21957, 15055, 39632, 31021, 47584, 58971, 68667, 25885, 57978, 68818, 26309, 56817, 32979,
+    5196, 33146, 48963, 7518, 20627, 65070, 39325, 58151, 27768, 11683, 39608, 50575, 16315, 64252, 40532, 59640,
+    40705, 19948, 35816, 67147, 32277, 21476, 4870, 50559, 65563, 24045, 20518, 9503, 65575, 70338, 45415, 36848,
+    35436, 4894, 4569, 46183, 30393, 29812, 37536, 18933, 48105, 1818, 33858, 56022, 37612, 3968, 2379, 50186,
+    28821, 27292, 14145, 18232, 64499, 29317, 25775, 49802, 59481, 26857, 49431, 28580, 10718, 10789, 19684, 27555,
+    2072, 39392, 40500, 57269, 27135, 45888, 19703, 42951, 65597, 38217, 29024, 67569, 61619, 35127, 69120, 1320,
+    14416, 33795, 33224, 8229, 47794, 33167, 53592, 10018, 66504, 3093, 2843, 7252, 49474, 65418, 50412, 31510,
+    46018, 14002, 9834, 40796, 21346, 52853, 16527, 33421, 29767, 13099, 1872, 11368, 64666, 62396, 45474, 68541,
+    67967, 66121, 49390, 35728, 59884, 47441, 22088, 69839, 30102, 13443, 67701, 14120, 27767, 14099, 47259, 41417,
+    26022, 10058, 22367, 40560, 23050, 66038, 398, 3699, 17709, 20063, 62080, 23598, 47977, 68206, 30733, 3055,
+    20335, 68426, 12074, 65595, 52472, 59116, 6783, 46546, 45260, 67875, 55027, 13036, 65759, 54346, 11784, 42156,
+    1169, 58303, 13889, 13823, 50952, 12983, 11218, 736, 62747, 43052, 59638, 20843, 26906, 59204, 17520, 30316,
+    20492, 32739, 21259, 25124, 33859, 53634, 388, 49188, 7528, 42169, 68939, 23986, 39794, 67050, 19749, 40940,
+    70263, 9356, 17512, 60868, 34774, 718, 52069, 62763, 54498, 64043, 57175, 6887, 49838, 51544, 32529, 57013,
+    34155, 1585, 34106, 4083, 59145, 44768, 24208, 42838, 30276, 36191, 36918, 20065, 21253, 64338, 29275, 12610,
+    38141, 70068, 21398, 20883, 70027, 49610, 8681, 62032, 1417, 58282, 47615, 24017, 46535, 46783, 51580, 42760,
+    49024, 69200, 18825, 16487, 70393, 15332, 38400, 15809, 5927, 53991, 11509, 15143, 47018, 67323, 67216, 39431,
+    9157, 61957, 61953, 45161, 12748, 42862, 2377, 48328, 57272, 726, 25861, 4841, 66138, 9073, 56312, 46588,
+    10130, 40774, 50783, 29466, 45292, 51546, 5485, 15213, 16066, 41338, 37491, 68616, 69960, 27276, 69409, 26499,
+    517, 35791, 38214, 46691, 28499, 26, 48344, 58709, 59103, 62095, 2421, 30662, 15418, 32621, 57197, 14179,
+    16648, 60181, 25459, 56284, 2857, 48564, 13049, 68188, 4729, 20919, 34081, 61851, 51871, 44009, 68699, 33644,
+    21607, 32157, 27338, 32556, 9830, 13541, 20317, 1570, 69398, 36445, 13023, 7109, 1847, 12179, 67708, 25111,
+    20971, 63606, 46899, 16389, 41578, 9465, 66218, 44483, 58920, 911, 18448, 58588, 15487, 15999, 45019, 20079,
+    28745, 38658, 7329, 29351, 23124, 62952, 38485, 34153, 61543, 53410, 53961, 34092, 12783, 44656, 31766, 32207,
+    50542, 54912, 36519, 6666, 61839, 27762, 42060, 9028, 83, 26962, 1093, 52609, 34075, 63528, 52456, 27790,
+    2287, 41437, 55616, 13855, 23902, 23785, 23586, 18530, 8930, 18398, 64886, 9631, 9282, 58009, 665, 37448,
+    44993, 48455, 30280, 11119, 62139, 40673, 34302, 30303, 17525, 38356, 18508, 57757, 32918, 40772, 25240, 40210,
+    19114, 62814, 54656, 9192, 13428, 25777, 28127, 24457, 11176, 33762, 31702, 27822, 34747, 6156, 65469, 522,
+    52622, 33401, 39528, 47906, 2518, 4356, 5562, 24856, 154, 47208, 12752, 68480, 20688, 12035, 44805, 49932,
+    46336, 33533, 15317, 66280, 67455, 60931, 59921, 69909, 8636, 56536, 62554, 53556, 43336, 47732, 58665, 25526,
+    23740, 55533, 39458, 33528, 69533, 12181, 6865, 29713, 24865, 17778, 37370, 47678, 26826, 45151, 38683, 69108,
+    5436, 21898, 66841, 7676, 50294, 46776, 2687, 14155, 45045, 66277, 57166, 52325, 47737, 31218, 11619, 14982,
+    24366, 3119, 7408, 62991, 31239, 68456, 44628, 54524, 12024, 57682, 24640, 27054, 11312, 11351, 53562, 4742,
+    11096, 25755, 27860, 9066, 53424, 23189, 51973, 35901, 29587, 57383, 61239, 25875, 61807, 20710, 28119, 3738,
+    59140, 12201, 56878, 46498, 5388, 58490, 60426, 52886, 43935, 62696, 12340, 50808, 57647, 25374, 58359, 62270,
+    24129, 32010, 402, 40672, 48011, 52971, 54320, 49991, 63821, 37108, 68684, 56672, 42898, 61276, 27207, 51882,
+    6667, 40011, 13204, 53896, 52595, 20802, 36331, 33061, 55980, 61317, 63416, 18399, 35040, 41876, 13069, 16132,
+    55496, 65044, 20122, 58797, 63706, 45312, 30994, 14984, 3671, 32849, 10109, 43658, 23765, 61947, 17887, 61133,
+    36792, 30300, 48104, 51110, 35616, 6415, 31858, 5583, 54399, 69212, 41920, 41894, 28608, 35567, 19969, 41879,
+    32578, 632, 63050, 36654, 43530, 32670, 57292, 46518, 36323, 36842, 69043, 12086, 18117, 23350, 69928, 34329,
+    17319, 26105, 33097, 51978, 57252, 38212, 37498, 9613, 47028, 53990, 60993, 18773, 16182, 42726, 4965, 11952,
+    61310, 10786, 44728, 48699, 32069, 28072, 605, 34298, 53938, 11729, 31254, 13416, 59956, 64944, 9100, 69222,
+    5291, 63923, 29801, 52577, 36675, 58989, 26135, 44286, 8230, 62400, 11564, 6229, 51482, 17124, 5390, 53958,
+    45013, 48561, 56844, 69270, 2290, 47265, 35548, 2770, 58968, 1833, 37362, 6984, 25860, 66880, 61961, 67638,
+    17453, 28596, 61681, 12042, 42772, 67261, 40445, 69448, 24190, 7583, 15791, 46902, 66371, 47759, 69751, 5162,
+    53031, 51476, 41204, 35033, 30069, 22964, 68642, 46228, 1126, 26158, 22360, 34902, 63398, 37276, 53715, 64610,
+    51615, 10485, 60350, 68938, 60891, 57801, 44037, 19513, 69259, 69828, 29868, 53461, 21954, 32382, 60384, 35727,
+    30314, 46929, 21256, 7986, 62853, 4940, 68173, 25149, 48593, 15110, 15634, 43788, 50621, 3240, 3675, 7394,
+    59579, 8806, 51358, 59991, 15759, 19064, 39749, 35870, 1218, 18506, 34272, 68074, 59114, 56230, 24989, 52638,
+    61710, 8378, 63637, 3241, 42652, 46842, 29981, 70226, 34664, 27825, 10844, 41440, 42167, 9913, 5993, 10898,
+    38818, 22764, 17250, 43367, 52750, 14359, 67044, 65570, 67020, 59678, 62209, 32096, 41988, 61427, 13488, 393,
+    36875, 35497, 45883, 14942, 55750, 30761, 53278, 69308, 23705, 11305, 39141, 24131, 50078, 817, 11087, 38768,
+    63410, 17431, 12018, 50677, 62903, 68112, 41460, 50609, 15642, 22155, 32878, 14696, 20779, 9722, 33729, 67693,
+    34107, 22294, 67201, 28647, 9988, 29181, 6081, 15985, 7473, 26762, 10511, 43350, 59036, 7655, 35431, 66897,
+    10563, 35443, 312, 66707, 16863, 36958, 69427, 20533, 10320, 54360, 42314, 50418, 44497, 52906, 53929, 51515,
+    21639, 5230, 10091, 32908, 9244, 70089, 29132, 53839, 45556, 57102, 32974, 61811, 29684, 34378, 10887, 53395,
+    31493, 31653, 40363, 13451, 5338, 3265, 9474, 52165, 69966, 54221, 25682, 70435, 51234, 34224, 13663, 49992,
+    53443, 39362, 33521, 25954, 5319, 19478, 69006, 55965, 18380, 40029, 61281, 13660, 21343, 68706, 45395, 42444,
+    7730, 31716, 29997, 23490, 49850, 4990, 37523, 33446, 8679, 14016, 10969, 51917, 64294, 35630, 29827, 4774,
+    18697, 59902, 55503, 19834, 33259, 24697, 6705, 38263, 17429, 60288, 1090, 64603, 64404, 39816, 43519, 52564,
+    11887, 37032, 7736, 23966, 17158, 43779, 29547, 9536, 43273, 39535, 26752, 45563, 1814, 44390, 25314, 18407,
+    23072, 59930, 39700, 40494, 27426, 47444, 66079, 149, 26224, 5451, 61433, 67352, 23669, 13473, 7048, 24968,
+    9583, 14728, 20764, 34392, 51207, 47865, 25068, 22411, 33887, 39770, 16543, 61975, 61689, 10183, 62090, 44956,
+    62115, 16012, 39622, 59075, 41326, 64645, 55220, 19605, 15046, 38406, 56438, 47498, 23572, 16615, 19137, 34770,
+    59684, 54436, 65746, 20442, 18967, 65999, 17410, 53364, 49735, 56263, 24559, 46093, 65221, 55411, 38902, 47153,
+    17618, 6104, 4196, 40825, 63699, 59600, 53117, 40278, 41723, 25936, 31383, 6257, 47356, 15834, 17995, 51472,
+    2571, 32717, 7853, 19101, 2335, 39698, 33438, 51005, 43237, 52268, 15375, 65588, 27573, 31371, 20983, 2292,
+    67380, 36224, 42464, 54774, 11111, 20800, 5692, 29494, 26579, 8972, 64697, 25147, 65669, 15641, 37132, 64705,
+    51700, 46249, 14756, 17770, 65555, 24803, 40411, 41464, 52354, 27737, 70044, 48930, 3373, 15871, 8611, 36168,
+    8223, 63187, 68403, 61472, 55489, 61745, 34343, 7294, 44409, 48143, 50662, 33094, 6026, 46688, 6735, 56555,
+    40851, 18142, 52447, 41284, 19095, 21751, 45457, 13668, 21667, 38300, 17147, 51672, 63785, 8453, 31923, 66946,
+    8481, 55598, 24437, 15380, 66429, 14921, 61222, 29590, 52889, 52480, 20248, 66035, 47347, 39767, 33665, 15836,
+    63736, 56607, 42083, 65870, 25502, 29476, 46808, 16761, 22947, 7089, 48080, 15461, 50993, 55962, 25792, 38253,
+    54004, 14453, 46366, 21860, 27869, 48283, 12176, 23230, 7274, 40230, 47744, 8178, 446, 41785, 69289, 44367,
+    59978, 896, 44524, 21961, 65513, 47913, 5491, 19788, 309, 58554, 19826, 61393, 67984, 34034, 55082, 70429,
+    6962, 70364, 64242, 28117, 48202, 56163, 15684, 50087, 33913, 46133, 36632, 16842, 31607, 70129, 12012, 4727,
+    12969, 41671, 45289, 10638, 29741, 2890, 2388, 21642, 4994, 56766, 4835, 8616, 18683, 18903, 20681, 66264,
+    28394, 68181, 36237, 13030, 52123, 9123, 26851, 24813, 25294, 39623, 52859, 60019, 1836, 48762, 34735, 60117,
+    16014, 58469, 12605, 48615, 33514, 66200, 13608, 50728, 67137, 63781, 29308, 63635, 56305, 6658, 50196, 65794,
+    32666, 11618, 62948, 38541, 42018, 29203, 55716, 5928, 1286, 52104, 9288, 44737, 59304, 52521, 21316, 65253,
+    34310, 4351, 35771, 4947, 18919, 52545, 12219, 2639, 10125, 33348, 48093, 47068, 57617, 42639, 15763, 34269,
+    61627, 40513, 48775, 29303, 11816, 63182, 32327, 7505, 48669, 62716, 15486, 49863, 57327, 42599, 8735, 18936,
+    30415, 24564, 46647, 15146, 5796, 4649, 66451, 60210, 23392, 6007, 47605, 50211, 64039, 10147, 22341, 16064,
+    57630, 13648, 25107, 3935, 10353, 64664, 62773, 15478, 39536, 32853, 46309, 1475, 67382, 23762, 38822, 38328,
+    46976, 26270, 5644, 48966, 26813, 55671, 15105, 68340, 56965, 26462, 60451, 60178, 16542, 65176, 48897, 22318,
+    1865, 25227, 59200, 35731, 64353, 43560, 57739, 52455, 36367, 31681, 4801, 27506, 38843, 64569, 3580, 4693,
+    8098, 28737, 46819, 49728, 55667, 27416, 4957, 32322, 27055, 49975, 8840, 34234, 43966, 50791, 8819, 47565,
+    63215, 24790, 62572, 20807, 32464, 14392, 45925, 54873, 2904, 27676, 10396, 14266, 68150, 47390, 32040, 5725,
+    9148, 12108, 59953, 45194, 62419, 40595, 22789, 22734, 20201, 18893, 53615, 15270, 23736, 61502, 16724, 40558,
+    15769, 36801, 52445, 62541, 24592, 12193, 49566, 65834, 18539, 66870, 63019, 45740, 67538, 18158, 33091, 32605,
+    19944, 35597, 49073, 31644, 64459, 6536, 65464, 15933, 13863, 29417, 1388, 60571, 25267, 28518, 8120, 15925,
+    20058, 18721, 57966, 33796, 29609, 20401, 65266, 47668, 50214, 15526, 24323, 51120, 4358, 29938, 54933, 54389,
+    1068, 48946, 21461, 25315, 23531, 3979, 60436, 59832, 14458, 55117, 66032, 65223, 63357, 28275, 59794, 15701,
+    17416, 11567, 18845, 945, 5832, 41039, 48373, 52633, 27080, 11701, 50639, 31, 19597, 36274, 23549, 66315,
+    58901, 67770, 1741, 57115, 11263, 11313, 55044, 25138, 33970, 1433, 36444, 62381, 40714, 4601, 67932, 1430,
+    13838, 19745, 52233, 49562, 68947, 63771, 31340, 28371, 42325, 43615, 49097, 28052, 68727, 7002, 32694, 27665,
+    1381, 33506, 56855, 1385, 52957, 54814, 28806, 67470, 30094, 36629, 34789, 31880, 34540, 26970, 36255, 22508,
+    6843, 33836, 16438, 51385, 69343, 5707, 37214, 37075, 21840, 66412, 2477, 44263, 27499, 16445, 54084, 38484,
+    63711, 19390, 57466, 13406, 34960, 17876, 15984, 55438, 32422, 45789, 31552, 30701, 17421, 64789, 39155, 70036,
+    34145, 37166, 20905, 38860, 20805, 66282, 10110, 69910, 8068, 19320, 56078, 67296, 13840, 50697, 68692, 36962,
+    25485, 6635, 59907, 65508, 53014, 22792, 47546, 45972, 11408, 51522, 42205, 9877, 34221, 63896, 28492, 26145,
+    45265, 64831, 8848, 40405, 65410, 13607, 50005, 34226, 33726, 34621, 65488, 44824, 7828, 63616, 3537, 8177,
+    50972, 9825, 24727, 59044, 44838, 63502, 68182, 47932, 13323, 64804, 61633, 4046, 14837, 4284, 52147, 4640,
+    30136, 35853, 47219, 36701, 3422, 50941, 67267, 47430, 61166, 41978, 65101, 39757, 61001, 65744, 30982, 8016,
+    68873, 46787, 16878, 42564, 37348, 58587, 13586, 68558, 27523, 32972, 30191, 52121, 2014, 10005, 39821, 38620,
+    30579, 8720, 30344, 55049, 24418, 53015, 45093, 18892, 26175, 42470, 61223, 53323, 59735, 38307, 43274, 27153,
+    16255, 30716, 38713, 21912, 64113, 52135, 10026, 1436, 59933, 32029, 40760, 8494, 20363, 7786, 44168, 46188,
+    39596, 34240, 38419, 50713, 24287, 49020, 61900, 58550, 18395, 59693, 66678, 58802, 48725, 44586, 18102, 11799,
+    20559, 54803, 65856, 49660, 63739, 61299, 2852, 57105, 5487, 8331, 55137, 60163, 31769, 1335, 30628, 19884,
+    48616, 38380, 66847, 11860, 52960, 23915, 64473, 59587, 44272, 44125, 26439, 62725, 13459, 67062, 32622, 65763,
+    1350, 64014, 5277, 11475, 61101, 5812, 54898, 64359, 40780, 6374, 47589, 14182, 9841, 15677, 17811, 59652,
+    47203, 57792, 8805, 60890, 7877, 51677, 52242, 33424, 9124, 14281, 16321, 24568, 43862, 11638, 34696, 50584,
+    13672, 15029, 20873, 19520, 51825, 45359, 7379, 43571, 15873, 19383, 3533, 46743, 45558, 66453, 19633, 59288,
+    41219, 51881, 52891, 55782, 43355, 28199, 50848, 35975, 8751, 36570, 33848, 15343, 68159, 51498, 16883, 69451,
+    51687, 23912, 51547, 68821, 50637, 10014, 853, 42801, 48868, 9552, 18575, 56936, 3084, 55645, 48186, 26301,
+    23359, 41253, 44489, 55707, 47285, 44867, 31589, 37861, 7030, 7010, 2535, 26239, 29311, 37871, 19920, 55426,
+    24515, 10038, 14263, 68623, 42953, 67071, 45103, 59593, 31382, 15631, 11793, 64095, 67817, 60391, 19205, 62920,
+    46052, 52510, 47072, 46456, 27306, 37371, 49276, 20395, 34271, 51556, 43967, 39409, 66553, 54, 64244, 56638,
+    37037, 49079, 66030, 39903, 5404, 34754, 24386, 3878, 16116, 63839, 68784, 52072, 59070, 3569, 42277, 9212,
+    35329, 49659, 7396, 15141, 39092, 35311, 4011, 68765, 27577, 2194, 44789, 30867, 615, 39979, 63985, 66717,
+    52207, 48402, 62727, 5193, 46210, 18449, 35693, 9612, 24712, 33054, 64350, 13625, 10517, 39284, 52450, 17690,
+    22946, 26479, 58543, 43583, 28321, 66760, 32270, 8354, 23784, 57526, 41257, 14038, 50236, 62661, 68661, 51707,
+    64262, 10895, 21202, 28105, 61211, 37906, 16822, 37914, 55032, 39969, 64352, 12601, 33781, 48382, 57416, 42780,
+    65896, 61941, 49307, 66147, 17535, 19070, 54453, 54348, 38014, 21617, 15735, 30826, 34281, 159, 44780, 12796,
+    41902, 69376, 55497, 66878, 38975, 17511, 54352, 14237, 28833, 53128, 61635, 24126, 12231, 4505, 54293, 43275,
+    24103, 63868, 25017, 7654, 19970, 52416, 32896, 4010, 25382, 27864, 70221, 57806, 31885, 23501, 62761, 68004,
+    61940, 6757, 12502, 6256, 9380, 38114, 23102, 68342, 37475, 35775, 16491, 19687, 6784, 34220, 12316, 14641,
+    12628, 38076, 58724, 67870, 9233, 15717, 59878, 33503, 8928, 1331, 5131, 14994, 61047, 30520, 39882, 27895,
+    23476, 64159, 54723, 50263, 47934, 5318, 30345, 59380, 1588, 56484, 62156, 684, 10205, 38304, 45053, 45721,
+    56753, 21175, 41733, 62617, 63747, 50179, 52717, 3496, 27176, 59898, 17394, 63617, 38176, 16504, 2873, 18011,
+    45929, 816, 10927, 48169, 15144, 64568, 24918, 21170, 53805, 17950, 27912, 33133, 48109, 16884, 38601, 8321,
+    9156, 8291, 36973, 69602, 53371, 66391, 58293, 18577, 67660, 55132, 40457, 61738, 53340, 3926, 51023, 7008,
+    54393, 15729, 2816, 57111, 35951, 52308, 55745, 23517, 3703, 11383, 32200, 4149, 39877, 33368, 69480, 25179,
+    60333, 70366, 70522, 69596, 64542, 4162, 51378, 65100, 64161, 23387, 57650, 65060, 16991, 45842, 60494, 23125,
+    460, 60721, 54407, 25882, 47078, 591, 34637, 11616, 32711, 35663, 69714, 44858, 66867, 48700, 65246, 50106,
+    13438, 20739, 51918, 49523, 8971, 4423, 29326, 11446, 10860, 20678, 57300, 6033, 50483, 5347, 51893, 20778,
+    54187, 40126, 11131, 63595, 4335, 47716, 12957, 69977, 27974, 34530, 29707, 7122, 47150, 20276, 17568, 65776,
+    7969, 36699, 44122, 41522, 19087, 14962, 40037, 31187, 10151, 24886, 8021, 20095, 31784, 7685, 23850, 32433,
+    69697, 23985, 35934, 9441, 67125, 64784, 14493, 52138, 36362, 32538, 38429, 7477, 39212, 15126, 23831, 39896,
+    54904, 30391, 19980, 43635, 8771, 36836, 34954, 37889, 15592, 16560, 52539, 25033, 52061, 62642, 62327, 59083,
+    1244, 37045, 51916, 25424, 15919, 46013, 19590, 41174, 25887, 15870, 61644, 51508, 43792, 148, 1260, 67139,
+    36139, 46029, 3288, 28866, 10425, 46815, 47579, 49852, 65967, 17696, 7748, 11946, 63903, 53126, 42239, 30590,
+    48010, 57977, 26595, 30631, 39061, 67579, 50681, 39985, 2191, 49368, 29645, 38221, 52664, 65159, 2759, 27669,
+    25610, 13501, 25237, 59348, 67369, 8279, 27131, 14657, 15016, 23645, 51233, 25699, 14909, 21354, 16328, 46057,
+    28560, 49213, 62603, 34683, 51033, 22929, 27977, 63989, 44571, 7641, 44558, 28853, 10207, 8094, 55013, 19648,
+    47922, 6670, 8804, 13783, 43869, 60549, 54608, 25874, 8807, 26090, 7674, 40637, 23229, 43684, 20861, 27688,
+    47282, 54445, 32881, 43373, 31121, 27038, 24081, 6796, 25018, 21000, 19490, 21845, 20425, 17559, 11542, 50992,
+    25183, 20449, 12377, 53527, 14732, 67165, 20101, 21919, 11489, 21848, 2020, 30898, 21309, 35319, 41046, 1021,
+    35005, 25397, 30843, 70227, 15905, 63938, 19184, 28147, 69359, 25943, 18659, 25711, 26245, 41156, 60923, 40339,
+    39413, 54970, 17102, 28094, 70302, 41960, 50396, 51875, 5527, 10451, 35572, 30087, 5452, 11468, 20315, 9992,
+    6880, 29567, 22745, 14914, 46191, 62312, 37458, 25432, 48083, 65636, 23305, 44606, 42084, 41286, 25092, 37247,
+    32307, 25838, 39850, 69167, 53598, 56356, 57396, 40994, 47612, 18101, 1466, 48065, 61020, 43933, 41947, 65993,
+    39905, 59387, 4487, 30519, 25814, 33237, 26845, 17584, 31000, 13206, 27713, 8905, 52760, 40291, 11745, 2090,
+    50142, 9292, 37196, 5595, 62108, 69434, 62199, 27667, 42142, 21816, 14177, 50436, 39226, 66799, 61944, 51226,
+    63349, 6569, 41598, 8577, 12654, 8801, 18959, 25795, 21416, 8595, 50122, 56834, 10388, 47693, 66810, 4022,
+    47223, 57162, 65075, 14804, 12492, 28920, 2516, 21843, 2663, 30263, 7071, 38274, 48845, 7525, 15533, 48119,
+    54095, 28926, 22796, 1045, 60643, 17747, 54683, 33289, 42729, 8519, 5469, 25088, 19761, 23751, 7958, 13598,
+    22013, 25081, 30479, 4273, 23908, 14180, 8283, 62901, 1537, 48618, 36695, 10925, 36447, 54919, 16516, 17651,
+    26165, 39020, 47157, 486, 62857, 3912, 42739, 5522, 62560, 44947, 16454, 39125, 49820, 1012, 37351, 63872,
+    60473, 30660, 21435, 20958, 6045, 27580, 42535, 69227, 42557, 51953, 43347, 65024, 31773, 31842, 5513, 32722,
+    68820, 40768, 17766, 7471, 45764, 55695, 47201, 29124, 3896, 34435, 46317, 45361, 47854, 21606, 52869, 13931,
+    11871, 34809, 42139, 13431, 22239, 21750, 216, 67571, 15833, 54540, 45528, 23791, 68339, 61765, 57227, 50857,
+    51843, 47900, 56644, 65022, 4526, 27548, 29940, 69871, 26443, 34457, 49962, 33740, 58916, 66239, 54372, 44854,
+    60886, 3262, 6941, 63848, 28153, 20452, 60806, 50551, 54415, 4713, 58370, 189, 8642, 9348, 15128, 44632,
+    2730, 65989, 56210, 7309, 134, 14802, 50261, 10580, 59824, 28633, 53921, 37672, 52277, 34840, 41020, 31809,
+    32299, 54791, 45392, 29349, 11453, 10383, 19855, 18556, 3881, 5173, 24073, 5689, 57032, 16092, 62279, 16798,
+    59125, 46467, 19336, 67040, 1192, 43073, 17769, 40073, 6010, 24541, 48042, 2022, 11916, 58145, 32586, 44715,
+    37501, 18162, 52532, 7422, 37356, 35664, 27953, 28301, 56456, 49748, 20274, 20865, 2483, 23266, 46284, 12493,
+    65209, 42393, 9142, 8961, 25706, 31484, 35423, 57616, 28408, 7138, 22247, 66773, 67019, 48734, 33774, 63107,
+    23895, 37784, 65029, 36552, 64595, 31943, 28261, 43769, 55484, 354, 46186, 21533, 69089, 35373, 46919, 61798,
+    19521, 813, 47765, 68942, 39704, 54170, 52800, 1092, 6270, 55882, 44845, 4268, 48591, 44962, 20747, 48092,
+    14736, 48905, 14413, 22597, 8947, 46701, 44233, 35083, 20009, 8510, 56665, 2352, 5140, 36511, 59328, 22881,
+    56479, 53005, 35653, 45524, 38657, 40342, 1477, 8652, 4846, 43889, 40065, 55588, 15181, 16138, 48793, 39378,
+    17542, 17297, 5694, 52200, 52044, 27809, 70101, 10292, 23745, 32135, 49067, 39073, 9130, 13285, 47276, 11320,
+    53368, 60190, 47645, 40628, 45704, 69844, 20028, 44003, 41127, 62517, 10208, 61924, 44022, 18301, 4152, 28943,
+    56997, 35470, 34009, 28481, 13450, 44385, 65108, 12041, 39624, 37068, 67330, 48302, 10408, 10846, 46908, 69690,
+    12312, 41649, 21, 54229, 1763, 42958, 57512, 27942, 48863, 48379, 11114, 31637, 69404, 12482, 8586, 5463,
+    19652, 55825, 11190, 9259, 44706, 63964, 20637, 17466, 27443, 68402, 673, 20040, 39055, 50446, 17042, 19446,
+    62890, 37225, 24244, 54510, 37175, 49508, 54799, 37079, 27658, 19497, 50634, 55254, 33605, 51407, 50364, 23140,
+    10289, 43110, 40055, 64803, 38915, 50421, 27033, 21028, 57444, 65612, 43616, 30460, 22001, 24379, 45559, 26088,
+    48820, 2478, 45468, 20060, 702, 23560, 34238, 33651, 21400, 54208, 7484, 8561, 26569, 64618, 9572, 13386,
+    44646, 48853, 23073, 889, 42865, 60038, 27850, 18045, 54090, 68833, 31818, 40186, 45396, 12257, 31222, 48657,
+    9650, 4033, 10673, 17737, 53477, 52409, 64328, 57478, 7815, 62335, 35422, 70311, 7183, 44069, 6728, 33731,
+    19418, 51593, 65793, 14008, 14189, 13760, 59357, 55350, 64792, 21447, 40220, 50181, 24982, 3893, 37510, 53094,
+    8181, 47398, 62677, 26433, 49986, 10943, 39044, 62820, 25096, 53213, 43609, 49165, 45190, 31869, 66496, 18699,
+    22351, 13704, 19425, 33198, 44077, 68549, 5938, 18672, 36535, 62440, 59431, 49745, 33943, 16695, 41327, 52607,
+    45447, 56800, 57371, 5497, 48467, 55364, 12273, 66711, 41385, 49142, 28769, 10417, 65749, 44812, 19235, 7090,
+    47329, 56354, 18840, 69800, 14669, 66458, 22233, 54568, 43902, 37130, 49122, 44881, 56475, 32729, 51051, 18002,
+    38364, 38697, 48605, 62273, 8207, 48158, 50387, 38392, 19358, 59134, 13391, 42321, 30976, 55619, 59370, 47417,
+    16356, 28696, 53606, 18712, 13503, 19508, 14296, 60459, 62628, 65678, 47236, 70235, 45336, 3199, 1549, 23162,
+    41042, 70266, 22477, 37904, 10904, 26670, 31283, 43815, 7125, 34994, 46058, 57313, 429, 65327, 5622, 20286,
+    10319, 29553, 56199, 46720, 3285, 29158, 65758, 6557, 34142, 45056, 24948, 38606, 12882, 55403, 46681, 33242,
+    59225, 63015, 48499, 54658, 44725, 6400, 1190, 12255, 26768, 8565, 41318, 38399, 68032, 56240, 12751, 39395,
+    56759, 47733, 31980, 50629, 48890, 68732, 38562, 61899, 34188, 24406, 59762, 14140, 1901, 745, 26494, 42888,
+    52051, 64910, 38080, 22324, 24321, 21108, 16114, 56772, 34366, 57944, 67203, 35690, 36550, 47730, 31446, 59120,
+    8860, 36157, 40877, 1082, 12511, 52214, 38973, 58637, 62687, 27096, 29118, 35608, 25708, 67767, 24218, 28919,
+    31982, 62383, 39936, 61011, 66657, 40844, 12306, 64049, 66907, 57642, 13026, 19337, 39128, 66088, 31567, 30923,
+    29817, 21407, 50262, 29271, 11596, 55294, 16318, 69968, 17674, 8784, 9960, 7411, 11181, 57527, 11055, 41938,
+    51135, 21534, 37422, 42724, 16094, 5779, 46231, 44254, 65016, 51693, 3597, 28762, 49480, 50549, 26244, 18882,
+    9670, 14648, 27565, 63427, 43781, 68842, 26146, 9657, 56876, 46799, 1980, 20554, 210, 56162, 32503, 26501,
+    772, 39254, 48910, 15087, 44983, 26769, 67104, 59143, 55866, 53221, 43114, 51220, 19589, 57703, 60411, 39957,
+    64890, 14320, 56745, 7795, 40050, 61103, 43542, 32499, 12706, 22567, 5117, 64726, 43181, 62767, 1759, 17308,
+    59988, 18284, 4603, 26196, 25863, 69163, 68152, 60448, 22591, 61797, 46648, 1167, 12861, 45550, 12866, 51111,
+    41706, 46826, 4987, 69406, 1380, 60495, 60104, 53446, 31088, 66559, 26371, 58426, 58209, 62811, 70509, 65382,
+    55736, 36525, 17824, 57316, 6447, 56940, 2061, 35221, 16823, 16007, 35642, 34687, 6717, 24857, 46766, 24667,
+    51983, 36521, 59814, 43213, 2106, 9759, 40676, 59246, 1340, 36652, 61342, 4437, 6914, 18819, 26259, 36585,
+    12806, 11774, 22135, 59785, 32198, 2468, 11441, 20531, 43619, 19557, 41120, 11183, 17544, 65031, 33197, 21742,
+    10870, 57519, 39982, 16503, 61939, 9168, 64402, 27423, 41109, 19965, 15528, 23060, 23426, 30895, 63614, 64574,
+    68372, 53142, 61825, 57009, 4851, 21265, 9392, 65216, 56728, 61732, 66652, 536, 37309, 1512, 33629, 2981,
+    9473, 63683, 6274, 65747, 743, 28260, 8090, 28390, 24683, 58840, 599, 20638, 53967, 29423, 50085, 35144,
+    63808, 4231, 66126, 65801, 30846, 69290, 66083, 17225, 32837, 25716, 56885, 56204, 3282, 38280, 63149, 58736,
+    7151, 5586, 35516, 63825, 47163, 4373, 13950, 29839, 45203, 70428, 50600, 19426, 62543, 28484, 1779, 56941,
+    31443, 7667, 65237, 26646, 13685, 48211, 6335, 53948, 22668, 14201, 8149, 22456, 49940, 3788, 25830, 58032,
+    24662, 31279, 69394, 44879, 41690, 51822, 8882, 65517, 35624, 33569, 36388, 62293, 44500, 19903, 16130, 4067,
+    38636, 38534, 15258, 51981, 61142, 3752, 32443, 46704, 22995, 38696, 14269, 23655, 10988, 67162, 9815, 39099,
+    25106, 56765, 54773, 32994, 49377, 47618, 35908, 18464, 55055, 21117, 6363, 26341, 38967, 8128, 64309, 69546,
+    37972, 46226, 9983, 67549, 29307, 45670, 48819, 56133, 41717, 26667, 67269, 26251, 65207, 42028, 44187, 52086,
+    5398, 34042, 50830, 22210, 50755, 24143, 5785, 52848, 57648, 54067, 64520, 11293, 14654, 60723, 64450, 56741,
+    25793, 69757, 69088, 16043, 9045, 45715, 65128, 48777, 28216, 44886, 20742, 59422, 48524, 50052, 42418, 21121,
+    61084, 34701, 10710, 46208, 30534, 33287, 70348, 52311, 34658, 40193, 13494, 53313, 35338, 47571, 67705, 47165,
+    24522, 1633, 12609, 68010, 30377, 57228, 3325, 45601, 40669, 42143, 45428, 27746, 5267, 58218, 48007, 19297,
+    22081, 43092, 37946, 47393, 27810, 61841, 62959, 29103, 43827, 8999, 50133, 28537, 41132, 19470, 14431, 55265,
+    61574, 59343, 57117, 18337, 21662, 65420, 2395, 32176, 68850, 47495, 35473, 29429, 68026, 36378, 46096, 12020,
+    49337, 58914, 16919, 55643, 21036, 194, 35487, 54349, 44136, 60756, 3160, 69455, 30181, 25117, 265, 25922,
+    58368, 23546, 24653, 5702, 63514, 54738, 31901, 19309, 36811, 32901, 5995, 13479, 52769, 8832, 35285, 26684,
+    7353, 34023, 59460, 12561, 18386, 23129, 60909, 20205, 66212, 1684, 32244, 42215, 60349, 3936, 10184, 20595,
+    654, 45197, 41807, 10978, 62358, 20991, 20974, 37355, 949, 49725, 43472, 27975, 22594, 12422, 37197, 6572,
+    15734, 52966, 66822, 3543, 43255, 60997, 25118, 3158, 63254, 28232, 4997, 25113, 50685, 27652, 700, 15804,
+    1404, 54851, 7229, 40071, 20374, 66, 10146, 2932, 3277, 16512, 61293, 53810, 1193, 62860, 6316, 24365,
+    64687, 15598, 45520, 21677, 5499, 49521, 43529, 57486, 58851, 42172, 45936, 26534, 59068, 58577, 5247, 56360,
+    58297, 40533, 58093, 29416, 69064, 68896, 57700, 37795, 59759, 2066, 57112, 20704, 8899, 34596, 65252, 21682,
+    31543, 69727, 36758, 21515, 30960, 20494, 9574, 36681, 42118, 59331, 61716, 5240, 6068, 49371, 28198, 44121,
+    53782, 11054, 33631, 67429, 13904, 6808, 42630, 11610, 25929, 2086, 32453, 37114, 61650, 5686, 69939, 62176,
+    285, 9644, 24917, 62332, 37863, 9753, 17228, 9057, 22659, 42476, 18609, 59339, 18426, 12104, 6854, 48720,
+    53560, 33658, 23395, 4491, 44517, 46876, 46298, 33160, 2798, 42488, 1729, 47029, 14720, 19158, 51413, 20302,
+    6749, 52439, 14267, 24599, 8884, 61303, 31622, 3825, 50883, 35598, 16638, 17541, 54021, 43103, 28066, 64395,
+    68920, 68982, 43521, 44711, 23468, 54542, 64083, 16163, 16752, 27449, 10424, 47320, 21655, 68664, 29018, 45887,
+    41602, 1128, 39652, 45112, 15094, 40004, 4383, 37181, 37010, 44311, 4288, 70402, 23032, 53674, 44658, 18350,
+    22564, 35687, 54689, 10235, 40601, 6414, 65339, 22223, 41645, 15423, 39839, 46185, 30077, 41999, 34483, 6409,
+    41433, 70028, 9185, 24639, 48526, 5341, 48461, 59696, 35383, 14361, 37713, 58942, 48626, 3880, 7343, 34828,
+    35958, 22905, 62121, 23422, 35798, 58748, 48754, 6330, 14967, 46512, 36948, 62910, 47125, 39185, 23067, 26407,
+    35563, 58031, 5371, 20140, 60596, 36650, 47512, 20507, 32486, 61415, 58638, 41859, 52534, 4519, 33467, 17212,
+    40421, 27129, 66077, 12815, 49113, 34375, 41878, 52681, 18985, 4901, 49192, 66820, 3472, 8710, 50717, 14985,
+    58432, 25994, 48009, 42734, 14126, 40685, 2032, 17055, 35945, 27124, 1907, 46827, 54416, 29911, 20675, 41341,
+    65134, 31036, 26818, 51160, 35290, 24360, 63007, 49040, 23703, 24760, 12656, 31678, 26492, 58400, 23248, 5142,
+    14671, 28329, 56546, 65531, 35913, 4536, 9832, 2554, 42204, 12051, 60579, 59397, 11835, 69863, 51384, 40731,
+    65155, 8939, 63931, 41188, 61102, 31252, 64046, 54133, 5828, 26968, 35478, 33158, 68654, 18920, 1251, 58794,
+    59643, 12436, 37835, 3457, 49672, 28856, 5416, 6602, 52421, 23278, 10227, 32485, 22783, 14401, 68510, 49522,
+    32935, 58845, 50486, 63697, 56376, 7088, 601, 53257, 7907, 35163, 14080, 70292, 66918, 47621, 9746, 17373,
+    44065, 45565, 24555, 26100, 11440, 50050, 24642, 62758, 16818, 36546, 30552, 15787, 4215, 23701, 3591, 7068,
+    9055, 63035, 44806, 67479, 11720, 67254, 10572, 34813, 12298, 24404, 16079, 9977, 1330, 66542, 49756, 48194,
+    9217, 42230, 27673, 50413, 6537, 33508, 36892, 14475, 17120, 2521, 28724, 4864, 64177, 17101, 57982, 17371,
+    54839, 21488, 21922, 7445, 17375, 36075, 42686, 39640, 70361, 52747, 54052, 28157, 45578, 30686, 50385, 28808,
+    21923, 43988, 52429, 22572, 29190, 37582, 65187, 60206, 58815, 56476, 48160, 29074, 27617, 59765, 66561, 34103,
+    48072, 67799, 14032, 69649, 20856, 41113, 41764, 8274, 21312, 36294, 33371, 40196, 45245, 31307, 48920, 9698,
+    16202, 38676, 66718, 59938, 67646, 52641, 55142, 57750, 33919, 64935, 40641, 32555, 22291, 28946, 31791, 18255,
+    44896, 20258, 22542, 33908, 13679, 66276, 17441, 25077, 52120, 4645, 9730, 70383, 20005, 28330, 50816, 32031,
+    2681, 26436, 44062, 12161, 59758, 15350, 40756, 12570, 1749, 51647, 57664, 181, 36649, 33904, 10762, 61546,
+    25158, 57898, 5665, 68228, 36690, 19696, 60520, 20760, 40052, 29369, 49787, 39487, 40988, 38920, 12662, 2829,
+    35774, 17138, 45837, 54246, 52412, 52697, 38811, 15963, 17307, 52131, 69538, 40583, 51431, 12476, 21556, 57766,
+    44550, 61407, 59624, 20881, 59563, 68857, 23446, 15884, 5200, 801, 57873, 16846, 52415, 20646, 56927, 70254,
+    6534, 59986, 12320, 26685, 51340, 44431, 39423, 49828, 6005, 33344, 63658, 23185, 32239, 57849, 19849, 3341,
+    45890, 40146, 28611, 64590, 49180, 10660, 63901, 40357, 20400, 67158, 26936, 61498, 9812, 46727, 6820, 18441,
+    17050, 36241, 13721, 13270, 24432, 6570, 21633, 41091, 21392, 41412, 59009, 1120, 51367, 8065, 56679, 59043,
+    35156, 2539, 5011, 64976, 794, 42127, 55554, 21033, 47257, 31564, 16277, 17069, 56087, 48548, 7686, 41518,
+    65474, 47041, 11687, 3636, 60935, 60317, 10785, 59434, 4667, 59174, 62380, 17316, 29747, 65735, 40015, 6368,
+    17140, 23391, 18292, 51084, 45870, 29133, 45862, 4984, 63779, 1219, 2872, 57805, 32332, 40453, 27595, 943,
+    21231, 60151, 14685, 34956, 25151, 43729, 26437, 5263, 22417, 32665, 57544, 54991, 53887, 5179, 57629, 1975,
+    29750, 19517, 6723, 7063, 23591, 29033, 28531, 65408, 22999, 27566, 27206, 1230, 4079, 7171, 30882, 30142,
+    12954, 14768, 19234, 20769, 10312, 68745, 29412, 48903, 36484, 34260, 55287, 3577, 41668, 63627, 45797, 2825,
+    63506, 59029, 53708, 65642, 50979, 3274, 45600, 49175, 13369, 50499, 3032, 48572, 66501, 66302, 34213, 54668,
+    27039, 22942, 50628, 12670, 422, 65667, 7556, 40059, 41178, 21469, 34439, 23040, 59808, 59067, 9606, 54574,
+    47550, 69555, 7427, 18960, 36105, 55672, 24018, 69963, 13759, 3376, 42309, 57627, 13053, 54072, 31137, 3331,
+    41838, 44126, 46607, 25622, 42467, 1816, 64759, 48217, 56557, 42388, 29678, 67596, 63742, 52387, 26134, 60154,
+    19579, 38532, 3860, 69122, 43625, 18890, 48412, 14052, 45894, 9948, 50844, 51719, 14884, 19701, 8309, 32609,
+    52796, 2670, 19298, 52508, 45548, 17422, 58130, 69058, 46852, 24139, 31030, 38558, 37687, 10273, 17587, 44819,
+    46868, 44762, 3782, 51826, 46232, 31385, 10354, 45763, 37600, 53702, 32344, 15808, 45048, 21298, 25511, 16221,
+    28007, 52782, 36769, 46414, 2575, 19512, 2116, 66498, 54063, 19808, 56837, 61672, 61906, 11541, 53458, 47154,
+    56909, 59958, 42319, 10941, 56216, 13410, 26360, 19912, 67637, 3497, 12913, 27433, 35880, 17298, 32651, 419,
+    21741, 453, 18794, 68295, 44404, 11582, 21622, 9059, 60801, 39387, 41491, 5661, 21931, 6299, 58113, 35278,
+    33687, 69955, 16665, 45493, 5362, 63841, 35557, 65584, 48118, 538, 51473, 68246, 43777, 33125, 16427, 27257,
+    52865, 18379, 825, 43216, 4009, 8342, 57598, 3321, 23340, 67183, 26356, 28600, 13101, 62019, 52670, 9605,
+    21714, 59905, 43302, 5304, 65730, 16848, 53748, 1516, 36867, 60965, 67726, 2620, 27137, 53307, 39112, 51353,
+    34311, 58179, 19065, 19510, 44931, 60779, 69397, 63214, 56446, 23346, 38351, 57056, 22461, 38994, 37126, 35439,
+    46322, 18826, 5852, 44169, 23331, 30769, 2710, 68304, 67917, 31034, 14656, 260, 8130, 30443, 13744, 46206,
+    61912, 33301, 56218, 9492, 24826, 27650, 9223, 8871, 26359, 22084, 31022, 1544, 31129, 32536, 68574, 30832,
+    39206, 35682, 48927, 50864, 21509, 48722, 10248, 11482, 46363, 70501, 61422, 20647, 18885, 42456, 13592, 10839,
+    24965, 10712, 45350, 7062, 23753, 56251, 66543, 63054, 5635, 25592, 48044, 50160, 65061, 46291, 35320, 14075,
+    20689, 9384, 42415, 10702, 5040, 12081, 39685, 12926, 57894, 15077, 26922, 597, 20067, 25725, 28001, 62077,
+    70175, 52015, 4657, 47534, 43989, 36264, 33239, 66031, 31746, 15888, 1005, 60802, 66705, 61329, 57514, 70427,
+    56139, 17760, 55059, 63056, 50016, 11943, 50550, 38516, 58566, 4552, 54896, 40024, 30067, 22990, 19996, 58485,
+    8250, 59504, 9404, 14139, 65891, 41054, 24620, 13294, 50722, 65573, 67225, 49811, 28365, 17166, 33509, 63862,
+    7558, 55715, 100, 16475, 52801, 13379, 55040, 12249, 59287, 9775, 46580, 52783, 37991, 20016, 53486, 65995,
+    19433, 34569, 36750, 16004, 62536, 36563, 22558, 47308, 28820, 45935, 29755, 56825, 11732, 8662, 6991, 16111,
+    12584, 16190, 50756, 29532, 40089, 32037, 67630, 20424, 68113, 66514, 45622, 28383, 17312, 10185, 16352, 66949,
+    30644, 835, 45814, 6985, 6680, 61835, 44622, 60252, 29400, 52890, 7565, 10264, 43932, 25590, 22262, 39277,
+    13087, 2835, 22931, 29648, 66630, 63148, 27215, 869, 63669, 34015, 65571, 67667, 26453, 50611, 33896, 66234,
+    21704, 50199, 33830, 64217, 50554, 17755, 18103, 30388, 17007, 32478, 23834, 47692, 65421, 846, 62589, 41309,
+    22924, 49601, 4642, 50138, 51798, 64088, 20945, 42107, 42737, 6917, 49411, 15010, 10482, 84, 61677, 52676,
+    2538, 25252, 39505, 26254, 33284, 55435, 41584, 38355, 54762, 18157, 55500, 6847, 31999, 19371, 21510, 15268,
+    43638, 33352, 68599, 39569, 28777, 48444, 15277, 23177, 37987, 43306, 56504, 46434, 48459, 55193, 66222, 53557,
+    30798, 9090, 29496, 52353, 20043, 24972, 43907, 54484, 69345, 51101, 23390, 53295, 6546, 18534, 53885, 16089,
+    23938, 37635, 69945, 4077, 7064, 16317, 16078, 53658, 42877, 30366, 36737, 62651, 48948, 70460, 29087, 25862,
+    34337, 17726, 30629, 15943, 60741, 3558, 1034, 26277, 19643, 48228, 26554, 57961, 21076, 49206, 41193, 12280,
+    30048, 26590, 38094, 39241, 46447, 1073, 53495, 1722, 43452, 68573, 53362, 53822, 62170, 1077, 23463, 20184,
+    37785, 15387, 20334, 61778, 56902, 33603, 30955, 32727, 47057, 17399, 37007, 59221, 38629, 13804, 13373, 44701,
+    19812, 50689, 36877, 14426, 45108, 47682, 7935, 37310, 50423, 33275, 23792, 62053, 43602, 57320, 48197, 61345,
+    22949, 45296, 26759, 62251, 11922, 45580, 43838, 55289, 51552, 40005, 48294, 64633, 12251, 6744, 60813, 64802,
+    36033, 21672, 31861, 39807, 47479, 958, 60309, 27672, 752, 45135, 32449, 5181, 12965, 37352, 64379, 53311,
+    36894, 49460, 45776, 8380, 33206, 19415, 7596, 34003, 3449, 13281, 31096, 68319, 995, 9748, 42186, 69721,
+    30326, 42455, 8920, 4013, 63238, 14857, 15304, 843, 14774, 9823, 69415, 31126, 54180, 16656, 25377, 39899,
+    61365, 50951, 465, 55336, 20866, 42292, 8959, 64555, 61439, 29568, 67572, 12458, 25409, 66916, 62915, 11886,
+    46733, 53483, 21257, 26760, 64335, 59187, 54798, 13340, 44982, 62030, 46753, 60600, 10667, 51708, 32125, 22143,
+    9426, 53980, 61948, 24455, 3203, 65660, 32079, 37728, 48832, 38685, 59432, 42605, 46487, 5695, 39424, 32142,
+    58155, 45183, 69230, 23434, 49882, 45258, 29624, 491, 15425, 37607, 50193, 57564, 28999, 30669, 29879, 40717,
+    24175, 19734, 35467, 35476, 25145, 21697, 45629, 26214, 36932, 13211, 60286, 16037, 21195, 46275, 24744, 38509,
+    38579, 32581, 43843, 29592, 42861, 1945, 63355, 19631, 19370, 59365, 57345, 19894, 7108, 130, 47023, 44092,
+    30610, 53638, 23084, 37423, 50141, 10721, 68716, 50400, 16692, 48643, 44474, 42956, 55356, 35610, 31655, 66742,
+    5874, 47327, 32343, 68926, 43065, 55225, 25126, 55735, 6561, 28677, 42883, 64257, 18910, 59854, 34385, 66494,
+    40613, 39139, 55263, 41915, 64842, 52900, 29054, 5431, 52007, 49345, 13988, 4904, 9565, 37005, 60066, 32554,
+    26417, 36682, 58473, 2927, 69181, 19867, 6472, 7613, 43664, 51379, 46422, 24562, 60002, 57780, 40185, 574,
+    48940, 65436, 2214, 28753, 19548, 20754, 32283, 396, 31529, 50974, 32060, 46751, 37558, 3003, 9369, 2975,
+    6304, 43100, 30993, 2006, 11524, 13551, 5272, 17105, 46548, 48449, 32350, 65427, 59553, 17002, 48974, 35184,
+    13254, 16113, 67560, 4686, 46207, 61827, 54410, 55349, 61135, 24919, 11353, 56222, 38130, 10626, 66171, 39266,
+    66336, 31752, 46423, 50752, 66286, 66531, 46239, 42281, 50425, 41541, 29097, 8296, 65657, 36464, 44243, 45718,
+    31267, 45409, 43101, 19249, 28002, 14737, 42086, 54083, 18706, 28209, 40963, 15186, 17728, 64557, 32293, 19664,
+    29044, 47887, 39345, 44429, 1652, 48443, 35865, 34904, 43473, 5690, 11677, 58751, 54527, 44923, 23496, 24612,
+    29364, 11444, 5346, 33647, 61749, 46562, 45356, 65868, 8158, 53903, 15854, 8290, 56715, 4184, 10365, 54875,
+    8798, 34192, 66675, 68912, 63943, 1923, 11794, 64472, 57040, 43081, 2837, 28923, 64090, 38481, 34468, 29638,
+    57284, 32832, 31123, 48862, 34074, 34076, 65826, 46780, 41559, 51403, 9030, 35869, 35489, 41616, 37837, 55710,
+    53168, 9129, 36532, 47342, 10929, 36572, 30779, 21791, 35231, 24924, 2153, 52059, 6279, 54476, 54344, 17610,
+    10856, 46452, 39246, 42395, 6083, 39075, 36463, 19467, 37234, 49534, 49149, 974, 44001, 4715, 19307, 34252,
+    23001, 31306, 17301, 56276, 4058, 27073, 25601, 54076, 60799, 49146, 60381, 4639, 65688, 32593, 40124, 65451,
+    5766, 63295, 36596, 10332, 1830, 61831, 56281, 11810, 3222, 48157, 13522, 65935, 20630, 23169, 56390, 14466,
+    66894, 61658, 35819, 29850, 14649, 16682, 16223, 37104, 33297, 10347, 58932, 41852, 58134, 70532, 65983, 35394,
+    39193, 42732, 3445, 41857, 23805, 56509, 56901, 54556, 8686, 45816, 54988, 7116, 40379, 12948, 60049, 6821,
+    17854, 48871, 2898, 64873, 69210, 15950, 48947, 27409, 32416, 53694, 28459, 10272, 26420, 4147, 45933, 3758,
+    39994, 11091, 9245, 40638, 4252, 36807, 24065, 3324, 68633, 55885, 24754, 8125, 26381, 26151, 23689, 11157,
+    14268, 40671, 10749, 45496, 25671, 8202, 52386, 66343, 53788, 32951, 56043, 45522, 13246, 29737, 50983, 15848,
+    68764, 54720, 56559, 51141, 54156, 51290, 17626, 27297, 69903, 2215, 55773, 61324, 61683, 4550, 32214, 68799,
+    44442, 30542, 29237, 51750, 70052, 2274, 51299, 46922, 1725, 5105, 929, 17712, 66962, 7995, 30109, 48539,
+    68454, 14895, 23249, 17675, 54272, 43621, 65021, 5260, 10631, 68310, 23781, 68795, 3456, 16036, 63378, 29554,
+    30217, 42502, 67060, 53971, 25598, 49017, 47667, 20281, 54337, 39941, 14568, 7283, 33667, 68100, 16578, 57462,
+    13478, 11856, 3054, 67665, 1571, 2617, 11454, 22443, 36582, 8824, 35300, 47240, 13427, 3120, 47415, 7037,
+    53096, 52208, 2361, 47093, 8536, 29604, 12491, 22538, 2299, 13652, 25999, 14778, 65670, 37944, 62087, 11028,
+    58918, 48472, 7843, 61030, 27816, 51899, 48882, 16616, 68230, 44336, 13654, 69758, 59074, 16531, 20668, 7951,
+    47690, 22491, 11436, 37831, 64517, 46565, 31856, 50161, 16530, 41230, 66255, 5484, 57540, 41795, 51729, 6946,
+    21018, 61842, 4747, 29706, 40869, 55686, 55546, 69653, 32988, 19603, 445, 6062, 6998, 40044, 43969, 36757,
+    60425, 45834, 49354, 40894, 33601, 534, 63648, 45557, 24858, 69724, 48427, 48458, 59941, 61647, 25886, 14433,
+    40227, 46375, 43633, 16713, 15904, 49427, 54996, 57612, 31665, 53666, 53791, 50467, 52763, 33884, 20206, 49716,
+    10361, 7050, 59766, 37550, 31167, 51965, 50045, 63639, 47102, 37764, 20310, 8598, 52232, 19601, 23583, 2628,
+    55343, 35357, 16450, 55488, 41956, 69310, 55515, 4170, 22633, 17551, 36426, 8445, 4934, 9470, 60187, 957,
+    7487, 25108, 26827, 51467, 12940, 69595, 63805, 12278, 20889, 61010, 27518, 60585, 64665, 48447, 51306, 59448,
+    58674, 29975, 25242, 26452, 61774, 8729, 1747, 61221, 58109, 42868, 42787, 53546, 36423, 67566, 10059, 50337,
+    52157, 38035, 66768, 21963, 50251, 69793, 42266, 50908, 57741, 37187, 45085, 5525, 51747, 59860, 24853, 52448,
+    50065, 31105, 10775, 33336, 17556, 4501, 69285, 54557, 6273, 3727, 23008, 44746, 29021, 55116, 34342, 66160,
+    7796, 6686, 69919, 22371, 21182, 39843, 13421, 21474, 65006, 35133, 39261, 47885, 51534, 57084, 60767, 23498,
+    70043, 41680, 34398, 48235, 20266, 52624, 68852, 56924, 18766, 69994, 8421, 63074, 17487, 25553, 5503, 12348,
+    17306, 38286, 24894, 64764, 52397, 3377, 49843, 37098, 27840, 41732, 49958, 50849, 3483, 1760, 15547, 8604,
+    21899, 56255, 59215, 47804, 5365, 59942, 2685, 44689, 58018, 45278, 23582, 58749, 68525, 57652, 35480, 54999,
+    69736, 65582, 36794, 39242, 25322, 9020, 49032, 23108, 9640, 68879, 9197, 37520, 33677, 56623, 58265, 14682,
+    42021, 18450, 50598, 5243, 30115, 43156, 66937, 68482, 58396, 8095, 60590, 19206, 45216, 49396, 28290, 48069,
+    57672, 38262, 64932, 34793, 10389, 10976, 21688, 3601, 5752, 26272, 43338, 64481, 38277, 14037, 52111, 55649,
+    16369, 68614, 19211, 3393, 6069, 1238, 11262, 34045, 22658, 41399, 48226, 16700, 45649, 19572, 6082, 39069,
+    62842, 39617, 10341, 54625, 40912, 59237, 57431, 6631, 34799, 61328, 62375, 68665, 25473, 61910, 5259, 24980,
+    2632, 38825, 36849, 60615, 18461, 64226, 51549, 53612, 12707, 43914, 44068, 4052, 25144, 33468, 22752, 9241,
+    17648, 2589, 43431, 55076, 16127, 5437, 59906, 30201, 11455, 49644, 68937, 51071, 36789, 68445, 14112, 31001,
+    10195, 932, 24087, 46402, 13044, 13589, 14448, 33725, 63503, 44825, 57141, 16276, 67231, 55632, 62474, 12247,
+    34526, 2276, 30949, 59527, 56853, 30919, 37135, 19179, 59165, 44941, 70329, 8976, 41371, 45787, 11790, 62061,
+    2679, 17014, 56738, 12209, 37668, 39778, 2162, 647, 51519, 59745, 61140, 20345, 14399, 49162, 16136, 2796,
+    25243, 61450, 5603, 7102, 24494, 43027, 69246, 49775, 21701, 19967, 50273, 998, 11992, 34697, 47559, 6344,
+    56896, 39228, 29546, 57069, 55726, 60536, 12095, 54301, 43832, 49887, 22091, 18590, 8374, 33633, 5839, 34515,
+    693, 7698, 2673, 45482, 22629, 59101, 11728, 42798, 39780, 48391, 42419, 15260, 39599, 65277, 26574, 16544,
+    44487, 69078, 41827, 9926, 68079, 44024, 142, 60991, 40077, 33917, 10935, 39880, 15149, 7992, 21002, 64128,
+    61227, 33842, 34292, 47238, 15376, 38776, 40886, 9520, 24333, 5787, 14625, 33996, 32451, 45605, 62012, 387,
+    44988, 40633, 55881, 66571, 27926, 52864, 14812, 26568, 53460, 34986, 915, 29711, 28771, 51920, 27831, 23024,
+    4372, 562, 3238, 54286, 15699, 54967, 57303, 45620, 33021, 61968, 56871, 67065, 54693, 54732, 65439, 4571,
+    6533, 57539, 63874, 39695, 19098, 10640, 48393, 65192, 19258, 61847, 52149, 53478, 15830, 53451, 58011, 40921,
+    14783, 51793, 2362, 30518, 8192, 24214, 59657, 14903, 54854, 559, 64243, 66620, 13164, 30237, 38001, 34368,
+    63570, 68389, 69613, 12795, 54311, 64594, 17848, 10810, 64184, 3162, 65336, 47352, 8503, 6487, 56289, 33413,
+    68977, 26527, 70092, 42899, 49473, 33207, 8480, 1059, 47971, 5422, 66601, 3254, 43485, 13919, 47222, 4914,
+    42407, 56721, 25217, 65112, 54523, 27083, 64388, 22819, 35952, 5732, 41314, 58499, 69164, 57769, 23913, 26832,
+    40908, 67174, 57202, 25367, 30363, 7189, 65127, 6529, 52540, 31099, 58649, 2259, 55176, 68385, 3651, 2365,
+    7221, 11731, 11919, 19974, 21543, 8666, 43468, 55992, 9314, 65719, 4065, 64894, 15748, 49051, 66939, 51259,
+    69639, 481, 59111, 50986, 63951, 33738, 66025, 45454, 2661, 22211, 9744, 62253, 15011, 68978, 13556, 69878,
+    42989, 28126, 32930, 22821, 6462, 31645, 4451, 62930, 20583, 55443, 12838, 473, 5929, 66271, 34463, 5184,
+    8753, 67671, 20901, 44969, 30070, 49834, 66341, 59247, 59131, 66428, 44985, 32822, 49982, 20730, 20546, 44455,
+    15510, 16850, 17529, 35522, 10790, 69616, 30394, 65445, 5046, 43199, 26204, 39397, 68099, 31018, 44979, 56314,
+    16687, 61773, 55170, 49631, 69989, 27651, 26666, 1982, 66142, 1415, 2650, 49953, 27118, 50022, 23255, 34028,
+    46904, 18100, 59240, 8156, 52887, 47022, 12059, 53515, 47071, 52936, 51372, 26295, 20530, 47229, 69408, 66896,
+    52005, 14378, 54114, 25740, 54869, 35812, 37152, 8077, 13201, 49030, 39716, 3921, 6086, 5413, 30859, 59582,
+    36549, 30583, 33009, 44052, 69382, 13010, 31777, 67913, 39519, 25507, 1559, 45658, 54971, 46303, 19099, 26160,
+    15960, 4190, 64157, 68622, 68012, 49783, 17629, 48859, 54917, 8901, 2868, 29575, 61168, 14577, 29855, 35088,
+    55134, 53418, 47070, 55727, 25648, 43677, 858, 62938, 44549, 17361, 63458, 31569, 14069, 11867, 52406, 2918,
+    45352, 1807, 19879, 65311, 11388, 51465, 678, 26075, 38243, 47104, 3345, 3532, 41163, 35252, 36635, 17134,
+    52023, 65535, 16196, 7208, 70059, 62151, 16088, 6563, 46388, 21189, 61889, 38496, 33460, 55075, 36864, 4706,
+    22160, 14725, 42968, 24090, 31200, 8275, 14419, 69864, 28513, 7874, 51316, 42174, 61754, 1283, 70296, 64751,
+    4559, 39353, 20908, 60857, 14628, 48680, 44903, 34653, 3705, 70155, 44908, 63040, 41750, 17236, 27704, 33791,
+    505, 63065, 19046, 20999, 59231, 29635, 62832, 27527, 55902, 53722, 58766, 56178, 18143, 55661, 24706, 1686,
+    48018, 51592, 53696, 50006, 14124, 42964, 31566, 14031, 1451, 26548, 21014, 30036, 61229, 54471, 52897, 23739,
+    42518, 6149, 55197, 43750, 40998, 68653, 28269, 40313, 54684, 52938, 32870, 4877, 29744, 10617, 22063, 26934,
+    12272, 24570, 46991, 27193, 33971, 10784, 20795, 10161, 63604, 27742, 17579, 63094, 55026, 13047, 29939, 25539,
+    23106, 55088, 27899, 34654, 32520, 7753, 12881, 57113, 20037, 3390, 33264, 26916, 22986, 16533, 27862, 12155,
+    1812, 3863, 42674, 26639, 44611, 53394, 43535, 51500, 44093, 28106, 5677, 26073, 59675, 54923, 62058, 49803,
+    43606, 34781, 1265, 56979, 41986, 13706, 4981, 48269, 15305, 44314, 59555, 3620, 22900, 10848, 9452, 49214,
+    50789, 11904, 8052, 46906, 5229, 30235, 24280, 21232, 7646, 27985, 37072, 26362, 58434, 50683, 14898, 53969,
+    23709, 11705, 22390, 67682, 3153, 14926, 43323, 13465, 21656, 26426, 36019, 62323, 35967, 60046, 28742, 53174,
+    34327, 45094, 16019, 58737, 31483, 19503, 5305, 10217, 9850, 43334, 24848, 18262, 16376, 22978, 15310, 56243,
+    32773, 15718, 15623, 3366, 25373, 34635, 48221, 16080, 31290, 5331, 1546, 40002, 60678, 40948, 28551, 6639,
+    29418, 51908, 51170, 34173, 26131, 23670, 3000, 27060, 65479, 62101, 52833, 8038, 63965, 51483, 44240, 17414,
+    67288, 60973, 26701, 56393, 49840, 36981, 44911, 14789, 63649, 12037, 56543, 41855, 46354, 12626, 62838, 59556,
+    31508, 52578, 56784, 65831, 47699, 50922, 17843, 69682, 5593, 39563, 33594, 60081, 8417, 36117, 49089, 39669,
+    13895, 39412, 24174, 58976, 42892, 9849, 23901, 55211, 66089, 18278, 14888, 54823, 21571, 49708, 50839, 19149,
+    38438, 10187, 1288, 60703, 45981, 24535, 12845, 67891, 16332, 22361, 50137, 39575, 57758, 20050, 35457, 66386,
+    30495, 47011, 10286, 29086, 28252, 51025, 65152, 14203, 54276, 20212, 26326, 16969, 18368, 46722, 56470, 30021,
+    2279, 24986, 38857, 11920, 55296, 44163, 24030, 31918, 19882, 53291, 25724, 280, 62949, 70085, 51374, 24533,
+    49937, 39885, 62570, 57253, 35143, 40391, 39272, 39237, 21703, 64347, 43190, 26927, 28370, 7148, 41835, 50582,
+    70295, 33464, 57857, 4006, 17691, 49839, 31196, 39893, 39414, 70251, 39089, 58325, 55409, 40096, 24855, 29064,
+    26490, 42330, 49973, 32393, 17826, 54085, 30671, 58064, 48908, 59897, 53459, 33619, 10837, 33697, 65245, 67046,
+    24996, 33719, 2204, 58570, 33074, 27218, 18203, 68566, 4376, 20721, 23017, 67041, 42299, 796, 13741, 50285,
+    10531, 29611, 43810, 26384, 19817, 3189, 22605, 33961, 14310, 53893, 47696, 10685, 12038, 57159, 2586, 8554,
+    4455, 35765, 37707, 13519, 7308, 20326, 38964, 39338, 20261, 51477, 44900, 48480, 31125, 57394, 25247, 45220,
+    40983, 29528, 20336, 41918, 55060, 35877, 43732, 37640, 38950, 23566, 28255, 38735, 61877, 50905, 56122, 18482,
+    5913, 7754, 52151, 21448, 46878, 66257, 10092, 69135, 60648, 35512, 39245, 24957, 45685, 13826, 319, 3950,
+    46631, 39453, 45050, 51410, 21428, 12382, 46234, 19691, 30924, 23568, 38178, 25110, 62797, 28651, 69983, 26944,
+    367, 41802, 37387, 430, 6091, 36329, 69026, 46404, 6698, 15319, 32608, 60925, 38423, 66163, 44893, 10327,
+    64538, 26677, 65269, 23721, 7984, 61630, 29811, 26988, 32589, 37517, 1679, 3043, 5920, 64933, 45555, 40465,
+    48262, 7261, 39151, 17695, 11290, 23671, 63645, 55663, 41078, 48706, 24237, 56857, 53024, 42709, 44089, 51369,
+    55333, 12743, 36301, 18887, 69505, 4665, 38876, 8022, 26064, 33189, 31238, 47573, 19538, 60870, 10471, 29359,
+    18017, 1114, 4064, 15043, 69762, 51415, 64506, 17097, 26068, 6911, 68467, 60377, 28638, 36732, 58391, 55936,
+    13231, 69672, 52816, 55843, 42024, 29845, 25263, 9025, 38944, 35459, 56594, 49634, 46711, 35590, 54089, 35982,
+    3759, 4863, 62801, 27229, 69271, 55196, 1956, 43923, 64060, 43740, 12891, 53177, 49114, 20004, 39956, 9708,
+    11149, 39172, 51605, 67679, 59489, 9526, 6706, 39649, 11432, 23461, 23929, 67403, 69385, 37365, 40993, 26623,
+    55278, 21045, 18873, 20021, 25757, 43161, 26149, 30349, 7330, 552, 28028, 40803, 51034, 12098, 55376, 9051,
+    6539, 23188, 50708, 24899, 25535, 3581, 58038, 13989, 59005, 45406, 37792, 61141, 57210, 30762, 65509, 20772,
+    35435, 9278, 12782, 6057, 60028, 35094, 37206, 26111, 67869, 2324, 34232, 43906, 22173, 11099, 16340, 8995,
+    12489, 32883, 43001, 62902, 4919, 42827, 25996, 16310, 11460, 63598, 56611, 41472, 23174, 16050, 36056, 59281,
+    24398, 37315, 60861, 49707, 41471, 60392, 15966, 61951, 10534, 34054, 23003, 56705, 15721, 35186, 51759, 2740,
+    62955, 12421, 13631, 60133, 32094, 57839, 44119, 35392, 23408, 68743, 40510, 14001, 47654, 45824, 10623, 2088,
+    61853, 30847, 45398, 32818, 41288, 30001, 58924, 63324, 31825, 62934, 15657, 18748, 63618, 29637, 46997, 34788,
+    38529, 38602, 8683, 52846, 7837, 24955, 31460, 41275, 41964, 22044, 2933, 42291, 40750, 42261, 30614, 44112,
+    2563, 35550, 10152, 19352, 2497, 59323, 54267, 44613, 65169, 50248, 2272, 22911, 9736, 62456, 36027, 2047,
+    342, 7682, 56859, 2337, 25549, 66816, 22097, 58327, 22966, 24362, 44084, 15975, 8572, 34446, 67156, 51896,
+    65113, 65907, 64845, 50289, 20817, 56172, 16844, 11656, 22502, 28657, 66363, 9488, 20729, 48326, 5445, 3209,
+    19138, 32442, 50152, 67067, 28016, 553, 20741, 3709, 18629, 104, 47619, 59090, 47790, 18128, 21308, 64888,
+    48590, 54716, 67873, 20837, 21331, 11934, 18630, 66390, 14447, 44731, 26543, 11495, 9287, 56334, 18272, 70438,
+    3681, 669, 32601, 10420, 7158, 25971, 19887, 42926, 12259, 68410, 3482, 62982, 65997, 18809, 21204, 15132,
+    69986, 53646, 7734, 33863, 68556, 22712, 13436, 61668, 69087, 9592, 44158, 67454, 35239, 32815, 39926, 47287,
+    26159, 27943, 55623, 18124, 42089, 33646, 38815, 32512, 29701, 5847, 62977, 8945, 19768, 19596, 55355, 40856,
+    47026, 13768, 41139, 62795, 48535, 65369, 7495, 48316, 26550, 60482, 37820, 11653, 52413, 62242, 20717, 34413,
+    12919, 55647, 60621, 68610, 68137, 3095, 776, 45777, 67612, 41818, 34895, 63755, 32712, 27315, 24198, 5150,
+    7100, 27457, 24396, 52878, 53101, 42548, 17791, 28245, 7486, 22050, 12995, 37753, 27200, 60989, 29143, 48674,
+    70061, 39309, 27951, 11534, 30310, 17404, 17217, 52538, 10194, 35991, 28811, 57730, 16993, 900, 46481, 14279,
+    12788, 50430, 32439, 65774, 25827, 23315, 22735, 27117, 26060, 27998, 25528, 18795, 55669, 59173, 11629, 52662,
+    60135, 23590, 24851, 20130, 57952, 42971, 24064, 9514, 41244, 2372, 44529, 14129, 51854, 14217, 20320, 60773,
+    10077, 42176, 34479, 55747, 66826, 44097, 13151, 12416, 36844, 16429, 16062, 34431, 127, 28287, 27554, 23845,
+    44777, 4938, 8191, 56755, 59473, 64010, 44099, 8566, 2802, 61321, 2923, 50032, 46025, 35848, 48167, 44473,
+    48227, 3421, 41985, 22981, 11535, 49127, 48623, 13669, 39197, 32857, 36940, 16517, 12240, 4119, 46197, 25285,
+    33735, 52449, 24664, 62871, 2871, 69880, 18582, 27940, 476, 26702, 42510, 56125, 64858, 20722, 8349, 39638,
+    29694, 57254, 50109, 47919, 41546, 30596, 47910, 33219, 1211, 4494, 53504, 1485, 64694, 56768, 54575, 35090,
+    56709, 3588, 50495, 5845, 8904, 36110, 4941, 67272, 14777, 3800, 51597, 58801, 14287, 58622, 66253, 31554,
+    6816, 11767, 47344, 67858, 25928, 60483, 61465, 44028, 68161, 56720, 24767, 47863, 39422, 7602, 34270, 10758,
+    7691, 44351, 2168, 49304, 23204, 59213, 2504, 33636, 54283, 47128, 50447, 39435, 49860, 35777, 67718, 47248,
+    34297, 48583, 16408, 21085, 25057, 4413, 13774, 18924, 24428, 21664, 63939, 49245, 1587, 16476, 52055, 69201,
+    37633, 4551, 8696, 53191, 22722, 67236, 18807, 46540, 40794, 23176, 15814, 64962, 29733, 41695, 20781, 13137,
+    56631, 34283, 67818, 1225, 60527, 65950, 48331, 2987, 57358, 5124, 38096, 19626, 24909, 4581, 44, 60427,
+    66545, 48128, 38791, 22385, 23983, 31709, 68326, 11914, 2303, 53537, 2690, 4817, 21851, 18635, 61171, 25453,
+    11022, 4533, 6682, 42071, 19705, 24670, 19196, 32645, 67633, 36889, 46495, 26144, 42398, 46931, 63351, 9255,
+    60521, 42689, 34027, 42620, 34294, 50940, 52646, 45737, 4813, 62563, 26191, 38531, 22323, 13865, 69400, 10263,
+    44764, 17992, 32185, 9513, 34017, 13742, 30704, 39202, 33223, 13645, 17964, 60282, 62508, 30331, 32947, 39350,
+    40493, 6952, 36045, 36221, 22112, 14206, 60795, 31895, 8980, 47083, 20421, 56659, 59283, 31511, 16215, 7447,
+    67462, 18231, 18435, 24109, 6812, 34906, 60567, 62638, 22965, 67477, 43755, 17931, 65824, 44321, 17867, 50201,
+    49185, 15951, 28297, 54342, 23126, 54553, 35216, 54450, 23355, 60830, 65319, 10909, 28903, 7389, 50172, 17829,
+    31847, 62487, 11970, 10720, 33236, 50544, 13298, 26786, 5424, 50046, 40735, 18765, 37973, 53943, 52246, 32092,
+    33340, 60203, 64118, 12162, 23459, 38472, 44388, 21823, 35400, 55351, 18631, 18757, 60313, 45305, 25269, 44471,
+    60881, 28864, 8759, 48960, 44368, 22054, 9188, 5493, 48588, 26027, 10761, 64165, 16421, 56490, 25241, 63960,
+    63123, 19883, 30218, 21798, 32782, 46055, 512, 28452, 61167, 19068, 61389, 11247, 18799, 27030, 11613, 47504,
+    52657, 37049, 54771, 23788, 30259, 55025, 57529, 36957, 46065, 64143, 66452, 48837, 40855, 1347, 16382, 60209,
+    41265, 19623, 33958, 33113, 66364, 41935, 31166, 15982, 17485, 19414, 29221, 31330, 7801, 37279, 22613, 52806,
+    59487, 18058, 70137, 6390, 44250, 46569, 6379, 51984, 15099, 64685, 29966, 39641, 10950, 42397, 16110, 16193,
+    56119, 21847, 34630, 68856, 30863, 36440, 42355, 68030, 59535, 54950, 3509, 66120, 31623, 6608, 39096, 22488,
+    8305, 33346, 33392, 28940, 8407, 60318, 13575, 50647, 46167, 35308, 69560, 39845, 25655, 36896, 37502, 46686,
+    25664, 50555, 25697, 18362, 66473, 40311, 38880, 23660, 26896, 49242, 35465, 35232, 2416, 66403, 40319, 64678,
+    6660, 53444, 44674, 3991, 31211, 53306, 15828, 29212, 14818, 67487, 66090, 49777, 691, 63723, 5802, 46227,
+    16386, 10529, 65081, 3763, 7931, 44428, 53734, 58528, 64613, 13740, 39613, 59035, 23921, 16820, 67299, 69985,
+    21027, 49767, 66724, 20599, 66187, 8106, 56059, 2280, 7581, 14136, 22146, 32521, 37254, 3996, 44532, 25250,
+    4139, 61169, 16962, 3981, 27479, 1611, 25369, 2782, 62807, 60898, 69273, 37017, 14793, 32033, 21748, 46273,
+    10671, 24071, 25344, 35538, 49446, 20565, 29426, 15075, 54785, 9705, 44687, 54973, 43706, 23089, 50480, 37241,
+    46564, 36481, 2482, 58979, 9820, 15501, 62693, 57326, 20719, 61126, 2171, 45086, 35176, 25338, 8330, 21371,
+    44503, 65553, 29244, 18930, 26403, 14891, 28707, 36671, 973, 47954, 24777, 66078, 50456, 8079, 6450, 37587,
+    56718, 17873, 66838, 60120, 13037, 23556, 61116, 17121, 24934, 4262, 21921, 46959, 69941, 64408, 8398, 28277,
+    47764, 418, 33572, 32964, 49510, 1541, 35893, 2863, 11858, 52639, 31223, 45132, 27448, 59492, 63578, 3476,
+    33341, 44904, 51744, 67777, 59584, 50126, 9236, 19136, 52998, 45626, 61586, 55939, 14919, 29277, 50073, 6401,
+    24734, 1458, 1696, 29199, 37440, 43480, 45927, 23036, 44183, 24304, 301, 29154, 3195, 51240, 36880, 23120,
+    5043, 62442, 59130, 56701, 51339, 43247, 30158, 1489, 9494, 33276, 55194, 56558, 61909, 24037, 11016, 10476,
+    53966, 27326, 52262, 69575, 12075, 70248, 62872, 8325, 65032, 45616, 22096, 64017, 24008, 9822, 37848, 11052,
+    12533, 59167, 20251, 62464, 14264, 65604, 37752, 38086, 51438, 57354, 22295, 52570, 39815, 32811, 30746, 59,
+    37873, 30696, 29127, 35708, 1734, 29922, 3061, 3436, 33252, 55148, 34309, 36355, 9011, 16425, 19007, 66100,
+    23329, 33408, 39257, 8722, 35139, 41325, 66433, 44045, 30605, 25159, 62675, 23242, 40034, 36356, 38269, 49178,
+    3952, 42219, 64721, 39078, 60766, 49797, 46357, 48716, 59896, 43493, 60793, 33435, 42380, 21511, 59082, 64635,
+    45956, 17827, 778, 45405, 57330, 13327, 22202, 49376, 20621, 19870, 28218, 52367, 25633, 20598, 53908, 51764,
+    68305, 22414, 19464, 2766, 40654, 31531, 27540, 7585, 27379, 4582, 17716, 23213, 6814, 7314, 16192, 56726,
+    46387, 41758, 37780, 12379, 49303, 9930, 61235, 63619, 62423, 39029, 56681, 35204, 58616, 40761, 11396, 33641,
+    7820, 13290, 8869, 54009, 1720, 5286, 63698, 17645, 10674, 60979, 32411, 59681, 12694, 24028, 28830, 16083,
+    41585, 62231, 34835, 50613, 9056, 69716, 6739, 42831, 21855, 66906, 5569, 17240, 46595, 24306, 67804, 33675,
+    35679, 36111, 25604, 15685, 17179, 29460, 40996, 69679, 40920, 17059, 32787, 23034, 62041, 18416, 8046, 37062,
+    67058, 22691, 32900, 9855, 46413, 56789, 39403, 23182, 22302, 68839, 9397, 13262, 21956, 57308, 39377, 48522,
+    50586, 9679, 59087, 10193, 30103, 31834, 62698, 25782, 47524, 16715, 43189, 24911, 42202, 5161, 16149, 53933,
+    56596, 56489, 44530, 2959, 31347, 58921, 68522, 36508, 53832, 40525, 49093, 31730, 33721, 34748, 56300, 64875,
+    50635, 5960, 14806, 48839, 25291, 12130, 10733, 25410, 17264, 31572, 1454, 771, 40614, 36874, 37857, 46177,
+    17438, 37147, 15049, 70123, 68345, 13376, 8631, 64249, 53939, 24380, 39441, 14667, 63053, 45880, 41124, 61729,
+    29901, 35155, 2126, 26303, 59047, 23098, 51270, 57501, 45918, 19514, 28794, 40190, 66468, 17111, 62444, 16271,
+    42212, 20500, 6212, 51841, 9009, 68823, 12391, 63963, 3256, 2254, 66136, 60910, 17914, 32631, 12888, 10528,
+    39437, 10246, 16074, 1117, 44678, 40175, 29046, 40150, 3761, 13546, 40630, 5964, 4028, 48635, 34539, 68064,
+    688, 43029, 3013, 3104, 14528, 38202, 56288, 69629, 23652, 66400, 56622, 45494, 51621, 34866, 39386, 65309,
+    69225, 51456, 36020, 15309, 30313, 1175, 60587, 44372, 7432, 70160, 14015, 21269, 17724, 4906, 57065, 69197,
+    39176, 54273, 35365, 45598, 15157, 884, 3623, 36882, 36641, 11088, 44400, 8787, 36741, 24184, 5643, 43057,
+    25477, 52700, 37134, 22386, 11219, 46444, 37347, 21568, 58998, 19313, 22243, 32501, 67846, 2442, 26200, 50670,
+    44895, 6161, 2752, 36350, 52809, 53348, 63703, 61875, 56673, 59633, 35235, 49283, 32215, 43084, 55526, 8601,
+    56113, 36594, 43976, 4016, 46668, 25206, 70420, 61999, 19058, 64632, 26431, 45771, 12480, 48512, 542, 31308,
+    53653, 33591, 52604, 9031, 40324, 57435, 18309, 10973, 21698, 8544, 2325, 6801, 47095, 31057, 13356, 20435,
+    7834, 44419, 21273, 26401, 29387, 6770, 58422, 47055, 24681, 48049, 16511, 48155, 53845, 28779, 57200, 60635,
+    24999, 1015, 19498, 25805, 45720, 52751, 51504, 10962, 55610, 56482, 67980, 8821, 56238, 57108, 35334, 34661,
+    43109, 22710, 44567, 34573, 337, 11187, 6048, 35513, 16549, 13525, 39796, 13911, 60819, 69145, 58619, 10288,
+    65459, 4622, 62569, 46450, 30245, 39901, 37064, 8892, 18811, 48942, 38039, 56118, 53258, 46660, 4868, 26304,
+    1261, 20538, 9304, 37091, 62394, 45575, 43759, 67279, 60200, 13186, 66837, 34050, 15140, 31116, 24172, 39488,
+    15362, 36533, 36928, 54442, 57147, 46477, 28990, 22992, 54120, 24389, 13219, 2025, 17505, 43981, 47555, 14029,
+    48224, 63075, 50926, 63014, 35743, 34929, 59822, 42692, 42814, 5809, 39301, 58173, 40422, 4104, 44708, 39604,
+    64132, 29341, 33914, 67318, 67622, 23062, 11697, 53974, 27888, 13794, 69091, 59576, 2177, 61866, 33165, 58640,
+    53755, 51026, 7186, 63335, 33980, 22382, 57255, 69180, 46150, 58532, 34405, 53973, 27249, 67301, 48580, 70210,
+    50524, 60058, 49410, 15679, 16100, 59644, 49456, 42064, 52082, 7873, 7803, 47940, 46721, 35600, 62060, 40489,
+    59305, 43223, 17445, 24574, 8778, 53463, 59282, 40452, 49255, 55233, 50709, 66140, 41524, 4029, 12428, 16001,
+    66349, 5545, 132, 55110, 13011, 5632, 4417, 41196, 57348, 62414, 54380, 63116, 15589, 48997, 39691, 19832,
+    34873, 61410, 69850, 63936, 59981, 64990, 42617, 24255, 65850, 68313, 26951, 65264, 32835, 4163, 66081, 3192,
+    37396, 45942, 68672, 26504, 44334, 38168, 3141, 55845, 58349, 37585, 62516, 7554, 33549, 17539, 34314, 36442,
+    62601, 46645, 16711, 13332, 32262, 8906, 46570, 29810, 56598, 47780, 13600, 63424, 46313, 13347, 34047, 69567,
+    284, 40910, 24538, 31888, 9880, 27851, 55718, 5729, 68005, 57399, 3546, 70394, 32164, 54941, 44171, 4324,
+    32669, 16158, 11309, 24327, 6352, 57990, 19063, 59034, 43256, 55781, 39639, 46791, 21869, 69918, 23338, 6466,
+    31647, 66201, 55262, 43003, 67951, 44732, 41059, 68526, 48120, 58655, 53927, 7099, 30225, 30840, 15351, 31109,
+    51, 26825, 24496, 459, 33052, 6118, 25869, 59919, 42474, 23074, 69369, 65848, 2771, 66483, 27482, 32566,
+    55768, 25979, 68495, 37504, 26118, 40312, 22453, 61152, 28246, 70316, 39756, 5453, 42530, 47593, 65097, 6032,
+    15625, 25977, 47480, 296, 520, 30405, 46689, 53707, 59381, 19000, 51620, 44892, 54652, 20393, 24529, 11045,
+    2944, 5754, 17439, 18566, 58744, 23367, 18578, 39214, 49995, 40359, 49439, 69630, 70341, 15938, 18700, 6307,
+    42803, 43475, 66242, 57866, 25759, 2506, 13200, 14391, 32445, 40765, 37719, 61224, 13878, 66546, 19738, 32095,
+    37723, 31897, 37178, 65217, 37257, 62722, 39302, 18497, 4137, 60055, 50779, 39243, 10189, 23429, 34946, 68793,
+    58512, 18858, 51936, 57833, 9194, 53523, 19088, 67713, 25038, 54665, 59124, 16917, 57077, 6148, 41154, 22103,
+    1801, 57299, 44627, 58958, 35603, 37589, 11864, 47339, 20457, 57334, 28868, 7281, 9447, 49961, 9962, 64992,
+    59718, 49825, 31547, 64773, 53983, 49459, 24785, 40201, 7315, 57775, 8072, 58919, 22072, 42057, 4256, 49060,
+    14051, 45333, 23297, 5407, 50522, 45748, 60573, 12206, 67765, 4291, 55872, 28035, 20697, 1582, 20104, 6632,
+    20359, 56202, 30456, 28171, 7483, 34064, 11831, 18313, 53156, 46602, 54012, 45008, 62704, 3501, 58612, 23680,
+    36185, 22865, 48873, 34609, 8454, 60243, 35388, 21230, 8739, 1564, 46583, 16591, 23056, 60608, 16596, 46992,
+    30011, 32319, 48116, 19293, 58273, 50433, 51019, 34624, 42683, 67733, 1668, 17948, 14733, 42061, 13817, 36494,
+    21429, 46713, 41074, 10627, 41993, 67651, 58317, 53331, 36633, 4869, 58679, 41739, 68169, 46000, 28258, 7971,
+    52228, 40003, 35266, 18857, 64989, 35275, 5770, 26583, 20197, 51338, 30511, 24840, 36898, 22914, 50923, 26775,
+    50528, 29297, 31787, 49461, 48941, 61736, 56873, 64741, 57222, 16139, 13795, 55191, 18493, 59849, 26541, 8276,
+    20549, 34030, 59085, 33754, 26444, 13844, 50173, 29945, 12540, 25800, 40072, 47891, 59364, 23616, 60551, 48875,
+    20034, 29873, 68219, 57161, 52213, 48833, 25600, 32085, 36010, 51686, 68288, 28730, 50276, 43276, 36795, 11030,
+    59717, 18531, 63400, 54152, 70466, 41921, 56898, 54279, 18842, 7683, 747, 61870, 67847, 51107, 54737, 4893,
+    69192, 19702, 6901, 8935, 68509, 46526, 42280, 54909, 19546, 70400, 25901, 18338, 63090, 65463, 6703, 51332,
+    38294, 1105, 58896, 49332, 56725, 4030, 65383, 37434, 48234, 48810, 17871, 15329, 25211, 24588, 30006, 45285,
+    12970, 28200, 8936, 18064, 52898, 9723, 17380, 57454, 315, 28641, 59908, 13910, 46455, 36946, 6726, 9387,
+    31723, 68987, 6262, 30992, 43556, 50958, 26779, 35471, 31689, 50762, 15958, 47563, 41528, 804, 56397, 59828,
+    43331, 68463, 35879, 30041, 45259, 35389, 9043, 8289, 21239, 54197, 9122, 50184, 21604, 5679, 28796, 56914,
+    10690, 20520, 60500, 70122, 55034, 12029, 22409, 27348, 54433, 17635, 63746, 18260, 48185, 9171, 52967, 56549,
+    37710, 15251, 909, 63564, 47973, 12062, 12859, 52158, 23137, 9914, 27812, 35719, 21561, 10766, 69858, 40922,
+    65158, 8970, 4708, 12241, 22713, 64269, 52454, 48895, 58276, 14303, 66846, 33723, 1462, 44258, 70388, 64826,
+    46712, 46552, 17814, 37725, 45747, 27108, 15548, 1201, 33067, 65992, 50530, 13140, 46073, 63740, 31866, 12459,
+    6176, 41182, 17949, 63579, 60884, 63207, 8721, 59699, 43240, 38989, 43665, 67938, 65204, 861, 57736, 46187,
+    61674, 28220, 46380, 48707, 4102, 35246, 31141, 3151, 59218, 44389, 37131, 3542, 27154, 52841, 10588, 18708,
+    33570, 8765, 22875, 29985, 15802, 26079, 59996, 12227, 12805, 17571, 14957, 41664, 49636, 58376, 918, 33038,
+    7254, 8499, 13425, 53131, 43501, 57798, 37323, 57050, 53691, 8808, 53882, 32531, 69957, 15790, 10731, 11734,
+    33482, 25788, 29152, 15779, 57324, 70331, 64240, 70095, 58923, 34318, 31995, 59716, 25458, 45204, 29482, 8337,
+    15449, 51571, 59096, 44330, 23046, 57992, 56035, 39950, 20631, 29334, 69250, 42134, 26324, 37727, 48916, 10967,
+    17630, 5623, 33517, 69158, 26783, 63975, 20506, 7861, 49297, 24470, 21958, 3478, 40458, 14618, 16286, 12114,
+    49698, 55483, 67606, 8944, 49551, 27238, 52680, 52924, 56544, 54662, 68291, 56382, 16764, 62559, 59233, 483,
+    46769, 47351, 3375, 12505, 32083, 6575, 63869, 13873, 9884, 36808, 19251, 16051, 48073, 41137, 52427, 25676,
+    30885, 59733, 9249, 50950, 19953, 62378, 52901, 60825, 25178, 66293, 30950, 56663, 53862, 13739, 29916, 65496,
+    29090, 55846, 1138, 36360, 34087, 54879, 35321, 26551, 40535, 20577, 60172, 17753, 13893, 21692, 26373, 18093,
+    56763, 20673, 51320, 62672, 64498, 40612, 50338, 23399, 37697, 35826, 23385, 55177, 40763, 9587, 66202, 53021,
+    8940, 19242, 6232, 28684, 30324, 52356, 4892, 54432, 42022, 33900, 36501, 19822, 13144, 17953, 51152, 47983,
+    11559, 66369, 9543, 22814, 39913, 49023, 7336, 54518, 16227, 53518, 53771, 41488, 14780, 19599, 69073, 17681,
+    9005, 5805, 61055, 15664, 58936, 11212, 3710, 56271, 6809, 18014, 59472, 46805, 21221, 12914, 11072, 32275,
+    57082, 66957, 24716, 2481, 29120, 66636, 46641, 60197, 15216, 2704, 54686, 36855, 49671, 37048, 17041, 30722,
+    290, 9719, 30970, 47040, 8377, 70496, 51980, 69747, 1589, 63061, 59508, 60709, 67010, 27373, 39282, 31395,
+    50119, 50829, 54400, 60138, 47740, 37630, 61123, 64684, 10443, 37489, 26749, 68141, 16493, 15192, 43888, 25430,
+    69072, 21022, 51950, 17039, 12847, 28704, 9638, 6651, 4374, 5509, 68579, 44342, 7367, 8861, 57305, 61879,
+    2062, 52267, 4320, 33033, 24484, 53800, 39090, 2564, 23668, 5560, 46036, 66913, 59319, 24958, 8898, 20432,
+    9044, 38984, 61945, 65271, 60941, 38748, 52774, 59659, 66516, 49656, 7694, 21090, 31209, 39149, 52077, 1724,
+    26150, 38780, 60862, 52802, 7142, 31148, 18942, 24477, 10948, 10099, 9752, 26998, 64145, 10757, 69825, 29643,
+    14646, 34134, 51663, 19931, 57372, 59674, 44820, 24298, 58105, 638, 10241, 40045, 69262, 17065, 4014, 51495,
+    24660, 17763, 69769, 23927, 39332, 32715, 44132, 25856, 3684, 27003, 30370, 5007, 70065, 55414, 4949, 14119,
+    29792, 50492, 8350, 45623, 38497, 41942, 64688, 32063, 40433, 27637, 38959, 8876, 26084, 65046, 37627, 32374,
+    52795, 14409, 69654, 67613, 16634, 9549, 67620, 4565, 16736, 58323, 57154, 21004, 34796, 9498, 6787, 20117,
+    14752, 25963, 26975, 37850, 13155, 3322, 2662, 59924, 39188, 70048, 19792, 24483, 62359, 44466, 519, 46956,
+    32543, 14436, 50080, 65591, 9568, 49770, 40586, 41011, 36057, 37652, 1950, 36249, 16082, 58783, 52344, 20316,
+    55358, 45039, 28838, 173, 3139, 35068, 9262, 62573, 62907, 1770, 43858, 28891, 21434, 3604, 21095, 4946,
+    61077, 18637, 43107, 35169, 60964, 4837, 3813, 20623, 4213, 35902, 1827, 34957, 22621, 54760, 38906, 48112,
+    30673, 38841, 56335, 1838, 1795, 29440, 23437, 4891, 54635, 37156, 21001, 23500, 27986, 24263, 58078, 1965,
+    14518, 11662, 39292, 67974, 64849, 45966, 49172, 46750, 58782, 11528, 48858, 24316, 41187, 63700, 68523, 50292,
+    22094, 11566, 19044, 22418, 24056, 65346, 49259, 62783, 25976, 41210, 39557, 58557, 29085, 41927, 24748, 44146,
+    14938, 8689, 15574, 33425, 7462, 12724, 28057, 53196, 62774, 67653, 31638, 48017, 30328, 15297, 9859, 68430,
+    47171, 14025, 2127, 19802, 49395, 46730, 17638, 22780, 54127, 54938, 29517, 53426, 27422, 26472, 28495, 20669,
+    64960, 16267, 26397, 29829, 54370, 55711, 41232, 9099, 54278, 32014, 38719, 11620, 1212, 55519, 24623, 48436,
+    50624, 1996, 1576, 17479, 48329, 49585, 66522, 62711, 57499, 62531, 10527, 21643, 13633, 21097, 43705, 40128,
+    68696, 36450, 29432, 59105, 32563, 7489, 66260, 1177, 26328, 61604, 55539, 24624, 16726, 17837, 28890, 9048,
+    7933, 85, 29082, 33185, 23965, 13227, 68989, 65932, 36727, 59418, 23526, 21947, 26395, 6215, 36783, 17088,
+    26063, 13399, 66097, 53086, 61822, 25399, 45349, 25463, 66183, 13963, 57940, 37601, 36465, 22440, 61740, 65391,
+    37828, 67901, 1198, 6538, 4069, 31188, 12953, 45269, 64207, 8608, 10313, 40252, 31378, 9350, 47035, 52935,
+    45624, 46471, 20103, 60843, 62705, 40149, 11237, 43261, 5510, 16366, 9760, 59089, 5529, 29566, 49524, 67119,
+    36049, 865, 60460, 38247, 2658, 10513, 25255, 29331, 20139, 52714, 52056, 57120, 4955, 58994, 36871, 24147,
+    19165, 52320, 52854, 69952, 21636, 54285, 30692, 62750, 21727, 49392, 23150, 58601, 62978, 54402, 66518, 23443,
+    22156, 40240, 16597, 60122, 43228, 28735, 13695, 41731, 54828, 15389, 51542, 15019, 3931, 4054, 63694, 55538,
+    56357, 3059, 45326, 6238, 51633, 32016, 61937, 57926, 27177, 22940, 34080, 55856, 42766, 60958, 28148, 62522,
+    3211, 43184, 59263, 1151, 809, 7927, 7997, 19460, 16891, 48900, 66966, 42196, 2104, 25055, 20578, 38360,
+    39974, 43397, 24354, 16691, 18999, 58335, 38831, 1469, 20353, 30387, 47713, 56693, 69563, 40951, 24349, 13203,
+    35508, 32318, 66254, 61652, 64415, 34982, 32290, 13667, 6397, 25387, 61676, 46059, 70057, 39555, 15031, 62165,
+    165, 22339, 48660, 31458, 28527, 68899, 22025, 37691, 41112, 67504, 2271, 8232, 62805, 4737, 52884, 10067,
+    43418, 29156, 8856, 8159, 60518, 57391, 68913, 3416, 7519, 38179, 67610, 68900, 18114, 54414, 37786, 8300,
+    36460, 56990, 48811, 60279, 1166, 41622, 44465, 59408, 26836, 54841, 34313, 37919, 63069, 59626, 30948, 12988,
+    30134, 53100, 46189, 52707, 47677, 49118, 2465, 67426, 61016, 46567, 63883, 49056, 1240, 56457, 69142, 2301,
+    63183, 715, 14603, 67935, 18125, 68437, 33912, 3697, 59975, 16772, 27390, 61686, 26287, 46946, 34022, 1899,
+    56200, 18311, 39390, 23254, 66500, 56860, 67990, 25437, 21659, 62185, 20176, 42170, 25224, 52945, 25245, 24884,
+    41396, 5370, 851, 19577, 55837, 61258, 25845, 24987, 69185, 4758, 46009, 22550, 17656, 8924, 44498, 43917,
+    64115, 36126, 44074, 48457, 66850, 49648, 8017, 9619, 1220, 64064, 14024, 63131, 66493, 27769, 268, 10384,
+    5696, 3040, 49490, 24621, 52576, 48342, 55067, 4076, 29259, 44580, 1481, 31037, 39795, 32004, 8877, 31356,
+    49293, 25244, 12141, 46421, 43644, 20041, 24751, 33855, 31807, 57014, 39184, 67615, 16121, 40317, 37085, 43185,
+    8822, 13426, 32728, 26957, 27450, 26478, 66800, 35888, 46023, 1479, 16529, 36604, 14380, 41594, 49764, 19858,
+    34156, 58242, 20361, 37054, 36406, 42338, 38010, 44965, 27185, 66722, 3872, 32097, 19865, 6938, 41566, 25385,
+    24164, 45160, 57747, 50592, 3430, 59176, 6408, 52408, 33063, 35150, 64204, 45998, 11415, 40228, 20246, 44061,
+    63634, 50987, 38422, 5339, 61737, 46030, 13643, 21176, 10799, 32965, 38666, 43834, 56058, 51710, 25466, 66805,
+    41793, 54646, 61098, 17213, 30089, 44607, 29264, 3126, 55439, 41172, 39737, 38633, 29209, 54676, 30789, 38259,
+    51761, 36004, 40133, 19236, 49364, 15799, 40178, 54223, 58743, 19783, 40344, 48791, 709, 38982, 57081, 7388,
+    17152, 39038, 42386, 40656, 53492, 8830, 19456, 1772, 19018, 38734, 3723, 25150, 68736, 6747, 28411, 18487,
+    30905, 43484, 18640, 42116, 42529, 20930, 21771, 64743, 70147, 29583, 5443, 21694, 15868, 17155, 48869, 24050,
+    6120, 1620, 35560, 41393, 4015, 16749, 35707, 12887, 2251, 40980, 25570, 16413, 67425, 5834, 44568, 55896,
+    59753, 27936, 38983, 7501, 48730, 33645, 47094, 22200, 69978, 26886, 22238, 35935, 20304, 34622, 32186, 14557,
+    26093, 50015, 50763, 15683, 54459, 36030, 38455, 36062, 48028, 39347, 30404, 63444, 10709, 68780, 48959, 35811,
+    36901, 60087, 25152, 60242, 59327, 954, 54307, 16048, 55948, 44907, 46917, 1420, 59095, 2037, 65733, 57706,
+    25822, 18926, 12944, 37081, 38755, 13594, 28900, 35413, 3948, 2413, 17819, 13370, 66548, 9553, 57998, 30998,
+    22410, 38689, 38511, 11936, 2567, 515, 40204, 6823, 32182, 5253, 70131, 9298, 63555, 57619, 26419, 18257,
+    19838, 41969, 35380, 68400, 22106, 2118, 8332, 7675, 33612, 16834, 32553, 28541, 5128, 3295, 9065, 38449,
+    67286, 6742, 38969, 54579, 56662, 30548, 38309, 6302, 46175, 2073, 41108, 10520, 33270, 32189, 63867, 18740,
+    24863, 26054, 15441, 47325, 15069, 49445, 2734, 8823, 52033, 55320, 48446, 53751, 67643, 35301, 51929, 46015,
+    56521, 15173, 55950, 46098, 14323, 19221, 42864, 6904, 39741, 24423, 9482, 20270, 2087, 22860, 2695, 45820,
+    19380, 67863, 43469, 39589, 46271, 53648, 46014, 20608, 27873, 28805, 32483, 13141, 68119, 24561, 44299, 377,
+    51655, 32839, 46370, 41459, 62356, 51766, 41378, 570, 31667, 61054, 21328, 65353, 38990, 59255, 25726, 19991,
+    15288, 25986, 68872, 61418, 45659, 421, 59238, 2330, 27308, 10410, 26530, 11347, 7659, 51842, 17164, 64037,
+    2304, 49619, 26354, 14552, 34619, 59747, 49282, 35042, 61628, 60617, 66955, 39942, 28237, 29117, 38236, 12992,
+    3221, 66488, 12695, 34898, 5022, 1579, 23855, 35776, 42190, 32843, 41398, 35135, 52556, 53193, 67927, 57850,
+    31659, 21773, 55636, 52574, 5206, 40209, 21990, 60491, 40397, 53059, 53894, 58941, 26631, 733, 47042, 54816,
+    51029, 28836, 51396, 33530, 26675, 4128, 23905, 11421, 34682, 5180, 31008, 65698, 23321, 55114, 26473, 29526,
+    1938, 6943, 62244, 65705, 29837, 29383, 61330, 61045, 47284, 29014, 37185, 42158, 58196, 44234, 36225, 56278,
+    58345, 32579, 3639, 50468, 58688, 14795, 4340, 22733, 49616, 44033, 56585, 31779, 68534, 51682, 69368, 6506,
+    37357, 15138, 8020, 53068, 37970, 21989, 7269, 53028, 2270, 8277, 34018, 15384, 9242, 63807, 32188, 12389,
+    20282, 20906, 64362, 9345, 21565, 21010, 36083, 13985, 37823, 13941, 18197, 55624, 46793, 14664, 45553, 56790,
+    8955, 49984, 56687, 67493, 30938, 63060, 42472, 70491, 22118, 39715, 11027, 67670, 12563, 49078, 56907, 13293,
+    45028, 16905, 16526, 16387, 21846, 17795, 15107, 6633, 66191, 4978, 42903, 8171, 69507, 47669, 24377, 51873,
+    63529, 25919, 49472, 7857, 33065, 5813, 9584, 54094, 18186, 13545, 64202, 54995, 55697, 11210, 6244, 57274,
+    32366, 52078, 49988, 55440, 59607, 57767, 65440, 34933, 45418, 14770, 60632, 30292, 23366, 15658, 16978, 3232,
+    7056, 8333, 8313, 60443, 12594, 63211, 31058, 58140, 1644, 23971, 8670, 51664, 61512, 69524, 50718, 25544,
+    23712, 5711, 43191, 18354, 7517, 8213, 6671, 46104, 18641, 44997, 23706, 49421, 16384, 2795, 34707, 46307,
+    45543, 23738, 70071, 11987, 51794, 58865, 42264, 69436, 19748, 11682, 30200, 17201, 32243, 66206, 36222, 47860,
+    63804, 61269, 16720, 13210, 19804, 66342, 35523, 25620, 14722, 36566, 4741, 66774, 10589, 43513, 23101, 19576,
+    61656, 26937, 53960, 68318, 32850, 31959, 26635, 26859, 60205, 45270, 16524, 61507, 3781, 24093, 33615, 64830,
+    42047, 53078, 37553, 70524, 52642, 12284, 36705, 498, 24063, 3661, 60089, 52141, 16618, 22618, 44635, 4804,
+    23258, 33445, 61572, 8785, 11630, 62544, 67075, 64643, 2130, 64912, 58310, 61185, 17572, 16765, 6579, 11888,
+    66784, 7136, 26905, 12483, 61156, 32977, 50209, 64016, 64868, 23779, 11691, 16847, 35405, 27909, 39614, 21386,
+    52276, 51725, 18898, 50445, 67211, 36989, 26573, 61052, 57025, 57017, 11942, 29204, 45025, 40328, 9204, 48432,
+    47024, 23337, 30466, 47915, 15211, 52799, 13366, 36916, 31811, 38037, 31904, 45497, 5442, 26215, 14317, 29270,
+    34852, 14916, 26208, 38352, 27387, 66719, 55826, 48005, 69774, 55654, 16501, 13537, 8203, 6198, 60752, 37452,
+    43246, 23132, 63433, 21390, 54248, 26715, 21951, 47107, 34742, 59003, 28562, 31796, 32183, 28473, 24577, 3458,
+    10106, 332, 46147, 10277, 34562, 51901, 47981, 53085, 54587, 59436, 67821, 46306, 48714, 49548, 19356, 46262,
+    7699, 23264, 68308, 32528, 36192, 30296, 26484, 14270, 54877, 67192, 18494, 19030, 55316, 46425, 60207, 38955,
+    49150, 23627, 6768, 34403, 9831, 56418, 65752, 10998, 57877, 9039, 48084, 4796, 38350, 47715, 11558, 43593,
+    61125, 20220, 31404, 67837, 40224, 2833, 57581, 27904, 36609, 25771, 2950, 69318, 6679, 48206, 16783, 11317,
+    17862, 70170, 60421, 14701, 67848, 40892, 25844, 42531, 42886, 12300, 7533, 44525, 13447, 47807, 66176, 21651,
+    30140, 57268, 48476, 52736, 26099, 47776, 14332, 5311, 48766, 4318, 14923, 40208, 26370, 56561, 11102, 58375,
+    9346, 48935, 68461, 66610, 61881, 45060, 54404, 67952, 22863, 4063, 61026, 21733, 42852, 5745, 50147, 57482,
+    42707, 811, 21975, 33834, 67355, 29314, 31199, 53918, 15245, 34415, 61237, 67540, 51169, 10872, 9213, 61989,
+    62447, 39091, 65138, 6550, 60816, 57048, 62266, 11769, 7352, 45822, 40302, 67782, 35479, 6769, 13496, 56207,
+    58992, 53577, 46853, 5815, 9232, 67143, 52193, 121, 54028, 14003, 28397, 50518, 34438, 53684, 21092, 7722,
+    70404, 51715, 17412, 53334, 61006, 27041, 49406, 54100, 68686, 63725, 53122, 26587, 19347, 25718, 13632, 25516,
+    5146, 20967, 11335, 16361, 58690, 11671, 10568, 70342, 45489, 9166, 43396, 41323, 15050, 53875, 68104, 17366,
+    59647, 43551, 5728, 25446, 23514, 37634, 1651, 1072, 32430, 45917, 66564, 340, 31328, 4228, 18850, 49194,
+    40610, 36091, 17196, 36430, 17049, 57853, 499, 64487, 25127, 64847, 47152, 51502, 61785, 60692, 4350, 51443,
+    29111, 35437, 26266, 62821, 66266, 47836, 42201, 28842, 58985, 69509, 64442, 26471, 16642, 50017, 18970, 26500,
+    61346, 47855, 54390, 4865, 31002, 1743, 36509, 65825, 13066, 30038, 59384, 25421, 67882, 32884, 66797, 64263,
+    34888, 19132, 42633, 14538, 24047, 10752, 65008, 8826, 11746, 12708, 51662, 12287, 1727, 3227, 16606, 44051,
+    29693, 19428, 29461, 31588, 7425, 22263, 50249, 35591, 57430, 35162, 53144, 7972, 4156, 63670, 43696, 47800,
+    27908, 40387, 50931, 40945, 1364, 16419, 7625, 30784, 14163, 8431, 70502, 548, 47909, 25899, 9928, 63729,
+    37844, 61528, 5674, 42839, 7469, 68358, 32537, 4554, 62749, 29146, 9777, 53332, 190, 36796, 67146, 41631,
+    60259, 51462, 7728, 55247, 33685, 57350, 63888, 39732, 14564, 26386, 62947, 10985, 16292, 23704, 47709, 2939,
+    38216, 56436, 20751, 5700, 4712, 9202, 55775, 16666, 35552, 47288, 56075, 9561, 211, 26283, 36037, 33879,
+    43257, 15262, 27631, 45, 16344, 21769, 69722, 35786, 26625, 59922, 63440, 45460, 24560, 69866, 63322, 66585,
+    11428, 30318, 66832, 1984, 32606, 3801, 28449, 60077, 20696, 15209, 50372, 50407, 2744, 38552, 41797, 1428,
+    15543, 65001, 26665, 70250, 56524, 27495, 41509, 65951, 24212, 15238, 29519, 33279, 9550, 20703, 12026, 18502,
+    15076, 58260, 24048, 68789, 49622, 49623, 60971, 14545, 35105, 56624, 59550, 15722, 61075, 14588, 62001, 13566,
+    36568, 28971, 56443, 46179, 16819, 40505, 54098, 8286, 49143, 45727, 27376, 13765, 50383, 45974, 41561, 61560,
+    29890, 58262, 2992, 62793, 12851, 26167, 33086, 40909, 21902, 1141, 36400, 55361, 4306, 4375, 3797, 61623,
+    6295, 38523, 28065, 59927, 19715, 39825, 65617, 19405, 22774, 68138, 47753, 66145, 29034, 23412, 56959, 15655,
+    49552, 55491, 41115, 55815, 68662, 25136, 1245, 40541, 46356, 39754, 55712, 47189, 50202, 51560, 63447, 44360,
+    2439, 60182, 40651, 8879, 66552, 9511, 26317, 3592, 22870, 49278, 49414, 17801, 69838, 30962, 27095, 22973,
+    19350, 19809, 30215, 10401, 2314, 65707, 20278, 60272, 27892, 4830, 58388, 5634, 36204, 50054, 49358, 311,
+    39192, 47637, 15300, 69932, 908, 46390, 32755, 45030, 17683, 44224, 23194, 36998, 24844, 5372, 37402, 49140,
+    68971, 38809, 52742, 5215, 19726, 4209, 20369, 55154, 23308, 27675, 51484, 36187, 52392, 19949, 63586, 1153,
+    59574, 19847, 38501, 38763, 29398, 44596, 69049, 52359, 22880, 21080, 66904, 23460, 62316, 32546, 46990, 49514,
+    49190, 3281, 62395, 15831, 14065, 23513, 43948, 51119, 64657, 33107, 26981, 6831, 20238, 34628, 63317, 55991,
+    18275, 36306, 61521, 95, 6982, 18270, 53511, 3440, 49344, 11144, 41572, 65472, 122, 36966, 299, 36622,
+    53704, 49746, 65111, 68147, 69302, 27075, 65370, 22562, 59781, 33722, 30807, 24551, 46392, 30231, 55465, 50135,
+    45386, 49786, 52163, 50021, 1194, 45984, 54392, 22431, 54569, 9691, 52571, 1116, 60847, 60693, 28151, 24789,
+    68394, 36831, 69305, 36529, 22514, 10253, 24215, 33743, 39111, 8195, 10197, 6023, 67280, 42761, 25832, 9918,
+    32169, 57382, 24584, 7115, 35263, 17921, 47019, 40294, 11592, 30463, 68160, 40930, 39232, 32507, 46360, 5884,
+    46652, 68707, 12892, 68477, 69701, 63969, 27056, 27090, 13965, 62751, 45295, 14694, 28680, 33023, 28617, 23624,
+    56699, 8612, 22218, 47838, 47268, 20761, 58838, 7318, 39331, 51389, 40450, 41324, 7568, 57392, 41715, 63160,
+    31516, 12585, 39910, 70457, 1647, 27778, 180, 39653, 70213, 61456, 39113, 68460, 51690, 34423, 23543, 42313,
+    51696, 41316, 3379, 39834, 31674, 58614, 39849, 25375, 55325, 64323, 28096, 41067, 60354, 40659, 42251, 61404,
+    5551, 53945, 2551, 38960, 16953, 31515, 56552, 53121, 12296, 70447, 4234, 69958, 62992, 12933, 43585, 58006,
+    11686, 163, 16479, 17442, 17311, 16203, 2210, 54010, 2261, 48050, 70327, 11287, 14684, 68594, 18029, 54162,
+    13287, 35018, 2979, 30613, 22047, 29903, 28270, 58246, 1048, 50129, 61584, 8161, 41851, 52281, 6889, 15168,
+    63387, 64900, 35153, 41469, 40469, 64806, 33183, 33478, 12089, 9929, 15034, 32323, 21043, 24603, 44166, 43490,
+    50665, 2746, 47881, 35407, 11830, 20511, 45808, 37295, 39758, 20686, 36145, 63761, 36513, 7161, 61855, 25148,
+    9659, 7606, 60244, 18537, 27628, 27181, 30527, 16843, 2884, 17046, 50736, 50023, 47581, 26795, 23960, 48577,
+    60141, 5871, 65685, 27074, 2462, 44485, 29150, 15042, 61294, 64966, 57657, 24387, 57819, 56499, 29906, 61311,
+    45790, 65753, 30044, 32392, 7106, 49967, 21800, 67009, 8115, 58048, 551, 44747, 51329, 17727, 31032, 54107,
+    45042, 47539, 42310, 42283, 62088, 18733, 18070, 42640, 28071, 12786, 25073, 60996, 39494, 19331, 5015, 24708,
+    37470, 46862, 45697, 11032, 48300, 39448, 54234, 2794, 18223, 28667, 47639, 34508, 6170, 64988, 11777, 64885,
+    18271, 28415, 25602, 3894, 31352, 25538, 49383, 14247, 8272, 22649, 35056, 57579, 47986, 14441, 27389, 5065,
+    49133, 6907, 50910, 22068, 60820, 30516, 35723, 44307, 17409, 43840, 43803, 32643, 18770, 48407, 44641, 62301,
+    11878, 5736, 69405, 66432, 64108, 61856, 59123, 47162, 30702, 65284, 13579, 32493, 44050, 50166, 40758, 7476,
+    873, 42568, 34146, 28906, 4591, 40883, 5199, 43921, 3200, 61296, 41429, 3869, 187, 19762, 51774, 8779,
+    16363, 43579, 62055, 17967, 10816, 6517, 12170, 57343, 65048, 48755, 12835, 60224, 65785, 15108, 57131, 47731,
+    65444, 12471, 66898, 56828, 26861, 876, 42499, 36914, 16868, 27158, 30742, 49141, 53389, 38265, 49683, 9727,
+    19972, 60565, 69760, 47747, 4183, 45665, 10102, 47435, 11665, 4311, 40484, 24752, 28695, 41704, 22897, 56383,
+    23821, 10175, 55043, 19659, 31456, 37793, 31719, 63177, 29574, 25357, 54190, 66987, 45503, 54117, 48380, 53671,
+    45052, 6815, 46304, 26222, 50100, 52818, 36407, 21601, 41214, 25359, 4401, 47306, 198, 20420, 40675, 44004,
+    44765, 59241, 4755, 67326, 40125, 63642, 27085, 65814, 3830, 17009, 59567, 28728, 4000, 50024, 31186, 20077,
+    24243, 17796, 60505, 6503, 13238, 21341, 4541, 23812, 41972, 54494, 46198, 67097, 32336, 15236, 14582, 64758,
+    52296, 25070, 60548, 60429, 69068, 51228, 32360, 53471, 51439, 5544, 60142, 58435, 13403, 61015, 65621, 10132,
+    41686, 23976, 2248, 5666, 28589, 45080, 68570, 11991, 27144, 39546, 40112, 40548, 69086, 42920, 61695, 50874,
+    45599, 49710, 27954, 51296, 23225, 17378, 38270, 47602, 40514, 53494, 67983, 5059, 11162, 61775, 60664, 56319,
+    32934, 63509, 45315, 18127, 52794, 70336, 68679, 61691, 34533, 11641, 13235, 11364, 50843, 6287, 3109, 16907,
+    54530, 11369, 53978, 62482, 54921, 8448, 18584, 66285, 18352, 55699, 37872, 50737, 68514, 53219, 55471, 50858,
+    8705, 57779, 5266, 32941, 24401, 54993, 50939, 39674, 27337, 69438, 30609, 56128, 2356, 65716, 49077, 23687,
+    36555, 16930, 15499, 53019, 22107, 21914, 31744, 28690, 2820, 1155, 51315, 31471, 18200, 5600, 14486, 23853,
+    50376, 61000, 46, 33310, 15797, 28768, 66269, 58957, 66014, 58054, 20466, 12526, 55453, 52992, 27044, 4520,
+    26411, 33240, 26676, 33041, 49519, 66397, 57964, 17355, 54314, 60456, 68831, 6648, 26138, 20775, 46788, 39108,
+    12230, 18196, 41386, 59549, 32127, 9569, 44451, 44256, 13297, 40891, 50576, 8521, 62029, 8768, 22303, 65548,
+    41141, 13198, 4915, 41239, 57764, 64834, 23760, 1172, 69196, 22023, 60369, 5867, 8964, 20840, 40218, 18559,
+    58073, 50538, 8579, 26610, 56963, 48813, 32304, 13990, 53767, 20107, 44784, 40716, 65939, 69112, 45240, 58604,
+    32780, 7701, 66125, 65690, 28539, 52551, 42654, 36291, 70425, 9714, 31169, 14927, 47192, 65846, 25678, 15650,
+    1187, 47952, 6168, 21517, 38291, 54695, 67195, 45908, 34422, 67813, 9110, 51292, 16536, 61478, 66392, 27571,
+    48731, 23695, 38255, 3959, 20875, 52688, 22578, 63073, 40442, 25691, 42217, 53541, 13529, 45802, 63988, 41949,
+    58960, 19934, 67443, 66300, 60347, 10711, 40786, 23291, 40592, 34890, 64650, 17287, 3854, 19542, 58181, 20827,
+    29186, 35815, 3978, 12832, 11008, 34663, 31854, 33456, 959, 15426, 51499, 33839, 42986, 57774, 39540, 37207,
+    43378, 50667, 8122, 22060, 11650, 58013, 54181, 59154, 27333, 33584, 61216, 69000, 35426, 44490, 10677, 52522,
+    36038, 11760, 67311, 48491, 70325, 6021, 59736, 51309, 41342, 1968, 65139, 58309, 20573, 18501, 14894, 14460,
+    30467, 51395, 59484, 39747, 6497, 12684, 19716, 50726, 62954, 53616, 49251, 52910, 52025, 56066, 11423, 28705,
+    34133, 67714, 3154, 51737, 58780, 20597, 69361, 48644, 28883, 59706, 51679, 32193, 26001, 41334, 57791, 58340,
+    25559, 47245, 63811, 26869, 63898, 51149, 48101, 23973, 16324, 26464, 25917, 59352, 15063, 14721, 35447, 55448,
+    61097, 3829, 33767, 60306, 30803, 32357, 27758, 12157, 25989, 13539, 52348, 43410, 51331, 29197, 9014, 61261,
+    40648, 16161, 52198, 59904, 27761, 42840, 2282, 34708, 29863, 49436, 11042, 54031, 26863, 9209, 971, 39003,
+    66294, 18052, 27250, 61285, 49553, 28960, 32807, 64950, 5970, 27431, 43962, 28822, 138, 52958, 8097, 10593,
+    6856, 37238, 44449, 10108, 10512, 5225, 16011, 13181, 62343, 52191, 51453, 25962, 59483, 41079, 49167, 53740,
+    44849, 66935, 29291, 40858, 21527, 36945, 66541, 11935, 48874, 47823, 16599, 50004, 24591, 52457, 43630, 46995,
+    6355, 11809, 30253, 493, 30985, 37628, 44326, 17425, 66487, 14356, 64129, 54672, 18263, 31601, 69647, 6221,
+    27463, 45754, 53399, 33139, 35280, 48877, 51417, 63654, 21783, 42764, 15926, 8782, 53723, 70080, 20956, 33829,
+    11927, 57132, 64048, 4066, 17776, 30873, 295, 54295, 24759, 38686, 21900, 67507, 54227, 12879, 63967, 14273,
+    62980, 12282, 39981, 14817, 42908, 15443, 43661, 29414, 614, 8470, 4751, 17504, 65238, 69935, 4504, 24281,
+    62161, 920, 50796, 27622, 45133, 9358, 49285, 25156, 27695, 47643, 24575, 18090, 43278, 53383, 44440, 48984,
+    68883, 62514, 13861, 22154, 1409, 36679, 8019, 66863, 26130, 45755, 44320, 50997, 53783, 26577, 58004, 30309,
+    67476, 25786, 54730, 31145, 39445, 28857, 19262, 32995, 54777, 38441, 11449, 68236, 42537, 11224, 57171, 32836,
+    34597, 27285, 49965, 54944, 36015, 13966, 32911, 38760, 68730, 30623, 67961, 48415, 6365, 37629, 42736, 6309,
+    58835, 9121, 48980, 36922, 67090, 53300, 47653, 62399, 50484, 41456, 9916, 53328, 57373, 51584, 65422, 50658,
+    8828, 13682, 9071, 26756, 9927, 35898, 19422, 22815, 14941, 22828, 65786, 49203, 55873, 22864, 64256, 5417,
+    59775, 61390, 25131, 58547, 30884, 28634, 24055, 37150, 36852, 526, 24487, 143, 3409, 53214, 13138, 58911,
+    55146, 37133, 14049, 9119, 28915, 36287, 5013, 67939, 25851, 55384, 45752, 58707, 22209, 44443, 33701, 29854,
+    21991, 21249, 35842, 16016, 69987, 10373, 46297, 58047, 38308, 63268, 41517, 59427, 41919, 61104, 46646, 19317,
+    1023, 68356, 57744, 51134, 15489, 1134, 47629, 68130, 32876, 48848, 67354, 49713, 40365, 62896, 50978, 3082,
+    34798, 38473, 24414, 37218, 26114, 11568, 32046, 36457, 15085, 30541, 33864, 3934, 9582, 27956, 17809, 18389,
+    35528, 52216, 40462, 43537, 54008, 64903, 3293, 39484, 16625, 50699, 53574, 58379, 36293, 53780, 51000, 30137,
+    48717, 30555, 55527, 43744, 61428, 26470, 17389, 6956, 39278, 37100, 25482, 55173, 38144, 42650, 4707, 59137,
+    12134, 423, 17279, 28775, 62480, 38645, 18259, 23145, 12787, 56517, 15544, 9975, 62470, 9069, 27007, 11425,
+    40776, 4208, 30447, 13192, 33356, 10477, 49250, 22641, 62681, 20607, 46460, 56366, 41950, 39260, 46470, 51013,
+    23622, 35149, 45423, 25287, 56614, 70529, 37265, 62973, 46220, 39382, 36841, 23838, 69441, 22053, 66595, 30752,
+    26185, 358, 18808, 33882, 35079, 44308, 43963, 28918, 923, 38257, 13445, 69788, 58108, 9034, 67781, 59079,
+    907, 47481, 60808, 69015, 3582, 21901, 2161, 23325, 7262, 45476, 37969, 66289, 39560, 37735, 50790, 34721,
+    29397, 52101, 5564, 3747, 67903, 30883, 40414, 8196, 62690, 49618, 2080, 37909, 23314, 52441, 68905, 30564,
+    7999, 26908, 29818, 42234, 27835, 38513, 20175, 63423, 27325, 44569, 68607, 19556, 47056, 63274, 1919, 42323,
+    69696, 60219, 64554, 43128, 49905, 5053, 19296, 39514, 12557, 9883, 18991, 68584, 15446, 65803, 52355, 12154,
+    61735, 64717, 54081, 34532, 440, 20949, 15366, 41909, 28009, 21009, 46504, 16341, 10209, 28693, 53326, 37034,
+    69870, 48729, 15956, 30184, 37900, 25679, 27856, 7433, 51587, 50533, 64608, 51643, 12889, 25371, 31017, 29857,
+    25310, 22357, 52161, 25035, 36775, 58837, 62556, 69761, 63045, 881, 4662, 19241, 58480, 9092, 5166, 31871,
+    47419, 68338, 1025, 29041, 12187, 4181, 348, 60987, 57184, 773, 51452, 67197, 21303, 32405, 16343, 42800,
+    27528, 14442, 59560, 3021, 54241, 21654, 8436, 39323, 25972, 36779, 29544, 28545, 41530, 64734, 64219, 30481,
+    70448, 27072, 3839, 1962, 49061, 7901, 36309, 65279, 20167, 52188, 1902, 1904, 13515, 15142, 66596, 43491,
+    54016, 26463, 37115, 23574, 67300, 62831, 12070, 31639, 58883, 12685, 25413, 46278, 44773, 68292, 37430, 24334,
+    68845, 1895, 14142, 26648, 29378, 53345, 47143, 34823, 41403, 17937, 20895, 50301, 22784, 69229, 56307, 32067,
+    714, 32770, 36357, 60716, 68489, 24997, 20616, 19408, 23764, 9136, 52640, 51122, 44008, 37685, 23397, 47834,
+    1135, 24091, 61917, 11093, 68632, 34502, 14759, 18843, 3816, 4299, 6939, 18935, 58397, 44011, 43660, 15517,
+    65381, 66883, 61148, 44837, 62733, 29808, 52520, 61061, 17192, 45953, 6290, 61288, 46041, 65404, 49694, 58732,
+    17602, 22140, 32960, 45855, 50188, 55017, 56381, 17337, 54790, 49235, 27979, 49219, 59252, 44614, 57925, 40385,
+    65068, 58520, 43987, 7620, 57068, 32753, 52819, 18514, 24196, 27001, 13417, 31374, 8266, 57201, 32987, 61009,
+    58509, 5980, 63884, 17828, 44160, 34849, 45722, 54323, 11981, 50124, 14623, 43005, 52690, 68532, 19693, 26066,
+    54959, 13531, 33476, 63928, 45314, 24444, 47267, 52835, 42517, 67155, 63909, 52261, 2229, 44782, 54196, 47006,
+    6935, 16916, 69901, 41926, 55895, 70040, 69539, 17167, 18028, 19104, 19328, 64991, 38856, 68231, 9161, 39383,
+    59480, 7725, 34702, 19222, 10939, 55614, 14309, 27781, 3945, 57584, 13666, 66676, 24921, 42367, 36068, 64949,
+    50594, 22353, 6289, 53225, 38090, 27394, 33747, 48767, 51689, 36046, 45256, 44961, 30715, 24671, 46361, 24829,
+    42619, 24292, 68958, 8253, 40267, 14581, 20121, 54864, 67841, 60516, 47506, 29636, 39072, 3540, 69092, 64104,
+    25177, 52614, 50371, 60916, 42527, 54045, 19042, 35526, 25573, 22832, 51269, 5028, 19668, 26822, 49761, 1824,
+    21217, 40247, 25423, 53049, 51923, 30536, 58450, 29704, 10951, 10899, 11153, 44928, 19625, 2505, 48855, 64748,
+    32438, 63301, 67055, 62581, 35671, 19732, 55801, 37956, 30410, 14651, 53749, 19175, 3895, 13355, 38072, 7470,
+    19427, 24717, 2371, 48110, 12182, 7798, 58231, 42099, 23873, 50915, 46042, 28951, 3858, 56370, 59913, 8635,
+    67992, 28703, 48400, 5982, 6315, 55035, 59710, 12218, 5876, 17413, 17022, 7906, 20978, 33390, 50330, 13154,
+    9693, 53238, 30457, 35065, 17745, 18218, 18121, 15020, 46488, 27863, 58939, 26855, 29238, 32339, 44042, 13159,
+    23848, 66298, 34370, 67947, 68499, 56129, 14425, 54832, 60129, 32297, 24076, 14334, 15745, 38279, 60076, 58341,
+    52264, 37117, 4514, 28429, 26346, 70523, 62377, 2359, 70493, 41249, 54796, 950, 65885, 31765, 10532, 26485,
+    47296, 5924, 6421, 60841, 24177, 55334, 18992, 13106, 18761, 6323, 35097, 45708, 65524, 5776, 7033, 59923,
+    55940, 14662, 25037, 40292, 11667, 49476, 20596, 4887, 20679, 48691, 41494, 24943, 47340, 40800, 46831, 56014,
+    43939, 17856, 52170, 58167, 11849, 3672, 52727, 24019, 22379, 20202, 29065, 34824, 20423, 35737, 31829, 21605,
+    21970, 60023, 58257, 2732, 16188, 5408, 45564, 32452, 41845, 17668, 52231, 20680, 49639, 18473, 17522, 50260,
+    24041, 39644, 28348, 68907, 47389, 68408, 28013, 31393, 61350, 41177, 10578, 30453, 50879, 62647, 51911, 57620,
+    16467, 35644, 63944, 53602, 15431, 37105, 64637, 42469, 54488, 59332, 66781, 61306, 41136, 14825, 42727, 3387,
+    3280, 7417, 67126, 60068, 33717, 12939, 38372, 32511, 43043, 55240, 67473, 6429, 38807, 2636, 50936, 68363,
+    33621, 41095, 70381, 49744, 2867, 32206, 26817, 24952, 29905, 55860, 18234, 42693, 65554, 70153, 25966, 37424,
+    17526, 20821, 58023, 52872, 56952, 37648, 46897, 7778, 51726, 67810, 52758, 46818, 51989, 1298, 1675, 18928,
+    43992, 32674, 55143, 19714, 2967, 42792, 30209, 43470, 40491, 21489, 43298, 40122, 9306, 70442, 30255,
+}};
+
+} // namespace xsk::gsc::iw8
@@ -0,0 +1,238 @@
+// Copyright 2021 xensik. All rights reserved.
+//
+// Use of this source code is governed by a GNU GPLv3 license
+// that can be found in the LICENSE file.
+
+// generated by gen/resolver.py, do not edit
+
+#pragma once
+
+namespace xsk::gsc::s1
+{
+
+constexpr std::array<std::int32_t, 38> opcode_hash_seeds
+{{
+    7, 10, 3, 13, 10, 243, 5, 165, 0, 135, 7, 255, 2, 433, 2, 142,
+    430, 257, 1, 275, 20, -96, 11, 687, 3, 606, 15, 735, 7, 16, 0, 79,
+    357, 490, 186, -71, 0, 1743,
+}};
+
+constexpr std::array<std::uint32_t, 154> opcode_hash_slots
+{{
+    46, 55, 115, 123, 25, 129, 143, 132, 105, 61, 69, 49, 145, 138, 84, 29,
+    58, 70, 15, 28, 125, 131, 34, 127, 150, 89, 35, 43, 59, 128, 5, 11,
+    48, 7, 67, 66, 148, 146, 90, 83, 32, 24, 122, 151, 37, 92, 26, 81,
+    149, 111, 71, 117, 114, 80, 78, 36, 98, 126, 86, 142, 52, 56, 73, 79,
+    12, 76, 57, 47, 88, 1, 40, 4, 42, 104, 108, 110, 109, 116, 45, 107,
+    152, 99, 112, 82, 96, 135, 17, 85, 51, 75, 31, 141, 21, 64, 94, 120,
+    18, 113, 93, 0, 97, 119, 147, 6, 101, 72, 38, 54, 8, 121, 103, 2,
+    87, 124, 136, 53, 134, 91, 14, 137, 50, 153, 133, 130, 10, 118, 22, 60,
+    39, 95, 30, 44, 106, 20, 19, 62, 41, 27, 63, 16, 74, 100, 13, 68,
+    33, 9, 23, 140, 3, 102, 139, 65, 77, 144,
+}};
+
+constexpr std::array<std::int32_t, 183> function_hash_seeds
+{{
+    9, 3, 130, 6, 8, 3, 39, 1, 12, 0, 10, 34, 1, -703, 107, 117,
+    3, 30, 1, 29, 75, 1, 84, 33, 195, 11, 47, 81, 50, 1, 598, 52,
+    1, 9, 23, 16, 85, 63, 3, 37, 394, 386, 269, 420, 2, 3, 131, 69,
+    11, 730, 12, 36, 1, 6, 1, 659, 95, 462, 160, 137, 33, 407, 3, 13,
+    8, 1, 391, 8, 9, 4, 10, 0, 2, 3, 52, 0, 17, 819, 7, 10,
+    287, 112, -650, 59, 0, 29, 21, 8, 628, 2, 12, 150, 37, 242, 5, 5,
+    389, 2, 23, 6, 269, 2, 2, 41, 13, 81, 36, 107, 543, 22, 11, -586,
+    23, 3, 21, 38, 863, 1143, 13, 187, 17, 159, 4, 53, 69, 82, 148, 8,
+    3, 460, 839, 50, 86, 27, 3, 3, 166, 230, 628, 100, 311, 5, 7, 839,
+    550, 1, 3103, 667, 13, 10, 2, 1340, 42, -542, 4, 2, 671, 3, 8, 40,
+    817, 2169, 872, 31, 729, 7, 177, 595, 993, 5146, 95, 32, 845, 54, 128, 7471,
+    20, 1, -382, 67, 417, 1133, -356,
+}};
+
+constexpr std::array<std::uint32_t, 735> function_hash_slots
+{{
+    24, 481, 194, 71, 26, 667, 215, 733, 710, 332, 73, 430, 75, 509, 15, 411,
+    589, 29, 724, 54, 154, 313, 125, 387, 662, 211, 183, 181, 91, 169, 77, 240,
+    611, 364, 431, 532, 479, 81, 588, 225, 582, 600, 418, 496, 123, 719, 668, 644,
+    518, 503, 701, 212, 189, 610, 68, 21, 429, 122, 168, 533, 664, 716, 576, 217,
+    109, 608, 659, 111, 537, 16, 198, 593, 207, 493, 633, 84, 621, 390, 358, 120,
+    223, 228, 356, 334, 53, 371, 577, 660, 314, 498, 161, 618, 655, 530, 78, 624,
+    519, 679, 554, 731, 517, 472, 32, 148, 174, 722, 414, 469, 598, 238, 282, 103,
+    475, 18, 565, 612, 596, 62, 534, 83, 97, 510, 351, 134, 326, 457, 689, 729,
+    400, 82, 300, 567, 349, 670, 47, 301, 315, 545, 557, 7, 462, 413, 563, 556,
+    474, 308, 486, 348, 483, 85, 402, 87, 564, 325, 687, 631, 449, 672, 420, 440,
+    10, 477, 297, 525, 511, 237, 407, 566, 399, 696, 378, 409, 98, 135, 480, 579,
+    374, 296, 93, 8, 309, 248, 467, 6, 305, 665, 597, 192, 261, 156, 691, 127,
+    376, 43, 578, 398, 92, 727, 601, 423, 550, 307, 319, 245, 523, 494, 614, 275,
+    142, 408, 64, 490, 365, 491, 516, 694, 155, 394, 643, 242, 144, 22, 58, 712,
+    333, 438, 164, 49, 2, 623, 108, 204, 303, 368, 676, 353, 513, 196, 42, 395,
+    675, 427, 497, 205, 342, 327, 343, 4, 641, 489, 287, 175, 266, 580, 190, 585,
+    685, 186, 465, 421, 561, 500, 476, 233, 383, 335, 1, 218, 293, 446, 158, 252,
+    250, 265, 239, 187, 688, 620, 728, 339, 254, 702, 463, 224, 568, 89, 172, 647,
+    340, 36, 149, 184, 640, 732, 700, 116, 264, 39, 100, 560, 153, 320, 41, 478,
+    367, 651, 104, 14, 627, 415, 171, 697, 128, 170, 191, 106, 521, 33, 548, 48,
+    44, 352, 121, 235, 292, 569, 452, 290, 150, 372, 230, 95, 454, 504, 552, 451,
+    505, 680, 412, 656, 317, 703, 270, 318, 506, 57, 167, 726, 202, 96, 203, 94,
+    256, 652, 19, 540, 458, 129, 433, 115, 575, 482, 388, 648, 444, 200, 209, 512,
+    473, 70, 715, 432, 529, 642, 615, 553, 686, 445, 229, 357, 278, 157, 80, 526,
+    695, 140, 102, 23, 61, 632, 583, 379, 484, 246, 284, 607, 435, 55, 663, 619,
+    182, 684, 310, 226, 599, 350, 131, 330, 616, 604, 50, 626, 302, 613, 522, 441,
+    60, 439, 119, 35, 573, 112, 581, 234, 361, 617, 20, 369, 541, 304, 281, 299,
+    210, 459, 434, 709, 654, 306, 274, 559, 147, 355, 51, 72, 456, 682, 285, 277,
+    236, 681, 208, 549, 425, 180, 443, 464, 341, 466, 373, 721, 331, 671, 377, 527,
+    63, 141, 273, 630, 416, 410, 706, 260, 591, 514, 571, 337, 602, 698, 468, 288,
+    105, 177, 381, 347, 231, 543, 166, 124, 714, 382, 570, 629, 56, 363, 384, 255,
+    241, 391, 11, 661, 143, 280, 392, 707, 405, 547, 283, 76, 542, 471, 269, 232,
+    289, 592, 528, 531, 595, 385, 321, 37, 247, 442, 322, 110, 99, 404, 79, 558,
+    645, 375, 133, 159, 587, 437, 316, 634, 66, 31, 487, 403, 386, 574, 279, 594,
+    344, 276, 450, 605, 717, 267, 201, 725, 389, 86, 424, 699, 673, 312, 720, 298,
+    220, 346, 139, 396, 286, 40, 428, 501, 345, 690, 625, 704, 520, 258, 3, 692,
+    27, 107, 488, 324, 272, 461, 30, 151, 214, 666, 163, 515, 572, 145, 268, 12,
+    470, 176, 544, 447, 74, 137, 417, 17, 718, 653, 195, 678, 609, 38, 118, 216,
+    244, 136, 637, 535, 657, 448, 622, 638, 406, 584, 262, 138, 635, 46, 323, 436,
+    669, 206, 492, 734, 243, 88, 263, 649, 0, 730, 259, 401, 65, 360, 25, 117,
+    336, 9, 52, 495, 165, 45, 113, 603, 13, 199, 366, 586, 173, 34, 295, 499,
+    539, 453, 708, 628, 257, 705, 338, 606, 213, 362, 639, 90, 271, 179, 370, 188,
+    311, 723, 152, 251, 562, 658, 551, 160, 524, 329, 508, 222, 677, 636, 555, 253,
+    162, 507, 197, 538, 713, 249, 646, 683, 393, 693, 590, 126, 291, 219, 359, 132,
+    354, 101, 485, 227, 422, 380, 460, 674, 193, 455, 650, 67, 130, 426, 397, 5,
+    546, 419, 59, 536, 185, 114, 502, 69, 711, 328, 294, 28, 146, 178, 221,
+}};
+
+constexpr std::array<std::int32_t, 347> method_hash_seeds
+{{
+    343, 24, 6, 0, 8, 3, -1308, 11, 2, 0, 20, 41, 650, 106, 16, 7,
+    134, 2, 95, 16, 3, 19, 1, 42, -1276, 15, 104, 3, 2, 35, 10, -1230,
+    3, 6, 214, 42, 15, 51, 4, 33, 1, 65, 13, 0, 4, 2, 39, 290,
+    2, 128, 4, 48, 211, 22, 92, 124, 26, 27, 18, 7, 24, 1, 294, 528,
+    32, 16, 9, 59, 11, 7, 2, 2, -1182, 5, 241, 1, 16, 171, 177, -1173,
+    7, 11, -1077, 4, 1, 7, 1, 34, 7, -1021, 28, 327, 25, 2, 2, 165,
+    12, 34, 96, 647, 2, 5, 142, 40, 15, 2, 5, 10, 47, 7, -972, 4,
+    73, 686, 4, 50, -961, 430, -955, 8, 59, 40, 66, 3, 38, 138, 238, 19,
+    40, 137, 10, 2, 119, 41, 163, -872, 14, 1, 17, 12, -842, 289, 1, 227,
+    37, 1, 3, 0, 52, 61, 7, 230, 57, 356, 1, 86, -797, 1, 44, 8,
+    252, 16, 4, 2, -724, 4, 46, -703, 102, 68, 175, 21, 338, 96, 3, 180,
+    3, 241, 13, -624, 64, 91, 40, 2, -596, 40, 191, 295, 85, 316, 22, 17,
+    441, 52, 1, 6, 270, 1, 443, 102, 1, 261, 915, 2, 37, 3, 114, 263,
+    163, 5, 43, 23, 0, -518, 29, 1, 59, -513, -487, 302, 2, 130, 557, 88,
+    215, 12, 131, 92, 26, 42, 128, 67, 153, 7, 302, 0, 1, 11, 158, 7,
+    24, 216, 13, 72, 1599, 15, 48, 2, 9, -415, 3, 3, -277, 1, 49, 368,
+    5, 1310, 1, 2, 994, 71, 1449, -226, 8, 88, -211, 395, 410, 30, 5, 46,
+    11, 452, 32, 88, 5, 64, 6, 741, 23, 608, 95, 4, 132, 17, 16, 738,
+    642, 416, 188, 450, 23, 2489, 338, 1246, 2, 52, 545, 65, 2, 8, 126, 377,
+    86, 127, 4, 15, 1296, 64, -155, -76, 49, 5, 341, 332, 1208, 1576, 5, 42,
+    1, 1103, 1155, 426, 628, 20, 248, 1, 108, 336, 1, 1223, 4, 13, 26, -64,
+    102, 7, 26, 85, 79, 3404, 62, 43, 1, 93, 2133,
+}};
+
+constexpr std::array<std::uint32_t, 1389> method_hash_slots
+{{
+    1012, 1207, 151, 194, 113, 751, 1025, 189, 996, 1333, 6, 858, 1201, 626, 173, 455,
+    730, 1321, 704, 776, 491, 342, 853, 1080, 307, 901, 369, 155, 100, 742, 1251, 786,
+    1368, 696, 931, 810, 762, 1280, 803, 295, 480, 990, 861, 1204, 176, 600, 58, 1167,
+    1030, 224, 1245, 1367, 1113, 1190, 1266, 1043, 687, 1318, 664, 139, 175, 949, 1162, 844,
+    419, 197, 666, 616, 808, 1247, 267, 592, 516, 1325, 1198, 1069, 54, 495, 685, 423,
+    479, 1199, 1181, 999, 476, 1297, 1139, 864, 213, 44, 915, 1290, 51, 590, 366, 288,
+    957, 1052, 1040, 680, 1216, 682, 1381, 133, 120, 982, 128, 737, 146, 1375, 1048, 262,
+    505, 143, 654, 53, 555, 1164, 126, 544, 1079, 48, 1033, 403, 650, 735, 579, 28,
+    1331, 460, 136, 412, 911, 720, 190, 964, 1372, 161, 174, 75, 632, 436, 1109, 571,
+    781, 347, 543, 276, 1260, 138, 311, 1250, 445, 1053, 1003, 1304, 169, 1082, 785, 906,
+    481, 830, 196, 941, 247, 585, 1212, 285, 486, 107, 805, 36, 1096, 852, 418, 1258,
+    661, 1222, 1103, 264, 943, 26, 214, 226, 643, 345, 87, 290, 689, 870, 43, 1051,
+    510, 812, 953, 319, 114, 903, 218, 540, 684, 134, 648, 926, 1357, 303, 468, 961,
+    1215, 946, 77, 1014, 1022, 1024, 496, 942, 456, 469, 601, 255, 1105, 517, 482, 1330,
+    824, 1235, 437, 631, 605, 250, 1102, 1228, 656, 726, 157, 99, 566, 806, 1365, 1205,
+    846, 236, 563, 313, 34, 595, 1065, 899, 7, 539, 883, 112, 1117, 364, 31, 714,
+    1287, 1104, 513, 644, 1073, 400, 905, 166, 13, 195, 1386, 309, 150, 756, 251, 690,
+    1008, 352, 636, 427, 1101, 62, 1045, 209, 41, 914, 1050, 992, 1146, 1032, 380, 933,
+    533, 429, 71, 755, 191, 249, 260, 199, 1118, 129, 627, 442, 876, 1384, 702, 695,
+    1093, 1291, 589, 778, 68, 335, 553, 1326, 17, 1361, 9, 32, 591, 1327, 1060, 859,
+    787, 91, 1360, 378, 327, 320, 1337, 797, 433, 796, 1123, 1298, 98, 875, 655, 109,
+    296, 1307, 822, 396, 1011, 1328, 857, 981, 693, 1177, 70, 370, 960, 315, 793, 1342,
+    1256, 503, 1373, 1248, 878, 734, 971, 774, 740, 90, 816, 397, 74, 541, 272, 820,
+    181, 547, 1132, 1072, 1282, 801, 1178, 625, 1339, 339, 564, 465, 1041, 310, 937, 73,
+    766, 1320, 1369, 866, 96, 353, 614, 798, 1274, 258, 212, 122, 928, 162, 321, 917,
+    706, 1161, 333, 873, 531, 1129, 467, 1221, 761, 955, 1246, 11, 719, 448, 662, 376,
+    770, 410, 651, 675, 1388, 372, 1006, 1249, 817, 19, 947, 542, 322, 16, 811, 1341,
+    254, 386, 1262, 408, 1023, 976, 1191, 1259, 39, 1180, 722, 628, 220, 447, 993, 1362,
+    1273, 1091, 69, 925, 149, 1085, 101, 63, 1202, 256, 821, 551, 1374, 548, 716, 604,
+    758, 292, 18, 535, 1264, 192, 900, 1158, 974, 1377, 225, 407, 4, 792, 1141, 678,
+    118, 185, 252, 889, 736, 103, 1112, 773, 707, 1350, 884, 76, 1355, 1376, 1349, 748,
+    2, 1334, 60, 559, 1124, 1218, 454, 474, 818, 1188, 83, 278, 886, 1017, 833, 739,
+    800, 500, 649, 789, 104, 578, 12, 439, 105, 1172, 1066, 368, 609, 326, 379, 1039,
+    1239, 1358, 1094, 392, 790, 1276, 574, 130, 1063, 22, 1269, 576, 358, 297, 351, 208,
+    1056, 668, 382, 619, 230, 1183, 477, 279, 669, 711, 165, 760, 506, 994, 639, 1378,
+    1192, 1021, 27, 1108, 344, 457, 663, 40, 894, 431, 373, 802, 1338, 863, 524, 1379,
+    986, 1371, 902, 1284, 1027, 948, 1152, 1203, 918, 1237, 1077, 1301, 1125, 965, 163, 606,
+    867, 679, 404, 1336, 958, 374, 565, 35, 360, 1047, 1149, 562, 59, 84, 597, 441,
+    1311, 768, 921, 282, 1234, 317, 1147, 318, 641, 1130, 280, 141, 570, 642, 1131, 1348,
+    927, 205, 586, 596, 1283, 110, 1119, 939, 1035, 365, 741, 1015, 777, 426, 451, 634,
+    985, 1299, 1106, 975, 187, 1185, 286, 1086, 845, 909, 145, 530, 458, 3, 653, 1189,
+    780, 725, 1302, 731, 897, 1359, 1182, 1054, 137, 1347, 1107, 913, 1208, 594, 794, 281,
+    759, 646, 546, 337, 124, 159, 1184, 723, 45, 504, 471, 385, 38, 1075, 677, 316,
+    211, 1140, 764, 814, 356, 1111, 483, 904, 765, 25, 871, 622, 444, 936, 8, 1335,
+    391, 338, 384, 638, 1098, 728, 935, 1232, 29, 494, 856, 1046, 242, 127, 223, 371,
+    246, 202, 239, 1387, 398, 983, 416, 688, 1279, 86, 1095, 908, 694, 1057, 289, 988,
+    1213, 624, 79, 538, 417, 1241, 633, 1265, 1286, 1200, 855, 657, 1345, 1340, 528, 277,
+    1211, 838, 826, 972, 995, 49, 827, 489, 1225, 836, 42, 399, 449, 283, 355, 843,
+    665, 46, 1088, 367, 692, 733, 703, 829, 848, 428, 923, 395, 1268, 804, 470, 1366,
+    608, 271, 172, 1064, 837, 715, 411, 293, 52, 328, 1155, 464, 930, 97, 984, 1097,
+    263, 771, 709, 332, 671, 47, 238, 269, 1137, 1238, 807, 1138, 1310, 485, 261, 1028,
+    1197, 1020, 415, 612, 1150, 1055, 1078, 330, 779, 331, 1195, 587, 186, 660, 0, 450,
+    147, 466, 509, 782, 425, 1010, 1312, 554, 438, 959, 1370, 882, 488, 1306, 1170, 888,
+    459, 1121, 1160, 945, 615, 1194, 298, 383, 1114, 1090, 924, 324, 329, 877, 1324, 1275,
+    1351, 362, 743, 1175, 221, 1061, 1231, 1145, 511, 1142, 183, 580, 140, 144, 1099, 1110,
+    998, 851, 1016, 868, 237, 92, 106, 381, 1209, 414, 1163, 1058, 57, 323, 245, 602,
+    697, 700, 907, 1296, 123, 893, 1254, 475, 561, 847, 1070, 819, 545, 724, 340, 1,
+    767, 572, 287, 569, 284, 757, 1255, 1289, 699, 549, 842, 746, 1168, 1380, 1001, 350,
+    979, 108, 234, 1219, 294, 588, 265, 1346, 583, 10, 266, 125, 1049, 520, 243, 89,
+    956, 1059, 713, 1236, 409, 1277, 556, 691, 446, 1305, 788, 980, 1356, 1210, 940, 180,
+    637, 1329, 244, 1319, 611, 763, 1257, 550, 1037, 153, 1156, 72, 932, 168, 499, 970,
+    453, 228, 1115, 1143, 896, 314, 80, 1313, 567, 1071, 219, 305, 874, 1206, 154, 991,
+    304, 1343, 229, 1382, 841, 1116, 346, 21, 443, 1196, 573, 1309, 121, 969, 152, 1186,
+    879, 652, 1044, 24, 750, 1092, 869, 839, 1013, 1126, 170, 772, 1253, 1179, 1018, 865,
+    487, 618, 1226, 1244, 1171, 952, 66, 348, 240, 963, 203, 394, 747, 55, 967, 1002,
+    135, 1074, 705, 621, 1134, 248, 537, 50, 343, 784, 1278, 1151, 148, 1270, 23, 235,
+    1344, 275, 1288, 1353, 630, 434, 834, 1084, 916, 1173, 501, 950, 232, 727, 116, 525,
+    484, 1136, 754, 498, 1120, 171, 1252, 1308, 1081, 493, 273, 200, 1128, 1034, 492, 783,
+    1293, 85, 334, 253, 527, 178, 301, 568, 854, 308, 1271, 850, 672, 828, 721, 1364,
+    891, 184, 938, 1285, 472, 1007, 795, 1026, 1292, 405, 673, 749, 1322, 753, 204, 718,
+    831, 769, 94, 115, 1019, 312, 536, 929, 389, 430, 81, 233, 951, 1229, 1122, 102,
+    461, 299, 198, 944, 557, 752, 1315, 623, 647, 1100, 813, 892, 823, 497, 840, 607,
+    962, 968, 160, 815, 849, 359, 257, 518, 558, 259, 514, 521, 117, 1031, 954, 710,
+    1154, 712, 920, 14, 1385, 1005, 1068, 300, 887, 167, 1076, 1300, 1233, 529, 1000, 1314,
+    744, 210, 522, 1316, 681, 701, 1261, 880, 268, 1214, 142, 670, 61, 274, 306, 1135,
+    188, 88, 413, 617, 667, 1083, 502, 432, 164, 1159, 363, 193, 862, 825, 1230, 387,
+    393, 552, 231, 593, 791, 158, 93, 809, 1169, 922, 1089, 881, 978, 206, 1224, 1153,
+    463, 910, 1294, 440, 357, 683, 1029, 1383, 934, 1317, 1174, 95, 515, 1352, 302, 1295,
+    860, 534, 523, 912, 1038, 997, 65, 354, 645, 420, 207, 37, 452, 1272, 775, 402,
+    422, 270, 613, 1217, 629, 745, 1042, 640, 1165, 67, 177, 1240, 898, 582, 507, 560,
+    131, 674, 111, 977, 659, 599, 406, 377, 1227, 119, 156, 686, 581, 182, 532, 1193,
+    1323, 1220, 1157, 241, 987, 82, 635, 375, 1127, 698, 732, 973, 388, 291, 1332, 1133,
+    885, 1062, 401, 835, 1363, 1263, 598, 1176, 1187, 341, 64, 462, 717, 5, 738, 56,
+    490, 1243, 361, 895, 1166, 1144, 1148, 966, 217, 1067, 222, 15, 676, 336, 179, 1009,
+    20, 832, 132, 1303, 30, 1004, 1267, 508, 603, 1242, 708, 610, 872, 658, 227, 216,
+    424, 584, 215, 78, 421, 919, 890, 575, 201, 519, 620, 473, 390, 1223, 577, 349,
+    512, 1087, 989, 526, 799, 1281, 33, 1354, 1036, 435, 729, 478, 325,
+}};
+
+constexpr std::array<std::int32_t, 3> file_hash_seeds
+{{
+    57, 1, 42,
+}};
+
+constexpr std::array<std::uint32_t, 13> file_hash_slots
+{{
+    9, 6, 10, 1, 11, 5, 7, 4, 12, 0, 3, 8, 2,
+}};
+
+constexpr std::array<std::int32_t, 6> token_hash_seeds
+{{
+    6, 1, 11, 6, 264, 94,
+}};
+
+constexpr std::array<std::uint32_t, 25> token_hash_slots
+{{
+    16, 12, 5, 21, 1, 7, 19, 23, 14, 2, 20, 24, 9, 22, 0, 3,
+    11, 17, 10, 13, 15, 4, 6, 8, 18,
+}};
+
+} // namespace xsk::gsc::s1
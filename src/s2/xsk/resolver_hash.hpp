@@ -0,0 +1,283 @@
+// Copyright 2021 xensik. All rights reserved.
+//
+// Use of this source code is governed by a GNU GPLv3 license
+// that can be found in the LICENSE file.
+
+// generated by gen/resolver.py, do not edit
+
+#pragma once
+
+namespace xsk::gsc::s2
+{
+
+constexpr std::array<std::int32_t, 38> opcode_hash_seeds
+{{
+    15, 83, 1, 3, 160, 4, 37, 68, 0, 15, 6, 507, 4, 506, 124, 20,
+    160, 945, 1, 154, 5, -86, 28, 87, 5, 76, 500, 728, 12, 57, 0, 31,
+    91, 837, 356, -34, 0, 1229,
+}};
+
+constexpr std::array<std::uint32_t, 155> opcode_hash_slots
+{{
+    94, 123, 93, 67, 56, 85, 98, 76, 153, 60, 114, 144, 117, 90, 13, 87,
+    71, 142, 30, 80, 52, 100, 112, 41, 62, 23, 141, 109, 108, 81, 146, 59,
+    12, 40, 10, 34, 72, 55, 89, 136, 106, 78, 113, 82, 20, 84, 24, 65,
+    29, 36, 28, 14, 124, 139, 49, 50, 21, 5, 118, 46, 73, 97, 45, 9,
+    22, 61, 107, 43, 145, 27, 128, 105, 134, 16, 3, 104, 6, 38, 88, 18,
+    147, 63, 8, 119, 66, 120, 150, 70, 68, 47, 126, 17, 37, 4, 122, 131,
+    19, 95, 115, 130, 64, 133, 132, 15, 69, 11, 135, 25, 48, 39, 125, 74,
+    75, 0, 51, 57, 99, 32, 152, 148, 110, 103, 42, 92, 1, 35, 58, 91,
+    102, 86, 7, 44, 53, 2, 138, 83, 96, 154, 129, 143, 54, 137, 116, 31,
+    101, 26, 111, 127, 79, 121, 151, 140, 77, 149, 33,
+}};
+
+constexpr std::array<std::int32_t, 250> function_hash_seeds
+{{
+    -987, 2, 111, 6, 22, 1, 8, 1, 6, 0, 84, 65, 5, 1, 4, 75,
+    -939, 85, 1, 2, 1, 408, 1, 24, 109, 42, 101, 115, 8, 5, 1, 2,
+    22, 81, 53, 33, 28, 11, 10, 200, 7, 7, 2, 875, 1, 55, 69, 47,
+    13, -864, 120, 249, 4, 136, 3, 48, 5, 9, 15, 83, 2, 3, 1, 180,
+    4, 181, 3, 3, 8, -821, 238, 46, 1, 76, 4, -534, 14, 4, 188, 87,
+    5, 5, -405, 1, 54, 18, 60, 1, 7, 4, 6, 126, 11, 1, 25, 65,
+    7, 9, 292, 91, 79, 2, 6, 179, 460, 27, 237, 7, 1014, 954, 9, 30,
+    221, 45, 19, 3, 8, 367, 61, 1, 149, 3, 12, 138, 1, 62, 14, 16,
+    0, -339, 14, 7, 101, 13, 118, 23, -193, 55, 6, 23, 0, 9, 77, 3,
+    221, 54, 79, 100, 1, 35, 149, 480, 9, 110, 14, 13, 138, -165, 32, 786,
+    5, 596, 103, -154, 69, 361, 67, -152, 24, 98, 370, 164, 112, 204, 9, 26,
+    30, 527, 66, -141, 71, 190, 0, 34, 3, 29, 521, 396, 598, 123, 1, 145,
+    383, 153, 2230, 3613, 7, 140, 1, 757, 26, -100, 933, 12, 3268, 135, 10, 2,
+    13, 1, 38, 55, 51, 12, 879, 103, 3, 706, 93, 255, 906, 6, 51, 233,
+    391, 160, -66, 1802, 9, 521, 19, 19, 3, 43, 1084, 18, 8812, 113, 45, 306,
+    274, 1409, 138, 220, 1, -22, 223, 86, 2, 1253,
+}};
+
+constexpr std::array<std::uint32_t, 1000> function_hash_slots
+{{
+    451, 899, 272, 205, 724, 846, 41, 66, 539, 936, 536, 105, 221, 21, 502, 83,
+    90, 720, 32, 884, 96, 834, 604, 994, 956, 262, 860, 181, 273, 417, 538, 706,
+    99, 932, 922, 921, 964, 20, 547, 206, 119, 421, 733, 27, 158, 841, 130, 314,
+    381, 449, 80, 467, 252, 76, 154, 198, 284, 673, 486, 528, 278, 478, 476, 281,
+    91, 226, 760, 764, 462, 466, 282, 806, 326, 174, 543, 193, 312, 998, 187, 4,
+    664, 271, 586, 151, 574, 15, 617, 715, 740, 692, 782, 13, 815, 695, 277, 997,
+    676, 969, 619, 460, 665, 916, 479, 297, 438, 175, 256, 791, 37, 1, 610, 135,
+    214, 423, 556, 552, 166, 521, 823, 360, 399, 609, 161, 731, 882, 347, 118, 742,
+    824, 25, 390, 384, 858, 444, 348, 185, 912, 645, 565, 408, 913, 618, 784, 213,
+    482, 990, 492, 510, 453, 361, 92, 505, 14, 323, 493, 42, 775, 332, 94, 729,
+    948, 223, 681, 264, 388, 777, 845, 530, 364, 773, 750, 684, 241, 380, 35, 671,
+    12, 220, 320, 178, 516, 822, 63, 744, 244, 578, 629, 641, 687, 518, 355, 426,
+    238, 602, 568, 313, 308, 746, 506, 701, 286, 207, 28, 437, 352, 288, 787, 818,
+    838, 730, 830, 603, 95, 633, 616, 456, 976, 605, 535, 382, 926, 832, 106, 726,
+    461, 338, 979, 620, 230, 170, 227, 885, 842, 234, 137, 481, 560, 590, 909, 208,
+    457, 44, 709, 129, 759, 72, 902, 363, 148, 19, 251, 269, 810, 853, 644, 790,
+    424, 722, 600, 389, 413, 519, 93, 84, 16, 203, 570, 723, 490, 233, 125, 514,
+    60, 714, 955, 291, 648, 123, 469, 232, 293, 55, 849, 878, 302, 863, 632, 819,
+    569, 34, 435, 386, 987, 939, 626, 840, 395, 290, 697, 359, 439, 908, 311, 46,
+    127, 303, 68, 653, 937, 239, 804, 890, 458, 954, 287, 978, 661, 442, 362, 532,
+    7, 387, 931, 557, 428, 373, 36, 418, 336, 177, 674, 455, 507, 425, 209, 585,
+    309, 693, 179, 346, 785, 741, 935, 325, 876, 707, 97, 685, 555, 263, 131, 163,
+    433, 403, 317, 943, 928, 907, 797, 694, 270, 33, 143, 171, 611, 412, 328, 431,
+    703, 189, 268, 865, 173, 527, 114, 298, 279, 788, 475, 410, 573, 826, 121, 551,
+    283, 300, 906, 316, 779, 160, 524, 708, 259, 755, 572, 869, 735, 358, 353, 678,
+    757, 8, 658, 677, 276, 940, 188, 957, 820, 350, 145, 172, 566, 45, 140, 144,
+    927, 152, 134, 811, 427, 561, 351, 305, 109, 378, 667, 941, 831, 89, 871, 946,
+    672, 480, 108, 894, 638, 881, 814, 75, 219, 299, 331, 50, 929, 440, 415, 829,
+    422, 368, 477, 318, 554, 799, 366, 196, 56, 870, 576, 204, 315, 182, 623, 991,
+    813, 614, 243, 48, 598, 699, 491, 914, 734, 553, 248, 718, 915, 489, 117, 190,
+    634, 523, 546, 973, 18, 961, 237, 254, 668, 597, 473, 529, 920, 107, 924, 79,
+    587, 416, 54, 659, 652, 65, 517, 0, 400, 210, 825, 533, 868, 698, 116, 768,
+    879, 6, 51, 850, 765, 22, 504, 327, 38, 86, 224, 688, 732, 548, 980, 883,
+    319, 967, 923, 981, 24, 812, 727, 146, 852, 895, 770, 752, 113, 157, 803, 5,
+    465, 2, 966, 950, 112, 942, 637, 61, 57, 649, 235, 904, 721, 808, 986, 774,
+    375, 365, 571, 136, 583, 794, 184, 132, 98, 349, 594, 625, 970, 793, 889, 575,
+    540, 545, 100, 280, 165, 711, 982, 115, 919, 335, 102, 87, 494, 949, 848, 149,
+    369, 896, 647, 215, 767, 660, 414, 613, 407, 944, 503, 544, 445, 162, 534, 404,
+    702, 394, 911, 837, 886, 64, 958, 593, 599, 650, 409, 212, 236, 156, 843, 542,
+    839, 9, 971, 247, 917, 82, 474, 925, 549, 53, 766, 218, 222, 745, 636, 357,
+    861, 686, 324, 669, 261, 159, 322, 783, 111, 800, 591, 464, 856, 372, 459, 778,
+    975, 754, 446, 101, 901, 285, 952, 763, 558, 334, 246, 872, 749, 631, 736, 999,
+    847, 725, 945, 579, 391, 607, 432, 580, 739, 864, 657, 728, 321, 682, 985, 888,
+    893, 401, 758, 29, 245, 903, 592, 304, 258, 563, 402, 513, 719, 167, 880, 642,
+    257, 333, 776, 675, 192, 266, 253, 679, 550, 595, 508, 419, 43, 374, 974, 960,
+    62, 306, 393, 126, 485, 470, 801, 398, 789, 601, 531, 128, 635, 835, 200, 655,
+    483, 495, 371, 59, 40, 500, 589, 124, 430, 342, 867, 377, 656, 651, 689, 821,
+    771, 817, 496, 877, 155, 376, 448, 968, 526, 434, 713, 39, 933, 747, 995, 756,
+    851, 743, 577, 654, 3, 564, 606, 396, 628, 498, 938, 471, 761, 874, 680, 559,
+    406, 343, 345, 307, 195, 452, 103, 340, 781, 666, 310, 796, 963, 934, 807, 229,
+    354, 798, 515, 67, 691, 275, 52, 972, 385, 267, 918, 139, 11, 612, 795, 844,
+    522, 511, 225, 696, 965, 716, 436, 996, 344, 58, 816, 356, 910, 468, 70, 231,
+    69, 370, 640, 30, 690, 862, 341, 512, 805, 120, 47, 827, 240, 624, 147, 289,
+    501, 962, 202, 265, 274, 472, 26, 74, 420, 197, 930, 77, 405, 211, 836, 186,
+    717, 23, 608, 828, 180, 947, 339, 169, 49, 122, 855, 627, 484, 443, 953, 142,
+    463, 581, 792, 296, 993, 875, 383, 622, 700, 71, 737, 141, 866, 509, 582, 367,
+    984, 379, 330, 454, 392, 88, 250, 670, 397, 337, 450, 176, 217, 992, 887, 983,
+    216, 81, 643, 639, 704, 621, 859, 959, 525, 164, 662, 295, 191, 255, 802, 710,
+    520, 857, 891, 769, 104, 194, 873, 780, 441, 584, 951, 487, 646, 153, 292, 78,
+    663, 411, 854, 260, 183, 199, 447, 905, 133, 301, 897, 499, 31, 748, 567, 683,
+    429, 150, 329, 772, 738, 705, 497, 892, 988, 201, 596, 833, 989, 630, 753, 242,
+    541, 562, 249, 751, 85, 809, 762, 10, 615, 138, 168, 588, 17, 786, 294, 488,
+    898, 228, 900, 110, 712, 73, 537, 977,
+}};
+
+constexpr std::array<std::int32_t, 425> method_hash_seeds
+{{
+    15, 1, 21, 28, 19, 12, 27, 4, 58, 0, 55, 10, 81, 375, 2, 127,
+    -1654, 8, 16, 2, 14, 1, 32, 104, 16, 1, 22, 30, 133, 68, 13, -1647,
+    1, 7, 11, 51, 238, 81, 44, 23, 4, 71, 17, -1624, 95, 0, 243, 146,
+    100, 29, 21, 13, 80, 11, 46, 3, 1, 1, 1, 2, 4, 21, 113, 4,
+    -1612, -1533, 14, 2, 1, 4, 73, 4, 177, -1510, 180, 1, 23, 206, 50, -1509,
+    2, 2, 3, 19, -1236, 74, 167, -1204, 374, 194, 25, 22, 3, -1185, 25, 34,
+    591, 1, 39, 22, 7, 59, 5, 132, 4, 34, -1173, 72, 1, 4, 39, -1152,
+    0, 134, 3, 20, 1, 32, 470, 54, 7, 18, 13, 54, 0, 22, 14, 194,
+    815, 103, 8, 32, 50, 33, 1, 19, 28, 34, 438, 103, 8, 9, 721, -1100,
+    162, 41, 10, 310, 1, 1, 1, 8, 20, 4, 23, 11, 223, 1, 387, 5,
+    -1072, -1039, 1, 49, 186, 217, 4, 152, 134, 7, 72, 11, -1010, -941, 181, 10,
+    22, 3, 483, 18, 16, 16, 48, 2, 291, 42, 531, 129, 27, 2, 140, 128,
+    161, 1, 1, 83, 269, 39, 105, 0, 1, 9, 22, 11, 25, 4, 3, 189,
+    21, 8, 107, 4, 260, 75, 3, -927, 95, -923, 70, 4, 47, 8, 27, 13,
+    100, 787, -883, 22, 274, 47, 36, 22, 1, 2, 36, -839, 59, 325, 2, 132,
+    219, 229, 623, 54, -795, 47, 25, 52, 86, 427, 297, 351, 96, 18, 55, 75,
+    373, 0, 178, 119, 23, 1, 3, 105, 133, 7, 107, 276, -725, 9, 20, -719,
+    21, 41, 60, 5, 186, 20, -631, -603, 51, 1518, 4, 81, 2, 1043, 324, 257,
+    833, 1, 1404, 74, 371, -597, 1, 17, -577, 2707, 365, 62, 11, 3, 2, 1,
+    -562, 30, 1002, 245, 1, 47, 102, 146, 1633, 2, -400, 35, 216, 1, 20, 100,
+    17, 5, 899, 487, 1370, 183, 2, -358, 20, 508, 29, 2, -321, 1, -297, 1228,
+    684, 29, 1, 6, 1139, 86, 22, 2524, 523, 146, 1, 86, 5, 2, 201, 7,
+    -265, -234, 2, 11, 15, 434, 525, 942, 14, 962, -219, 14, 544, 125, -211, 76,
+    8, 113, 126, -186, 2, 1, 152, 340, 797, 412, 980, 214, 372, 1, -137, 1498,
+    731, 2, 2, 167, 7, -23, 2, 112, 37, 4, 54, 118, 15, 265, 2, 24,
+    212, 134, 136, 691, 25, 422, 1916, 1593, 1, 657, 29, 20, 1, 176, 2603, 22,
+    6, 3, -3, 278, 9, 1, 761, 3, 596,
+}};
+
+constexpr std::array<std::uint32_t, 1700> method_hash_slots
+{{
+    1553, 728, 192, 981, 1491, 810, 1181, 487, 1452, 815, 1356, 1292, 830, 1173, 204, 100,
+    1237, 392, 1626, 1364, 1163, 1038, 1395, 1346, 132, 880, 405, 553, 1506, 317, 153, 402,
+    56, 954, 800, 1192, 1660, 415, 722, 793, 1320, 1381, 1281, 500, 1058, 1162, 1544, 1120,
+    931, 1437, 958, 1001, 664, 1474, 1206, 1136, 904, 319, 1406, 388, 636, 432, 1533, 276,
+    242, 440, 823, 422, 1325, 720, 1450, 547, 1014, 489, 495, 705, 1513, 878, 1568, 268,
+    148, 1557, 130, 1507, 357, 730, 1201, 173, 772, 626, 898, 207, 868, 990, 1178, 1468,
+    211, 1536, 166, 765, 704, 640, 1275, 1205, 1508, 265, 120, 373, 369, 899, 1260, 622,
+    828, 180, 297, 1015, 1289, 1428, 508, 838, 1566, 397, 382, 47, 545, 1189, 1691, 566,
+    1383, 96, 1422, 1243, 316, 675, 1698, 1264, 1529, 1567, 216, 128, 407, 78, 223, 634,
+    55, 133, 1490, 692, 189, 616, 718, 1059, 44, 1101, 1118, 218, 1571, 1148, 758, 324,
+    565, 400, 894, 567, 285, 870, 31, 1447, 849, 1278, 1547, 1135, 797, 948, 1624, 690,
+    1262, 1299, 482, 1088, 1108, 1012, 496, 158, 786, 1225, 1418, 660, 1051, 1297, 38, 68,
+    1344, 829, 532, 349, 1081, 833, 625, 1336, 763, 1390, 906, 641, 1401, 919, 661, 1119,
+    742, 725, 1633, 328, 852, 165, 232, 1558, 321, 106, 221, 49, 443, 941, 509, 1423,
+    869, 1497, 1076, 783, 1574, 986, 806, 798, 1382, 4, 698, 1514, 1620, 534, 654, 1332,
+    1475, 1294, 1033, 677, 1256, 531, 529, 1156, 572, 340, 1314, 729, 226, 968, 544, 861,
+    62, 576, 457, 1280, 738, 92, 1556, 273, 1165, 1062, 1417, 929, 318, 559, 959, 102,
+    1179, 418, 549, 413, 1211, 362, 1227, 752, 1638, 1112, 1199, 224, 12, 74, 1114, 1030,
+    355, 447, 734, 979, 1636, 915, 1511, 872, 1170, 1394, 938, 735, 1218, 539, 801, 927,
+    1295, 1442, 1391, 1473, 653, 659, 668, 1235, 1403, 1311, 303, 1477, 394, 76, 631, 851,
+    25, 548, 649, 535, 354, 970, 644, 769, 1699, 1077, 590, 1089, 1572, 646, 1441, 503,
+    1583, 1255, 53, 791, 1608, 1172, 1306, 1153, 1074, 1150, 1168, 1229, 592, 1010, 1482, 1596,
+    933, 662, 648, 623, 1350, 251, 191, 1594, 1158, 1159, 208, 1327, 271, 1046, 911, 1139,
+    29, 1373, 149, 924, 1279, 669, 1576, 384, 174, 399, 437, 1374, 1050, 812, 706, 37,
+    643, 950, 1285, 139, 731, 1063, 1261, 1313, 525, 1026, 1145, 1677, 272, 1245, 953, 685,
+    1375, 1041, 1628, 944, 288, 202, 182, 1476, 951, 401, 712, 323, 217, 773, 1174, 353,
+    1236, 308, 1207, 263, 431, 1578, 1354, 583, 1396, 363, 637, 1005, 1084, 1080, 960, 558,
+    826, 579, 1456, 1688, 818, 804, 855, 604, 261, 455, 821, 241, 81, 980, 1358, 1559,
+    181, 1531, 1341, 753, 1389, 1214, 237, 875, 305, 568, 696, 1300, 591, 792, 996, 206,
+    1175, 788, 1068, 1587, 298, 379, 441, 361, 776, 490, 1303, 1025, 1321, 1554, 1215, 917,
+    1692, 1196, 874, 741, 1411, 837, 666, 1465, 831, 103, 615, 222, 1143, 1541, 1387, 1371,
+    1020, 1244, 647, 1037, 352, 1019, 1457, 469, 201, 23, 779, 1627, 289, 1412, 889, 435,
+    449, 1502, 819, 796, 1249, 259, 726, 916, 1184, 481, 8, 777, 1453, 1124, 1213, 1309,
+    920, 873, 42, 610, 398, 346, 1031, 1644, 584, 1338, 1496, 1130, 1151, 1522, 897, 253,
+    283, 595, 513, 1040, 1472, 409, 1067, 1029, 1276, 946, 1267, 163, 656, 473, 570, 721,
+    1622, 992, 257, 236, 1047, 1008, 1393, 1340, 1431, 311, 155, 322, 1603, 1669, 605, 1155,
+    1630, 1097, 1203, 1693, 1272, 1432, 991, 995, 1268, 1190, 302, 530, 88, 414, 1397, 1532,
+    304, 682, 799, 975, 598, 1362, 667, 475, 794, 892, 834, 1408, 1317, 376, 1501, 997,
+    526, 1142, 900, 1011, 1208, 1034, 66, 1414, 1427, 839, 1160, 452, 325, 1376, 0, 1022,
+    1367, 1619, 264, 1318, 247, 129, 1129, 1687, 737, 1039, 41, 1610, 627, 629, 260, 248,
+    347, 429, 1524, 50, 1116, 491, 907, 225, 1360, 150, 966, 417, 1246, 1146, 345, 335,
+    695, 518, 1525, 411, 386, 1054, 169, 1283, 1096, 395, 1595, 294, 1125, 1204, 645, 1004,
+    1498, 1100, 1070, 124, 300, 446, 6, 709, 147, 597, 759, 845, 1679, 930, 136, 419,
+    60, 1056, 1517, 426, 356, 476, 1094, 1284, 1400, 888, 714, 1607, 438, 389, 703, 713,
+    245, 971, 58, 964, 1331, 1147, 1416, 281, 674, 686, 1251, 813, 761, 554, 161, 552,
+    162, 599, 736, 326, 119, 1271, 358, 571, 85, 1384, 1182, 187, 1438, 425, 359, 611,
+    1602, 633, 111, 1188, 330, 515, 1593, 817, 1646, 1683, 1198, 976, 1223, 1055, 824, 157,
+    87, 514, 1586, 684, 408, 1220, 255, 11, 40, 77, 1105, 1471, 95, 1632, 1180, 771,
+    51, 186, 965, 811, 1591, 1493, 320, 350, 853, 977, 942, 1296, 843, 984, 59, 1138,
+    993, 1133, 284, 69, 745, 9, 1265, 551, 835, 521, 91, 110, 895, 589, 947, 1241,
+    858, 1361, 618, 1302, 1323, 1202, 494, 240, 146, 935, 1036, 61, 780, 372, 774, 983,
+    1460, 331, 1481, 1464, 383, 15, 1409, 982, 1399, 364, 200, 1247, 1257, 1177, 63, 1333,
+    925, 708, 940, 1530, 1234, 926, 306, 171, 617, 1504, 1658, 563, 339, 1326, 36, 1238,
+    859, 1315, 1614, 1635, 581, 1152, 683, 246, 994, 1210, 1647, 1092, 1673, 955, 1664, 760,
+    1601, 480, 905, 291, 234, 865, 179, 679, 1650, 639, 1357, 456, 1542, 934, 343, 404,
+    1600, 882, 1073, 467, 1551, 98, 115, 790, 2, 365, 896, 212, 632, 842, 229, 16,
+    1612, 1509, 1413, 877, 117, 1479, 655, 524, 1222, 541, 1113, 1075, 1258, 1535, 1242, 1027,
+    249, 747, 177, 914, 1230, 827, 588, 1250, 463, 680, 1613, 1469, 510, 478, 1035, 1212,
+    48, 1322, 160, 1186, 1131, 104, 1516, 1599, 156, 479, 464, 329, 1328, 1484, 1488, 505,
+    876, 269, 175, 1546, 183, 1337, 1478, 670, 142, 256, 784, 21, 332, 1562, 342, 72,
+    884, 1121, 39, 90, 1305, 348, 1308, 470, 1347, 274, 1675, 1405, 1505, 406, 523, 1044,
+    94, 578, 461, 538, 1329, 603, 143, 1085, 215, 295, 694, 1348, 1379, 564, 1682, 936,
+    961, 109, 1224, 910, 20, 24, 1425, 1221, 802, 1489, 344, 1061, 1415, 1353, 562, 424,
+    766, 879, 1458, 134, 1424, 757, 596, 472, 152, 287, 122, 540, 1443, 1696, 1598, 600,
+    867, 199, 630, 624, 1573, 1042, 922, 949, 1579, 444, 1617, 493, 52, 1606, 749, 574,
+    178, 762, 1018, 1288, 22, 1695, 921, 1420, 671, 527, 17, 1485, 54, 13, 396, 628,
+    459, 1132, 488, 1430, 371, 214, 1449, 1684, 650, 1345, 1480, 244, 1232, 1665, 1095, 230,
+    988, 1049, 1609, 410, 1561, 1269, 1652, 1649, 374, 987, 1342, 65, 1654, 412, 460, 609,
+    57, 528, 619, 170, 1086, 1470, 1137, 28, 1670, 575, 498, 608, 512, 1590, 213, 46,
+    1277, 1, 1007, 1343, 691, 918, 1024, 1641, 1200, 1483, 863, 909, 1454, 1126, 717, 313,
+    193, 391, 1526, 1623, 785, 93, 434, 1103, 932, 1071, 767, 903, 943, 912, 1404, 450,
+    1592, 862, 1685, 613, 580, 1436, 1167, 377, 483, 1681, 848, 913, 1239, 998, 744, 809,
+    957, 1107, 635, 250, 486, 387, 841, 1648, 681, 561, 70, 893, 453, 167, 26, 1016,
+    112, 477, 113, 746, 34, 586, 1028, 1539, 781, 385, 299, 278, 860, 1185, 1540, 1550,
+    315, 279, 1605, 1528, 1187, 963, 901, 73, 1352, 1448, 33, 235, 585, 775, 621, 341,
+    1534, 1462, 137, 82, 1667, 748, 416, 1266, 292, 1538, 710, 468, 1629, 1032, 1445, 1495,
+    1082, 1079, 1169, 1680, 1369, 154, 556, 756, 1052, 857, 492, 474, 702, 1642, 1459, 1282,
+    665, 1128, 739, 1259, 430, 1463, 258, 1365, 676, 1689, 286, 1193, 1366, 967, 3, 1231,
+    1090, 1426, 123, 1355, 220, 1512, 138, 1060, 516, 1287, 64, 1122, 1253, 499, 557, 436,
+    582, 1002, 1519, 1093, 1651, 1500, 239, 233, 465, 125, 1157, 1666, 1615, 135, 1104, 7,
+    908, 1217, 945, 764, 587, 678, 1499, 707, 1604, 902, 420, 1194, 1668, 1380, 755, 569,
+    107, 1697, 101, 652, 18, 700, 1656, 723, 1555, 620, 1197, 184, 144, 209, 638, 1009,
+    1634, 375, 689, 1444, 267, 310, 84, 79, 923, 1043, 114, 1351, 999, 699, 466, 1657,
+    1363, 1386, 1616, 1301, 1228, 290, 1585, 337, 338, 807, 543, 577, 672, 270, 1298, 1549,
+    423, 546, 1678, 733, 1378, 141, 127, 1171, 367, 1252, 1006, 484, 956, 1021, 1216, 1233,
+    433, 1316, 1434, 974, 719, 969, 1527, 985, 1552, 45, 1048, 1183, 1304, 1671, 451, 768,
+    140, 43, 1191, 1694, 1446, 1589, 743, 1066, 1312, 1537, 327, 602, 1335, 887, 1640, 1588,
+    1293, 205, 390, 282, 1433, 840, 1392, 716, 658, 366, 1164, 1655, 1349, 336, 1639, 83,
+    151, 789, 1065, 1064, 1385, 1307, 1455, 1240, 520, 1461, 458, 1072, 1398, 1631, 1429, 550,
+    711, 506, 952, 1087, 471, 1115, 697, 1575, 814, 121, 701, 1663, 1661, 816, 164, 312,
+    105, 185, 822, 673, 145, 1134, 378, 612, 881, 820, 1419, 989, 601, 254, 1324, 606,
+    651, 1368, 1560, 1653, 844, 1388, 1548, 885, 1611, 519, 277, 14, 555, 275, 116, 972,
+    751, 5, 727, 1069, 301, 1662, 1291, 1676, 252, 1407, 1023, 1263, 1584, 1618, 1580, 832,
+    1161, 80, 442, 1410, 421, 188, 203, 750, 1435, 517, 866, 1690, 86, 131, 803, 770,
+    1330, 1117, 928, 1674, 1248, 1487, 118, 962, 454, 196, 97, 836, 1582, 825, 393, 1166,
+    657, 1110, 333, 198, 1219, 168, 890, 1334, 368, 1597, 439, 1274, 266, 75, 71, 973,
+    380, 197, 573, 740, 1377, 19, 1625, 1518, 614, 27, 1565, 231, 126, 1503, 688, 219,
+    1359, 1000, 307, 1672, 1372, 190, 227, 1637, 296, 537, 1543, 847, 262, 1643, 1494, 594,
+    533, 663, 1370, 607, 1564, 427, 1226, 448, 715, 1659, 886, 1154, 1319, 195, 428, 159,
+    1570, 891, 522, 1492, 32, 504, 1127, 10, 883, 445, 560, 1140, 30, 293, 1686, 67,
+    850, 1467, 1451, 1466, 1141, 1053, 787, 1106, 1421, 1111, 1091, 1273, 334, 854, 1569, 1209,
+    309, 507, 1017, 1521, 1520, 176, 238, 805, 1098, 1439, 228, 1144, 1013, 687, 1545, 280,
+    1515, 724, 808, 1045, 795, 1123, 1486, 360, 1510, 1339, 1286, 108, 1402, 978, 1645, 693,
+    1003, 1057, 1581, 485, 856, 35, 754, 1310, 1083, 1149, 1078, 403, 172, 937, 351, 732,
+    871, 1109, 778, 497, 210, 314, 194, 1099, 1440, 1102, 370, 381, 1523, 1290, 593, 502,
+    243, 1254, 939, 846, 511, 1176, 89, 864, 501, 642, 536, 1577, 462, 1195, 99, 1270,
+    782, 542, 1621, 1563,
+}};
+
+constexpr std::array<std::int32_t, 1> file_hash_seeds
+{{
+    -1,
+}};
+
+constexpr std::array<std::uint32_t, 1> file_hash_slots
+{{
+    0,
+}};
+
+constexpr std::array<std::int32_t, 1> token_hash_seeds
+{{
+    -1,
+}};
+
+constexpr std::array<std::uint32_t, 1> token_hash_slots
+{{
+    0,
+}};
+
+} // namespace xsk::gsc::s2
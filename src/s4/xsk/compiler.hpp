@@ -19,28 +19,40 @@ class compiler : public gsc::compiler
     std::uint32_t index_;
     std::uint32_t label_idx_;
     std::uint8_t stack_idx_;
-    std::vector<std::string> local_stack_;
+    std::unordered_map<utils::interner::handle, std::uint8_t> local_stack_;
     std::vector<std::string> local_functions_;
     std::vector<include_t> includes_;
     std::vector<animtree_t> animtrees_;
     std::unordered_map<std::string, ast::expr> constants_;
     std::function<std::vector<std::uint8_t>(const std::string&)> read_callback_;
-    std::vector<gsc::source> sources_;
+    gsc::include_cache* include_cache_ = nullptr;
+    bool inlining_ = false;
+    bool peephole_rules_ = false;
+    bool jump_threading_ = false;
+    gsc::source_cache sources_;
     std::vector<block*> break_blks_;
     std::vector<block*> continue_blks_;
     bool can_break_;
     bool can_continue_;
     bool developer_thread_;
+    gsc::opcode_table peephole_;
+    gsc::local_allocator locals_;
+    std::map<std::string, std::size_t> opt_stats_;
 
 public:
-    compiler(build mode) : mode_(mode) {}
+    compiler(build mode);
     auto output() -> std::vector<function::ptr>;
     void compile(const std::string& file, std::vector<std::uint8_t>& data);
     void read_callback(std::function<std::vector<std::uint8_t>(const std::string&)> func);
+    void include_cache(gsc::include_cache* cache);
+    void inlining(bool enable);
+    void peephole_rules(bool enable);
+    void jump_threading(bool enable);
+    auto dependencies() -> std::vector<std::string>;
+    auto opt_stats() -> const std::map<std::string, std::size_t>&;
 
 private:
     auto parse_buffer(const std::string& file, std::vector<std::uint8_t>& data) -> ast::program::ptr;
-    auto parse_file(const std::string& file) -> ast::program::ptr;
     void compile_program(const ast::program::ptr& program);
     void emit_include(const ast::include::ptr& include);
     void emit_declaration(const ast::decl& decl);
@@ -121,8 +133,8 @@ private:
     void emit_create_local_vars(const block::ptr& blk);
     void emit_remove_local_vars(const block::ptr& blk);
     void emit_opcode(opcode op);
-    void emit_opcode(opcode op, const std::string& data);
-    void emit_opcode(opcode op, const std::vector<std::string>& data);
+    void emit_opcode(opcode op, const operand& data);
+    void emit_opcode(opcode op, const std::vector<operand>& data);
     void process_thread(const ast::decl_thread::ptr& decl, const block::ptr& blk);
     void process_stmt(const ast::stmt& stmt, const block::ptr& blk);
     void process_stmt_list(const ast::stmt_list::ptr& stmt, const block::ptr& blk);
@@ -141,19 +153,21 @@ private:
     void process_stmt_return(const ast::stmt_return::ptr& stmt, const block::ptr& blk);
     void process_expr(const ast::expr& expr, const block::ptr& blk);
     void process_expr_parameters(const ast::expr_parameters::ptr& decl, const block::ptr& blk);
-    void register_variable(const std::string& name, const block::ptr& blk);
+    void register_variable(utils::interner::handle name, const block::ptr& blk);
+    void register_hoisted(const ast::node* loop, const block::ptr& blk);
     void initialize_variable(const ast::expr_identifier::ptr& name, const block::ptr& blk);
     void create_variable(const ast::expr_identifier::ptr& name, const block::ptr& blk);
     auto variable_stack_index(const ast::expr_identifier::ptr& name, const block::ptr& blk) -> std::uint8_t;
-    auto variable_create_index(const ast::expr_identifier::ptr& name, const block::ptr& blk) -> std::string;
-    auto variable_access_index(const ast::expr_identifier::ptr& name, const block::ptr& blk) -> std::string;
+    auto variable_create_index(const ast::expr_identifier::ptr& name, const block::ptr& blk) -> operand;
+    auto variable_access_index(const ast::expr_identifier::ptr& name, const block::ptr& blk) -> operand;
     auto variable_initialized(const ast::expr_identifier::ptr& name, const block::ptr& blk) -> bool;
     auto resolve_function_type(const ast::expr_function::ptr& expr) -> ast::call::type;
     auto resolve_reference_type(const ast::expr_reference::ptr& expr, bool& method) -> ast::call::type;
     auto is_constant_condition(const ast::expr& expr) -> bool;
-    auto create_label() -> std::string;
-    auto insert_label() -> std::string;
-    void insert_label(const std::string& label);
+    auto local_function(const std::string& name) -> operand;
+    auto create_label() -> operand;
+    auto insert_label() -> operand;
+    void insert_label(const operand& label);
 
     auto map_known_includes(const std::string& include) -> bool;
 };
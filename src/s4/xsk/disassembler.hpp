@@ -14,13 +14,16 @@ class disassembler : public gsc::disassembler
     utils::byte_buffer::ptr script_;
     utils::byte_buffer::ptr stack_;
     utils::byte_buffer::ptr output_;
+    std::size_t script_size_ = 0;
     std::vector<function::ptr> functions_;
-    std::unordered_map<std::uint32_t, std::string> labels_;
+    std::unordered_map<std::uint32_t, std::uint32_t> labels_;
+    std::unordered_map<std::uint32_t, std::uint32_t> function_index_;
 
 public:
     auto output() -> std::vector<function::ptr>;
     auto output_data() -> std::vector<std::uint8_t>;
     void disassemble(const std::string& file, std::vector<std::uint8_t>& script, std::vector<std::uint8_t>& stack);
+    void disassemble(const std::string& file, const std::uint8_t* script, std::size_t script_size, const std::uint8_t* stack, std::size_t stack_size);
 
 private:
     void dissasemble_function(const function::ptr& func);
@@ -35,7 +38,7 @@ private:
     void disassemble_end_switch(const instruction::ptr& inst);
     auto disassemble_offset() -> std::int32_t;
     void resolve_local_functions();
-    auto resolve_function(const std::string& index) -> std::string;
+    auto resolve_function(std::uint32_t index) -> operand;
     void print_function(const function::ptr& func);
     void print_instruction(const instruction::ptr& inst);
 };
@@ -0,0 +1,76 @@
+// Copyright 2021 xensik. All rights reserved.
+//
+// Use of this source code is governed by a GNU GPLv3 license
+// that can be found in the LICENSE file.
+
+// generated by gen/resolver.py, do not edit
+
+#pragma once
+
+namespace xsk::gsc::s4
+{
+
+constexpr std::array<std::int32_t, 47> opcode_hash_seeds
+{{
+    -180, 10, 1, 7, 18, 171, 49, 15, 3, 9, 38, -165, 1149, 190, -157, 5,
+    366, -138, -87, 3, 46, 3, 32, 5, 1, 44, 234, 88, 14, 5, 1, 41,
+    15, 45, -59, 1, 59, -36, 36, 1, 1236, 282, 3, 682, 1, 4340, 90,
+}};
+
+constexpr std::array<std::uint32_t, 190> opcode_hash_slots
+{{
+    65, 182, 54, 20, 50, 6, 118, 139, 25, 116, 77, 165, 113, 98, 68, 43,
+    76, 53, 64, 40, 82, 160, 12, 131, 143, 39, 173, 95, 183, 88, 35, 114,
+    152, 49, 186, 146, 34, 75, 86, 27, 121, 89, 178, 123, 96, 94, 159, 161,
+    104, 90, 84, 29, 99, 103, 110, 52, 55, 13, 179, 47, 144, 156, 62, 7,
+    125, 189, 58, 111, 67, 16, 73, 92, 135, 126, 115, 15, 60, 171, 150, 134,
+    78, 155, 176, 97, 105, 93, 26, 122, 4, 63, 180, 72, 151, 81, 18, 112,
+    41, 2, 141, 127, 162, 107, 106, 174, 70, 168, 79, 163, 36, 108, 69, 167,
+    153, 80, 66, 48, 164, 172, 157, 137, 132, 128, 83, 120, 57, 85, 24, 42,
+    136, 148, 22, 184, 44, 28, 46, 30, 87, 147, 14, 130, 17, 177, 74, 187,
+    9, 149, 124, 140, 8, 59, 175, 154, 5, 166, 38, 119, 181, 56, 142, 11,
+    61, 19, 102, 71, 31, 169, 32, 10, 21, 91, 51, 0, 138, 3, 133, 145,
+    109, 23, 158, 188, 129, 37, 45, 1, 170, 185, 33, 100, 117, 101,
+}};
+
+constexpr std::array<std::int32_t, 1> function_hash_seeds
+{{
+    6,
+}};
+
+constexpr std::array<std::uint32_t, 4> function_hash_slots
+{{
+    0, 2, 1, 3,
+}};
+
+constexpr std::array<std::int32_t, 1> method_hash_seeds
+{{
+    -1,
+}};
+
+constexpr std::array<std::uint32_t, 1> method_hash_slots
+{{
+    0,
+}};
+
+constexpr std::array<std::int32_t, 1> file_hash_seeds
+{{
+    -1,
+}};
+
+constexpr std::array<std::uint32_t, 1> file_hash_slots
+{{
+    0,
+}};
+
+constexpr std::array<std::int32_t, 1> token_hash_seeds
+{{
+    9,
+}};
+
+constexpr std::array<std::uint32_t, 4> token_hash_slots
+{{
+    0, 3, 1, 2,
+}};
+
+} // namespace xsk::gsc::s4
@@ -19,7 +19,7 @@
 namespace xsk::gsc
 {
 
-enum class encd { __, SOURCE, ASSEMBLY, BINARY };
+enum class encd { __, SOURCE, ASSEMBLY, BINARY, IR };
 enum class mode { __, ASM, DISASM, COMP, DECOMP };
 enum class game { __, IW5, IW6, IW7, IW8, S1, S2, S4, H1, H2 };
 
@@ -29,6 +29,7 @@ const std::map<std::string, encd> exts =
     { ".gscasm", encd::ASSEMBLY },
     { ".cgsc", encd::BINARY },
     { ".gscbin", encd::BINARY },
+    { ".gscir", encd::IR },
 };
 
 const std::map<std::string, mode> modes = 
@@ -60,16 +61,39 @@ const std::map<mode, encd> encds =
     { mode::DECOMP, encd::BINARY },
 };
 
-std::map<game, gsc::assembler::ptr> assemblers;
-std::map<game, gsc::disassembler::ptr> disassemblers;
-std::map<game, gsc::compiler::ptr> compilers;
-std::map<game, gsc::decompiler::ptr> decompilers;
-std::map<mode, std::function<void(game game, std::string file)>> funcs;
+enum class status { done, skipped, failed };
+
+thread_local std::map<game, gsc::assembler::ptr> assemblers;
+thread_local std::map<game, gsc::disassembler::ptr> disassemblers;
+thread_local std::map<game, gsc::compiler::ptr> compilers;
+thread_local std::map<game, gsc::decompiler::ptr> decompilers;
+std::map<mode, std::function<status(game game, std::string file, std::ostream& out, std::ostream& err)>> funcs;
 
 bool zonetool = false;
+bool emit_ir = false;
+bool from_ir = false;
+std::uint32_t jobs = 1;
+utils::thread_pool* workers = nullptr;
+gsc::include_cache include_cache;
+std::string include_cache_file;
+std::unique_ptr<gsc::build_cache> builds;
+std::string build_cache_dir;
+gsc::build build_mode = gsc::build::prod;
+std::int32_t zlib_level = utils::zlib::best;
+utils::thread_pool* writer = nullptr;
+std::future<status> pending_write;
+std::mutex prompt_mutex;
+bool opt_stats = false;
+bool inlining = false;
+bool peephole_rules = false;
+bool jump_threading = false;
+std::map<std::string, std::size_t> opt_counts;
+std::mutex opt_mutex;
 
 auto overwrite_prompt(const std::string& file) -> bool
 {
+    std::lock_guard<std::mutex> lock(prompt_mutex);
+
     auto overwrite = true;
 
     if (utils::file::exists(file))
@@ -121,12 +145,89 @@ auto choose_resolver_file_name(uint32_t id, game& game) -> std::string
     }
 }
 
-void assemble_file(game game, std::string file)
+auto game_name(game game) -> std::string
+{
+    for (const auto& entry : games)
+    {
+        if (entry.second == game) return entry.first;
+    }
+
+    return "";
+}
+
+// IR files hold disassembler output with bare function names, the 'sub_' prefix is added back for decompiling
+void save_ir(game game, const std::string& file, std::vector<function::ptr> functions)
+{
+    for (auto& func : functions)
+    {
+        if (func->name.compare(0, 4, "sub_") == 0)
+        {
+            func->name.erase(0, 4);
+        }
+    }
+
+    ir script;
+
+    script.game = game_name(game);
+    script.functions = std::move(functions);
+
+    auto stream = utils::file::create(file);
+    script.serialize(stream);
+}
+
+auto load_ir(game game, const std::string& file) -> std::vector<function::ptr>
+{
+    auto data = utils::file::map(file);
+
+    ir script;
+
+    script.deserialize(data.data(), data.size());
+
+    if (script.game != game_name(game))
+    {
+        throw std::runtime_error("IR file '" + file + "' was emitted for game '" + script.game + "'");
+    }
+
+    return std::move(script.functions);
+}
+
+void save_disassembly(game game, const gsc::disassembler::ptr& disassembler, const std::string& file, std::ostream& out)
+{
+    if (emit_ir)
+    {
+        save_ir(game, file + ".gscir", disassembler->output());
+        out << "disassembled " << file << ".gscir\n";
+    }
+    else
+    {
+        utils::file::save(file + ".gscasm", disassembler->output_data());
+        out << "disassembled " << file << ".gscasm\n";
+    }
+}
+
+void save_gscbin(const std::string& file, const std::vector<std::uint8_t>& bytecode, const std::vector<std::uint8_t>& stack)
+{
+    const auto buffer = utils::zlib::compress(stack, zlib_level);
+
+    asset script;
+
+    script.name = file;
+    script.buffer = buffer.data();
+    script.bytecode = bytecode.data();
+    script.len = stack.size();
+    script.compressedLen = buffer.size();
+    script.bytecodeLen = bytecode.size();
+
+    auto stream = utils::file::create(file + ".gscbin");
+    script.serialize(stream);
+}
+
+auto assemble_file(game game, std::string file, std::ostream& out, std::ostream& err) -> status
 {
     try
     {
         const auto& assembler = assemblers[game];
-        const auto ext = std::string(".gscasm");
+        const auto ext = std::string(from_ir ? ".gscir" : ".gscasm");
         const auto extpos = file.find(ext);
         
         if (extpos != std::string::npos)
@@ -134,9 +235,18 @@ void assemble_file(game game, std::string file)
             file.replace(extpos, ext.length(), "");
         }
 
-        auto data = utils::file::read(file + ext);
+        if (from_ir)
+        {
+            auto functions = load_ir(game, file + ext);
 
-        assembler->assemble(file, data);
+            assembler->assemble(file, functions);
+        }
+        else
+        {
+            auto data = utils::file::read(file + ext);
+
+            assembler->assemble(file, data);
+        }
 
         if (overwrite_prompt(file + (zonetool ? ".cgsc" : ".gscbin")))
         {
@@ -144,48 +254,44 @@ void assemble_file(game game, std::string file)
             {
                 utils::file::save(file + ".cgsc", assembler->output_script());
                 utils::file::save(file + ".cgsc.stack", assembler->output_stack());
-                std::cout << "assembled " << file << ".cgsc\n";
+                out << "assembled " << file << ".cgsc\n";
             }
             else
             {
-                asset script;
-
-                auto uncompressed = assembler->output_stack();
-                auto compressed = utils::zlib::compress(uncompressed);
-
-                script.name = file;
-                script.bytecode = assembler->output_script();
-                script.buffer = std::move(compressed);
-                script.len = uncompressed.size();
-                script.compressedLen = script.buffer.size();
-                script.bytecodeLen = script.bytecode.size();
-
-                auto output = script.serialize();
-                utils::file::save(file + ".gscbin", output);
-                std::cout << "assembled " << file << ".gscbin\n";
+                save_gscbin(file, assembler->output_script(), assembler->output_stack());
+                out << "assembled " << file << ".gscbin\n";
             }
         }
+
+        return status::done;
     }
     catch (const std::exception& e)
     {
-        std::cerr << e.what() << '\n';
+        err << e.what() << '\n';
+        return status::failed;
     }
 }
 
-void disassemble_file(game game, std::string file)
+auto disassemble_file(game game, std::string file, std::ostream& out, std::ostream& err) -> status
 {
     try
     {
         const auto& disassembler = disassemblers[game];
 
+        // the disassembler reads through views of these, they must outlive saving its output
+        auto script_view = utils::file_view{};
+        auto stack_view = utils::file_view{};
+        auto script = asset{};
+        auto stack = std::vector<std::uint8_t>{};
+
         if (zonetool)
         {
-            if (file.find(".gscbin") != std::string::npos) return;
+            if (file.find(".gscbin") != std::string::npos) return status::skipped;
 
             if (file.find(".stack") != std::string::npos)
             {
-                std::cerr << "Cannot disassemble stack files\n";
-                return;
+                err << "Cannot disassemble stack files\n";
+                return status::failed;
             }
 
             const auto ext = std::string(".cgsc");
@@ -196,14 +302,14 @@ void disassemble_file(game game, std::string file)
                 file.replace(extpos, ext.length(), "");
             }
 
-            auto script = utils::file::read(file + ".cgsc");
-            auto stack = utils::file::read(file + ".cgsc.stack");
+            script_view = utils::file::map(file + ".cgsc");
+            stack_view = utils::file::map(file + ".cgsc.stack");
 
-            disassembler->disassemble(file, script, stack);
+            disassembler->disassemble(file, script_view.data(), script_view.size(), stack_view.data(), stack_view.size());
         }
         else
         {
-            if (file.find(".cgsc") != std::string::npos) return;
+            if (file.find(".cgsc") != std::string::npos) return status::skipped;
 
             const auto ext = std::string(".gscbin");
             const auto extpos = file.find(ext);
@@ -213,23 +319,20 @@ void disassemble_file(game game, std::string file)
                 file.replace(extpos, ext.length(), "");
             }
 
-            auto data = utils::file::read(file + ext);
-
-            asset script;
+            script_view = utils::file::map(file + ext);
 
-            script.deserialize(data);
+            script.deserialize(script_view.data(), script_view.size());
 
-            auto stack = utils::zlib::decompress(script.buffer, script.len);
+            stack = utils::zlib::decompress(script.buffer, script.compressedLen, script.len);
 
-            disassembler->disassemble(file, script.bytecode, stack);
+            disassembler->disassemble(file, script.bytecode, script.bytecodeLen, stack.data(), stack.size());
         }
 
         auto scriptid = std::filesystem::path(file).filename().string();
 
         if (!isdigit(scriptid.data()[0]))
         {
-            utils::file::save(file + ".gscasm", disassembler->output_data());
-            std::cout << "disassembled " << file << ".gscasm\n";
+            save_disassembly(game, disassembler, file, out);
         }
         else
         {
@@ -244,17 +347,60 @@ void disassemble_file(game game, std::string file)
                 }
             }
 
-            utils::file::save(file + filename + ".gscasm", disassembler->output_data());
-            std::cout << "disassembled " << file << filename << ".gscasm\n";
+            save_disassembly(game, disassembler, file + filename, out);
         }
+
+        return status::done;
     }
     catch (const std::exception& e)
     {
-        std::cerr << e.what() << '\n';
+        err << e.what() << '\n';
+        return status::failed;
     } 
 }
 
-void compile_file(game game, std::string file)
+// everything besides the sources that changes what comp writes
+auto build_config(game game) -> std::string
+{
+    const auto output = zonetool ? "cgsc"s : utils::string::va("gscbin%d", zlib_level);
+
+    return utils::string::va("%s:%s:%s%s%s%s", game_name(game).data(), output.data(), build_mode == gsc::build::dev ? "dev" : "prod", inlining ? ":inline" : "", peephole_rules ? ":peephole" : "", jump_threading ? ":threading" : "");
+}
+
+// copies a cached build over the outputs, they are left alone when already identical
+auto restore_build(const std::string& object, const std::string& file, const std::vector<std::string>& exts, std::ostream& out) -> status
+{
+    auto same = true;
+
+    for (const auto& ext : exts)
+    {
+        if (!utils::file::exists(file + ext) || utils::file::read(file + ext) != utils::file::read(object + ext))
+        {
+            same = false;
+            break;
+        }
+    }
+
+    if (same)
+    {
+        out << "up to date " << file << exts.front() << "\n";
+        return status::skipped;
+    }
+
+    if (overwrite_prompt(file + exts.front()))
+    {
+        for (const auto& ext : exts)
+        {
+            std::filesystem::copy_file(object + ext, file + ext, std::filesystem::copy_options::overwrite_existing);
+        }
+
+        out << "compiled " << file << exts.front() << " (cached)\n";
+    }
+
+    return status::done;
+}
+
+auto compile_file(game game, std::string file, std::ostream& out, std::ostream& err) -> status
 {
     try
     {
@@ -269,65 +415,120 @@ void compile_file(game game, std::string file)
         }
 
         auto data = utils::file::read(file + ext);
+        const auto outputs = zonetool ? std::vector<std::string> { ".cgsc", ".cgsc.stack" } : std::vector<std::string> { ".gscbin" };
+        const auto source = builds ? utils::hash::fnv1a(data) : 0;
+
+        if (builds)
+        {
+            const auto object = builds->find(file + ext, source, build_config(game), outputs);
+
+            if (!object.empty())
+            {
+                return restore_build(object, file, outputs, out);
+            }
+        }
 
         compiler->read_callback(utils::file::read);
+        compiler->include_cache(&include_cache);
+        compiler->inlining(inlining);
+        compiler->peephole_rules(peephole_rules);
+        compiler->jump_threading(jump_threading);
         compiler->compile(file, data);
 
+        if (opt_stats)
+        {
+            std::lock_guard<std::mutex> lock(opt_mutex);
+
+            for (const auto& [name, count] : compiler->opt_stats())
+            {
+                opt_counts[name] += count;
+            }
+        }
+
         auto assembly = compiler->output();
 
         assembler->assemble(file, assembly);
 
-        if (overwrite_prompt(file + (zonetool ? ".cgsc" : ".gscbin")))
+        // labels and indexes only settle once assembled, the IR is what disasm --emit-ir writes for it
+        if (emit_ir)
+        {
+            const auto& disassembler = disassemblers[game];
+            auto script = assembler->output_script();
+            auto stack = assembler->output_stack();
+
+            disassembler->disassemble(file, script, stack);
+            save_ir(game, file + ".gscir", disassembler->output());
+            out << "compiled " << file << ".gscir\n";
+            return status::done;
+        }
+
+        if (!overwrite_prompt(file + outputs.front())) return status::done;
+
+        auto save = [=, &out, deps = builds ? compiler->dependencies() : std::vector<std::string> {}, script = assembler->output_script(), stack = assembler->output_stack()]
         {
             if (zonetool)
             {
-                utils::file::save(file + ".cgsc", assembler->output_script());
-                utils::file::save(file + ".cgsc.stack", assembler->output_stack());
-                std::cout << "compiled " << file << ".cgsc\n";
+                utils::file::save(file + ".cgsc", script);
+                utils::file::save(file + ".cgsc.stack", stack);
             }
             else
             {
-                asset script;
-
-                auto uncompressed = assembler->output_stack();
-                auto compressed = utils::zlib::compress(uncompressed);
+                save_gscbin(file, script, stack);
+            }
 
-                script.name = file;
-                script.bytecode = assembler->output_script();
-                script.buffer = std::move(compressed);
-                script.len = uncompressed.size();
-                script.compressedLen = script.buffer.size();
-                script.bytecodeLen = script.bytecode.size();
+            out << "compiled " << file << outputs.front() << "\n";
 
-                auto output = script.serialize();
-                utils::file::save(file + ".gscbin", output);
-                std::cout << "compiled " << file << ".gscbin\n";
+            if (builds)
+            {
+                builds->store(file + ext, source, build_config(game), deps, file, outputs);
             }
+        };
+
+        if (writer == nullptr)
+        {
+            save();
+            return status::done;
         }
+
+        // the writer deflates and saves the outputs while the caller compiles the next script
+        auto task = std::make_shared<std::packaged_task<status()>>([save = std::move(save), &err]
+        {
+            try
+            {
+                save();
+                return status::done;
+            }
+            catch (const std::exception& e)
+            {
+                err << e.what() << '\n';
+                return status::failed;
+            }
+        });
+
+        pending_write = task->get_future();
+        writer->submit([task] { (*task)(); });
+
+        return status::done;
     }
     catch (const std::exception& e)
     {
-        std::cerr << e.what() << '\n';
+        err << e.what() << '\n';
+        return status::failed;
     }
 }
 
-void decompile_file(game game, std::string file)
+auto decompile_file(game game, std::string file, std::ostream& out, std::ostream& err) -> status
 {
     try
     {
         const auto& disassembler = disassemblers[game];
+        const auto& decompiler = decompilers[game];
 
-        if (zonetool)
-        {
-            if (file.find(".gscbin") != std::string::npos) return;
-
-            if (file.find(".stack") != std::string::npos)
-            {
-                std::cerr << "Cannot disassemble stack files\n";
-                return;
-            }
+        decompiler->thread_pool(workers);
 
-            const auto ext = std::string(".cgsc");
+        if (from_ir)
+        {
+            const auto ext = std::string(".gscir");
             const auto extpos = file.find(ext);
 
             if (extpos != std::string::npos)
@@ -335,46 +536,75 @@ void decompile_file(game game, std::string file)
                 file.replace(extpos, ext.length(), "");
             }
 
-            auto script = utils::file::read(file + ".cgsc");
-            auto stack = utils::file::read(file + ".cgsc.stack");
+            auto functions = load_ir(game, file + ext);
 
-            disassembler->disassemble(file, script, stack);
+            for (auto& func : functions)
+            {
+                func->name.insert(0, "sub_");
+            }
+
+            decompiler->decompile(file, functions);
         }
         else
         {
-            if (file.find(".cgsc") != std::string::npos) return;
+            if (zonetool)
+            {
+                if (file.find(".gscbin") != std::string::npos) return status::skipped;
 
-            const auto ext = std::string(".gscbin");
-            const auto extpos = file.find(ext);
+                if (file.find(".stack") != std::string::npos)
+                {
+                    err << "Cannot disassemble stack files\n";
+                    return status::failed;
+                }
 
-            if (extpos != std::string::npos)
-            {
-                file.replace(extpos, ext.length(), "");
+                const auto ext = std::string(".cgsc");
+                const auto extpos = file.find(ext);
+
+                if (extpos != std::string::npos)
+                {
+                    file.replace(extpos, ext.length(), "");
+                }
+
+                auto script = utils::file::map(file + ".cgsc");
+                auto stack = utils::file::map(file + ".cgsc.stack");
+
+                disassembler->disassemble(file, script.data(), script.size(), stack.data(), stack.size());
             }
+            else
+            {
+                if (file.find(".cgsc") != std::string::npos) return status::skipped;
 
-            auto data = utils::file::read(file + ext);
+                const auto ext = std::string(".gscbin");
+                const auto extpos = file.find(ext);
 
-            asset script;
+                if (extpos != std::string::npos)
+                {
+                    file.replace(extpos, ext.length(), "");
+                }
 
-            script.deserialize(data);
+                auto data = utils::file::map(file + ext);
 
-            auto stack = utils::zlib::decompress(script.buffer, script.len);
+                asset script;
 
-            disassembler->disassemble(file, script.bytecode, stack);
-        }
+                script.deserialize(data.data(), data.size());
 
-        const auto& decompiler = decompilers[game];
+                auto stack = utils::zlib::decompress(script.buffer, script.compressedLen, script.len);
 
-        auto output = disassembler->output();
+                disassembler->disassemble(file, script.bytecode, script.bytecodeLen, stack.data(), stack.size());
+            }
+
+            auto output = disassembler->output();
 
-        decompiler->decompile(file, output);
+            decompiler->decompile(file, output);
+        }
 
         auto scriptid = std::filesystem::path(file).filename().string();
 
         if (!isdigit(scriptid.data()[0]))
         {
-            utils::file::save(file + ".gsc", decompiler->output());
-            std::cout << "decompiled " << file << ".gsc\n";
+            auto stream = utils::file::create(file + ".gsc");
+            decompiler->output(stream);
+            out << "decompiled " << file << ".gsc\n";
         }
         else
         {
@@ -389,20 +619,107 @@ void decompile_file(game game, std::string file)
                 }
             }
 
-            utils::file::save(file + filename + ".gsc", decompiler->output());
-            std::cout << "decompiled " << file << filename << ".gsc\n";
+            auto stream = utils::file::create(file + filename + ".gsc");
+            decompiler->output(stream);
+            out << "decompiled " << file << filename << ".gsc\n";
         }
+
+        return status::done;
     }
     catch (const std::exception& e)
     {
-        std::cerr << e.what() << '\n';
+        err << e.what() << '\n';
+        return status::failed;
     }
 }
 
+struct job
+{
+    std::string file;
+    std::ostringstream out;
+    std::ostringstream err;
+    status result;
+    bool finished;
+};
+
+void init_engines(game game)
+{
+    if (assemblers.find(game) != assemblers.end()) return;
+
+    switch (game)
+    {
+        case game::IW5:
+            assemblers[game] = std::make_unique<gsc::iw5::assembler>();
+            disassemblers[game] = std::make_unique<gsc::iw5::disassembler>();
+            compilers[game] = std::make_unique<gsc::iw5::compiler>(build_mode);
+            decompilers[game] = std::make_unique<gsc::iw5::decompiler>();
+            break;
+        case game::IW6:
+            assemblers[game] = std::make_unique<gsc::iw6::assembler>();
+            disassemblers[game] = std::make_unique<gsc::iw6::disassembler>();
+            compilers[game] = std::make_unique<gsc::iw6::compiler>(build_mode);
+            decompilers[game] = std::make_unique<gsc::iw6::decompiler>();
+            break;
+        case game::IW7:
+            assemblers[game] = std::make_unique<gsc::iw7::assembler>();
+            disassemblers[game] = std::make_unique<gsc::iw7::disassembler>();
+            compilers[game] = std::make_unique<gsc::iw7::compiler>(build_mode);
+            decompilers[game] = std::make_unique<gsc::iw7::decompiler>();
+            break;
+        case game::IW8:
+            assemblers[game] = std::make_unique<gsc::iw8::assembler>();
+            disassemblers[game] = std::make_unique<gsc::iw8::disassembler>();
+            compilers[game] = std::make_unique<gsc::iw8::compiler>(build_mode);
+            decompilers[game] = std::make_unique<gsc::iw8::decompiler>();
+            break;
+        case game::S1:
+            assemblers[game] = std::make_unique<gsc::s1::assembler>();
+            disassemblers[game] = std::make_unique<gsc::s1::disassembler>();
+            compilers[game] = std::make_unique<gsc::s1::compiler>(build_mode);
+            decompilers[game] = std::make_unique<gsc::s1::decompiler>();
+            break;
+        case game::S2:
+            assemblers[game] = std::make_unique<gsc::s2::assembler>();
+            disassemblers[game] = std::make_unique<gsc::s2::disassembler>();
+            compilers[game] = std::make_unique<gsc::s2::compiler>(build_mode);
+            decompilers[game] = std::make_unique<gsc::s2::decompiler>();
+            break;
+        case game::S4:
+            assemblers[game] = std::make_unique<gsc::s4::assembler>();
+            disassemblers[game] = std::make_unique<gsc::s4::disassembler>();
+            compilers[game] = std::make_unique<gsc::s4::compiler>(build_mode);
+            decompilers[game] = std::make_unique<gsc::s4::decompiler>();
+            break;
+        case game::H1:
+            assemblers[game] = std::make_unique<gsc::h1::assembler>();
+            disassemblers[game] = std::make_unique<gsc::h1::disassembler>();
+            compilers[game] = std::make_unique<gsc::h1::compiler>(build_mode);
+            decompilers[game] = std::make_unique<gsc::h1::decompiler>();
+            break;
+        case game::H2:
+            assemblers[game] = std::make_unique<gsc::h2::assembler>();
+            disassemblers[game] = std::make_unique<gsc::h2::disassembler>();
+            compilers[game] = std::make_unique<gsc::h2::compiler>(build_mode);
+            decompilers[game] = std::make_unique<gsc::h2::decompiler>();
+            break;
+        default:
+            break;
+    }
+}
+
+auto process_file(mode mode, game game, const std::string& file, std::ostream& out, std::ostream& err) -> status
+{
+    init_engines(game);
+
+    return funcs.at(mode)(game, file, out, err);
+}
+
 void execute(mode mode, game game, const std::string& path)
 {
     if (std::filesystem::is_directory(path))
     {
+        std::vector<std::unique_ptr<job>> list;
+
         for (const auto& entry : std::filesystem::recursive_directory_iterator(path))
         {
             if (entry.is_regular_file())
@@ -410,24 +727,227 @@ void execute(mode mode, game game, const std::string& path)
                 auto it1 = encds.find(mode);
                 auto it2 = exts.find(entry.path().extension().string());
 
-                if (it1 != encds.end() && it2 != exts.end() && it1->second == it2->second)
+                if (it1 != encds.end() && it2 != exts.end() && (from_ir ? encd::IR : it1->second) == it2->second)
+                {
+                    list.push_back(std::make_unique<job>());
+                    list.back()->file = entry.path().string();
+                    list.back()->finished = false;
+                }
+            }
+        }
+
+        const auto start = std::chrono::steady_clock::now();
+        std::size_t done = 0, skipped = 0, failed = 0;
+
+        auto count = [&](status result)
+        {
+            switch (result)
+            {
+                case status::done: done++; break;
+                case status::skipped: skipped++; break;
+                case status::failed: failed++; break;
+            }
+        };
+
+        if (jobs > 1 && list.size() > 1)
+        {
+            std::mutex mutex;
+            std::condition_variable cv;
+            utils::thread_pool pool(jobs);
+            workers = &pool;
+
+            for (auto& entry : list)
+            {
+                pool.submit([&, ptr = entry.get()]
                 {
-                    funcs[mode](game, entry.path().string());
+                    auto result = process_file(mode, game, ptr->file, ptr->out, ptr->err);
+
+                    {
+                        std::lock_guard<std::mutex> lock(mutex);
+                        ptr->result = result;
+                        ptr->finished = true;
+                    }
+
+                    cv.notify_all();
+                });
+            }
+
+            // flush logs in directory order as soon as each file is finished
+            for (auto& entry : list)
+            {
+                {
+                    std::unique_lock<std::mutex> lock(mutex);
+                    cv.wait(lock, [&] { return entry->finished; });
                 }
-            }  
+
+                std::cout << entry->out.str();
+                std::cerr << entry->err.str();
+                count(entry->result);
+                entry.reset();
+            }
+
+            pool.wait();
+            workers = nullptr;
         }
+        else if (mode == mode::COMP && !emit_ir && list.size() > 1)
+        {
+            // a single worker writes each script while the next one compiles, the
+            // log of a script is flushed once its outputs are on disk
+            utils::thread_pool pool(1);
+            std::future<status> previous;
+            writer = &pool;
+
+            for (auto i = 0u; i <= list.size(); i++)
+            {
+                std::future<status> current;
+
+                if (i < list.size())
+                {
+                    auto& entry = list[i];
+                    entry->result = process_file(mode, game, entry->file, entry->out, entry->err);
+                    current = std::move(pending_write);
+                }
+
+                if (i > 0)
+                {
+                    auto& entry = list[i - 1];
+
+                    if (previous.valid())
+                    {
+                        entry->result = previous.get();
+                    }
+
+                    std::cout << entry->out.str();
+                    std::cerr << entry->err.str();
+                    count(entry->result);
+                    entry.reset();
+                }
+
+                previous = std::move(current);
+            }
+
+            writer = nullptr;
+        }
+        else
+        {
+            for (auto& entry : list)
+            {
+                count(process_file(mode, game, entry->file, std::cout, std::cerr));
+            }
+        }
+
+        const auto elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+        std::cout << utils::string::va("processed %zu files (%zu ok, %zu skipped, %zu failed) in %.2fs\n",
+            list.size(), done, skipped, failed, elapsed);
     }
     else if (std::filesystem::is_regular_file(path))
     {
-        funcs[mode](game, path);
+        if (jobs > 1)
+        {
+            // a single script still splits its functions across the workers
+            utils::thread_pool pool(jobs);
+            workers = &pool;
+            process_file(mode, game, path, std::cout, std::cerr);
+            workers = nullptr;
+        }
+        else
+        {
+            process_file(mode, game, path, std::cout, std::cerr);
+        }
     }
 }
 
 int parse_flags(int argc, char** argv, game& game, mode& mode, std::string& path)
 {
-    if (argc != 4) return 1;
+    std::vector<std::string> args;
 
-    auto arg = utils::string::to_lower(argv[1]);
+    for (auto i = 1; i < argc; i++)
+    {
+        auto arg = std::string(argv[i]);
+
+        if (arg.rfind("-j", 0) == 0)
+        {
+            auto value = arg.size() > 2 ? arg.substr(2) : (i + 1 < argc) ? std::string(argv[++i]) : ""s;
+
+            if (!utils::string::is_number(value))
+            {
+                std::cout << "Invalid job count '" << value << "'.\n\n";
+                return 1;
+            }
+
+            jobs = std::strtoul(value.data(), nullptr, 10);
+
+            if (jobs == 0)
+            {
+                jobs = static_cast<std::uint32_t>(utils::thread_pool::hardware_threads());
+            }
+        }
+        else if (arg == "--emit-ir")
+        {
+            emit_ir = true;
+        }
+        else if (arg == "--from-ir")
+        {
+            from_ir = true;
+        }
+        else if (arg == "--opt-stats")
+        {
+            opt_stats = true;
+        }
+        else if (arg == "--inline")
+        {
+            inlining = true;
+        }
+        else if (arg == "--peephole")
+        {
+            peephole_rules = true;
+        }
+        else if (arg == "--jump-threading")
+        {
+            jump_threading = true;
+        }
+        else if (arg == "--build-cache")
+        {
+            if (i + 1 >= argc)
+            {
+                std::cout << "Missing build cache directory.\n\n";
+                return 1;
+            }
+
+            build_cache_dir = argv[++i];
+        }
+        else if (arg == "--zlib-level")
+        {
+            auto value = (i + 1 < argc) ? std::string(argv[++i]) : ""s;
+
+            if (value.size() != 1 || !utils::string::is_number(value))
+            {
+                std::cout << "Invalid zlib level '" << value << "'.\n\n";
+                return 1;
+            }
+
+            zlib_level = std::stoi(value);
+        }
+        else if (arg == "--include-cache")
+        {
+            if (i + 1 >= argc)
+            {
+                std::cout << "Missing include cache file.\n\n";
+                return 1;
+            }
+
+            include_cache_file = argv[++i];
+        }
+        else
+        {
+            args.push_back(arg);
+        }
+    }
+
+    if (args.size() != 3) return 1;
+
+    auto arg = utils::string::to_lower(args[0]);
 
     if (arg.at(0) == 'z')
     {
@@ -443,11 +963,65 @@ int parse_flags(int argc, char** argv, game& game, mode& mode, std::string& path
     }
     else
     {
-        std::cout << "Unknown mode '" << argv[1] << "'.\n\n";
+        std::cout << "Unknown mode '" << args[0] << "'.\n\n";
+        return 1;
+    }
+
+    if (emit_ir && mode != mode::DISASM && mode != mode::COMP)
+    {
+        std::cout << "--emit-ir is only valid for disasm and comp.\n\n";
+        return 1;
+    }
+
+    if (from_ir && mode != mode::ASM && mode != mode::DECOMP)
+    {
+        std::cout << "--from-ir is only valid for asm and decomp.\n\n";
+        return 1;
+    }
+
+    if (zlib_level != utils::zlib::best && mode != mode::ASM && mode != mode::COMP)
+    {
+        std::cout << "--zlib-level is only valid for asm and comp.\n\n";
+        return 1;
+    }
+
+    if (opt_stats && mode != mode::COMP)
+    {
+        std::cout << "--opt-stats is only valid for comp.\n\n";
         return 1;
     }
 
-    arg = utils::string::to_lower(argv[2]);
+    if (inlining && mode != mode::COMP)
+    {
+        std::cout << "--inline is only valid for comp.\n\n";
+        return 1;
+    }
+
+    if (peephole_rules && mode != mode::COMP)
+    {
+        std::cout << "--peephole is only valid for comp.\n\n";
+        return 1;
+    }
+
+    if (jump_threading && mode != mode::COMP)
+    {
+        std::cout << "--jump-threading is only valid for comp.\n\n";
+        return 1;
+    }
+
+    if (!include_cache_file.empty() && mode != mode::COMP)
+    {
+        std::cout << "--include-cache is only valid for comp.\n\n";
+        return 1;
+    }
+
+    if (!build_cache_dir.empty() && (mode != mode::COMP || emit_ir))
+    {
+        std::cout << "--build-cache is only valid for comp without --emit-ir.\n\n";
+        return 1;
+    }
+
+    arg = utils::string::to_lower(args[1]);
 
     const auto itr = games.find(arg);
 
@@ -457,21 +1031,46 @@ int parse_flags(int argc, char** argv, game& game, mode& mode, std::string& path
     }
     else
     {
-        std::cout << "Unknown game '" << argv[2] << "'.\n\n";
+        std::cout << "Unknown game '" << args[1] << "'.\n\n";
         return 1;
     }
 
-    path = utils::string::fordslash(argv[3]);
+    path = utils::string::fordslash(args[2]);
 
     return 0;
 }
 
+void print_opt_stats()
+{
+    std::size_t total = 0;
+
+    std::cout << "function pass rewrites:\n";
+
+    for (const auto& [name, count] : opt_counts)
+    {
+        std::cout << utils::string::va("\t%-20s %zu\n", name.data(), count);
+        total += count;
+    }
+
+    std::cout << utils::string::va("\t%-20s %zu\n", "total", total);
+}
+
 void print_usage()
 {
-    std::cout << "usage: gsc-tool.exe <mode> <game> <path>\n";
+    std::cout << "usage: gsc-tool.exe [-j <jobs>] [--emit-ir | --from-ir] [--zlib-level <0-9>] [--opt-stats] [--inline] [--peephole] [--jump-threading] [--include-cache <file>] [--build-cache <dir>] <mode> <game> <path>\n";
     std::cout << "	* modes: asm, disasm, comp, decomp\n";
     std::cout << "	* games: iw5, iw6, iw7, iw8, s1, s2, s4, h1, h2\n";
     std::cout << "	* paths: file or directory (recursive)\n";
+    std::cout << "	* jobs: worker threads for directories and script functions (0 = all cores, default 1)\n";
+    std::cout << "	* --emit-ir: disasm/comp write a binary .gscir instead of .gscasm/.gscbin\n";
+    std::cout << "	* --from-ir: asm/decomp read a binary .gscir instead of .gscasm/.gscbin\n";
+    std::cout << "	* --zlib-level: asm/comp deflate level of .gscbin stacks, 0 = store uncompressed, 1 = fastest, 9 = best (default)\n";
+    std::cout << "	* --opt-stats: comp prints how many times each jump threading, block layout, peephole and local slot rewrite fired, scripts restored from --build-cache are not counted\n";
+    std::cout << "	* --inline: comp replaces calls to small threads of the same script that only return an expression without waiting\n";
+    std::cout << "	* --peephole: comp rewrites short instruction sequences of each function\n";
+    std::cout << "	* --jump-threading: comp threads and inverts jumps, drops unreachable blocks and lays out the blocks of each function\n";
+    std::cout << "	* --include-cache: comp keeps the parsed #include function lists in <file> between runs\n";
+    std::cout << "	* --build-cache: comp reuses outputs from <dir> for scripts whose sources, includes and headers are unchanged\n";
 }
 
 std::uint32_t main(std::uint32_t argc, char** argv)
@@ -480,46 +1079,6 @@ std::uint32_t main(std::uint32_t argc, char** argv)
     mode mode = mode::__;
     game game = game::__;
 
-    assemblers[game::IW5] = std::make_unique<gsc::iw5::assembler>();
-    assemblers[game::IW6] = std::make_unique<gsc::iw6::assembler>();
-    assemblers[game::IW7] = std::make_unique<gsc::iw7::assembler>();
-    assemblers[game::IW8] = std::make_unique<gsc::iw8::assembler>();
-    assemblers[game::S1] = std::make_unique<gsc::s1::assembler>();
-    assemblers[game::S2] = std::make_unique<gsc::s2::assembler>();
-    assemblers[game::S4] = std::make_unique<gsc::s4::assembler>();
-    assemblers[game::H1] = std::make_unique<gsc::h1::assembler>();
-    assemblers[game::H2] = std::make_unique<gsc::h2::assembler>();
-
-    disassemblers[game::IW5] = std::make_unique<gsc::iw5::disassembler>();
-    disassemblers[game::IW6] = std::make_unique<gsc::iw6::disassembler>();
-    disassemblers[game::IW7] = std::make_unique<gsc::iw7::disassembler>();
-    disassemblers[game::IW8] = std::make_unique<gsc::iw8::disassembler>();
-    disassemblers[game::S1] = std::make_unique<gsc::s1::disassembler>();
-    disassemblers[game::S2] = std::make_unique<gsc::s2::disassembler>();
-    disassemblers[game::S4] = std::make_unique<gsc::s4::disassembler>();
-    disassemblers[game::H1] = std::make_unique<gsc::h1::disassembler>();
-    disassemblers[game::H2] = std::make_unique<gsc::h2::disassembler>();
-
-    compilers[game::IW5] = std::make_unique<gsc::iw5::compiler>(gsc::build::prod);
-    compilers[game::IW6] = std::make_unique<gsc::iw6::compiler>(gsc::build::prod);
-    compilers[game::IW7] = std::make_unique<gsc::iw7::compiler>(gsc::build::prod);
-    compilers[game::IW8] = std::make_unique<gsc::iw8::compiler>(gsc::build::prod);
-    compilers[game::S1] = std::make_unique<gsc::s1::compiler>(gsc::build::prod);
-    compilers[game::S2] = std::make_unique<gsc::s2::compiler>(gsc::build::prod);
-    compilers[game::S4] = std::make_unique<gsc::s4::compiler>(gsc::build::prod);
-    compilers[game::H1] = std::make_unique<gsc::h1::compiler>(gsc::build::prod);
-    compilers[game::H2] = std::make_unique<gsc::h2::compiler>(gsc::build::prod);
-
-    decompilers[game::IW5] = std::make_unique<gsc::iw5::decompiler>();
-    decompilers[game::IW6] = std::make_unique<gsc::iw6::decompiler>();
-    decompilers[game::IW7] = std::make_unique<gsc::iw7::decompiler>();
-    decompilers[game::IW8] = std::make_unique<gsc::iw8::decompiler>();
-    decompilers[game::S1] = std::make_unique<gsc::s1::decompiler>();
-    decompilers[game::S2] = std::make_unique<gsc::s2::decompiler>();
-    decompilers[game::S4] = std::make_unique<gsc::s4::decompiler>();
-    decompilers[game::H1] = std::make_unique<gsc::h1::decompiler>();
-    decompilers[game::H2] = std::make_unique<gsc::h2::decompiler>();
-
     funcs[mode::ASM] = assemble_file;
     funcs[mode::DISASM] = disassemble_file;
     funcs[mode::COMP] = compile_file;
@@ -531,8 +1090,28 @@ std::uint32_t main(std::uint32_t argc, char** argv)
         return 0;
     }
 
+    if (!include_cache_file.empty())
+    {
+        include_cache.load(include_cache_file, game_name(game));
+    }
+
+    if (!build_cache_dir.empty())
+    {
+        builds = std::make_unique<gsc::build_cache>(build_cache_dir);
+    }
+
     execute(mode, game, path);
 
+    if (opt_stats)
+    {
+        print_opt_stats();
+    }
+
+    if (!include_cache_file.empty() && include_cache.modified())
+    {
+        include_cache.save(include_cache_file, game_name(game));
+    }
+
     return 0;
 }
 
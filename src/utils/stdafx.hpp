@@ -17,19 +17,29 @@
 // C/C++
 #include <regex>
 #include <string>
+#include <cstring>
 #include <vector>
 #include <memory>
 #include <algorithm>
+#include <cmath>
 #include <filesystem>
 #include <functional>
 #include <stdexcept>
 #include <map>
+#include <set>
 #include <stack>
 #include <array>
 #include <iostream>
 #include <sstream>
 #include <fstream>
 #include <unordered_map>
+#include <unordered_set>
+#include <deque>
+#include <thread>
+#include <mutex>
+#include <shared_mutex>
+#include <condition_variable>
+#include <atomic>
 #include <stdio.h>
 
 // Ext
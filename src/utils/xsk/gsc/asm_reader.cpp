@@ -0,0 +1,157 @@
+// Copyright 2021 xensik. All rights reserved.
+//
+// Use of this source code is governed by a GNU GPLv3 license
+// that can be found in the LICENSE file.
+
+#include "stdafx.hpp"
+
+namespace xsk::gsc
+{
+
+namespace
+{
+
+auto is_word(char c) -> bool
+{
+    return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9') || c == '_' || c == '-';
+}
+
+auto is_space(char c) -> bool
+{
+    return c == ' ' || c == '\t' || c == '\n' || c == '\v' || c == '\f' || c == '\r';
+}
+
+} // namespace
+
+asm_reader::asm_reader(const std::uint8_t* data, std::size_t size)
+    : data_(reinterpret_cast<const char*>(data), size), pos_(0) {}
+
+auto asm_reader::next() -> bool
+{
+    while (pos_ < data_.size())
+    {
+        auto end = data_.find('\n', pos_);
+
+        if (end == std::string_view::npos)
+            end = data_.size();
+
+        const auto raw = data_.substr(pos_, end - pos_);
+        pos_ = end + 1;
+
+        if (raw.find_first_of("\t\r") == std::string_view::npos)
+        {
+            line_ = raw;
+        }
+        else
+        {
+            clean_.clear();
+
+            for (const auto c : raw)
+            {
+                if (c != '\t' && c != '\r')
+                    clean_.push_back(c);
+            }
+
+            line_ = clean_;
+        }
+
+        if (!line_.empty())
+            return true;
+    }
+
+    line_ = {};
+    return false;
+}
+
+auto asm_reader::line() const -> std::string_view
+{
+    return line_;
+}
+
+// splits the line into words ([_A-Za-z0-9-]+) and quoted strings, a token
+// counts only when followed by whitespace or the end of the line
+auto asm_reader::tokens() -> const std::vector<std::string_view>&
+{
+    tokens_.clear();
+
+    std::size_t pos = 0;
+
+    while (pos < line_.size())
+    {
+        const auto c = line_[pos];
+
+        if (is_word(c))
+        {
+            auto end = pos;
+
+            while (end < line_.size() && is_word(line_[end]))
+                end++;
+
+            if (end == line_.size() || is_space(line_[end]))
+                tokens_.push_back(line_.substr(pos, end - pos));
+
+            pos = end;
+        }
+        else if (c == '"' || c == '\'')
+        {
+            const auto end = quoted(pos);
+
+            if (end != std::string_view::npos)
+            {
+                tokens_.push_back(line_.substr(pos, end - pos));
+                pos = end;
+            }
+            else
+            {
+                pos++;
+            }
+        }
+        else
+        {
+            pos++;
+        }
+    }
+
+    return tokens_;
+}
+
+// returns the end of the quoted string starting at pos, or npos. the closing quote
+// must be followed by whitespace or the end of the line, escapes are preferred
+// but a backslash may also stand for itself when that is the only way to close
+auto asm_reader::quoted(std::size_t pos) -> std::size_t
+{
+    const auto quote = line_[pos];
+    const auto size = line_.size();
+    const auto none = std::string_view::npos;
+
+    for (auto i = pos + 1; i < size;)
+    {
+        if (line_[i] == quote)
+        {
+            if (i + 1 == size || is_space(line_[i + 1]))
+                return i + 1;
+
+            break;
+        }
+
+        i += (line_[i] == '\\' && i + 1 < size) ? 2 : 1;
+    }
+
+    ends_.assign(size + 2, none);
+
+    for (auto i = size; i > pos + 1; i--)
+    {
+        const auto c = line_[i - 1];
+
+        if (c == quote)
+            ends_[i - 1] = (i == size || is_space(line_[i])) ? i : none;
+        else if (c == '\\' && i < size && ends_[i + 1] != none)
+            ends_[i - 1] = ends_[i + 1];
+        else
+            ends_[i - 1] = ends_[i];
+    }
+
+    return ends_[pos + 1];
+}
+
+} // namespace xsk::gsc
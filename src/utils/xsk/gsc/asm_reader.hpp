@@ -0,0 +1,32 @@
+// Copyright 2021 xensik. All rights reserved.
+//
+// Use of this source code is governed by a GNU GPLv3 license
+// that can be found in the LICENSE file.
+
+#pragma once
+
+namespace xsk::gsc
+{
+
+// single pass .gscasm reader, lines have tabs and carriage returns removed
+// and tokens are views into the current line, valid until the next call to next()
+class asm_reader
+{
+    std::string_view data_;
+    std::size_t pos_;
+    std::string_view line_;
+    std::string clean_;
+    std::vector<std::string_view> tokens_;
+    std::vector<std::size_t> ends_;
+
+public:
+    asm_reader(const std::uint8_t* data, std::size_t size);
+    auto next() -> bool;
+    auto line() const -> std::string_view;
+    auto tokens() -> const std::vector<std::string_view>&;
+
+private:
+    auto quoted(std::size_t pos) -> std::size_t;
+};
+
+} // namespace xsk::gsc
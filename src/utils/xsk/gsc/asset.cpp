@@ -8,57 +8,78 @@
 namespace xsk::gsc
 {
 
-auto asset::serialize() -> std::vector<std::uint8_t>
+auto asset::serialize() const -> std::vector<std::uint8_t>
 {
-    std::vector<std::uint8_t> data;
+    utils::byte_buffer data(name.size() + compressedLen + bytecodeLen + 13);
 
-    data.resize(name.size() + compressedLen + bytecodeLen + 13);
-    std::memset(data.data(), 0, data.size());
+    serialize(data);
 
-    auto pos = 0u;
-    
-    std::memcpy(&data[pos], name.data(), name.size() + 1);
-    pos += name.size() + 1;
-
-    *reinterpret_cast<std::uint32_t*>(&data[pos]) = compressedLen;
-    pos += 4;
-
-    *reinterpret_cast<std::uint32_t*>(&data[pos]) = len;
-    pos += 4;
-
-    *reinterpret_cast<std::uint32_t*>(&data[pos]) = bytecodeLen;
-    pos += 4;
+    return data.release();
+}
 
-    std::memcpy(&data[pos], buffer.data(), buffer.size());
-    pos += buffer.size();
+void asset::serialize(std::ostream& stream) const
+{
+    stream.write(name.data(), name.size() + 1);
+    stream.write(reinterpret_cast<const char*>(&compressedLen), 4);
+    stream.write(reinterpret_cast<const char*>(&len), 4);
+    stream.write(reinterpret_cast<const char*>(&bytecodeLen), 4);
+    stream.write(reinterpret_cast<const char*>(buffer), compressedLen);
+    stream.write(reinterpret_cast<const char*>(bytecode), bytecodeLen);
+    stream.flush();
+
+    if (!stream.good())
+    {
+        throw std::runtime_error("Couldn't write asset '" + name + "'");
+    }
+}
 
-    std::memcpy(&data[pos], bytecode.data(), bytecode.size());
+void asset::serialize(utils::byte_buffer& data) const
+{
+    data.write_c_string(name);
+    data.write<std::uint32_t>(compressedLen);
+    data.write<std::uint32_t>(len);
+    data.write<std::uint32_t>(bytecodeLen);
+    data.write_bytes(buffer, compressedLen);
+    data.write_bytes(bytecode, bytecodeLen);
+}
 
-    return data;
+void asset::deserialize(const std::vector<std::uint8_t>& data)
+{
+    deserialize(data.data(), data.size());
 }
 
-void asset::deserialize(std::vector<std::uint8_t> data)
+void asset::deserialize(const std::uint8_t* data, std::size_t size)
 {
-    auto pos = 0u;
+    const auto* end = data + size;
+    const auto* term = std::find(data, end, 0);
 
-    name = std::string(reinterpret_cast<const char*>(data.data()));
-    pos += name.size() + 1;
+    if (term == end || static_cast<std::size_t>(end - term) < 13)
+    {
+        throw std::runtime_error("Couldn't read asset header, data is truncated");
+    }
 
-    compressedLen = *reinterpret_cast<std::uint32_t*>(data.data() + pos);
+    name = std::string(reinterpret_cast<const char*>(data), term - data);
+
+    auto pos = name.size() + 1;
+
+    std::memcpy(&compressedLen, data + pos, 4);
     pos += 4;
 
-    len = *reinterpret_cast<std::uint32_t*>(data.data() + pos);
+    std::memcpy(&len, data + pos, 4);
     pos += 4;
 
-    bytecodeLen = *reinterpret_cast<std::uint32_t*>(data.data() + pos);
+    std::memcpy(&bytecodeLen, data + pos, 4);
     pos += 4;
 
-    buffer.resize(compressedLen);
-    std::memcpy(buffer.data(), data.data() + pos, compressedLen);
-    pos += buffer.size();
+    if (size - pos < static_cast<std::size_t>(compressedLen) + bytecodeLen)
+    {
+        throw std::runtime_error("Couldn't read asset '" + name + "', data is truncated");
+    }
+
+    buffer = data + pos;
+    pos += compressedLen;
 
-    bytecode.resize(bytecodeLen);
-    std::memcpy(bytecode.data(), data.data() + pos, bytecodeLen);
+    bytecode = data + pos;
 }
 
 } // namespace xsk::gsc
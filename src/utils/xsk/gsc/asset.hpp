@@ -16,11 +16,17 @@ struct asset
     std::uint32_t compressedLen;
     std::uint32_t len;
     std::uint32_t bytecodeLen;
-    std::vector<std::uint8_t> buffer;
-    std::vector<std::uint8_t> bytecode;
 
-    auto serialize() -> std::vector<std::uint8_t>;
-    void deserialize(std::vector<std::uint8_t> data);
+    // views of compressedLen and bytecodeLen bytes, deserialize points them into its input,
+    // which has to outlive the asset
+    const std::uint8_t* buffer = nullptr;
+    const std::uint8_t* bytecode = nullptr;
+
+    auto serialize() const -> std::vector<std::uint8_t>;
+    void serialize(std::ostream& stream) const;
+    void serialize(utils::byte_buffer& data) const;
+    void deserialize(const std::vector<std::uint8_t>& data);
+    void deserialize(const std::uint8_t* data, std::size_t size);
 };
 
 } // namespace xsk::gsc
@@ -8,13 +8,16 @@
 namespace xsk::gsc
 {
 
-block::block() : is_last(false), abort(abort_t::abort_none),
+// the decompiler names its labels, the compiler jumps to label ids, 0 when there's none
+block::block() : is_last(false), abort(abort_t::abort_none), label_break(0), label_continue(0),
     local_vars_create_count(0), local_vars_public_count(0) { }
 
 void block::transfer(const block::ptr& child)
 {
     child->loc_break = this->loc_break;
     child->loc_continue = this->loc_continue;
+    child->label_break = this->label_break;
+    child->label_continue = this->label_continue;
 
     for (std::uint32_t i = 0; i < child->local_vars_public_count || i < this->local_vars_create_count; i++ )
     {
@@ -142,12 +145,28 @@ void block::init_from_child(const std::vector<block*>& childs)
     }
 }
 
-auto block::find_variable(std::size_t start, const std::string& name) -> std::int32_t
+auto block::find_variable(std::size_t start, utils::interner::handle name) -> std::int32_t
 {
-    for (std::size_t i = start; i < local_vars.size(); ++i )
+    const auto pos = find_variable(name);
+    return pos >= std::int32_t(start) ? pos : -1;
+}
+
+// names are unique in a block. local_vars is reordered in place, so a remembered position
+// is only used while it still holds the name and the list is scanned again otherwise
+auto block::find_variable(utils::interner::handle name) -> std::int32_t
+{
+    const auto itr = positions_.find(name);
+
+    if (itr != positions_.end() && itr->second < local_vars.size() && local_vars[itr->second].name == name)
+        return itr->second;
+
+    for (std::size_t i = 0; i < local_vars.size(); ++i )
     {
-        if (local_vars.at(i).name == name)
+        if (local_vars[i].name == name)
+        {
+            positions_[name] = i;
             return i;
+        }
     }
     return -1;
 }
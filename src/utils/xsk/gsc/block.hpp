@@ -10,7 +10,7 @@ namespace xsk::gsc
 
 struct local_var
 {
-    std::string name;
+    utils::interner::handle name;
     std::uint8_t create;
     bool init;
 };
@@ -22,6 +22,8 @@ struct block
     std::string loc_end;
     std::string loc_break;
     std::string loc_continue;
+    std::uint32_t label_break;
+    std::uint32_t label_continue;
     std::vector<local_var> local_vars;
     std::uint32_t local_vars_create_count;
     std::uint32_t local_vars_public_count;
@@ -34,9 +36,13 @@ struct block
     void append(const std::vector<block*>& childs);
     void merge(const std::vector<block*>& childs);
     void init_from_child(const std::vector<block*>& childs);
-    auto find_variable(std::size_t start, const std::string& name) -> std::int32_t;
+    auto find_variable(std::size_t start, utils::interner::handle name) -> std::int32_t;
+    auto find_variable(utils::interner::handle name) -> std::int32_t;
     void transfer_decompiler(const block::ptr& child);
     void append_decompiler(const block::ptr& child, bool all = false);
+
+private:
+    std::unordered_map<utils::interner::handle, std::uint32_t> positions_;
 };
 
 } // namespace xsk::gsc
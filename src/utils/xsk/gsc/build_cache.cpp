@@ -0,0 +1,177 @@
+// Copyright 2021 xensik. All rights reserved.
+//
+// Use of this source code is governed by a GNU GPLv3 license
+// that can be found in the LICENSE file.
+
+#include "stdafx.hpp"
+
+// manifest layout, all integers little endian, strings are u32 length + bytes:
+//   u32 magic, u16 version, string file, u32 dependency count, { string file }
+
+namespace xsk::gsc
+{
+
+namespace
+{
+
+// a u32 size ahead of the bytes, so neighbouring parts of a key can't run into each other
+auto hash_part(std::uint64_t value, const std::string& data) -> std::uint64_t
+{
+    return utils::hash::fnv1a(data, utils::hash::fnv1a_le(static_cast<std::uint32_t>(data.size()), value));
+}
+
+void write_string(utils::byte_buffer& data, const std::string& value)
+{
+    data.write_le<std::uint32_t>(static_cast<std::uint32_t>(value.size()));
+    data.write_string(value);
+}
+
+auto read_string(utils::byte_buffer& data) -> std::string
+{
+    return data.read_string(data.read_le<std::uint32_t>());
+}
+
+// unique name next to a cache file, files are renamed into place so readers only see them complete
+auto temp_name(const std::string& file) -> std::string
+{
+    static std::atomic<std::uint32_t> counter = 0;
+
+    return utils::string::va("%s.%zX.%u.tmp", file.data(), std::hash<std::thread::id>()(std::this_thread::get_id()), counter++);
+}
+
+} // namespace
+
+build_cache::build_cache(const std::string& path) : path_(path)
+{
+    std::filesystem::create_directories(path_ + "/objects");
+    std::filesystem::create_directories(path_ + "/manifests");
+}
+
+// object path without extension when every output is cached, empty otherwise
+auto build_cache::find(const std::string& file, std::uint64_t source, const std::string& config, const std::vector<std::string>& exts) -> std::string
+{
+    const auto name = manifest(file, config);
+
+    if (!utils::file::exists(name)) return "";
+
+    std::vector<std::string> deps;
+
+    try
+    {
+        auto content = utils::file::read(name);
+        utils::byte_buffer input(content);
+
+        if (content.size() < 6 || input.read_le<std::uint32_t>() != magic) return "";
+        if (input.read_le<std::uint16_t>() != version || read_string(input) != file) return "";
+
+        const auto count = input.read_le<std::uint32_t>();
+
+        for (auto i = 0u; i < count; i++)
+        {
+            deps.push_back(read_string(input));
+        }
+    }
+    catch (const std::exception&)
+    {
+        return "";
+    }
+
+    const auto object = key(file, source, config, deps);
+
+    if (object.empty()) return "";
+
+    for (const auto& ext : exts)
+    {
+        if (!utils::file::exists(object + ext)) return "";
+    }
+
+    return object;
+}
+
+void build_cache::store(const std::string& file, std::uint64_t source, const std::string& config, const std::vector<std::string>& deps, const std::string& output, const std::vector<std::string>& exts)
+{
+    const auto object = key(file, source, config, deps);
+
+    if (object.empty()) return;
+
+    for (const auto& ext : exts)
+    {
+        const auto temp = temp_name(object + ext);
+
+        std::filesystem::copy_file(output + ext, temp, std::filesystem::copy_options::overwrite_existing);
+        std::filesystem::rename(temp, object + ext);
+    }
+
+    utils::byte_buffer content;
+
+    content.write_le<std::uint32_t>(magic);
+    content.write_le<std::uint16_t>(version);
+    write_string(content, file);
+    content.write_le<std::uint32_t>(static_cast<std::uint32_t>(deps.size()));
+
+    for (const auto& dep : deps)
+    {
+        write_string(content, dep);
+    }
+
+    const auto name = manifest(file, config);
+    const auto temp = temp_name(name);
+
+    utils::file::save(temp, content.buffer());
+    std::filesystem::rename(temp, name);
+}
+
+// empty when a dependency can't be read anymore
+auto build_cache::key(const std::string& file, std::uint64_t source, const std::string& config, const std::vector<std::string>& deps) -> std::string
+{
+    // the outputs embed the script name, so it is part of the key too
+    auto value = hash_part(hash_part(utils::hash::basis ^ version, config), file);
+
+    value = utils::hash::fnv1a_le(source, value);
+
+    for (const auto& dep : deps)
+    {
+        auto content = std::uint64_t(0);
+
+        if (!dependency(dep, content)) return "";
+
+        value = utils::hash::fnv1a_le(content, hash_part(value, dep));
+    }
+
+    return utils::string::va("%s/objects/%016llX", path_.data(), static_cast<unsigned long long>(value));
+}
+
+// files don't change during a run, so each one is read and hashed once however many scripts include it
+auto build_cache::dependency(const std::string& file, std::uint64_t& value) -> bool
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+
+        const auto itr = deps_.find(file);
+
+        if (itr != deps_.end())
+        {
+            value = itr->second;
+            return true;
+        }
+    }
+
+    if (!utils::file::exists(file)) return false;
+
+    value = utils::hash::fnv1a(utils::file::read(file));
+
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    deps_.emplace(file, value);
+
+    return true;
+}
+
+auto build_cache::manifest(const std::string& file, const std::string& config) -> std::string
+{
+    const auto value = hash_part(hash_part(utils::hash::basis, config), file);
+
+    return utils::string::va("%s/manifests/%016llX", path_.data(), static_cast<unsigned long long>(value));
+}
+
+} // namespace xsk::gsc
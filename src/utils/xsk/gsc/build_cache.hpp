@@ -0,0 +1,36 @@
+// Copyright 2021 xensik. All rights reserved.
+//
+// Use of this source code is governed by a GNU GPLv3 license
+// that can be found in the LICENSE file.
+
+#pragma once
+
+namespace xsk::gsc
+{
+
+// compiled outputs on disk, addressed by a hash of the script name and bytes, the bytes of
+// every include and gsh header the last build of that script read, and the build config.
+// objects/<key><ext> hold the outputs, manifests/<hash> the dependency list of a source
+class build_cache
+{
+public:
+    static constexpr std::uint32_t magic = 0x43425347; // "GSBC"
+    static constexpr std::uint16_t version = 7;
+
+private:
+    std::string path_;
+    std::unordered_map<std::string, std::uint64_t> deps_;
+    std::mutex mutex_;
+
+public:
+    build_cache(const std::string& path);
+    auto find(const std::string& file, std::uint64_t source, const std::string& config, const std::vector<std::string>& exts) -> std::string;
+    void store(const std::string& file, std::uint64_t source, const std::string& config, const std::vector<std::string>& deps, const std::string& output, const std::vector<std::string>& exts);
+
+private:
+    auto key(const std::string& file, std::uint64_t source, const std::string& config, const std::vector<std::string>& deps) -> std::string;
+    auto dependency(const std::string& file, std::uint64_t& value) -> bool;
+    auto manifest(const std::string& file, const std::string& config) -> std::string;
+};
+
+} // namespace xsk::gsc
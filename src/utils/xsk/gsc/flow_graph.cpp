@@ -0,0 +1,622 @@
+// Copyright 2021 xensik. All rights reserved.
+//
+// Use of this source code is governed by a GNU GPLv3 license
+// that can be found in the LICENSE file.
+
+#include "stdafx.hpp"
+
+namespace xsk::gsc
+{
+
+namespace
+{
+
+using op = opcode_table::op;
+
+// conditional jumps and jumpback store a 16 bit offset
+constexpr std::uint32_t short_jump_max = 0x7FFF;
+constexpr std::size_t no_block = std::numeric_limits<std::size_t>::max();
+constexpr std::uint32_t no_label = std::numeric_limits<std::uint32_t>::max();
+
+struct block
+{
+    std::size_t begin = 0;
+    std::size_t end = 0;
+    op branch = op::none;
+    std::size_t target = no_block;
+    std::vector<std::size_t> cases;
+    std::size_t chain = no_block;
+    std::uint32_t label = no_label;
+    bool falls = false;
+    bool live = true;
+    bool drop = false;
+};
+
+auto is_jump(op kind) -> bool
+{
+    return kind == op::jump || kind == op::jump_back;
+}
+
+auto is_condition(op kind) -> bool
+{
+    switch (kind)
+    {
+        case op::jump_on_false:
+        case op::jump_on_true:
+        case op::jump_on_false_expr:
+        case op::jump_on_true_expr:
+            return true;
+        default:
+            return false;
+    }
+}
+
+auto ends_block(op kind) -> bool
+{
+    return is_jump(kind) || is_condition(kind) || kind == op::switch_jump || kind == op::switch_end || kind == op::end || kind == op::ret;
+}
+
+auto invert(op kind) -> op
+{
+    return kind == op::jump_on_false ? op::jump_on_true : op::jump_on_false;
+}
+
+// blocks keep their original order in the vector, the layout only decides the order they
+// are emitted in. instructions aren't touched until the new layout is known to assemble
+class graph
+{
+public:
+    const opcode_table& ops;
+    function& func;
+    std::vector<block> blocks;
+    std::vector<std::size_t> refs;
+    std::map<std::string, std::size_t> stats;
+
+    graph(const opcode_table& ops, function& func) : ops(ops), func(func) {}
+
+    // false when a label doesn't resolve to an instruction or a block runs off the end
+    auto build() -> bool
+    {
+        const auto& insts = func.instructions;
+        std::unordered_map<std::uint32_t, std::size_t> position;
+        std::vector<bool> leader(insts.size(), false);
+
+        leader[0] = true;
+
+        for (auto i = 0u; i < insts.size(); i++)
+        {
+            position.insert({ insts[i]->index, i });
+
+            if (ends_block(ops.kind(*insts[i])) && i + 1 < insts.size())
+            {
+                leader[i + 1] = true;
+            }
+        }
+
+        for (const auto& entry : func.labels)
+        {
+            const auto itr = position.find(entry.first);
+
+            if (itr == position.end()) return false;
+
+            leader[itr->second] = true;
+        }
+
+        std::vector<std::size_t> block_at(insts.size());
+
+        for (auto i = 0u; i < insts.size(); i++)
+        {
+            if (leader[i])
+            {
+                if (!blocks.empty()) blocks.back().end = i;
+
+                blocks.emplace_back();
+                blocks.back().begin = i;
+            }
+
+            block_at[i] = blocks.size() - 1;
+        }
+
+        blocks.back().end = insts.size();
+
+        std::unordered_map<std::uint32_t, std::size_t> labeled;
+
+        for (const auto& [index, label] : func.labels)
+        {
+            const auto id = block_at[position.at(index)];
+
+            blocks[id].label = label;
+            labeled.insert({ label, id });
+        }
+
+        const auto resolve = [&labeled](const operand& label)
+        {
+            const auto itr = labeled.find(label.as_label());
+            return itr != labeled.end() ? itr->second : no_block;
+        };
+
+        for (auto i = 0u; i < blocks.size(); i++)
+        {
+            auto& blk = blocks[i];
+            const auto& inst = *insts[blk.end - 1];
+            const auto kind = ops.kind(inst);
+
+            if (is_jump(kind) || is_condition(kind) || kind == op::switch_jump)
+            {
+                blk.branch = kind;
+                blk.target = resolve(inst.data[0]);
+
+                if (blk.target == no_block) return false;
+            }
+            else if (kind == op::switch_end)
+            {
+                const auto count = inst.data[0].as_int();
+
+                for (auto j = 0; j < count; j++)
+                {
+                    const auto& type = inst.data[1 + (3 * j)];
+                    const auto target = resolve(type == "case" ? inst.data[1 + (3 * j) + 2] : inst.data[1 + (3 * j) + 1]);
+
+                    if (target == no_block) return false;
+
+                    blk.cases.push_back(target);
+                }
+            }
+
+            blk.falls = !is_jump(kind) && kind != op::switch_jump && kind != op::end && kind != op::ret;
+
+            if (blk.falls && i + 1 == blocks.size()) return false;
+        }
+
+        refs.assign(blocks.size(), 0);
+
+        for (auto i = 0u; i < blocks.size(); i++)
+        {
+            for (const auto succ : successors(i))
+            {
+                refs[succ]++;
+            }
+        }
+
+        return true;
+    }
+
+    auto next(std::size_t id) const -> std::size_t
+    {
+        while (++id < blocks.size() && !blocks[id].live);
+        return id < blocks.size() ? id : no_block;
+    }
+
+    auto successors(std::size_t id) const -> std::vector<std::size_t>
+    {
+        const auto& blk = blocks[id];
+        auto result = blk.cases;
+
+        if (blk.falls) result.push_back(next(id));
+        if (blk.target != no_block) result.push_back(blk.target);
+
+        return result;
+    }
+
+    auto forwarder(std::size_t id) const -> bool
+    {
+        const auto& blk = blocks[id];
+        return blk.live && blk.end - blk.begin == 1 && is_jump(blk.branch);
+    }
+
+    void retarget(std::size_t id, std::size_t target)
+    {
+        refs[blocks[id].target]--;
+        refs[target]++;
+        blocks[id].target = target;
+    }
+
+    // conditional jumps may only move further down, the layout keeps them forward
+    auto thread(std::size_t id) -> bool
+    {
+        auto& blk = blocks[id];
+
+        if (!is_jump(blk.branch) && !is_condition(blk.branch)) return false;
+
+        const auto& dest = blocks[blk.target];
+
+        // jump landing on an unconditional jump, a conditional one landing on a jumpback is
+        // left to the inversion below
+        if (forwarder(blk.target) && dest.target != blk.target && (!is_condition(blk.branch) || dest.target > id))
+        {
+            retarget(id, dest.target);
+            stats["thread-jump"]++;
+            return true;
+        }
+
+        // && or || result tested again by the jump it lands on
+        if ((blk.branch == op::jump_on_false_expr || blk.branch == op::jump_on_true_expr) && dest.end - dest.begin == 1 && is_condition(dest.branch))
+        {
+            const auto value = blk.branch == op::jump_on_true_expr;
+            const auto taken = (dest.branch == op::jump_on_true || dest.branch == op::jump_on_true_expr) == value;
+
+            if (!taken)
+            {
+                blk.branch = value ? op::jump_on_true : op::jump_on_false;
+                retarget(id, next(blk.target));
+            }
+            else
+            {
+                if (dest.branch == op::jump_on_false || dest.branch == op::jump_on_true)
+                {
+                    blk.branch = dest.branch;
+                }
+
+                retarget(id, dest.target);
+            }
+
+            stats["thread-condition"]++;
+            return true;
+        }
+
+        // conditional jump over an unconditional one nothing else reaches
+        if (blk.branch == op::jump_on_false || blk.branch == op::jump_on_true)
+        {
+            const auto over = next(id);
+
+            if (over == no_block || !forwarder(over) || blocks[over].branch != op::jump || refs[over] != 1 || next(over) != blk.target) return false;
+            if (blocks[over].target <= id || blocks[over].target == over) return false;
+
+            blk.branch = invert(blk.branch);
+            refs[blk.target]--;
+            blk.target = blocks[over].target;
+            refs[over]--;
+            blocks[over].live = false;
+            stats["invert-branch"]++;
+            return true;
+        }
+
+        return false;
+    }
+
+    void prune()
+    {
+        std::vector<bool> seen(blocks.size(), false);
+        std::vector<std::size_t> stack = { 0 };
+
+        seen[0] = true;
+
+        while (!stack.empty())
+        {
+            const auto id = stack.back();
+            stack.pop_back();
+
+            for (const auto succ : successors(id))
+            {
+                if (!seen[succ])
+                {
+                    seen[succ] = true;
+                    stack.push_back(succ);
+                }
+            }
+        }
+
+        // the block holding the function end stays last
+        for (auto i = 0u; i + 1 < blocks.size(); i++)
+        {
+            if (blocks[i].live && !seen[i])
+            {
+                for (const auto succ : successors(i))
+                {
+                    refs[succ]--;
+                }
+
+                blocks[i].live = false;
+                stats["unreachable-block"]++;
+            }
+        }
+    }
+
+    // blocks falling into each other form chains. chains are placed in their original order
+    // except that a chain starting at the target of the jump ending the last one goes next,
+    // as long as the conditional jumps and switches into it were already placed and it
+    // doesn't land inside a loop, ahead of a jumpback to an already placed chain
+    auto layout() -> std::vector<std::size_t>
+    {
+        std::vector<std::vector<std::size_t>> chains;
+        auto prev = no_block;
+
+        for (auto i = 0u; i < blocks.size(); i++)
+        {
+            if (!blocks[i].live) continue;
+
+            if (prev == no_block || !blocks[prev].falls)
+            {
+                chains.emplace_back();
+            }
+
+            chains.back().push_back(i);
+            blocks[i].chain = chains.size() - 1;
+            prev = i;
+        }
+
+        std::vector<std::vector<std::size_t>> after(chains.size());
+        std::vector<std::size_t> pending(chains.size(), 0);
+
+        for (const auto& chain : chains)
+        {
+            for (const auto id : chain)
+            {
+                const auto& blk = blocks[id];
+
+                if (!is_condition(blk.branch) && blk.branch != op::switch_jump) continue;
+
+                const auto target = blocks[blk.target].chain;
+
+                if (target != blk.chain)
+                {
+                    after[blk.chain].push_back(target);
+                    pending[target]++;
+                }
+            }
+        }
+
+        // the last chain holds the function end and nothing waits on it, so the lowest
+        // ready chain only picks it once everything else is placed
+        std::set<std::size_t> ready;
+        std::vector<std::size_t> result;
+        std::vector<bool> placed(chains.size(), false);
+        auto current = std::size_t(0);
+
+        const auto in_loop = [&](std::size_t target)
+        {
+            for (auto i = 0u; i < target; i++)
+            {
+                const auto& tail = blocks[chains[i].back()];
+
+                if (!placed[i] && tail.branch == op::jump_back && placed[blocks[tail.target].chain]) return true;
+            }
+
+            return false;
+        };
+
+        for (auto i = 0u; i < chains.size(); i++)
+        {
+            if (pending[i] == 0) ready.insert(i);
+        }
+
+        while (true)
+        {
+            ready.erase(current);
+            placed[current] = true;
+
+            for (const auto id : chains[current])
+            {
+                result.push_back(id);
+            }
+
+            for (const auto target : after[current])
+            {
+                if (--pending[target] == 0) ready.insert(target);
+            }
+
+            if (ready.empty()) break;
+
+            const auto& tail = blocks[chains[current].back()];
+            current = *ready.begin();
+
+            if (is_jump(tail.branch))
+            {
+                const auto target = blocks[tail.target].chain;
+
+                if (target + 1 != chains.size() && chains[target].front() == tail.target && ready.count(target) && !in_loop(target))
+                {
+                    current = target;
+                }
+            }
+        }
+
+        return result;
+    }
+
+    // new instructions, indexes and labels, or false leaving the function as it was when
+    // a conditional jump or jumpback would end up out of range
+    auto emit() -> bool
+    {
+        auto& insts = func.instructions;
+        const auto order = layout();
+        std::vector<std::size_t> rank(blocks.size(), no_block);
+
+        for (auto i = 0u; i < order.size(); i++)
+        {
+            rank[order[i]] = i;
+        }
+
+        for (auto i = 0u; i < order.size(); i++)
+        {
+            auto& blk = blocks[order[i]];
+
+            if (!is_jump(blk.branch)) continue;
+
+            if (i + 1 < order.size() && order[i + 1] == blk.target)
+            {
+                blk.drop = true;
+            }
+            else
+            {
+                blk.branch = rank[blk.target] > i ? op::jump : op::jump_back;
+            }
+        }
+
+        std::vector<std::uint32_t> start(blocks.size());
+        std::vector<std::uint32_t> at(blocks.size());
+        auto index = func.index;
+
+        for (const auto id : order)
+        {
+            const auto& blk = blocks[id];
+
+            start[id] = index;
+
+            for (auto i = blk.begin; i + 1 < blk.end; i++)
+            {
+                index += insts[i]->size;
+            }
+
+            at[id] = index;
+
+            if (!blk.drop)
+            {
+                index += (is_jump(blk.branch) || is_condition(blk.branch)) ? ops.size(blk.branch) : insts[blk.end - 1]->size;
+            }
+        }
+
+        for (const auto id : order)
+        {
+            const auto& blk = blocks[id];
+
+            if (blk.drop) continue;
+
+            if (is_condition(blk.branch))
+            {
+                const auto addr = start[blk.target];
+
+                if (addr <= at[id] || addr - at[id] - ops.size(blk.branch) > short_jump_max) return false;
+            }
+            else if (blk.branch == op::jump_back)
+            {
+                const auto addr = start[blk.target];
+
+                if (addr > at[id] || at[id] + ops.size(op::jump_back) - addr > short_jump_max) return false;
+            }
+        }
+
+        std::vector<bool> targeted(blocks.size(), false);
+        std::uint32_t last = 0;
+
+        for (const auto id : order)
+        {
+            const auto& blk = blocks[id];
+
+            if (!blk.drop && blk.target != no_block) targeted[blk.target] = true;
+
+            for (const auto target : blk.cases)
+            {
+                targeted[target] = true;
+            }
+        }
+
+        for (const auto& entry : func.labels)
+        {
+            last = std::max(last, entry.second);
+        }
+
+        // labels meeting at the same index after an emptied block are merged into the first
+        std::unordered_map<std::uint32_t, std::uint32_t> labels;
+
+        for (const auto id : order)
+        {
+            auto& blk = blocks[id];
+
+            if (!targeted[id]) continue;
+
+            if (blk.label == no_label)
+            {
+                blk.label = ++last;
+            }
+
+            const auto [itr, inserted] = labels.insert({ start[id], blk.label });
+
+            if (!inserted)
+            {
+                blk.label = itr->second;
+            }
+        }
+
+        std::vector<instruction::ptr> result;
+        index = func.index;
+
+        result.reserve(insts.size());
+
+        for (const auto id : order)
+        {
+            const auto& blk = blocks[id];
+
+            for (auto i = blk.begin; i < blk.end; i++)
+            {
+                auto& inst = insts[i];
+
+                if (i + 1 == blk.end)
+                {
+                    if (blk.drop)
+                    {
+                        stats["fallthrough-jump"]++;
+                        continue;
+                    }
+
+                    if (is_jump(blk.branch) || is_condition(blk.branch))
+                    {
+                        ops.assign(*inst, blk.branch);
+                        inst->data = { operand::label(blocks[blk.target].label) };
+                    }
+                    else if (blk.branch == op::switch_jump)
+                    {
+                        inst->data[0] = operand::label(blocks[blk.target].label);
+                    }
+
+                    for (auto j = 0u; j < blk.cases.size(); j++)
+                    {
+                        const auto pos = 1 + (3 * j) + (inst->data[1 + (3 * j)] == "case" ? 2 : 1);
+                        inst->data[pos] = operand::label(blocks[blk.cases[j]].label);
+                    }
+                }
+
+                inst->index = index;
+                index += inst->size;
+                result.push_back(std::move(inst));
+            }
+        }
+
+        func.instructions = std::move(result);
+        func.labels = std::move(labels);
+        func.size = index - func.index;
+        return true;
+    }
+};
+
+} // namespace
+
+void flow_graph::optimize(function& func, std::map<std::string, std::size_t>& stats) const
+{
+    if (func.instructions.empty()) return;
+
+    graph cfg(ops_, func);
+
+    if (!cfg.build()) return;
+
+    // dead code after a break or continue hides the blocks a branch skips over
+    cfg.prune();
+
+    // every rewrite moves a jump down a chain or removes a block, the bound is only a guard
+    auto changed = true;
+    auto passes = cfg.blocks.size() + 1;
+
+    while (changed && passes-- > 0)
+    {
+        changed = false;
+
+        for (auto i = 0u; i < cfg.blocks.size(); i++)
+        {
+            if (cfg.blocks[i].live && cfg.thread(i))
+            {
+                changed = true;
+            }
+        }
+    }
+
+    cfg.prune();
+
+    if (!cfg.emit()) return;
+
+    for (const auto& [name, count] : cfg.stats)
+    {
+        stats[name] += count;
+    }
+}
+
+} // namespace xsk::gsc
@@ -0,0 +1,23 @@
+// Copyright 2021 xensik. All rights reserved.
+//
+// Use of this source code is governed by a GNU GPLv3 license
+// that can be found in the LICENSE file.
+
+#pragma once
+
+namespace xsk::gsc
+{
+
+// basic block pass over a compiled function: threads jumps landing on other jumps or on
+// the conditions of && and ||, drops unreachable blocks and lays the blocks out again so
+// unconditional jumps fall through wherever the forward only conditional jumps allow it
+class flow_graph
+{
+    const opcode_table& ops_;
+
+public:
+    flow_graph(const opcode_table& ops) : ops_(ops) {}
+    void optimize(function& func, std::map<std::string, std::size_t>& stats) const;
+};
+
+} // namespace xsk::gsc
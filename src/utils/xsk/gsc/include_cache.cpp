@@ -0,0 +1,139 @@
+// Copyright 2021 xensik. All rights reserved.
+//
+// Use of this source code is governed by a GNU GPLv3 license
+// that can be found in the LICENSE file.
+
+#include "stdafx.hpp"
+
+// layout, all integers little endian, strings are u32 length + bytes:
+//   u32 magic, u16 version, string game, u32 entry count
+//   entry: string path, u64 content hash, u32 function count, { string name }
+
+namespace xsk::gsc
+{
+
+namespace
+{
+
+void write_string(utils::byte_buffer& data, const std::string& value)
+{
+    data.write_le<std::uint32_t>(static_cast<std::uint32_t>(value.size()));
+    data.write_string(value);
+}
+
+auto read_string(utils::byte_buffer& data) -> std::string
+{
+    return data.read_string(data.read_le<std::uint32_t>());
+}
+
+} // namespace
+
+include_cache::include_cache() : modified_(false)
+{
+}
+
+auto include_cache::find(const std::string& path, std::uint64_t hash, std::vector<std::string>& funcs) const -> bool
+{
+    std::shared_lock<std::shared_mutex> lock(mutex_);
+
+    const auto itr = entries_.find(path);
+
+    if (itr == entries_.end() || itr->second.hash != hash) return false;
+
+    funcs = itr->second.funcs;
+
+    return true;
+}
+
+void include_cache::insert(const std::string& path, std::uint64_t hash, const std::vector<std::string>& funcs)
+{
+    std::unique_lock<std::shared_mutex> lock(mutex_);
+
+    entries_[path] = entry { hash, funcs };
+    modified_ = true;
+}
+
+auto include_cache::modified() const -> bool
+{
+    std::shared_lock<std::shared_mutex> lock(mutex_);
+
+    return modified_;
+}
+
+// a cache written for another game or by another version is dropped, not an error
+void include_cache::load(const std::string& file, const std::string& game)
+{
+    std::unique_lock<std::shared_mutex> lock(mutex_);
+
+    entries_.clear();
+    modified_ = false;
+
+    if (!utils::file::exists(file)) return;
+
+    auto data = utils::file::read(file);
+    utils::byte_buffer input(data);
+
+    try
+    {
+        if (data.size() < 6 || input.read_le<std::uint32_t>() != magic) return;
+        if (input.read_le<std::uint16_t>() != version || read_string(input) != game) return;
+
+        const auto count = input.read_le<std::uint32_t>();
+
+        for (auto i = 0u; i < count; i++)
+        {
+            auto path = read_string(input);
+            auto& item = entries_[path];
+            item.hash = input.read_le<std::uint64_t>();
+
+            const auto func_count = input.read_le<std::uint32_t>();
+
+            for (auto j = 0u; j < func_count; j++)
+            {
+                item.funcs.push_back(read_string(input));
+            }
+        }
+    }
+    catch (const std::exception&)
+    {
+        entries_.clear();
+    }
+}
+
+void include_cache::save(const std::string& file, const std::string& game)
+{
+    std::unique_lock<std::shared_mutex> lock(mutex_);
+
+    std::vector<const std::pair<const std::string, entry>*> list;
+
+    for (const auto& item : entries_)
+    {
+        list.push_back(&item);
+    }
+
+    std::sort(list.begin(), list.end(), [](const auto* lhs, const auto* rhs) { return lhs->first < rhs->first; });
+
+    utils::byte_buffer data;
+
+    data.write_le<std::uint32_t>(magic);
+    data.write_le<std::uint16_t>(version);
+    write_string(data, game);
+    data.write_le<std::uint32_t>(static_cast<std::uint32_t>(list.size()));
+
+    for (const auto* item : list)
+    {
+        write_string(data, item->first);
+        data.write_le<std::uint64_t>(item->second.hash);
+        data.write_le<std::uint32_t>(static_cast<std::uint32_t>(item->second.funcs.size()));
+
+        for (const auto& name : item->second.funcs)
+        {
+            write_string(data, name);
+        }
+    }
+
+    utils::file::save(file, data.buffer());
+    modified_ = false;
+}
+
+} // namespace xsk::gsc
@@ -0,0 +1,39 @@
+// Copyright 2021 xensik. All rights reserved.
+//
+// Use of this source code is governed by a GNU GPLv3 license
+// that can be found in the LICENSE file.
+
+#pragma once
+
+namespace xsk::gsc
+{
+
+// thread names exported by include files, keyed by path and utils::hash of the content,
+// shared by the compilers of a run and optionally kept on disk between runs
+class include_cache
+{
+public:
+    static constexpr std::uint32_t magic = 0x43495347; // "GSIC"
+    static constexpr std::uint16_t version = 1;
+
+private:
+    struct entry
+    {
+        std::uint64_t hash;
+        std::vector<std::string> funcs;
+    };
+
+    std::unordered_map<std::string, entry> entries_;
+    mutable std::shared_mutex mutex_;
+    bool modified_;
+
+public:
+    include_cache();
+    auto find(const std::string& path, std::uint64_t hash, std::vector<std::string>& funcs) const -> bool;
+    void insert(const std::string& path, std::uint64_t hash, const std::vector<std::string>& funcs);
+    auto modified() const -> bool;
+    void load(const std::string& file, const std::string& game);
+    void save(const std::string& file, const std::string& game);
+};
+
+} // namespace xsk::gsc
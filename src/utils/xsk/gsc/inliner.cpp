@@ -0,0 +1,843 @@
+// Copyright 2021 xensik. All rights reserved.
+//
+// Use of this source code is governed by a GNU GPLv3 license
+// that can be found in the LICENSE file.
+
+#include "stdafx.hpp"
+
+namespace xsk::gsc
+{
+
+namespace
+{
+
+// syntax nodes of a returned expression, bigger ones stay calls
+constexpr std::size_t max_nodes = 16;
+
+auto is_binary(ast::kind kind) -> bool
+{
+    switch (kind)
+    {
+        case ast::kind::expr_or:
+        case ast::kind::expr_and:
+        case ast::kind::expr_equality:
+        case ast::kind::expr_inequality:
+        case ast::kind::expr_less:
+        case ast::kind::expr_greater:
+        case ast::kind::expr_less_equal:
+        case ast::kind::expr_greater_equal:
+        case ast::kind::expr_bitwise_or:
+        case ast::kind::expr_bitwise_and:
+        case ast::kind::expr_bitwise_exor:
+        case ast::kind::expr_shift_left:
+        case ast::kind::expr_shift_right:
+        case ast::kind::expr_add:
+        case ast::kind::expr_sub:
+        case ast::kind::expr_mul:
+        case ast::kind::expr_div:
+        case ast::kind::expr_mod:
+            return true;
+        default:
+            return false;
+    }
+}
+
+// values that read the same wherever and however often they are evaluated
+auto is_trivial(const ast::expr& expr) -> bool
+{
+    switch (expr.kind())
+    {
+        case ast::kind::expr_true:
+        case ast::kind::expr_false:
+        case ast::kind::expr_integer:
+        case ast::kind::expr_float:
+        case ast::kind::expr_string:
+        case ast::kind::expr_istring:
+        case ast::kind::expr_color:
+        case ast::kind::expr_animation:
+        case ast::kind::expr_animtree:
+        case ast::kind::expr_undefined:
+        case ast::kind::expr_identifier:
+        case ast::kind::expr_reference:
+        case ast::kind::expr_self:
+        case ast::kind::expr_level:
+        case ast::kind::expr_game:
+        case ast::kind::expr_anim:
+        case ast::kind::expr_thisthread:
+            return true;
+        default:
+            return false;
+    }
+}
+
+// no calls, reads can only change when something is called in between
+auto is_pure(const ast::expr& expr) -> bool
+{
+    if (is_trivial(expr)) return true;
+
+    if (is_binary(expr.kind()))
+        return is_pure(expr.as_binary->lvalue) && is_pure(expr.as_binary->rvalue);
+
+    switch (expr.kind())
+    {
+        case ast::kind::expr_empty_array:
+            return true;
+        case ast::kind::expr_paren:
+            return is_pure(expr.as_paren->child);
+        case ast::kind::expr_size:
+            return is_pure(expr.as_size->obj);
+        case ast::kind::expr_field:
+            return is_pure(expr.as_field->obj);
+        case ast::kind::expr_array:
+            return is_pure(expr.as_array->obj) && is_pure(expr.as_array->key);
+        case ast::kind::expr_vector:
+            return is_pure(expr.as_vector->x) && is_pure(expr.as_vector->y) && is_pure(expr.as_vector->z);
+        case ast::kind::expr_not:
+            return is_pure(expr.as_not->rvalue);
+        case ast::kind::expr_complement:
+            return is_pure(expr.as_complement->rvalue);
+        case ast::kind::expr_ternary:
+            return is_pure(expr.as_ternary->test) && is_pure(expr.as_ternary->true_expr) && is_pure(expr.as_ternary->false_expr);
+        default:
+            return false;
+    }
+}
+
+// expressions the compilers take where an object is expected
+auto is_object(const ast::expr& expr) -> bool
+{
+    switch (expr.kind())
+    {
+        case ast::kind::expr_level:
+        case ast::kind::expr_anim:
+        case ast::kind::expr_self:
+        case ast::kind::expr_array:
+        case ast::kind::expr_field:
+        case ast::kind::expr_call:
+        case ast::kind::expr_method:
+        case ast::kind::expr_identifier:
+            return true;
+        default:
+            return false;
+    }
+}
+
+auto is_thread(ast::call::mode mode) -> bool
+{
+    return mode == ast::call::mode::thread || mode == ast::call::mode::childthread;
+}
+
+auto param_index(const ast::expr_parameters& params, const ast::expr_identifier& name) -> std::int32_t
+{
+    for (auto i = 0u; i < params.list.size(); i++)
+    {
+        if (params.list[i]->id == name.id) return i;
+    }
+
+    return -1;
+}
+
+// what a returned expression reads and calls, false when it holds anything that doesn't
+// mean the same in the caller or could suspend it
+struct shape
+{
+    const ast::expr_parameters& params;
+    std::vector<std::size_t> uses;
+    std::vector<std::string> locals;
+    std::vector<std::string> functions;
+    std::size_t self_uses = 0;
+    std::size_t nodes = 0;
+    bool calls = false;
+
+    shape(const ast::expr_parameters& params) : params(params), uses(params.list.size(), 0) {}
+
+    auto scan(const ast::expr& expr) -> bool
+    {
+        nodes++;
+
+        if (is_binary(expr.kind()))
+            return scan(expr.as_binary->lvalue) && scan(expr.as_binary->rvalue);
+
+        switch (expr.kind())
+        {
+            case ast::kind::expr_true:
+            case ast::kind::expr_false:
+            case ast::kind::expr_integer:
+            case ast::kind::expr_float:
+            case ast::kind::expr_string:
+            case ast::kind::expr_istring:
+            case ast::kind::expr_color:
+            case ast::kind::expr_undefined:
+            case ast::kind::expr_empty_array:
+            case ast::kind::expr_reference:
+            case ast::kind::expr_level:
+            case ast::kind::expr_game:
+            case ast::kind::expr_anim:
+            case ast::kind::expr_thisthread:
+                return true;
+            case ast::kind::expr_self:
+                self_uses++;
+                return true;
+            case ast::kind::expr_identifier:
+            {
+                const auto index = param_index(params, *expr.as_identifier);
+
+                if (index < 0) return false;
+
+                uses[index]++;
+                return true;
+            }
+            case ast::kind::expr_paren:
+                return scan(expr.as_paren->child);
+            case ast::kind::expr_size:
+                return scan(expr.as_size->obj);
+            case ast::kind::expr_field:
+                return scan(expr.as_field->obj);
+            case ast::kind::expr_array:
+                return scan(expr.as_array->obj) && scan(expr.as_array->key);
+            case ast::kind::expr_vector:
+                return scan(expr.as_vector->x) && scan(expr.as_vector->y) && scan(expr.as_vector->z);
+            case ast::kind::expr_not:
+                return scan(expr.as_not->rvalue);
+            case ast::kind::expr_complement:
+                return scan(expr.as_complement->rvalue);
+            case ast::kind::expr_ternary:
+                return scan(expr.as_ternary->test) && scan(expr.as_ternary->true_expr) && scan(expr.as_ternary->false_expr);
+            case ast::kind::expr_call:
+                // a call without object runs on self too
+                calls = true;
+                self_uses++;
+                return scan(expr.as_call->call, false);
+            case ast::kind::expr_method:
+                calls = true;
+                return scan(expr.as_method->obj) && scan(expr.as_method->call, true);
+            default:
+                return false;
+        }
+    }
+
+    auto scan(const ast::call& call, bool method) -> bool
+    {
+        if (call == ast::kind::expr_pointer)
+        {
+            return !is_thread(call.as_pointer->mode) && scan(call.as_pointer->func) && scan(call.as_pointer->args);
+        }
+
+        if (call == ast::kind::expr_function)
+        {
+            if (is_thread(call.as_function->mode)) return false;
+
+            if (call.as_function->path->value.empty())
+            {
+                locals.push_back(call.as_function->name->value);
+
+                if (!method) functions.push_back(call.as_function->name->value);
+            }
+
+            return scan(call.as_function->args);
+        }
+
+        return false;
+    }
+
+    auto scan(const ast::expr_arguments::ptr& args) -> bool
+    {
+        for (const auto& entry : args->list)
+        {
+            if (!scan(entry)) return false;
+        }
+
+        return true;
+    }
+};
+
+template <typename T>
+auto make_binary(const location& loc, ast::expr lvalue, ast::expr rvalue) -> ast::expr
+{
+    return ast::expr(std::make_unique<T>(loc, std::move(lvalue), std::move(rvalue)));
+}
+
+// copies an expression to a call site, the parameters and self of a returned expression
+// are replaced by copies of the call's arguments and object, calls made on the implicit
+// self become method calls on that object
+struct copier
+{
+    const location& loc;
+    const ast::expr_parameters* params = nullptr;
+    const std::vector<ast::expr>* args = nullptr;
+    const ast::expr* self = nullptr;
+
+    auto copy(const ast::expr& expr) const -> ast::expr
+    {
+        switch (expr.kind())
+        {
+            case ast::kind::expr_true:
+                return ast::expr(std::make_unique<ast::expr_true>(loc));
+            case ast::kind::expr_false:
+                return ast::expr(std::make_unique<ast::expr_false>(loc));
+            case ast::kind::expr_integer:
+                return ast::expr(std::make_unique<ast::expr_integer>(loc, expr.as_integer->value));
+            case ast::kind::expr_float:
+                return ast::expr(std::make_unique<ast::expr_float>(loc, expr.as_float->value));
+            case ast::kind::expr_string:
+                return ast::expr(std::make_unique<ast::expr_string>(loc, expr.as_string->value));
+            case ast::kind::expr_istring:
+                return ast::expr(std::make_unique<ast::expr_istring>(loc, expr.as_istring->value));
+            case ast::kind::expr_color:
+                return ast::expr(std::make_unique<ast::expr_color>(loc, expr.as_color->value));
+            case ast::kind::expr_animation:
+                return ast::expr(std::make_unique<ast::expr_animation>(loc, expr.as_animation->value));
+            case ast::kind::expr_animtree:
+                return ast::expr(std::make_unique<ast::expr_animtree>(loc));
+            case ast::kind::expr_undefined:
+                return ast::expr(std::make_unique<ast::expr_undefined>(loc));
+            case ast::kind::expr_empty_array:
+                return ast::expr(std::make_unique<ast::expr_empty_array>(loc));
+            case ast::kind::expr_thisthread:
+                return ast::expr(std::make_unique<ast::expr_thisthread>(loc));
+            case ast::kind::expr_level:
+                return ast::expr(std::make_unique<ast::expr_level>(loc));
+            case ast::kind::expr_game:
+                return ast::expr(std::make_unique<ast::expr_game>(loc));
+            case ast::kind::expr_anim:
+                return ast::expr(std::make_unique<ast::expr_anim>(loc));
+            case ast::kind::expr_self:
+                if (self != nullptr) return copier{ loc }.copy(*self);
+                return ast::expr(std::make_unique<ast::expr_self>(loc));
+            case ast::kind::expr_identifier:
+            {
+                if (params == nullptr)
+                    return ast::expr(std::make_unique<ast::expr_identifier>(loc, expr.as_identifier->value));
+
+                // parameters the call leaves out are undefined
+                const auto index = static_cast<std::size_t>(param_index(*params, *expr.as_identifier));
+
+                if (index < args->size()) return copier{ loc }.copy(args->at(index));
+
+                return ast::expr(std::make_unique<ast::expr_undefined>(loc));
+            }
+            case ast::kind::expr_reference:
+            {
+                auto path = std::make_unique<ast::expr_path>(loc, expr.as_reference->path->value);
+                auto name = std::make_unique<ast::expr_identifier>(loc, expr.as_reference->name->value);
+                return ast::expr(std::make_unique<ast::expr_reference>(loc, std::move(path), std::move(name)));
+            }
+            case ast::kind::expr_paren:
+                return ast::expr(std::make_unique<ast::expr_paren>(loc, copy(expr.as_paren->child)));
+            case ast::kind::expr_size:
+                return ast::expr(std::make_unique<ast::expr_size>(loc, copy(expr.as_size->obj)));
+            case ast::kind::expr_field:
+            {
+                auto field = std::make_unique<ast::expr_identifier>(loc, expr.as_field->field->value);
+                return ast::expr(std::make_unique<ast::expr_field>(loc, copy(expr.as_field->obj), std::move(field)));
+            }
+            case ast::kind::expr_array:
+                return ast::expr(std::make_unique<ast::expr_array>(loc, copy(expr.as_array->obj), copy(expr.as_array->key)));
+            case ast::kind::expr_vector:
+                return ast::expr(std::make_unique<ast::expr_vector>(loc, copy(expr.as_vector->x), copy(expr.as_vector->y), copy(expr.as_vector->z)));
+            case ast::kind::expr_not:
+                return ast::expr(std::make_unique<ast::expr_not>(loc, copy(expr.as_not->rvalue)));
+            case ast::kind::expr_complement:
+                return ast::expr(std::make_unique<ast::expr_complement>(loc, copy(expr.as_complement->rvalue)));
+            case ast::kind::expr_ternary:
+                return ast::expr(std::make_unique<ast::expr_ternary>(loc, copy(expr.as_ternary->test), copy(expr.as_ternary->true_expr), copy(expr.as_ternary->false_expr)));
+            case ast::kind::expr_call:
+                if (self != nullptr)
+                    return ast::expr(std::make_unique<ast::expr_method>(loc, copier{ loc }.copy(*self), copy(expr.as_call->call)));
+                return ast::expr(std::make_unique<ast::expr_call>(loc, copy(expr.as_call->call)));
+            case ast::kind::expr_method:
+                return ast::expr(std::make_unique<ast::expr_method>(loc, copy(expr.as_method->obj), copy(expr.as_method->call)));
+            default:
+                return copy_binary(expr);
+        }
+    }
+
+    auto copy_binary(const ast::expr& expr) const -> ast::expr
+    {
+        auto lvalue = copy(expr.as_binary->lvalue);
+        auto rvalue = copy(expr.as_binary->rvalue);
+
+        switch (expr.kind())
+        {
+            case ast::kind::expr_or:
+                return make_binary<ast::expr_or>(loc, std::move(lvalue), std::move(rvalue));
+            case ast::kind::expr_and:
+                return make_binary<ast::expr_and>(loc, std::move(lvalue), std::move(rvalue));
+            case ast::kind::expr_equality:
+                return make_binary<ast::expr_equality>(loc, std::move(lvalue), std::move(rvalue));
+            case ast::kind::expr_inequality:
+                return make_binary<ast::expr_inequality>(loc, std::move(lvalue), std::move(rvalue));
+            case ast::kind::expr_less:
+                return make_binary<ast::expr_less>(loc, std::move(lvalue), std::move(rvalue));
+            case ast::kind::expr_greater:
+                return make_binary<ast::expr_greater>(loc, std::move(lvalue), std::move(rvalue));
+            case ast::kind::expr_less_equal:
+                return make_binary<ast::expr_less_equal>(loc, std::move(lvalue), std::move(rvalue));
+            case ast::kind::expr_greater_equal:
+                return make_binary<ast::expr_greater_equal>(loc, std::move(lvalue), std::move(rvalue));
+            case ast::kind::expr_bitwise_or:
+                return make_binary<ast::expr_bitwise_or>(loc, std::move(lvalue), std::move(rvalue));
+            case ast::kind::expr_bitwise_and:
+                return make_binary<ast::expr_bitwise_and>(loc, std::move(lvalue), std::move(rvalue));
+            case ast::kind::expr_bitwise_exor:
+                return make_binary<ast::expr_bitwise_exor>(loc, std::move(lvalue), std::move(rvalue));
+            case ast::kind::expr_shift_left:
+                return make_binary<ast::expr_shift_left>(loc, std::move(lvalue), std::move(rvalue));
+            case ast::kind::expr_shift_right:
+                return make_binary<ast::expr_shift_right>(loc, std::move(lvalue), std::move(rvalue));
+            case ast::kind::expr_add:
+                return make_binary<ast::expr_add>(loc, std::move(lvalue), std::move(rvalue));
+            case ast::kind::expr_sub:
+                return make_binary<ast::expr_sub>(loc, std::move(lvalue), std::move(rvalue));
+            case ast::kind::expr_mul:
+                return make_binary<ast::expr_mul>(loc, std::move(lvalue), std::move(rvalue));
+            case ast::kind::expr_div:
+                return make_binary<ast::expr_div>(loc, std::move(lvalue), std::move(rvalue));
+            default:
+                return make_binary<ast::expr_mod>(loc, std::move(lvalue), std::move(rvalue));
+        }
+    }
+
+    auto copy(const ast::call& call) const -> ast::call
+    {
+        if (call == ast::kind::expr_pointer)
+        {
+            const auto& func = *call.as_pointer;
+            return ast::call(std::make_unique<ast::expr_pointer>(loc, copy(func.func), copy(func.args), func.mode));
+        }
+
+        const auto& func = *call.as_function;
+        auto path = std::make_unique<ast::expr_path>(loc, func.path->value);
+        auto name = std::make_unique<ast::expr_identifier>(loc, func.name->value);
+        return ast::call(std::make_unique<ast::expr_function>(loc, std::move(path), std::move(name), copy(func.args), func.mode));
+    }
+
+    auto copy(const ast::expr_arguments::ptr& args) const -> ast::expr_arguments::ptr
+    {
+        auto result = std::make_unique<ast::expr_arguments>(loc);
+
+        for (const auto& entry : args->list)
+        {
+            result->list.push_back(copy(entry));
+        }
+
+        return result;
+    }
+};
+
+// an argument can take the place of a parameter when evaluating it where and as often as
+// the parameter is read gives the same value
+auto can_substitute(const ast::expr& arg, std::size_t uses, bool calls) -> bool
+{
+    if (is_trivial(arg)) return true;
+
+    return is_pure(arg) && (uses == 0 || (uses == 1 && !calls));
+}
+
+auto empty_stmt(const location& loc) -> ast::stmt
+{
+    return ast::stmt(std::make_unique<ast::stmt_list>(loc));
+}
+
+} // namespace
+
+auto inliner::optimize(const ast::program::ptr& program, std::map<std::string, std::size_t>& stats) -> bool
+{
+    callees_.clear();
+    count_ = 0;
+
+    collect(program);
+
+    if (callees_.empty()) return false;
+
+    for (auto& decl : program->declarations)
+    {
+        if (decl == ast::kind::decl_thread)
+        {
+            inline_stmt_list(decl.as_thread->stmt);
+        }
+    }
+
+    if (count_ == 0) return false;
+
+    stats["inlined-call"] += count_;
+    return true;
+}
+
+// threads that do nothing or only return a small expression, without thread calls and
+// never reaching themselves through other candidates
+void inliner::collect(const ast::program::ptr& program)
+{
+    std::unordered_map<std::string, std::size_t> names;
+    std::unordered_map<std::string, std::vector<std::string>> edges;
+
+    for (const auto& decl : program->declarations)
+    {
+        if (decl == ast::kind::decl_thread)
+        {
+            names[decl.as_thread->name->value]++;
+        }
+    }
+
+    for (const auto& decl : program->declarations)
+    {
+        if (decl.kind() != ast::kind::decl_thread) continue;
+
+        const auto& thread = *decl.as_thread;
+        const auto& name = thread.name->value;
+        const auto& list = thread.stmt->list;
+
+        // builtins win over local threads of the same name
+        if (names[name] != 1 || builtin_(name)) continue;
+
+        const ast::expr* source = nullptr;
+
+        if (list.size() == 1 && list[0] == ast::kind::stmt_return)
+        {
+            if (list[0].as_return->expr != ast::kind::null)
+                source = &list[0].as_return->expr;
+        }
+        else if (!list.empty()) continue;
+
+        shape info(*thread.params);
+
+        if (source != nullptr && (!info.scan(*source) || info.nodes > max_nodes)) continue;
+
+        // builtin functions have no method form, a thread calling one isn't inlined into method calls
+        const auto method = std::none_of(info.functions.begin(), info.functions.end(), builtin_);
+
+        // the declarations get inlined into while the callers are walked, every call expands
+        // a copy of the thread as it was declared whatever the order of the threads
+        auto body = (source != nullptr) ? copier{ source->loc() }.copy(*source) : ast::expr();
+
+        callees_.emplace(name, callee{ thread.params.get(), std::move(body), std::move(info.uses), info.self_uses, info.calls, method });
+        edges.insert({ name, std::move(info.locals) });
+    }
+
+    std::vector<std::string> recursive;
+
+    for (const auto& [name, entry] : callees_)
+    {
+        std::unordered_set<std::string> visited;
+        std::vector<std::string> pending = edges[name];
+
+        while (!pending.empty())
+        {
+            const auto next = std::move(pending.back());
+            pending.pop_back();
+
+            if (next == name)
+            {
+                recursive.push_back(name);
+                break;
+            }
+
+            if (callees_.count(next) == 0 || !visited.insert(next).second) continue;
+
+            const auto& calls = edges[next];
+            pending.insert(pending.end(), calls.begin(), calls.end());
+        }
+    }
+
+    for (const auto& name : recursive)
+    {
+        callees_.erase(name);
+    }
+}
+
+void inliner::inline_stmt(ast::stmt& stmt)
+{
+    switch (stmt.kind())
+    {
+        case ast::kind::stmt_list:
+            inline_stmt_list(stmt.as_list);
+            break;
+        case ast::kind::stmt_expr:
+            inline_expr(stmt.as_expr->expr);
+            break;
+        case ast::kind::stmt_call:
+            inline_stmt_call(stmt);
+            break;
+        case ast::kind::stmt_assign:
+            inline_expr(stmt.as_assign->expr);
+            break;
+        case ast::kind::stmt_endon:
+            inline_expr_object(stmt.as_endon->obj);
+            inline_expr(stmt.as_endon->event);
+            break;
+        case ast::kind::stmt_notify:
+            inline_expr_object(stmt.as_notify->obj);
+            inline_expr(stmt.as_notify->event);
+            inline_expr_arguments(stmt.as_notify->args);
+            break;
+        case ast::kind::stmt_wait:
+            inline_expr(stmt.as_wait->time);
+            break;
+        case ast::kind::stmt_waittill:
+            inline_expr_object(stmt.as_waittill->obj);
+            inline_expr(stmt.as_waittill->event);
+            break;
+        case ast::kind::stmt_waittillmatch:
+            inline_expr_object(stmt.as_waittillmatch->obj);
+            inline_expr(stmt.as_waittillmatch->event);
+            inline_expr_arguments(stmt.as_waittillmatch->args);
+            break;
+        case ast::kind::stmt_if:
+            inline_expr(stmt.as_if->test);
+            inline_stmt(stmt.as_if->stmt);
+            break;
+        case ast::kind::stmt_ifelse:
+            inline_expr(stmt.as_ifelse->test);
+            inline_stmt(stmt.as_ifelse->stmt_if);
+            inline_stmt(stmt.as_ifelse->stmt_else);
+            break;
+        case ast::kind::stmt_while:
+            inline_expr(stmt.as_while->test);
+            inline_stmt(stmt.as_while->stmt);
+            break;
+        case ast::kind::stmt_dowhile:
+            inline_expr(stmt.as_dowhile->test);
+            inline_stmt(stmt.as_dowhile->stmt);
+            break;
+        case ast::kind::stmt_for:
+            inline_stmt(stmt.as_for->init);
+            inline_expr(stmt.as_for->test);
+            inline_stmt(stmt.as_for->iter);
+            inline_stmt(stmt.as_for->stmt);
+            break;
+        case ast::kind::stmt_foreach:
+            inline_expr(stmt.as_foreach->array_expr);
+            inline_stmt(stmt.as_foreach->stmt);
+            break;
+        case ast::kind::stmt_switch:
+            inline_expr(stmt.as_switch->test);
+            inline_stmt_list(stmt.as_switch->stmt);
+            break;
+        case ast::kind::stmt_case:
+            if (stmt.as_case->stmt != nullptr) inline_stmt_list(stmt.as_case->stmt);
+            break;
+        case ast::kind::stmt_default:
+            if (stmt.as_default->stmt != nullptr) inline_stmt_list(stmt.as_default->stmt);
+            break;
+        case ast::kind::stmt_return:
+            inline_expr(stmt.as_return->expr);
+            break;
+        case ast::kind::stmt_prof_begin:
+            inline_expr_arguments(stmt.as_prof_begin->args);
+            break;
+        case ast::kind::stmt_prof_end:
+            inline_expr_arguments(stmt.as_prof_end->args);
+            break;
+        default:
+            break;
+    }
+}
+
+void inliner::inline_stmt_list(const ast::stmt_list::ptr& stmt)
+{
+    for (auto& entry : stmt->list)
+    {
+        inline_stmt(entry);
+    }
+}
+
+// a call statement drops the value, it stays a statement only while the value is a call
+void inliner::inline_stmt_call(ast::stmt& stmt)
+{
+    auto& expr = stmt.as_call->expr;
+
+    if (expr == ast::kind::expr_method)
+    {
+        inline_expr_object(expr.as_method->obj);
+        inline_expr_call(expr.as_method->call);
+    }
+    else if (expr == ast::kind::expr_call)
+    {
+        inline_expr_call(expr.as_call->call);
+    }
+
+    auto result = expand(expr);
+
+    if (result.as_node == nullptr) return;
+
+    if (result == ast::kind::expr_call || result == ast::kind::expr_method)
+    {
+        count_++;
+        expr = std::move(result);
+        inline_stmt_call(stmt);
+    }
+    else if (is_pure(result))
+    {
+        count_++;
+        stmt = empty_stmt(stmt.loc());
+    }
+}
+
+void inliner::inline_expr(ast::expr& expr)
+{
+    if (is_binary(expr.kind()))
+    {
+        inline_expr(expr.as_binary->lvalue);
+        inline_expr(expr.as_binary->rvalue);
+        return;
+    }
+
+    switch (expr.kind())
+    {
+        case ast::kind::expr_paren:
+            inline_expr(expr.as_paren->child);
+            break;
+        case ast::kind::expr_ternary:
+            inline_expr(expr.as_ternary->test);
+            inline_expr(expr.as_ternary->true_expr);
+            inline_expr(expr.as_ternary->false_expr);
+            break;
+        case ast::kind::expr_complement:
+            inline_expr(expr.as_complement->rvalue);
+            break;
+        case ast::kind::expr_not:
+            inline_expr(expr.as_not->rvalue);
+            break;
+        case ast::kind::expr_assign_equal:
+        case ast::kind::expr_assign_add:
+        case ast::kind::expr_assign_sub:
+        case ast::kind::expr_assign_mul:
+        case ast::kind::expr_assign_div:
+        case ast::kind::expr_assign_mod:
+        case ast::kind::expr_assign_shift_left:
+        case ast::kind::expr_assign_shift_right:
+        case ast::kind::expr_assign_bitwise_or:
+        case ast::kind::expr_assign_bitwise_and:
+        case ast::kind::expr_assign_bitwise_exor:
+            inline_expr_object(expr.as_assign->lvalue);
+            inline_expr(expr.as_assign->rvalue);
+            break;
+        case ast::kind::expr_increment:
+            inline_expr_object(expr.as_increment->lvalue);
+            break;
+        case ast::kind::expr_decrement:
+            inline_expr_object(expr.as_decrement->lvalue);
+            break;
+        case ast::kind::expr_add_array:
+            inline_expr_arguments(expr.as_add_array->args);
+            break;
+        case ast::kind::expr_array:
+            inline_expr_object(expr.as_array->obj);
+            inline_expr(expr.as_array->key);
+            break;
+        case ast::kind::expr_field:
+            inline_expr_object(expr.as_field->obj);
+            break;
+        case ast::kind::expr_size:
+            inline_expr(expr.as_size->obj);
+            break;
+        case ast::kind::expr_vector:
+            inline_expr(expr.as_vector->x);
+            inline_expr(expr.as_vector->y);
+            inline_expr(expr.as_vector->z);
+            break;
+        case ast::kind::expr_call:
+        case ast::kind::expr_method:
+            inline_call(expr, false);
+            break;
+        default:
+            break;
+    }
+}
+
+void inliner::inline_expr_object(ast::expr& expr)
+{
+    if (expr == ast::kind::expr_call || expr == ast::kind::expr_method)
+    {
+        inline_call(expr, true);
+    }
+    else
+    {
+        inline_expr(expr);
+    }
+}
+
+void inliner::inline_expr_arguments(const ast::expr_arguments::ptr& args)
+{
+    for (auto& entry : args->list)
+    {
+        inline_expr(entry);
+    }
+}
+
+void inliner::inline_expr_call(ast::call& call)
+{
+    if (call == ast::kind::expr_pointer)
+    {
+        inline_expr(call.as_pointer->func);
+        inline_expr_arguments(call.as_pointer->args);
+    }
+    else if (call == ast::kind::expr_function)
+    {
+        inline_expr_arguments(call.as_function->args);
+    }
+}
+
+// calls used as objects are only replaced by expressions that are objects too
+void inliner::inline_call(ast::expr& expr, bool object)
+{
+    if (expr == ast::kind::expr_method)
+    {
+        inline_expr_object(expr.as_method->obj);
+        inline_expr_call(expr.as_method->call);
+    }
+    else
+    {
+        inline_expr_call(expr.as_call->call);
+    }
+
+    auto result = expand(expr);
+
+    if (result.as_node == nullptr || (object && !is_object(result))) return;
+
+    count_++;
+    expr = std::move(result);
+
+    if (object)
+        inline_expr_object(expr);
+    else
+        inline_expr(expr);
+}
+
+// the returned expression for a call of a candidate, null when the arguments can't be
+// moved into it
+auto inliner::expand(const ast::expr& expr) -> ast::expr
+{
+    const auto& call = (expr == ast::kind::expr_method) ? expr.as_method->call : expr.as_call->call;
+    const auto* obj = (expr == ast::kind::expr_method) ? &expr.as_method->obj : nullptr;
+
+    if (call.kind() != ast::kind::expr_function) return ast::expr(nullptr);
+
+    const auto& func = *call.as_function;
+
+    if (func.mode != ast::call::mode::normal || !func.path->value.empty()) return ast::expr(nullptr);
+
+    const auto itr = callees_.find(func.name->value);
+
+    if (itr == callees_.end()) return ast::expr(nullptr);
+
+    const auto& entry = itr->second;
+    const auto& args = func.args->list;
+
+    if (args.size() > entry.params->list.size()) return ast::expr(nullptr);
+
+    for (auto i = 0u; i < args.size(); i++)
+    {
+        if (!can_substitute(args[i], entry.uses[i], entry.calls)) return ast::expr(nullptr);
+    }
+
+    if (obj != nullptr && (!entry.method || !can_substitute(*obj, entry.self_uses, entry.calls))) return ast::expr(nullptr);
+
+    const auto loc = expr.loc();
+
+    if (entry.body.as_node == nullptr) return ast::expr(std::make_unique<ast::expr_undefined>(loc));
+
+    return copier{ loc, entry.params, &args, obj }.copy(entry.body);
+}
+
+} // namespace xsk::gsc
@@ -0,0 +1,47 @@
+// Copyright 2021 xensik. All rights reserved.
+//
+// Use of this source code is governed by a GNU GPLv3 license
+// that can be found in the LICENSE file.
+
+#pragma once
+
+namespace xsk::gsc
+{
+
+// syntax tree pass run by the compilers when inlining is enabled. calls to small threads
+// of the same file that do nothing or only return an expression are replaced by that
+// expression, with the caller's arguments in place of the parameters
+class inliner
+{
+    struct callee
+    {
+        const ast::expr_parameters* params;
+        ast::expr body;
+        std::vector<std::size_t> uses;
+        std::size_t self_uses;
+        bool calls;
+        bool method;
+    };
+
+    std::function<bool(const std::string&)> builtin_;
+    std::unordered_map<std::string, callee> callees_;
+    std::size_t count_ = 0;
+
+public:
+    inliner(std::function<bool(const std::string&)> builtin) : builtin_(std::move(builtin)) {}
+    auto optimize(const ast::program::ptr& program, std::map<std::string, std::size_t>& stats) -> bool;
+
+private:
+    void collect(const ast::program::ptr& program);
+    void inline_stmt(ast::stmt& stmt);
+    void inline_stmt_list(const ast::stmt_list::ptr& stmt);
+    void inline_stmt_call(ast::stmt& stmt);
+    void inline_expr(ast::expr& expr);
+    void inline_expr_object(ast::expr& expr);
+    void inline_expr_arguments(const ast::expr_arguments::ptr& args);
+    void inline_expr_call(ast::call& call);
+    void inline_call(ast::expr& expr, bool object);
+    auto expand(const ast::expr& expr) -> ast::expr;
+};
+
+} // namespace xsk::gsc
@@ -17,6 +17,12 @@ public:
     virtual auto output() -> std::vector<gsc::function::ptr> = 0;
     virtual void compile(const std::string& file, std::vector<std::uint8_t>& data) = 0;
     virtual void read_callback(std::function<std::vector<std::uint8_t>(const std::string&)> func) = 0;
+    virtual void include_cache(gsc::include_cache* cache) = 0;
+    virtual void inlining(bool enable) = 0;
+    virtual void peephole_rules(bool enable) = 0;
+    virtual void jump_threading(bool enable) = 0;
+    virtual auto dependencies() -> std::vector<std::string> = 0;
+    virtual auto opt_stats() -> const std::map<std::string, std::size_t>& = 0;
 };
 
 } // namespace xsk::gsc
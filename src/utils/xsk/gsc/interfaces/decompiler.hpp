@@ -15,7 +15,9 @@ public:
 
     virtual ~decompiler() = default;
     virtual auto output() -> std::vector<std::uint8_t> = 0;
+    virtual void output(std::ostream& stream) = 0;
     virtual void decompile(const std::string& file, std::vector<gsc::function::ptr>& funcs) = 0;
+    virtual void thread_pool(utils::thread_pool* pool) = 0;
 };
 
 } // namespace xsk::gsc
@@ -17,6 +17,7 @@ public:
     virtual auto output() -> std::vector<gsc::function::ptr> = 0;
     virtual auto output_data() -> std::vector<std::uint8_t> = 0;
     virtual void disassemble(const std::string& file, std::vector<std::uint8_t>& script, std::vector<std::uint8_t>& stack) = 0;
+    virtual void disassemble(const std::string& file, const std::uint8_t* script, std::size_t script_size, const std::uint8_t* stack, std::size_t stack_size) = 0;
 };
 
 } // namespace xsk::gsc
@@ -0,0 +1,222 @@
+// Copyright 2021 xensik. All rights reserved.
+//
+// Use of this source code is governed by a GNU GPLv3 license
+// that can be found in the LICENSE file.
+
+#include "stdafx.hpp"
+
+// layout, all integers little endian, strings are u32 length + bytes:
+//   u32 magic, u16 version, string game, u32 function count
+//   function: u32 index, u32 size, u32 id, string name,
+//             u32 label count, { u32 index, u32 label } sorted by index,
+//             u32 instruction count
+//   instruction: u32 index, u32 size, u8 opcode, u32 operand count
+//   operand: u8 kind, then i32 value for integers, f32 bits for floats and vector
+//            components, u32 label, u32 value and string name for ids and local
+//            functions or string for text
+
+namespace xsk::gsc
+{
+
+namespace
+{
+
+void write_string(utils::byte_buffer& data, const std::string& value)
+{
+    data.write_le<std::uint32_t>(static_cast<std::uint32_t>(value.size()));
+    data.write_string(value);
+}
+
+auto read_string(utils::byte_buffer& data) -> std::string
+{
+    return data.read_string(data.read_le<std::uint32_t>());
+}
+
+} // namespace
+
+void ir::serialize(std::ostream& stream) const
+{
+    utils::byte_buffer data;
+
+    serialize(data);
+
+    stream.write(reinterpret_cast<const char*>(data.buffer().data()), data.size());
+    stream.flush();
+
+    if (!stream.good())
+    {
+        throw std::runtime_error("Couldn't write IR, stream failed");
+    }
+}
+
+void ir::serialize(utils::byte_buffer& data) const
+{
+    data.write_le<std::uint32_t>(magic);
+    data.write_le<std::uint16_t>(version);
+    write_string(data, game);
+    data.write_le<std::uint32_t>(static_cast<std::uint32_t>(functions.size()));
+
+    std::vector<std::pair<std::uint32_t, std::uint32_t>> labels;
+
+    for (const auto& func : functions)
+    {
+        data.write_le<std::uint32_t>(func->index);
+        data.write_le<std::uint32_t>(func->size);
+        data.write_le<std::uint32_t>(func->id);
+        write_string(data, func->name);
+
+        labels.assign(func->labels.begin(), func->labels.end());
+        std::sort(labels.begin(), labels.end());
+
+        data.write_le<std::uint32_t>(static_cast<std::uint32_t>(labels.size()));
+
+        for (const auto& entry : labels)
+        {
+            data.write_le<std::uint32_t>(entry.first);
+            data.write_le<std::uint32_t>(entry.second);
+        }
+
+        data.write_le<std::uint32_t>(static_cast<std::uint32_t>(func->instructions.size()));
+
+        for (const auto& inst : func->instructions)
+        {
+            data.write_le<std::uint32_t>(inst->index);
+            data.write_le<std::uint32_t>(inst->size);
+            data.write<std::uint8_t>(inst->opcode);
+            data.write_le<std::uint32_t>(static_cast<std::uint32_t>(inst->data.size()));
+
+            for (const auto& entry : inst->data)
+            {
+                data.write<std::uint8_t>(static_cast<std::uint8_t>(entry.type()));
+
+                switch (entry.type())
+                {
+                    case operand::kind::integer:
+                        data.write_le<std::int32_t>(entry.as_int());
+                        break;
+                    case operand::kind::floating:
+                    case operand::kind::component:
+                    {
+                        const auto value = entry.as_float();
+                        std::uint32_t bits = 0;
+                        std::memcpy(&bits, &value, sizeof(bits));
+                        data.write_le<std::uint32_t>(bits);
+                    }
+                        break;
+                    case operand::kind::label:
+                        data.write_le<std::uint32_t>(entry.as_label());
+                        break;
+                    case operand::kind::function:
+                        data.write_le<std::uint32_t>(entry.as_uint());
+                        write_string(data, entry.str().substr(4));
+                        break;
+                    case operand::kind::id:
+                        data.write_le<std::uint32_t>(entry.as_uint());
+                        write_string(data, entry.str());
+                        break;
+                    default:
+                        write_string(data, entry.str());
+                        break;
+                }
+            }
+        }
+    }
+}
+
+void ir::deserialize(const std::uint8_t* data, std::size_t size)
+{
+    utils::byte_buffer input(data, size);
+
+    if (size < 6 || input.read_le<std::uint32_t>() != magic)
+    {
+        throw std::runtime_error("Couldn't read IR, bad magic");
+    }
+
+    const auto ver = input.read_le<std::uint16_t>();
+
+    if (ver != version)
+    {
+        throw std::runtime_error(utils::string::va("Couldn't read IR, unsupported version %u", ver));
+    }
+
+    game = read_string(input);
+    functions.clear();
+
+    const auto func_count = input.read_le<std::uint32_t>();
+
+    for (auto i = 0u; i < func_count; i++)
+    {
+        auto func = std::make_unique<function>();
+        func->index = input.read_le<std::uint32_t>();
+        func->size = input.read_le<std::uint32_t>();
+        func->id = input.read_le<std::uint32_t>();
+        func->name = read_string(input);
+
+        const auto label_count = input.read_le<std::uint32_t>();
+
+        for (auto j = 0u; j < label_count; j++)
+        {
+            const auto index = input.read_le<std::uint32_t>();
+            func->labels.insert({ index, input.read_le<std::uint32_t>() });
+        }
+
+        const auto inst_count = input.read_le<std::uint32_t>();
+
+        for (auto j = 0u; j < inst_count; j++)
+        {
+            auto inst = std::make_unique<instruction>();
+            inst->index = input.read_le<std::uint32_t>();
+            inst->size = input.read_le<std::uint32_t>();
+            inst->opcode = input.read<std::uint8_t>();
+
+            const auto data_count = input.read_le<std::uint32_t>();
+
+            for (auto k = 0u; k < data_count; k++)
+            {
+                const auto type = input.read<std::uint8_t>();
+
+                switch (static_cast<operand::kind>(type))
+                {
+                    case operand::kind::integer:
+                        inst->data.push_back(operand::integer(input.read_le<std::int32_t>()));
+                        break;
+                    case operand::kind::floating:
+                    case operand::kind::component:
+                    {
+                        const auto bits = input.read_le<std::uint32_t>();
+                        float value = 0;
+                        std::memcpy(&value, &bits, sizeof(value));
+                        inst->data.push_back(type == static_cast<std::uint8_t>(operand::kind::floating) ? operand::floating(value) : operand::component(value));
+                    }
+                        break;
+                    case operand::kind::label:
+                        inst->data.push_back(operand::label(input.read_le<std::uint32_t>()));
+                        break;
+                    case operand::kind::function:
+                    {
+                        const auto value = input.read_le<std::uint32_t>();
+                        inst->data.push_back(operand::function(value, read_string(input)));
+                    }
+                        break;
+                    case operand::kind::id:
+                    {
+                        const auto value = input.read_le<std::uint32_t>();
+                        inst->data.push_back(operand::id(value, read_string(input)));
+                    }
+                        break;
+                    case operand::kind::text:
+                        inst->data.push_back(read_string(input));
+                        break;
+                    default:
+                        throw std::runtime_error(utils::string::va("Couldn't read IR, bad operand kind %u", type));
+                }
+            }
+
+            func->instructions.push_back(std::move(inst));
+        }
+
+        functions.push_back(std::move(func));
+    }
+}
+
+} // namespace xsk::gsc
@@ -0,0 +1,25 @@
+// Copyright 2021 xensik. All rights reserved.
+//
+// Use of this source code is governed by a GNU GPLv3 license
+// that can be found in the LICENSE file.
+
+#pragma once
+
+namespace xsk::gsc
+{
+
+// binary form of a function list, as produced by the disassemblers
+struct ir
+{
+    static constexpr std::uint32_t magic = 0x52495347; // "GSIR"
+    static constexpr std::uint16_t version = 5;
+
+    std::string game;
+    std::vector<function::ptr> functions;
+
+    void serialize(std::ostream& stream) const;
+    void serialize(utils::byte_buffer& data) const;
+    void deserialize(const std::uint8_t* data, std::size_t size);
+};
+
+} // namespace xsk::gsc
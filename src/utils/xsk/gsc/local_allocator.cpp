@@ -0,0 +1,493 @@
+// Copyright 2021 xensik. All rights reserved.
+//
+// Use of this source code is governed by a GNU GPLv3 license
+// that can be found in the LICENSE file.
+
+#include "stdafx.hpp"
+
+namespace xsk::gsc
+{
+
+namespace
+{
+
+// EvalLocalVariableCached0 to 5 carry the index in the opcode
+constexpr std::size_t cached_slots = 6;
+
+// uses weigh 8 times more per enclosing loop, deeper loops weigh the same
+constexpr std::size_t max_depth = 4;
+
+struct variable
+{
+    std::vector<ast::expr*> refs;
+    const ast::stmt_list* list = nullptr;
+    const ast::node* last = nullptr;
+    std::size_t begin = 0;
+    std::size_t end = 0;
+    std::size_t weight = 0;
+    bool scoped = true;
+};
+
+// statement list being walked and its current statement, case labels jump into the
+// middle of a switch body so assignments there don't come before every use
+struct frame
+{
+    const ast::stmt_list* list;
+    const ast::node* stmt;
+    bool definite;
+};
+
+struct loop
+{
+    const ast::node* node;
+    std::size_t begin;
+    std::size_t end;
+};
+
+// statements are numbered in source order, a use inside a loop body is numbered inside
+// it and the loop test outside of it
+class scanner
+{
+public:
+    std::unordered_map<utils::interner::handle, variable> vars;
+    std::vector<utils::interner::handle> order;
+    std::unordered_map<const ast::node*, std::size_t> ends;
+    std::vector<loop> loops;
+    std::vector<frame> frames;
+    std::size_t pos = 0;
+    std::size_t depth = 0;
+
+    auto get(utils::interner::handle name) -> variable&
+    {
+        const auto [itr, inserted] = vars.try_emplace(name);
+
+        if (inserted) order.push_back(name);
+
+        return itr->second;
+    }
+
+    void occur(ast::expr& expr, bool def)
+    {
+        auto& var = get(expr.as_identifier->id);
+
+        var.refs.push_back(&expr);
+        var.weight += std::size_t(1) << (3 * std::min(depth, max_depth));
+
+        if (!var.scoped) return;
+
+        if (var.refs.size() == 1)
+        {
+            if (!def)
+            {
+                var.scoped = false;
+                return;
+            }
+
+            var.list = frames.back().list;
+            var.last = frames.back().stmt;
+            var.begin = pos;
+            return;
+        }
+
+        const auto itr = std::find_if(frames.rbegin(), frames.rend(), [&var](const frame& entry) { return entry.list == var.list; });
+
+        if (itr == frames.rend())
+        {
+            var.scoped = false;
+            return;
+        }
+
+        var.last = itr->stmt;
+    }
+
+    void scan_params(const ast::expr_parameters::ptr& params)
+    {
+        for (const auto& entry : params->list)
+        {
+            get(entry->id).scoped = false;
+        }
+    }
+
+    void scan_list(const ast::stmt_list::ptr& stmt, bool definite)
+    {
+        frames.push_back({ stmt.get(), nullptr, definite });
+
+        for (auto& entry : stmt->list)
+        {
+            frames.back().stmt = entry.as_node.get();
+            scan_stmt(entry);
+        }
+
+        frames.pop_back();
+    }
+
+    void scan_body(ast::stmt& stmt, const ast::node* node)
+    {
+        depth++;
+        loops.push_back({ node, pos + 1, 0 });
+
+        const auto index = loops.size() - 1;
+
+        scan_stmt(stmt);
+
+        loops[index].end = pos;
+        depth--;
+    }
+
+    void scan_stmt(ast::stmt& stmt)
+    {
+        const auto node = stmt.as_node.get();
+
+        pos++;
+
+        switch (stmt.kind())
+        {
+            case ast::kind::stmt_list:
+                scan_list(stmt.as_list, true);
+                break;
+            case ast::kind::stmt_expr:
+                scan_expr(stmt.as_expr->expr);
+                break;
+            case ast::kind::stmt_call:
+                scan_expr(stmt.as_call->expr);
+                break;
+            case ast::kind::stmt_assign:
+                scan_assign(stmt.as_assign->expr, !frames.empty() && frames.back().definite && frames.back().stmt == node);
+                break;
+            case ast::kind::stmt_endon:
+                scan_expr(stmt.as_endon->obj);
+                scan_expr(stmt.as_endon->event);
+                break;
+            case ast::kind::stmt_notify:
+                scan_expr(stmt.as_notify->obj);
+                scan_expr(stmt.as_notify->event);
+                scan_args(stmt.as_notify->args);
+                break;
+            case ast::kind::stmt_wait:
+                scan_expr(stmt.as_wait->time);
+                break;
+            case ast::kind::stmt_waittill:
+                scan_expr(stmt.as_waittill->obj);
+                scan_expr(stmt.as_waittill->event);
+                scan_args(stmt.as_waittill->args);
+                break;
+            case ast::kind::stmt_waittillmatch:
+                scan_expr(stmt.as_waittillmatch->obj);
+                scan_expr(stmt.as_waittillmatch->event);
+                scan_args(stmt.as_waittillmatch->args);
+                break;
+            case ast::kind::stmt_if:
+                scan_expr(stmt.as_if->test);
+                scan_stmt(stmt.as_if->stmt);
+                break;
+            case ast::kind::stmt_ifelse:
+                scan_expr(stmt.as_ifelse->test);
+                scan_stmt(stmt.as_ifelse->stmt_if);
+                scan_stmt(stmt.as_ifelse->stmt_else);
+                break;
+            case ast::kind::stmt_while:
+                depth++;
+                scan_expr(stmt.as_while->test);
+                depth--;
+                scan_body(stmt.as_while->stmt, node);
+                break;
+            case ast::kind::stmt_dowhile:
+                scan_body(stmt.as_dowhile->stmt, node);
+                pos++;
+                depth++;
+                scan_expr(stmt.as_dowhile->test);
+                depth--;
+                break;
+            case ast::kind::stmt_for:
+                scan_stmt(stmt.as_for->init);
+                pos++;
+                depth++;
+                scan_expr(stmt.as_for->test);
+                depth--;
+                scan_body(stmt.as_for->stmt, node);
+                depth++;
+                scan_stmt(stmt.as_for->iter);
+                depth--;
+                break;
+            case ast::kind::stmt_foreach:
+                scan_expr(stmt.as_foreach->array_expr);
+                depth++;
+                scan_expr(stmt.as_foreach->value_expr);
+                scan_expr(stmt.as_foreach->key_expr);
+                depth--;
+                scan_body(stmt.as_foreach->stmt, node);
+                break;
+            case ast::kind::stmt_switch:
+                scan_expr(stmt.as_switch->test);
+                scan_list(stmt.as_switch->stmt, false);
+                break;
+            case ast::kind::stmt_case:
+                scan_expr(stmt.as_case->label);
+                if (stmt.as_case->stmt != nullptr) scan_list(stmt.as_case->stmt, false);
+                break;
+            case ast::kind::stmt_default:
+                if (stmt.as_default->stmt != nullptr) scan_list(stmt.as_default->stmt, false);
+                break;
+            case ast::kind::stmt_return:
+                scan_expr(stmt.as_return->expr);
+                break;
+            case ast::kind::stmt_prof_begin:
+                scan_args(stmt.as_prof_begin->args);
+                break;
+            case ast::kind::stmt_prof_end:
+                scan_args(stmt.as_prof_end->args);
+                break;
+            default:
+                break;
+        }
+
+        ends[node] = pos;
+    }
+
+    // the value is evaluated before the variable is written
+    void scan_assign(ast::expr& expr, bool definite)
+    {
+        if (expr != ast::kind::expr_assign_equal || expr.as_assign->lvalue != ast::kind::expr_identifier)
+        {
+            scan_expr(expr);
+            return;
+        }
+
+        scan_expr(expr.as_assign->rvalue);
+        occur(expr.as_assign->lvalue, definite);
+    }
+
+    void scan_args(const ast::expr_arguments::ptr& args)
+    {
+        for (auto& entry : args->list)
+        {
+            scan_expr(entry);
+        }
+    }
+
+    void scan_call(ast::call& call)
+    {
+        if (call == ast::kind::expr_pointer)
+        {
+            scan_expr(call.as_pointer->func);
+            scan_args(call.as_pointer->args);
+        }
+        else if (call == ast::kind::expr_function)
+        {
+            scan_args(call.as_function->args);
+        }
+    }
+
+    void scan_expr(ast::expr& expr)
+    {
+        if (expr.as_node == nullptr) return;
+
+        switch (expr.kind())
+        {
+            case ast::kind::expr_identifier:
+                occur(expr, false);
+                break;
+            case ast::kind::expr_paren:
+                scan_expr(expr.as_paren->child);
+                break;
+            case ast::kind::expr_size:
+                scan_expr(expr.as_size->obj);
+                break;
+            case ast::kind::expr_field:
+                scan_expr(expr.as_field->obj);
+                break;
+            case ast::kind::expr_array:
+                scan_expr(expr.as_array->obj);
+                scan_expr(expr.as_array->key);
+                break;
+            case ast::kind::expr_istrue:
+                scan_expr(expr.as_istrue->expr);
+                break;
+            case ast::kind::expr_isdefined:
+                scan_expr(expr.as_isdefined->expr);
+                break;
+            case ast::kind::expr_add_array:
+                scan_args(expr.as_add_array->args);
+                break;
+            case ast::kind::expr_call:
+                scan_call(expr.as_call->call);
+                break;
+            case ast::kind::expr_method:
+                scan_expr(expr.as_method->obj);
+                scan_call(expr.as_method->call);
+                break;
+            case ast::kind::expr_complement:
+                scan_expr(expr.as_complement->rvalue);
+                break;
+            case ast::kind::expr_not:
+                scan_expr(expr.as_not->rvalue);
+                break;
+            case ast::kind::expr_add:
+            case ast::kind::expr_sub:
+            case ast::kind::expr_mul:
+            case ast::kind::expr_div:
+            case ast::kind::expr_mod:
+            case ast::kind::expr_shift_left:
+            case ast::kind::expr_shift_right:
+            case ast::kind::expr_bitwise_or:
+            case ast::kind::expr_bitwise_and:
+            case ast::kind::expr_bitwise_exor:
+            case ast::kind::expr_equality:
+            case ast::kind::expr_inequality:
+            case ast::kind::expr_less_equal:
+            case ast::kind::expr_greater_equal:
+            case ast::kind::expr_less:
+            case ast::kind::expr_greater:
+            case ast::kind::expr_or:
+            case ast::kind::expr_and:
+                scan_expr(expr.as_binary->lvalue);
+                scan_expr(expr.as_binary->rvalue);
+                break;
+            case ast::kind::expr_ternary:
+                scan_expr(expr.as_ternary->test);
+                scan_expr(expr.as_ternary->true_expr);
+                scan_expr(expr.as_ternary->false_expr);
+                break;
+            case ast::kind::expr_increment:
+                scan_expr(expr.as_increment->lvalue);
+                break;
+            case ast::kind::expr_decrement:
+                scan_expr(expr.as_decrement->lvalue);
+                break;
+            case ast::kind::expr_assign_equal:
+            case ast::kind::expr_assign_add:
+            case ast::kind::expr_assign_sub:
+            case ast::kind::expr_assign_mul:
+            case ast::kind::expr_assign_div:
+            case ast::kind::expr_assign_mod:
+            case ast::kind::expr_assign_shift_left:
+            case ast::kind::expr_assign_shift_right:
+            case ast::kind::expr_assign_bitwise_or:
+            case ast::kind::expr_assign_bitwise_and:
+            case ast::kind::expr_assign_bitwise_exor:
+                scan_expr(expr.as_assign->rvalue);
+                scan_expr(expr.as_assign->lvalue);
+                break;
+            case ast::kind::expr_vector:
+                scan_expr(expr.as_vector->x);
+                scan_expr(expr.as_vector->y);
+                scan_expr(expr.as_vector->z);
+                break;
+            default:
+                break;
+        }
+    }
+};
+
+void rename(ast::expr& expr, utils::interner::handle name)
+{
+    expr = ast::expr(std::make_unique<ast::expr_identifier>(expr.loc(), utils::interner::find(name)));
+}
+
+} // namespace
+
+void local_allocator::allocate(const ast::decl_thread::ptr& thread, std::map<std::string, std::size_t>& stats)
+{
+    hoisted_.clear();
+    weights_.clear();
+
+    scanner scan;
+
+    scan.scan_params(thread->params);
+    scan.scan_list(thread->stmt, true);
+
+    // a scoped variable reuses the first name whose ranges all end before its own begins,
+    // its range runs to the end of the statement of its list holding the last use
+    struct slot
+    {
+        utils::interner::handle name;
+        std::size_t begin;
+        std::size_t end;
+    };
+
+    std::vector<slot> slots;
+
+    for (const auto name : scan.order)
+    {
+        auto& var = scan.vars.at(name);
+
+        if (!var.scoped)
+        {
+            weights_[name] += var.weight;
+            continue;
+        }
+
+        var.end = scan.ends.at(var.last);
+
+        const auto itr = std::find_if(slots.begin(), slots.end(), [&var](const slot& entry) { return entry.end < var.begin; });
+
+        if (itr == slots.end())
+        {
+            slots.push_back({ name, var.begin, var.end });
+            weights_[name] += var.weight;
+            continue;
+        }
+
+        for (const auto ref : var.refs)
+        {
+            rename(*ref, itr->name);
+        }
+
+        itr->end = var.end;
+        weights_[itr->name] += var.weight;
+        stats["shared-local"]++;
+    }
+
+    // loops come in source order, the first one holding every range is the outermost
+    for (const auto& entry : slots)
+    {
+        const auto itr = std::find_if(scan.loops.begin(), scan.loops.end(), [&entry](const loop& item)
+        {
+            return item.begin <= entry.begin && entry.end <= item.end;
+        });
+
+        if (itr != scan.loops.end())
+        {
+            hoisted_[itr->node].push_back(entry.name);
+            stats["hoisted-local"]++;
+        }
+    }
+}
+
+auto local_allocator::hoisted(const ast::node* loop) const -> const std::vector<utils::interner::handle>&
+{
+    static const std::vector<utils::interner::handle> none;
+
+    const auto itr = hoisted_.find(loop);
+
+    return itr != hoisted_.end() ? itr->second : none;
+}
+
+// the variable created last is at index 0, so the most used ones go to the end. parameters
+// keep their positions, and with no more variables than cached slots every index is short
+void local_allocator::order(block& blk, std::size_t fixed, std::map<std::string, std::size_t>& stats) const
+{
+    if (blk.local_vars.size() <= cached_slots || blk.local_vars.size() <= fixed) return;
+
+    const auto weight = [this](const local_var& var)
+    {
+        const auto itr = weights_.find(var.name);
+        return itr != weights_.end() ? itr->second : 0;
+    };
+
+    const auto sorted = std::is_sorted(blk.local_vars.begin() + fixed, blk.local_vars.end(), [&weight](const local_var& lhs, const local_var& rhs)
+    {
+        return weight(lhs) < weight(rhs);
+    });
+
+    if (sorted) return;
+
+    std::stable_sort(blk.local_vars.begin() + fixed, blk.local_vars.end(), [&weight](const local_var& lhs, const local_var& rhs)
+    {
+        return weight(lhs) < weight(rhs);
+    });
+
+    stats["ordered-locals"]++;
+}
+
+} // namespace xsk::gsc
@@ -0,0 +1,27 @@
+// Copyright 2021 xensik. All rights reserved.
+//
+// Use of this source code is governed by a GNU GPLv3 license
+// that can be found in the LICENSE file.
+
+#pragma once
+
+namespace xsk::gsc
+{
+
+// local variable slots of a thread, worked out on the syntax tree before the compiler
+// assigns stack positions. a variable is scoped when a plain assignment in one statement
+// list comes before all of its uses: scoped variables with ranges that don't overlap share
+// a name, the ones inside loops are created before the outermost loop, and the most used
+// variables of a thread get the slots the single byte access opcodes reach
+class local_allocator
+{
+    std::unordered_map<const ast::node*, std::vector<utils::interner::handle>> hoisted_;
+    std::unordered_map<utils::interner::handle, std::size_t> weights_;
+
+public:
+    void allocate(const ast::decl_thread::ptr& thread, std::map<std::string, std::size_t>& stats);
+    auto hoisted(const ast::node* loop) const -> const std::vector<utils::interner::handle>&;
+    void order(block& blk, std::size_t fixed, std::map<std::string, std::size_t>& stats) const;
+};
+
+} // namespace xsk::gsc
@@ -161,6 +161,17 @@ public:
         return utils::string::va("loc_%X", begin.line);
     }
 
+    // inverse of label(), -1 when the string isn't one
+    static auto label_line(const std::string& label) -> counter_type
+    {
+        if (label.size() <= 4 || label.compare(0, 4, "loc_") != 0)
+            return -1;
+
+        const auto line = static_cast<counter_type>(std::strtoul(label.data() + 4, nullptr, 16));
+
+        return (utils::string::va("loc_%X", line) == label) ? line : -1;
+    }
+
 public:
     /// Beginning of the located region.
     position begin;
@@ -0,0 +1,202 @@
+// Copyright 2021 xensik. All rights reserved.
+//
+// Use of this source code is governed by a GNU GPLv3 license
+// that can be found in the LICENSE file.
+
+#pragma once
+
+namespace xsk::gsc
+{
+
+class lookup
+{
+public:
+    // must match seed_hash in gen/resolver.py
+    static constexpr auto hash(std::string_view str, std::uint32_t seed, bool lower = false) -> std::uint32_t
+    {
+        auto value = 0x811C9DC5u ^ seed;
+
+        for (const auto c : str)
+        {
+            value ^= lower ? to_lower(c) : static_cast<std::uint8_t>(c);
+            value *= 0x01000193u;
+        }
+
+        value ^= value >> 16;
+        value *= 0x85EBCA6Bu;
+        value ^= value >> 13;
+        value *= 0xC2B2AE35u;
+        value ^= value >> 16;
+
+        return value;
+    }
+
+    template <typename T, std::size_t N>
+    static constexpr auto is_sorted(const std::array<T, N>& list) -> bool
+    {
+        for (std::size_t i = 1; i < N; i++)
+        {
+            if (list[i].key < list[i - 1].key) return false;
+        }
+
+        return true;
+    }
+
+    template <typename T, std::size_t N>
+    static constexpr auto min_key(const std::array<T, N>& list) -> std::size_t
+    {
+        std::size_t value = list[0].key;
+
+        for (const auto& entry : list)
+        {
+            if (entry.key < value) value = entry.key;
+        }
+
+        return value;
+    }
+
+    template <typename T, std::size_t N>
+    static constexpr auto max_key(const std::array<T, N>& list) -> std::size_t
+    {
+        std::size_t value = list[0].key;
+
+        for (const auto& entry : list)
+        {
+            if (entry.key > value) value = entry.key;
+        }
+
+        return value;
+    }
+
+    // direct index table over [B, B + S), first list entry wins on duplicated keys
+    template <std::size_t B, std::size_t S, typename T, std::size_t N>
+    static constexpr auto dense(const std::array<T, N>& list) -> std::array<const char*, S>
+    {
+        std::array<const char*, S> result {};
+
+        for (auto i = N; i > 0; i--)
+        {
+            result[list[i - 1].key - B] = list[i - 1].value;
+        }
+
+        return result;
+    }
+
+    template <std::size_t B, std::size_t S>
+    static auto find_dense(const std::array<const char*, S>& table, std::size_t key) -> const char*
+    {
+        if (key < B || key - B >= S) return nullptr;
+
+        return table[key - B];
+    }
+
+    // binary search over a list sorted by key
+    template <typename T, std::size_t N>
+    static auto find_key(const std::array<T, N>& list, decltype(T::key) key) -> const T*
+    {
+        const auto itr = std::lower_bound(list.begin(), list.end(), key, [](const T& entry, decltype(T::key) key)
+        {
+            return entry.key < key;
+        });
+
+        if (itr != list.end() && itr->key == key)
+        {
+            return &(*itr);
+        }
+
+        return nullptr;
+    }
+
+    // minimal perfect hash lookup, tables generated by gen/resolver.py
+    template <typename T, std::size_t N, std::size_t S, std::size_t K>
+    static auto find_value(const std::array<T, N>& list, const std::array<std::int32_t, S>& seeds,
+        const std::array<std::uint32_t, K>& slots, std::string_view name, bool lower) -> const T*
+    {
+        const auto& entry = list[slots[slot(seeds, K, name, false)]];
+
+        return equals(entry.value, name, lower) ? &entry : nullptr;
+    }
+
+    // every entry must land on the slot of the first entry with its name and the slots must hold
+    // one entry per name, tables left stale by a list edit without re-running gen/resolver.py fail this
+    template <const auto& list, const auto& seeds, const auto& slots, bool lower>
+    static constexpr auto is_perfect() -> bool
+    {
+        constexpr auto chunks = (list.size() + chunk_size - 1) / chunk_size;
+
+        return slots.size() <= list.size() && count_chunks<list, seeds, slots, lower>(std::make_index_sequence<chunks>()) == slots.size();
+    }
+
+private:
+    static constexpr auto to_lower(char c) -> std::uint8_t
+    {
+        return (c >= 'A' && c <= 'Z') ? static_cast<std::uint8_t>(c - 'A' + 'a') : static_cast<std::uint8_t>(c);
+    }
+
+    static constexpr std::size_t chunk_size = 128;
+
+    // each chunk is counted in a template argument of its own, so it's a separate constant evaluation,
+    // a single pass over the biggest token lists runs past the compilers' operation limits
+    template <const auto& list, const auto& seeds, const auto& slots, bool lower, std::size_t... chunks>
+    static constexpr auto count_chunks(std::index_sequence<chunks...>) -> std::size_t
+    {
+        return (std::integral_constant<std::size_t, count_names(list, seeds, slots, lower, chunks * chunk_size)>::value + ... + 0);
+    }
+
+    // names whose first entry is in the chunk, more than the list holds if an entry is misplaced
+    template <typename T, std::size_t N, std::size_t S, std::size_t K>
+    static constexpr auto count_names(const std::array<T, N>& list, const std::array<std::int32_t, S>& seeds,
+        const std::array<std::uint32_t, K>& slots, bool lower, std::size_t first) -> std::size_t
+    {
+        std::size_t names = 0;
+
+        for (auto i = first; i < first + chunk_size && i < N; i++)
+        {
+            const auto name = std::string_view(list[i].value);
+            const auto pos = slot(seeds, K, name, lower);
+
+            if (pos >= K || slots[pos] > i || !same(list[slots[pos]].value, name, lower)) return N + 1;
+            if (slots[pos] == i) names++;
+        }
+
+        return names;
+    }
+
+    template <std::size_t S>
+    static constexpr auto slot(const std::array<std::int32_t, S>& seeds, std::size_t K, std::string_view name, bool lower) -> std::size_t
+    {
+        const auto seed = seeds[hash(name, 0, lower) % S];
+
+        return (seed < 0) ? static_cast<std::size_t>(-seed - 1) : hash(name, seed, lower) % K;
+    }
+
+    static constexpr auto same(std::string_view a, std::string_view b, bool lower) -> bool
+    {
+        if (a.size() != b.size()) return false;
+
+        for (std::size_t i = 0; i < a.size(); i++)
+        {
+            if ((lower ? to_lower(a[i]) : static_cast<std::uint8_t>(a[i])) != (lower ? to_lower(b[i]) : static_cast<std::uint8_t>(b[i]))) return false;
+        }
+
+        return true;
+    }
+
+    static auto equals(const char* value, std::string_view name, bool lower) -> bool
+    {
+        std::size_t i = 0;
+
+        for (; value[i] != '\0'; i++)
+        {
+            if (i == name.size()) return false;
+
+            const auto c = lower ? static_cast<char>(std::tolower(static_cast<std::uint8_t>(value[i]))) : value[i];
+
+            if (c != name[i]) return false;
+        }
+
+        return i == name.size();
+    }
+};
+
+} // namespace xsk::gsc
@@ -8,20 +8,6 @@
 namespace xsk::gsc::ast
 {
 
-std::uint32_t node::indent_;
-
-void node::reset_indentation()
-{
-    indent_ = 0;
-}
-
-auto node::indented(std::uint32_t indent) -> std::string
-{
-    static char buff[100];
-    snprintf(buff, sizeof(buff), "%*s", indent, "");
-    return std::string(buff);
-}
-
 auto node::is_special_stmt() -> bool
 {
     switch (kind_)
@@ -124,8 +110,8 @@ expr_vector::expr_vector(const location& loc, expr x, expr y, expr z) : node(kin
 expr_color::expr_color(const std::string& value) : node(kind::expr_color), value(value) {}
 expr_color::expr_color(const location& loc, const std::string& value) : node(kind::expr_color, loc), value(value) {}
 
-expr_string::expr_string(const std::string& value) : node(kind::expr_string), value(value) {}
-expr_string::expr_string(const location& loc, const std::string& value) : node(kind::expr_string, loc), value(value) {}
+expr_string::expr_string(const std::string& value) : node(kind::expr_string), value(utils::interner::intern(value).value) {}
+expr_string::expr_string(const location& loc, const std::string& value) : node(kind::expr_string, loc), value(utils::interner::intern(value).value) {}
 
 expr_istring::expr_istring(const std::string& value) : node(kind::expr_istring), value(std::move(value)) {}
 expr_istring::expr_istring(const location& loc, const std::string& value) : node(kind::expr_istring, loc), value(std::move(value)) {}
@@ -135,8 +121,9 @@ expr_path::expr_path(const std::string& value) : node(kind::expr_path), value(va
 expr_path::expr_path(const location& loc) : node(kind::expr_path, loc) {}
 expr_path::expr_path(const location& loc, const std::string& value) : node(kind::expr_path, loc), value(value) {}
 
-expr_identifier::expr_identifier(const std::string& value) : node(kind::expr_identifier), value(value) {}
-expr_identifier::expr_identifier(const location& loc, const std::string& value) : node(kind::expr_identifier, loc), value(value) {}
+expr_identifier::expr_identifier(const std::string& value) : expr_identifier(location(), utils::interner::intern(value)) {}
+expr_identifier::expr_identifier(const location& loc, const std::string& value) : expr_identifier(loc, utils::interner::intern(value)) {}
+expr_identifier::expr_identifier(const location& loc, const utils::interner::entry& entry) : node(kind::expr_identifier, loc), value(entry.value), id(entry.id) {}
 
 expr_animtree::expr_animtree() : node(kind::expr_animtree) {}
 expr_animtree::expr_animtree(const location& loc) : node(kind::expr_animtree, loc) {}
@@ -461,410 +448,512 @@ asm_remove::asm_remove(const location& loc, const std::string& index) : node(kin
 asm_clear::asm_clear(const std::string& index) : node(kind::asm_clear), index(index) {}
 asm_clear::asm_clear(const location& loc, const std::string& index) : node(kind::asm_clear, loc), index(index) {}
 
-auto expr_true::print() const -> std::string
+void expr_true::print(printer& p) const
 {
-    return "true";
+    p << "true";
 }
 
-auto expr_false::print() const -> std::string
+void expr_false::print(printer& p) const
 {
-    return "false";
+    p << "false";
 }
 
-auto expr_integer::print() const -> std::string
+void expr_integer::print(printer& p) const
 {
-    return value;
+    p << value;
 }
 
-auto expr_float::print() const -> std::string
+void expr_float::print(printer& p) const
 {
-    return value;
+    p << value;
 }
 
-auto expr_vector::print() const -> std::string
+void expr_vector::print(printer& p) const
 {
-    return "( "s + x.print() + ", " + y.print() + ", " + z.print() + " )";
+    p << "( ";
+    x.print(p);
+    p << ", ";
+    y.print(p);
+    p << ", ";
+    z.print(p);
+    p << " )";
 }
 
-auto expr_color::print() const -> std::string
+void expr_color::print(printer& p) const
 {
-    return "#"s += value;
+    p << "#" << value;
 }
 
-auto expr_string::print() const -> std::string
+void expr_string::print(printer& p) const
 {
-    return value;
+    p << value;
 }
 
-auto expr_istring::print() const -> std::string
+void expr_istring::print(printer& p) const
 {
-    return "&"s += value;
+    p << "&" << value;
 }
 
-auto expr_path::print() const -> std::string
+void expr_path::print(printer& p) const
 {
-    return value;
+    p << value;
 }
 
-auto expr_identifier::print() const -> std::string
+void expr_identifier::print(printer& p) const
 {
-    return value;
+    p << value;
 }
 
-auto expr_animtree::print() const -> std::string
+void expr_animtree::print(printer& p) const
 {
-    return "#animtree";
+    p << "#animtree";
 }
 
-auto expr_animation::print() const -> std::string
+void expr_animation::print(printer& p) const
 {
-    return "%"s += value;
+    p << "%" << value;
 }
 
-auto expr_level::print() const -> std::string
+void expr_level::print(printer& p) const
 {
-    return "level";
+    p << "level";
 }
 
-auto expr_anim::print() const -> std::string
+void expr_anim::print(printer& p) const
 {
-    return "anim";
+    p << "anim";
 }
 
-auto expr_self::print() const -> std::string
+void expr_self::print(printer& p) const
 {
-    return "self";
+    p << "self";
 }
 
-auto expr_game::print() const -> std::string
+void expr_game::print(printer& p) const
 {
-    return "game";
+    p << "game";
 }
 
-auto expr_undefined::print() const -> std::string
+void expr_undefined::print(printer& p) const
 {
-    return "undefined";
+    p << "undefined";
 }
 
-auto expr_empty_array::print() const -> std::string
+void expr_empty_array::print(printer& p) const
 {
-    return "[]";
+    p << "[]";
 }
 
-auto expr_thisthread::print() const -> std::string
+void expr_thisthread::print(printer& p) const
 {
-    return "thisthread";
+    p << "thisthread";
 }
 
-auto expr_paren::print() const -> std::string
+void expr_paren::print(printer& p) const
 {
-    return "( " + child.print() + " )";
+    p << "( ";
+    child.print(p);
+    p << " )";
 }
 
-auto expr_size::print() const -> std::string
+void expr_size::print(printer& p) const
 {
-    return obj.print() + ".size";
+    obj.print(p);
+    p << ".size";
 }
 
-auto expr_field::print() const -> std::string
+void expr_field::print(printer& p) const
 {
-    return obj.print() + "." + field->print();
+    obj.print(p);
+    p << ".";
+    field->print(p);
 }
 
-auto expr_array::print() const -> std::string
+void expr_array::print(printer& p) const
 {
-    return obj.print() + "[" + key.print() + "]";
+    obj.print(p);
+    p << "[";
+    key.print(p);
+    p << "]";
 }
 
-auto expr_reference::print() const -> std::string
+void expr_reference::print(printer& p) const
 {
-    return path->print() + "::" + name->print();
+    path->print(p);
+    p << "::";
+    name->print(p);
 }
 
-auto expr_istrue::print() const -> std::string
+void expr_istrue::print(printer& p) const
 {
-    return "istrue( " + expr.print() + " )";
+    p << "istrue( ";
+    expr.print(p);
+    p << " )";
 }
 
-auto expr_isdefined::print() const -> std::string
+void expr_isdefined::print(printer& p) const
 {
-    return "isdefined( " + expr.print() + " )";
+    p << "isdefined( ";
+    expr.print(p);
+    p << " )";
 }
 
-auto expr_arguments::print() const -> std::string
+void expr_arguments::print(printer& p) const
 {
-    std::string data;
-
     for (const auto& entry : list)
     {
-        data += " " + entry.print();
-        data += (&entry != &list.back()) ? "," : " ";
+        p << " ";
+        entry.print(p);
+        p << ((&entry != &list.back()) ? "," : " ");
     }
-
-    return data;
 }
 
-auto expr_parameters::print() const -> std::string
+void expr_parameters::print(printer& p) const
 {
-    std::string data;
-
     for (const auto& entry : list)
     {
-        data += " " + entry->print();
-        data += (&entry != &list.back()) ? "," : " ";
+        p << " ";
+        entry->print(p);
+        p << ((&entry != &list.back()) ? "," : " ");
     }
-
-    return data;
 }
 
-auto expr_add_array::print() const -> std::string
+void expr_add_array::print(printer& p) const
 {
-    return "[" + args->print() + "]";
+    p << "[";
+    args->print(p);
+    p << "]";
 }
 
-auto expr_pointer::print() const -> std::string
+void expr_pointer::print(printer& p) const
 {
-    std::string data;
-
     if (mode == call::mode::builtin)
-        data += "call ";
+        p << "call ";
     else if (mode == call::mode::thread)
-        data += "thread ";
+        p << "thread ";
     else if (mode == call::mode::childthread) 
-        data += "childthread ";
+        p << "childthread ";
 
-    return data += "[[ "s + func.print() + " ]](" + args->print() + ")";
+    p << "[[ ";
+    func.print(p);
+    p << " ]](";
+    args->print(p);
+    p << ")";
 }
 
-auto expr_function::print() const -> std::string
+void expr_function::print(printer& p) const
 {
-    std::string data;
-
     if (mode == call::mode::thread)
-        data += "thread ";
+        p << "thread ";
     else if (mode == call::mode::childthread) 
-        data += "childthread ";
+        p << "childthread ";
 
     if (path->value != "")
-        data += path->print() + "::";
+    {
+        path->print(p);
+        p << "::";
+    }
 
-    return data += name->print() + "(" + args->print() + ")";
+    name->print(p);
+    p << "(";
+    args->print(p);
+    p << ")";
 }
 
-auto expr_method::print() const -> std::string
+void expr_method::print(printer& p) const
 {
-    return obj.print() + " " + call.print();
+    obj.print(p);
+    p << " ";
+    call.print(p);
 }
 
-auto expr_call::print() const -> std::string
+void expr_call::print(printer& p) const
 {
-    return call.print();
+    call.print(p);
 }
 
-auto expr_complement::print() const -> std::string
+void expr_complement::print(printer& p) const
 {
-    return "~" + rvalue.print();
+    p << "~";
+    rvalue.print(p);
 }
 
-auto expr_not::print() const -> std::string
+void expr_not::print(printer& p) const
 {
-    return "!" + rvalue.print();
+    p << "!";
+    rvalue.print(p);
 }
 
-auto expr_add::print() const -> std::string
+void expr_add::print(printer& p) const
 {
-    return lvalue.print() + " + " + rvalue.print();
+    lvalue.print(p);
+    p << " + ";
+    rvalue.print(p);
 }
 
-auto expr_sub::print() const -> std::string
+void expr_sub::print(printer& p) const
 {
-    return lvalue.print() + " - " + rvalue.print();
+    lvalue.print(p);
+    p << " - ";
+    rvalue.print(p);
 }
 
-auto expr_mul::print() const -> std::string
+void expr_mul::print(printer& p) const
 {
-    return lvalue.print() + " * " + rvalue.print();
+    lvalue.print(p);
+    p << " * ";
+    rvalue.print(p);
 }
 
-auto expr_div::print() const -> std::string
+void expr_div::print(printer& p) const
 {
-    return lvalue.print() + " / " + rvalue.print();
+    lvalue.print(p);
+    p << " / ";
+    rvalue.print(p);
 }
 
-auto expr_mod::print() const -> std::string
+void expr_mod::print(printer& p) const
 {
-    return lvalue.print() + " % " + rvalue.print();
+    lvalue.print(p);
+    p << " % ";
+    rvalue.print(p);
 }
 
-auto expr_shift_left::print() const -> std::string
+void expr_shift_left::print(printer& p) const
 {
-    return lvalue.print() + " << " + rvalue.print();
+    lvalue.print(p);
+    p << " << ";
+    rvalue.print(p);
 }
 
-auto expr_shift_right::print() const -> std::string
+void expr_shift_right::print(printer& p) const
 {
-    return lvalue.print() + " >> " + rvalue.print();
+    lvalue.print(p);
+    p << " >> ";
+    rvalue.print(p);
 }
 
-auto expr_bitwise_or::print() const -> std::string
+void expr_bitwise_or::print(printer& p) const
 {
-    return lvalue.print() + " | " + rvalue.print();
+    lvalue.print(p);
+    p << " | ";
+    rvalue.print(p);
 }
 
-auto expr_bitwise_and::print() const -> std::string
+void expr_bitwise_and::print(printer& p) const
 {
-    return lvalue.print() + " & " + rvalue.print();
+    lvalue.print(p);
+    p << " & ";
+    rvalue.print(p);
 }
 
-auto expr_bitwise_exor::print() const -> std::string
+void expr_bitwise_exor::print(printer& p) const
 {
-    return lvalue.print() + " ^ " + rvalue.print();
+    lvalue.print(p);
+    p << " ^ ";
+    rvalue.print(p);
 }
 
-auto expr_equality::print() const -> std::string
+void expr_equality::print(printer& p) const
 {
-    return lvalue.print() + " == " + rvalue.print();
+    lvalue.print(p);
+    p << " == ";
+    rvalue.print(p);
 }
 
-auto expr_inequality::print() const -> std::string
+void expr_inequality::print(printer& p) const
 {
-    return lvalue.print() + " != " + rvalue.print();
+    lvalue.print(p);
+    p << " != ";
+    rvalue.print(p);
 }
 
-auto expr_less_equal::print() const -> std::string
+void expr_less_equal::print(printer& p) const
 {
-    return lvalue.print() + " <= " + rvalue.print();
+    lvalue.print(p);
+    p << " <= ";
+    rvalue.print(p);
 }
 
-auto expr_greater_equal::print() const -> std::string
+void expr_greater_equal::print(printer& p) const
 {
-    return lvalue.print() + " >= " + rvalue.print();
+    lvalue.print(p);
+    p << " >= ";
+    rvalue.print(p);
 }
 
-auto expr_less::print() const -> std::string
+void expr_less::print(printer& p) const
 {
-    return lvalue.print() + " < " + rvalue.print();
+    lvalue.print(p);
+    p << " < ";
+    rvalue.print(p);
 }
 
-auto expr_greater::print() const -> std::string
+void expr_greater::print(printer& p) const
 {
-    return lvalue.print() + " > " + rvalue.print();
+    lvalue.print(p);
+    p << " > ";
+    rvalue.print(p);
 }
 
-auto expr_or::print() const -> std::string
+void expr_or::print(printer& p) const
 {
-    return lvalue.print() + " || " + rvalue.print();
+    lvalue.print(p);
+    p << " || ";
+    rvalue.print(p);
 }
 
-auto expr_and::print() const -> std::string
+void expr_and::print(printer& p) const
 {
-    return lvalue.print() + " && " + rvalue.print();
+    lvalue.print(p);
+    p << " && ";
+    rvalue.print(p);
 }
 
-auto expr_ternary::print() const -> std::string
+void expr_ternary::print(printer& p) const
 {
-    return test.print() + " ? " + true_expr.print() + " : " + false_expr.print();
+    test.print(p);
+    p << " ? ";
+    true_expr.print(p);
+    p << " : ";
+    false_expr.print(p);
 }
 
-auto expr_increment::print() const -> std::string
+void expr_increment::print(printer& p) const
 {
-    if (prefix) return "++" + lvalue.print();
-    return lvalue.print() + "++";
+    if (prefix)
+    {
+        p << "++";
+        lvalue.print(p);
+    }
+    else
+    {
+        lvalue.print(p);
+        p << "++";
+    }
 }
 
-auto expr_decrement::print() const -> std::string
+void expr_decrement::print(printer& p) const
 {
-    if (prefix) return "--" + lvalue.print();
-    return lvalue.print() + "--";
+    if (prefix)
+    {
+        p << "--";
+        lvalue.print(p);
+    }
+    else
+    {
+        lvalue.print(p);
+        p << "--";
+    }
 }
 
-auto expr_assign_equal::print() const -> std::string
+void expr_assign_equal::print(printer& p) const
 {
-    return lvalue.print() + " = " + rvalue.print();
-};
+    lvalue.print(p);
+    p << " = ";
+    rvalue.print(p);
+}
 
-auto expr_assign_add::print() const -> std::string
+void expr_assign_add::print(printer& p) const
 {
-    return lvalue.print() + " += " + rvalue.print() ;
-};
+    lvalue.print(p);
+    p << " += ";
+    rvalue.print(p);
+}
 
-auto expr_assign_sub::print() const -> std::string
+void expr_assign_sub::print(printer& p) const
 {
-    return lvalue.print() + " -= " + rvalue.print() ;
-};
+    lvalue.print(p);
+    p << " -= ";
+    rvalue.print(p);
+}
 
-auto expr_assign_mul::print() const -> std::string
+void expr_assign_mul::print(printer& p) const
 {
-    return lvalue.print() + " *= " + rvalue.print() ;
-};
+    lvalue.print(p);
+    p << " *= ";
+    rvalue.print(p);
+}
 
-auto expr_assign_div::print() const -> std::string
+void expr_assign_div::print(printer& p) const
 {
-    return lvalue.print() + " /= " + rvalue.print() ;
-};
+    lvalue.print(p);
+    p << " /= ";
+    rvalue.print(p);
+}
 
-auto expr_assign_mod::print() const -> std::string
+void expr_assign_mod::print(printer& p) const
 {
-    return lvalue.print() + " %= " + rvalue.print() ;
-};
+    lvalue.print(p);
+    p << " %= ";
+    rvalue.print(p);
+}
 
-auto expr_assign_shift_left::print() const -> std::string
+void expr_assign_shift_left::print(printer& p) const
 {
-    return lvalue.print() + " <<= " + rvalue.print() ;
-};
+    lvalue.print(p);
+    p << " <<= ";
+    rvalue.print(p);
+}
 
-auto expr_assign_shift_right::print() const -> std::string
+void expr_assign_shift_right::print(printer& p) const
 {
-    return lvalue.print() + " >>= " + rvalue.print() ;
-};
+    lvalue.print(p);
+    p << " >>= ";
+    rvalue.print(p);
+}
 
-auto expr_assign_bitwise_or::print() const -> std::string
+void expr_assign_bitwise_or::print(printer& p) const
 {
-    return lvalue.print() + " |= " + rvalue.print();
+    lvalue.print(p);
+    p << " |= ";
+    rvalue.print(p);
 }
 
-auto expr_assign_bitwise_and::print() const -> std::string
+void expr_assign_bitwise_and::print(printer& p) const
 {
-    return lvalue.print() + " &= " + rvalue.print();
+    lvalue.print(p);
+    p << " &= ";
+    rvalue.print(p);
 }
 
-auto expr_assign_bitwise_exor::print() const -> std::string
+void expr_assign_bitwise_exor::print(printer& p) const
 {
-    return lvalue.print() + " ^= " + rvalue.print();
+    lvalue.print(p);
+    p << " ^= ";
+    rvalue.print(p);
 }
 
-auto stmt_list::print() const -> std::string
+void stmt_list::print(printer& p) const
 {
     if (is_expr)
     {
         if (list.size() > 0)
         {
-            auto s = list[0].print();
-            s.pop_back();
-            return s;
+            list[0].print(p);
+            p.data.pop_back();
         }
-        else return "";
+
+        return;
     }
 
-    std::string data;
     bool last_special = false;
-    auto block_pad = indented(indent_);
-    indent_ += 4;
-
-    auto stmts_pad = indented(indent_);
 
     if (!is_case)
-        data += block_pad + "{\n";
+        p.pad() << "{\n";
+
+    p.indent += 4;
 
     for (const auto& stmt : list)
     {
         if (&stmt != &list.front() && stmt.as_node->is_special_stmt() || last_special)
-            data += "\n";
+            p << "\n";
 
-        data += stmts_pad + stmt.print();
+        p.pad();
+        stmt.print(p);
 
         if (&stmt != &list.back())
-            data += "\n";
+            p << "\n";
 
         if (stmt.as_node->is_special_stmt())
             last_special = true;
@@ -872,429 +961,507 @@ auto stmt_list::print() const -> std::string
             last_special = false;
     }
 
-    indent_ -= 4;
+    p.indent -= 4;
 
     if (!is_case)
-        data += "\n" + block_pad + "}";
-
-    return data;
+    {
+        p << "\n";
+        p.pad() << "}";
+    }
 }
 
-auto stmt_expr::print() const -> std::string
+void stmt_expr::print(printer& p) const
 {
-    return expr.print();
+    expr.print(p);
 }
 
-auto stmt_call::print() const -> std::string
+void stmt_call::print(printer& p) const
 {
-    return expr.print() + ";";
+    expr.print(p);
+    p << ";";
 };
 
-auto stmt_assign::print() const -> std::string
+void stmt_assign::print(printer& p) const
 {
-    return expr.print() + ";";
+    expr.print(p);
+    p << ";";
 };
 
-auto stmt_endon::print() const -> std::string
+void stmt_endon::print(printer& p) const
 {
-    return obj.print() + " endon( " + event.print() + " );";
+    obj.print(p);
+    p << " endon( ";
+    event.print(p);
+    p << " );";
 };
 
-auto stmt_notify::print() const -> std::string
+void stmt_notify::print(printer& p) const
 {
-    if (args->list.size() == 0)
-        return obj.print() + " notify( " + event.print() + " );"; 
-    else
-        return obj.print() + " notify( " + event.print() + ", " + args->print() + " );";
+    obj.print(p);
+    p << " notify( ";
+    event.print(p);
+
+    if (args->list.size() > 0)
+    {
+        p << ", ";
+        args->print(p);
+    }
+
+    p << " );";
 };
 
-auto stmt_wait::print() const -> std::string
+void stmt_wait::print(printer& p) const
 {
     if (time == kind::expr_float || time == kind::expr_integer)
-        return "wait " + time.print() + ";";
+    {
+        p << "wait ";
+        time.print(p);
+        p << ";";
+    }
     else
-        return "wait(" + time.print() + ");";
+    {
+        p << "wait(";
+        time.print(p);
+        p << ");";
+    }
 };
 
-auto stmt_waittill::print() const -> std::string
+void stmt_waittill::print(printer& p) const
 {
-    if (args->list.size() == 0)
-        return obj.print() + " waittill( " + event.print() + " );";
-    else
-        return obj.print() + " waittill( " + event.print() + ", " + args->print() + " );";
+    obj.print(p);
+    p << " waittill( ";
+    event.print(p);
+
+    if (args->list.size() > 0)
+    {
+        p << ", ";
+        args->print(p);
+    }
+
+    p << " );";
 };
 
-auto stmt_waittillmatch::print() const -> std::string
+void stmt_waittillmatch::print(printer& p) const
 {
-    if (args->list.size() == 0)
-        return obj.print() + " waittillmatch( " + event.print() + " );";
-    else
-        return obj.print() + " waittillmatch( " + event.print() + ", " + args->print() + " );";
+    obj.print(p);
+    p << " waittillmatch( ";
+    event.print(p);
+
+    if (args->list.size() > 0)
+    {
+        p << ", ";
+        args->print(p);
+    }
+
+    p << " );";
 };
 
-auto stmt_waittillframeend::print() const -> std::string
+void stmt_waittillframeend::print(printer& p) const
 {
-    return "waittillframeend;";
+    p << "waittillframeend;";
 };
 
-auto stmt_waitframe::print() const -> std::string
+void stmt_waitframe::print(printer& p) const
 {
-    return "waitframe;";
+    p << "waitframe;";
 };
 
-auto stmt_if::print() const -> std::string
+void stmt_if::print(printer& p) const
 {
-    std::string data = "if ( " + test.print() + " )\n";
+    p << "if ( ";
+    test.print(p);
+    p << " )\n";
 
     if (stmt == kind::stmt_list)
     {
-        data += stmt.as_list->print();
+        stmt.as_list->print(p);
     }
     else
     {
-        indent_ += 4;
-        data += indented(indent_) + stmt.print();
-        indent_ -= 4;
+        p.indent += 4;
+        p.pad();
+        stmt.print(p);
+        p.indent -= 4;
     }
-    
-    return data;
 };
 
-auto stmt_ifelse::print() const -> std::string
+void stmt_ifelse::print(printer& p) const
 {
-    std::string pad = indented(indent_);
-    std::string data = "if ( " + test.print() + " )\n";
+    p << "if ( ";
+    test.print(p);
+    p << " )\n";
 
     if (stmt_if == kind::stmt_list)
     {
-        data += stmt_if.print();
+        stmt_if.print(p);
     }
     else
     {
-        indent_ += 4;
-        data += indented(indent_) + stmt_if.print();
-        indent_ -= 4;
+        p.indent += 4;
+        p.pad();
+        stmt_if.print(p);
+        p.indent -= 4;
     }
 
-    data += "\n" + pad + "else";
+    p << "\n";
+    p.pad() << "else";
 
     if (stmt_else == kind::stmt_list)
     {
-        data += "\n" + stmt_else.as_list->print();
+        p << "\n";
+        stmt_else.as_list->print(p);
     }
     else
     {
         if (stmt_else == kind::stmt_if || stmt_else == kind::stmt_ifelse)
         {
-            data += " " + stmt_else.print();
+            p << " ";
+            stmt_else.print(p);
         }
         else
         {
-            indent_ += 4;
-            data += "\n" + indented(indent_) + stmt_else.print();
-            indent_ -= 4;
+            p.indent += 4;
+            p << "\n";
+            p.pad();
+            stmt_else.print(p);
+            p.indent -= 4;
         }
     }
-    
-    return data;
 };
 
-auto stmt_while::print() const -> std::string
+void stmt_while::print(printer& p) const
 {
-    std::string data;
-
     if (test == kind::null)
     {
-        data += "while ( true )\n";
+        p << "while ( true )\n";
     }
     else
     {
-        data += "while ( " + test.print() + " )\n";
+        p << "while ( ";
+        test.print(p);
+        p << " )\n";
     }
 
-    std::string pad = indented(indent_);
-
     if (stmt == kind::stmt_list)
     {
-        data += stmt.print();
+        stmt.print(p);
     }
     else
     {
-        indent_ += 4;
-        data += indented(indent_) + stmt.print();
-        indent_ -= 4;
+        p.indent += 4;
+        p.pad();
+        stmt.print(p);
+        p.indent -= 4;
     }
-
-    return data;
 };
 
-auto stmt_dowhile::print() const -> std::string
+void stmt_dowhile::print(printer& p) const
 {
-    std::string data;
-
-    data += "do\n";
-
-    std::string pad = indented(indent_);
+    p << "do\n";
 
     if (stmt == kind::stmt_list)
     {
-        data += stmt.print();
+        stmt.print(p);
     }
     else
     {
-        indent_ += 4;
-        data += indented(indent_) + stmt.print();
-        indent_ -= 4;
+        p.indent += 4;
+        p.pad();
+        stmt.print(p);
+        p.indent -= 4;
     }
 
+    p << "\n";
+
     if (test == kind::null)
     {
-        data += "\n" + pad + "while ( true );";
+        p.pad() << "while ( true );";
     }
     else
     {
-        data += "\n" + pad + "while ( " + test.print() + " );";
+        p.pad() << "while ( ";
+        test.print(p);
+        p << " );";
     }
-
-    return data;
 };
 
-auto stmt_for::print() const -> std::string
+void stmt_for::print(printer& p) const
 {
-    std::string data;
-
     if (test == kind::null)
     {
-        data += "for (;;)\n";
+        p << "for (;;)\n";
     }
     else
     {
-        data += "for ( " + init.print() + "; " + test.print() + "; " + iter.print() + " )";
-        data += "\n";
+        p << "for ( ";
+        init.print(p);
+        p << "; ";
+        test.print(p);
+        p << "; ";
+        iter.print(p);
+        p << " )\n";
     }
 
     if (stmt == kind::stmt_list)
     {
-        data += stmt.print();
+        stmt.print(p);
     }
     else
     {
-        indent_ += 4;
-        data += indented(indent_) + stmt.print();
-        indent_ -= 4;
+        p.indent += 4;
+        p.pad();
+        stmt.print(p);
+        p.indent -= 4;
     }
-
-    return data;
 };
 
-auto stmt_foreach::print() const -> std::string
+void stmt_foreach::print(printer& p) const
 {
-    std::string data;
+    p << "foreach ( ";
 
-    data += "foreach ( ";
-    
-    if (use_key) data += key_expr.print() + ", ";
-    
-    data += value_expr.print() + " in " + array_expr.print() + " )\n";
+    if (use_key)
+    {
+        key_expr.print(p);
+        p << ", ";
+    }
+
+    value_expr.print(p);
+    p << " in ";
+    array_expr.print(p);
+    p << " )\n";
 
     if (stmt == kind::stmt_list)
     {
-        data += stmt.print();
+        stmt.print(p);
     }
     else
     {
-        indent_ += 4;
-        data += indented(indent_) + stmt.print();
-        indent_ -= 4;
+        p.indent += 4;
+        p.pad();
+        stmt.print(p);
+        p.indent -= 4;
     }
-
-    return data;
 };
 
-auto stmt_switch::print() const -> std::string
+void stmt_switch::print(printer& p) const
 {
-    std::string data;
-
-    data += "switch ( " + test.print() + " )\n";
-    data += stmt->print();
-
-    return data;
+    p << "switch ( ";
+    test.print(p);
+    p << " )\n";
+    stmt->print(p);
 };
 
-auto stmt_case::print() const -> std::string
+void stmt_case::print(printer& p) const
 {
-    if (stmt != nullptr && stmt->list.size() == 0)
-        return "case " + label.print() + ":";
-    else
-        return "case " + label.print() + ":\n" + stmt->print();
+    p << "case ";
+    label.print(p);
+    p << ":";
+
+    if (stmt == nullptr || stmt->list.size() != 0)
+    {
+        p << "\n";
+        stmt->print(p);
+    }
 };
 
-auto stmt_default::print() const -> std::string
+void stmt_default::print(printer& p) const
 {
-    if (stmt != nullptr && stmt->list.size() == 0)
-        return "default:";
-    else
-        return "default:\n" + stmt->print();
+    p << "default:";
+
+    if (stmt == nullptr || stmt->list.size() != 0)
+    {
+        p << "\n";
+        stmt->print(p);
+    }
 };
 
-auto stmt_break::print() const -> std::string
+void stmt_break::print(printer& p) const
 {
-    return "break;";
+    p << "break;";
 };
 
-auto stmt_continue::print() const -> std::string
+void stmt_continue::print(printer& p) const
 {
-    return "continue;";
+    p << "continue;";
 };
 
-auto stmt_return::print() const -> std::string
+void stmt_return::print(printer& p) const
 {
-    if (expr == kind::null) return "return;";
+    if (expr == kind::null)
+    {
+        p << "return;";
+        return;
+    }
 
-    return "return " + expr.print() + ";";
+    p << "return ";
+    expr.print(p);
+    p << ";";
 };
 
-auto stmt_breakpoint::print() const -> std::string
+void stmt_breakpoint::print(printer& p) const
 {
-    return "breakpoint;";
+    p << "breakpoint;";
 };
 
-auto stmt_prof_begin::print() const -> std::string
+void stmt_prof_begin::print(printer& p) const
 {
-    return "prof_begin(" + args->print() + ");";
+    p << "prof_begin(";
+    args->print(p);
+    p << ");";
 };
 
-auto stmt_prof_end::print() const -> std::string
+void stmt_prof_end::print(printer& p) const
 {
-    return "prof_end(" + args->print() + ");";
+    p << "prof_end(";
+    args->print(p);
+    p << ");";
 };
 
-auto decl_thread::print() const -> std::string
+void decl_thread::print(printer& p) const
 {
-    return name->print() + "(" + params->print() + ")" + "\n" + stmt->print() + "\n";
+    name->print(p);
+    p << "(";
+    params->print(p);
+    p << ")\n";
+    stmt->print(p);
+    p << "\n";
 }
 
-auto decl_constant::print() const -> std::string
+void decl_constant::print(printer& p) const
 {
-    return name->print() + " = "s + value.print() + ";\n";
+    name->print(p);
+    p << " = ";
+    value.print(p);
+    p << ";\n";
 }
 
-auto decl_usingtree::print() const -> std::string
+void decl_usingtree::print(printer& p) const
 {
-    return "#using_animtree"s + "(" + name->print() + ");\n";
+    p << "#using_animtree(";
+    name->print(p);
+    p << ");\n";
 }
 
-auto decl_dev_begin::print() const -> std::string
+void decl_dev_begin::print(printer& p) const
 {
-    return "/#";
+    p << "/#";
 }
 
-auto decl_dev_end::print() const -> std::string
+void decl_dev_end::print(printer& p) const
 {
-    return "#/";
+    p << "#/";
 }
 
-auto include::print() const -> std::string
+void include::print(printer& p) const
 {
-    return "#include"s + " " + path->print() + ";\n";
+    p << "#include ";
+    path->print(p);
+    p << ";\n";
 }
 
 auto program::print() const -> std::string
 {
-    std::string data;
+    printer p;
+    print(p);
+    return std::move(p.data);
+}
 
+void program::print(printer& p) const
+{
     for (const auto& include : includes)
     {
-        data += include->print();
+        include->print(p);
     }
 
     for (const auto& entry : declarations)
     {
         if (entry == kind::decl_thread)
         {
-            data += "\n";
+            p << "\n";
         }
 
-        data += entry.print();
+        entry.print(p);
+        p.flush();
     }
-
-    return data;
 }
 
-auto asm_loc::print() const -> std::string
+void asm_loc::print(printer& p) const
 {
-    return value + ":";
+    p << value << ":";
 }
 
-auto asm_jump::print() const -> std::string
+void asm_jump::print(printer& p) const
 {
-    return "jump " + value;
+    p << "jump " << value;
 }
 
-auto asm_jump_back::print() const -> std::string
+void asm_jump_back::print(printer& p) const
 {
-    return "jump_back " + value;
+    p << "jump_back " << value;
 }
 
-auto asm_jump_cond::print() const -> std::string
+void asm_jump_cond::print(printer& p) const
 {
-    return "jump_cond( " + expr.print() + " ) " + value;
+    p << "jump_cond( ";
+    expr.print(p);
+    p << " ) " << value;
 }
 
-auto asm_jump_true_expr::print() const -> std::string
+void asm_jump_true_expr::print(printer& p) const
 {
-    return "expr_true " + value;
+    p << "expr_true " << value;
 }
 
-auto asm_jump_false_expr::print() const -> std::string
+void asm_jump_false_expr::print(printer& p) const
 {
-    return "expr_false " + value;
+    p << "expr_false " << value;
 }
 
-auto asm_switch::print() const -> std::string
+void asm_switch::print(printer& p) const
 {
-    return "switch( " + expr.print() + " ) " + value;
+    p << "switch( ";
+    expr.print(p);
+    p << " ) " << value;
 }
 
-auto asm_endswitch::print() const -> std::string
+void asm_endswitch::print(printer& p) const
 {
-    std::string result;
+    p << "endswitch( " << count << " )";
 
     for (auto& entry : data)
     {
-        result += " " + entry;
+        p << " " << entry;
     }
-    return "endswitch( " + count + " )" + result;
 }
 
-auto asm_prescriptcall::print() const -> std::string
+void asm_prescriptcall::print(printer& p) const
 {
-    return "prescriptcall";
+    p << "prescriptcall";
 }
 
-auto asm_voidcodepos::print() const -> std::string
+void asm_voidcodepos::print(printer& p) const
 {
-    return "voidcodepos";
+    p << "voidcodepos";
 }
 
-auto asm_create::print() const -> std::string
+void asm_create::print(printer& p) const
 {
-    return "var_create_" + index;
+    p << "var_create_" << index;
 }
 
-auto asm_access::print() const -> std::string
+void asm_access::print(printer& p) const
 {
-    return "var_access_" + index;
+    p << "var_access_" << index;
 }
 
-auto asm_remove::print() const -> std::string
+void asm_remove::print(printer& p) const
 {
-    return "var_remove_" + index;
+    p << "var_remove_" << index;
 }
 
-auto asm_clear::print() const -> std::string
+void asm_clear::print(printer& p) const
 {
-    return "var_clear_" + index;
+    p << "var_clear_" << index;
 }
 
 // operators
@@ -1341,7 +1508,7 @@ bool operator==(const expr_color& lhs, const expr_color& rhs)
 
 bool operator==(const expr_string& lhs, const expr_string& rhs)
 {
-    return lhs.value == rhs.value;
+    return &lhs.value == &rhs.value;
 }
 
 bool operator==(const expr_istring& lhs, const expr_istring& rhs)
@@ -1356,7 +1523,7 @@ bool operator==(const expr_path& lhs, const expr_path& rhs)
 
 bool operator==(const expr_identifier& lhs, const expr_identifier& rhs)
 {
-    return lhs.value == rhs.value;
+    return lhs.id == rhs.id;
 }
 
 bool operator==(const expr_animtree&, const expr_animtree&)
@@ -1461,9 +1628,9 @@ auto call::kind() const -> ast::kind
     return as_node->kind();
 }
 
-auto call::print() const -> std::string
+void call::print(printer& p) const
 {
-    return as_node->print();
+    as_node->print(p);
 }
 
 expr::expr() : as_node(nullptr) {}
@@ -1612,9 +1779,9 @@ auto expr::kind() const -> ast::kind
     return as_node->kind();
 }
 
-auto expr::print() const -> std::string
+void expr::print(printer& p) const
 {
-    return as_node->print();
+    as_node->print(p);
 }
 
 stmt::stmt() : as_node(nullptr) {}
@@ -1694,9 +1861,9 @@ auto stmt::kind() const -> ast::kind
     return as_node->kind();
 }
 
-auto stmt::print() const -> std::string
+void stmt::print(printer& p) const
 {
-    return as_node->print();
+    as_node->print(p);
 }
 
 decl::decl() : as_node(nullptr) {}
@@ -1745,9 +1912,9 @@ auto decl::kind() const -> ast::kind
     return as_node->kind();
 }
 
-auto decl::print() const -> std::string
+void decl::print(printer& p) const
 {
-    return as_node->print();
+    as_node->print(p);
 }
 
 } // namespace xsk::gsc::ast
@@ -128,6 +128,27 @@ enum class kind
     asm_clear,
 };
 
+struct printer
+{
+    std::uint32_t indent;
+    std::string data;
+    std::ostream* stream;
+
+    printer() : indent(0), stream(nullptr) {}
+    printer(std::ostream& stream) : indent(0), stream(&stream) {}
+    auto operator<<(std::string_view value) -> printer& { data.append(value); return *this; }
+    auto pad() -> printer& { data.append(indent, ' '); return *this; }
+
+    // moves the pending text to the stream, only call between complete statements
+    void flush()
+    {
+        if (stream == nullptr) return;
+
+        stream->write(data.data(), data.size());
+        data.clear();
+    }
+};
+
 struct node;
 struct expr_true;
 struct expr_false;
@@ -262,7 +283,7 @@ union call
     friend bool operator==(const call& lhs, kind rhs);
     auto loc() const -> location;
     auto kind() const -> ast::kind;
-    auto print() const -> std::string;
+    void print(printer& p) const;
 };
 
 union expr
@@ -352,7 +373,7 @@ union expr
     friend bool operator==(const expr& lhs, const expr& rhs);
     auto loc() const -> location;
     auto kind() const -> ast::kind;
-    auto print() const -> std::string;
+    void print(printer& p) const;
 };
 
 union stmt
@@ -405,7 +426,7 @@ union stmt
     friend bool operator==(const stmt& lhs, kind rhs);
     auto loc() const -> location;
     auto kind() const -> ast::kind;
-    auto print() const -> std::string;
+    void print(printer& p) const;
 };
 
 union decl
@@ -427,7 +448,7 @@ union decl
     friend bool operator==(const decl& lhs, kind rhs);
     auto loc() const -> location;
     auto kind() const -> ast::kind;
-    auto print() const -> std::string;
+    void print(printer& p) const;
 };
 
 struct node
@@ -445,7 +466,13 @@ public:
     node(kind type, const location& loc) : kind_(type), loc_(loc) {}
 
     virtual ~node() = default;
-    virtual auto print() const -> std::string { return ""; };
+    virtual void print(printer&) const {};
+
+    // nodes own strings and child lists and are destroyed one by one through their unique_ptr,
+    // the pool only serves their blocks from per-thread chunks
+    static auto operator new(std::size_t size) -> void* { return utils::node_pool::allocate(size); }
+    static void operator delete(void* ptr, std::size_t size) { utils::node_pool::deallocate(ptr, size); }
+
     friend bool operator==(const node& n, kind k);
     friend bool operator==(const node& lhs, const node& rhs);
 
@@ -456,11 +483,6 @@ public:
     auto is_special_stmt_noif() -> bool;
     auto is_binary() -> bool;
     auto precedence() -> std::uint8_t;
-
-protected:
-    static std::uint32_t indent_;
-    static void reset_indentation();
-    static std::string indented(std::uint32_t indent); 
 };
 
 struct expr_true : public node
@@ -469,7 +491,7 @@ struct expr_true : public node
 
     expr_true();
     expr_true(const location& loc);
-    auto print() const -> std::string override;
+    void print(printer& p) const override;
     friend bool operator==(const expr_true&, const expr_true&);
 };
 
@@ -479,7 +501,7 @@ struct expr_false : public node
 
     expr_false();
     expr_false(const location& loc);
-    auto print() const -> std::string override;
+    void print(printer& p) const override;
     friend bool operator==(const expr_false&, const expr_false&);
 };
 
@@ -491,7 +513,7 @@ struct expr_integer : public node
 
     expr_integer(const std::string& value);
     expr_integer(const location& loc, const std::string& value);
-    auto print() const -> std::string override;
+    void print(printer& p) const override;
     friend bool operator==(const expr_integer& lhs, const expr_integer& rhs);
 };
 
@@ -503,7 +525,7 @@ struct expr_float : public node
 
     expr_float(const std::string& value);
     expr_float(const location& loc, const std::string& value);
-    auto print() const -> std::string override;
+    void print(printer& p) const override;
     friend bool operator==(const expr_float& lhs, const expr_float& rhs);
 };
 
@@ -517,7 +539,7 @@ struct expr_vector : public node
 
     expr_vector(expr x, expr y, expr z);
     expr_vector(const location& loc, expr x, expr y, expr z);
-    auto print() const -> std::string override;
+    void print(printer& p) const override;
     friend bool operator==(const expr_vector& lhs, const expr_vector& rhs);
 };
 
@@ -529,7 +551,7 @@ struct expr_color : public node
 
     expr_color(const std::string& value);
     expr_color(const location& loc, const std::string& value);
-    auto print() const -> std::string override;
+    void print(printer& p) const override;
     friend bool operator==(const expr_color& lhs, const expr_color& rhs);
 };
 
@@ -537,11 +559,11 @@ struct expr_string : public node
 {
     using ptr = std::unique_ptr<expr_string>;
 
-    std::string value;
+    const std::string& value;
 
     expr_string(const std::string& value);
     expr_string(const location& loc, const std::string& value);
-    auto print() const -> std::string override;
+    void print(printer& p) const override;
     friend bool operator==(const expr_string& lhs, const expr_string& rhs);
 };
 
@@ -553,7 +575,7 @@ struct expr_istring : public node
 
     expr_istring(const std::string& value);
     expr_istring(const location& loc, const std::string& value);
-    auto print() const -> std::string override;
+    void print(printer& p) const override;
     friend bool operator==(const expr_istring& lhs, const expr_istring& rhs);
 };
 
@@ -567,7 +589,7 @@ struct expr_path : public node
     expr_path(const std::string& value);
     expr_path(const location& loc);
     expr_path(const location& loc, const std::string& value);
-    auto print() const -> std::string override;
+    void print(printer& p) const override;
     friend bool operator==(const expr_path& lhs, const expr_path& rhs);
 };
 
@@ -575,11 +597,13 @@ struct expr_identifier : public node
 {
     using ptr = std::unique_ptr<expr_identifier>;
 
-    std::string value;
+    const std::string& value;
+    utils::interner::handle id;
 
     expr_identifier(const std::string& value);
     expr_identifier(const location& loc, const std::string& value);
-    auto print() const -> std::string override;
+    expr_identifier(const location& loc, const utils::interner::entry& entry);
+    void print(printer& p) const override;
     friend bool operator==(const expr_identifier& lhs, const expr_identifier& rhs);
 };
 
@@ -589,7 +613,7 @@ struct expr_animtree : public node
 
     expr_animtree();
     expr_animtree(const location& loc);
-    auto print() const -> std::string override;
+    void print(printer& p) const override;
     friend bool operator==(const expr_animtree& lhs, const expr_animtree& rhs);
 };
 
@@ -601,7 +625,7 @@ struct expr_animation : public node
 
     expr_animation(const std::string& value);
     expr_animation(const location& loc, const std::string& value);
-    auto print() const -> std::string override;
+    void print(printer& p) const override;
     friend bool operator==(const expr_animation& lhs, const expr_animation& rhs);
 };
 
@@ -611,7 +635,7 @@ struct expr_level : public node
 
     expr_level();
     expr_level(const location& loc);
-    auto print() const -> std::string override;
+    void print(printer& p) const override;
     friend bool operator==(const expr_level& lhs, const expr_level& rhs);
 };
 
@@ -621,7 +645,7 @@ struct expr_anim : public node
 
     expr_anim();
     expr_anim(const location& loc);
-    auto print() const -> std::string override;
+    void print(printer& p) const override;
     friend bool operator==(const expr_anim& lhs, const expr_anim& rhs);
 };
 
@@ -631,7 +655,7 @@ struct expr_self : public node
 
     expr_self();
     expr_self(const location& loc);
-    auto print() const -> std::string override;
+    void print(printer& p) const override;
     friend bool operator==(const expr_self& lhs, const expr_self& rhs);
 };
 
@@ -641,7 +665,7 @@ struct expr_game : public node
 
     expr_game();
     expr_game(const location& loc);
-    auto print() const -> std::string override;
+    void print(printer& p) const override;
     friend bool operator==(const expr_game& lhs, const expr_game& rhs);
 };
 
@@ -651,7 +675,7 @@ struct expr_undefined : public node
 
     expr_undefined();
     expr_undefined(const location& loc);
-    auto print() const -> std::string override;
+    void print(printer& p) const override;
     friend bool operator==(const expr_undefined& lhs, const expr_undefined& rhs);
 };
 
@@ -661,7 +685,7 @@ struct expr_empty_array : public node
 
     expr_empty_array();
     expr_empty_array(const location& loc);
-    auto print() const -> std::string override;
+    void print(printer& p) const override;
     friend bool operator==(const expr_empty_array& lhs, const expr_empty_array& rhs);
 };
 
@@ -671,7 +695,7 @@ struct expr_thisthread : public node
 
     expr_thisthread();
     expr_thisthread(const location& loc);
-    auto print() const -> std::string override;
+    void print(printer& p) const override;
     friend bool operator==(const expr_thisthread& lhs, const expr_thisthread& rhs);
 };
 
@@ -683,7 +707,7 @@ struct expr_paren : public node
 
     expr_paren(expr expr);
     expr_paren(const location& loc, expr expr);
-    auto print() const -> std::string override;
+    void print(printer& p) const override;
     friend bool operator==(const expr_paren& lhs, const expr_paren& rhs);
 };
 
@@ -695,7 +719,7 @@ struct expr_size : public node
 
     expr_size(expr obj);
     expr_size(const location& loc, expr obj);
-    auto print() const -> std::string override;
+    void print(printer& p) const override;
     friend bool operator==(const expr_size& lhs, const expr_size& rhs);
 };
 
@@ -708,7 +732,7 @@ struct expr_field : public node
 
     expr_field(expr obj, expr_identifier::ptr field);
     expr_field(const location& loc, expr obj, expr_identifier::ptr field);
-    auto print() const -> std::string override;
+    void print(printer& p) const override;
     friend bool operator==(const expr_field& lhs, const expr_field& rhs);
 };
 
@@ -721,7 +745,7 @@ struct expr_array : public node
 
     expr_array(expr obj, expr key);
     expr_array(const location& loc, expr obj, expr key);
-    auto print() const -> std::string override;
+    void print(printer& p) const override;
     friend bool operator==(const expr_array& lhs, const expr_array& rhs);
 };
 
@@ -734,7 +758,7 @@ struct expr_reference : public node
 
     expr_reference(expr_path::ptr path, expr_identifier::ptr name);
     expr_reference(const location& loc, expr_path::ptr path, expr_identifier::ptr name);
-    auto print() const -> std::string override;
+    void print(printer& p) const override;
 };
 
 struct expr_istrue : public node
@@ -745,7 +769,7 @@ struct expr_istrue : public node
 
     expr_istrue(ast::expr expr);
     expr_istrue(const location& loc, ast::expr expr);
-    auto print() const -> std::string override;
+    void print(printer& p) const override;
 };
 
 struct expr_isdefined : public node
@@ -756,7 +780,7 @@ struct expr_isdefined : public node
 
     expr_isdefined(ast::expr expr);
     expr_isdefined(const location& loc, ast::expr expr);
-    auto print() const -> std::string override;
+    void print(printer& p) const override;
 };
 
 struct expr_arguments : public node
@@ -767,7 +791,7 @@ struct expr_arguments : public node
 
     expr_arguments();
     expr_arguments(const location& loc);
-    auto print() const -> std::string override;
+    void print(printer& p) const override;
 };
 
 struct expr_parameters : public node
@@ -778,7 +802,7 @@ struct expr_parameters : public node
 
     expr_parameters();
     expr_parameters(const location& loc);
-    auto print() const -> std::string override;
+    void print(printer& p) const override;
 };
 
 struct expr_add_array : public node
@@ -789,7 +813,7 @@ struct expr_add_array : public node
 
     expr_add_array(expr_arguments::ptr args);
     expr_add_array(const location& loc, expr_arguments::ptr args);
-    auto print() const -> std::string override;
+    void print(printer& p) const override;
 };
 
 struct expr_pointer : public node
@@ -802,7 +826,7 @@ struct expr_pointer : public node
 
     expr_pointer(expr func, expr_arguments::ptr args, call::mode mode);
     expr_pointer(const location& loc, expr func, expr_arguments::ptr args, call::mode mode);
-    auto print() const -> std::string override;
+    void print(printer& p) const override;
 };
 
 struct expr_function : public node
@@ -816,7 +840,7 @@ struct expr_function : public node
 
     expr_function(expr_path::ptr path, expr_identifier::ptr name, expr_arguments::ptr args, call::mode mode);
     expr_function(const location& loc, expr_path::ptr path, expr_identifier::ptr name, expr_arguments::ptr args, call::mode mode);
-    auto print() const -> std::string override;
+    void print(printer& p) const override;
 };
 
 struct expr_method : public node
@@ -828,7 +852,7 @@ struct expr_method : public node
 
     expr_method(expr obj, ast::call call);
     expr_method(const location& loc, expr obj, ast::call call);
-    auto print() const -> std::string override;
+    void print(printer& p) const override;
 };
 
 struct expr_call : public node
@@ -839,7 +863,7 @@ struct expr_call : public node
 
     expr_call(ast::call call);
     expr_call(const location& loc, ast::call call);
-    auto print() const -> std::string override;
+    void print(printer& p) const override;
 };
 
 struct expr_complement : public node
@@ -850,7 +874,7 @@ struct expr_complement : public node
 
     expr_complement(expr rvalue);
     expr_complement(const location& loc, expr rvalue);
-    auto print() const -> std::string override;
+    void print(printer& p) const override;
 };
 
 struct expr_not : public node
@@ -861,7 +885,7 @@ struct expr_not : public node
 
     expr_not(expr rvalue);
     expr_not(const location& loc, expr rvalue);
-    auto print() const -> std::string override;
+    void print(printer& p) const override;
 };
 
 struct expr_binary : public node
@@ -873,7 +897,7 @@ struct expr_binary : public node
 
     expr_binary(ast::kind kind, expr lvalue, expr rvalue);
     expr_binary(ast::kind kind, const location& loc, expr lvalue, expr rvalue);
-    virtual auto print() const -> std::string = 0;
+    virtual void print(printer& p) const = 0;
 };
 
 struct expr_add : public expr_binary
@@ -882,7 +906,7 @@ struct expr_add : public expr_binary
 
     expr_add(expr lvalue, expr rvalue);
     expr_add(const location& loc, expr lvalue, expr rvalue);
-    auto print() const -> std::string override;
+    void print(printer& p) const override;
 };
 
 struct expr_sub : public expr_binary
@@ -891,7 +915,7 @@ struct expr_sub : public expr_binary
 
     expr_sub(expr lvalue, expr rvalue);
     expr_sub(const location& loc, expr lvalue, expr rvalue);
-    auto print() const -> std::string override;
+    void print(printer& p) const override;
 };
 
 struct expr_mul : public expr_binary
@@ -900,7 +924,7 @@ struct expr_mul : public expr_binary
 
     expr_mul(expr lvalue, expr rvalue);
     expr_mul(const location& loc, expr lvalue, expr rvalue);
-    auto print() const -> std::string override;
+    void print(printer& p) const override;
 };
 
 struct expr_div : public expr_binary
@@ -909,7 +933,7 @@ struct expr_div : public expr_binary
 
     expr_div(expr lvalue, expr rvalue);
     expr_div(const location& loc, expr lvalue, expr rvalue);
-    auto print() const -> std::string override;
+    void print(printer& p) const override;
 };
 
 struct expr_mod : public expr_binary
@@ -918,7 +942,7 @@ struct expr_mod : public expr_binary
 
     expr_mod(expr lvalue, expr rvalue);
     expr_mod(const location& loc, expr lvalue, expr rvalue);
-    auto print() const -> std::string override;
+    void print(printer& p) const override;
 };
 
 struct expr_shift_left : public expr_binary
@@ -927,7 +951,7 @@ struct expr_shift_left : public expr_binary
 
     expr_shift_left(expr lvalue, expr rvalue);
     expr_shift_left(const location& loc, expr lvalue, expr rvalue);
-    auto print() const -> std::string override;
+    void print(printer& p) const override;
 };
 
 struct expr_shift_right : public expr_binary
@@ -936,7 +960,7 @@ struct expr_shift_right : public expr_binary
 
     expr_shift_right(expr lvalue, expr rvalue);
     expr_shift_right(const location& loc, expr lvalue, expr rvalue);
-    auto print() const -> std::string override;
+    void print(printer& p) const override;
 };
 
 struct expr_bitwise_or : public expr_binary
@@ -945,7 +969,7 @@ struct expr_bitwise_or : public expr_binary
 
     expr_bitwise_or(expr lvalue, expr rvalue);
     expr_bitwise_or(const location& loc, expr lvalue, expr rvalue);
-    auto print() const -> std::string override;
+    void print(printer& p) const override;
 };
 
 struct expr_bitwise_and : public expr_binary
@@ -954,7 +978,7 @@ struct expr_bitwise_and : public expr_binary
 
     expr_bitwise_and(expr lvalue, expr rvalue);
     expr_bitwise_and(const location& loc, expr lvalue, expr rvalue);
-    auto print() const -> std::string override;
+    void print(printer& p) const override;
 };
 
 struct expr_bitwise_exor : public expr_binary
@@ -963,7 +987,7 @@ struct expr_bitwise_exor : public expr_binary
 
     expr_bitwise_exor(expr lvalue, expr rvalue);
     expr_bitwise_exor(const location& loc, expr lvalue, expr rvalue);
-    auto print() const -> std::string override;
+    void print(printer& p) const override;
 };
 
 struct expr_equality : public expr_binary
@@ -972,7 +996,7 @@ struct expr_equality : public expr_binary
 
     expr_equality(expr lvalue, expr rvalue);
     expr_equality(const location& loc, expr lvalue, expr rvalue);
-    auto print() const -> std::string override;
+    void print(printer& p) const override;
 };
 
 struct expr_inequality : public expr_binary
@@ -981,7 +1005,7 @@ struct expr_inequality : public expr_binary
 
     expr_inequality(expr lvalue, expr rvalue);
     expr_inequality(const location& loc, expr lvalue, expr rvalue);
-    auto print() const -> std::string override;
+    void print(printer& p) const override;
 };
 
 struct expr_less_equal : public expr_binary
@@ -990,7 +1014,7 @@ struct expr_less_equal : public expr_binary
 
     expr_less_equal(expr lvalue, expr rvalue);
     expr_less_equal(const location& loc, expr lvalue, expr rvalue);
-    auto print() const -> std::string override;
+    void print(printer& p) const override;
 };
 
 struct expr_greater_equal : public expr_binary
@@ -999,7 +1023,7 @@ struct expr_greater_equal : public expr_binary
 
     expr_greater_equal(expr lvalue, expr rvalue);
     expr_greater_equal(const location& loc, expr lvalue, expr rvalue);
-    auto print() const -> std::string override;
+    void print(printer& p) const override;
 };
 
 struct expr_less : public expr_binary
@@ -1008,7 +1032,7 @@ struct expr_less : public expr_binary
 
     expr_less(expr lvalue, expr rvalue);
     expr_less(const location& loc, expr lvalue, expr rvalue);
-    auto print() const -> std::string override;
+    void print(printer& p) const override;
 };
 
 struct expr_greater : public expr_binary
@@ -1017,7 +1041,7 @@ struct expr_greater : public expr_binary
 
     expr_greater(expr lvalue, expr rvalue);
     expr_greater(const location& loc, expr lvalue, expr rvalue);
-    auto print() const -> std::string override;
+    void print(printer& p) const override;
 };
 
 struct expr_or : public expr_binary
@@ -1026,7 +1050,7 @@ struct expr_or : public expr_binary
 
     expr_or(expr lvalue, expr rvalue);
     expr_or(const location& loc, expr lvalue, expr rvalue);
-    auto print() const -> std::string override;
+    void print(printer& p) const override;
 };
 
 struct expr_and : public expr_binary
@@ -1035,7 +1059,7 @@ struct expr_and : public expr_binary
 
     expr_and(expr lvalue, expr rvalue);
     expr_and(const location& loc, expr lvalue, expr rvalue);
-    auto print() const -> std::string override;
+    void print(printer& p) const override;
 };
 
 struct expr_ternary : public node
@@ -1048,7 +1072,7 @@ struct expr_ternary : public node
 
     expr_ternary(expr test, expr true_expr, expr false_expr);
     expr_ternary(const location& loc, expr test, expr true_expr, expr false_expr);
-    auto print() const -> std::string override;
+    void print(printer& p) const override;
 };
 
 struct expr_increment : node
@@ -1060,7 +1084,7 @@ struct expr_increment : node
 
     expr_increment(expr lvalue, bool prefix);
     expr_increment(const location& loc, expr lvalue, bool prefix);
-    auto print() const -> std::string override;
+    void print(printer& p) const override;
 };
 
 struct expr_decrement : node
@@ -1072,7 +1096,7 @@ struct expr_decrement : node
 
     expr_decrement(expr lvalue, bool prefix);
     expr_decrement(const location& loc, expr lvalue, bool prefix);
-    auto print() const -> std::string override;
+    void print(printer& p) const override;
 };
 
 struct expr_assign : public node
@@ -1084,7 +1108,7 @@ struct expr_assign : public node
 
     expr_assign(ast::kind kind, expr lvalue, expr rvalue);
     expr_assign(ast::kind kind, const location& loc, expr lvalue, expr rvalue);
-    virtual auto print() const -> std::string = 0;
+    virtual void print(printer& p) const = 0;
 };
 
 struct expr_assign_equal : public expr_assign
@@ -1093,7 +1117,7 @@ struct expr_assign_equal : public expr_assign
 
     expr_assign_equal(expr lvalue, expr rvalue);
     expr_assign_equal(const location& loc, expr lvalue, expr rvalue);
-    auto print() const -> std::string override;
+    void print(printer& p) const override;
 };
 
 struct expr_assign_add : public expr_assign
@@ -1102,7 +1126,7 @@ struct expr_assign_add : public expr_assign
 
     expr_assign_add(expr lvalue, expr rvalue);
     expr_assign_add(const location& loc, expr lvalue, expr rvalue);
-    auto print() const -> std::string override;
+    void print(printer& p) const override;
 };
 
 struct expr_assign_sub : public expr_assign
@@ -1111,7 +1135,7 @@ struct expr_assign_sub : public expr_assign
 
     expr_assign_sub(expr lvalue, expr rvalue);
     expr_assign_sub(const location& loc, expr lvalue, expr rvalue);
-    auto print() const -> std::string override;
+    void print(printer& p) const override;
 };
 
 struct expr_assign_mul : public expr_assign
@@ -1120,7 +1144,7 @@ struct expr_assign_mul : public expr_assign
 
     expr_assign_mul(expr lvalue, expr rvalue);
     expr_assign_mul(const location& loc, expr lvalue, expr rvalue);
-    auto print() const -> std::string override;
+    void print(printer& p) const override;
 };
 
 struct expr_assign_div : public expr_assign
@@ -1129,7 +1153,7 @@ struct expr_assign_div : public expr_assign
 
     expr_assign_div(expr lvalue, expr rvalue);
     expr_assign_div(const location& loc, expr lvalue, expr rvalue);
-    auto print() const -> std::string override;
+    void print(printer& p) const override;
 };
 
 struct expr_assign_mod : public expr_assign
@@ -1138,7 +1162,7 @@ struct expr_assign_mod : public expr_assign
 
     expr_assign_mod(expr lvalue, expr rvalue);
     expr_assign_mod(const location& loc, expr lvalue, expr rvalue);
-    auto print() const -> std::string override;
+    void print(printer& p) const override;
 };
 
 struct expr_assign_shift_left : public expr_assign
@@ -1147,7 +1171,7 @@ struct expr_assign_shift_left : public expr_assign
 
     expr_assign_shift_left(expr lvalue, expr rvalue);
     expr_assign_shift_left(const location& loc, expr lvalue, expr rvalue);
-    auto print() const -> std::string override;
+    void print(printer& p) const override;
 };
 
 struct expr_assign_shift_right : public expr_assign
@@ -1156,7 +1180,7 @@ struct expr_assign_shift_right : public expr_assign
 
     expr_assign_shift_right(expr lvalue, expr rvalue);
     expr_assign_shift_right(const location& loc, expr lvalue, expr rvalue);
-    auto print() const -> std::string override;
+    void print(printer& p) const override;
 };
 
 struct expr_assign_bitwise_or : public expr_assign
@@ -1165,7 +1189,7 @@ struct expr_assign_bitwise_or : public expr_assign
 
     expr_assign_bitwise_or(expr lvalue, expr rvalue);
     expr_assign_bitwise_or(const location& loc, expr lvalue, expr rvalue);
-    auto print() const -> std::string override;
+    void print(printer& p) const override;
 };
 
 struct expr_assign_bitwise_and : public expr_assign
@@ -1174,7 +1198,7 @@ struct expr_assign_bitwise_and : public expr_assign
 
     expr_assign_bitwise_and(expr lvalue, expr rvalue);
     expr_assign_bitwise_and(const location& loc, expr lvalue, expr rvalue);
-    auto print() const -> std::string override;
+    void print(printer& p) const override;
 };
 
 struct expr_assign_bitwise_exor : public expr_assign
@@ -1183,7 +1207,7 @@ struct expr_assign_bitwise_exor : public expr_assign
 
     expr_assign_bitwise_exor(expr lvalue, expr rvalue);
     expr_assign_bitwise_exor(const location& loc, expr lvalue, expr rvalue);
-    auto print() const -> std::string override;
+    void print(printer& p) const override;
 };
 
 struct stmt_list : public node
@@ -1196,7 +1220,7 @@ struct stmt_list : public node
 
     stmt_list();
     stmt_list(const location& loc);
-    auto print() const -> std::string override;
+    void print(printer& p) const override;
 };
 
 struct stmt_expr : public node
@@ -1207,7 +1231,7 @@ struct stmt_expr : public node
 
     stmt_expr(ast::expr expr);
     stmt_expr(const location& loc, ast::expr expr);
-    auto print() const -> std::string override;
+    void print(printer& p) const override;
 };
 
 struct stmt_call : public node
@@ -1218,7 +1242,7 @@ struct stmt_call : public node
 
     stmt_call(ast::expr expr);
     stmt_call(const location& loc, ast::expr expr);
-    auto print() const -> std::string override;
+    void print(printer& p) const override;
 };
 
 struct stmt_assign : public node
@@ -1229,7 +1253,7 @@ struct stmt_assign : public node
 
     stmt_assign(ast::expr expr);
     stmt_assign(const location& loc, ast::expr expr);
-    auto print() const -> std::string override;
+    void print(printer& p) const override;
 };
 
 struct stmt_endon : public node
@@ -1241,7 +1265,7 @@ struct stmt_endon : public node
 
     stmt_endon(expr obj, expr event);
     stmt_endon(const location& loc, expr obj, expr event);
-    auto print() const -> std::string override;
+    void print(printer& p) const override;
 };
 
 struct stmt_notify : public node
@@ -1254,7 +1278,7 @@ struct stmt_notify : public node
 
     stmt_notify(expr obj, expr event, expr_arguments::ptr args);
     stmt_notify(const location& loc, expr obj, expr event, expr_arguments::ptr args);
-    auto print() const -> std::string override;
+    void print(printer& p) const override;
 };
 
 struct stmt_wait : public node
@@ -1265,7 +1289,7 @@ struct stmt_wait : public node
 
     stmt_wait(expr time);
     stmt_wait(const location& loc, expr time);
-    auto print() const -> std::string override;
+    void print(printer& p) const override;
 };
 
 struct stmt_waittill : public node
@@ -1278,7 +1302,7 @@ struct stmt_waittill : public node
 
     stmt_waittill(expr obj, expr event, expr_arguments::ptr params);
     stmt_waittill(const location& loc, expr obj, expr event, expr_arguments::ptr args);
-    auto print() const -> std::string override;
+    void print(printer& p) const override;
 };
 
 struct stmt_waittillmatch : public node
@@ -1291,7 +1315,7 @@ struct stmt_waittillmatch : public node
 
     stmt_waittillmatch(expr obj, expr event, expr_arguments::ptr args);
     stmt_waittillmatch(const location& loc, expr obj, expr expr, expr_arguments::ptr args);
-    auto print() const -> std::string override;
+    void print(printer& p) const override;
 };
 
 struct stmt_waittillframeend : public node
@@ -1301,7 +1325,7 @@ struct stmt_waittillframeend : public node
     stmt_waittillframeend();
     stmt_waittillframeend(const location& loc);
 
-    auto print() const -> std::string override;
+    void print(printer& p) const override;
 };
 
 struct stmt_waitframe : public node
@@ -1310,7 +1334,7 @@ struct stmt_waitframe : public node
 
     stmt_waitframe();
     stmt_waitframe(const location& loc);
-    auto print() const -> std::string override;
+    void print(printer& p) const override;
 };
 
 struct stmt_if : public node
@@ -1323,7 +1347,7 @@ struct stmt_if : public node
 
     stmt_if(expr test, ast::stmt stmt);
     stmt_if(const location& loc, expr test, ast::stmt stmt);
-    auto print() const -> std::string override;
+    void print(printer& p) const override;
 };
 
 struct stmt_ifelse : public node
@@ -1338,7 +1362,7 @@ struct stmt_ifelse : public node
 
     stmt_ifelse(expr test, stmt stmt_if, stmt stmt_else);
     stmt_ifelse(const location& loc, expr test, stmt stmt_if, stmt stmt_else);
-    auto print() const -> std::string override;
+    void print(printer& p) const override;
 };
 
 struct stmt_while : public node
@@ -1351,7 +1375,7 @@ struct stmt_while : public node
 
     stmt_while(expr test, ast::stmt stmt);
     stmt_while(const location& loc, expr test, ast::stmt stmt);
-    auto print() const -> std::string override;
+    void print(printer& p) const override;
 };
 
 struct stmt_dowhile : public node
@@ -1364,7 +1388,7 @@ struct stmt_dowhile : public node
 
     stmt_dowhile(expr test, ast::stmt stmt);
     stmt_dowhile(const location& loc, expr test, ast::stmt stmt);
-    auto print() const -> std::string override;
+    void print(printer& p) const override;
 };
 
 struct stmt_for : public node
@@ -1381,7 +1405,7 @@ struct stmt_for : public node
 
     stmt_for(ast::stmt init, expr test, ast::stmt iter, ast::stmt stmt);
     stmt_for(const location& loc, ast::stmt init, expr test, ast::stmt iter, ast::stmt stmt);
-    auto print() const -> std::string override;
+    void print(printer& p) const override;
 };
 
 struct stmt_foreach : public node
@@ -1407,7 +1431,7 @@ struct stmt_foreach : public node
     stmt_foreach(ast::expr key, ast::expr element, ast::expr container, ast::stmt stmt);
     stmt_foreach(const location& loc, ast::expr element, ast::expr container, ast::stmt stmt);
     stmt_foreach(const location& loc, ast::expr key, ast::expr element, ast::expr container, ast::stmt stmt);
-    auto print() const -> std::string override;
+    void print(printer& p) const override;
 };
 
 struct stmt_switch : public node
@@ -1420,7 +1444,7 @@ struct stmt_switch : public node
 
     stmt_switch(expr test, stmt_list::ptr stmt);
     stmt_switch(const location& loc, expr test, stmt_list::ptr stmt);
-    auto print() const -> std::string override;
+    void print(printer& p) const override;
 };
 
 struct stmt_case : public node
@@ -1434,7 +1458,7 @@ struct stmt_case : public node
     stmt_case(expr label);
     stmt_case(const location& loc, expr label);
     stmt_case(const location& loc, expr label, stmt_list::ptr stmt);
-    auto print() const -> std::string override;
+    void print(printer& p) const override;
 };
 
 struct stmt_default : public node
@@ -1447,7 +1471,7 @@ struct stmt_default : public node
     stmt_default();
     stmt_default(const location& loc);
     stmt_default(const location& loc, stmt_list::ptr stmt);
-    auto print() const -> std::string override;
+    void print(printer& p) const override;
 };
 
 struct stmt_break : public node
@@ -1456,7 +1480,7 @@ struct stmt_break : public node
 
     stmt_break();
     stmt_break(const location& loc);
-    auto print() const -> std::string override;
+    void print(printer& p) const override;
 };
 
 struct stmt_continue : public node
@@ -1465,7 +1489,7 @@ struct stmt_continue : public node
 
     stmt_continue();
     stmt_continue(const location& loc);
-    auto print() const -> std::string override;
+    void print(printer& p) const override;
 };
 
 struct stmt_return : public node
@@ -1477,7 +1501,7 @@ struct stmt_return : public node
     stmt_return(ast::expr expr);
     stmt_return(const location& loc, ast::expr expr);
 
-    auto print() const -> std::string override;
+    void print(printer& p) const override;
 };
 
 struct stmt_breakpoint : public node
@@ -1486,7 +1510,7 @@ struct stmt_breakpoint : public node
 
     stmt_breakpoint();
     stmt_breakpoint(const location& loc);
-    auto print() const -> std::string override;
+    void print(printer& p) const override;
 };
 
 struct stmt_prof_begin : public node
@@ -1497,7 +1521,7 @@ struct stmt_prof_begin : public node
 
     stmt_prof_begin(expr_arguments::ptr args);
     stmt_prof_begin(const location& loc, expr_arguments::ptr args);
-    auto print() const -> std::string override;
+    void print(printer& p) const override;
 };
 
 struct stmt_prof_end : public node
@@ -1508,7 +1532,7 @@ struct stmt_prof_end : public node
 
     stmt_prof_end(expr_arguments::ptr args);
     stmt_prof_end(const location& loc, expr_arguments::ptr args);
-    auto print() const -> std::string override;
+    void print(printer& p) const override;
 };
 
 struct decl_thread : public node
@@ -1521,7 +1545,7 @@ struct decl_thread : public node
 
     decl_thread(expr_identifier::ptr name, expr_parameters::ptr params, stmt_list::ptr stmt);
     decl_thread(const location& loc, expr_identifier::ptr name, expr_parameters::ptr params, stmt_list::ptr stmt);
-    auto print() const -> std::string override;
+    void print(printer& p) const override;
 };
 
 struct decl_constant : public node
@@ -1533,7 +1557,7 @@ struct decl_constant : public node
 
     decl_constant(expr_identifier::ptr name, expr value);
     decl_constant(const location& loc, expr_identifier::ptr name, expr value);
-    auto print() const -> std::string override;
+    void print(printer& p) const override;
 };
 
 struct decl_usingtree : public node
@@ -1544,7 +1568,7 @@ struct decl_usingtree : public node
 
     decl_usingtree(expr_string::ptr name);
     decl_usingtree(const location& loc, expr_string::ptr name);
-    auto print() const -> std::string override;
+    void print(printer& p) const override;
 };
 
 struct decl_dev_begin : public node
@@ -1553,7 +1577,7 @@ struct decl_dev_begin : public node
 
     decl_dev_begin();
     decl_dev_begin(const location& loc);
-    auto print() const -> std::string override;
+    void print(printer& p) const override;
 };
 
 struct decl_dev_end : public node
@@ -1562,7 +1586,7 @@ struct decl_dev_end : public node
 
     decl_dev_end();
     decl_dev_end(const location& loc);
-    auto print() const -> std::string override;
+    void print(printer& p) const override;
 };
 
 struct include : public node
@@ -1573,7 +1597,7 @@ struct include : public node
 
     include(expr_path::ptr path);
     include(const location& loc, expr_path::ptr path);
-    auto print() const -> std::string override;
+    void print(printer& p) const override;
 };
 
 struct program : public node
@@ -1585,7 +1609,8 @@ struct program : public node
 
     program();
     program(const location& loc);
-    auto print() const -> std::string override;
+    auto print() const -> std::string;
+    void print(printer& p) const override;
 };
 
 struct asm_loc : public node
@@ -1596,7 +1621,7 @@ struct asm_loc : public node
 
     asm_loc(const std::string& value);
     asm_loc(const location& loc, const std::string& value);
-    auto print() const -> std::string override;
+    void print(printer& p) const override;
 };
 
 struct asm_jump : public node
@@ -1607,7 +1632,7 @@ struct asm_jump : public node
 
     asm_jump(const std::string& value);
     asm_jump(const location& loc, const std::string& value);
-    auto print() const -> std::string override;
+    void print(printer& p) const override;
 };
 
 struct asm_jump_back : public node
@@ -1618,7 +1643,7 @@ struct asm_jump_back : public node
 
     asm_jump_back(const std::string& value);
     asm_jump_back(const location& loc, const std::string& value);
-    auto print() const -> std::string override;
+    void print(printer& p) const override;
 };
 
 struct asm_jump_cond : public node
@@ -1630,7 +1655,7 @@ struct asm_jump_cond : public node
 
     asm_jump_cond(ast::expr expr, const std::string& value);
     asm_jump_cond(const location& loc, ast::expr expr, const std::string& value);
-    auto print() const -> std::string override;
+    void print(printer& p) const override;
 };
 
 struct asm_jump_true_expr : public node
@@ -1642,7 +1667,7 @@ struct asm_jump_true_expr : public node
 
     asm_jump_true_expr(ast::expr expr, const std::string& value);
     asm_jump_true_expr(const location& loc, ast::expr expr, const std::string& value);
-    auto print() const -> std::string override;
+    void print(printer& p) const override;
 };
 
 struct asm_jump_false_expr : public node
@@ -1654,7 +1679,7 @@ struct asm_jump_false_expr : public node
 
     asm_jump_false_expr(ast::expr expr, const std::string& value);
     asm_jump_false_expr(const location& loc, ast::expr expr, const std::string& value);
-    auto print() const -> std::string override;
+    void print(printer& p) const override;
 };
 
 struct asm_switch : public node
@@ -1666,7 +1691,7 @@ struct asm_switch : public node
 
     asm_switch(ast::expr expr, const std::string& value);
     asm_switch(const location& loc, ast::expr expr, const std::string& value);
-    auto print() const -> std::string override;
+    void print(printer& p) const override;
 };
 
 struct asm_endswitch : public node
@@ -1678,7 +1703,7 @@ struct asm_endswitch : public node
 
     asm_endswitch(std::vector<std::string> data, const std::string& count);
     asm_endswitch(const location& loc, std::vector<std::string> data, const std::string& count);
-    auto print() const -> std::string override;
+    void print(printer& p) const override;
 };
 
 struct asm_prescriptcall : public node
@@ -1687,7 +1712,7 @@ struct asm_prescriptcall : public node
 
     asm_prescriptcall();
     asm_prescriptcall(const location& loc);
-    auto print() const -> std::string override;
+    void print(printer& p) const override;
 };
 
 struct asm_voidcodepos : public node
@@ -1696,7 +1721,7 @@ struct asm_voidcodepos : public node
 
     asm_voidcodepos();
     asm_voidcodepos(const location& loc);
-    auto print() const -> std::string override;
+    void print(printer& p) const override;
 };
 
 struct asm_create : public node
@@ -1708,7 +1733,7 @@ struct asm_create : public node
 
     asm_create(const std::string& index);
     asm_create(const location& loc, const std::string& index);
-    auto print() const -> std::string override;
+    void print(printer& p) const override;
 };
 
 struct asm_access : public node
@@ -1719,7 +1744,7 @@ struct asm_access : public node
 
     asm_access(const std::string& index);
     asm_access(const location& loc, const std::string& index);
-    auto print() const -> std::string override;
+    void print(printer& p) const override;
 };
 
 struct asm_remove : public node
@@ -1730,7 +1755,7 @@ struct asm_remove : public node
 
     asm_remove(const std::string& index);
     asm_remove(const location& loc, const std::string& index);
-    auto print() const -> std::string override;
+    void print(printer& p) const override;
 };
 
 struct asm_clear : public node
@@ -1741,7 +1766,7 @@ struct asm_clear : public node
 
     asm_clear(const std::string& index);
     asm_clear(const location& loc, const std::string& index);
-    auto print() const -> std::string override;
+    void print(printer& p) const override;
 };
 
 } // namespace xsk::gsc::ast
@@ -0,0 +1,29 @@
+// Copyright 2021 xensik. All rights reserved.
+//
+// Use of this source code is governed by a GNU GPLv3 license
+// that can be found in the LICENSE file.
+
+#include "stdafx.hpp"
+
+namespace xsk::gsc
+{
+
+opcode_table::opcode_table(const std::vector<entry>& table, size_func size) : size_(size)
+{
+    ops_.fill(op::none);
+    ids_.fill(0xFF);
+
+    for (const auto& entry : table)
+    {
+        ops_[entry.id] = entry.kind;
+        ids_[static_cast<std::size_t>(entry.kind)] = entry.id;
+    }
+}
+
+void opcode_table::assign(instruction& inst, op kind) const
+{
+    inst.opcode = ids_[static_cast<std::size_t>(kind)];
+    inst.size = size_(inst.opcode);
+}
+
+} // namespace xsk::gsc
@@ -0,0 +1,72 @@
+// Copyright 2021 xensik. All rights reserved.
+//
+// Use of this source code is governed by a GNU GPLv3 license
+// that can be found in the LICENSE file.
+
+#pragma once
+
+namespace xsk::gsc
+{
+
+// generic operations the passes over compiled functions work with, each game maps
+// them to its own opcode ids and sizes
+class opcode_table
+{
+public:
+    enum class op : std::uint8_t
+    {
+        none,
+        jump,
+        jump_back,
+        jump_on_false,
+        jump_on_true,
+        jump_on_false_expr,
+        jump_on_true_expr,
+        switch_jump,
+        switch_end,
+        end,
+        ret,
+        cast_bool,
+        bool_not,
+        get_zero,
+        get_byte,
+        get_neg_byte,
+        equality,
+        inequality,
+        less,
+        greater,
+        less_equal,
+        greater_equal,
+        eval_local_cached0,
+        eval_local_cached1,
+        eval_local_cached2,
+        eval_local_cached3,
+        eval_local_cached4,
+        eval_local_cached5,
+        eval_local_cached,
+        set_local_field_cached0,
+        set_local_field_cached,
+        count,
+    };
+
+    struct entry
+    {
+        op kind;
+        std::uint8_t id;
+    };
+
+    using size_func = auto (*)(std::uint8_t id) -> std::uint32_t;
+
+private:
+    std::array<op, 0x100> ops_;
+    std::array<std::uint8_t, static_cast<std::size_t>(op::count)> ids_;
+    size_func size_;
+
+public:
+    opcode_table(const std::vector<entry>& table, size_func size);
+    auto kind(const instruction& inst) const -> op { return ops_[inst.opcode]; }
+    auto size(op kind) const -> std::uint32_t { return size_(ids_[static_cast<std::size_t>(kind)]); }
+    void assign(instruction& inst, op kind) const;
+};
+
+} // namespace xsk::gsc
@@ -0,0 +1,718 @@
+// Copyright 2021 xensik. All rights reserved.
+//
+// Use of this source code is governed by a GNU GPLv3 license
+// that can be found in the LICENSE file.
+
+#include "stdafx.hpp"
+
+namespace xsk::gsc
+{
+
+namespace
+{
+
+// compile time value of an expression, none when it depends on the runtime
+struct value
+{
+    enum class type { none, integer, number, string, vector };
+
+    type kind = type::none;
+    std::int32_t integer = 0;
+    float number = 0.0f;
+    std::string string;
+    std::array<float, 3> vector = {};
+
+    auto numeric() const -> bool { return kind == type::integer || kind == type::number; }
+    auto as_float() const -> float { return kind == type::integer ? static_cast<float>(integer) : number; }
+    auto is_bool() const -> bool { return kind == type::integer && (integer == 0 || integer == 1); }
+};
+
+// ints are 32 bits in the VM, results that would wrap are left to it
+auto make_integer(std::int64_t data) -> value
+{
+    value result;
+
+    if (data < std::numeric_limits<std::int32_t>::min() || data > std::numeric_limits<std::int32_t>::max()) return result;
+
+    result.kind = value::type::integer;
+    result.integer = static_cast<std::int32_t>(data);
+    return result;
+}
+
+auto make_number(float data) -> value
+{
+    value result;
+
+    if (!std::isfinite(data)) return result;
+
+    result.kind = value::type::number;
+    result.number = data;
+    return result;
+}
+
+auto make_string(const std::string& data) -> value
+{
+    value result;
+    result.kind = value::type::string;
+    result.string = data;
+    return result;
+}
+
+auto make_vector(float x, float y, float z) -> value
+{
+    value result;
+
+    if (!std::isfinite(x) || !std::isfinite(y) || !std::isfinite(z)) return result;
+
+    result.kind = value::type::vector;
+    result.vector = { x, y, z };
+    return result;
+}
+
+auto evaluate(const ast::expr& expr) -> value
+{
+    switch (expr.kind())
+    {
+        case ast::kind::expr_true:
+            return make_integer(1);
+        case ast::kind::expr_false:
+            return make_integer(0);
+        case ast::kind::expr_integer:
+        {
+            const auto& data = expr.as_integer->value;
+            char* end = nullptr;
+            const auto result = std::strtoll(data.data(), &end, 10);
+
+            if (end == data.data() || *end != '\0') return {};
+
+            return make_integer(result);
+        }
+        case ast::kind::expr_float:
+        {
+            try
+            {
+                // same conversion the assemblers use
+                return make_number(std::stof(expr.as_float->value));
+            }
+            catch (const std::exception&)
+            {
+                return {};
+            }
+        }
+        case ast::kind::expr_string:
+            // the literal keeps its quotes and escapes, the value is what the assembler writes
+            return make_string(utils::string::to_code(expr.as_string->value));
+        case ast::kind::expr_vector:
+        {
+            const auto x = evaluate(expr.as_vector->x);
+            const auto y = evaluate(expr.as_vector->y);
+            const auto z = evaluate(expr.as_vector->z);
+
+            if (!x.numeric() || !y.numeric() || !z.numeric()) return {};
+
+            return make_vector(x.as_float(), y.as_float(), z.as_float());
+        }
+        case ast::kind::expr_paren:
+            return evaluate(expr.as_paren->child);
+        default:
+            return {};
+    }
+}
+
+auto make_float_expr(float data, const location& loc) -> ast::expr
+{
+    // 9 significant digits give back the same float
+    return ast::expr(std::make_unique<ast::expr_float>(loc, utils::string::va("%.9g", data)));
+}
+
+auto make_expr(const value& data, const location& loc) -> ast::expr
+{
+    switch (data.kind)
+    {
+        case value::type::integer:
+            return ast::expr(std::make_unique<ast::expr_integer>(loc, std::to_string(data.integer)));
+        case value::type::number:
+            return make_float_expr(data.number, loc);
+        case value::type::string:
+        {
+            // strings the escapes can't spell back are left unfolded
+            const auto literal = utils::string::to_literal(data.string);
+
+            if (utils::string::to_code(literal) != data.string) return ast::expr(nullptr);
+
+            return ast::expr(std::make_unique<ast::expr_string>(loc, literal));
+        }
+        default:
+            return ast::expr(std::make_unique<ast::expr_vector>(loc, make_float_expr(data.vector[0], loc), make_float_expr(data.vector[1], loc), make_float_expr(data.vector[2], loc)));
+    }
+}
+
+// literal constants are copied as written, anything else is left to the compiler
+auto copy_literal(const ast::expr& expr, const location& loc) -> ast::expr
+{
+    switch (expr.kind())
+    {
+        case ast::kind::expr_true:
+            return ast::expr(std::make_unique<ast::expr_true>(loc));
+        case ast::kind::expr_false:
+            return ast::expr(std::make_unique<ast::expr_false>(loc));
+        case ast::kind::expr_integer:
+            return ast::expr(std::make_unique<ast::expr_integer>(loc, expr.as_integer->value));
+        case ast::kind::expr_float:
+            return ast::expr(std::make_unique<ast::expr_float>(loc, expr.as_float->value));
+        case ast::kind::expr_string:
+            return ast::expr(std::make_unique<ast::expr_string>(loc, expr.as_string->value));
+        case ast::kind::expr_istring:
+            return ast::expr(std::make_unique<ast::expr_istring>(loc, expr.as_istring->value));
+        case ast::kind::expr_vector:
+        {
+            auto x = copy_literal(expr.as_vector->x, loc);
+            auto y = copy_literal(expr.as_vector->y, loc);
+            auto z = copy_literal(expr.as_vector->z, loc);
+
+            if (x.as_node == nullptr || y.as_node == nullptr || z.as_node == nullptr) return ast::expr(nullptr);
+
+            return ast::expr(std::make_unique<ast::expr_vector>(loc, std::move(x), std::move(y), std::move(z)));
+        }
+        default:
+            return ast::expr(nullptr);
+    }
+}
+
+auto fold_binary(ast::kind op, const value& lhs, const value& rhs) -> value
+{
+    using type = value::type;
+
+    if (lhs.kind == type::none || rhs.kind == type::none) return {};
+
+    const auto ints = lhs.kind == type::integer && rhs.kind == type::integer;
+    const auto numbers = lhs.numeric() && rhs.numeric();
+    const auto strings = lhs.kind == type::string && rhs.kind == type::string;
+    const auto vectors = lhs.kind == type::vector && rhs.kind == type::vector;
+    const auto a = static_cast<std::int64_t>(lhs.integer);
+    const auto b = static_cast<std::int64_t>(rhs.integer);
+    const auto x = lhs.as_float();
+    const auto y = rhs.as_float();
+    const auto& u = lhs.vector;
+    const auto& v = rhs.vector;
+
+    switch (op)
+    {
+        case ast::kind::expr_add:
+            if (ints) return make_integer(a + b);
+            if (numbers) return make_number(static_cast<float>(x + y));
+            if (strings) return make_string(lhs.string + rhs.string);
+            if (lhs.kind == type::string && rhs.kind == type::integer) return make_string(lhs.string + std::to_string(rhs.integer));
+            if (lhs.kind == type::integer && rhs.kind == type::string) return make_string(std::to_string(lhs.integer) + rhs.string);
+            if (vectors) return make_vector(u[0] + v[0], u[1] + v[1], u[2] + v[2]);
+            return {};
+        case ast::kind::expr_sub:
+            if (ints) return make_integer(a - b);
+            if (numbers) return make_number(static_cast<float>(x - y));
+            if (vectors) return make_vector(u[0] - v[0], u[1] - v[1], u[2] - v[2]);
+            return {};
+        case ast::kind::expr_mul:
+            if (ints) return make_integer(a * b);
+            if (numbers) return make_number(static_cast<float>(x * y));
+            if (lhs.kind == type::vector && rhs.numeric()) return make_vector(u[0] * y, u[1] * y, u[2] * y);
+            if (lhs.numeric() && rhs.kind == type::vector) return make_vector(x * v[0], x * v[1], x * v[2]);
+            return {};
+        case ast::kind::expr_div:
+            // int / int is left to the VM, it decides the result type
+            if (numbers && !ints && y != 0.0f) return make_number(static_cast<float>(x / y));
+            return {};
+        case ast::kind::expr_mod:
+            if (ints && b != 0 && !(b == -1 && a == std::numeric_limits<std::int32_t>::min())) return make_integer(a % b);
+            return {};
+        case ast::kind::expr_shift_left:
+            if (ints && a >= 0 && b >= 0 && b < 32) return make_integer(a << b);
+            return {};
+        case ast::kind::expr_shift_right:
+            if (ints && a >= 0 && b >= 0 && b < 32) return make_integer(a >> b);
+            return {};
+        case ast::kind::expr_bitwise_or:
+            if (ints) return make_integer(a | b);
+            return {};
+        case ast::kind::expr_bitwise_and:
+            if (ints) return make_integer(a & b);
+            return {};
+        case ast::kind::expr_bitwise_exor:
+            if (ints) return make_integer(a ^ b);
+            return {};
+        case ast::kind::expr_equality:
+            if (ints) return make_integer(a == b);
+            if (numbers) return make_integer(x == y);
+            if (strings) return make_integer(lhs.string == rhs.string);
+            return {};
+        case ast::kind::expr_inequality:
+            if (ints) return make_integer(a != b);
+            if (numbers) return make_integer(x != y);
+            if (strings) return make_integer(lhs.string != rhs.string);
+            return {};
+        case ast::kind::expr_less:
+            if (ints) return make_integer(a < b);
+            if (numbers) return make_integer(x < y);
+            return {};
+        case ast::kind::expr_greater:
+            if (ints) return make_integer(a > b);
+            if (numbers) return make_integer(x > y);
+            return {};
+        case ast::kind::expr_less_equal:
+            if (ints) return make_integer(a <= b);
+            if (numbers) return make_integer(x <= y);
+            return {};
+        case ast::kind::expr_greater_equal:
+            if (ints) return make_integer(a >= b);
+            if (numbers) return make_integer(x >= y);
+            return {};
+        default:
+            return {};
+    }
+}
+
+auto is_literal_false(const ast::expr& expr) -> bool
+{
+    const auto data = evaluate(expr);
+
+    return (expr == ast::kind::expr_false || expr == ast::kind::expr_integer) && data.kind == value::type::integer && data.integer == 0;
+}
+
+// break or continue statements that bind to the loop around the statement
+auto has_loop_jump(const ast::stmt& stmt, bool in_switch = false) -> bool
+{
+    switch (stmt.kind())
+    {
+        case ast::kind::stmt_list:
+            for (const auto& entry : stmt.as_list->list)
+            {
+                if (has_loop_jump(entry, in_switch)) return true;
+            }
+            return false;
+        case ast::kind::stmt_if:
+            return has_loop_jump(stmt.as_if->stmt, in_switch);
+        case ast::kind::stmt_ifelse:
+            return has_loop_jump(stmt.as_ifelse->stmt_if, in_switch) || has_loop_jump(stmt.as_ifelse->stmt_else, in_switch);
+        case ast::kind::stmt_switch:
+            for (const auto& entry : stmt.as_switch->stmt->list)
+            {
+                if (has_loop_jump(entry, true)) return true;
+            }
+            return false;
+        case ast::kind::stmt_case:
+            if (stmt.as_case->stmt == nullptr) return false;
+            for (const auto& entry : stmt.as_case->stmt->list)
+            {
+                if (has_loop_jump(entry, in_switch)) return true;
+            }
+            return false;
+        case ast::kind::stmt_default:
+            if (stmt.as_default->stmt == nullptr) return false;
+            for (const auto& entry : stmt.as_default->stmt->list)
+            {
+                if (has_loop_jump(entry, in_switch)) return true;
+            }
+            return false;
+        case ast::kind::stmt_break:
+            return !in_switch;
+        case ast::kind::stmt_continue:
+            return true;
+        default:
+            return false;
+    }
+}
+
+auto empty_stmt(const location& loc) -> ast::stmt
+{
+    return ast::stmt(std::make_unique<ast::stmt_list>(loc));
+}
+
+} // namespace
+
+void optimizer::optimize(const ast::program::ptr& program)
+{
+    constants_.clear();
+
+    // constants are visible from their declaration on, the first one of a name wins
+    for (auto& decl : program->declarations)
+    {
+        if (decl == ast::kind::decl_constant)
+        {
+            optimize_expr(decl.as_constant->value);
+            constants_.insert({ decl.as_constant->name->value, &decl.as_constant->value });
+        }
+        else if (decl == ast::kind::decl_thread)
+        {
+            optimize_stmt_list(decl.as_thread->stmt);
+        }
+    }
+}
+
+void optimizer::optimize_stmt(ast::stmt& stmt)
+{
+    switch (stmt.kind())
+    {
+        case ast::kind::stmt_list:
+            optimize_stmt_list(stmt.as_list);
+            break;
+        case ast::kind::stmt_expr:
+            optimize_expr(stmt.as_expr->expr);
+            break;
+        case ast::kind::stmt_call:
+            optimize_expr(stmt.as_call->expr);
+            break;
+        case ast::kind::stmt_assign:
+            optimize_expr(stmt.as_assign->expr);
+            break;
+        case ast::kind::stmt_endon:
+            optimize_expr(stmt.as_endon->obj);
+            optimize_expr(stmt.as_endon->event);
+            break;
+        case ast::kind::stmt_notify:
+            optimize_expr(stmt.as_notify->obj);
+            optimize_expr(stmt.as_notify->event);
+            optimize_expr_arguments(stmt.as_notify->args);
+            break;
+        case ast::kind::stmt_wait:
+            optimize_expr(stmt.as_wait->time);
+            break;
+        case ast::kind::stmt_waittill:
+            optimize_expr(stmt.as_waittill->obj);
+            optimize_expr(stmt.as_waittill->event);
+            break;
+        case ast::kind::stmt_waittillmatch:
+            optimize_expr(stmt.as_waittillmatch->obj);
+            optimize_expr(stmt.as_waittillmatch->event);
+            optimize_expr_arguments(stmt.as_waittillmatch->args);
+            break;
+        case ast::kind::stmt_if:
+            optimize_stmt_if(stmt);
+            break;
+        case ast::kind::stmt_ifelse:
+            optimize_stmt_ifelse(stmt);
+            break;
+        case ast::kind::stmt_while:
+            optimize_stmt_while(stmt);
+            break;
+        case ast::kind::stmt_dowhile:
+            optimize_stmt_dowhile(stmt);
+            break;
+        case ast::kind::stmt_for:
+            optimize_stmt_for(stmt);
+            break;
+        case ast::kind::stmt_foreach:
+            optimize_expr(stmt.as_foreach->array_expr);
+            optimize_stmt(stmt.as_foreach->stmt);
+            break;
+        case ast::kind::stmt_switch:
+            optimize_expr(stmt.as_switch->test);
+            optimize_stmt_list(stmt.as_switch->stmt);
+            break;
+        case ast::kind::stmt_case:
+            optimize_expr(stmt.as_case->label);
+            if (stmt.as_case->stmt != nullptr) optimize_stmt_list(stmt.as_case->stmt);
+            break;
+        case ast::kind::stmt_default:
+            if (stmt.as_default->stmt != nullptr) optimize_stmt_list(stmt.as_default->stmt);
+            break;
+        case ast::kind::stmt_return:
+            optimize_expr(stmt.as_return->expr);
+            break;
+        case ast::kind::stmt_prof_begin:
+            optimize_expr_arguments(stmt.as_prof_begin->args);
+            break;
+        case ast::kind::stmt_prof_end:
+            optimize_expr_arguments(stmt.as_prof_end->args);
+            break;
+        default:
+            break;
+    }
+}
+
+void optimizer::optimize_stmt_list(const ast::stmt_list::ptr& stmt)
+{
+    for (auto& entry : stmt->list)
+    {
+        optimize_stmt(entry);
+    }
+}
+
+void optimizer::optimize_stmt_if(ast::stmt& stmt)
+{
+    optimize_expr(stmt.as_if->test);
+    optimize_stmt(stmt.as_if->stmt);
+
+    const auto test = evaluate(stmt.as_if->test);
+
+    if (test.kind != value::type::integer) return;
+
+    auto body = test.integer ? std::move(stmt.as_if->stmt) : empty_stmt(stmt.loc());
+    stmt = std::move(body);
+}
+
+void optimizer::optimize_stmt_ifelse(ast::stmt& stmt)
+{
+    optimize_expr(stmt.as_ifelse->test);
+    optimize_stmt(stmt.as_ifelse->stmt_if);
+    optimize_stmt(stmt.as_ifelse->stmt_else);
+
+    const auto test = evaluate(stmt.as_ifelse->test);
+
+    if (test.kind != value::type::integer) return;
+
+    auto body = std::move(test.integer ? stmt.as_ifelse->stmt_if : stmt.as_ifelse->stmt_else);
+    stmt = std::move(body);
+}
+
+// a literal false loop test is an error the compiler still reports, only folded ones are pruned
+void optimizer::optimize_stmt_while(ast::stmt& stmt)
+{
+    const auto written = is_literal_false(stmt.as_while->test);
+
+    optimize_expr(stmt.as_while->test);
+    optimize_stmt(stmt.as_while->stmt);
+
+    if (!written && is_literal_false(stmt.as_while->test))
+    {
+        stmt = empty_stmt(stmt.loc());
+    }
+}
+
+// a folded false test runs the body once in place of the loop, a body that breaks out
+// or continues keeps its loop and the test is left as written
+void optimizer::optimize_stmt_dowhile(ast::stmt& stmt)
+{
+    const auto written = is_literal_false(stmt.as_dowhile->test);
+
+    optimize_stmt(stmt.as_dowhile->stmt);
+
+    if (has_loop_jump(stmt.as_dowhile->stmt)) return;
+
+    optimize_expr(stmt.as_dowhile->test);
+
+    if (!written && is_literal_false(stmt.as_dowhile->test))
+    {
+        auto body = std::move(stmt.as_dowhile->stmt);
+        stmt = std::move(body);
+    }
+}
+
+void optimizer::optimize_stmt_for(ast::stmt& stmt)
+{
+    const auto written = is_literal_false(stmt.as_for->test);
+
+    optimize_stmt(stmt.as_for->init);
+    optimize_expr(stmt.as_for->test);
+    optimize_stmt(stmt.as_for->iter);
+    optimize_stmt(stmt.as_for->stmt);
+
+    if (!written && is_literal_false(stmt.as_for->test))
+    {
+        auto init = std::move(stmt.as_for->init);
+        stmt = std::move(init);
+    }
+}
+
+void optimizer::optimize_expr(ast::expr& expr)
+{
+    switch (expr.kind())
+    {
+        case ast::kind::expr_paren:
+            optimize_expr(expr.as_paren->child);
+            if (evaluate(expr.as_paren->child).kind != value::type::none)
+            {
+                auto child = std::move(expr.as_paren->child);
+                expr = std::move(child);
+            }
+            break;
+        case ast::kind::expr_ternary:
+            optimize_expr_ternary(expr);
+            break;
+        case ast::kind::expr_and:
+        case ast::kind::expr_or:
+            optimize_expr_logical(expr);
+            break;
+        case ast::kind::expr_equality:
+        case ast::kind::expr_inequality:
+        case ast::kind::expr_less:
+        case ast::kind::expr_greater:
+        case ast::kind::expr_less_equal:
+        case ast::kind::expr_greater_equal:
+        case ast::kind::expr_bitwise_or:
+        case ast::kind::expr_bitwise_and:
+        case ast::kind::expr_bitwise_exor:
+        case ast::kind::expr_shift_left:
+        case ast::kind::expr_shift_right:
+        case ast::kind::expr_add:
+        case ast::kind::expr_sub:
+        case ast::kind::expr_mul:
+        case ast::kind::expr_div:
+        case ast::kind::expr_mod:
+            optimize_expr_binary(expr);
+            break;
+        case ast::kind::expr_complement:
+        case ast::kind::expr_not:
+            optimize_expr_unary(expr);
+            break;
+        case ast::kind::expr_assign_equal:
+        case ast::kind::expr_assign_add:
+        case ast::kind::expr_assign_sub:
+        case ast::kind::expr_assign_mul:
+        case ast::kind::expr_assign_div:
+        case ast::kind::expr_assign_mod:
+        case ast::kind::expr_assign_shift_left:
+        case ast::kind::expr_assign_shift_right:
+        case ast::kind::expr_assign_bitwise_or:
+        case ast::kind::expr_assign_bitwise_and:
+        case ast::kind::expr_assign_bitwise_exor:
+            optimize_expr_object(expr.as_assign->lvalue);
+            optimize_expr(expr.as_assign->rvalue);
+            break;
+        case ast::kind::expr_call:
+            optimize_expr_call(expr.as_call->call);
+            break;
+        case ast::kind::expr_method:
+            optimize_expr_object(expr.as_method->obj);
+            optimize_expr_call(expr.as_method->call);
+            break;
+        case ast::kind::expr_add_array:
+            optimize_expr_arguments(expr.as_add_array->args);
+            break;
+        case ast::kind::expr_array:
+            optimize_expr_object(expr.as_array->obj);
+            optimize_expr(expr.as_array->key);
+            break;
+        case ast::kind::expr_field:
+            optimize_expr_object(expr.as_field->obj);
+            break;
+        case ast::kind::expr_size:
+            optimize_expr_object(expr.as_size->obj);
+            break;
+        case ast::kind::expr_vector:
+            optimize_expr(expr.as_vector->x);
+            optimize_expr(expr.as_vector->y);
+            optimize_expr(expr.as_vector->z);
+            break;
+        case ast::kind::expr_identifier:
+            optimize_expr_identifier(expr);
+            break;
+        default:
+            break;
+    }
+}
+
+// variables used as objects or assigned keep their name, only their keys and calls are folded
+void optimizer::optimize_expr_object(ast::expr& expr)
+{
+    if (expr != ast::kind::expr_identifier)
+    {
+        optimize_expr(expr);
+    }
+}
+
+void optimizer::optimize_expr_arguments(const ast::expr_arguments::ptr& args)
+{
+    for (auto& entry : args->list)
+    {
+        optimize_expr(entry);
+    }
+}
+
+void optimizer::optimize_expr_call(ast::call& call)
+{
+    if (call == ast::kind::expr_pointer)
+    {
+        optimize_expr(call.as_pointer->func);
+        optimize_expr_arguments(call.as_pointer->args);
+    }
+    else if (call == ast::kind::expr_function)
+    {
+        optimize_expr_arguments(call.as_function->args);
+    }
+}
+
+void optimizer::optimize_expr_binary(ast::expr& expr)
+{
+    optimize_expr(expr.as_binary->lvalue);
+    optimize_expr(expr.as_binary->rvalue);
+
+    const auto result = fold_binary(expr.kind(), evaluate(expr.as_binary->lvalue), evaluate(expr.as_binary->rvalue));
+
+    if (result.kind == value::type::none) return;
+
+    auto folded = make_expr(result, expr.loc());
+
+    if (folded.as_node != nullptr)
+    {
+        expr = std::move(folded);
+    }
+}
+
+// the left value is the result when it decides alone, the right one is cast to bool.
+// only 0 and 1 are folded, those read the same whether the VM normalizes ints or not
+void optimizer::optimize_expr_logical(ast::expr& expr)
+{
+    optimize_expr(expr.as_binary->lvalue);
+    optimize_expr(expr.as_binary->rvalue);
+
+    const auto lhs = evaluate(expr.as_binary->lvalue);
+
+    if (!lhs.is_bool()) return;
+
+    if (lhs.integer == (expr == ast::kind::expr_or ? 1 : 0))
+    {
+        expr = make_expr(lhs, expr.loc());
+        return;
+    }
+
+    const auto rhs = evaluate(expr.as_binary->rvalue);
+
+    if (rhs.is_bool())
+    {
+        expr = make_expr(rhs, expr.loc());
+    }
+}
+
+void optimizer::optimize_expr_unary(ast::expr& expr)
+{
+    auto& rvalue = (expr == ast::kind::expr_not) ? expr.as_not->rvalue : expr.as_complement->rvalue;
+
+    optimize_expr(rvalue);
+
+    const auto data = evaluate(rvalue);
+
+    if (data.kind != value::type::integer) return;
+
+    const auto result = (expr == ast::kind::expr_not) ? make_integer(data.integer == 0) : make_integer(~data.integer);
+
+    expr = make_expr(result, expr.loc());
+}
+
+void optimizer::optimize_expr_ternary(ast::expr& expr)
+{
+    optimize_expr(expr.as_ternary->test);
+    optimize_expr(expr.as_ternary->true_expr);
+    optimize_expr(expr.as_ternary->false_expr);
+
+    const auto test = evaluate(expr.as_ternary->test);
+
+    if (test.kind != value::type::integer) return;
+
+    auto result = std::move(test.integer ? expr.as_ternary->true_expr : expr.as_ternary->false_expr);
+    expr = std::move(result);
+}
+
+void optimizer::optimize_expr_identifier(ast::expr& expr)
+{
+    const auto itr = constants_.find(expr.as_identifier->value);
+
+    if (itr == constants_.end()) return;
+
+    auto result = copy_literal(*itr->second, expr.loc());
+
+    if (result.as_node != nullptr)
+    {
+        expr = std::move(result);
+    }
+}
+
+} // namespace xsk::gsc
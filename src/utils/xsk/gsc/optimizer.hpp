@@ -0,0 +1,40 @@
+// Copyright 2021 xensik. All rights reserved.
+//
+// Use of this source code is governed by a GNU GPLv3 license
+// that can be found in the LICENSE file.
+
+#pragma once
+
+namespace xsk::gsc
+{
+
+// syntax tree pass run by the compilers before code generation. folds constant
+// expressions the way the VM would evaluate them, propagates literal constants
+// and prunes statements behind constant conditions
+class optimizer
+{
+    std::unordered_map<std::string, const ast::expr*> constants_;
+
+public:
+    void optimize(const ast::program::ptr& program);
+
+private:
+    void optimize_stmt(ast::stmt& stmt);
+    void optimize_stmt_list(const ast::stmt_list::ptr& stmt);
+    void optimize_stmt_if(ast::stmt& stmt);
+    void optimize_stmt_ifelse(ast::stmt& stmt);
+    void optimize_stmt_while(ast::stmt& stmt);
+    void optimize_stmt_dowhile(ast::stmt& stmt);
+    void optimize_stmt_for(ast::stmt& stmt);
+    void optimize_expr(ast::expr& expr);
+    void optimize_expr_object(ast::expr& expr);
+    void optimize_expr_arguments(const ast::expr_arguments::ptr& args);
+    void optimize_expr_call(ast::call& call);
+    void optimize_expr_binary(ast::expr& expr);
+    void optimize_expr_logical(ast::expr& expr);
+    void optimize_expr_unary(ast::expr& expr);
+    void optimize_expr_ternary(ast::expr& expr);
+    void optimize_expr_identifier(ast::expr& expr);
+};
+
+} // namespace xsk::gsc
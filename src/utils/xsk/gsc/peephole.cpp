@@ -0,0 +1,364 @@
+// Copyright 2021 xensik. All rights reserved.
+//
+// Use of this source code is governed by a GNU GPLv3 license
+// that can be found in the LICENSE file.
+
+#include "stdafx.hpp"
+
+namespace xsk::gsc
+{
+
+namespace
+{
+
+using op = opcode_table::op;
+
+// conditional jumps and jumpback store a 16 bit offset
+constexpr std::uint32_t short_jump_max = 0x7FFF;
+
+// instructions of the function being rewritten, removed ones are left as null until the
+// layout so positions and the original indexes stay valid for label lookups
+class window
+{
+public:
+    const opcode_table& ops;
+    function& func;
+    std::vector<instruction::ptr>& insts;
+    std::vector<std::uint32_t> indexes;
+    std::map<std::uint32_t, std::uint32_t> labels;
+    std::unordered_map<std::uint32_t, std::uint32_t> label_index;
+
+    window(const opcode_table& ops, function& func) : ops(ops), func(func), insts(func.instructions)
+    {
+        indexes.reserve(insts.size());
+
+        for (const auto& inst : insts)
+        {
+            indexes.push_back(inst->index);
+        }
+
+        for (const auto& entry : func.labels)
+        {
+            labels.insert(entry);
+            label_index.insert({ entry.second, entry.first });
+        }
+    }
+
+    auto next(std::size_t pos) const -> std::size_t
+    {
+        while (++pos < insts.size() && insts[pos] == nullptr);
+        return pos;
+    }
+
+    // a label on a removed instruction now belongs to the next one left
+    auto labeled(std::size_t prev, std::size_t pos) const -> bool
+    {
+        const auto itr = labels.upper_bound(indexes[prev]);
+        return itr != labels.end() && itr->first <= indexes[pos];
+    }
+
+    auto address(const operand& label) const -> std::uint32_t
+    {
+        return label_index.at(label.as_label());
+    }
+
+    auto target(const operand& label) const -> std::size_t
+    {
+        const auto itr = std::lower_bound(indexes.begin(), indexes.end(), address(label));
+        const auto pos = static_cast<std::size_t>(itr - indexes.begin());
+
+        return (pos < insts.size() && insts[pos] != nullptr) ? pos : next(pos);
+    }
+
+    auto at(std::size_t pos) const -> op
+    {
+        return pos < insts.size() ? ops.kind(*insts[pos]) : op::none;
+    }
+
+    void remove(std::size_t pos)
+    {
+        insts[pos] = nullptr;
+    }
+};
+
+auto invert(op kind) -> op
+{
+    return kind == op::jump_on_false ? op::jump_on_true : op::jump_on_false;
+}
+
+auto short_jump(const instruction& inst, std::uint32_t addr) -> bool
+{
+    return addr > inst.index && addr - inst.index - inst.size <= short_jump_max;
+}
+
+auto slot(const opcode_table& ops, const instruction& inst) -> std::int32_t
+{
+    switch (ops.kind(inst))
+    {
+        case op::eval_local_cached0:
+        case op::set_local_field_cached0:
+            return 0;
+        case op::eval_local_cached1:
+            return 1;
+        case op::eval_local_cached2:
+            return 2;
+        case op::eval_local_cached3:
+            return 3;
+        case op::eval_local_cached4:
+            return 4;
+        case op::eval_local_cached5:
+            return 5;
+        default:
+            return inst.data[0].as_int();
+    }
+}
+
+struct rule
+{
+    const char* name;
+    std::vector<std::vector<op>> pattern;
+    auto (*apply)(window& win, const std::vector<std::size_t>& pos) -> bool;
+};
+
+// distances only shrink while instructions are removed, so offsets are checked on the
+// indexes the compiler laid out
+const std::vector<rule> rules =
+{
+    {
+        // jump to the instruction right after it
+        "jump-next", { { op::jump } },
+        [](window& win, const std::vector<std::size_t>& pos)
+        {
+            if (win.target(win.insts[pos[0]]->data[0]) != win.next(pos[0])) return false;
+
+            win.remove(pos[0]);
+            return true;
+        }
+    },
+    {
+        // jump landing on an unconditional jump goes straight to its target
+        "jump-chain", { { op::jump, op::jump_on_false, op::jump_on_true, op::jump_on_false_expr, op::jump_on_true_expr } },
+        [](window& win, const std::vector<std::size_t>& pos)
+        {
+            auto& inst = *win.insts[pos[0]];
+            const auto target = win.target(inst.data[0]);
+            const auto kind = win.at(target);
+
+            if (kind != op::jump && kind != op::jump_back) return false;
+
+            const auto& label = win.insts[target]->data[0];
+            const auto addr = win.address(label);
+
+            if (kind == op::jump_back)
+            {
+                if (win.ops.kind(inst) != op::jump || addr > inst.index || inst.index + 3 - addr > short_jump_max) return false;
+
+                win.ops.assign(inst, op::jump_back);
+                inst.data[0] = label;
+                return true;
+            }
+
+            if (addr <= inst.index) return false;
+            if (win.ops.kind(inst) != op::jump && !short_jump(inst, addr)) return false;
+
+            inst.data[0] = label;
+            return true;
+        }
+    },
+    {
+        // conditional jump over an unconditional one turns into the inverse condition
+        "branch-over-jump", { { op::jump_on_false, op::jump_on_true }, { op::jump } },
+        [](window& win, const std::vector<std::size_t>& pos)
+        {
+            auto& inst = *win.insts[pos[0]];
+            const auto& label = win.insts[pos[1]]->data[0];
+
+            if (win.target(inst.data[0]) != win.next(pos[1])) return false;
+            if (!short_jump(inst, win.address(label))) return false;
+
+            win.ops.assign(inst, invert(win.ops.kind(inst)));
+            inst.data[0] = label;
+            win.remove(pos[1]);
+            return true;
+        }
+    },
+    {
+        // negated condition folded into the branch
+        "not-branch", { { op::bool_not }, { op::jump_on_false, op::jump_on_true } },
+        [](window& win, const std::vector<std::size_t>& pos)
+        {
+            auto& inst = *win.insts[pos[1]];
+
+            win.ops.assign(inst, invert(win.ops.kind(inst)));
+            win.remove(pos[0]);
+            return true;
+        }
+    },
+    {
+        // comparisons and negations already leave 0 or 1
+        "redundant-cast", { { op::equality, op::inequality, op::less, op::greater, op::less_equal, op::greater_equal, op::bool_not, op::cast_bool }, { op::cast_bool } },
+        [](window& win, const std::vector<std::size_t>& pos)
+        {
+            win.remove(pos[1]);
+            return true;
+        }
+    },
+    {
+        // negated integer constant
+        "not-constant", { { op::get_zero, op::get_byte, op::get_neg_byte }, { op::bool_not } },
+        [](window& win, const std::vector<std::size_t>& pos)
+        {
+            auto& inst = *win.insts[pos[0]];
+            const auto value = win.ops.kind(inst) == op::get_zero ? 0 : inst.data[0].as_int();
+
+            if (value == 0)
+            {
+                win.ops.assign(inst, op::get_byte);
+                inst.data = { operand::integer(1) };
+            }
+            else
+            {
+                win.ops.assign(inst, op::get_zero);
+                inst.data.clear();
+            }
+
+            win.remove(pos[1]);
+            return true;
+        }
+    },
+    {
+        // local variable assigned to itself
+        "self-assign",
+        {
+            { op::eval_local_cached0, op::eval_local_cached1, op::eval_local_cached2, op::eval_local_cached3, op::eval_local_cached4, op::eval_local_cached5, op::eval_local_cached },
+            { op::set_local_field_cached0, op::set_local_field_cached },
+        },
+        [](window& win, const std::vector<std::size_t>& pos)
+        {
+            if (slot(win.ops, *win.insts[pos[0]]) != slot(win.ops, *win.insts[pos[1]])) return false;
+
+            win.remove(pos[0]);
+            win.remove(pos[1]);
+            return true;
+        }
+    },
+};
+
+// instructions matching the pattern from pos on, only the first one may be a jump target
+auto match(const window& win, const rule& entry, std::size_t pos, std::vector<std::size_t>& result) -> bool
+{
+    result.clear();
+
+    for (const auto& alternatives : entry.pattern)
+    {
+        if (!result.empty())
+        {
+            const auto prev = result.back();
+            pos = win.next(prev);
+
+            if (pos >= win.insts.size() || win.labeled(prev, pos)) return false;
+        }
+
+        const auto kind = win.at(pos);
+
+        if (kind == op::none || std::find(alternatives.begin(), alternatives.end(), kind) == alternatives.end()) return false;
+
+        result.push_back(pos);
+    }
+
+    return true;
+}
+
+// new indexes from the function start, labels of removed instructions move to the next
+// one and labels meeting at the same index are merged into the first
+void layout(window& win)
+{
+    std::vector<instruction::ptr> result;
+    std::unordered_map<std::uint32_t, std::uint32_t> moved;
+    std::unordered_map<std::uint32_t, std::uint32_t> renamed;
+    auto index = win.func.index;
+
+    result.reserve(win.insts.size());
+
+    for (auto i = 0u; i < win.insts.size(); i++)
+    {
+        moved.insert({ win.indexes[i], index });
+
+        if (win.insts[i] != nullptr)
+        {
+            win.insts[i]->index = index;
+            index += win.insts[i]->size;
+            result.push_back(std::move(win.insts[i]));
+        }
+    }
+
+    win.func.labels.clear();
+
+    for (const auto& [addr, id] : win.labels)
+    {
+        // anything past the instructions is the function end
+        const auto itr = moved.find(addr);
+        const auto value = itr != moved.end() ? itr->second : index;
+        const auto [entry, inserted] = win.func.labels.insert({ value, id });
+
+        if (!inserted)
+        {
+            renamed.insert({ id, entry->second });
+        }
+    }
+
+    if (!renamed.empty())
+    {
+        for (auto& inst : result)
+        {
+            for (auto& data : inst->data)
+            {
+                if (data.type() != operand::kind::label) continue;
+
+                const auto itr = renamed.find(data.as_label());
+
+                if (itr != renamed.end())
+                {
+                    data = operand::label(itr->second);
+                }
+            }
+        }
+    }
+
+    win.func.instructions = std::move(result);
+    win.func.size = index - win.func.index;
+}
+
+} // namespace
+
+void peephole::optimize(function& func, std::map<std::string, std::size_t>& stats) const
+{
+    if (func.instructions.empty()) return;
+
+    window win(ops_, func);
+    std::vector<std::size_t> pos;
+    auto changed = true;
+
+    while (changed)
+    {
+        changed = false;
+
+        for (auto i = 0u; i < win.insts.size(); i++)
+        {
+            if (win.insts[i] == nullptr) continue;
+
+            for (const auto& entry : rules)
+            {
+                if (win.insts[i] != nullptr && match(win, entry, i, pos) && entry.apply(win, pos))
+                {
+                    stats[entry.name]++;
+                    changed = true;
+                }
+            }
+        }
+    }
+
+    layout(win);
+}
+
+} // namespace xsk::gsc
@@ -0,0 +1,22 @@
+// Copyright 2021 xensik. All rights reserved.
+//
+// Use of this source code is governed by a GNU GPLv3 license
+// that can be found in the LICENSE file.
+
+#pragma once
+
+namespace xsk::gsc
+{
+
+// table driven rewrites of short instruction sequences in a compiled function. instruction
+// indexes and labels are laid out again once the function is rewritten
+class peephole
+{
+    const opcode_table& ops_;
+
+public:
+    peephole(const opcode_table& ops) : ops_(ops) {}
+    void optimize(function& func, std::map<std::string, std::size_t>& stats) const;
+};
+
+} // namespace xsk::gsc
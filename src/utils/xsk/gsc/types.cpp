@@ -16,4 +16,171 @@ void context::restrict_header(const xsk::gsc::location& loc)
     }
 }
 
+auto source_cache::load(const std::string& file, const std::function<std::vector<std::uint8_t>(const std::string&)>& read) -> source&
+{
+    auto key = utils::string::fordslash(file);
+    auto itr = entries_.find(key);
+
+    // a file that can't be checked on disk is always read again
+    std::error_code ec;
+    const auto path = std::filesystem::path(file + ".gsh");
+    const auto time = std::filesystem::last_write_time(path, ec);
+    const auto size = ec ? 0 : std::filesystem::file_size(path, ec);
+    const auto stale = ec || itr == entries_.end() || itr->second.time != time || itr->second.size != size;
+
+    if (stale)
+    {
+        auto buf = read(file + ".gsh");
+        buf.push_back(0);
+        buf.push_back(0);
+
+        if (itr == entries_.end())
+        {
+            source entry;
+            entry.name = file;
+            itr = entries_.emplace(std::move(key), std::move(entry)).first;
+        }
+
+        // the entry is updated in place, locations keep pointing to its name
+        itr->second.buf = std::move(buf);
+        itr->second.time = time;
+        itr->second.size = size;
+    }
+
+    loaded_.push_back(itr->second.name + ".gsh");
+
+    return itr->second;
+}
+
+// files of the sources handed out since the last clear, cached or not
+auto source_cache::loaded() const -> const std::vector<std::string>&
+{
+    return loaded_;
+}
+
+void source_cache::clear_loaded()
+{
+    loaded_.clear();
+}
+
+auto operand::integer(std::int32_t value) -> operand
+{
+    operand result;
+    result.kind_ = kind::integer;
+    result.int_ = value;
+    return result;
+}
+
+// a float literal, integral values keep a point so they don't read back as integers
+auto operand::floating(float value) -> operand
+{
+    operand result;
+    result.kind_ = kind::floating;
+    result.float_ = value;
+    return result;
+}
+
+// one of the three floats of a vector, printed without the point
+auto operand::component(float value) -> operand
+{
+    operand result;
+    result.kind_ = kind::component;
+    result.float_ = value;
+    return result;
+}
+
+// label ids are the index of the labeled instruction once disassembled, the compiler and
+// the passes over compiled functions number theirs from 1
+auto operand::label(std::uint32_t id) -> operand
+{
+    operand result;
+    result.kind_ = kind::label;
+    result.int_ = static_cast<std::int32_t>(id);
+    return result;
+}
+
+// an id read from or resolved for the bytecode, the name is what gets printed
+auto operand::id(std::uint32_t value, std::string name) -> operand
+{
+    operand result(std::move(name));
+    result.kind_ = kind::id;
+    result.int_ = static_cast<std::int32_t>(value);
+    return result;
+}
+
+// a local function by its position in the script, the name is kept for printing
+auto operand::function(std::uint32_t index, std::string name) -> operand
+{
+    operand result(std::move(name));
+    result.kind_ = kind::function;
+    result.int_ = static_cast<std::int32_t>(index);
+    return result;
+}
+
+auto operand::label_name(std::uint32_t id) -> std::string
+{
+    return utils::string::va("loc_%X", id);
+}
+
+auto operand::label_id(const std::string& name) -> std::uint32_t
+{
+    if (name.size() > 4 && name.compare(0, 4, "loc_") == 0 && name.find_first_not_of("0123456789abcdefABCDEF", 4) == std::string::npos)
+    {
+        return static_cast<std::uint32_t>(std::stoul(name.substr(4), nullptr, 16));
+    }
+
+    throw std::runtime_error("invalid label '" + name + "'");
+}
+
+auto operand::as_int() const -> std::int32_t
+{
+    if (kind_ == kind::integer || kind_ == kind::id || kind_ == kind::label || kind_ == kind::function) return int_;
+    if (kind_ == kind::floating || kind_ == kind::component) return static_cast<std::int32_t>(float_);
+
+    return std::stoi(text_);
+}
+
+auto operand::as_uint() const -> std::uint32_t
+{
+    if (kind_ == kind::integer || kind_ == kind::id || kind_ == kind::label || kind_ == kind::function) return static_cast<std::uint32_t>(int_);
+    if (kind_ == kind::floating || kind_ == kind::component) return static_cast<std::uint32_t>(float_);
+
+    return static_cast<std::uint32_t>(std::stoul(text_));
+}
+
+auto operand::as_float() const -> float
+{
+    if (kind_ == kind::floating || kind_ == kind::component) return float_;
+    if (kind_ == kind::integer) return static_cast<float>(int_);
+
+    return std::stof(text_);
+}
+
+auto operand::as_label() const -> std::uint32_t
+{
+    if (kind_ == kind::label) return static_cast<std::uint32_t>(int_);
+
+    return label_id(text_);
+}
+
+// returned by value, numbers are formatted here so nothing is cached across threads
+auto operand::str() const -> std::string
+{
+    switch (kind_)
+    {
+        case kind::integer:
+            return std::to_string(int_);
+        case kind::floating:
+            return utils::string::va("%g%s", float_, float_ == int(float_) ? ".0" : "");
+        case kind::component:
+            return utils::string::va("%g", float_);
+        case kind::label:
+            return label_name(static_cast<std::uint32_t>(int_));
+        case kind::function:
+            return "sub_" + text_;
+        default:
+            return text_;
+    }
+}
+
 } // namespace xsk::gsc
@@ -26,6 +26,22 @@ struct source
 {
     std::string name;
     std::vector<std::uint8_t> buf;
+    std::filesystem::file_time_type time;
+    std::uintmax_t size;
+};
+
+// gsh sources by normalized path, a compiler keeps them across compilations and
+// reads a file again once it changed on disk. buffers carry the two NUL bytes flex
+// needs, the lexer scans a copy
+class source_cache
+{
+    std::unordered_map<std::string, source> entries_;
+    std::vector<std::string> loaded_;
+
+public:
+    auto load(const std::string& file, const std::function<std::vector<std::uint8_t>(const std::string&)>& read) -> source&;
+    auto loaded() const -> const std::vector<std::string>&;
+    void clear_loaded();
 };
 
 struct context
@@ -37,7 +53,7 @@ struct context
     xsk::gsc::build mode;
     xsk::gsc::location loc;
     std::stack<xsk::gsc::location> locs;
-    std::vector<xsk::gsc::source>* sources;
+    xsk::gsc::source_cache* sources;
     std::function<std::vector<std::uint8_t>(const std::string&)> read_callback;
 
     void restrict_header(const xsk::gsc::location& loc);
@@ -57,6 +73,62 @@ struct animtree_t
     bool loaded;
 };
 
+// instruction operand, numbers, labels, local function refs and resolved ids keep their
+// binary value and are only formatted when their text is asked for. text operands come
+// from a .gscasm and are parsed when read
+class operand
+{
+public:
+    enum class kind : std::uint8_t { text, integer, label, floating, id, component, function };
+
+private:
+    kind kind_;
+    union
+    {
+        std::int32_t int_;
+        float float_;
+    };
+    std::string text_;
+
+public:
+    operand() : kind_(kind::text), int_(0) {}
+    operand(const std::string& text) : kind_(kind::text), int_(0), text_(text) {}
+    operand(std::string&& text) : kind_(kind::text), int_(0), text_(std::move(text)) {}
+    operand(const char* text) : kind_(kind::text), int_(0), text_(text) {}
+
+    static auto integer(std::int32_t value) -> operand;
+    static auto floating(float value) -> operand;
+    static auto component(float value) -> operand;
+    static auto label(std::uint32_t id) -> operand;
+    static auto id(std::uint32_t value, std::string name) -> operand;
+    static auto function(std::uint32_t index, std::string name) -> operand;
+    static auto label_name(std::uint32_t id) -> std::string;
+    static auto label_id(const std::string& name) -> std::uint32_t;
+
+    auto type() const -> kind { return kind_; }
+    auto as_int() const -> std::int32_t;
+    auto as_uint() const -> std::uint32_t;
+    auto as_float() const -> float;
+    auto as_label() const -> std::uint32_t;
+    auto str() const -> std::string;
+
+    operator std::string() const { return str(); }
+    auto size() const -> std::size_t { return has_text() ? text_.size() : str().size(); }
+    auto substr(std::size_t pos, std::size_t count = std::string::npos) const -> std::string { return has_text() ? text_.substr(pos, count) : str().substr(pos, count); }
+
+    friend auto operator==(const operand& lhs, const std::string& rhs) -> bool { return lhs.has_text() ? lhs.text_ == rhs : lhs.str() == rhs; }
+    friend auto operator==(const operand& lhs, const char* rhs) -> bool { return lhs.has_text() ? lhs.text_ == rhs : lhs.str() == rhs; }
+    friend auto operator!=(const operand& lhs, const std::string& rhs) -> bool { return !(lhs == rhs); }
+    friend auto operator!=(const operand& lhs, const char* rhs) -> bool { return !(lhs == rhs); }
+    friend auto operator+(const std::string& lhs, const operand& rhs) -> std::string { return lhs + rhs.str(); }
+    friend auto operator+(const char* lhs, const operand& rhs) -> std::string { return lhs + rhs.str(); }
+    friend auto operator+(const operand& lhs, const std::string& rhs) -> std::string { return lhs.str() + rhs; }
+    friend auto operator+(const operand& lhs, const char* rhs) -> std::string { return lhs.str() + rhs; }
+
+private:
+    auto has_text() const -> bool { return kind_ == kind::text || kind_ == kind::id; }
+};
+
 struct instruction
 {
     using ptr = std::unique_ptr<instruction>;
@@ -64,7 +136,7 @@ struct instruction
     std::uint32_t index;
     std::uint32_t size;
     std::uint8_t opcode;
-    std::vector<std::string> data;
+    std::vector<operand> data;
 
     instruction() : index(0), size(0), opcode(0xFF) {}
 };
@@ -78,7 +150,7 @@ struct function
     std::uint32_t id;
     std::string name;
     std::vector<instruction::ptr> instructions;
-    std::unordered_map<std::uint32_t, std::string> labels;
+    std::unordered_map<std::uint32_t, std::uint32_t> labels;
 
     function() : index(0), size(0), id(0) {}
 };
@@ -9,14 +9,29 @@
 #include "utils/file.hpp"
 #include "utils/string.hpp"
 #include "utils/byte_buffer.hpp"
+#include "utils/hash.hpp"
 #include "utils/compression.hpp"
+#include "utils/thread_pool.hpp"
+#include "utils/interner.hpp"
+#include "utils/node_pool.hpp"
 
 // GSC Types
 #include "gsc/location.hpp"
 #include "gsc/types.hpp"
 #include "gsc/asset.hpp"
+#include "gsc/ir.hpp"
+#include "gsc/include_cache.hpp"
+#include "gsc/build_cache.hpp"
 #include "gsc/block.hpp"
 #include "gsc/nodetree.hpp"
+#include "gsc/optimizer.hpp"
+#include "gsc/inliner.hpp"
+#include "gsc/opcode_table.hpp"
+#include "gsc/flow_graph.hpp"
+#include "gsc/peephole.hpp"
+#include "gsc/local_allocator.hpp"
+#include "gsc/lookup.hpp"
+#include "gsc/asm_reader.hpp"
 
 // GSC Interfaces
 #include "gsc/interfaces/exception.hpp"
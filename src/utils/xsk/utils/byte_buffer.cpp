@@ -8,27 +8,26 @@
 namespace xsk::utils
 {
 
-byte_buffer::byte_buffer()
+byte_buffer::byte_buffer() : view_(nullptr), view_size_(0), pos_(0)
 {
-    data_.resize(0x1000000);
-    std::fill(data_.begin(), data_.end(), 0);
-    size_ = data_.size();
-    pos_ = 0;
 }
 
-byte_buffer::byte_buffer(std::size_t size)
+byte_buffer::byte_buffer(std::size_t reserve) : view_(nullptr), view_size_(0), pos_(0)
 {
-    data_.resize(size);
-    std::fill(data_.begin(), data_.end(), 0);
-    size_ = size;
-    pos_ = 0;
+    data_.reserve(reserve);
 }
 
-byte_buffer::byte_buffer(const std::vector<std::uint8_t>& data)
+byte_buffer::byte_buffer(const std::vector<std::uint8_t>& data) : data_(data), view_(nullptr), view_size_(0), pos_(0)
+{
+}
+
+byte_buffer::byte_buffer(std::vector<std::uint8_t>&& data) : data_(std::move(data)), view_(nullptr), view_size_(0), pos_(0)
+{
+}
+
+// read-only view over external memory, it's copied on the first write
+byte_buffer::byte_buffer(const std::uint8_t* data, std::size_t size) : view_(data), view_size_(size), pos_(0)
 {
-    data_ = data;
-    size_ = data.size();
-    pos_ = 0;
 }
 
 byte_buffer::~byte_buffer()
@@ -39,12 +38,21 @@ byte_buffer::~byte_buffer()
 
 void byte_buffer::clear()
 {
-    std::fill(data_.begin(), data_.end(), 0);
+    view_ = nullptr;
+    view_size_ = 0;
+    data_.clear();
+    pos_ = 0;
+}
+
+void byte_buffer::reserve(std::size_t size)
+{
+    detach();
+    data_.reserve(size);
 }
 
 auto byte_buffer::is_avail() -> bool
 {
-    if (pos_ < data_.size()) return true;
+    if (pos_ < size()) return true;
     return false;
 }
 
@@ -57,32 +65,54 @@ void byte_buffer::seek_neg(std::size_t pos)
     pos_ -= pos;
 }
 
+void byte_buffer::write_bytes(const std::uint8_t* data, std::size_t size)
+{
+    if (size == 0) return;
+
+    std::memcpy(alloc(size), data, size);
+}
+
 void byte_buffer::write_string(const std::string& data)
 {
-    strcpy(reinterpret_cast<char*>(data_.data() + pos_), data.data());
-    pos_ += data.size();
+    write_bytes(reinterpret_cast<const std::uint8_t*>(data.data()), data.size());
 }
 
 void byte_buffer::write_c_string(const std::string& data)
 {
-    strcpy(reinterpret_cast<char*>(data_.data() + pos_), data.data());
-    pos_ += data.size() + 1;
+    std::memcpy(alloc(data.size() + 1), data.c_str(), data.size() + 1);
 }
 
 auto byte_buffer::read_c_string() -> std::string
 {
-    auto ret = std::string(reinterpret_cast<const char*>(data_.data() + pos_));
+    const auto* base = (view_ != nullptr) ? view_ : data_.data();
+    const auto* begin = reinterpret_cast<const char*>(base + std::min(pos_, size()));
+    const auto* end = reinterpret_cast<const char*>(base + size());
+    const auto* term = std::find(begin, end, '\0');
+
+    if (term == end)
+    {
+        throw std::runtime_error(utils::string::va("Couldn't read string at offset 0x%zX, missing terminator", pos_));
+    }
+
+    auto ret = std::string(begin, term);
     pos_ += ret.size() + 1;
     return ret;
 }
 
+auto byte_buffer::read_string(std::size_t size) -> std::string
+{
+    return std::string(reinterpret_cast<const char*>(fetch(size)), size);
+}
+
 auto byte_buffer::print_bytes(std::size_t pos, std::size_t count) -> std::string
 {
     std::string shit;
     
-    for (auto i = pos; i < pos + count; i++)
+    const auto* base = (view_ != nullptr) ? view_ : data_.data();
+
+    for (auto i = pos; i < pos + count && i < size(); i++)
     {
-        shit += utils::string::va("%s %02X", shit.data(), (*reinterpret_cast<std::uint8_t*>(data_.data() + i)));
+        shit += utils::string::va("%s %02X", shit.data(), base[i]);
     }
 
     return shit;
@@ -93,9 +123,67 @@ auto byte_buffer::pos() -> std::size_t
     return pos_;
 }
 
+auto byte_buffer::size() -> std::size_t
+{
+    return (view_ != nullptr) ? view_size_ : data_.size();
+}
+
 auto byte_buffer::buffer() -> std::vector<std::uint8_t>&
 {
+    detach();
     return data_;
 }
 
+auto byte_buffer::release() -> std::vector<std::uint8_t>
+{
+    detach();
+    pos_ = 0;
+    return std::move(data_);
+}
+
+auto byte_buffer::fetch(std::size_t size) -> const std::uint8_t*
+{
+    const auto total = this->size();
+
+    if (pos_ > total || size > total - pos_)
+    {
+        throw std::runtime_error(utils::string::va("Couldn't read %zu bytes at offset 0x%zX, buffer size is 0x%zX", size, pos_, total));
+    }
+
+    const auto* mem = ((view_ != nullptr) ? view_ : data_.data()) + pos_;
+    pos_ += size;
+    return mem;
+}
+
+auto byte_buffer::alloc(std::size_t size) -> std::uint8_t*
+{
+    detach();
+
+    const auto end = pos_ + size;
+
+    if (end > data_.size())
+    {
+        // grow geometrically, only the bytes being written get initialized
+        if (end > data_.capacity())
+        {
+            data_.reserve(std::max(end, data_.capacity() * 2));
+        }
+
+        data_.resize(end);
+    }
+
+    auto* mem = data_.data() + pos_;
+    pos_ = end;
+    return mem;
+}
+
+void byte_buffer::detach()
+{
+    if (view_ == nullptr) return;
+
+    data_.assign(view_, view_ + view_size_);
+    view_ = nullptr;
+    view_size_ = 0;
+}
+
 } // namespace xsk::utils
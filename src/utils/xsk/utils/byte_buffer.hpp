@@ -15,69 +15,106 @@ public:
 
 private:
     std::vector<std::uint8_t> data_;
-    std::size_t size_;
+    const std::uint8_t* view_;
+    std::size_t view_size_;
     std::size_t pos_;
 
 public:
     byte_buffer();
-    byte_buffer(std::size_t size);
+    byte_buffer(std::size_t reserve);
     byte_buffer(const std::vector<std::uint8_t>& data);
+    byte_buffer(std::vector<std::uint8_t>&& data);
+    byte_buffer(const std::uint8_t* data, std::size_t size);
     ~byte_buffer();
 
     template <typename T>
     auto read() -> T
     {
-        auto ret = *reinterpret_cast<T*>(data_.data() + pos_);
-        pos_ += sizeof(T);
+        T ret;
+        std::memcpy(&ret, fetch(sizeof(T)), sizeof(T));
         return ret;
     }
 
     template <typename T>
     void write(T data)
     {
-        T* mem = reinterpret_cast<T*>(data_.data() + pos_);
-        std::memcpy(mem, &data, sizeof(T));
-        pos_ += sizeof(T);
+        std::memcpy(alloc(sizeof(T)), &data, sizeof(T));
     }
 
     template <typename T>
     auto read_endian() -> T
     {
         std::array<std::uint8_t, sizeof(T)> mem;
+        const auto* src = fetch(sizeof(T));
 
         for (auto i = 0; i < sizeof(T); i++)
         {
-            mem[i] = reinterpret_cast<std::uint8_t*>(data_.data() + pos_)[sizeof(T) - 1 - i];
+            mem[i] = src[sizeof(T) - 1 - i];
         }
 
-        pos_ += sizeof(T);
-
-        return *reinterpret_cast<T*>(mem.data());
+        T ret;
+        std::memcpy(&ret, mem.data(), sizeof(T));
+        return ret;
     }
 
     template <typename T>
     void write_endian(T data)
     {
-        auto* mem = data_.data() + pos_;
+        auto* mem = alloc(sizeof(T));
 
         for (auto i = 0; i < sizeof(T); i++)
         {
             mem[i] = reinterpret_cast<std::uint8_t*>(&data)[sizeof(T) - 1 - i];
         }
+    }
+
+    // byte by byte, low to high, so files written with these read back on any host
+    template <typename T>
+    auto read_le() -> T
+    {
+        const auto* src = fetch(sizeof(T));
+        auto bits = std::make_unsigned_t<T>(0);
+
+        for (auto i = 0u; i < sizeof(T); i++)
+        {
+            bits |= static_cast<std::make_unsigned_t<T>>(src[i]) << (i * 8);
+        }
 
-        pos_ += sizeof(T);
+        return static_cast<T>(bits);
+    }
+
+    template <typename T>
+    void write_le(T data)
+    {
+        auto* mem = alloc(sizeof(T));
+        auto bits = static_cast<std::make_unsigned_t<T>>(data);
+
+        for (auto i = 0u; i < sizeof(T); i++)
+        {
+            mem[i] = static_cast<std::uint8_t>(bits >> (i * 8));
+        }
     }
 
     void clear();
+    void reserve(std::size_t size);
     auto is_avail() -> bool;
     void seek(std::size_t pos);
     void seek_neg(std::size_t pos);
+    void write_bytes(const std::uint8_t* data, std::size_t size);
     void write_string(const std::string& data);
     void write_c_string(const std::string& data);
     auto read_c_string() -> std::string;
+    auto read_string(std::size_t size) -> std::string;
     auto print_bytes(std::size_t pos, std::size_t count) -> std::string;
     auto pos() -> std::size_t;
+    auto size() -> std::size_t;
     auto buffer() -> std::vector<std::uint8_t>&;
+    auto release() -> std::vector<std::uint8_t>;
+
+private:
+    auto fetch(std::size_t size) -> const std::uint8_t*;
+    auto alloc(std::size_t size) -> std::uint8_t*;
+    void detach();
 };
 
 } // namespace xsk::utils
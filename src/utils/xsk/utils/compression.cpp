@@ -9,32 +9,178 @@
 namespace xsk::utils
 {
 
-auto zlib::compress(const std::vector<std::uint8_t>& data) -> std::vector<std::uint8_t>
+namespace
 {
-    auto length = compressBound(static_cast<uLong>(data.size()));
 
-    std::vector<std::uint8_t> output;
-    output.resize(length);
+constexpr std::size_t chunk_size = 0x10000;
 
-    auto result = compress2(reinterpret_cast<Bytef*>(output.data()), &length, reinterpret_cast<const Bytef*>(data.data()), static_cast<uLong>(data.size()), Z_BEST_COMPRESSION);
-    
-    if (result != Z_OK) return {};
+// zlib counts bytes in uInt, bigger inputs are handed over in slices
+constexpr std::size_t slice_size = 0x40000000;
 
-    output.resize(length);
-    
-    return output;
+} // namespace
+
+zlib::deflater::deflater(std::int32_t level) : stream_(std::make_unique<z_stream>())
+{
+    if (deflateInit(stream_.get(), level) != Z_OK)
+    {
+        throw std::runtime_error(utils::string::va("Couldn't initialize deflate with level %d", level));
+    }
+}
+
+zlib::deflater::~deflater()
+{
+    deflateEnd(stream_.get());
+}
+
+void zlib::deflater::write(const std::uint8_t* data, std::size_t size)
+{
+    run(data, size, Z_NO_FLUSH);
+}
+
+auto zlib::deflater::finish() -> std::vector<std::uint8_t>
+{
+    run(nullptr, 0, Z_FINISH);
+
+    return std::move(output_);
+}
+
+void zlib::deflater::run(const std::uint8_t* data, std::size_t size, std::int32_t flush)
+{
+    do
+    {
+        const auto slice = std::min(size, slice_size);
+
+        stream_->next_in = const_cast<Bytef*>(data);
+        stream_->avail_in = static_cast<uInt>(slice);
+        data += slice;
+        size -= slice;
+
+        do
+        {
+            const auto pos = output_.size();
+            output_.resize(pos + chunk_size);
+
+            stream_->next_out = output_.data() + pos;
+            stream_->avail_out = static_cast<uInt>(chunk_size);
+
+            const auto result = deflate(stream_.get(), size == 0 ? flush : Z_NO_FLUSH);
+
+            output_.resize(pos + chunk_size - stream_->avail_out);
+
+            if (result == Z_STREAM_ERROR)
+            {
+                throw std::runtime_error("Couldn't deflate data, stream error");
+            }
+        }
+        while (stream_->avail_out == 0);
+    }
+    while (size > 0);
+}
+
+zlib::inflater::inflater(std::size_t limit) : stream_(std::make_unique<z_stream>()), limit_(limit), done_(false)
+{
+    if (inflateInit(stream_.get()) != Z_OK)
+    {
+        throw std::runtime_error("Couldn't initialize inflate");
+    }
+}
+
+zlib::inflater::~inflater()
+{
+    inflateEnd(stream_.get());
+}
+
+// true once the end of the stream was read, anything after it is ignored
+auto zlib::inflater::write(const std::uint8_t* data, std::size_t size) -> bool
+{
+    while (size > 0 && !done_)
+    {
+        const auto slice = std::min(size, slice_size);
+
+        stream_->next_in = const_cast<Bytef*>(data);
+        stream_->avail_in = static_cast<uInt>(slice);
+
+        do
+        {
+            // one byte of room past the limit tells a longer stream apart from an exact fit
+            const auto pos = output_.size();
+            const auto room = (limit_ - pos < chunk_size) ? limit_ - pos + 1 : chunk_size;
+            output_.resize(pos + room);
+
+            stream_->next_out = output_.data() + pos;
+            stream_->avail_out = static_cast<uInt>(room);
+
+            const auto result = inflate(stream_.get(), Z_NO_FLUSH);
+
+            output_.resize(pos + room - stream_->avail_out);
+
+            if (output_.size() > limit_)
+            {
+                throw std::runtime_error(utils::string::va("Couldn't inflate data, output exceeds 0x%zX bytes", limit_));
+            }
+
+            if (result == Z_STREAM_END)
+            {
+                done_ = true;
+                break;
+            }
+
+            if (result != Z_OK && result != Z_BUF_ERROR)
+            {
+                throw std::runtime_error(utils::string::va("Couldn't inflate data, %s", stream_->msg ? stream_->msg : "stream error"));
+            }
+        }
+        while (stream_->avail_out == 0);
+
+        const auto used = slice - stream_->avail_in;
+        data += used;
+        size -= used;
+
+        if (used == 0 && !done_) break;
+    }
+
+    return done_;
+}
+
+auto zlib::inflater::finish() -> std::vector<std::uint8_t>
+{
+    if (!done_)
+    {
+        throw std::runtime_error("Couldn't inflate data, stream is truncated");
+    }
+
+    return std::move(output_);
+}
+
+auto zlib::compress(const std::vector<std::uint8_t>& data, std::int32_t level) -> std::vector<std::uint8_t>
+{
+    deflater stream(level);
+
+    stream.write(data.data(), data.size());
+
+    return stream.finish();
 }
 
 auto zlib::decompress(const std::vector<std::uint8_t>& data, std::uint32_t length) -> std::vector<std::uint8_t>
 {
-    std::vector<std::uint8_t> output;
-    output.resize(length);
+    return decompress(data.data(), data.size(), length);
+}
+
+// the recorded length is only a bound, the stream has to end exactly there
+auto zlib::decompress(const std::uint8_t* data, std::size_t size, std::uint32_t length) -> std::vector<std::uint8_t>
+{
+    inflater stream(length);
+
+    stream.write(data, size);
 
-    auto result = uncompress(output.data(), (uLongf*)&length, (Bytef*)data.data(), data.size());
+    auto output = stream.finish();
 
-    if (result != Z_OK) return {};
+    if (output.size() != length)
+    {
+        throw std::runtime_error(utils::string::va("Couldn't inflate data, got 0x%zX bytes instead of 0x%X", output.size(), length));
+    }
 
     return output;
 }
 
-} // namespace xsk::uitls
+} // namespace xsk::utils
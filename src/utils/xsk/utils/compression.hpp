@@ -5,14 +5,51 @@
 
 #pragma once
 
+struct z_stream_s;
+
 namespace xsk::utils
 {
 
 class zlib
 {
 public:
-    static auto compress(const std::vector<std::uint8_t>& data) -> std::vector<std::uint8_t>;
+    static constexpr std::int32_t fastest = 1;
+    static constexpr std::int32_t best = 9;
+
+    // deflate fed in any number of chunks, the output is the same as a single compress call
+    class deflater
+    {
+        std::unique_ptr<z_stream_s> stream_;
+        std::vector<std::uint8_t> output_;
+
+    public:
+        deflater(std::int32_t level = best);
+        ~deflater();
+        void write(const std::uint8_t* data, std::size_t size);
+        auto finish() -> std::vector<std::uint8_t>;
+
+    private:
+        void run(const std::uint8_t* data, std::size_t size, std::int32_t flush);
+    };
+
+    // inflate fed in any number of chunks, never grows the output past limit
+    class inflater
+    {
+        std::unique_ptr<z_stream_s> stream_;
+        std::vector<std::uint8_t> output_;
+        std::size_t limit_;
+        bool done_;
+
+    public:
+        inflater(std::size_t limit = std::numeric_limits<std::size_t>::max());
+        ~inflater();
+        auto write(const std::uint8_t* data, std::size_t size) -> bool;
+        auto finish() -> std::vector<std::uint8_t>;
+    };
+
+    static auto compress(const std::vector<std::uint8_t>& data, std::int32_t level = best) -> std::vector<std::uint8_t>;
     static auto decompress(const std::vector<std::uint8_t>& data, std::uint32_t length) -> std::vector<std::uint8_t>;
+    static auto decompress(const std::uint8_t* data, std::size_t size, std::uint32_t length) -> std::vector<std::uint8_t>;
 };
 
 } // namespace xsk::utils
@@ -5,9 +5,85 @@
 
 #include "stdafx.hpp"
 
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
 namespace xsk::utils
 {
 
+file_view::file_view() : data_(nullptr), size_(0), mapping_(nullptr)
+{
+}
+
+file_view::file_view(file_view&& other) noexcept : file_view()
+{
+    *this = std::move(other);
+}
+
+file_view::~file_view()
+{
+    unmap();
+}
+
+auto file_view::operator=(file_view&& other) noexcept -> file_view&
+{
+    if (this != &other)
+    {
+        unmap();
+
+        buffer_ = std::move(other.buffer_);
+        mapping_ = other.mapping_;
+        size_ = other.size_;
+        data_ = (mapping_ != nullptr) ? other.data_ : buffer_.data();
+
+        other.data_ = nullptr;
+        other.size_ = 0;
+        other.mapping_ = nullptr;
+    }
+
+    return *this;
+}
+
+auto file_view::data() const -> const std::uint8_t*
+{
+    return data_;
+}
+
+auto file_view::size() const -> std::size_t
+{
+    return size_;
+}
+
+auto file_view::mapped() const -> bool
+{
+    return mapping_ != nullptr;
+}
+
+void file_view::unmap()
+{
+    if (mapping_ != nullptr)
+    {
+#ifdef _WIN32
+        UnmapViewOfFile(mapping_);
+#else
+        munmap(mapping_, size_);
+#endif
+    }
+
+    buffer_.clear();
+    data_ = nullptr;
+    size_ = 0;
+    mapping_ = nullptr;
+}
+
 auto file::read(const std::string& file) -> std::vector<std::uint8_t>
 {
     std::vector<std::uint8_t> data;
@@ -34,6 +110,71 @@ auto file::read(const std::string& file) -> std::vector<std::uint8_t>
     return data;
 }
 
+auto file::map(const std::string& file) -> file_view
+{
+    file_view view;
+
+#ifdef _WIN32
+    auto handle = CreateFileA(file.data(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+
+    if (handle != INVALID_HANDLE_VALUE)
+    {
+        LARGE_INTEGER size;
+
+        if (GetFileSizeEx(handle, &size) && size.QuadPart > 0)
+        {
+            auto mapping = CreateFileMappingA(handle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+
+            if (mapping != nullptr)
+            {
+                view.mapping_ = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+                CloseHandle(mapping);
+            }
+
+            if (view.mapping_ != nullptr)
+            {
+                view.size_ = static_cast<std::size_t>(size.QuadPart);
+            }
+        }
+
+        CloseHandle(handle);
+    }
+#else
+    auto fd = open(file.data(), O_RDONLY);
+
+    if (fd != -1)
+    {
+        struct stat info;
+
+        if (fstat(fd, &info) == 0 && info.st_size > 0)
+        {
+            auto mem = mmap(nullptr, static_cast<std::size_t>(info.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+
+            if (mem != MAP_FAILED)
+            {
+                view.mapping_ = mem;
+                view.size_ = static_cast<std::size_t>(info.st_size);
+            }
+        }
+
+        close(fd);
+    }
+#endif
+
+    if (view.mapping_ != nullptr)
+    {
+        view.data_ = reinterpret_cast<const std::uint8_t*>(view.mapping_);
+        return view;
+    }
+
+    // empty files and platforms without mapping support use a buffered read
+    view.buffer_ = read(file);
+    view.data_ = view.buffer_.data();
+    view.size_ = view.buffer_.size();
+
+    return view;
+}
+
 void file::save(const std::string& file, const std::vector<std::uint8_t>& data)
 {
     const auto pos = file.find_last_of("/\\");
@@ -52,6 +193,25 @@ void file::save(const std::string& file, const std::vector<std::uint8_t>& data)
     }
 }
 
+auto file::create(const std::string& file) -> std::ofstream
+{
+    const auto pos = file.find_last_of("/\\");
+
+    if (pos != std::string::npos)
+    {
+        std::filesystem::create_directories(file.substr(0, pos));
+    }
+
+    std::ofstream stream(file, std::ios::binary | std::ofstream::out);
+
+    if (!stream.is_open())
+    {
+        throw std::runtime_error("Couldn't create file " + file);
+    }
+
+    return stream;
+}
+
 auto file::length(const std::string& file) -> size_t
 {
     auto stream = std::ifstream(file, std::ios::binary);
@@ -8,11 +8,39 @@
 namespace xsk::utils
 {
 
+// read-only view of a whole file, memory mapped when the platform allows it
+class file_view
+{
+    const std::uint8_t* data_;
+    std::size_t size_;
+    std::vector<std::uint8_t> buffer_;
+    void* mapping_;
+
+public:
+    file_view();
+    file_view(file_view&& other) noexcept;
+    file_view(const file_view&) = delete;
+    ~file_view();
+
+    auto operator=(file_view&& other) noexcept -> file_view&;
+    auto operator=(const file_view&) -> file_view& = delete;
+
+    auto data() const -> const std::uint8_t*;
+    auto size() const -> std::size_t;
+    auto mapped() const -> bool;
+
+private:
+    friend class file;
+    void unmap();
+};
+
 class file
 {
 public:
     static auto read(const std::string& file) -> std::vector<std::uint8_t>;
+    static auto map(const std::string& file) -> file_view;
     static void save(const std::string& file, const std::vector<std::uint8_t>& data);
+    static auto create(const std::string& file) -> std::ofstream;
     static auto length(const std::string& file) -> size_t;
     static auto exists(const std::string& file) -> bool;
 };
@@ -0,0 +1,32 @@
+// Copyright 2021 xensik. All rights reserved.
+//
+// Use of this source code is governed by a GNU GPLv3 license
+// that can be found in the LICENSE file.
+
+#include "stdafx.hpp"
+
+namespace xsk::utils
+{
+
+auto hash::fnv1a(const std::uint8_t* data, std::size_t size, std::uint64_t value) -> std::uint64_t
+{
+    for (auto i = 0u; i < size; i++)
+    {
+        value ^= data[i];
+        value *= 0x100000001B3ull;
+    }
+
+    return value;
+}
+
+auto hash::fnv1a(const std::vector<std::uint8_t>& data, std::uint64_t value) -> std::uint64_t
+{
+    return fnv1a(data.data(), data.size(), value);
+}
+
+auto hash::fnv1a(const std::string& data, std::uint64_t value) -> std::uint64_t
+{
+    return fnv1a(reinterpret_cast<const std::uint8_t*>(data.data()), data.size(), value);
+}
+
+} // namespace xsk::utils
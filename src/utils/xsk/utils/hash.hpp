@@ -0,0 +1,37 @@
+// Copyright 2021 xensik. All rights reserved.
+//
+// Use of this source code is governed by a GNU GPLv3 license
+// that can be found in the LICENSE file.
+
+#pragma once
+
+namespace xsk::utils
+{
+
+// 64-bit FNV-1a, value chains a hash over several parts
+class hash
+{
+public:
+    static constexpr std::uint64_t basis = 0xCBF29CE484222325ull;
+
+    static auto fnv1a(const std::uint8_t* data, std::size_t size, std::uint64_t value = basis) -> std::uint64_t;
+    static auto fnv1a(const std::vector<std::uint8_t>& data, std::uint64_t value = basis) -> std::uint64_t;
+    static auto fnv1a(const std::string& data, std::uint64_t value = basis) -> std::uint64_t;
+
+    // the bytes of an integer low to high, so the value is the same on every host
+    template <typename T>
+    static auto fnv1a_le(T data, std::uint64_t value = basis) -> std::uint64_t
+    {
+        auto bits = static_cast<std::make_unsigned_t<T>>(data);
+
+        for (auto i = 0u; i < sizeof(T); i++)
+        {
+            value ^= static_cast<std::uint8_t>(bits >> (i * 8));
+            value *= 0x100000001B3ull;
+        }
+
+        return value;
+    }
+};
+
+} // namespace xsk::utils
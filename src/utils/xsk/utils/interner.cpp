@@ -0,0 +1,91 @@
+// Copyright 2021 xensik. All rights reserved.
+//
+// Use of this source code is governed by a GNU GPLv3 license
+// that can be found in the LICENSE file.
+
+#include "stdafx.hpp"
+
+namespace xsk::utils
+{
+
+namespace
+{
+
+thread_local interner* current_table = nullptr;
+
+} // namespace
+
+interner::scope::scope(interner& table) : prev_(current_table)
+{
+    current_table = &table;
+}
+
+interner::scope::~scope()
+{
+    current_table = prev_;
+}
+
+auto interner::get(std::string_view value) -> const entry&
+{
+    {
+        std::shared_lock<std::shared_mutex> lock(mutex_);
+
+        const auto itr = index_.find(value);
+
+        if (itr != index_.end())
+            return *itr->second;
+    }
+
+    std::unique_lock<std::shared_mutex> lock(mutex_);
+
+    const auto itr = index_.find(value);
+
+    if (itr != index_.end())
+        return *itr->second;
+
+    entries_.push_back({ std::string(value), static_cast<handle>(entries_.size()) });
+
+    const auto& result = entries_.back();
+    index_.insert({ result.value, &result });
+
+    return result;
+}
+
+auto interner::at(handle id) -> const entry&
+{
+    std::shared_lock<std::shared_mutex> lock(mutex_);
+
+    if (id >= entries_.size())
+        throw std::runtime_error("Couldn't find interned string " + std::to_string(id));
+
+    return entries_[id];
+}
+
+// only once nothing refers to the entries anymore
+void interner::clear()
+{
+    std::unique_lock<std::shared_mutex> lock(mutex_);
+
+    index_.clear();
+    entries_.clear();
+}
+
+auto interner::intern(std::string_view value) -> const entry&
+{
+    return current().get(value);
+}
+
+auto interner::find(handle id) -> const entry&
+{
+    return current().at(id);
+}
+
+auto interner::current() -> interner&
+{
+    if (current_table == nullptr)
+        throw std::runtime_error("Couldn't intern a string outside of an interner scope");
+
+    return *current_table;
+}
+
+} // namespace xsk::utils
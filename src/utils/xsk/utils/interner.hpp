@@ -0,0 +1,60 @@
+// Copyright 2021 xensik. All rights reserved.
+//
+// Use of this source code is governed by a GNU GPLv3 license
+// that can be found in the LICENSE file.
+
+#pragma once
+
+namespace xsk::utils
+{
+
+// string table of one compile or decompile. a scope makes it the table the static
+// functions use on the current thread, entries stay valid until the table is cleared.
+// only syntax tree identifiers and string literals are interned, instructions outlive
+// the table (assembled, saved as ir) so their labels and local calls are numbered in
+// operand and the remaining text operands keep their own strings
+class interner
+{
+public:
+    using handle = std::uint32_t;
+
+    struct entry
+    {
+        std::string value;
+        handle id;
+    };
+
+    class scope
+    {
+        interner* prev_;
+
+    public:
+        scope(interner& table);
+        scope(const scope&) = delete;
+        ~scope();
+
+        auto operator=(const scope&) -> scope& = delete;
+    };
+
+private:
+    std::shared_mutex mutex_;
+    std::deque<entry> entries_;
+    std::unordered_map<std::string_view, const entry*> index_;
+
+public:
+    interner() = default;
+    interner(const interner&) = delete;
+    auto operator=(const interner&) -> interner& = delete;
+
+    auto get(std::string_view value) -> const entry&;
+    auto at(handle id) -> const entry&;
+    void clear();
+
+    static auto intern(std::string_view value) -> const entry&;
+    static auto find(handle id) -> const entry&;
+
+private:
+    static auto current() -> interner&;
+};
+
+} // namespace xsk::utils
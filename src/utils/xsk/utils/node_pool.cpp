@@ -0,0 +1,238 @@
+// Copyright 2021 xensik. All rights reserved.
+//
+// Use of this source code is governed by a GNU GPLv3 license
+// that can be found in the LICENSE file.
+
+#include "stdafx.hpp"
+
+namespace xsk::utils
+{
+
+namespace
+{
+
+constexpr std::size_t classes = node_pool::max_size / node_pool::granularity;
+
+struct free_block
+{
+    free_block* next;
+};
+
+struct pool;
+
+// chunks are aligned to their size, the owner of a block is found from its address
+struct chunk_header
+{
+    pool* owner;
+};
+
+static_assert(sizeof(chunk_header) <= node_pool::granularity);
+
+auto new_chunk(pool* owner) -> std::uint8_t*
+{
+    auto data = static_cast<std::uint8_t*>(::operator new(node_pool::chunk_size, std::align_val_t(node_pool::chunk_size)));
+    reinterpret_cast<chunk_header*>(data)->owner = owner;
+    return data;
+}
+
+void delete_chunk(std::uint8_t* data)
+{
+    ::operator delete(data, std::align_val_t(node_pool::chunk_size));
+}
+
+auto owner_of(void* ptr) -> pool*
+{
+    const auto addr = reinterpret_cast<std::uintptr_t>(ptr) & ~(static_cast<std::uintptr_t>(node_pool::chunk_size) - 1);
+    return reinterpret_cast<chunk_header*>(addr)->owner;
+}
+
+// the free lists, the bump pointer and the live count belong to the owning thread, blocks
+// other threads free wait in the remote lists until the owner takes them back
+struct pool
+{
+    std::array<free_block*, classes> free {};
+    std::uint8_t* pos = nullptr;
+    std::uint8_t* end = nullptr;
+    std::vector<std::uint8_t*> chunks;
+    std::size_t live = 0;
+
+    std::mutex mutex;
+    std::array<free_block*, classes> remote {};
+    std::size_t remote_count = 0;
+    std::atomic<bool> has_remote = false;
+    bool orphaned = false;
+
+    ~pool()
+    {
+        for (auto chunk : chunks)
+        {
+            delete_chunk(chunk);
+        }
+    }
+
+    auto allocate(std::size_t index) -> void*
+    {
+        if (free[index] == nullptr && has_remote.load(std::memory_order_acquire))
+        {
+            reclaim();
+        }
+
+        live++;
+
+        if (free[index] != nullptr)
+        {
+            auto result = free[index];
+            free[index] = result->next;
+            return result;
+        }
+
+        const auto bytes = (index + 1) * node_pool::granularity;
+
+        if (static_cast<std::size_t>(end - pos) < bytes)
+        {
+            // the tail of the old chunk is dropped, at most max_size bytes
+            chunks.push_back(new_chunk(this));
+            pos = chunks.back() + node_pool::granularity;
+            end = chunks.back() + node_pool::chunk_size;
+        }
+
+        auto result = pos;
+        pos += bytes;
+        return result;
+    }
+
+    void deallocate(free_block* entry, std::size_t index)
+    {
+        entry->next = free[index];
+        free[index] = entry;
+
+        if (--live == 0) reset();
+    }
+
+    // called from other threads, returns true when the pool is done and must be deleted
+    auto give_back(free_block* entry, std::size_t index) -> bool
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+
+        if (orphaned)
+        {
+            return --live == 0;
+        }
+
+        entry->next = remote[index];
+        remote[index] = entry;
+        remote_count++;
+        has_remote.store(true, std::memory_order_release);
+        return false;
+    }
+
+    void reclaim()
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+
+        for (auto i = 0u; i < classes; i++)
+        {
+            while (remote[i] != nullptr)
+            {
+                auto entry = remote[i];
+                remote[i] = entry->next;
+                entry->next = free[i];
+                free[i] = entry;
+            }
+        }
+
+        live -= remote_count;
+        remote_count = 0;
+        has_remote.store(false, std::memory_order_relaxed);
+    }
+
+    // every block is free, only the newest chunk is kept for the next allocations
+    void reset()
+    {
+        if (has_remote.load(std::memory_order_acquire)) return;
+
+        free.fill(nullptr);
+
+        if (chunks.empty()) return;
+
+        for (auto i = 0u; i + 1 < chunks.size(); i++)
+        {
+            delete_chunk(chunks[i]);
+        }
+
+        chunks.erase(chunks.begin(), chunks.end() - 1);
+        pos = chunks.back() + node_pool::granularity;
+        end = chunks.back() + node_pool::chunk_size;
+    }
+
+    // the owning thread exits, returns true when nothing is left to wait for
+    auto orphan() -> bool
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+
+        live -= remote_count;
+        remote_count = 0;
+        orphaned = true;
+        return live == 0;
+    }
+};
+
+struct local_pool
+{
+    pool* data = nullptr;
+
+    ~local_pool()
+    {
+        if (data != nullptr && data->orphan())
+        {
+            delete data;
+        }
+
+        data = nullptr;
+    }
+
+    auto get() -> pool&
+    {
+        if (data == nullptr) data = new pool;
+        return *data;
+    }
+};
+
+thread_local local_pool local;
+
+} // namespace
+
+auto node_pool::allocate(std::size_t size) -> void*
+{
+    if (size == 0 || size > max_size)
+        return ::operator new(size);
+
+    return local.get().allocate((size - 1) / granularity);
+}
+
+void node_pool::deallocate(void* ptr, std::size_t size)
+{
+    if (ptr == nullptr)
+        return;
+
+    if (size == 0 || size > max_size)
+    {
+        ::operator delete(ptr);
+        return;
+    }
+
+    const auto index = (size - 1) / granularity;
+    auto owner = owner_of(ptr);
+    auto entry = static_cast<free_block*>(ptr);
+
+    if (owner == local.data)
+    {
+        owner->deallocate(entry, index);
+    }
+    else if (owner->give_back(entry, index))
+    {
+        delete owner;
+    }
+}
+
+} // namespace xsk::utils
@@ -0,0 +1,28 @@
+// Copyright 2021 xensik. All rights reserved.
+//
+// Use of this source code is governed by a GNU GPLv3 license
+// that can be found in the LICENSE file.
+
+#pragma once
+
+namespace xsk::utils
+{
+
+// size class allocator for ast nodes, each thread bumps through chunks of its own pool
+// and reuses freed blocks. nodes are still destroyed one by one, the pool only makes
+// that cheap. a block freed on another thread goes back to the pool it came from. once
+// all blocks of a pool are free, e.g. after a compile or decompile dropped its tree, the
+// pool releases its chunks and keeps only the newest, an orphaned pool is deleted after
+// its thread exits
+class node_pool
+{
+public:
+    static constexpr std::size_t granularity = 16;
+    static constexpr std::size_t max_size = 512;
+    static constexpr std::size_t chunk_size = 64 * 1024;
+
+    static auto allocate(std::size_t size) -> void*;
+    static void deallocate(void* ptr, std::size_t size);
+};
+
+} // namespace xsk::utils
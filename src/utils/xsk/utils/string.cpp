@@ -187,44 +187,4 @@ auto string::split(std::string& str, char delimiter) -> std::vector<std::string>
     return tokens;
 }
 
-auto string::clean_buffer_lines(std::vector<std::uint8_t>& buffer) -> std::vector<std::string>
-{
-    std::string data = std::string(reinterpret_cast<char*>(buffer.data()), buffer.size());
-    std::size_t pos;
-
-    while ((pos = data.find("\t")) != std::string::npos)
-    {
-        data = data.replace(pos, 1, "");
-    }
-
-    while ((pos = data.find("\r")) != std::string::npos)
-    {
-        data = data.replace(pos, 1, "");
-    }
-
-    std::vector<std::string> lines;
-    std::stringstream ss(data);
-    std::string tok;
-
-    while (std::getline(ss, tok, '\n'))
-    {
-        lines.push_back(tok);
-    }
-
-    return lines;
-}
-
-auto string::parse_code(std::string& line) -> std::vector<std::string>
-{
-    std::vector<std::string> data;
-    std::regex exp(R"(([_A-Za-z0-9\-]+|\"(?:\\.|[^\"])*?\"|\'(?:\\.|[^\'])*?\')(?:\s+|$))");
-
-    for (auto i = std::sregex_iterator(line.begin(), line.end(), exp); i != std::sregex_iterator(); ++i)
-    {
-        data.push_back(i->format("$1"));
-    }
-
-    return data;
-}
-
 } // namespace xsk::utils
@@ -35,8 +35,6 @@ public:
     static auto quote(const std::string& s, bool single = true) -> std::string;
     static auto unquote(const std::string& s) -> std::string;
     static auto split(std::string& str, char delimiter) -> std::vector<std::string>;
-    static auto clean_buffer_lines(std::vector<std::uint8_t>& buffer) -> std::vector<std::string>;
-    static auto parse_code(std::string& line) -> std::vector<std::string>;
 };
 
 } // namespace xsk::utils
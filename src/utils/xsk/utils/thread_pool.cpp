@@ -0,0 +1,240 @@
+// Copyright 2021 xensik. All rights reserved.
+//
+// Use of this source code is governed by a GNU GPLv3 license
+// that can be found in the LICENSE file.
+
+#include "stdafx.hpp"
+
+namespace xsk::utils
+{
+
+thread_local thread_pool* current_pool = nullptr;
+thread_local std::size_t current_index = 0;
+
+thread_pool::thread_pool(std::size_t count) : queued_(0), active_(0), next_(0), stop_(false)
+{
+    if (count == 0) count = 1;
+
+    for (std::size_t i = 0; i < count; i++)
+    {
+        queues_.push_back(std::make_unique<queue>());
+    }
+
+    for (std::size_t i = 0; i < count; i++)
+    {
+        threads_.emplace_back([this, i] { run(i); });
+    }
+}
+
+thread_pool::~thread_pool()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stop_ = true;
+    }
+
+    work_cv_.notify_all();
+
+    for (auto& thread : threads_)
+    {
+        thread.join();
+    }
+}
+
+void thread_pool::submit(task func)
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+
+        // tasks spawned by a worker stay on its own queue, others are dealt round-robin
+        auto spawned = (current_pool == this);
+        auto index = spawned ? current_index : next_++ % queues_.size();
+
+        {
+            std::lock_guard<std::mutex> qlock(queues_[index]->mutex);
+
+            // the owner pops from the back, dealt tasks go in front so they still run in submission order
+            if (spawned)
+                queues_[index]->tasks.push_back(std::move(func));
+            else
+                queues_[index]->tasks.push_front(std::move(func));
+        }
+
+        queued_++;
+        active_++;
+    }
+
+    work_cv_.notify_one();
+}
+
+void thread_pool::wait()
+{
+    std::unique_lock<std::mutex> lock(mutex_);
+    idle_cv_.wait(lock, [this] { return active_ == 0; });
+
+    if (error_)
+    {
+        auto error = error_;
+        error_ = nullptr;
+        std::rethrow_exception(error);
+    }
+}
+
+// the caller takes indices too, so it never blocks on helpers still sitting in a queue
+void thread_pool::parallel_for(std::size_t count, const std::function<void(std::size_t)>& func)
+{
+    struct state
+    {
+        const std::function<void(std::size_t)>* func;
+        std::atomic<std::size_t> next;
+        std::size_t count;
+        std::size_t remaining;
+        std::vector<std::exception_ptr> errors;
+        std::mutex mutex;
+        std::condition_variable cv;
+    };
+
+    if (count == 0) return;
+
+    auto data = std::make_shared<state>();
+    data->func = &func;
+    data->next = 0;
+    data->count = count;
+    data->remaining = count;
+    data->errors.resize(count);
+
+    auto work = [data]
+    {
+        for (auto i = data->next++; i < data->count; i = data->next++)
+        {
+            try
+            {
+                (*data->func)(i);
+            }
+            catch (...)
+            {
+                data->errors[i] = std::current_exception();
+            }
+
+            std::lock_guard<std::mutex> lock(data->mutex);
+
+            if (--data->remaining == 0)
+            {
+                data->cv.notify_all();
+            }
+        }
+    };
+
+    for (std::size_t i = 1; i < std::min(count, threads_.size()); i++)
+    {
+        submit(work);
+    }
+
+    work();
+
+    {
+        std::unique_lock<std::mutex> lock(data->mutex);
+        data->cv.wait(lock, [&] { return data->remaining == 0; });
+    }
+
+    // report the error the sequential order would have hit first
+    for (auto& error : data->errors)
+    {
+        if (error) std::rethrow_exception(error);
+    }
+}
+
+auto thread_pool::size() const -> std::size_t
+{
+    return threads_.size();
+}
+
+auto thread_pool::hardware_threads() -> std::size_t
+{
+    auto count = std::thread::hardware_concurrency();
+    return count == 0 ? 1 : count;
+}
+
+void thread_pool::run(std::size_t index)
+{
+    current_pool = this;
+    current_index = index;
+
+    while (true)
+    {
+        task func;
+
+        if (take(index, func))
+        {
+            // a throwing task must not leave the pool busy forever, keep the first error for wait()
+            auto error = std::exception_ptr{};
+
+            try
+            {
+                func();
+            }
+            catch (...)
+            {
+                error = std::current_exception();
+            }
+
+            std::lock_guard<std::mutex> lock(mutex_);
+
+            if (error && !error_) error_ = error;
+
+            if (--active_ == 0)
+            {
+                idle_cv_.notify_all();
+            }
+
+            continue;
+        }
+
+        std::unique_lock<std::mutex> lock(mutex_);
+        work_cv_.wait(lock, [this] { return stop_ || queued_ > 0; });
+
+        if (stop_ && queued_ == 0) return;
+    }
+}
+
+auto thread_pool::take(std::size_t index, task& func) -> bool
+{
+    auto found = false;
+
+    {
+        auto& own = *queues_[index];
+        std::lock_guard<std::mutex> lock(own.mutex);
+
+        // the owner works LIFO on its newest task, which is still warm in cache
+        if (!own.tasks.empty())
+        {
+            func = std::move(own.tasks.back());
+            own.tasks.pop_back();
+            found = true;
+        }
+    }
+
+    // thieves take the oldest task from the front, usually the largest one left
+    for (std::size_t i = 1; !found && i < queues_.size(); i++)
+    {
+        auto& victim = *queues_[(index + i) % queues_.size()];
+        std::lock_guard<std::mutex> lock(victim.mutex);
+
+        if (!victim.tasks.empty())
+        {
+            func = std::move(victim.tasks.front());
+            victim.tasks.pop_front();
+            found = true;
+        }
+    }
+
+    if (found)
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        queued_--;
+    }
+
+    return found;
+}
+
+} // namespace xsk::utils
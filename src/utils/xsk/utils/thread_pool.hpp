@@ -0,0 +1,48 @@
+// Copyright 2021 xensik. All rights reserved.
+//
+// Use of this source code is governed by a GNU GPLv3 license
+// that can be found in the LICENSE file.
+
+#pragma once
+
+namespace xsk::utils
+{
+
+class thread_pool
+{
+public:
+    using task = std::function<void()>;
+
+private:
+    struct queue
+    {
+        std::mutex mutex;
+        std::deque<task> tasks;
+    };
+
+    std::vector<std::unique_ptr<queue>> queues_;
+    std::vector<std::thread> threads_;
+    std::mutex mutex_;
+    std::condition_variable work_cv_;
+    std::condition_variable idle_cv_;
+    std::size_t queued_;
+    std::size_t active_;
+    std::size_t next_;
+    std::exception_ptr error_;
+    bool stop_;
+
+public:
+    thread_pool(std::size_t count);
+    ~thread_pool();
+    void submit(task func);
+    void wait();
+    void parallel_for(std::size_t count, const std::function<void(std::size_t)>& func);
+    auto size() const -> std::size_t;
+    static auto hardware_threads() -> std::size_t;
+
+private:
+    void run(std::size_t index);
+    auto take(std::size_t index, task& func) -> bool;
+};
+
+} // namespace xsk::utils
@@ -0,0 +1,87 @@
+#!/bin/sh
+# Copyright 2021 xensik. All rights reserved.
+#
+# Use of this source code is governed by a GNU GPLv3 license
+# that can be found in the LICENSE file.
+
+# usage: tests/run.sh <path to gsc-tool>
+#
+# every tests/<game>/<name>.gsc is compiled and every <name>.gscasm assembled, with the
+# flags on a first line '// flags: ...', then decompiled. the output must match
+# <name>.expected, or the decompiler must fail with the message in <name>.error.
+# a compiled test with a <name>.gscasm.expected must also disassemble to that listing.
+# with --emit-ir in the flags the test.gscir written is decompiled with --from-ir instead
+
+tool=$1
+root=$(cd "$(dirname "$0")" && pwd)
+work=$(mktemp -d)
+failed=0
+
+trap 'rm -rf "$work"' EXIT
+
+if [ -z "$tool" ]; then
+    echo "usage: $0 <gsc-tool>"
+    exit 1
+fi
+
+for src in "$root"/*/*.gsc "$root"/*/*.gscasm; do
+    [ -f "$src" ] || continue
+
+    game=$(basename "$(dirname "$src")")
+    file=$(basename "$src")
+    name=${file%.*}
+    ext=${file##*.}
+    flags=$(sed -n '1s|^// flags:||p' "$src")
+    mode=comp
+    input=gscbin
+    decomp=
+
+    [ "$ext" = "gscasm" ] && mode=asm
+
+    case " $flags " in
+        *" --emit-ir "*) input=gscir; decomp=--from-ir;;
+    esac
+
+    rm -rf "$work/case" && mkdir "$work/case"
+    cp "$src" "$work/case/test.$ext"
+
+    if ! "$tool" $flags $mode "$game" "$work/case/test.$ext" < /dev/null > "$work/log" 2>&1; then
+        echo "FAIL $game/$name: $mode"
+        cat "$work/log"
+        failed=1
+        continue
+    fi
+
+    # the decompiled test.gsc must not run into the overwrite prompt
+    rm "$work/case/test.$ext"
+
+    if [ -f "$root/$game/$name.gscasm.expected" ]; then
+        "$tool" disasm "$game" "$work/case/test.gscbin" < /dev/null > "$work/log" 2>&1
+
+        if ! diff -u "$root/$game/$name.gscasm.expected" "$work/case/test.gscasm"; then
+            echo "FAIL $game/$name: disasm"
+            cat "$work/log"
+            failed=1
+            continue
+        fi
+    fi
+
+    "$tool" $decomp decomp "$game" "$work/case/test.$input" < /dev/null > "$work/log" 2>&1
+
+    if [ -f "$root/$game/$name.error" ]; then
+        if ! grep -qF "$(cat "$root/$game/$name.error")" "$work/log"; then
+            echo "FAIL $game/$name: expected error '$(cat "$root/$game/$name.error")'"
+            cat "$work/log"
+            failed=1
+            continue
+        fi
+    elif ! diff -u "$root/$game/$name.expected" "$work/case/test.gsc"; then
+        echo "FAIL $game/$name"
+        failed=1
+        continue
+    fi
+
+    echo "ok   $game/$name"
+done
+
+exit $failed